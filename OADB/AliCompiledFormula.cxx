@@ -0,0 +1,268 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//-------------------------------------------------------------------------
+//     Formula compiled to a small stack program, see the header
+//-------------------------------------------------------------------------
+
+#include <cctype>
+#include <cstdlib>
+
+#include <TMath.h>
+
+#include "AliCompiledFormula.h"
+
+namespace {
+  inline Bool_t IsNameStart(char c) { return isalpha(c) || c == '_'; }
+  inline Bool_t IsNameChar(char c)  { return isalnum(c) || c == '_'; }
+}
+
+//_____________________________________________________________________________
+AliCompiledFormula::AliCompiledFormula() :
+  fCode(),
+  fConstants(),
+  fNames(),
+  fMaxDepth(0),
+  fValid(kFALSE),
+  fPos(0)
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+Bool_t AliCompiledFormula::Compile(const char* expression)
+{
+  // compiles the expression, returns kFALSE if it contains constructs
+  // which are not supported
+  fCode.clear();
+  fConstants.clear();
+  fNames.clear();
+  fMaxDepth = 0;
+  fPos = expression;
+  fValid = ParseBinary(0);
+  SkipSpaces();
+  if (*fPos) fValid = kFALSE;
+  if (fCode.empty()) fValid = kFALSE;
+  fPos = 0;
+
+  // stack depth
+  Int_t depth = 0;
+  for (size_t i = 0; fValid && i < fCode.size(); i += 2) {
+    Int_t op = fCode[i];
+    if (op == kName || op == kConst) depth++;
+    else if (op >= kAdd) depth--;
+    if (depth > fMaxDepth) fMaxDepth = depth;
+  }
+  if (fMaxDepth > kMaxDepth) fValid = kFALSE;
+  return fValid;
+}
+
+//_____________________________________________________________________________
+void AliCompiledFormula::SetOperands(const std::vector<Int_t>& operands)
+{
+  // name i is taken from operands[i] of the operand array; to be called once after Compile
+  for (size_t pc = 0; pc < fCode.size(); pc += 2)
+    if (fCode[pc] == kName) fCode[pc+1] = operands[fCode[pc+1]];
+}
+
+//_____________________________________________________________________________
+Int_t AliCompiledFormula::MatchOperator(Int_t level)
+{
+  // binary operator with precedence level at the current position, -1 if none
+  SkipSpaces();
+  if (!*fPos) return -1;
+  const char c = fPos[0], n = fPos[1];
+  switch (level) {
+    case 0: if (c == '|' && n == '|') { fPos += 2; return kOr;  } break;
+    case 1: if (c == '&' && n == '&') { fPos += 2; return kAnd; } break;
+    case 2: if (c == '=' && n == '=') { fPos += 2; return kEq;  }
+            if (c == '!' && n == '=') { fPos += 2; return kNe;  } break;
+    case 3: if (c == '<' && n == '=') { fPos += 2; return kLe;  }
+            if (c == '>' && n == '=') { fPos += 2; return kGe;  }
+            if (c == '<' && n != '<') { fPos += 1; return kLt;  }
+            if (c == '>' && n != '>') { fPos += 1; return kGt;  } break;
+    case 4: if (c == '+') { fPos += 1; return kAdd; }
+            if (c == '-') { fPos += 1; return kSub; } break;
+    case 5: if (c == '*' && n != '*') { fPos += 1; return kMul; }
+            if (c == '/') { fPos += 1; return kDiv; } break;
+  }
+  return -1;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCompiledFormula::ParseBinary(Int_t level)
+{
+  if (level > 5) return ParseUnary();
+  if (!ParseBinary(level+1)) return kFALSE;
+  Int_t op;
+  while ((op = MatchOperator(level)) >= 0) {
+    if (!ParseBinary(level+1)) return kFALSE;
+    Emit(op);
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliCompiledFormula::ParseUnary()
+{
+  SkipSpaces();
+  if (*fPos == '-') { fPos++; if (!ParseUnary()) return kFALSE; Emit(kNeg); return kTRUE; }
+  if (*fPos == '+') { fPos++; return ParseUnary(); }
+  if (*fPos == '!' && fPos[1] != '=') { fPos++; if (!ParseUnary()) return kFALSE; Emit(kNot); return kTRUE; }
+  return ParsePrimary();
+}
+
+//_____________________________________________________________________________
+Bool_t AliCompiledFormula::ParsePrimary()
+{
+  SkipSpaces();
+  if (*fPos == '(') {
+    fPos++;
+    if (!ParseBinary(0)) return kFALSE;
+    SkipSpaces();
+    if (*fPos != ')') return kFALSE;
+    fPos++;
+    return kTRUE;
+  }
+  if (isdigit(*fPos) || *fPos == '.') {
+    char* end = 0;
+    Double_t value = strtod(fPos, &end);
+    if (end == fPos) return kFALSE;
+    fPos = end;
+    Emit(kConst, fConstants.size());
+    fConstants.push_back(value);
+    return kTRUE;
+  }
+  if (IsNameStart(*fPos)) {
+    const char* begin = fPos;
+    while (IsNameChar(*fPos)) fPos++;
+    std::string name(begin, fPos - begin);
+    SkipSpaces();
+    if (*fPos == '(' || *fPos == ':') return kFALSE; // function
+    size_t index = 0;
+    while (index < fNames.size() && fNames[index] != name) index++;
+    if (index == fNames.size()) fNames.push_back(name);
+    Emit(kName, index);
+    return kTRUE;
+  }
+  return kFALSE;
+}
+
+//_____________________________________________________________________________
+Double_t AliCompiledFormula::Apply(Int_t op, Double_t a, Double_t b)
+{
+  // binary operation
+  switch (op) {
+    case kAdd: return a + b;
+    case kSub: return a - b;
+    case kMul: return a * b;
+    case kDiv: return a / b;
+    case kLt:  return a <  b;
+    case kLe:  return a <= b;
+    case kGt:  return a >  b;
+    case kGe:  return a >= b;
+    case kEq:  return a == b;
+    case kNe:  return a != b;
+    case kAnd: return a && b;
+    case kOr:  return a || b;
+  }
+  return 0;
+}
+
+//_____________________________________________________________________________
+Double_t AliCompiledFormula::Evaluate(const Double_t* operands) const
+{
+  Double_t stack[kMaxDepth];
+  Int_t sp = 0;
+  const Int_t size = fCode.size();
+  for (Int_t pc = 0; pc < size; pc += 2) {
+    switch (fCode[pc]) {
+      case kName:  stack[sp++] = operands[fCode[pc+1]]; break;
+      case kConst: stack[sp++] = fConstants[fCode[pc+1]]; break;
+      case kNeg:   stack[sp-1] = -stack[sp-1]; break;
+      case kNot:   stack[sp-1] = !stack[sp-1]; break;
+      default:     sp--; stack[sp-1] = Apply(fCode[pc], stack[sp-1], stack[sp]); break;
+    }
+  }
+  return stack[0];
+}
+
+//_____________________________________________________________________________
+void AliCompiledFormula::Evaluate(Long_t nEvents, Long_t stride, const Double_t* operands, Double_t* out, Long_t outStride) const
+{
+  // operation-wise over blocks of events: every operation is a simple loop
+  const Long_t block = 256;
+  std::vector<Double_t> stack(fMaxDepth * block);
+  const Int_t size = fCode.size();
+  for (Long_t first = 0; first < nEvents; first += block) {
+    const Long_t n = TMath::Min(block, nEvents - first);
+    const Double_t* in = operands + first*stride;
+    Int_t sp = 0;
+    for (Int_t pc = 0; pc < size; pc += 2) {
+      const Int_t op = fCode[pc], arg = fCode[pc+1];
+      if (op == kName) {
+        Double_t* s = &stack[sp++*block];
+        for (Long_t i = 0; i < n; i++) s[i] = in[i*stride + arg];
+      } else if (op == kConst) {
+        Double_t* s = &stack[sp++*block];
+        for (Long_t i = 0; i < n; i++) s[i] = fConstants[arg];
+      } else if (op == kNeg || op == kNot) {
+        Double_t* s = &stack[(sp-1)*block];
+        if (op == kNeg) for (Long_t i = 0; i < n; i++) s[i] = -s[i];
+        else            for (Long_t i = 0; i < n; i++) s[i] = !s[i];
+      } else {
+        sp--;
+        Double_t*       a = &stack[(sp-1)*block];
+        const Double_t* b = &stack[sp*block];
+        switch (op) {
+          case kAdd: for (Long_t i = 0; i < n; i++) a[i] += b[i]; break;
+          case kSub: for (Long_t i = 0; i < n; i++) a[i] -= b[i]; break;
+          case kMul: for (Long_t i = 0; i < n; i++) a[i] *= b[i]; break;
+          case kDiv: for (Long_t i = 0; i < n; i++) a[i] /= b[i]; break;
+          default:   for (Long_t i = 0; i < n; i++) a[i] = Apply(op, a[i], b[i]); break;
+        }
+      }
+    }
+    for (Long_t i = 0; i < n; i++) out[(first+i)*outStride] = stack[i];
+  }
+}
+
+//_____________________________________________________________________________
+TString AliCompiledFormula::ReplaceNames(const char* expression, const std::map<std::string, std::string>& replacements)
+{
+  // replaces the whole names found in replacements (e.g. by TFormula parameters "[i]"),
+  // a name being a part of a longer one is not replaced (fAmplitude_V0A in fAmplitude_V0AEq)
+  TString result;
+  const char* pos = expression;
+  while (*pos) {
+    if (IsNameStart(*pos)) {
+      const char* begin = pos;
+      while (IsNameChar(*pos)) pos++;
+      std::string name(begin, pos - begin);
+      std::map<std::string, std::string>::const_iterator it = replacements.find(name);
+      result += (it != replacements.end()) ? it->second.c_str() : name.c_str();
+    }
+    else if (isdigit(*pos) || *pos == '.') {
+      // numbers, including exponents (1e5), are copied as they are
+      char* end = 0;
+      strtod(pos, &end);
+      if (end == pos) end = const_cast<char*>(pos) + 1;
+      result.Append(pos, end - pos);
+      pos = end;
+    }
+    else result.Append(*pos++);
+  }
+  return result;
+}
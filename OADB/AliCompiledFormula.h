@@ -0,0 +1,66 @@
+#ifndef ALICOMPILEDFORMULA_H
+#define ALICOMPILEDFORMULA_H
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//-------------------------------------------------------------------------
+//     Formula compiled to a small stack program
+// Used for the OADB strings evaluated on every event: the trigger logic of
+// AliPhysicsSelection ("V0A && V0C && !TPCHVdip") and the definitions of
+// the AliMultEstimator ("(fAmplitude_V0A)+(fAmplitude_V0C)").
+// Grammar, with C precedence: names, numbers, parenthesis, unary - + !,
+// * /, + -, < <= > >=, == !=, &&, ||. Anything else (functions, ^, ...)
+// is not compiled and is left to TFormula by the users.
+// A name is an identifier ([A-Za-z_][A-Za-z0-9_]*), with or without
+// parenthesis around it; ReplaceNames() applies the same rule when the
+// names are substituted for TFormula.
+//-------------------------------------------------------------------------
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <TString.h>
+
+class AliCompiledFormula
+{
+ public:
+  enum EOp { kName, kConst, kNeg, kNot, kAdd, kSub, kMul, kDiv,
+             kLt, kLe, kGt, kGe, kEq, kNe, kAnd, kOr };
+  enum { kMaxDepth = 64 };
+
+  AliCompiledFormula();
+
+  Bool_t Compile(const char* expression);
+  Bool_t IsValid() const { return fValid; }
+
+  // names in the order of first appearance; by default name i is operand i,
+  // SetOperands() maps them to other positions of the operand array
+  const std::vector<std::string>& GetNames() const { return fNames; }
+  void SetOperands(const std::vector<Int_t>& operands);
+
+  Double_t Evaluate(const Double_t* operands) const;
+  // nEvents sets of operands, operands[iEv*stride+i] -> out[iEv*outStride]
+  void Evaluate(Long_t nEvents, Long_t stride, const Double_t* operands, Double_t* out, Long_t outStride = 1) const;
+
+  static Double_t Apply(Int_t op, Double_t a, Double_t b);
+  // replace the names given in replacements (same rule as in Compile)
+  static TString ReplaceNames(const char* expression, const std::map<std::string, std::string>& replacements);
+
+ private:
+  void   SkipSpaces() { while (*fPos == ' ' || *fPos == '\t' || *fPos == '\n') fPos++; }
+  void   Emit(Int_t op, Int_t arg = 0) { fCode.push_back(op); fCode.push_back(arg); }
+  Int_t  MatchOperator(Int_t level);
+  Bool_t ParseBinary(Int_t level);
+  Bool_t ParseUnary();
+  Bool_t ParsePrimary();
+
+  std::vector<Int_t>       fCode;      // (operation, argument) pairs
+  std::vector<Double_t>    fConstants; // constants used by the program
+  std::vector<std::string> fNames;     // names in the order of first appearance
+  Int_t                    fMaxDepth;  // stack depth needed
+  Bool_t                   fValid;     // compiled successfully
+  const char*              fPos;       // parser position
+};
+
+#endif
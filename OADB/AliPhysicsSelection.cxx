@@ -85,6 +85,7 @@
 #endif
 
 #include "AliPhysicsSelection.h"
+#include "AliCompiledFormula.h"
 
 #include "AliTriggerAnalysis.h"
 #include "AliLog.h"
@@ -111,6 +112,59 @@
 
 class StringToRegexp : public std::map<std::string, TPRegexp> {};
 
+// Trigger logic compiled with AliCompiledFormula, on the values of the
+// AliTriggerAnalysis bits corresponding to its names
+struct TriggerProgram {
+  enum { kMaxBits = 64 };
+  AliCompiledFormula                       fFormula; // compiled trigger logic
+  std::vector<AliTriggerAnalysis::Trigger> fBits;    // trigger bits corresponding to the names of fFormula
+};
+
+class StringToTriggerProgram : public std::map<std::string, TriggerProgram> {};
+
+// Values of the trigger bits evaluated for the current event, indexed by
+// AliTriggerAnalysis instance (they can be configured differently, e.g.
+// with SetSPDGFOEfficiency), trigger bit and online/offline. Entries are
+// valid if their stamp equals the current event stamp.
+class TriggerBitCache {
+public:
+  enum { kNSlots = 2 * AliTriggerAnalysis::kStartOfFlags };
+
+  TriggerBitCache() : fEventStamp(1), fInstances() {}
+
+  void NewEvent() { if (++fEventStamp == 0) { fInstances.clear(); fEventStamp = 1; } }
+  Int_t Get(const AliVEvent* event, AliTriggerAnalysis* triggerAnalysis, AliTriggerAnalysis::Trigger bit, Bool_t offline) {
+    Instance& instance = Find(triggerAnalysis);
+    UInt_t slot = (UInt_t) bit % (UInt_t) AliTriggerAnalysis::kStartOfFlags + (offline ? (UInt_t) AliTriggerAnalysis::kStartOfFlags : 0);
+    if (instance.fStamp[slot] != fEventStamp) {
+      UInt_t flag = offline ? (UInt_t) AliTriggerAnalysis::kOfflineFlag : 0;
+      instance.fValue[slot] = triggerAnalysis->EvaluateTrigger(event, static_cast<AliTriggerAnalysis::Trigger>(bit | flag));
+      instance.fStamp[slot] = fEventStamp;
+    }
+    return instance.fValue[slot];
+  }
+
+private:
+  struct Instance {
+    const AliTriggerAnalysis* fTriggerAnalysis; // instance the values were evaluated with
+    UInt_t fStamp[kNSlots];                     // stamp of the event for which the value was evaluated
+    Int_t  fValue[kNSlots];                     // value of the trigger bit
+  };
+  Instance& Find(const AliTriggerAnalysis* triggerAnalysis) {
+    // a handful of instances: linear search
+    for (size_t i = 0; i < fInstances.size(); i++)
+      if (fInstances[i].fTriggerAnalysis == triggerAnalysis) return fInstances[i];
+    fInstances.resize(fInstances.size() + 1);
+    Instance& instance = fInstances.back();
+    instance.fTriggerAnalysis = triggerAnalysis;
+    for (Int_t i = 0; i < kNSlots; i++) instance.fStamp[i] = 0;
+    return instance;
+  }
+
+  UInt_t                fEventStamp; // stamp of the current event
+  std::vector<Instance> fInstances;  // cached values per AliTriggerAnalysis instance
+};
+
 ClassImp(AliPhysicsSelection)
 
 AliPhysicsSelection::AliPhysicsSelection() :
@@ -132,6 +186,8 @@ fPSOADB(0),
 fFillOADB(0),
 fTriggerOADB(0),
 fTriggerToFormula(new StringToFormula()),
+fTriggerToProgram(new StringToTriggerProgram()),
+fTriggerBits(new TriggerBitCache()),
 fTriggerToRegexp(new StringToRegexp())
 {
   // constructor
@@ -162,6 +218,8 @@ AliPhysicsSelection::AliPhysicsSelection(const char *name) :
  fFillOADB(0),
  fTriggerOADB(0),
  fTriggerToFormula(new StringToFormula()),
+ fTriggerToProgram(new StringToTriggerProgram()),
+ fTriggerBits(new TriggerBitCache()),
  fTriggerToRegexp(new StringToRegexp())
  {
    // constructor
@@ -178,6 +236,8 @@ AliPhysicsSelection::~AliPhysicsSelection(){
   if (fFillOADB)     delete fFillOADB;
   if (fTriggerOADB)  delete fTriggerOADB;
   delete fTriggerToFormula;
+  delete fTriggerToProgram;
+  delete fTriggerBits;
   delete fTriggerToRegexp;
 }
 
@@ -266,10 +326,22 @@ UInt_t AliPhysicsSelection::CheckTriggerClass(const AliVEvent* event, const char
 /// \param triggerLogic Describing trigger logic; e.g. "V0A && V0C && ZDCTime && !TPCHVdip"
 /// \param offline Offline analysis(?)
 ///
+/// The trigger bits are taken from the per-event cache, so that a bit
+/// used by several trigger classes is evaluated only once per event.
+/// Trigger logic which cannot be compiled is evaluated with TFormula.
+///
 /// \return True if the given event matches the trigger logic
 Bool_t AliPhysicsSelection::EvaluateTriggerLogic(const AliVEvent* event,
 						 AliTriggerAnalysis* triggerAnalysis,
 						 const char* triggerLogic, Bool_t offline){
+  const TriggerProgram* program = FindProgram(triggerLogic);
+  if (program) {
+    Double_t values[TriggerProgram::kMaxBits];
+    for (size_t i = 0; i < program->fBits.size(); i++)
+      values[i] = fTriggerBits->Get(event, triggerAnalysis, program->fBits[i], offline);
+    return program->fFormula.Evaluate(values);
+  }
+
   auto& formula_and_bits = FindForumla(triggerLogic);
   auto& trg_formula = formula_and_bits.first;
   auto& bits = formula_and_bits.second;
@@ -302,6 +374,9 @@ UInt_t AliPhysicsSelection::IsCollisionCandidate(const AliVEvent* event){
     if (eventType != 7) return kFALSE;
   }
   
+  // trigger bits are evaluated at most once per event for all classes
+  fTriggerBits->NewEvent();
+  
   UInt_t accept = 0;
   Int_t nColl = fCollTrigClasses.GetEntries();
   Int_t nBG   = fBGTrigClasses.GetEntries();
@@ -876,6 +951,31 @@ FormulaAndBits& AliPhysicsSelection::FindForumla(const char* triggerLogic) {
   return it->second;
 }
 
+const TriggerProgram* AliPhysicsSelection::FindProgram(const char* triggerLogic) {
+  // Do we have this logic compiled? If not, compile it
+  auto it = fTriggerToProgram->find(triggerLogic);
+  if (it == fTriggerToProgram->end()) {
+    it = fTriggerToProgram->emplace(std::string(triggerLogic), TriggerProgram()).first;
+    TriggerProgram& program = it->second;
+    if (!program.fFormula.Compile(triggerLogic) || program.fFormula.GetNames().size() > TriggerProgram::kMaxBits) {
+      AliInfo(Form("Trigger logic %s evaluated with TFormula", triggerLogic));
+      program.fBits.clear();
+      return 0;
+    }
+    for (const std::string& name : program.fFormula.GetNames()) {
+      TInterpreter::EErrorCode error;
+      Int_t bit = gInterpreter->ProcessLine(Form("AliTriggerAnalysis::k%s;", name.c_str()), &error);
+
+      if (error > 0)
+	AliFatal(Form("Trigger token %s unknown", name.c_str()));
+
+      program.fBits.push_back(static_cast<AliTriggerAnalysis::Trigger>(bit));
+    }
+  }
+  const TriggerProgram& program = it->second;
+  return (program.fFormula.IsValid() && program.fBits.size() == program.fFormula.GetNames().size()) ? &program : 0;
+}
+
 TPRegexp& AliPhysicsSelection::FindRegexp(const std::string& triggers) const {
   auto it = fTriggerToRegexp->find(triggers);
   if (it != fTriggerToRegexp->end())
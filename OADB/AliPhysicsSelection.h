@@ -45,6 +45,9 @@ class AliOADBFillingScheme;
 class AliOADBTriggerAnalysis;
 class TPRegexp;
 class StringToRegexp;
+struct TriggerProgram;
+class StringToTriggerProgram;
+class TriggerBitCache;
 
 typedef std::pair<R5TFormula, std::vector<AliTriggerAnalysis::Trigger>> FormulaAndBits;
 typedef std::map<std::string, FormulaAndBits> StringToFormula;
@@ -125,10 +128,14 @@ protected:
   StringToFormula *fTriggerToFormula; //! Map trigger strings to TFormulas
   FormulaAndBits& FindForumla(const char* triggerLogic); //! Returns pair of TFormula and trigger bits
 
+  StringToTriggerProgram* fTriggerToProgram; //! Map trigger strings to compiled trigger logic
+  TriggerBitCache* fTriggerBits;             //! Trigger bits evaluated for the current event
+  const TriggerProgram* FindProgram(const char* triggerLogic); //! Returns compiled trigger logic (0 if only available as TFormula)
+
   StringToRegexp* fTriggerToRegexp; //!
   TPRegexp& FindRegexp(const std::string& triggers) const;
 
-  ClassDef(AliPhysicsSelection, 24)
+  ClassDef(AliPhysicsSelection, 25)
 private:
   AliPhysicsSelection(const AliPhysicsSelection&);
   AliPhysicsSelection& operator=(const AliPhysicsSelection&);
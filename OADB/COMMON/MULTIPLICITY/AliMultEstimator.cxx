@@ -19,19 +19,24 @@
 #include "TObjString.h"
 #include "TBrowser.h"
 #include "TFormula.h"
+#include "TMath.h"
 #include "RVersion.h"
+#include "AliCompiledFormula.h"
+#include <map>
+#include <string>
+#include <vector>
 
 ClassImp(AliMultEstimator);
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
-  TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+  TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0), fCompiled(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
   
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
-TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0), fCompiled(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,11 +51,13 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fCompiled(0),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
 {
   if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+  if (e.fCompiled) fCompiled = new AliCompiledFormula(*e.fCompiled);
 }
 //________________________________________________________________
 AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
@@ -67,6 +74,9 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    if (fCompiled) delete fCompiled;
+    fCompiled = 0;
+    if (e.fCompiled) fCompiled = new AliCompiledFormula(*e.fCompiled);
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -96,6 +106,7 @@ void AliMultEstimator::Set(const AliMultEstimator* e)
 AliMultEstimator::~AliMultEstimator(){
   // destructor
   if (fFormula) delete fFormula;   
+  if (fCompiled) delete fCompiled;
 }
 //________________________________________________________________
 Float_t AliMultEstimator::GetZ() const {
@@ -109,26 +120,78 @@ Float_t AliMultEstimator::GetZ() const {
 //________________________________________________________________
 void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
 {
-    TString expr = fDefinition;
+    //Both the TFormula and the compiled definition take the whole names
+    //of the variables as such, with or without parenthesis around them
+    //(see AliCompiledFormula::ReplaceNames)
+    std::map<std::string, std::string> lParameters;
     Int_t   nVar = lInput->GetNVariables();
-    for (Int_t i = 0; i < nVar; i++) {
-        TString repl(Form("[%d]", i));
-        TString lVarName = lInput->GetVariable(i)->GetName();
-        //IMPORTANT: this is necessary as names may have a common component!
-        //Example: fAmplitude_V0A and fAmplitude_V0AEq
-        //Required in syntax: parenthesis around all variables
-        lVarName.Append (")");
-        lVarName.Prepend("(");
-        expr.ReplaceAll(lVarName, repl);
-    }
+    for (Int_t i = 0; i < nVar; i++)
+        lParameters[lInput->GetVariable(i)->GetName()] = Form("[%d]", i);
+    TString expr = AliCompiledFormula::ReplaceNames(fDefinition.Data(), lParameters);
+    if (fFormula) delete fFormula;
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
 #endif
+    if (!Compile(lInput))
+        Printf("AliMultEstimator %s: definition %s evaluated with TFormula", GetName(), fDefinition.Data());
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::Compile(const AliMultInput* lInput)
+{
+    //Compile the definition into a stack program on the variable slots
+    if (fCompiled) delete fCompiled;
+    fCompiled = 0;
+    
+    std::map<std::string, Int_t> lVars;
+    for (Int_t i = 0; i < lInput->GetNVariables(); i++)
+        lVars[lInput->GetVariable(i)->GetName()] = i;
+    
+    AliCompiledFormula* lCompiled = new AliCompiledFormula();
+    if (!lCompiled->Compile(fDefinition.Data())) { delete lCompiled; return kFALSE; }
+    std::vector<Int_t> lSlots;
+    for (size_t i = 0; i < lCompiled->GetNames().size(); i++) {
+        std::map<std::string, Int_t>::const_iterator it = lVars.find(lCompiled->GetNames()[i]);
+        if (it == lVars.end()) { delete lCompiled; return kFALSE; } //not a variable
+        lSlots.push_back(it->second);
+    }
+    lCompiled->SetOperands(lSlots);
+    fCompiled = lCompiled;
+    return kTRUE;
 }
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
 {
+    if (!IsCompiled()) return EvaluateFormula(lInput);
+    std::vector<Double_t> lValues(lInput->GetNVariables() + 1);
+    lInput->GetValues(&lValues[0]);
+    return Evaluate(&lValues[0]);
+}
+//________________________________________________________________
+Float_t AliMultEstimator::Evaluate(const Double_t* lValues)
+{
+    if (!IsCompiled()) {
+        if (!fFormula) return fValue = 0;
+        fFormula->SetParameters(lValues);
+        return fValue = fFormula->Eval(0);
+    }
+    return fValue = fCompiled->Evaluate(lValues);
+}
+//________________________________________________________________
+void AliMultEstimator::Evaluate(Long_t lNEvents, Long_t lNVars, const Double_t* lValues, Double_t* lOut, Long_t lOutStride)
+{
+    if (!IsCompiled()) {
+        for (Long_t iEv = 0; iEv < lNEvents; iEv++)
+            lOut[iEv*lOutStride] = Evaluate(lValues + iEv*lNVars);
+        return;
+    }
+    fCompiled->Evaluate(lNEvents, lNVars, lValues, lOut, lOutStride);
+    if (lNEvents > 0) fValue = lOut[(lNEvents-1)*lOutStride];
+}
+//________________________________________________________________
+Float_t AliMultEstimator::EvaluateFormula(const AliMultInput* lInput)
+{
+    //Reference implementation
     if (!fFormula) return fValue = 0;
     for (Int_t i = 0; i < lInput->GetNVariables(); i++) {
         AliMultVariable* v = lInput->GetVariable(i);
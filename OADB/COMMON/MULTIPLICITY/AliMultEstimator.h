@@ -2,6 +2,7 @@
 #define AliMultEstimator_H
 #include <TNamed.h>
 class AliMultInput;
+class AliCompiledFormula;
 class TFormula;
 
 class AliMultEstimator : public TNamed {
@@ -44,6 +45,15 @@ public:
     void SetupFormula(const AliMultInput* lInput);
     Float_t Evaluate(const AliMultInput* lInput);
     
+    //Compiled evaluation on the flat array of variable values
+    //(see AliMultInput::GetValues), TFormula if not compiled
+    Bool_t   IsCompiled() const { return fCompiled != 0; }
+    Float_t  Evaluate(const Double_t* lValues);
+    //Batch: lNEvents events, lValues[iEv*lNVars+iVar] -> lOut[iEv*lOutStride]
+    void     Evaluate(Long_t lNEvents, Long_t lNVars, const Double_t* lValues, Double_t* lOut, Long_t lOutStride = 1);
+    //Reference implementation
+    Float_t  EvaluateFormula(const AliMultInput* lInput);
+    
 private:
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
@@ -53,11 +63,15 @@ private:
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
     
+    //Compiled definition: stack program on the variable slots
+    Bool_t Compile(const AliMultInput* lInput);
+    AliCompiledFormula* fCompiled; //!
+    
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
     Float_t fAnchorPercentile;  //Percentile of X-section at anchor point
     
-    ClassDef(AliMultEstimator, 1)
+    ClassDef(AliMultEstimator, 2)
 };
 #endif
@@ -92,6 +92,17 @@ AliMultVariable* AliMultInput::GetVariable (Long_t iIdx) const
     return static_cast<AliMultVariable*>(fVariableList->At(iIdx));
 }
 
+void AliMultInput::GetValues(Double_t* lValues) const
+{
+    //Fill lValues (at least GetNVariables() entries) in one pass over the list
+    TIter next(fVariableList);
+    AliMultVariable* var = 0;
+    Long_t i = 0;
+    while ((var = static_cast<AliMultVariable*>(next()))) {
+        lValues[i++] = var->IsInteger() ? var->GetValueInteger() : var->GetValue();
+    }
+}
+
 void AliMultInput::Clear(Option_t* option)
 {
     TIter next(fVariableList);
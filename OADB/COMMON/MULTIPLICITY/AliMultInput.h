@@ -16,6 +16,8 @@ public:
     AliMultVariable* GetVariable (const TString& lName) const;
     AliMultVariable* GetVariable (Long_t iIdx) const;
     Long_t GetNVariables         () const { return fNVars; }
+    //Flat array of all values (index as in GetVariable(iIdx))
+    void     GetValues ( Double_t *lValues ) const;
     void Clear(Option_t* option="");
     void Set(const AliMultInput* other);
     void Print(Option_t* option="") const;
@@ -14,6 +14,7 @@
 
 #include "TList.h"
 #include "TFormula.h"
+#include "TMath.h"
 #include "AliMultVariable.h"
 #include "AliMultInput.h"
 #include "AliMultSelection.h"
@@ -37,7 +38,8 @@ fThisEvent_HasNoInconsistentVertices(0),
 fThisEvent_PassesTrackletVsCluster(0),
 fThisEvent_IsNotAsymmetricInVZERO(0),
 fThisEvent_IsNotIncompleteDAQ(0),
-fThisEvent_HasGoodVertex2016(0)
+fThisEvent_HasGoodVertex2016(0),
+fValues()
 {
   // Constructor
     fEstimatorList = new TList();
@@ -55,7 +57,8 @@ fThisEvent_HasNoInconsistentVertices(0),
 fThisEvent_PassesTrackletVsCluster(0),
 fThisEvent_IsNotAsymmetricInVZERO(0),
 fThisEvent_IsNotIncompleteDAQ(0),
-fThisEvent_HasGoodVertex2016(0)
+fThisEvent_HasGoodVertex2016(0),
+fValues()
 {
   // Constructor
     fEstimatorList = new TList();
@@ -77,7 +80,8 @@ fThisEvent_HasNoInconsistentVertices(lCopyMe.fThisEvent_HasNoInconsistentVertice
 fThisEvent_PassesTrackletVsCluster(lCopyMe.fThisEvent_PassesTrackletVsCluster),
 fThisEvent_IsNotAsymmetricInVZERO(lCopyMe.fThisEvent_IsNotAsymmetricInVZERO),
 fThisEvent_IsNotIncompleteDAQ(lCopyMe.fThisEvent_IsNotIncompleteDAQ),
-fThisEvent_HasGoodVertex2016(lCopyMe.fThisEvent_HasGoodVertex2016)
+fThisEvent_HasGoodVertex2016(lCopyMe.fThisEvent_HasGoodVertex2016),
+fValues()
 {
     TIter next(lCopyMe.fEstimatorList);
     AliMultEstimator* est = 0;
@@ -239,11 +243,15 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 //Master function to evaluate all existing estimators based on
 //a set of input variables. Error handling to be done with care...
 {
+    //Flat array of input values, filled once for all estimators
+    if ( fValues.GetSize() < lInput->GetNVariables() ) fValues.Set( lInput->GetNVariables() );
+    lInput->GetValues( fValues.GetArray() );
+    
     //Loop over estimators defined in the acquired list
     AliMultEstimator* estimator = 0;
     TIter             next(fEstimatorList);
     while ((estimator = static_cast<AliMultEstimator*>(next())))
-        estimator->Evaluate(lInput);
+        estimator->Evaluate(fValues.GetArray());
 
 //deprecated evaluation
 #if 0
@@ -278,6 +286,34 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 #endif
 }
 //________________________________________________________________
+void AliMultSelection::Evaluate( Long_t lNEvents, Long_t lNVars, const Double_t *lValues, Double_t *lOut )
+//Batch evaluation for calibration and reprocessing: each estimator
+//is evaluated for all events before moving to the next one
+{
+    Long_t lEst = 0;
+    AliMultEstimator* estimator = 0;
+    TIter             next(fEstimatorList);
+    while ((estimator = static_cast<AliMultEstimator*>(next())))
+        estimator->Evaluate(lNEvents, lNVars, lValues, lOut + lEst++, fNEsts);
+}
+//________________________________________________________________
+Bool_t AliMultSelection::Validate( AliMultInput *lInput, Double_t lTolerance )
+//Cross-check of the compiled evaluation against the TFormula reference
+{
+    Bool_t lReturnValue = kTRUE;
+    AliMultEstimator* estimator = 0;
+    TIter             next(fEstimatorList);
+    while ((estimator = static_cast<AliMultEstimator*>(next()))) {
+        Double_t lCompiled  = estimator->Evaluate(lInput);
+        Double_t lReference = estimator->EvaluateFormula(lInput);
+        if ( TMath::Abs(lCompiled - lReference) > lTolerance * TMath::Max(1.0, TMath::Abs(lReference)) ) {
+            Printf("AliMultSelection::Validate: estimator %s compiled %g, TFormula %g", estimator->GetName(), lCompiled, lReference);
+            lReturnValue = kFALSE;
+        }
+    }
+    return lReturnValue;
+}
+//________________________________________________________________
 void AliMultSelection::Setup(const AliMultInput* inp)
 {
     AliMultEstimator* estimator = 0;
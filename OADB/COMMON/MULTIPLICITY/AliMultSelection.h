@@ -2,6 +2,7 @@
 #define AliMultSelection_H
 #include <TNamed.h>
 #include <TList.h>
+#include <TArrayD.h>
 #include "AliMultSelectionBase.h"
 #include "AliMultEstimator.h"
 
@@ -41,6 +42,12 @@ public:
     
     //Master "Evaluate"
     void Evaluate ( AliMultInput *lInput );
+    //Batch evaluation of all estimators for lNEvents events
+    //lValues[iEv*lNVars+iVar] (variables as in the AliMultInput given to Setup)
+    //-> lOut[iEv*GetNEstimators()+iEst]
+    void Evaluate ( Long_t lNEvents, Long_t lNVars, const Double_t *lValues, Double_t *lOut );
+    //Compare compiled and TFormula evaluation for the current input
+    Bool_t Validate ( AliMultInput *lInput, Double_t lTolerance = 1e-5 );
     
     //Get ready: prepare/optimize TFormulas
     void Setup(const AliMultInput *lInput);
@@ -90,12 +97,15 @@ private:
     Bool_t fThisEvent_IsNotIncompleteDAQ;       //!
     Bool_t fThisEvent_HasGoodVertex2016;         //!
     
-    ClassDef(AliMultSelection, 6)
+    TArrayD fValues; //! flat array of input values for compiled evaluation
+    
+    ClassDef(AliMultSelection, 7)
     // 1 - original implementation
     // 2 - added fEvSelCode for EvSel bypass + getter changed
     // 3 - added booleans to classify which event criteria are satisfied
     // 4 - added IsEventSelected
     // 5 - added Good vertex, adjustments
     // 6 - changed to inherit from AliMultSelectionBase
+    // 7 - compiled estimator evaluation on a flat array of input values
 };
 #endif
@@ -306,7 +306,9 @@ Bool_t  AliCaloTrackReader::AcceptParticleMCLabel(Int_t mcLabel) const
 //_____________________________________________________________________
 /// Get the name of the generator that generated a given primary particle 
 /// Copy of AliMCEvent::GetCocktailGeneratorAndIndex(), modified to get the 
-/// the generator index in the cocktail
+/// the generator index in the cocktail.
+/// If the AliMCAnalysisUtils are available, the generator ranges and the
+/// mothers are taken from its per event genealogy cache.
 ///
 /// \param index: mc label index
 /// \param nameGen: cocktail generator name for this index
@@ -314,6 +316,8 @@ Bool_t  AliCaloTrackReader::AcceptParticleMCLabel(Int_t mcLabel) const
 //_____________________________________________________________________
 Int_t AliCaloTrackReader::GetCocktailGeneratorAndIndex(Int_t index, TString & nameGen) const
 {
+  if ( fMCUtils ) return fMCUtils->GetCocktailGeneratorAndIndex(index, GetMC(), nameGen);
+  
   //method that gives the generator for a given particle with label index (or that of the corresponding primary)
   AliVParticle* mcpart0 = (AliVParticle*) GetMC()->GetTrack(index);
   Int_t genIndex = -1;
@@ -24,6 +24,7 @@
 #include "AliAnalysisManager.h"
 #include "AliInputEventHandler.h"
 #include "AliMCEvent.h"
+#include "AliGenEventHeader.h"
 #include "AliGenPythiaEventHeader.h"
 #include "AliVParticle.h"
 #include "AliLog.h"
@@ -53,7 +54,22 @@ fPyProcess(-1),
 fPyFirstParticle(0), 
 fPyVersion(0),
 fMinPartonicParent(5),
-fMaxPartonicParent(8)
+fMaxPartonicParent(8),
+fMCCacheEvent(0x0),
+fMCCacheEntry(-1),
+fMCCacheNTracks(-1),
+fMCLoaded(),
+fMCParentLabel(),
+fMCPdgCode(),
+fMCStatusCode(),
+fMCDepth(),
+fMCJump(),
+fMCOriginTag(),
+fMCOriginHeader(),
+fMCGenStatus(-1),
+fMCGenLow(),
+fMCGenHigh(),
+fMCGenName()
 {}
 
 //_______________________________________
@@ -71,6 +87,7 @@ AliMCAnalysisUtils::~AliMCAnalysisUtils()
 //_____________________________________________________________________________________________
 /// Check the first common ancestor of 2 clusters, given the most likely labels 
 /// of the primaries generating such clusters.
+/// The ancestor is found with GetMCCommonAncestor().
 //_____________________________________________________________________________________________
 Int_t AliMCAnalysisUtils::CheckCommonAncestor(Int_t index1, Int_t index2, 
                                               const AliMCEvent* mcevent, 
@@ -86,99 +103,359 @@ Int_t AliMCAnalysisUtils::CheckCommonAncestor(Int_t index1, Int_t index2,
     //printf("\t Negative index (%d, %d)\n",index1,index2);
   }
 
-  Int_t label1[1000];
-  Int_t label2[1000];
-  label1[0]= index1;
-  label2[0]= index2;
-  Int_t counter1 = 0;
-  Int_t counter2 = 0;
-  
-  if(label1[0]==label2[0])
-  {
-    //printf("\t Already the same label: %d\n",label1[0]);
-    counter1=1;
-    counter2=1;
+  // Lowest common ancestor, from the genealogy cache
+  Int_t ancLabel = GetMCCommonAncestor(index1, index2, mcevent);
+  
+  if ( ancLabel >= 0 )
+  {
+    AliVParticle * mom = mcevent->GetTrack(ancLabel);
+    
+    if (mom)
+    {
+      ancPDG    = mom->PdgCode();
+      ancStatus = mom->MCStatusCode();
+      momentum.SetPxPyPzE(mom->Px(),mom->Py(),mom->Pz(),mom->E());
+      prodVertex.SetXYZ(mom->Xv(),mom->Yv(),mom->Zv());
+      //printf("Ancestor label %d PDG %d, status %d\n",ancLabel,ancPDG,ancStatus);
+    }
   }
-  else
+  
+  if(ancLabel < 0)
   {
-    Int_t label=label1[0];
+    //printf("No ancestor found!\n");
+    ancPDG    = -10000;
+    ancStatus = -10000;
+    momentum.SetXYZT(0,0,0,0);
+    prodVertex.SetXYZ(-10,-10,-10);
+  }
+  
+  return ancLabel;
+}
+
+//_____________________________________________________________________________________________
+/// Reset the genealogy cache if the MC event changed: different event pointer,
+/// read entry of the input handler or number of MC particles.
+/// The per label arrays are sized for the new event but filled on demand.
+//_____________________________________________________________________________________________
+void AliMCAnalysisUtils::CheckMCEventCache(const AliMCEvent* mcevent)
+{
+  Int_t entry = -1;
+  AliAnalysisManager * manager = AliAnalysisManager::GetAnalysisManager();
+  if ( manager && manager->GetInputEventHandler() )
+    entry = manager->GetInputEventHandler()->GetReadEntry();
+  
+  Int_t ntracks = mcevent ? mcevent->GetNumberOfTracks() : 0;
+  
+  if ( mcevent == fMCCacheEvent && entry == fMCCacheEntry && ntracks == fMCCacheNTracks ) return;
+  
+  fMCCacheEvent   = mcevent;
+  fMCCacheEntry   = entry;
+  fMCCacheNTracks = ntracks;
+  
+  fMCLoaded     .assign(ntracks, 0);
+  fMCParentLabel.resize(ntracks);
+  fMCPdgCode    .resize(ntracks);
+  fMCStatusCode .resize(ntracks);
+  fMCDepth      .assign(ntracks,-1);
+  fMCOriginTag  .assign(ntracks,-1);
+  fMCJump       .clear();
+  
+  fMCGenStatus = -1;
+  fMCGenLow .clear();
+  fMCGenHigh.clear();
+  fMCGenName.clear();
+}
+
+//_____________________________________________________________________________________________
+/// Force the genealogy cache to be rebuilt on next access.
+/// Needed when the MC event is changed in place without input handler.
+//_____________________________________________________________________________________________
+void AliMCAnalysisUtils::ResetMCEventCache()
+{
+  fMCCacheEvent   = 0x0;
+  fMCCacheEntry   = -1;
+  fMCCacheNTracks = -1;
+}
+
+//_____________________________________________________________________________________________
+/// Read once the mother, PDG and status of the particle with this label.
+/// A particle not available in the MC event, or with a mother label out of range,
+/// is considered without mother.
+/// \return kFALSE if the label is out of range or the particle not available.
+//_____________________________________________________________________________________________
+Bool_t AliMCAnalysisUtils::LoadMCParticle(Int_t label)
+{
+  if ( label < 0 || label >= fMCCacheNTracks ) return kFALSE;
+  
+  if ( fMCLoaded[label] == 0 )
+  {
+    AliVParticle * particle = fMCCacheEvent->GetTrack(label);
     
-    while(label > -1 && counter1 < 999)
+    if ( particle )
     {
-      counter1++;
-      AliVParticle * mom = mcevent->GetTrack(label);
-      if(mom)
-      {
-        label  = mom->GetMother() ;
-        label1[counter1]=label;
-      }
-      //printf("\t 1) counter %d, mom label %d, pdg %d\n", counter1,label, mom->PdgCode());
+      Int_t mother = particle->GetMother();
+      
+      fMCLoaded     [label] = 1;
+      fMCParentLabel[label] = ( mother < fMCCacheNTracks ) ? mother : -1;
+      fMCPdgCode    [label] = particle->PdgCode();
+      fMCStatusCode [label] = particle->MCStatusCode();
+    }
+    else
+    {
+      fMCLoaded     [label] = 2;
+      fMCParentLabel[label] = -1;
+      fMCPdgCode    [label] =  0;
+      fMCStatusCode [label] = -1;
+    }
+  }
+  
+  return fMCLoaded[label] == 1;
+}
+
+//_____________________________________________________________________________________________
+/// \return number of ancestors of the particle, -1 if the genealogy is too large.
+/// The depth of all the particles on the way is also stored.
+//_____________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::MCDepth(Int_t label)
+{
+  const Int_t kMaxGenerations = 999;
+  
+  if ( fMCDepth[label] >= 0 ) return fMCDepth[label];
+  
+  // Go up until a particle with known depth or without mother
+  std::vector<Int_t> path;
+  Int_t current = label;
+  Int_t depth   = -1;
+  
+  while ( current >= 0 )
+  {
+    if ( fMCDepth[current] >= 0 )
+    {
+      depth = fMCDepth[current];
+      break;
     }
     
-    //printf("Org label2=%d,\n",label2[0]);
-    label=label2[0];
+    path.push_back(current);
     
-    while(label > -1 && counter2 < 999)
+    if ( (Int_t) path.size() > kMaxGenerations )
     {
-      counter2++;
-      AliVParticle * mom = mcevent->GetTrack(label);
-      if(mom)
-      {
-        label  = mom->GetMother() ;
-        label2[counter2]=label;
-      }
-      //printf("\t 2) counter %d, mom label %d, pdg %d \n", counter2,label, mom->PdgCode());
+      AliWarning(Form("Genealogy too large for label %d, more than %d generations", label, kMaxGenerations));
+      return -1;
     }
-  }//First labels not the same
+    
+    current = MCParent(current);
+  }
   
-  if((counter1==999 || counter2==999))
-    AliWarning(Form("Genealogy too large, generations: cluster1: %d, cluster2= %d", counter1, counter2));
+  for ( Int_t i = path.size()-1; i >= 0; i-- ) fMCDepth[path[i]] = ++depth;
+  
+  return fMCDepth[label];
+}
+
+//_____________________________________________________________________________________________
+/// \return label of the ancestor 2^level generations back, -1 if there is none.
+/// Levels above 0 are stored in fMCJump when first requested.
+//_____________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::MCAncestor(Int_t label, Int_t level)
+{
+  if ( label < 0 ) return -1;
   
-  //printf("CheckAncestor:\n");
+  if ( level == 0 ) return MCParent(label);
   
-  //Int_t commonparents = 0;
-  Int_t ancLabel = -1;
-  //printf("counters %d %d \n",counter1, counter2);
-  for (Int_t c1 = 0; c1 < counter1; c1++)
+  Int_t index = (level-1)*fMCCacheNTracks+label;
+  
+  if ( (Int_t) fMCJump.size() < level*fMCCacheNTracks )
+    fMCJump.resize(level*fMCCacheNTracks, -2);
+  
+  if ( fMCJump[index] == -2 )
   {
-    for (Int_t c2 = 0; c2 < counter2; c2++)
+    Int_t half = MCAncestor(label, level-1);
+    fMCJump[index] = MCAncestor(half, level-1);
+  }
+  
+  return fMCJump[index];
+}
+
+//_____________________________________________________________________________________________
+/// \return label of the mother of the particle, read from the genealogy cache.
+//_____________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::GetMCParent(Int_t label, const AliMCEvent* mcevent)
+{
+  if ( !mcevent ) return -1;
+  
+  CheckMCEventCache(mcevent);
+  
+  return MCParent(label);
+}
+
+//_____________________________________________________________________________________________
+/// \return label of the first common ancestor of 2 particles, -1 if there is none.
+/// A particle is its own ancestor: if one label descends from the other, the older one is returned.
+/// Both labels are moved to the same generation and then up together,
+/// in jumps of 2^k generations, stored in the genealogy cache of the event.
+//_____________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::GetMCCommonAncestor(Int_t label1, Int_t label2, const AliMCEvent* mcevent)
+{
+  if ( !mcevent ) return -1;
+  
+  CheckMCEventCache(mcevent);
+  
+  if ( !LoadMCParticle(label1) || !LoadMCParticle(label2) ) return -1;
+  
+  Int_t depth1 = MCDepth(label1);
+  Int_t depth2 = MCDepth(label2);
+  
+  if ( depth1 < 0 || depth2 < 0 ) return -1;
+  
+  if ( depth1 < depth2 )
+  {
+    Int_t tmp = label1; label1 = label2; label2 = tmp;
+    tmp       = depth1; depth1 = depth2; depth2 = tmp;
+  }
+  
+  // Same generation
+  Int_t maxLevel = 0;
+  for ( Int_t diff = depth1-depth2, level = 0; diff > 0; diff >>= 1, level++ )
+  {
+    if ( diff & 1 ) label1 = MCAncestor(label1, level);
+  }
+  
+  if ( label1 == label2 ) return label1;
+  
+  while ( (1 << (maxLevel+1)) <= depth2 ) maxLevel++;
+  
+  // Go up together while the ancestors differ
+  for ( Int_t level = maxLevel; level >= 0; level-- )
+  {
+    Int_t anc1 = MCAncestor(label1, level);
+    Int_t anc2 = MCAncestor(label2, level);
+    
+    if ( anc1 != anc2 )
     {
-      if ( label1[c1]==label2[c2] && label1[c1]>-1 &&
-           ancLabel < label1[c1]                      ) // make sure to take the first common parent, not needed since array is ordered, just in case
-      {
-        ancLabel = label1[c1];
-        //commonparents++;
-        
-        AliVParticle * mom = mcevent->GetTrack(label1[c1]);
-        
-        if (mom)
-        {
-          ancPDG    = mom->PdgCode();
-          ancStatus = mom->MCStatusCode();
-          momentum.SetPxPyPzE(mom->Px(),mom->Py(),mom->Pz(),mom->E());
-          prodVertex.SetXYZ(mom->Xv(),mom->Yv(),mom->Zv());
-          //printf("Ancestor label %d PDG %d, status %d\n",ancLabel,ancPDG,ancStatus);
-        }
-        
-        //First ancestor found, end the loops
-        //counter1=0;
-        //counter2=0;
-      }//Ancestor found
-    }//second cluster loop
-  }//first cluster loop
+      label1 = anc1;
+      label2 = anc2;
+    }
+  }
   
-  //printf("common ancestors %d\n",commonparents);
+  return MCParent(label1);
+}
+
+//_____________________________________________________________________________________________
+/// Fill once per event the label range of each generator of the cocktail.
+/// Same ranges as in AliCaloTrackReader::GetGeneratorNameAndIndex():
+/// the last headers take the last primaries, the first one the remaining.
+//_____________________________________________________________________________________________
+void AliMCAnalysisUtils::FillMCGeneratorRanges(AliMCEvent* mcevent)
+{
+  if ( fMCGenStatus >= 0 ) return;
   
-  if(ancLabel < 0)
+  TList* lh = mcevent->GetCocktailList();
+  if ( !lh )
   {
-    //printf("No ancestor found!\n");
-    ancPDG    = -10000;
-    ancStatus = -10000;
-    momentum.SetXYZT(0,0,0,0);
-    prodVertex.SetXYZ(-10,-10,-10);
+    fMCGenStatus = 0;
+    return;
   }
   
-  return ancLabel;
+  Int_t nh       = lh->GetEntries();
+  Int_t nsumpart = mcevent->GetNumberOfPrimaries();
+  
+  fMCGenLow .assign(nh,0);
+  fMCGenHigh.assign(nh,0);
+  fMCGenName.assign(nh,"");
+  
+  for (Int_t i = nh-1; i >= 0; i--)
+  {
+    AliGenEventHeader* gh = (AliGenEventHeader*)lh->At(i);
+    
+    Int_t npart = gh->NProduced();
+    
+    if (i == 0) npart = nsumpart;
+    
+    fMCGenName[i] = gh->GetName();
+    fMCGenHigh[i] = nsumpart;
+    fMCGenLow [i] = nsumpart-npart;
+    
+    nsumpart-=npart;
+  }
+  
+  fMCGenStatus = 1;
+}
+
+//_____________________________________________________________________________________________
+/// \return cocktail generator name of the label, empty if not in the range of any generator.
+/// \param genIndex: index of the generator in the cocktail, -1 if not found
+//_____________________________________________________________________________________________
+TString AliMCAnalysisUtils::GetMCGeneratorName(Int_t label, Int_t & genIndex) const
+{
+  genIndex = -1;
+  
+  if ( fMCGenStatus == 0 ) return "nococktailheader";
+  
+  for (Int_t i = fMCGenName.size()-1; i >= 0; i--)
+  {
+    if ( label < fMCGenHigh[i] && label >= fMCGenLow[i] )
+    {
+      genIndex = i;
+      return fMCGenName[i];
+    }
+  }
+  
+  return "";
+}
+
+//_____________________________________________________________________________________________
+/// Get the name of the generator that generated a given particle and its index
+/// in the cocktail, or those of the first ancestor produced by a generator.
+/// Same as AliCaloTrackReader::GetCocktailGeneratorAndIndex() but the generator
+/// ranges and the mothers are read once per event from the genealogy cache.
+///
+/// \param label: mc label index
+/// \param mcevent: pointer to MCEvent()
+/// \param nameGen: cocktail generator name for this index
+/// \return cocktail generator index
+//_____________________________________________________________________________________________
+Int_t AliMCAnalysisUtils::GetCocktailGeneratorAndIndex(Int_t label, AliMCEvent* mcevent, TString & nameGen)
+{
+  if ( !mcevent ) return -1;
+  
+  CheckMCEventCache(mcevent);
+  
+  if ( !LoadMCParticle(label) )
+  {
+    printf("AliMCEvent-BREAK: No valid AliMCParticle at label %i\n",label);
+    return -1;
+  }
+  
+  FillMCGeneratorRanges(mcevent);
+  
+  Int_t genIndex = -1;
+  nameGen = GetMCGeneratorName(label,genIndex);
+  
+  if(nameGen.Contains("nococktailheader") ) return -1;
+  
+  Int_t lab=label;
+  
+  while(nameGen.IsWhitespace())
+  {
+    Int_t mother = MCParent(lab);
+    
+    if(mother<0)
+    {
+      printf("AliMCEvent - BREAK: Reached primary particle without valid mother\n");
+      break;
+    }
+    
+    if(!LoadMCParticle(mother))
+    {
+      printf("AliMCEvent-BREAK: No valid AliMCParticle mother at label %i\n",mother);
+      break;
+    }
+    
+    lab=mother;
+    
+    nameGen = GetMCGeneratorName(mother,genIndex);
+  }
+  
+  return genIndex;
 }
 
 //____________________________________________________________________________________________________
@@ -263,6 +540,22 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, Int_t nlabels,
   //
   //////////////// End get the Pythia header //////////
   
+  // The tag of a single label without cluster list depends only on the label,
+  // reuse it if it was already obtained in this event
+  Bool_t singleLabel = ( nlabels == 1 && !arrayCluster );
+  if ( singleLabel )
+  {
+    CheckMCEventCache(mcevent);
+    
+    if ( selectHeaderName != fMCOriginHeader )
+    {
+      fMCOriginTag.assign(fMCOriginTag.size(),-1);
+      fMCOriginHeader = selectHeaderName;
+    }
+    
+    if ( fMCOriginTag[labels[0]] >= 0 ) return fMCOriginTag[labels[0]];
+  }
+  
   // Most significant particle contributing to the cluster
   Int_t label=labels[0];
     
@@ -606,6 +899,8 @@ Int_t AliMCAnalysisUtils::CheckOrigin(const Int_t *labels, Int_t nlabels,
     SetTagBit(tag,kMCUnknown);
   }
   
+  if ( singleLabel ) fMCOriginTag[labels[0]] = tag;
+  
   return tag;
 }
 
@@ -623,6 +918,8 @@ void AliMCAnalysisUtils::CheckOverlapped2GammaDecay(const Int_t *labels, Int_t n
     return;
   }
   
+  CheckMCEventCache(mcevent);
+  
   AliVParticle * meson = mcevent->GetTrack(mesonIndex);
   Int_t mesonPdg = meson->PdgCode();
   if(mesonPdg != 111 && mesonPdg != 221)
@@ -719,15 +1016,13 @@ void AliMCAnalysisUtils::CheckOverlapped2GammaDecay(const Int_t *labels, Int_t n
       continue;
     }
     
-    AliVParticle * daught =  mcevent->GetTrack(index);
-    Int_t tmpindex = daught->GetMother();
+    Int_t tmpindex = MCParent(index);
     AliDebug(3,Form("Conversion? : mother %d",tmpindex));
     
     while(tmpindex>=0)
     {
       // MC particle of interest is the mother
       AliDebug(3,Form("\t parent index %d",tmpindex));
-      daught   =  mcevent->GetTrack(tmpindex);
       //printf("tmpindex %d\n",tmpindex);
       if      (iPhoton0 == tmpindex)
       {
@@ -742,7 +1037,7 @@ void AliMCAnalysisUtils::CheckOverlapped2GammaDecay(const Int_t *labels, Int_t n
         break;
       }
       
-      tmpindex = daught->GetMother();
+      tmpindex = MCParent(tmpindex);
       
     }//While to check if pi0/eta daughter was one of these contributors to the cluster
     
@@ -791,6 +1086,8 @@ void    AliMCAnalysisUtils::CheckLostDecayPair(const TObjArray* arrayCluster, In
 {
   if(!arrayCluster || iMom < 0 || iParent < 0|| !mcevent) return;
   
+  CheckMCEventCache(mcevent);
+  
   AliVParticle * parent = mcevent->GetTrack(iParent);
   
   //printf("*** Check label %d with parent %d\n",iMom, iParent);
@@ -839,26 +1136,23 @@ void    AliMCAnalysisUtils::CheckLostDecayPair(const TObjArray* arrayCluster, In
       }
       else // check the ancestry
       {
-        AliVParticle * mother = mcevent->GetTrack(label);
-        
-        if ( !mother )
+        if ( !LoadMCParticle(label) )
         {
           AliInfo(Form("MC Mother not available for label %d",label));
           continue;
         }
         
-        Int_t momPDG = TMath::Abs(mother->PdgCode());
+        Int_t momPDG = TMath::Abs(MCPdg(label));
         if ( momPDG!=11 && momPDG!=22 ) continue;
         
         // Check if "mother" of entity is converted, if not, get the first non converted mother
-        Int_t iParentClus = mother->GetMother();
+        Int_t iParentClus = MCParent(label);
         if(iParentClus < 0) continue;
         
-        AliVParticle * parentClus = mcevent->GetTrack(iParentClus);
-        if(!parentClus) continue;
+        if( !LoadMCParticle(iParentClus) ) continue;
         
-        Int_t parentClusPDG    = TMath::Abs(parentClus->PdgCode());
-        Int_t parentClusStatus = parentClus->MCStatusCode();
+        Int_t parentClusPDG    = TMath::Abs(MCPdg(iParentClus));
+        Int_t parentClusStatus = MCStatus(iParentClus);
         
         if ( parentClusPDG != 22 && parentClusPDG != 11 && parentClusStatus != 0 )
         {
@@ -875,14 +1169,13 @@ void    AliMCAnalysisUtils::CheckLostDecayPair(const TObjArray* arrayCluster, In
           label            = iParentClus;
           momPDG           = parentClusPDG;
           
-          iParentClus      = parentClus->GetMother();
+          iParentClus      = MCParent(iParentClus);
           if ( iParentClus < 0 ) break;
           
-          parentClus       = mcevent->GetTrack(iParentClus);
-          if ( !parentClus ) break;
+          if ( !LoadMCParticle(iParentClus) ) break;
           
-          parentClusPDG    = TMath::Abs(parentClus->PdgCode());
-          parentClusStatus = parentClus->MCStatusCode() ;
+          parentClusPDG    = TMath::Abs(MCPdg(iParentClus));
+          parentClusStatus = MCStatus(iParentClus) ;
         }//while
         
         if ( (momPDG == 22 || parentClusPDG ==22) && (label==pairLabel || iParentClus == pairLabel) )
@@ -1190,34 +1483,35 @@ TLorentzVector AliMCAnalysisUtils::GetMotherWithPDG(Int_t label, Int_t pdg,
   }
   
   
-  AliVParticle * momP = mcevent->GetTrack(label);
+  CheckMCEventCache(mcevent);
   
-  if(momP->PdgCode()==pdg)
+  if(MCPdg(label)==pdg)
   {
     AliDebug(2,"PDG of mother is already the one requested!");
+    AliVParticle * momP = mcevent->GetTrack(label);
     fGMotherMom.SetPxPyPzE(momP->Px(),momP->Py(),momP->Pz(),momP->E());
     
     ok=kTRUE;
     return fGMotherMom;
   }
   
-  Int_t grandmomLabel = momP->GetMother();
+  // Walk the ancestors with the cached genealogy, only the one found is read
+  Int_t grandmomLabel = MCParent(label);
   Int_t grandmomPDG   = -1;
-  AliVParticle * grandmomP = 0x0;
   
   while (grandmomLabel >=0 ) 
   {
-    grandmomP   = mcevent->GetTrack(grandmomLabel);
-    grandmomPDG = grandmomP->PdgCode();
+    grandmomPDG = MCPdg(grandmomLabel);
     if(grandmomPDG==pdg)
     {
       //printf("AliMCAnalysisUtils::GetMotherWithPDG(AOD) - mother with PDG %d FOUND! \n",pdg);
       momlabel = grandmomLabel;
+      AliVParticle * grandmomP = mcevent->GetTrack(grandmomLabel);
       fGMotherMom.SetPxPyPzE(grandmomP->Px(),grandmomP->Py(),grandmomP->Pz(),grandmomP->E());
       break;
     }
     
-    grandmomLabel =  grandmomP->GetMother();
+    grandmomLabel = MCParent(grandmomLabel);
   }
   
   if(grandmomPDG!=pdg) AliInfo(Form("Mother with PDG %d, NOT found!",pdg));
@@ -1254,28 +1548,32 @@ TLorentzVector AliMCAnalysisUtils::GetFirstMotherWithPDG(Int_t label, Int_t pdg,
     return fGMotherMom;
   }
   
-  AliVParticle * momP = mcevent->GetTrack(label);
+  CheckMCEventCache(mcevent);
   
-  Int_t grandmomLabel = momP->GetMother();
+  // Walk the ancestors with the cached genealogy, keep the last (oldest) one found
+  Int_t grandmomLabel = MCParent(label);
   gparentlabel = grandmomLabel;
-  Int_t grandmomPDG   = -1;
-  AliVParticle * grandmomP = 0x0;
+  Int_t found = -1;
   
   while (grandmomLabel >=0 ) 
   {
-    grandmomP   = mcevent->GetTrack(grandmomLabel);
-    grandmomPDG = grandmomP->PdgCode();
-    if(grandmomPDG==pdg)
+    if(MCPdg(grandmomLabel)==pdg)
     {
       //printf("AliMCAnalysisUtils::GetMotherWithPDG(AOD) - mother with PDG %d FOUND! \n",pdg);
-      momlabel = grandmomLabel;
-      fGMotherMom.SetPxPyPzE(grandmomP->Px(),grandmomP->Py(),grandmomP->Pz(),grandmomP->E());
-      gparentlabel =  grandmomP->GetMother();
+      found        = grandmomLabel;
+      momlabel     = grandmomLabel;
+      gparentlabel = MCParent(grandmomLabel);
     }
     
-    grandmomLabel =  grandmomP->GetMother();
+    grandmomLabel = MCParent(grandmomLabel);
   }
-    
+  
+  if ( found >= 0 )
+  {
+    AliVParticle * grandmomP = mcevent->GetTrack(found);
+    fGMotherMom.SetPxPyPzE(grandmomP->Px(),grandmomP->Py(),grandmomP->Pz(),grandmomP->E());
+  }
+  
   ok = kTRUE;
   
   return fGMotherMom;
@@ -1349,23 +1647,26 @@ void AliMCAnalysisUtils::GetMCDecayAsymmetryAngleForPDG(Int_t label, Int_t pdg,
     return ;
   }
   
-  AliVParticle * momP = mcevent->GetTrack(label);
+  CheckMCEventCache(mcevent);
   
-  Int_t grandmomLabel = momP->GetMother();
+  Int_t grandmomLabel = MCParent(label);
   Int_t grandmomPDG   = -1;
   AliVParticle * grandmomP = 0x0;
   
   while (grandmomLabel >=0 ) 
   {
-    grandmomP   = mcevent->GetTrack(grandmomLabel);
-    grandmomPDG = grandmomP->PdgCode();
+    grandmomPDG = MCPdg(grandmomLabel);
     
-    if(grandmomPDG==pdg) break;
+    if(grandmomPDG==pdg) 
+    {
+      grandmomP = mcevent->GetTrack(grandmomLabel);
+      break;
+    }
     
-    grandmomLabel =  grandmomP->GetMother();
+    grandmomLabel = MCParent(grandmomLabel);
   }
   
-  if(grandmomPDG==pdg && grandmomP->GetNDaughters()==2) 
+  if(grandmomPDG==pdg && grandmomP && grandmomP->GetNDaughters()==2) 
   {
     AliVParticle * d1 = mcevent->GetTrack(grandmomP->GetDaughterLabel(0));
     AliVParticle * d2 = mcevent->GetTrack(grandmomP->GetDaughterLabel(1));
@@ -1804,6 +2105,8 @@ void AliMCAnalysisUtils::PrintMCTag(Int_t tag) const
 //__________________________________________________
 void AliMCAnalysisUtils::SetMCGenerator(Int_t mcgen)
 {  
+  ResetMCEventCache(); // CheckOrigin() tags depend on the generator
+  
   fMCGenerator = mcgen ;
   if     (mcgen == kPythia) fMCGeneratorString = "PYTHIA";
   else if(mcgen == kHerwig) fMCGeneratorString = "HERWIG";
@@ -1820,6 +2123,8 @@ void AliMCAnalysisUtils::SetMCGenerator(Int_t mcgen)
 //____________________________________________________
 void AliMCAnalysisUtils::SetMCGenerator(TString mcgen)
 {  
+  ResetMCEventCache(); // CheckOrigin() tags depend on the generator
+  
   fMCGeneratorString = mcgen ;
   
   if     (mcgen == "PYTHIA") fMCGenerator = kPythia;
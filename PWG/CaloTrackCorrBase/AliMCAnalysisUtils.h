@@ -23,6 +23,7 @@
 #include <TObject.h>
 #include <TString.h>
 #include <TLorentzVector.h>
+#include <vector>
 class TList ;
 class TVector3;
 class TClonesArray;
@@ -94,6 +95,15 @@ class AliMCAnalysisUtils : public TObject {
                               AliMCEvent* mcevent,
                               Int_t *overpdg, Int_t *overlabel);
   
+  //--------------------------------------
+  // Genealogy cache of the current event
+  //--------------------------------------
+  
+  Int_t   GetMCParent(Int_t label, const AliMCEvent* mcevent) ;
+  Int_t   GetMCCommonAncestor(Int_t label1, Int_t label2, const AliMCEvent* mcevent) ;
+  Int_t   GetCocktailGeneratorAndIndex(Int_t label, AliMCEvent* mcevent, TString & nameGen) ;
+  void    ResetMCEventCache() ;
+  
   //Check or set the bits produced in the above methods
   void    SetTagBit(Int_t &tag, UInt_t set) const {
     // Set bit of type set (mcTypes) in tag
@@ -142,6 +152,16 @@ class AliMCAnalysisUtils : public TObject {
 
  private:
 
+  void    CheckMCEventCache(const AliMCEvent* mcevent) ;
+  Bool_t  LoadMCParticle(Int_t label) ;
+  Int_t   MCParent(Int_t label)  { return LoadMCParticle(label) ? fMCParentLabel[label] : -1 ; }
+  Int_t   MCPdg(Int_t label)     { return LoadMCParticle(label) ? fMCPdgCode[label]     :  0 ; }
+  Int_t   MCStatus(Int_t label)  { return LoadMCParticle(label) ? fMCStatusCode[label]  : -1 ; }
+  Int_t   MCDepth(Int_t label) ;
+  Int_t   MCAncestor(Int_t label, Int_t level) ;
+  void    FillMCGeneratorRanges(AliMCEvent* mcevent) ;
+  TString GetMCGeneratorName(Int_t label, Int_t & genIndex) const ;
+
   Int_t          fCurrentEvent;        ///<  Current Event number - GetJets()
   
   Int_t          fDebug;               ///<  Debug level
@@ -173,6 +193,24 @@ class AliMCAnalysisUtils : public TObject {
   Int_t         fMinPartonicParent;   ///< Minimum label of partonic parent of direct photon
   Int_t         fMaxPartonicParent;   ///< Minimum label of partonic parent of direct photon
   
+  // Genealogy of the current event, filled on demand.
+  // Reset when the MC event, the read entry or the number of MC particles change.
+  const AliMCEvent   * fMCCacheEvent;   //!<! MC event of the cache
+  Int_t                fMCCacheEntry;   //!<! Read entry of the cached event
+  Int_t                fMCCacheNTracks; //!<! Number of MC particles in the cached event
+  std::vector<Char_t>  fMCLoaded;       //!<! Per label: 0 not read yet, 1 read, 2 not available
+  std::vector<Int_t>   fMCParentLabel;  //!<! Per label: mother label
+  std::vector<Int_t>   fMCPdgCode;      //!<! Per label: PDG code
+  std::vector<Int_t>   fMCStatusCode;   //!<! Per label: MC status code
+  std::vector<Int_t>   fMCDepth;        //!<! Per label: number of ancestors, -1 not computed yet
+  std::vector<Int_t>   fMCJump;         //!<! Ancestor 2^k generations back, [(k-1)*n+label] for k>0, -2 not computed yet
+  std::vector<Int_t>   fMCOriginTag;    //!<! Per label: CheckOrigin() tag of the single label, -1 not computed yet
+  TString              fMCOriginHeader; //!<! Header name selection of the cached CheckOrigin() tags
+  Int_t                fMCGenStatus;    //!<! Cocktail generator ranges: -1 not filled yet, 0 no cocktail list, 1 filled
+  std::vector<Int_t>   fMCGenLow;       //!<! Per cocktail generator: first label
+  std::vector<Int_t>   fMCGenHigh;      //!<! Per cocktail generator: last label + 1
+  std::vector<TString> fMCGenName;      //!<! Per cocktail generator: header name
+  
   /// Copy constructor not implemented.
   AliMCAnalysisUtils & operator = (const AliMCAnalysisUtils & mcu) ; 
   
@@ -180,7 +218,7 @@ class AliMCAnalysisUtils : public TObject {
   AliMCAnalysisUtils(              const AliMCAnalysisUtils & mcu) ; 
   
   /// \cond CLASSIMP
-  ClassDef(AliMCAnalysisUtils,8) ;
+  ClassDef(AliMCAnalysisUtils,9) ;
   /// \endcond
 
 } ;
@@ -21,6 +21,7 @@
 #include <fstream>
 #include <iostream>
 #include <bitset>
+#include <deque>
 
 #include <TFile.h>
 #include <TMath.h>
@@ -35,6 +36,15 @@
 #include <TH1F.h>
 #include <TRandom3.h>
 #include <TList.h>
+#include <TChainElement.h>
+#include <TClonesArray.h>
+#include <TObjArray.h>
+#include <TBufferFile.h>
+#include <TProcessID.h>
+#include <TStopwatch.h>
+#include <TROOT.h>
+#include <TVirtualMutex.h>
+#include <RVersion.h>
 
 #include <AliLog.h>
 #include <AliAnalysisManager.h>
@@ -53,6 +63,13 @@
 
 #include "AliAnalysisTaskEmcalEmbeddingHelper.h"
 
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIEMCALEMBEDDINGREADAHEAD_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
 /// \cond CLASSIMP
 ClassImp(AliAnalysisTaskEmcalEmbeddingHelper);
 /// \endcond
@@ -105,6 +122,546 @@ bool IsFileAccessible(std::string filename)
   return res;
 }
 
+/**
+ * \class AliEmcalEmbeddingReadAhead
+ * \brief Reads the embedded events ahead of the analysis on a worker thread.
+ *
+ * The worker walks through its own copy of the TChain of the embedding helper in exactly the same order
+ * as AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry() (including the random offset into each tree),
+ * reads each entry into its own external event and applies the part of the event selection which only
+ * depends on the embedded event. The result of each entry (position in the chain, pythia properties,
+ * rejection and vertex) is queued, until the requested number of candidate events is available.
+ *
+ * The embedding helper then only needs to apply the selection which depends on the internal event. The
+ * accepted event is handed over without reading it again (see HandOver()): the external event of the
+ * helper cannot be replaced, since the containers keep pointers to its arrays, so the content of the
+ * worker's event is moved into these arrays instead. For each candidate, the worker moves the objects of
+ * the TClonesArrays out of its event (TClonesArray::AbsorbObjects()) and streams the other objects of the
+ * event (header, cells, ...) into a buffer. Up to the requested number of candidate events are therefore
+ * kept in memory.
+ *
+ * The TRef of the embedded event are registered again when it is handed over, but the worker can register
+ * objects of the events read ahead with the same unique IDs afterwards. Analyses resolving TRef of the embedded
+ * event (e.g. the tracks matched to AOD clusters) should not read ahead.
+ *
+ * Without thread support, or if ROOT thread safety was not enabled in the steering macro (ROOT::EnableThreadSafety()),
+ * the entries are determined when they are requested.
+ */
+class AliEmcalEmbeddingReadAhead {
+ public:
+  /**
+   * \struct Entry
+   * \brief Properties of one entry of the TChain.
+   */
+  struct Entry {
+    Int_t fEntry;                               ///< Entry in the TChain
+    bool fRestarted;                            ///< Ran out of files and restarted from the beginning of the TChain
+    Int_t fNNewTrees;                           ///< Number of trees initialized before reading the entry
+    UInt_t fNewTreeFileNumber[2];               ///< File number of each tree initialized before reading the entry
+    Int_t fLowerEntry;                          ///< First entry of the current tree
+    Int_t fUpperEntry;                          ///< Last entry of the current tree
+    Int_t fOffset;                              ///< Offset from fLowerEntry where the loop over the tree started
+    UInt_t fFileNumber;                         ///< File number corresponding to the current tree
+    int fPythiaTrialsFromFile;                  ///< Average number of trials extracted from the xsec file
+    double fPythiaCrossSectionFromFile;         ///< Average pythia cross section extracted from the xsec file
+    int fPythiaTrials;                          ///< Number of pythia trials
+    double fPythiaCrossSection;                 ///< Pythia cross section
+    double fPythiaPtHard;                       ///< Pt hard
+    UInt_t fRejection;                          ///< Rejection mask (see AliAnalysisTaskEmcalEmbeddingHelper::EmbeddedEventRejection_t)
+    bool fHasVertex;                            ///< The embedded event has a primary vertex
+    Double_t fVertex[3];                        ///< Primary vertex of the embedded event
+    TObjArray *fContent;                        ///< Content of the event (candidates only, see HandOver())
+  };
+
+  AliEmcalEmbeddingReadAhead(const AliAnalysisTaskEmcalEmbeddingHelper * helper, Int_t depth);
+  ~AliEmcalEmbeddingReadAhead();
+
+  bool Pop(Entry & entry);
+  static bool HandOver(TObjArray * content, AliVEvent * event);
+  static bool CheckEntry(AliAnalysisTaskEmcalEmbeddingHelper * helper, const Entry & entry);
+
+ private:
+  AliEmcalEmbeddingReadAhead(const AliEmcalEmbeddingReadAhead &);             // not implemented
+  AliEmcalEmbeddingReadAhead & operator=(const AliEmcalEmbeddingReadAhead &); // not implemented
+
+  bool Init();
+  void Next(Entry & entry);
+  void InitTree(Entry & entry);
+  void SetEventProperties(Entry & entry);
+  TObjArray * TakeContent();
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+  void Run();
+#endif
+
+  static const size_t kMaxEntries = 10000;      ///< Maximum number of queued entries (including rejected ones)
+
+  const AliAnalysisTaskEmcalEmbeddingHelper *fHelper; ///< Embedding helper (configuration and selection)
+  Int_t fDepth;                                 ///< Number of candidate events to read ahead
+  std::vector<std::string> fFilenames;          ///< Files of the TChain of the embedding helper, in the same order
+  std::vector<std::string> fPythiaCrossSectionFilenames; ///< Paths to the pythia xsection files
+  TString fTreeName;                            ///< Name of the ESD/AOD tree
+  bool fRandomEventNumberAccess;                ///< Start from a random entry in each tree
+  UInt_t fMaxNumberOfFiles;                     ///< Max number of files that are in the TChain
+  bool fInitialized;                            ///< TChain and event are set up
+  TChain *fChain;                               ///< Own TChain
+  AliVEvent *fEvent;                            ///< Own external event
+  AliGenPythiaEventHeader *fPythiaHeader;       ///< Pythia header of the current event
+  int fPythiaTrials;                            ///< Number of pythia trials of the current event
+  int fPythiaTrialsFromFile;                    ///< Average number of trials extracted from a xsec file
+  double fPythiaCrossSection;                   ///< Pythia cross section of the current event
+  double fPythiaCrossSectionFromFile;           ///< Average pythia cross section extracted from a xsec file
+  double fPythiaPtHard;                         ///< Pt hard of the current event
+  bool fInitializedNewFile;                     ///< The entry indices have been initialized for the first tree
+  bool fWrappedAroundTree;                      ///< Wrapped around the current tree
+  Int_t fCurrentEntry;                          ///< Current entry
+  Int_t fLowerEntry;                            ///< First entry of the current tree
+  Int_t fUpperEntry;                            ///< Last entry of the current tree
+  Int_t fOffset;                                ///< Offset from fLowerEntry where the loop over the tree starts
+  UInt_t fFileNumber;                           ///< File number corresponding to the current tree
+  std::deque<Entry> fEntries;                   ///< Queued entries
+  Int_t fNCandidates;                           ///< Number of queued entries which are not rejected
+  bool fFailed;                                 ///< The TChain could not be set up
+  bool fStop;                                   ///< The worker should stop
+  bool fThreaded;                               ///< The entries are read on the worker thread
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+  std::mutex fMutex;                            ///< Protects the queue
+  std::condition_variable fNotEmpty;            ///< Signals a new entry
+  std::condition_variable fNotFull;             ///< Signals a consumed entry or stop
+  std::thread fThread;                          ///< Worker thread
+#endif
+};
+
+/**
+ * Constructor. Copies the list of files from the TChain of the embedding helper and starts the worker.
+ *
+ * @param[in] helper Embedding helper, which must have set up its TChain
+ * @param[in] depth Number of candidate events to read ahead
+ */
+AliEmcalEmbeddingReadAhead::AliEmcalEmbeddingReadAhead(const AliAnalysisTaskEmcalEmbeddingHelper * helper, Int_t depth) :
+  fHelper(helper),
+  fDepth(depth > 0 ? depth : 1),
+  fFilenames(),
+  fPythiaCrossSectionFilenames(helper->fPythiaCrossSectionFilenames),
+  fTreeName(helper->fTreeName),
+  fRandomEventNumberAccess(helper->fRandomEventNumberAccess),
+  fMaxNumberOfFiles(helper->fMaxNumberOfFiles),
+  fInitialized(false),
+  fChain(nullptr),
+  fEvent(nullptr),
+  fPythiaHeader(nullptr),
+  fPythiaTrials(0),
+  fPythiaTrialsFromFile(0),
+  fPythiaCrossSection(0.),
+  fPythiaCrossSectionFromFile(0.),
+  fPythiaPtHard(0.),
+  fInitializedNewFile(false),
+  fWrappedAroundTree(false),
+  fCurrentEntry(0),
+  fLowerEntry(0),
+  fUpperEntry(0),
+  fOffset(0),
+  fFileNumber(0),
+  fEntries(),
+  fNCandidates(0),
+  fFailed(false),
+  fStop(false),
+  fThreaded(false)
+{
+  TIter next(helper->fChain->GetListOfFiles());
+  while (TChainElement * element = static_cast<TChainElement *>(next())) {
+    fFilenames.push_back(element->GetTitle());
+  }
+
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+  if (gGlobalMutex) {
+    fThreaded = true;
+    fThread = std::thread(&AliEmcalEmbeddingReadAhead::Run, this);
+  }
+  else {
+    AliWarningGeneral("AliEmcalEmbeddingReadAhead", "ROOT thread safety not enabled in the steering macro, the embedded events are read when they are requested");
+  }
+#endif
+}
+
+/**
+ * Destructor. Stops the worker.
+ */
+AliEmcalEmbeddingReadAhead::~AliEmcalEmbeddingReadAhead()
+{
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fStop = true;
+  }
+  fNotFull.notify_all();
+  if (fThread.joinable()) fThread.join();
+#endif
+  for (auto & entry : fEntries) {
+    delete entry.fContent;
+  }
+  delete fEvent;
+  delete fChain;
+}
+
+/**
+ * Set up the TChain and the external event. Called by the thread which reads the entries.
+ *
+ * @return true if successful
+ */
+bool AliEmcalEmbeddingReadAhead::Init()
+{
+  fInitialized = true;
+
+  if (fTreeName == "aodTree") {
+    fEvent = new AliAODEvent();
+  }
+  else if (fTreeName == "esdTree") {
+    fEvent = new AliESDEvent();
+  }
+  else {
+    return false;
+  }
+
+  fChain = new TChain(fTreeName);
+  for (const auto & filename : fFilenames) {
+    fChain->Add(filename.c_str());
+  }
+  fEvent->ReadFromTree(fChain, fTreeName);
+
+  return fMaxNumberOfFiles > 0;
+}
+
+/**
+ * Read the next entry, following the same steps as AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry().
+ *
+ * @param[out] entry Properties of the entry
+ */
+void AliEmcalEmbeddingReadAhead::Next(Entry & entry)
+{
+  entry.fRestarted = false;
+  entry.fNNewTrees = 0;
+
+  if (!fInitializedNewFile) {
+    InitTree(entry);
+  }
+
+  // Reset to start of tree
+  if (fCurrentEntry == fUpperEntry) {
+    fCurrentEntry = fLowerEntry;
+    fWrappedAroundTree = true;
+  }
+
+  if (fCurrentEntry >= fLowerEntry + fOffset && fWrappedAroundTree) {
+    InitTree(entry);
+  }
+
+  if (fFileNumber >= fMaxNumberOfFiles) {
+    // Restart from the beginning of the TChain
+    entry.fRestarted = true;
+    fFileNumber = 0;
+    fUpperEntry = 0;
+    InitTree(entry);
+  }
+
+  fChain->GetEntry(fCurrentEntry);
+
+  entry.fEntry = fCurrentEntry;
+  entry.fLowerEntry = fLowerEntry;
+  entry.fUpperEntry = fUpperEntry;
+  entry.fOffset = fOffset;
+  entry.fFileNumber = fFileNumber;
+  SetEventProperties(entry);
+  entry.fContent = (entry.fRejection == 0) ? TakeContent() : nullptr;
+
+  fCurrentEntry++;
+}
+
+/**
+ * Initialize the next tree within the TChain, following the same steps as
+ * AliAnalysisTaskEmcalEmbeddingHelper::InitTree().
+ *
+ * @param[in,out] entry Properties of the entry which will be read next
+ */
+void AliEmcalEmbeddingReadAhead::InitTree(Entry & entry)
+{
+  fChain->GetEntry(fUpperEntry);
+
+  fLowerEntry = fUpperEntry;
+  fUpperEntry += fChain->GetTree()->GetEntries();
+
+  if (fRandomEventNumberAccess) {
+    TRandom3 rand(0);
+    fOffset = TMath::Nint(rand.Rndm()*(fUpperEntry-fLowerEntry))-1;
+  }
+  else {
+    fOffset = 0;
+  }
+
+  fCurrentEntry = fLowerEntry + fOffset;
+
+  if (fLowerEntry > 0) {
+    fFileNumber++;
+  }
+
+  if (entry.fNNewTrees < 2) {
+    entry.fNewTreeFileNumber[entry.fNNewTrees] = fFileNumber;
+  }
+  entry.fNNewTrees++;
+
+  if (fFileNumber < fPythiaCrossSectionFilenames.size()) {
+    fHelper->PythiaInfoFromCrossSectionFile(fPythiaCrossSectionFilenames.at(fFileNumber), fPythiaTrialsFromFile, fPythiaCrossSectionFromFile);
+  }
+
+  fWrappedAroundTree = false;
+  fInitializedNewFile = true;
+}
+
+/**
+ * Determine the pythia properties, the rejection mask and the vertex of the current event,
+ * following AliAnalysisTaskEmcalEmbeddingHelper::SetEmbeddedEventProperties().
+ *
+ * @param[in,out] entry Properties of the entry
+ */
+void AliEmcalEmbeddingReadAhead::SetEventProperties(Entry & entry)
+{
+  AliAODMCHeader* aodMCH = dynamic_cast<AliAODMCHeader*>(fEvent->FindListObject(AliAODMCHeader::StdBranchName()));
+  if (aodMCH) {
+    for (UInt_t i = 0;i<aodMCH->GetNCocktailHeaders();i++) {
+      fPythiaHeader = dynamic_cast<AliGenPythiaEventHeader*>(aodMCH->GetCocktailHeader(i));
+      if (fPythiaHeader) break;
+    }
+  }
+
+  if (fPythiaHeader) {
+    fPythiaCrossSection = fPythiaHeader->GetXsection();
+    fPythiaTrials = fPythiaHeader->Trials();
+    fPythiaPtHard = fPythiaHeader->GetPtHard();
+    if (fPythiaCrossSection == 0.) fPythiaCrossSection = fPythiaCrossSectionFromFile;
+    if (fPythiaTrials == 0.) fPythiaTrials = fPythiaTrialsFromFile;
+  }
+
+  entry.fPythiaTrialsFromFile = fPythiaTrialsFromFile;
+  entry.fPythiaCrossSectionFromFile = fPythiaCrossSectionFromFile;
+  entry.fPythiaTrials = fPythiaTrials;
+  entry.fPythiaCrossSection = fPythiaCrossSection;
+  entry.fPythiaPtHard = fPythiaPtHard;
+  entry.fRejection = fHelper->DetermineEmbeddedEventRejection(fEvent, fPythiaHeader, fPythiaPtHard);
+
+  const AliVVertex *vertex = fEvent->GetPrimaryVertex();
+  entry.fHasVertex = (vertex != nullptr);
+  entry.fVertex[0] = entry.fVertex[1] = entry.fVertex[2] = 0;
+  if (vertex) vertex->GetXYZ(entry.fVertex);
+}
+
+/**
+ * Move the content of the current event out of the external event of the worker, so that it can be handed
+ * over to the embedding helper. The objects of the TClonesArrays are moved, the other objects are streamed
+ * into a buffer. The worker's TClonesArrays create new objects when the next entry is read.
+ *
+ * @return Content of the event, one element per object of the list of the event
+ */
+TObjArray * AliEmcalEmbeddingReadAhead::TakeContent()
+{
+  TList * list = fEvent->GetList();
+  TObjArray * content = new TObjArray(list->GetEntries());
+  content->SetOwner(kTRUE);
+
+  TIter next(list);
+  while (TObject * obj = next()) {
+    TClonesArray * array = dynamic_cast<TClonesArray *>(obj);
+    if (array) {
+      TClonesArray * moved = new TClonesArray(array->GetClass(), array->GetEntriesFast());
+      moved->AbsorbObjects(array);
+      content->Add(moved);
+    }
+    else {
+      TBufferFile * buffer = new TBufferFile(TBuffer::kWrite);
+      obj->Streamer(*buffer);
+      content->Add(buffer);
+    }
+  }
+
+  return content;
+}
+
+/**
+ * Hand over the content of an event read ahead (see TakeContent()) to the external event of the embedding
+ * helper, keeping the arrays of the external event (the containers point to them). The objects of the
+ * TClonesArrays are moved and their TRef are registered again, the other objects are streamed from the buffer.
+ *
+ * @param[in] content Content of the event, which is emptied
+ * @param[in,out] event External event of the embedding helper
+ * @return false if the content does not correspond to the event. The event must then be read again.
+ */
+bool AliEmcalEmbeddingReadAhead::HandOver(TObjArray * content, AliVEvent * event)
+{
+  TList * list = event->GetList();
+  if (!content || content->GetEntriesFast() != list->GetEntries()) return false;
+
+  Int_t i = 0;
+  TIter next(list);
+  while (TObject * obj = next()) {
+    TObject * item = content->At(i++);
+    TClonesArray * array = dynamic_cast<TClonesArray *>(obj);
+    if (array) {
+      TClonesArray * moved = dynamic_cast<TClonesArray *>(item);
+      if (!moved || moved->GetClass() != array->GetClass()) return false;
+      array->Clear("C");
+      array->AbsorbObjects(moved);
+      for (Int_t j = 0; j < array->GetEntriesFast(); j++) {
+        TObject * movedObj = array->UncheckedAt(j);
+        if (!movedObj || !movedObj->TestBit(kIsReferenced)) continue;
+        TProcessID * pid = TProcessID::GetProcessWithUID(movedObj);
+        if (pid) pid->PutObjectWithID(movedObj);
+      }
+    }
+    else {
+      TBufferFile * buffer = dynamic_cast<TBufferFile *>(item);
+      if (!buffer) return false;
+      buffer->SetReadMode();
+      buffer->SetBufferOffset(0);
+      obj->Streamer(*buffer);
+    }
+  }
+
+  return true;
+}
+
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+/**
+ * Worker: read entries until the requested number of candidate events is queued.
+ */
+void AliEmcalEmbeddingReadAhead::Run()
+{
+  if (!Init()) {
+    std::lock_guard<std::mutex> lock(fMutex);
+    fFailed = true;
+    fNotEmpty.notify_all();
+    return;
+  }
+
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(fMutex);
+      fNotFull.wait(lock, [this] { return fStop || (fNCandidates < fDepth && fEntries.size() < kMaxEntries); });
+      if (fStop) return;
+    }
+
+    Entry entry;
+    Next(entry);
+
+    {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fEntries.push_back(entry);
+      if (entry.fRejection == 0) fNCandidates++;
+    }
+    fNotEmpty.notify_one();
+  }
+}
+#endif
+
+/**
+ * Retrieve the next entry, in the same order as without read ahead. Waits if the worker has not
+ * yet read it.
+ *
+ * @param[out] entry Properties of the entry
+ * @return false if the TChain could not be set up
+ */
+bool AliEmcalEmbeddingReadAhead::Pop(Entry & entry)
+{
+#ifdef ALIEMCALEMBEDDINGREADAHEAD_THREAD
+  if (fThreaded) {
+    std::unique_lock<std::mutex> lock(fMutex);
+    fNotEmpty.wait(lock, [this] { return !fEntries.empty() || fFailed; });
+    if (fEntries.empty()) return false;
+    entry = fEntries.front();
+    fEntries.pop_front();
+    if (entry.fRejection == 0) fNCandidates--;
+    lock.unlock();
+    fNotFull.notify_one();
+    return true;
+  }
+#endif
+  if (!fInitialized) fFailed = !Init();
+  if (fFailed) return false;
+  Next(entry);
+  return true;
+}
+
+/**
+ * Compare an entry provided by the read ahead with the synchronous path (see
+ * AliAnalysisTaskEmcalEmbeddingHelper::SetCheckReadAhead()). Must be called before the state of the
+ * embedding helper is updated with the entry.
+ *
+ * The position in the TChain is compared with the one which GetNextEntry() would load next, starting from
+ * the same state (the random offset into a new tree is taken from the entry). The entry is then read into
+ * the external event of the embedding helper and the part of the selection which only depends on the embedded
+ * event, as well as the vertex, are determined again and compared.
+ *
+ * @param[in] helper Embedding helper, with its state before the entry
+ * @param[in] entry Entry provided by the read ahead
+ * @return true if the entry is the same as in the synchronous path
+ */
+bool AliEmcalEmbeddingReadAhead::CheckEntry(AliAnalysisTaskEmcalEmbeddingHelper * helper, const Entry & entry)
+{
+  // Position in the TChain, following GetNextEntry()
+  bool expectNewTree = !helper->fInitializedNewFile;
+  Int_t current = helper->fCurrentEntry;
+  if (!expectNewTree) {
+    bool wrapped = helper->fWrappedAroundTree;
+    if (current == helper->fUpperEntry) {
+      current = helper->fLowerEntry;
+      wrapped = true;
+    }
+    expectNewTree = (current >= helper->fLowerEntry + helper->fOffset && wrapped);
+  }
+
+  bool sameEntry = (expectNewTree == (entry.fNNewTrees > 0));
+  if (sameEntry && expectNewTree) {
+    // Following InitTree(), restarting from the first tree if there are no more files
+    Int_t lower = entry.fRestarted ? 0 : helper->fUpperEntry;
+    Int_t treeEntries = -1;
+    if (helper->fChain->LoadTree(lower) >= 0) treeEntries = helper->fChain->GetTree()->GetEntries();
+    sameEntry = (entry.fLowerEntry == lower && entry.fUpperEntry == lower + treeEntries &&
+                 entry.fEntry == entry.fLowerEntry + entry.fOffset &&
+                 (helper->fRandomEventNumberAccess || entry.fOffset == 0));
+  }
+  else if (sameEntry) {
+    sameEntry = (entry.fEntry == current && entry.fLowerEntry == helper->fLowerEntry && entry.fUpperEntry == helper->fUpperEntry);
+  }
+
+  // Selection on the embedded event, following IsEventSelected()
+  helper->fChain->GetEntry(entry.fEntry);
+  helper->SetEmbeddedEventProperties();
+  UInt_t rejection = helper->DetermineEmbeddedEventRejection(helper->fExternalEvent, helper->fPythiaHeader, helper->fPythiaPtHard);
+  Double_t vertex[3] = {0};
+  const AliVVertex *externalVert = helper->fExternalEvent->GetPrimaryVertex();
+  if (externalVert) externalVert->GetXYZ(vertex);
+  bool sameSelection = (rejection == entry.fRejection && (externalVert != nullptr) == entry.fHasVertex &&
+                        helper->fPythiaPtHard == entry.fPythiaPtHard);
+  for (Int_t i = 0; i < 3 && externalVert; i++) {
+    if (vertex[i] != entry.fVertex[i]) sameSelection = false;
+  }
+
+  if (!sameEntry) {
+    AliErrorGeneralStream("AliEmcalEmbeddingReadAhead") << "Read ahead provided entry " << entry.fEntry << " (tree " << entry.fLowerEntry << "-" << entry.fUpperEntry
+      << ", new trees: " << entry.fNNewTrees << "), expected entry " << current << " (tree " << helper->fLowerEntry << "-" << helper->fUpperEntry
+      << ", new tree: " << expectNewTree << ")!\n";
+  }
+  if (!sameSelection) {
+    AliErrorGeneralStream("AliEmcalEmbeddingReadAhead") << "Selection of entry " << entry.fEntry << " differs: rejection " << entry.fRejection
+      << " (read ahead) " << rejection << " (synchronous), pt hard " << entry.fPythiaPtHard << " (read ahead) " << helper->fPythiaPtHard << " (synchronous)\n";
+  }
+
+  if (helper->fCreateHisto) {
+    helper->fHistManager.FillTH1("fHistReadAheadCheck", "Entries");
+    if (!sameEntry) helper->fHistManager.FillTH1("fHistReadAheadCheck", "EntryDiffers");
+    if (!sameSelection) helper->fHistManager.FillTH1("fHistReadAheadCheck", "SelectionDiffers");
+  }
+
+  return sameEntry && sameSelection;
+}
+
 AliAnalysisTaskEmcalEmbeddingHelper* AliAnalysisTaskEmcalEmbeddingHelper::fgInstance = nullptr;
 
 /**
@@ -165,7 +722,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fReadAheadEvents(0),
+  fCheckReadAhead(false),
+  fReadAhead(nullptr)
 {
   if (fgInstance != nullptr) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -235,7 +795,10 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fPythiaCrossSectionFromFile(0.),
   fPythiaPtHard(0.),
   fPrintTimingInfoToLog(false),
-  fTimer()
+  fTimer(),
+  fReadAheadEvents(0),
+  fCheckReadAhead(false),
+  fReadAhead(nullptr)
 {
   if (fgInstance != 0) {
     AliError("An instance of AliAnalysisTaskEmcalEmbeddingHelper already exists: it will be deleted!!!");
@@ -257,6 +820,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
 AliAnalysisTaskEmcalEmbeddingHelper::~AliAnalysisTaskEmcalEmbeddingHelper()
 {
   if (fgInstance == this) fgInstance = nullptr;
+  delete fReadAhead;
   if (fExternalEvent) delete fExternalEvent;
   if (fExternalFile) {
     fExternalFile->Close();
@@ -320,6 +884,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RetrieveTaskPropertiesFromYAMLConfig()
   res = fYAMLConfig.GetProperty("randomFileAccess", fRandomFileAccess, false);
   res = fYAMLConfig.GetProperty("createHisto", fCreateHisto, false);
   res = fYAMLConfig.GetProperty("printTimingInfoInLog", fPrintTimingInfoToLog, false);
+  res = fYAMLConfig.GetProperty("readAheadEvents", fReadAheadEvents, false);
+  res = fYAMLConfig.GetProperty("checkReadAhead", fCheckReadAhead, false);
   // More general embedding helper properties
   res = fYAMLConfig.GetProperty("filePattern", fFilePattern, false);
   res = fYAMLConfig.GetProperty("inputFilename", fInputFilename, false);
@@ -810,6 +1376,8 @@ void AliAnalysisTaskEmcalEmbeddingHelper::DetermineFirstFileToEmbed()
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 {
+  if (fReadAhead) return GetNextEntryFromReadAhead();
+
   Int_t attempts = -1;
 
   do {
@@ -886,6 +1454,95 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
   return kTRUE;
 }
 
+/**
+ * Get the next event when reading ahead (see SetReadAheadEvents()). The entries are provided by the worker
+ * in the same order as in GetNextEntry(), together with the part of the selection which only depends on
+ * the embedded event. The remaining selection is applied here and the accepted event, already read by the
+ * worker, is handed over to the external event (see AliEmcalEmbeddingReadAhead::HandOver()). Histograms
+ * and logging are handled as in GetNextEntry() and InitTree().
+ *
+ * @return kTRUE if successful
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntryFromReadAhead()
+{
+  Int_t attempts = -1;
+  AliEmcalEmbeddingReadAhead::Entry entry;
+  bool selected = false;
+
+  do {
+    if (!fReadAhead->Pop(entry)) return kFALSE;
+
+    if (fCheckReadAhead) AliEmcalEmbeddingReadAhead::CheckEntry(this, entry);
+
+    if (entry.fRestarted) {
+      AliError("====================================================================================================");
+      AliError("== No more files available to embed from the TChain! Restarting from the beginning of the TChain! ==");
+      AliError("== Be careful to check that this is the desired action!                                           ==");
+      AliError("====================================================================================================");
+    }
+
+    // Account for the trees which were initialized by the worker
+    for (Int_t i = 0; i < entry.fNNewTrees && i < 2; i++) {
+      fHistManager.FillTH1("fHistNumberOfFilesEmbedded", 1);
+      fHistManager.FillTH1("fHistAbsoluteFileNumber", (entry.fNewTreeFileNumber[i] + fFilenameIndex) % fMaxNumberOfFiles);
+      if (fPythiaCrossSectionFilenames.size() > 0 && entry.fNewTreeFileNumber[i] >= fPythiaCrossSectionFilenames.size()) {
+        AliErrorStream() << "Attempted to read past the end of the pythia cross section filenames vector. File number: " << entry.fNewTreeFileNumber[i] << ", vector size: " << fPythiaCrossSectionFilenames.size() << ".\nThis should only occur if we have run out of files to embed!\n";
+      }
+    }
+    if (entry.fNNewTrees > 0) {
+      fLowerEntry = entry.fLowerEntry;
+      fUpperEntry = entry.fUpperEntry;
+      fOffset = entry.fOffset;
+      fFileNumber = entry.fFileNumber;
+      fInitializedNewFile = kTRUE;
+      AliDebug(2, TString::Format("Will start embedding file %i beginning from entry %i (entry %i within the file). NOTE: This file number is not equal to the absolute file number in the file list!", fFileNumber, entry.fEntry, entry.fEntry - fLowerEntry));
+    }
+    AliDebug(4, TString::Format("Loading entry %i between %i-%i, starting with offset %i from the lower bound of %i", entry.fEntry, fLowerEntry, fUpperEntry, fOffset, fLowerEntry));
+
+    // Set relevant event properties
+    fPythiaTrialsFromFile = entry.fPythiaTrialsFromFile;
+    fPythiaCrossSectionFromFile = entry.fPythiaCrossSectionFromFile;
+    fPythiaTrials = entry.fPythiaTrials;
+    fPythiaCrossSection = entry.fPythiaCrossSection;
+    fPythiaPtHard = entry.fPythiaPtHard;
+
+    // Increment current entry
+    fCurrentEntry = entry.fEntry + 1;
+    // Entries before the starting offset are only reached after wrapping around the tree
+    fWrappedAroundTree = (entry.fEntry < fLowerEntry + fOffset);
+
+    // Provide a check for number of attempts
+    attempts++;
+    if (attempts == 1000)
+      AliWarning("After 1000 attempts no event has been accepted by the event selection (trigger, centrality...)!");
+
+    // Record event properties
+    if (fCreateHisto) {
+      RecordEmbeddedEventProperties();
+    }
+
+    selected = IsEventSelected(entry.fRejection, entry.fHasVertex ? entry.fVertex : nullptr);
+    if (!selected) delete entry.fContent;
+
+  } while (!selected);
+
+  // Hand over the accepted event. It is only read again if the content does not match the external event.
+  bool handedOver = AliEmcalEmbeddingReadAhead::HandOver(entry.fContent, fExternalEvent);
+  delete entry.fContent;
+  if (!handedOver) {
+    AliWarning(TString::Format("Could not hand over entry %i read ahead, reading it again!", entry.fEntry));
+    fChain->GetEntry(entry.fEntry);
+  }
+  SetEmbeddedEventProperties();
+
+  if (fCreateHisto) {
+    fHistManager.FillTH1("fHistEventCount", "Accepted");
+    fHistManager.FillTH1("fHistEmbeddedEventsAttempted", attempts);
+  }
+
+  return kTRUE;
+}
+
 /**
  * Set some properties of the event that are not immediately available from the external event to make them
  * available to user tasks.
@@ -938,13 +1595,32 @@ void AliAnalysisTaskEmcalEmbeddingHelper::RecordEmbeddedEventProperties()
 }
 
 /**
- * Handles (ie wraps) event selection and proper event counting.
+ * Handles (ie wraps) event selection and proper event counting for the current external event.
  *
  * @return kTRUE if the event successfully passes all criteria.
  */
 Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected()
 {
-  if (CheckIsEmbeddedEventSelected()) {
+  Double_t externalVertex[3]={0};
+  const AliVVertex *externalVert = fExternalEvent->GetPrimaryVertex();
+  if (externalVert) {
+    externalVert->GetXYZ(externalVertex);
+  }
+
+  return IsEventSelected(DetermineEmbeddedEventRejection(fExternalEvent, fPythiaHeader, fPythiaPtHard), externalVert ? externalVertex : nullptr);
+}
+
+/**
+ * Handles (ie wraps) event selection and proper event counting.
+ *
+ * @param[in] rejection Rejection mask determined by DetermineEmbeddedEventRejection()
+ * @param[in] externalVertex Primary vertex of the external event (nullptr if not available)
+ *
+ * @return kTRUE if the event successfully passes all criteria.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected(UInt_t rejection, const Double_t * externalVertex)
+{
+  if (CheckIsEmbeddedEventSelected(rejection, externalVertex)) {
     return kTRUE;
   }
 
@@ -957,28 +1633,33 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::IsEventSelected()
 }
 
 /**
- * Performs the embedded event selection on the current external event.
+ * Performs the part of the embedded event selection which only depends on the external event (pt hard,
+ * physics selection and MC outliers). It does not fill any histograms, so that it can also be used when
+ * reading ahead on the worker thread.
  *
- * @return kTRUE if the event successfully passes all criteria.
+ * @param[in] event External event
+ * @param[in] pythiaHeader Pythia header of the external event (nullptr if not available)
+ * @param[in] ptHard Pt hard of the external event
+ *
+ * @return Mask of the failed criteria (see EmbeddedEventRejection_t), 0 if all are passed.
  */
-Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
+UInt_t AliAnalysisTaskEmcalEmbeddingHelper::DetermineEmbeddedEventRejection(const AliVEvent * event, AliGenPythiaEventHeader * pythiaHeader, double ptHard) const
 {
+  UInt_t rejection = 0;
+
   // Check if pt hard bin is 0, indicating a problem with the event or the grid.
   // In such a case, the event should be rejected.
   // This condition should only be applied if we have a valid pythia header.
   // (pt hard should still be set even if the production wasn't done in pt hard bins).
-  if (fPythiaPtHard == 0. && fPythiaHeader) {
+  if (ptHard == 0. && pythiaHeader) {
     AliDebugStream(3) << "Event rejected due to pt hard = 0, indicating a problem with the external event.\n";
-    if (fCreateHisto) {
-      fHistManager.FillTH1("fHistEmbeddedEventRejection", "PtHardIs0", 1);
-    }
-    return kFALSE;
+    rejection |= kPtHardIs0;
   }
 
   // Physics selection
   if (fTriggerMask != 0) {
     UInt_t res = 0;
-    const AliESDEvent *eev = dynamic_cast<const AliESDEvent*>(fExternalEvent);
+    const AliESDEvent *eev = dynamic_cast<const AliESDEvent*>(event);
     if (eev) {
       AliFatal("Event selection is not implemented for embedding ESDs.");
       // Unfortunately, the normal method of retrieving the trigger mask (commented out below) doesn't work for the embedded event since we don't
@@ -988,7 +1669,7 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
       // Suggestions are welcome here!
       //res = (dynamic_cast<AliInputEventHandler*>(AliAnalysisManager::GetAnalysisManager()->GetInputEventHandler()))->IsEventSelected();
     } else {
-      const AliAODEvent *aev = dynamic_cast<const AliAODEvent*>(fExternalEvent);
+      const AliAODEvent *aev = dynamic_cast<const AliAODEvent*>(event);
       if (aev) {
         res = (dynamic_cast<AliVAODHeader*>(aev->GetHeader()))->GetOfflineTrigger();
       }
@@ -997,20 +1678,76 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
     if ((res & fTriggerMask) == 0) {
       AliDebug(3, Form("Event rejected due to physics selection. Event trigger mask: %d, trigger mask selection: %d.",
                       res, fTriggerMask));
-      if (fCreateHisto) {
-        fHistManager.FillTH1("fHistEmbeddedEventRejection", "PhysSel", 1);
+      rejection |= kPhysSel;
+    }
+  }
+
+  // Check for pt hard bin outliers
+  if (pythiaHeader && fMCRejectOutliers)
+  {
+    // Pythia jet / pT-hard > factor
+    // This corresponds to "condition 1" in AliAnalysisTaskEmcal
+    // NOTE: The other "conditions" defined there are not really suitable to define here, since they
+    //       depend on the input objects of the event
+    if (fPtHardJetPtRejectionFactor > 0.) {
+      TLorentzVector jet;
+
+      Int_t nTriggerJets =  pythiaHeader->NTriggerJets();
+
+      AliDebugStream(4) << "Pythia Njets: " << nTriggerJets << ", pT Hard: " << ptHard << "\n";
+
+      Float_t tmpjet[]={0,0,0,0};
+      for (Int_t iJet = 0; iJet< nTriggerJets; iJet++) {
+        pythiaHeader->TriggerJet(iJet, tmpjet);
+
+        jet.SetPxPyPzE(tmpjet[0],tmpjet[1],tmpjet[2],tmpjet[3]);
+
+        AliDebugStream(5) << "Pythia jet " << iJet << ", pycell jet pT: " << jet.Pt() << "\n";
+
+        //Compare jet pT and pt Hard
+        if (jet.Pt() > fPtHardJetPtRejectionFactor * ptHard) {
+          AliDebugStream(3) << "Event rejected because of MC outlier removal. Pythia header jet with: pT Hard " << ptHard << ", pycell jet pT " << jet.Pt() << ", rejection factor " << fPtHardJetPtRejectionFactor << "\n";
+          rejection |= kMCOutlier;
+          break;
+        }
       }
-      return kFALSE;
     }
   }
 
+  return rejection;
+}
+
+/**
+ * Performs the embedded event selection, combining the criteria which only depend on the external event
+ * with the vertex selection, which also depends on the internal event. The criteria are checked in the
+ * same order as they are recorded in the rejection histogram.
+ *
+ * @param[in] rejection Rejection mask determined by DetermineEmbeddedEventRejection()
+ * @param[in] externalVertex Primary vertex of the external event (nullptr if not available)
+ *
+ * @return kTRUE if the event successfully passes all criteria.
+ */
+Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected(UInt_t rejection, const Double_t * externalVertex)
+{
+  if (rejection & kPtHardIs0) {
+    if (fCreateHisto) {
+      fHistManager.FillTH1("fHistEmbeddedEventRejection", "PtHardIs0", 1);
+    }
+    return kFALSE;
+  }
+
+  // Physics selection
+  if (rejection & kPhysSel) {
+    if (fCreateHisto) {
+      fHistManager.FillTH1("fHistEmbeddedEventRejection", "PhysSel", 1);
+    }
+    return kFALSE;
+  }
+
   // Vertex selection
-  Double_t externalVertex[3]={0};
   Double_t inputVertex[3]={0};
-  const AliVVertex *externalVert = fExternalEvent->GetPrimaryVertex();
   const AliVVertex *inputVert = AliAnalysisTaskSE::InputEvent()->GetPrimaryVertex();
-  if (externalVert && inputVert) {
-    externalVert->GetXYZ(externalVertex);
+  if (externalVertex && inputVert) {
     inputVert->GetXYZ(inputVertex);
 
     if (TMath::Abs(externalVertex[2]) > fZVertexCut) {
@@ -1034,35 +1771,9 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::CheckIsEmbeddedEventSelected()
   }
 
   // Check for pt hard bin outliers
-  if (fPythiaHeader && fMCRejectOutliers)
-  {
-    // Pythia jet / pT-hard > factor
-    // This corresponds to "condition 1" in AliAnalysisTaskEmcal
-    // NOTE: The other "conditions" defined there are not really suitable to define here, since they
-    //       depend on the input objects of the event
-    if (fPtHardJetPtRejectionFactor > 0.) {
-      TLorentzVector jet;
-
-      Int_t nTriggerJets =  fPythiaHeader->NTriggerJets();
-
-      AliDebugStream(4) << "Pythia Njets: " << nTriggerJets << ", pT Hard: " << fPythiaPtHard << "\n";
-
-      Float_t tmpjet[]={0,0,0,0};
-      for (Int_t iJet = 0; iJet< nTriggerJets; iJet++) {
-        fPythiaHeader->TriggerJet(iJet, tmpjet);
-
-        jet.SetPxPyPzE(tmpjet[0],tmpjet[1],tmpjet[2],tmpjet[3]);
-
-        AliDebugStream(5) << "Pythia jet " << iJet << ", pycell jet pT: " << jet.Pt() << "\n";
-
-        //Compare jet pT and pt Hard
-        if (jet.Pt() > fPtHardJetPtRejectionFactor * fPythiaPtHard) {
-          AliDebugStream(3) << "Event rejected because of MC outlier removal. Pythia header jet with: pT Hard " << fPythiaPtHard << ", pycell jet pT " << jet.Pt() << ", rejection factor " << fPtHardJetPtRejectionFactor << "\n";
-          fHistManager.FillTH1("fHistEmbeddedEventRejection", "MCOutlier", 1);
-          return kFALSE;
-        }
-      }
-    }
+  if (rejection & kMCOutlier) {
+    fHistManager.FillTH1("fHistEmbeddedEventRejection", "MCOutlier", 1);
+    return kFALSE;
   }
 
   return kTRUE;
@@ -1209,6 +1920,21 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserCreateOutputObjects()
   histTitle = "Number of times each absolute file number was embedded";
   fHistManager.CreateTH1(histName, histTitle, fMaxNumberOfFiles, 0, fMaxNumberOfFiles);
 
+  // Time to provide the embedded event, to compare reading ahead with the synchronous path
+  histName = "fHistNextEntryTime";
+  histTitle = "Wall time to provide the accepted embedded event;#it{t} (ms);Counts";
+  fHistManager.CreateTH1(histName, histTitle, 500, 0, 500);
+
+  // Comparison of the read ahead with the synchronous path
+  if (fReadAheadEvents > 0 && fCheckReadAhead) {
+    histName = "fHistReadAheadCheck";
+    histTitle = "Entries provided by the read ahead compared with the synchronous path";
+    auto histReadAheadCheck = fHistManager.CreateTH1(histName, histTitle, 3, 0, 3);
+    histReadAheadCheck->GetXaxis()->SetBinLabel(1, "Entries");
+    histReadAheadCheck->GetXaxis()->SetBinLabel(2, "EntryDiffers");
+    histReadAheadCheck->GetXaxis()->SetBinLabel(3, "SelectionDiffers");
+  }
+
   if (fUseInternalEventSelection) {
     // Internal event cut statistics
     histName = "fHistInternalEventCutsStats";
@@ -1401,6 +2127,12 @@ void AliAnalysisTaskEmcalEmbeddingHelper::SetupEmbedding()
   if (fRandomEventNumberAccess) {
     AliInfo("Random event number access enabled!");
   }
+
+  // Start reading ahead if requested
+  if (fReadAheadEvents > 0 && !fReadAhead) {
+    AliInfo(TString::Format("Reading %d embedded events ahead!", fReadAheadEvents));
+    fReadAhead = new AliEmcalEmbeddingReadAhead(this, fReadAheadEvents);
+  }
   
   fInitializedEmbedding = kTRUE;
 }
@@ -1505,6 +2237,21 @@ void AliAnalysisTaskEmcalEmbeddingHelper::InitTree()
  * @return True if the information has been successfully extracted.
  */
 bool AliAnalysisTaskEmcalEmbeddingHelper::PythiaInfoFromCrossSectionFile(std::string pythiaFileName)
+{
+  return PythiaInfoFromCrossSectionFile(pythiaFileName, fPythiaTrialsFromFile, fPythiaCrossSectionFromFile);
+}
+
+/**
+ * Extract pythia information from a cross section file. Does not modify the task, so that it can also be
+ * used when reading ahead on the worker thread.
+ *
+ * @param[in] pythiaFileName Path to the pythia cross section file.
+ * @param[out] trialsFromFile Average number of trials (only set if successful).
+ * @param[out] crossSectionFromFile Average cross section (only set if successful).
+ *
+ * @return True if the information has been successfully extracted.
+ */
+bool AliAnalysisTaskEmcalEmbeddingHelper::PythiaInfoFromCrossSectionFile(std::string pythiaFileName, int & trialsFromFile, double & crossSectionFromFile) const
 {
   std::unique_ptr<TFile> fxsec(TFile::Open(pythiaFileName.c_str()));
 
@@ -1554,9 +2301,9 @@ bool AliAnalysisTaskEmcalEmbeddingHelper::PythiaInfoFromCrossSectionFile(std::st
     // We do not want to just use the overall value because some of the events may be rejected by various
     // event selections, so we only want that ones that were actually use. The easiest way to do so is by
     // filling it for each event.
-    fPythiaTrialsFromFile = trials/nEvents;
+    trialsFromFile = trials/nEvents;
     // Do __NOT__ divide by nEvents here! The value is already from a TProfile and therefore is already the mean!
-    fPythiaCrossSectionFromFile = crossSection;
+    crossSectionFromFile = crossSection;
 
     return true;
   }
@@ -1617,11 +2364,16 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserExec(Option_t*)
     }
   }
 
-  if (!fInitializedNewFile) {
+  // When reading ahead, the trees are initialized by the worker
+  if (!fInitializedNewFile && !fReadAhead) {
     InitTree();
   }
 
+  TStopwatch watch;
   Bool_t res = GetNextEntry();
+  if (fCreateHisto) {
+    fHistManager.FillTH1("fHistNextEntryTime", watch.RealTime() * 1e3);
+  }
 
   if (!res) {
     AliError("Unable to get the event to embed. Nothing will be embedded.");
@@ -1633,6 +2385,15 @@ void AliAnalysisTaskEmcalEmbeddingHelper::UserExec(Option_t*)
   }
 }
 
+/**
+ * Stop reading ahead at the end of the event loop.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::FinishTaskOutput()
+{
+  delete fReadAhead;
+  fReadAhead = nullptr;
+}
+
 /**
  * This function is called once at the end of the analysis.
  */
@@ -1784,6 +2545,8 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "File list filename: \"" << fFileListFilename << "\"\n";
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Print timing info to log: " << fPrintTimingInfoToLog << "\n";
+  tempSS << "Read ahead events: " << fReadAheadEvents << "\n";
+  tempSS << "Check read ahead: " << fCheckReadAhead << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
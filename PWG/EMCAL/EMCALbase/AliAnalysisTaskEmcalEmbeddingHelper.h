@@ -23,6 +23,7 @@ class AliVEvent;
 class AliVHeader;
 class AliGenPythiaEventHeader;
 class AliEmcalList;
+class AliEmcalEmbeddingReadAhead;
 
 #include <iosfwd>
 #include <vector>
@@ -80,6 +81,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
    */
   void      UserExec(Option_t *option)                           ;
   void      UserCreateOutputObjects()                            ;
+  void      FinishTaskOutput()                                   ;
   void      Terminate(Option_t *option)                          ;
   /* @} */
 
@@ -115,6 +117,8 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
   TString GetFileListFilename()                             const { return fFileListFilename; }
   bool GetCreateHistos()                                    const { return fCreateHisto; }
+  Int_t GetReadAheadEvents()                                const { return fReadAheadEvents; }
+  bool GetCheckReadAhead()                                  const { return fCheckReadAhead; }
 
   // Set
   /// Set the pt hard bin which will be added into the file pattern. Can also be omitted and set directly in the pattern.
@@ -149,6 +153,19 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetCreateHistos(bool b)                                    { fCreateHisto = b; }
   /// Set path to %YAML configuration file
   void SetConfigurationPath(const char * path)                    { fConfigurationPath = path; }
+  /**
+   * Read the embedded events ahead on a worker thread, which keeps up to n candidate events (accepted
+   * by the part of the selection which only depends on the embedded event) in advance. The entries
+   * are read in the same order as without read ahead, and the accepted event is handed over without
+   * reading it again. TRef of the embedded event can resolve to objects of the events read ahead.
+   * 0 (default) disables the read ahead.
+   */
+  void SetReadAheadEvents(Int_t n)                                { fReadAheadEvents = n; }
+  /**
+   * Compare each entry provided by the read ahead with the entry and selection of the synchronous path
+   * (see fHistReadAheadCheck). Each entry is then read a second time, so this is only meant for validation.
+   */
+  void SetCheckReadAhead(bool b = true)                           { fCheckReadAhead = b; }
   /* @} */
 
   /**
@@ -291,19 +308,30 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          SetupInputFiles()     ;
   std::string     ConstructFullPythiaXSecFilename(std::string inputFilename, const std::string & pythiaFilename, bool testIfExists) const;
   Bool_t          GetNextEntry()        ;
+  Bool_t          GetNextEntryFromReadAhead();
   void            SetEmbeddedEventProperties();
   void            RecordEmbeddedEventProperties();
   Bool_t          IsEventSelected()     ;
-  Bool_t          CheckIsEmbeddedEventSelected();
+  Bool_t          IsEventSelected(UInt_t rejection, const Double_t * externalVertex);
+  UInt_t          DetermineEmbeddedEventRejection(const AliVEvent * event, AliGenPythiaEventHeader * pythiaHeader, double ptHard) const;
+  Bool_t          CheckIsEmbeddedEventSelected(UInt_t rejection, const Double_t * externalVertex);
   Bool_t          InitEvent()           ;
   void            InitTree()            ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
+  bool            PythiaInfoFromCrossSectionFile(std::string filename, int & trials, double & crossSection) const;
   // Helper functions
   bool            IsFileAccessible() const;
   void            ConnectToAliEn() const;
   // LEGO Train utility
   void            RemoveDummyTask() const;
 
+  /// Reasons to reject an embedded event which only depend on the embedded event itself (bit mask)
+  enum EmbeddedEventRejection_t {
+    kPtHardIs0 = BIT(0),                        ///< Pt hard is 0, indicating a problem with the external event
+    kPhysSel = BIT(1),                          ///< Rejected by the physics selection
+    kMCOutlier = BIT(2)                         ///< Rejected by the MC outlier rejection
+  };
+
   UInt_t                                        fTriggerMask;       ///<  Trigger selection mask
   bool                                          fMCRejectOutliers;  ///<  If true, MC outliers will be rejected
   Double_t                                      fPtHardJetPtRejectionFactor; ///<  Factor which the pt hard bin is multiplied by to compare against pythia header jets pt
@@ -366,6 +394,9 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   
   bool                                          fPrintTimingInfoToLog; ///< Flag to print time to execute InitTree(), for logging purposes
   TStopwatch                                    fTimer            ;    //!<! Timer for the InitTree() function
+  Int_t                                         fReadAheadEvents  ; ///<  Number of candidate events read ahead on a worker thread (0: disabled)
+  bool                                          fCheckReadAhead   ; ///<  Compare the entries provided by the read ahead with the synchronous path
+  AliEmcalEmbeddingReadAhead                   *fReadAhead        ; //!<! Reads the embedded events ahead of the analysis
 
   static AliAnalysisTaskEmcalEmbeddingHelper   *fgInstance        ; //!<! Global instance of this class
 
@@ -373,8 +404,10 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper(const AliAnalysisTaskEmcalEmbeddingHelper&)           ; // not implemented
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
+  friend class AliEmcalEmbeddingReadAhead;
+
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 11);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 13);
   /// \endcond
 };
 #endif
@@ -25,6 +25,7 @@
 #include "AliTLorentzVector.h"
 
 #include "AliClusterContainer.h"
+#include "AliEmcalContainerKinematicsCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliClusterContainer);
@@ -272,6 +273,8 @@ Bool_t AliClusterContainer::GetMomentum(TLorentzVector &mom, const AliVCluster*
  */
 Bool_t AliClusterContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
 {
+  Bool_t status = kFALSE;
+  if (GetCachedMomentum(mom, i, status)) return status;
   AliVCluster *vc = GetCluster(i);
   return GetMomentum(mom, vc);
 }
@@ -312,6 +315,9 @@ Bool_t AliClusterContainer::GetNextAcceptMomentum(TLorentzVector &mom)
 
 Bool_t AliClusterContainer::AcceptCluster(Int_t i, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(i, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyClusterCuts(GetCluster(i), rejectionReason);
   if (!r) return kFALSE;
 
@@ -323,6 +329,9 @@ Bool_t AliClusterContainer::AcceptCluster(Int_t i, UInt_t &rejectionReason) cons
 
 Bool_t AliClusterContainer::AcceptCluster(const AliVCluster* clus, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(clus, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyClusterCuts(clus, rejectionReason);
   if (!r) return kFALSE;
 
@@ -512,6 +521,30 @@ const AliClusterIterableMomentumContainer AliClusterContainer::accepted_momentum
   return AliClusterIterableMomentumContainer(this, true);
 }
 
+/**
+ * Extend the configuration key of the kinematics cache with the
+ * cluster selection criteria.
+ * @param[out] key Configuration key
+ * @return False if the configuration cannot be compared exactly
+ */
+Bool_t AliClusterContainer::GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const
+{
+  if (!AliEmcalContainer::GetKinematicsCacheKey(key)) return kFALSE;
+  key.Add(fClusTimeCutLow);
+  key.Add(fClusTimeCutUp);
+  key.Add(fExoticCut);
+  key.Add(fDefaultClusterEnergy);
+  key.Add(fIncludePHOS);
+  key.Add(fIncludePHOSonly);
+  key.Add(fPhosMinNcells);
+  key.Add(fPhosMinM02);
+  key.Add(fEmcalMinM02);
+  key.Add(fEmcalMaxM02);
+  key.Add(fEmcalMaxM02CutEnergy);
+  for (Int_t i = 0; i <= AliVCluster::kLastUserDefEnergy; i++) key.Add(fUserDefEnergyCut[i]);
+  return kTRUE;
+}
+
 const char* AliClusterContainer::GetTitle() const
 {
   static TString clusterString;
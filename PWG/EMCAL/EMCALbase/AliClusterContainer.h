@@ -101,6 +101,7 @@ class AliClusterContainer : public AliEmcalContainer {
 #endif
 
  protected:
+  virtual Bool_t              GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const;
   /**
    * Create default array name for the cluster container. The
    * default array name will be
@@ -75,7 +75,11 @@ AliEMCALRecoUtils::AliEMCALRecoUtils():
   fCutRequireTPCRefit(kFALSE),            fCutRequireITSRefit(kFALSE),            fCutAcceptKinkDaughters(kFALSE),
   fCutMaxDCAToVertexXY(0),                fCutMaxDCAToVertexZ(0),                 fCutDCAToVertex2D(kFALSE),
   fCutRequireITSStandAlone(kFALSE),       fCutRequireITSpureSA(kFALSE),             
-  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1)
+  fNMCGenerToAccept(0),                   fMCGenerToAcceptForTrack(1),
+  fCalibTablesDirty(kTRUE),               fCalibTablesGeom(0),                    fCalibTablesNCells(0),
+  fCalibTablesNTimeSlots(0),              fCellChannel(),                         fChannelStatus(),
+  fChannelBad(),                          fChannelRecalibFactor(),                fCellTimeRecalibFactor(),
+  fSML1Phase()
 {
   // Init parameters
   InitParameters();
@@ -137,7 +141,12 @@ AliEMCALRecoUtils::AliEMCALRecoUtils(const AliEMCALRecoUtils & reco)
   fCutAcceptKinkDaughters(reco.fCutAcceptKinkDaughters),     fCutMaxDCAToVertexXY(reco.fCutMaxDCAToVertexXY),    
   fCutMaxDCAToVertexZ(reco.fCutMaxDCAToVertexZ),             fCutDCAToVertex2D(reco.fCutDCAToVertex2D),
   fCutRequireITSStandAlone(reco.fCutRequireITSStandAlone),   fCutRequireITSpureSA(reco.fCutRequireITSpureSA),
-  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack)
+  fNMCGenerToAccept(reco.fNMCGenerToAccept),                 fMCGenerToAcceptForTrack(reco.fMCGenerToAcceptForTrack),
+  fCalibTablesDirty(kTRUE),                                  fCalibTablesGeom(0),
+  fCalibTablesNCells(0),                                     fCalibTablesNTimeSlots(0),
+  fCellChannel(),                                            fChannelStatus(),
+  fChannelBad(),                                             fChannelRecalibFactor(),
+  fCellTimeRecalibFactor(),                                  fSML1Phase()
 {  
   for (Int_t i = 0; i < 15 ; i++) { fMisalRotShift[i]      = reco.fMisalRotShift[i]      ; 
                                     fMisalTransShift[i]    = reco.fMisalTransShift[i]    ; }
@@ -343,6 +352,8 @@ AliEMCALRecoUtils & AliEMCALRecoUtils::operator = (const AliEMCALRecoUtils & rec
     for(int ism = 0; ism < reco.fEMCALL1PhaseInTimeRecalibration->GetEntries(); ism++) fEMCALL1PhaseInTimeRecalibration->AddAt(reco.fEMCALL1PhaseInTimeRecalibration->At(ism), ism);
   }
 
+  fCalibTablesDirty = kTRUE;
+
   return *this;
 }
 
@@ -409,37 +420,65 @@ Bool_t AliEMCALRecoUtils::AcceptCalibrateCell(Int_t absID, Int_t bc,
   if ( absID < 0 || absID >= 24*48*geom->GetNumberOfSuperModules() ) 
     return kFALSE;
   
-  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1, status=0; 
+  if ( !UpdateCalibrationTables(geom) )
+    return kFALSE;
+  
+  Bool_t isLowGain = !(cells->GetCellHighGain(absID));//HG = false -> LG = true
+
+  return AcceptCalibrateCellFromTables(absID, bc, cells->GetCellAmplitude(absID), cells->GetCellTime(absID), isLowGain, amp, time);
+}
+
+///
+/// Same as AcceptCalibrateCell, with the cell amplitude and time already 
+/// read from the cells list and the calibration tables up to date.
+///
+/// \param absID: absolute cell ID number
+/// \param bc: bunch crossing number
+/// \param ampIn: input cell energy amplitude
+/// \param timeIn: input cell time
+/// \param isLowGain: cell is low gain
+/// \param amp: output calibrated amplitude
+/// \param time: output calibrated time
+///
+/// \return bool quality of cell, exists or not 
+///
+//_______________________________________________________________________________
+Bool_t AliEMCALRecoUtils::AcceptCalibrateCellFromTables(Int_t absID, Int_t bc,
+                                                        Float_t ampIn, Double_t timeIn, Bool_t isLowGain,
+                                                        Float_t  & amp,    Double_t & time) const
+{
+  if ( absID < 0 || absID >= fCalibTablesNCells ) 
+    return kFALSE;
   
-  if (!geom->GetCellIndex(absID,imod,iTower,iIphi,iIeta)) 
+  Int_t channel = fCellChannel[absID];
+  if ( channel < 0 ) 
   {
     // cell absID does not exist
     amp=0; time = 1.e9;
     return kFALSE; 
   }
   
-  geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);  
+  Int_t imod = channel / (48*24);
 
   // Do not include bad channels found in analysis,
   if ( IsBadChannelsRemovalSwitchedOn() )
   {
-    Bool_t bad = GetEMCALChannelStatus(imod, ieta, iphi,status);
+    Bool_t bad = fChannelBad[channel];
     
-    if ( status > 0 )
-      AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absID, status, bad));
+    if ( fChannelStatus[channel] > 0 )
+      AliDebug(1,Form("Channel absId %d, status %d, set as bad %d",absID, fChannelStatus[channel], bad));
     
     if ( bad ) return kFALSE;
   }
   
   //Recalibrate energy
-  amp  = cells->GetCellAmplitude(absID);
+  amp  = ampIn;
   if (!fCellsRecalibrated && IsRecalibrationOn())
-    amp *= GetEMCALChannelRecalibrationFactor(imod,ieta,iphi);
+    amp *= fChannelRecalibFactor[channel];
   
   // Recalibrate time
-  time = cells->GetCellTime(absID);
+  time = timeIn;
   time-=fConstantTimeShift*1e-9; // only in case of old Run1 simulation
-  Bool_t isLowGain = !(cells->GetCellHighGain(absID));//HG = false -> LG = true
 
   RecalibrateCellTime(absID,bc,time,isLowGain);
   
@@ -1238,6 +1277,8 @@ void AliEMCALRecoUtils::SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dea
   fBadStatusSelection[1] = dead; 
   fBadStatusSelection[2] = hot; 
   fBadStatusSelection[3] = warm; 
+  
+  fCalibTablesDirty = kTRUE;
 }
 
 ///
@@ -1253,11 +1294,34 @@ void AliEMCALRecoUtils::SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dea
 //____________________________________________________________________
 Bool_t AliEMCALRecoUtils::GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const 
 { 
+  if ( !fCalibTablesDirty && iSM >= 0 && iCol >= 0 && iCol < 48 && iRow >= 0 && iRow < 24 && 
+       (iSM*48+iCol)*24+iRow < fCalibTablesNCells )
+  {
+    Int_t channel = (iSM*48+iCol)*24+iRow;
+    status = fChannelStatus[channel];
+    return fChannelBad[channel];
+  }
+
   if(fEMCALBadChannelMap) 
     status = (Int_t) ((TH2I*)fEMCALBadChannelMap->At(iSM))->GetBinContent(iCol,iRow); 
   else 
     status = 0; // Channel is ok by default
   
+  return IsBadChannelStatus(iSM, iCol, iRow, status);
+}
+
+///
+/// \return declare channel with the given status as bad (true) or not (false),
+/// see GetEMCALChannelStatus
+///
+/// \param iSM: supermodule number of channel
+/// \param iCol: cell column in SM
+/// \param iRow: cell row in SM
+/// \param status: channel status
+///
+//____________________________________________________________________
+Bool_t AliEMCALRecoUtils::IsBadChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t status) const 
+{ 
   if ( status == AliCaloCalibPedestal::kAlive ) 
   {
     return kFALSE; // Good channel
@@ -1502,6 +1566,8 @@ void AliEMCALRecoUtils::InitEMCALRecalibrationFactors()
   fEMCALRecalibrationFactors->SetOwner(kTRUE);
   fEMCALRecalibrationFactors->Compress();
   
+  fCalibTablesDirty = kTRUE;
+  
   // In order to avoid rewriting the same histograms
   TH1::AddDirectory(oldStatus);    
 }
@@ -1547,6 +1613,8 @@ void AliEMCALRecoUtils::InitEMCALTimeRecalibrationFactors()
   fEMCALTimeRecalibrationFactors->SetOwner(kTRUE);
   fEMCALTimeRecalibrationFactors->Compress();
   
+  fCalibTablesDirty = kTRUE;
+  
   // In order to avoid rewriting the same histograms
   TH1::AddDirectory(oldStatus);    
 }
@@ -1572,6 +1640,8 @@ void AliEMCALRecoUtils::InitEMCALBadChannelStatusMap()
   fEMCALBadChannelMap->SetOwner(kTRUE);
   fEMCALBadChannelMap->Compress();
   
+  fCalibTablesDirty = kTRUE;
+  
   // In order to avoid rewriting the same histograms
   TH1::AddDirectory(oldStatus);    
 }
@@ -1598,10 +1668,95 @@ void AliEMCALRecoUtils::InitEMCALL1PhaseInTimeRecalibration()
   fEMCALL1PhaseInTimeRecalibration->SetOwner(kTRUE);
   fEMCALL1PhaseInTimeRecalibration->Compress();
   
+  fCalibTablesDirty = kTRUE;
+  
   // In order to avoid rewriting the same histograms
   TH1::AddDirectory(oldStatus);    
 }
 
+///
+/// Flatten the bad channel map, energy and time recalibration factors and L1 phase
+/// shifts into arrays, together with the absId to (SM, column, row) decomposition,
+/// so that the per-cell corrections do not need the geometry and the histograms.
+/// Tables are only rebuilt when the calibration histograms or the bad channel 
+/// selection were changed through the setters, or the geometry changed.
+/// The values are read from the histograms exactly as the histogram based 
+/// getters do, so the corrections are unchanged.
+///
+/// \param geom: pointer to geometry
+///
+/// \return true if the tables are available
+///
+//_________________________________________________________________________
+Bool_t AliEMCALRecoUtils::UpdateCalibrationTables(const AliEMCALGeometry* geom)
+{
+  if (!geom) return kFALSE;
+  
+  if (!fCalibTablesDirty && geom == fCalibTablesGeom) return kTRUE;
+  
+  AliDebug(1,"Rebuild calibration tables");
+  
+  Int_t nSM    = geom->GetNumberOfSuperModules();
+  Int_t nCells = 24*48*nSM;
+  
+  // absId -> channel index
+  fCellChannel.assign(nCells, -1);
+  Int_t imod = -1, iphi =-1, ieta=-1,iTower = -1, iIphi = -1, iIeta = -1; 
+  for (Int_t absId = 0; absId < nCells; absId++) 
+  {
+    if (!geom->GetCellIndex(absId,imod,iTower,iIphi,iIeta)) continue;
+    geom->GetCellPhiEtaIndexInSModule(imod,iTower,iIphi, iIeta,iphi,ieta);
+    Int_t channel = (imod*48+ieta)*24+iphi;
+    if (channel >= 0 && channel < nCells) fCellChannel[absId] = channel;
+  }
+  
+  // Per channel bad status and energy recalibration factors
+  fChannelStatus.assign(nCells, 0);
+  fChannelBad.assign(nCells, kFALSE);
+  fChannelRecalibFactor.assign(nCells, 1.);
+  for (Int_t sm = 0; sm < nSM; sm++) 
+  {
+    TH2I *hStatus = fEMCALBadChannelMap        ? (TH2I*)fEMCALBadChannelMap       ->At(sm) : 0;
+    TH2F *hRecal  = fEMCALRecalibrationFactors ? (TH2F*)fEMCALRecalibrationFactors->At(sm) : 0;
+    for (Int_t col = 0; col < 48; col++) 
+    {
+      for (Int_t row = 0; row < 24; row++) 
+      {
+        Int_t channel = (sm*48+col)*24+row;
+        if (hStatus) fChannelStatus[channel] = (Int_t) hStatus->GetBinContent(col,row);
+        if (hRecal)  fChannelRecalibFactor[channel] = (Float_t) hRecal->GetBinContent(col,row);
+        if (fChannelStatus[channel] != AliCaloCalibPedestal::kAlive)
+          fChannelBad[channel] = IsBadChannelStatus(sm, col, row, fChannelStatus[channel]);
+      }
+    }
+  }
+  
+  // Time recalibration per BC, and low gain, slot
+  fCalibTablesNTimeSlots = fEMCALTimeRecalibrationFactors ? TMath::Min(fEMCALTimeRecalibrationFactors->GetEntriesFast(), 8) : 0;
+  fCellTimeRecalibFactor.assign(fCalibTablesNTimeSlots*nCells, 0.);
+  for (Int_t slot = 0; slot < fCalibTablesNTimeSlots; slot++) 
+  {
+    TH1F *hTime = (TH1F*)fEMCALTimeRecalibrationFactors->At(slot);
+    if (!hTime) continue;
+    for (Int_t absId = 0; absId < nCells; absId++) 
+      fCellTimeRecalibFactor[slot*nCells+absId] = (Float_t) hTime->GetBinContent(absId);
+  }
+  
+  // L1 phase per SM
+  fSML1Phase.assign(nSM, 0);
+  TH1C *hL1Phase = fEMCALL1PhaseInTimeRecalibration ? (TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0) : 0;
+  if (hL1Phase) 
+  {
+    for (Int_t sm = 0; sm < nSM; sm++) fSML1Phase[sm] = (Int_t) hL1Phase->GetBinContent(sm);
+  }
+  
+  fCalibTablesNCells = nCells;
+  fCalibTablesGeom   = geom;
+  fCalibTablesDirty  = kFALSE;
+  
+  return kTRUE;
+}
+
 ///
 /// Recalibrate the cluster energy and time, considering the recalibration map 
 /// and the time and energy of the cells that compose the cluster.
@@ -1708,6 +1863,9 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
     return;
   }  
   
+  // Without geometry AcceptCalibrateCell rejects each cell, as before
+  Bool_t useTables = UpdateCalibrationTables(AliEMCALGeometry::GetInstance());
+  
   Short_t  absId  =-1;
   Bool_t   accept = kFALSE;
   Float_t  ecell  = 0;
@@ -1717,12 +1875,17 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
   Int_t  mclabel = -1;
   Double_t efrac = 0;
   
+  // Single pass over the cells list: amplitude, time and gain are taken 
+  // from the cell position instead of being searched by absId
   Int_t nEMcell  = cells->GetNumberOfCells() ;  
   for (Int_t iCell = 0; iCell < nEMcell; iCell++) 
   { 
     cells->GetCell( iCell, absId, ecellin, tcellin, mclabel, efrac );
     
-    accept = AcceptCalibrateCell(absId, bc, ecell ,tcell ,cells); 
+    if (useTables)
+      accept = AcceptCalibrateCellFromTables(absId, bc, ecellin, tcellin, !(cells->GetHighGain(iCell)), ecell, tcell); 
+    else
+      accept = AcceptCalibrateCell(absId, bc, ecell ,tcell ,cells); 
     if (!accept)
     {
       ecell = 0;
@@ -1748,7 +1911,10 @@ void AliEMCALRecoUtils::RecalibrateCells(AliVCaloCells * cells, Int_t bc)
 void AliEMCALRecoUtils::RecalibrateCellTime(Int_t absId, Int_t bc, Double_t & celltime, Bool_t isLGon) const
 {  
   if (!fCellsRecalibrated && IsTimeRecalibrationOn() && bc >= 0) {
-    if(fLowGain)
+    Int_t slot = bc%4 + ((fLowGain && isLGon) ? 4 : 0);
+    if (!fCalibTablesDirty && absId >= 0 && absId < fCalibTablesNCells && slot < fCalibTablesNTimeSlots)
+      celltime -= fCellTimeRecalibFactor[slot*fCalibTablesNCells+absId]*1.e-9;
+    else if(fLowGain)
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,isLGon)*1.e-9;
     else
       celltime -= GetEMCALChannelTimeRecalibrationFactor(bc%4,absId,kFALSE)*1.e-9;
@@ -1770,7 +1936,8 @@ void AliEMCALRecoUtils::RecalibrateCellTimeL1Phase(Int_t iSM, Int_t bc, Double_t
     bc=bc%4;
 
     Float_t offsetPerSM=0.;
-    Int_t l1PhaseShift = GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
+    Int_t l1PhaseShift = (!fCalibTablesDirty && iSM >= 0 && iSM < (Int_t)fSML1Phase.size()) ? 
+                         fSML1Phase[iSM] : GetEMCALL1PhaseInTimeRecalibrationForSM(iSM);
     Int_t l1Phase=l1PhaseShift & 3; //bit operation
 
     if(bc >= l1Phase)
@@ -3571,6 +3738,7 @@ void AliEMCALRecoUtils::SetTracksMatchedToCluster(const AliVEvent *event)
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(const TObjArray *map) { 
+  fCalibTablesDirty = kTRUE;
   if(fEMCALRecalibrationFactors) fEMCALRecalibrationFactors->Clear();
   else {
     fEMCALRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3597,9 +3765,11 @@ void AliEMCALRecoUtils::SetEMCALChannelRecalibrationFactors(Int_t iSM , const TH
   TH2F *clone = new TH2F(*h);
   clone->SetDirectory(NULL);
   fEMCALRecalibrationFactors->AddAt(clone,iSM); 
+  fCalibTablesDirty = kTRUE;
 }
 
 void AliEMCALRecoUtils::SetEMCALChannelStatusMap(const TObjArray *map) { 
+  fCalibTablesDirty = kTRUE;
   if(fEMCALBadChannelMap) fEMCALBadChannelMap->Clear();
   else {
     fEMCALBadChannelMap = new TObjArray(map->GetEntries());
@@ -3626,9 +3796,11 @@ void AliEMCALRecoUtils::SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h) {
   TH2I *clone = new TH2I(*h);
   clone->SetDirectory(NULL);
   fEMCALBadChannelMap->AddAt(clone,iSM); 
+  fCalibTablesDirty = kTRUE;
 }
 
 void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map) { 
+  fCalibTablesDirty = kTRUE;
   if(fEMCALTimeRecalibrationFactors) fEMCALTimeRecalibrationFactors->Clear();
   else {
     fEMCALTimeRecalibrationFactors = new TObjArray(map->GetEntries());
@@ -3655,9 +3827,11 @@ void  AliEMCALRecoUtils::SetEMCALChannelTimeRecalibrationFactors(Int_t bc, const
   TH1F *clone = new TH1F(*h);
   clone->SetDirectory(NULL);
   fEMCALTimeRecalibrationFactors->AddAt(clone,bc); 
+  fCalibTablesDirty = kTRUE;
 }
 
 void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArray *map) { 
+  fCalibTablesDirty = kTRUE;
   if(fEMCALL1PhaseInTimeRecalibration) fEMCALL1PhaseInTimeRecalibration->Clear();
   else {
     fEMCALL1PhaseInTimeRecalibration = new TObjArray(map->GetEntries());
@@ -3683,6 +3857,7 @@ void AliEMCALRecoUtils::SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TH1C* h
   TH1C *clone = new TH1C(*h);
   clone->SetDirectory(NULL);
   fEMCALL1PhaseInTimeRecalibration->AddAt(clone,0); 
+  fCalibTablesDirty = kTRUE;
 }
 
 ///
@@ -32,6 +32,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 // Root includes
+#include <vector>
 #include <TNamed.h>
 #include <TMath.h>
 class TObjArray;
@@ -161,6 +162,10 @@ public:
   void     RecalibrateClusterEnergy(const AliEMCALGeometry* geom, AliVCluster* cluster, AliVCaloCells * cells, Int_t bc=-1) ; // Energy and time
   void     ResetCellsCalibrated()                        { fCellsRecalibrated = kFALSE; }
 
+  // Flat per-cell calibration tables, rebuilt from the histograms when they change
+  void     InvalidateCalibrationTables()                 { fCalibTablesDirty = kTRUE ; } // call after modifying calibration histograms in place
+  Bool_t   UpdateCalibrationTables(const AliEMCALGeometry* geom) ;
+
   // Energy recalibration
   Bool_t   IsRecalibrationOn()                     const { return fRecalibration ; }
   void     SwitchOffRecalibration()                      { fRecalibration = kFALSE ; }
@@ -177,7 +182,7 @@ public:
     else return 1 ; } 
   void     SetEMCALChannelRecalibrationFactor(Int_t iSM , Int_t iCol, Int_t iRow, Double_t c = 1) { 
     if(!fEMCALRecalibrationFactors) InitEMCALRecalibrationFactors() ;
-    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; }
+    ((TH2F*)fEMCALRecalibrationFactors->At(iSM))->SetBinContent(iCol,iRow,c) ; fCalibTablesDirty = kTRUE ; }
   
   // Recalibrate channels energy with run dependent corrections
   Bool_t   IsRunDepRecalibrationOn()               const { return fUseRunCorrectionFactors ; }
@@ -202,7 +207,7 @@ public:
     else return 0 ; } 
   void     SetEMCALChannelTimeRecalibrationFactor(Int_t bc, Int_t absID, Double_t c = 0, Bool_t isLGon=kFALSE) { 
     if(!fEMCALTimeRecalibrationFactors) InitEMCALTimeRecalibrationFactors() ;
-    ((TH1F*)fEMCALTimeRecalibrationFactors->At(bc+4*isLGon))->SetBinContent(absID,c) ; }  
+    ((TH1F*)fEMCALTimeRecalibrationFactors->At(bc+4*isLGon))->SetBinContent(absID,c) ; fCalibTablesDirty = kTRUE ; }  
   
   TH1F *   GetEMCALChannelTimeRecalibrationFactors(Int_t bc)const       { return (TH1F*)fEMCALTimeRecalibrationFactors->At(bc) ; }	
   void     SetEMCALChannelTimeRecalibrationFactors(const TObjArray *map);
@@ -228,7 +233,7 @@ public:
     else return 0 ; } 
   void     SetEMCALL1PhaseInTimeRecalibrationForSM(Int_t iSM, Int_t c = 0) { 
     if(!fEMCALL1PhaseInTimeRecalibration) InitEMCALL1PhaseInTimeRecalibration();
-    ((TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0))->SetBinContent(iSM,c) ; }  
+    ((TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0))->SetBinContent(iSM,c) ; fCalibTablesDirty = kTRUE ; }  
   
   TH1C *   GetEMCALL1PhaseInTimeRecalibrationForAllSM()const       { return (TH1C*)fEMCALL1PhaseInTimeRecalibration->At(0) ; }	
   void     SetEMCALL1PhaseInTimeRecalibrationForAllSM(const TObjArray *map);
@@ -262,15 +267,15 @@ public:
   void     InitEMCALBadChannelStatusMap() ;
   void     SetEMCALBadChannelStatusSelection(Bool_t all, Bool_t dead, Bool_t hot, Bool_t warm);
   void     SetWarmChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kWarning] = kFALSE; fCalibTablesDirty = kTRUE; }
   void     SetDeadChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; }
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kDead]    = kFALSE; fCalibTablesDirty = kTRUE; }
   void     SetHotChannelAsGood() 
-           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; } 
+           { fBadStatusSelection[0] = kFALSE; fBadStatusSelection[AliCaloCalibPedestal::kHot]     = kFALSE; fCalibTablesDirty = kTRUE; } 
   Bool_t   GetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t & status) const ;
   void     SetEMCALChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Double_t status = 1) { 
     if(!fEMCALBadChannelMap)InitEMCALBadChannelStatusMap()               ;
-    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; }
+    ((TH2I*)fEMCALBadChannelMap->At(iSM))->SetBinContent(iCol,iRow,status)    ; fCalibTablesDirty = kTRUE ; }
   TH2I *   GetEMCALChannelStatusMap(Int_t iSM)     const { return (TH2I*)fEMCALBadChannelMap->At(iSM) ; }
   void     SetEMCALChannelStatusMap(const TObjArray *map);
   void     SetEMCALChannelStatusMap(Int_t iSM , const TH2I* h);
@@ -442,6 +447,10 @@ public:
                                                       Float_t & amp, TArrayI & labeArr, TArrayF & eDepArr ) const;
 private:  
   
+  Bool_t   IsBadChannelStatus(Int_t iSM , Int_t iCol, Int_t iRow, Int_t status) const ;
+  Bool_t   AcceptCalibrateCellFromTables(Int_t absID, Int_t bc, Float_t ampIn, Double_t timeIn, Bool_t isLowGain,
+                                         Float_t & amp, Double_t & time) const ;
+
   // Position recalculation
   Float_t    fMisalTransShift[15];       ///< Cluster position translation shift parameters
   Float_t    fMisalRotShift[15];         ///< Cluster position rotation shift parameters
@@ -548,8 +557,20 @@ private:
   TString    fMCGenerToAccept[5];        ///<  List with name of generators that should not be included
   Bool_t     fMCGenerToAcceptForTrack;   ///<  Activate the removal of tracks entering the track matching that come from a particular generator
   
+  // Flat calibration tables, channel index = (SM*48+col)*24+row
+  Bool_t                  fCalibTablesDirty;        //!<! Tables have to be rebuilt from the histograms
+  const AliEMCALGeometry *fCalibTablesGeom;         //!<! Geometry used to build the tables
+  Int_t                   fCalibTablesNCells;       //!<! Number of cells in the tables
+  Int_t                   fCalibTablesNTimeSlots;   //!<! Number of BC (and low gain) slots in the time table
+  std::vector<Int_t>      fCellChannel;             //!<! absId -> channel index, -1 if the cell does not exist
+  std::vector<Int_t>      fChannelStatus;           //!<! channel index -> bad channel status
+  std::vector<Bool_t>     fChannelBad;              //!<! channel index -> channel considered bad with the current status selection
+  std::vector<Float_t>    fChannelRecalibFactor;    //!<! channel index -> energy recalibration factor
+  std::vector<Float_t>    fCellTimeRecalibFactor;   //!<! slot*NCells+absId -> time recalibration shift
+  std::vector<Int_t>      fSML1Phase;               //!<! SM -> L1 phase shift
+  
   /// \cond CLASSIMP
-  ClassDef(AliEMCALRecoUtils, 26) ;
+  ClassDef(AliEMCALRecoUtils, 27) ;
   /// \endcond
 
 };
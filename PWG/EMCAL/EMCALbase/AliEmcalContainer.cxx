@@ -13,6 +13,7 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 #include <TClonesArray.h>
+#include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliLog.h"
 #include "AliNamedArrayI.h"
@@ -22,6 +23,8 @@
 #include "AliEmcalContainerUtils.h"
 
 #include "AliEmcalContainer.h"
+#include "AliEmcalContainerKinematicsCache.h"
+#include "AliEmcalContainerKinematicsCacheManager.h"
 
 /// \cond CLASSIMP
 ClassImp(AliEmcalContainer);
@@ -55,6 +58,13 @@ AliEmcalContainer::AliEmcalContainer():
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fUseKinematicsCache(kFALSE),
+  fKinematicsCacheManager(0),
+  fKinematicsCache(0),
+  fOwnKinematicsCache(kFALSE),
+  fFillingKinematicsCache(kFALSE),
+  fCurrentEvent(0),
+  fCurrentEntry(-1),
   fClassName()
 {
   fVertex[0] = 0;
@@ -92,6 +102,13 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fUseKinematicsCache(kFALSE),
+  fKinematicsCacheManager(0),
+  fKinematicsCache(0),
+  fOwnKinematicsCache(kFALSE),
+  fFillingKinematicsCache(kFALSE),
+  fCurrentEvent(0),
+  fCurrentEntry(-1),
   fClassName()
 {
   fVertex[0] = 0;
@@ -99,6 +116,14 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fVertex[2] = 0;
 }
 
+/**
+ * Destructor. Deletes the kinematics cache if it is not owned by a cache manager.
+ */
+AliEmcalContainer::~AliEmcalContainer()
+{
+  if (fOwnKinematicsCache) delete fKinematicsCache;
+}
+
 /**
  * Index operator, accessing object in the container at a given index.
  * Operates on all objects inside the container.
@@ -190,6 +215,160 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+
+  fCurrentEvent = event;
+  if (fKinematicsCache && fOwnKinematicsCache) {
+    // a private cache is refilled at the first access in the new event
+    fKinematicsCache->Invalidate();
+  }
+  else if (fKinematicsCacheManager) {
+    // a shared cache is recognized as outdated by the event and entry it was filled for
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    fCurrentEntry = mgr ? mgr->GetCurrentEntry() : -1;
+  }
+}
+
+/**
+ * Fill the key identifying the configuration of the container. Containers
+ * with identical keys select the same objects with the same momenta and can
+ * therefore share a kinematics cache. Derived classes adding selection criteria
+ * must extend the key.
+ * @param[out] key Configuration key
+ * @return False if the configuration cannot be compared exactly (the cache is then not shared)
+ */
+Bool_t AliEmcalContainer::GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const
+{
+  key.Add(IsA()->GetName());
+  key.Add(fClArrayName.Data());
+  key.Add(fIsEmbedding);
+  key.Add(fBitMap);
+  key.Add(fMinPt);
+  key.Add(fMaxPt);
+  key.Add(fMinE);
+  key.Add(fMaxE);
+  key.Add(fMinEta);
+  key.Add(fMaxEta);
+  key.Add(fMinPhi);
+  key.Add(fMaxPhi);
+  key.Add(fMinMCLabel);
+  key.Add(fMaxMCLabel);
+  key.Add(fMassHypothesis);
+  return kTRUE;
+}
+
+/**
+ * Get the kinematics cache for the current event, filling it if needed.
+ * At the first call the cache is taken from the cache manager, or created
+ * privately if no manager is set or the configuration cannot be shared.
+ * @return Cache filled for the current event, NULL if the cache is disabled
+ * or being filled
+ */
+const AliEmcalContainerKinematicsCache *AliEmcalContainer::GetKinematicsCache() const
+{
+  if (!fUseKinematicsCache || fFillingKinematicsCache || !fClArray) return 0;
+
+  if (!fKinematicsCache) {
+    AliEmcalContainerKinematicsCacheKey key;
+    if (fKinematicsCacheManager && GetKinematicsCacheKey(key)) {
+      fKinematicsCache = fKinematicsCacheManager->GetCache(key);
+    }
+    else {
+      if (fKinematicsCacheManager) AliWarning(Form("%s: configuration cannot be compared with other containers, using a private kinematics cache", GetName()));
+      fKinematicsCache = new AliEmcalContainerKinematicsCache;
+      fOwnKinematicsCache = kTRUE;
+    }
+  }
+
+  Int_t nentries = GetNEntries();
+  if (!fKinematicsCache->IsValidFor(fCurrentEvent, fCurrentEntry, nentries)) FillKinematicsCache(nentries);
+
+  return fKinematicsCache;
+}
+
+/**
+ * Fill the kinematics cache running the full selection and
+ * momentum calculation of the container on all objects.
+ * @param[in] nentries Number of objects in the container
+ */
+void AliEmcalContainer::FillKinematicsCache(Int_t nentries) const
+{
+  AliEmcalContainerKinematicsCache &cache = *fKinematicsCache;
+  fFillingKinematicsCache = kTRUE;
+
+  cache.Resize(nentries);
+  cache.fIndexMap.reserve(nentries);
+  TLorentzVector mom;
+  for (Int_t i = 0; i < nentries; i++) {
+    const TObject *obj = (*this)[i];
+    cache.fObjects[i] = obj;
+    if (obj) cache.fIndexMap[obj] = i;
+
+    UInt_t rejectionReason = 0;
+    cache.fAccepted[i] = AcceptObject(i, rejectionReason);
+    cache.fRejectionReason[i] = rejectionReason;
+
+    cache.fMomentumStatus[i] = GetMomentum(mom, i);
+    cache.fPx[i] = mom.Px();
+    cache.fPy[i] = mom.Py();
+    cache.fPz[i] = mom.Pz();
+    cache.fE[i] = mom.E();
+  }
+
+  cache.fEvent = fCurrentEvent;
+  cache.fEntry = fCurrentEntry;
+  cache.fNEntries = nentries;
+  fFillingKinematicsCache = kFALSE;
+}
+
+/**
+ * Read the selection result of the object at index i from the cache.
+ * @param[in] i Index of the object
+ * @param[out] rejectionReason Bitmap with the reason why the object was rejected (combined with the input value)
+ * @param[out] accepted Selection result
+ * @return True if the result was found in the cache, false if it has to be computed
+ */
+Bool_t AliEmcalContainer::GetCachedAcceptance(Int_t i, UInt_t &rejectionReason, Bool_t &accepted) const
+{
+  const AliEmcalContainerKinematicsCache *cache = GetKinematicsCache();
+  if (!cache || i < 0 || i >= cache->fNEntries) return kFALSE;
+  rejectionReason |= cache->fRejectionReason[i];
+  accepted = cache->fAccepted[i];
+  return kTRUE;
+}
+
+/**
+ * Read the selection result of an object from the cache, using
+ * the object-to-index map instead of a scan of the array.
+ * @param[in] obj Object to check
+ * @param[out] rejectionReason Bitmap with the reason why the object was rejected (combined with the input value)
+ * @param[out] accepted Selection result
+ * @return True if the result was found in the cache, false if it has to be computed
+ */
+Bool_t AliEmcalContainer::GetCachedAcceptance(const TObject *obj, UInt_t &rejectionReason, Bool_t &accepted) const
+{
+  const AliEmcalContainerKinematicsCache *cache = GetKinematicsCache();
+  if (!cache || !obj) return kFALSE;
+  Int_t i = cache->IndexOf(obj);
+  if (i < 0) return kFALSE;
+  rejectionReason |= cache->fRejectionReason[i];
+  accepted = cache->fAccepted[i];
+  return kTRUE;
+}
+
+/**
+ * Read the momentum of the object at index i from the cache.
+ * @param[out] mom Momentum vector
+ * @param[in] i Index of the object
+ * @param[out] status Return value of GetMomentum for this object
+ * @return True if the momentum was found in the cache, false if it has to be computed
+ */
+Bool_t AliEmcalContainer::GetCachedMomentum(TLorentzVector &mom, Int_t i, Bool_t &status) const
+{
+  const AliEmcalContainerKinematicsCache *cache = GetKinematicsCache();
+  if (!cache || i < 0 || i >= cache->fNEntries) return kFALSE;
+  mom.SetPxPyPzE(cache->fPx[i], cache->fPy[i], cache->fPz[i], cache->fE[i]);
+  status = cache->fMomentumStatus[i];
+  return kTRUE;
 }
 
 /**
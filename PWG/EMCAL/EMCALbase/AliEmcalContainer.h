@@ -10,6 +10,9 @@ class AliTLorentzVector;
 class AliVEvent;
 class AliNamedArrayI;
 class AliVParticle;
+struct AliEmcalContainerKinematicsCache;
+struct AliEmcalContainerKinematicsCacheKey;
+class AliEmcalContainerKinematicsCacheManager;
 
 #include <TNamed.h>
 #include <TClonesArray.h>
@@ -120,7 +123,7 @@ class AliEmcalContainer : public TObject {
 
   AliEmcalContainer();
   AliEmcalContainer(const char *name); 
-  virtual ~AliEmcalContainer(){;}
+  virtual ~AliEmcalContainer();
 
   virtual TObject *operator[](int index) const = 0;
 
@@ -176,6 +179,10 @@ class AliEmcalContainer : public TObject {
   void                        SetClassName(const char *clname);
   void                        SetIsEmbedding(Bool_t b)                  { fIsEmbedding = b ; }
   Bool_t                      GetIsEmbedding() const                    { return fIsEmbedding; }
+  void                        SetUseKinematicsCache(Bool_t b = kTRUE)   { fUseKinematicsCache = b; }
+  Bool_t                      GetUseKinematicsCache() const             { return fUseKinematicsCache; }
+  void                        SetKinematicsCacheManager(AliEmcalContainerKinematicsCacheManager *m) { fKinematicsCacheManager = m; if (m) fUseKinematicsCache = kTRUE; }
+  AliEmcalContainerKinematicsCacheManager *GetKinematicsCacheManager() const { return fKinematicsCacheManager; }
 
   const char*                 GetName()                       const { return fName.Data()               ; }
   void                        SetName(const char* n)                { fName = n                         ; }
@@ -204,6 +211,13 @@ class AliEmcalContainer : public TObject {
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return ""; }
   void                        GetVertexFromEvent(const AliVEvent * event);
 
+  const AliEmcalContainerKinematicsCache *GetKinematicsCache() const;
+  Bool_t                      GetCachedAcceptance(Int_t i, UInt_t &rejectionReason, Bool_t &accepted) const;
+  Bool_t                      GetCachedAcceptance(const TObject *obj, UInt_t &rejectionReason, Bool_t &accepted) const;
+  Bool_t                      GetCachedMomentum(TLorentzVector &mom, Int_t i, Bool_t &status) const;
+  void                        FillKinematicsCache(Int_t nentries) const;
+  virtual Bool_t              GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const;
+
   TString                     fName;                    ///< object name
   TString                     fClArrayName;             ///< name of branch
   TString                     fBaseClassName;           ///< name of the base class that this container can handle
@@ -226,6 +240,13 @@ class AliEmcalContainer : public TObject {
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  Bool_t                      fUseKinematicsCache;      ///< compute acceptance and momenta once per event and serve them from a cache
+  AliEmcalContainerKinematicsCacheManager *fKinematicsCacheManager; ///< owner of the caches shared with other containers of the same configuration
+  mutable AliEmcalContainerKinematicsCache *fKinematicsCache; //!<! per-event cache of acceptance and momenta
+  mutable Bool_t              fOwnKinematicsCache;      //!<! the cache is private to the container (not owned by the manager)
+  mutable Bool_t              fFillingKinematicsCache;  //!<! the cache is being filled (bypass it)
+  const AliVEvent            *fCurrentEvent;            //!<! event given to the last NextEvent
+  Long64_t                    fCurrentEntry;            //!<! entry of the analysis manager at the last NextEvent
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -234,7 +255,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
   /// \endcond
 };
 #endif
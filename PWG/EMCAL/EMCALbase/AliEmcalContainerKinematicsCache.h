@@ -0,0 +1,99 @@
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#ifndef ALIEMCALCONTAINERKINEMATICSCACHE_H
+#define ALIEMCALCONTAINERKINEMATICSCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Rtypes.h>
+
+class TObject;
+class AliVEvent;
+
+/**
+ * @class AliEmcalContainerKinematicsCache
+ * @ingroup EMCALCOREFW
+ * @brief Per-event cache of acceptance and four-momenta of the objects in an EMCAL container
+ *
+ * The cache is filled once per event (lazily, at the first access after AliEmcalContainer::NextEvent)
+ * by running the full selection (AcceptObject) and momentum calculation (GetMomentum) of the owning
+ * container on every object of the array. The results are stored in structure-of-arrays form:
+ * - \f$ p_{x} \f$, \f$ p_{y} \f$, \f$ p_{z} \f$, E
+ * - selection result and rejection reason bitmap
+ * - map from the object address to its index in the array
+ *
+ * Containers with identical configuration (see AliEmcalContainer::GetKinematicsCacheKey) connected
+ * to the same AliEmcalContainerKinematicsCacheManager share one cache object, which is then only
+ * filled by the first container accessing it in a given event.
+ */
+struct AliEmcalContainerKinematicsCache {
+  AliEmcalContainerKinematicsCache() :
+    fEvent(0), fEntry(-1), fNEntries(-1),
+    fPx(), fPy(), fPz(), fE(),
+    fMomentumStatus(), fAccepted(), fRejectionReason(), fObjects(), fIndexMap() {}
+
+  /// Whether the cache was filled for the given event
+  bool IsValidFor(const AliVEvent *event, Long64_t entry, Int_t nentries) const
+  { return fNEntries >= 0 && fEvent == event && fEntry == entry && fNEntries == nentries; }
+
+  /// Drop content (keeping the allocated memory)
+  void Invalidate() { fNEntries = -1; }
+
+  /// Resize all arrays to n objects
+  void Resize(Int_t n)
+  {
+    fPx.resize(n); fPy.resize(n); fPz.resize(n); fE.resize(n);
+    fMomentumStatus.resize(n); fAccepted.resize(n); fRejectionReason.resize(n);
+    fObjects.resize(n);
+    fIndexMap.clear();
+  }
+
+  /// Index of an object in the array, -1 if the object is not in the cache
+  Int_t IndexOf(const TObject *obj) const
+  {
+    std::unordered_map<const TObject *, Int_t>::const_iterator it = fIndexMap.find(obj);
+    return it == fIndexMap.end() ? -1 : it->second;
+  }
+
+  const AliVEvent                           *fEvent;             ///< Event the cache was filled for
+  Long64_t                                   fEntry;             ///< Entry of the analysis manager the cache was filled for
+  Int_t                                      fNEntries;          ///< Number of objects in the cache (-1 = invalid)
+
+  std::vector<Double_t>                      fPx;                ///< \f$ p_{x} \f$
+  std::vector<Double_t>                      fPy;                ///< \f$ p_{y} \f$
+  std::vector<Double_t>                      fPz;                ///< \f$ p_{z} \f$
+  std::vector<Double_t>                      fE;                 ///< Energy (with the mass hypothesis of the container)
+  std::vector<Bool_t>                        fMomentumStatus;    ///< return value of GetMomentum
+  std::vector<Bool_t>                        fAccepted;          ///< return value of AcceptObject
+  std::vector<UInt_t>                        fRejectionReason;   ///< rejection reason bitmap
+  std::vector<const TObject *>               fObjects;           ///< object at each index
+  std::unordered_map<const TObject *, Int_t> fIndexMap;          ///< object to index map
+};
+
+/**
+ * @class AliEmcalContainerKinematicsCacheKey
+ * @ingroup EMCALCOREFW
+ * @brief Configuration of a container as seen by the kinematics cache
+ *
+ * Holds the names (class, array, period...) and the values of all selection parameters
+ * of a container. Values are compared exactly, two containers get the same key only
+ * if all their parameters are identical.
+ */
+struct AliEmcalContainerKinematicsCacheKey {
+  AliEmcalContainerKinematicsCacheKey() : fNames(), fValues() {}
+
+  void Add(const char *name) { fNames.push_back(name); }
+  void Add(Double_t value)   { fValues.push_back(value); }
+
+  bool operator<(const AliEmcalContainerKinematicsCacheKey &other) const
+  { return fNames != other.fNames ? fNames < other.fNames : fValues < other.fValues; }
+
+  std::vector<std::string>                   fNames;             ///< Class, array name and other string parameters
+  std::vector<Double_t>                      fValues;            ///< Selection parameters (integers are exactly represented)
+};
+
+#endif
+#endif
@@ -0,0 +1,99 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <map>
+
+#include <RVersion.h>
+
+#include "AliEmcalContainerKinematicsCache.h"
+#include "AliEmcalContainerKinematicsCacheManager.h"
+
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIEMCALCONTAINERKINEMATICSCACHE_THREAD
+#include <mutex>
+#endif
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalContainerKinematicsCacheManager);
+/// \endcond
+
+/**
+ * @struct AliEmcalContainerKinematicsCacheRegistry
+ * @brief Caches held by an AliEmcalContainerKinematicsCacheManager, by configuration
+ */
+struct AliEmcalContainerKinematicsCacheRegistry {
+  std::map<AliEmcalContainerKinematicsCacheKey, AliEmcalContainerKinematicsCache *> fCaches; ///< Caches by configuration
+#ifdef ALIEMCALCONTAINERKINEMATICSCACHE_THREAD
+  std::mutex fMutex;                                                                           ///< Protects fCaches
+#endif
+};
+
+/**
+ * Default constructor, for ROOT I/O.
+ */
+AliEmcalContainerKinematicsCacheManager::AliEmcalContainerKinematicsCacheManager():
+  TNamed(),
+  fRegistry(new AliEmcalContainerKinematicsCacheRegistry)
+{
+}
+
+/**
+ * Standard constructor.
+ * @param[in] name Name of the manager
+ */
+AliEmcalContainerKinematicsCacheManager::AliEmcalContainerKinematicsCacheManager(const char *name):
+  TNamed(name, name),
+  fRegistry(new AliEmcalContainerKinematicsCacheRegistry)
+{
+}
+
+/**
+ * Destructor. Deletes all caches, the manager must therefore
+ * not be deleted before the containers connected to it.
+ */
+AliEmcalContainerKinematicsCacheManager::~AliEmcalContainerKinematicsCacheManager()
+{
+  for (std::map<AliEmcalContainerKinematicsCacheKey, AliEmcalContainerKinematicsCache *>::iterator it = fRegistry->fCaches.begin(); it != fRegistry->fCaches.end(); ++it) {
+    delete it->second;
+  }
+  delete fRegistry;
+}
+
+/**
+ * Get the cache for a given container configuration, creating it
+ * at the first request. The cache stays owned by the manager.
+ * @param[in] key Configuration of the container
+ * @return Cache shared by all containers with this configuration
+ */
+AliEmcalContainerKinematicsCache *AliEmcalContainerKinematicsCacheManager::GetCache(const AliEmcalContainerKinematicsCacheKey &key)
+{
+#ifdef ALIEMCALCONTAINERKINEMATICSCACHE_THREAD
+  std::lock_guard<std::mutex> lock(fRegistry->fMutex);
+#endif
+  AliEmcalContainerKinematicsCache *&cache = fRegistry->fCaches[key];
+  if (!cache) cache = new AliEmcalContainerKinematicsCache;
+  return cache;
+}
+
+/**
+ * Get the number of different container configurations seen.
+ * @return Number of caches
+ */
+Int_t AliEmcalContainerKinematicsCacheManager::GetNCaches() const
+{
+#ifdef ALIEMCALCONTAINERKINEMATICSCACHE_THREAD
+  std::lock_guard<std::mutex> lock(fRegistry->fMutex);
+#endif
+  return fRegistry->fCaches.size();
+}
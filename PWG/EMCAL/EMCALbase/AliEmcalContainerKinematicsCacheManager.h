@@ -0,0 +1,48 @@
+#ifndef ALIEMCALCONTAINERKINEMATICSCACHEMANAGER_H
+#define ALIEMCALCONTAINERKINEMATICSCACHEMANAGER_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TNamed.h>
+
+struct AliEmcalContainerKinematicsCache;
+struct AliEmcalContainerKinematicsCacheKey;
+struct AliEmcalContainerKinematicsCacheRegistry;
+
+/**
+ * @class AliEmcalContainerKinematicsCacheManager
+ * @ingroup EMCALCOREFW
+ * @brief Owner of the kinematics caches shared between EMCAL containers
+ *
+ * Containers connected to the same manager (AliEmcalContainer::SetKinematicsCacheManager)
+ * and having identical configuration use a single AliEmcalContainerKinematicsCache, which is
+ * filled once per event by the first container accessing it. The manager owns the caches
+ * and deletes them in its destructor, it has to outlive the containers. It is created in the steering macro and given to the
+ * containers of all tasks which should share their caches:
+ *
+ * ~~~{.cxx}
+ * AliEmcalContainerKinematicsCacheManager *cacheManager = new AliEmcalContainerKinematicsCacheManager("kinematicsCaches");
+ * trackCont1->SetKinematicsCacheManager(cacheManager);
+ * trackCont2->SetKinematicsCacheManager(cacheManager);
+ * ~~~
+ */
+class AliEmcalContainerKinematicsCacheManager : public TNamed {
+ public:
+  AliEmcalContainerKinematicsCacheManager();
+  AliEmcalContainerKinematicsCacheManager(const char *name);
+  virtual ~AliEmcalContainerKinematicsCacheManager();
+
+  AliEmcalContainerKinematicsCache *GetCache(const AliEmcalContainerKinematicsCacheKey &key);
+  Int_t                       GetNCaches() const;
+
+ private:
+  AliEmcalContainerKinematicsCacheRegistry *fRegistry; //!<! Caches by configuration
+
+  AliEmcalContainerKinematicsCacheManager(const AliEmcalContainerKinematicsCacheManager&);            // not implemented
+  AliEmcalContainerKinematicsCacheManager& operator=(const AliEmcalContainerKinematicsCacheManager&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalContainerKinematicsCacheManager, 1);
+  /// \endcond
+};
+#endif
@@ -12,6 +12,7 @@
 
 #include "AliTLorentzVector.h"
 #include "AliMCParticleContainer.h"
+#include "AliEmcalContainerKinematicsCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliMCParticleContainer);
@@ -155,6 +156,9 @@ AliAODMCParticle* AliMCParticleContainer::GetNextMCParticle()
 Bool_t AliMCParticleContainer::AcceptMCParticle(const AliAODMCParticle *vp, UInt_t &rejectionReason) const
 {
   // Return true if vp is accepted.
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(vp, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyMCParticleCuts(vp, rejectionReason);
   if (!r) return kFALSE;
 
@@ -176,6 +180,8 @@ Bool_t AliMCParticleContainer::AcceptMCParticle(const AliAODMCParticle *vp, UInt
 Bool_t AliMCParticleContainer::AcceptMCParticle(Int_t i, UInt_t &rejectionReason) const
 {
   // Return true if vp is accepted.
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(i, rejectionReason, accepted)) return accepted;
 
   Bool_t r = ApplyMCParticleCuts(GetMCParticle(i), rejectionReason);
   if (!r) return kFALSE;
@@ -243,6 +249,19 @@ const AliMCParticleIterableMomentumContainer AliMCParticleContainer::accepted_mo
   return AliMCParticleIterableMomentumContainer(this, true);
 }
 
+/**
+ * Extend the configuration key of the kinematics cache with the
+ * MC flag selection.
+ * @param[out] key Configuration key
+ * @return False if the configuration cannot be compared exactly
+ */
+Bool_t AliMCParticleContainer::GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const
+{
+  if (!AliParticleContainer::GetKinematicsCacheKey(key)) return kFALSE;
+  key.Add(fMCFlag);
+  return kTRUE;
+}
+
 /**
  * Build title of the container consisting of the container name
  * and a string encoding the minimum \f$ p_{t} \f$ cut applied
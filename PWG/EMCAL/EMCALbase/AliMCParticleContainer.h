@@ -61,6 +61,7 @@ class AliMCParticleContainer : public AliParticleContainer {
 #endif
 
  protected:
+  virtual Bool_t              GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const;
   virtual TString             GetDefaultArrayName(const AliVEvent * const ev) const { return "mcparticles"; }
 
   UInt_t                      fMCFlag;                        ///< select MC particles with flags
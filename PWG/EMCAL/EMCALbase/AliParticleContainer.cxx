@@ -22,6 +22,7 @@
 
 #include "AliTLorentzVector.h"
 #include "AliParticleContainer.h"
+#include "AliEmcalContainerKinematicsCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliParticleContainer);
@@ -207,6 +208,8 @@ Bool_t AliParticleContainer::GetMomentumFromParticle(TLorentzVector &mom, const
 Bool_t AliParticleContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
 {
   if (i == -1) i = fCurrentID;
+  Bool_t status = kFALSE;
+  if (GetCachedMomentum(mom, i, status)) return status;
   AliVParticle *vp = GetParticle(i);
   return GetMomentumFromParticle(mom, vp);
 }
@@ -270,12 +273,16 @@ Bool_t AliParticleContainer::GetNextAcceptMomentum(TLorentzVector &mom)
  */
 Bool_t AliParticleContainer::AcceptParticle(const AliVParticle *vp, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(vp, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyParticleCuts(vp, rejectionReason);
   if (!r) return kFALSE;
 
   AliTLorentzVector mom;
 
-  Int_t id = fClArray->IndexOf(vp);
+  // with the kinematics cache enabled, particles not found in its index map are not in the array
+  Int_t id = GetKinematicsCache() ? -1 : fClArray->IndexOf(vp);
   bool status(true);
   if (id >= 0) {
     status = GetMomentum(mom, id);
@@ -300,6 +307,9 @@ Bool_t AliParticleContainer::AcceptParticle(const AliVParticle *vp, UInt_t &reje
  */
 Bool_t AliParticleContainer::AcceptParticle(Int_t i, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(i, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyParticleCuts(GetParticle(i), rejectionReason);
   if (!r) return kFALSE;
 
@@ -438,6 +448,21 @@ const char* AliParticleContainer::GetTitle() const
   return trackString.Data();
 }
 
+/**
+ * Extend the configuration key of the kinematics cache with the
+ * particle selection criteria.
+ * @param[out] key Configuration key
+ * @return False if the configuration cannot be compared exactly
+ */
+Bool_t AliParticleContainer::GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const
+{
+  if (!AliEmcalContainer::GetKinematicsCacheKey(key)) return kFALSE;
+  key.Add(fMinDistanceTPCSectorEdge);
+  key.Add(fChargeCut);
+  key.Add(fGeneratorIndex);
+  return kTRUE;
+}
+
 /**
  * Connect the container to the array with content stored inside the virtual event.
  * The object name in the event must match the name given in the constructor.
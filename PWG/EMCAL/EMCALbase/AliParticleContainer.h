@@ -92,6 +92,8 @@ class AliParticleContainer : public AliEmcalContainer {
 
  protected:
 
+  virtual Bool_t              GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const;
+
 #if !(defined(__CINT__) || defined(__MAKECINT__))
   static AliEmcalContainerIndexMap <TClonesArray, AliVParticle> fgEmcalContainerIndexMap; //!<! Mapping from containers to indices
 #endif
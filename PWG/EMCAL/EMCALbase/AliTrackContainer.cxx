@@ -42,6 +42,7 @@
 #include "AliEmcalTrackSelResultCombined.h"
 #include "AliEmcalTrackSelResultHybrid.h"
 #include "AliTrackContainer.h"
+#include "AliEmcalContainerKinematicsCache.h"
 
 /// \cond CLASSIMP
 ClassImp(AliTrackContainer);
@@ -396,6 +397,8 @@ Bool_t AliTrackContainer::GetMomentum(TLorentzVector &mom, Int_t i) const
   Double_t mass = fMassHypothesis;
 
   if (i == -1) i = fCurrentID;
+  Bool_t status = kFALSE;
+  if (GetCachedMomentum(mom, i, status)) return status;
   AliVTrack *vp = GetTrack(i);
   if (vp) {
     if (mass < 0) mass = vp->M();
@@ -536,6 +539,9 @@ Bool_t AliTrackContainer::GetNextAcceptMomentum(TLorentzVector &mom)
  */
 Bool_t AliTrackContainer::AcceptTrack(const AliVTrack *vp, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(vp, rejectionReason, accepted)) return accepted;
+
   Bool_t r = ApplyTrackCuts(vp, rejectionReason);
   if (!r) return kFALSE;
 
@@ -558,6 +564,9 @@ Bool_t AliTrackContainer::AcceptTrack(const AliVTrack *vp, UInt_t &rejectionReas
  */
 Bool_t AliTrackContainer::AcceptTrack(Int_t i, UInt_t &rejectionReason) const
 {
+  Bool_t accepted = kFALSE;
+  if (GetCachedAcceptance(i, rejectionReason, accepted)) return accepted;
+
   if(fTrackTypes[i] == kRejected) return false; // track was rejected by the track selection
   Bool_t r = ApplyTrackCuts(GetTrack(i), rejectionReason);
   if (!r) return kFALSE;
@@ -727,6 +736,25 @@ const char* AliTrackContainer::GetTitle() const
   return trackString.Data();
 }
 
+/**
+ * Extend the configuration key of the kinematics cache with the
+ * track selection settings. Containers with additional track cuts
+ * (AddTrackCuts) cannot be compared and keep a private cache.
+ * @param[out] key Configuration key
+ * @return False if the configuration cannot be compared exactly
+ */
+Bool_t AliTrackContainer::GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const
+{
+  if (fListOfCuts && fListOfCuts->GetEntries() > 0) return kFALSE;
+  if (!AliParticleContainer::GetKinematicsCacheKey(key)) return kFALSE;
+  key.Add(fTrackFilterType);
+  key.Add(fAODFilterBits);
+  key.Add(fSelectionModeAny);
+  key.Add(fITSHybridTrackDistinction);
+  key.Add(fTrackCutsPeriod.Data());
+  return kTRUE;
+}
+
 TString AliTrackContainer::GetDefaultArrayName(const AliVEvent *const ev) const {
   if(ev->IsA() == AliAODEvent::Class()) return "tracks";
   else if(ev->IsA() == AliESDEvent::Class()) return "Tracks";
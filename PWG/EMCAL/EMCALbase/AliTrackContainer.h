@@ -183,6 +183,7 @@ class AliTrackContainer : public AliParticleContainer {
 #endif
 
  protected:
+  virtual Bool_t              GetKinematicsCacheKey(AliEmcalContainerKinematicsCacheKey &key) const;
   /**
    * Create default array name for the track container. The
    * default array name will be
@@ -12,6 +12,7 @@
 #pragma link C++ class AliEmcalEmbeddingQA+;
 #pragma link C++ class AliClusterContainer+;
 #pragma link C++ class AliEmcalContainer+;
+#pragma link C++ class AliEmcalContainerKinematicsCacheManager+;
 #pragma link C++ class AliEmcalContainerUtils+;
 #pragma link C++ class AliEmcalParticle+;
 #pragma link C++ class AliEmcalPhysicsSelection+;
@@ -21,9 +21,16 @@
  *         (abilandzic@gmail.com)   *
  ************************************/ 
   
+#include <algorithm>
+#include "RVersion.h"
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIFLOWEVENTSIMPLEMAKERONTHEFLY_THREAD
+#include <thread>
+#endif
 #include "Riostream.h"
 #include "TMath.h"
 #include "TF1.h"
+#include "TH1D.h"
 #include "TH3.h"
 #include "TRandom3.h"
 #include "AliFlowEventSimpleMakerOnTheFly.h"
@@ -73,7 +80,17 @@ fPi(TMath::Pi()),
 fUniformEfficiency(kTRUE),
 fPtMin(0.5),
 fPtMax(1.0),
-fPtProbability(0.75) 
+fPtProbability(0.75),
+fSeed(uiSeed),
+fFastGenerator(kFALSE),
+fNThreads(1),
+fEventsPerBlock(1000),
+fPtTable(),
+fPtCDF(),
+fStreams(),
+fFastEvents(),
+fNextFastEvent(0),
+fReusableEvent(NULL) 
 {
  // Constructor.
   
@@ -91,6 +108,8 @@ AliFlowEventSimpleMakerOnTheFly::~AliFlowEventSimpleMakerOnTheFly()
 
  if(fPtSpectra){delete fPtSpectra;}
  if(fPhiDistribution){delete fPhiDistribution;}
+ for(UInt_t s=0;s<fStreams.size();s++){delete fStreams[s];}
+ if(fReusableEvent){delete fReusableEvent;}
 
 } // end of AliFlowEventSimpleMakerOnTheFly::~AliFlowEventSimpleMakerOnTheFly()	
 
@@ -101,7 +120,8 @@ void AliFlowEventSimpleMakerOnTheFly::Init()
  // Book all objects in this method.
  
  // a) Define the pt spectra;
- // b) Define the phi distribution.
+ // b) Define the phi distribution;
+ // c) Prepare the fast generator.
 
  // a) Define the pt spectra:
  Double_t dPtMin = 0.; 
@@ -132,6 +152,9 @@ void AliFlowEventSimpleMakerOnTheFly::Init()
  fPhiDistribution->SetParName(6,"Hexagonal Flow (v6)");
  fPhiDistribution->SetParameter(6,fV6);
 
+ // c) Prepare the fast generator:
+ if(fFastGenerator){this->InitFastGenerator();}
+
 } // end of void AliFlowEventSimpleMakerOnTheFly::Init()
 
 //====================================================================================================================
@@ -177,6 +200,16 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
 {
  // Method to create event 'on the fly'.
  
+ // With the fast generator the event is filled from the block of pre-generated events
+ // (the track array is booked for the accepted particles only, not for fNTimes*fMaxMult):
+ if(fFastGenerator)
+ {
+  const FastEvent &event = this->NextFastEvent();
+  AliFlowEventSimple *pFastEvent = new AliFlowEventSimple(TMath::Max(1,fNTimes*(Int_t)event.fPt.size())); 
+  this->FillEventOnTheFly(pFastEvent,event,cutsRP,cutsPOI);
+  return pFastEvent;
+ }
+ 
  // a) Determine the multiplicity of an event;
  // b) Determine the reaction plane of an event;
  // c) If v2 fluctuates uniformly event-by-event, sample its value from [fMinV2,fMaxV2];
@@ -256,7 +289,20 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
  pEvent->SetNumberOfPOIs(fNTimes*nPOIs);
  
  // e) Cosmetics for the printout on the screen:
+ this->PrintEventInfo(dReactionPlane,iMult,nRPs,nPOIs);
+
+ return pEvent;
+    
+} // end of CreateEventOnTheFly()
+ 
+//====================================================================================================================
+
+void AliFlowEventSimpleMakerOnTheFly::PrintEventInfo(Double_t dReactionPlane, Int_t iMult, Int_t nRPs, Int_t nPOIs)
+{
+ // Cosmetics for the printout on the screen.
+
  Int_t cycle = (fPtDependentV2 ? 10 : 100);
+ if(fFastGenerator){cycle *= 100;}
  if((++fCount % cycle) == 0) 
  {
   if(TMath::Abs(dReactionPlane)>1.e-44) 
@@ -272,9 +318,313 @@ AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::CreateEventOnTheFly(AliFlow
   cout <<"  .... "<<fCount<< " events processed ...."<<endl;
  } // end of if((++fCount % cycle) == 0) 
 
- return pEvent;
-    
-} // end of CreateEventOnTheFly()
+} // end of void AliFlowEventSimpleMakerOnTheFly::PrintEventInfo(Double_t dReactionPlane, Int_t iMult, Int_t nRPs, Int_t nPOIs)
+
+//====================================================================================================================
+
+AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::GetEventOnTheFly(AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI)
+{
+ // Fill the event owned by this class 'on the fly' with the fast generator, and return it.
+ // The event and its tracks are reused in the next call, so the caller must not delete it.
+ 
+ if(!fFastGenerator)
+ {
+  cout<<" WARNING (AliFlowEventSimpleMakerOnTheFly::GetEventOnTheFly): fast generator is not enabled, use CreateEventOnTheFly. "<<endl;
+  return NULL;
+ }
+ if(fPtCDF.empty()){this->InitFastGenerator();}
+ this->FillEventOnTheFly(fReusableEvent,this->NextFastEvent(),cutsRP,cutsPOI);
+
+ return fReusableEvent;
+
+} // end of AliFlowEventSimple* AliFlowEventSimpleMakerOnTheFly::GetEventOnTheFly(AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI)
+
+//====================================================================================================================
+
+void AliFlowEventSimpleMakerOnTheFly::InitFastGenerator()
+{
+ // Prepare the fast generator.
+ 
+ // a) Tabulate the inverse CDF of the pt spectra;
+ // b) Create independent random streams, one per thread;
+ // c) Book the event returned by GetEventOnTheFly.
+
+ // a) Tabulate the inverse CDF of the pt spectra (same Boltzmann distribution as in fPtSpectra, on the same range):
+ const Int_t nPtBins = 10000;
+ Double_t dPtMin = 0.; 
+ Double_t dPtMax = 10.; 
+ fPtTable.resize(nPtBins+1);
+ fPtCDF.resize(nPtBins+1);
+ Double_t dPrevious = 0.;
+ for(Int_t b=0;b<=nPtBins;b++)
+ {
+  Double_t dPt = dPtMin + (dPtMax-dPtMin)*b/nPtBins;
+  Double_t dValue = dPt*TMath::Exp(-pow(fMass*fMass+dPt*dPt,0.5)/fTemperature);
+  fPtTable[b] = dPt;
+  fPtCDF[b] = (b == 0 ? 0. : fPtCDF[b-1] + 0.5*(dValue+dPrevious)*(dPtMax-dPtMin)/nPtBins); // trapezoidal rule
+  dPrevious = dValue;
+ }
+ for(Int_t b=0;b<=nPtBins;b++){fPtCDF[b] /= fPtCDF[nPtBins];}
+
+ // b) Create independent random streams, one per thread:
+ //    (seeds are drawn from gRandom, which is seeded with fSeed in the constructor)
+ if(fNThreads < 1){fNThreads = 1;}
+ if(fEventsPerBlock < fNThreads){fEventsPerBlock = fNThreads;}
+ for(UInt_t s=0;s<fStreams.size();s++){delete fStreams[s];}
+ fStreams.resize(fNThreads);
+ for(Int_t s=0;s<fNThreads;s++)
+ {
+  fStreams[s] = new TRandom3(fSeed == 0 ? 0 : 1+gRandom->Integer(kMaxInt));
+ }
+ fFastEvents.resize(fEventsPerBlock);
+ fNextFastEvent = fEventsPerBlock; // first block is generated at the first request
+
+ // c) Book the event returned by GetEventOnTheFly, once for all events:
+ if(!fReusableEvent){fReusableEvent = new AliFlowEventSimple(fNTimes*fMaxMult);} 
+
+} // end of void AliFlowEventSimpleMakerOnTheFly::InitFastGenerator()
+
+//====================================================================================================================
+
+Double_t AliFlowEventSimpleMakerOnTheFly::SamplePt(TRandom3 *pRandom) const
+{
+ // Sample pt from the tabulated inverse CDF of the pt spectra, with linear interpolation inside the bin.
+
+ Double_t u = pRandom->Rndm();
+ Int_t b = std::upper_bound(fPtCDF.begin(),fPtCDF.end(),u) - fPtCDF.begin();
+ if(b >= (Int_t)fPtCDF.size()){return fPtTable.back();}
+ if(b < 1){b = 1;}
+ Double_t dWidth = fPtCDF[b]-fPtCDF[b-1];
+ Double_t dFraction = (dWidth > 0. ? (u-fPtCDF[b-1])/dWidth : 0.);
+
+ return fPtTable[b-1] + dFraction*(fPtTable[b]-fPtTable[b-1]);
+
+} // end of Double_t AliFlowEventSimpleMakerOnTheFly::SamplePt(TRandom3 *pRandom) const
+
+//====================================================================================================================
+
+Double_t AliFlowEventSimpleMakerOnTheFly::SamplePhi(TRandom3 *pRandom, Double_t dReactionPlane, Double_t dV2) const
+{
+ // Sample phi from the same Fourier-like distribution as fPhiDistribution, 
+ // by accept-reject against the constant envelope 1+2*(|v1|+...+|v6|).
+
+ Double_t v[7] = {0.,fV1,dV2,fV3,fV4,fV5,fV6};
+ Double_t dEnvelope = 1.;
+ for(Int_t n=1;n<=6;n++){dEnvelope += 2.*TMath::Abs(v[n]);}
+ Double_t dTwoPi = TMath::TwoPi();
+ for(Int_t t=0;t<1000000;t++)
+ {
+  Double_t dPhi = dTwoPi*pRandom->Rndm();
+  Double_t dValue = 1.;
+  for(Int_t n=1;n<=6;n++)
+  {
+   if(v[n] != 0.){dValue += 2.*v[n]*TMath::Cos(n*(dPhi-dReactionPlane));}
+  }
+  if(dEnvelope*pRandom->Rndm() < dValue){return dPhi;}
+ }
+ 
+ return dTwoPi*pRandom->Rndm(); // only reached for a distribution which is nowhere positive
+
+} // end of Double_t AliFlowEventSimpleMakerOnTheFly::SamplePhi(TRandom3 *pRandom, Double_t dReactionPlane, Double_t dV2) const
+
+//====================================================================================================================
+
+Bool_t AliFlowEventSimpleMakerOnTheFly::ValidateFastGenerator(Int_t nSamples, Double_t dMinProbability)
+{
+ // Compare the pt and phi distributions sampled by the fast generator with the ones 
+ // sampled from fPtSpectra and fPhiDistribution with TF1::GetRandom, as in CreateEventOnTheFly.
+ // The distributions are compared with a chi2 test, returns kTRUE if both probabilities are above dMinProbability.
+ // Call after Init(); the random streams of the fast generator are not used, so that the generated events are unchanged.
+
+ // a) Sample pt and phi with both methods;
+ // b) Compare the distributions.
+
+ if(!fPtSpectra || !fPhiDistribution)
+ {
+  cout<<" WARNING (AliFlowEventSimpleMakerOnTheFly::ValidateFastGenerator): call Init() first. "<<endl;
+  return kFALSE;
+ }
+ if(fPtCDF.empty()){this->InitFastGenerator();}
+
+ // a) Sample pt and phi with both methods (phi for the reaction plane at 0 and the fixed v2):
+ TRandom3 random(fSeed == 0 ? 0 : fSeed+1);
+ Double_t dReactionPlane = fPhiDistribution->GetParameter(0);
+ Double_t dV2 = fPhiDistribution->GetParameter(2);
+ fPhiDistribution->SetParameter(0,0.);
+ fPhiDistribution->SetParameter(2,fV2);
+ TH1D hPtTF1("hPtTF1","p_{t} from TF1::GetRandom",100,0.,10.);
+ TH1D hPtFast("hPtFast","p_{t} from the fast generator",100,0.,10.);
+ TH1D hPhiTF1("hPhiTF1","#phi from TF1::GetRandom",100,0.,TMath::TwoPi());
+ TH1D hPhiFast("hPhiFast","#phi from the fast generator",100,0.,TMath::TwoPi());
+ hPtTF1.SetDirectory(0);
+ hPtFast.SetDirectory(0);
+ hPhiTF1.SetDirectory(0);
+ hPhiFast.SetDirectory(0);
+ for(Int_t s=0;s<nSamples;s++)
+ {
+  hPtTF1.Fill(fPtSpectra->GetRandom());
+  hPtFast.Fill(this->SamplePt(&random));
+  hPhiTF1.Fill(fPhiDistribution->GetRandom());
+  hPhiFast.Fill(this->SamplePhi(&random,0.,fV2));
+ }
+ fPhiDistribution->SetParameter(0,dReactionPlane);
+ fPhiDistribution->SetParameter(2,dV2);
+
+ // b) Compare the distributions:
+ Double_t dProbabilityPt = hPtTF1.Chi2Test(&hPtFast,"UU");
+ Double_t dProbabilityPhi = hPhiTF1.Chi2Test(&hPhiFast,"UU");
+ cout<<" Fast generator vs TF1 sampling ("<<nSamples<<" samples):"<<endl;
+ cout<<"  pt:  <pt> = "<<hPtFast.GetMean()<<" vs "<<hPtTF1.GetMean()<<", chi2 probability = "<<dProbabilityPt<<endl;
+ cout<<"  phi: <phi> = "<<hPhiFast.GetMean()<<" vs "<<hPhiTF1.GetMean()<<", chi2 probability = "<<dProbabilityPhi<<endl;
+ 
+ return (dProbabilityPt > dMinProbability && dProbabilityPhi > dMinProbability);
+
+} // end of Bool_t AliFlowEventSimpleMakerOnTheFly::ValidateFastGenerator(Int_t nSamples, Double_t dMinProbability)
+
+//====================================================================================================================
+
+void AliFlowEventSimpleMakerOnTheFly::GenerateFastEvents(Int_t iStream, Int_t iFirst, Int_t iLast)
+{
+ // Generate events [iFirst,iLast[ of the block with random stream iStream.
+ // Only plain numbers are produced here, so that different streams can run concurrently.
+
+ TRandom3 *pRandom = fStreams[iStream];
+ for(Int_t e=iFirst;e<iLast;e++)
+ {
+  FastEvent &event = fFastEvents[e];
+  // a) Determine the multiplicity of an event:
+  event.fMult = (Int_t)pRandom->Uniform(fMinMult,fMaxMult);
+  // b) Determine the reaction plane of an event:
+  event.fReactionPlane = pRandom->Uniform(0.,TMath::TwoPi());
+  // c) If v2 fluctuates uniformly event-by-event, sample its value from [fMinV2,fMaxV2]:
+  Double_t dV2 = (fUniformFluctuationsV2 ? pRandom->Uniform(fMinV2,fMaxV2) : fV2);
+  // d) Sample particles:
+  event.fPt.clear();
+  event.fPhi.clear();
+  event.fEta.clear();
+  event.fCharge.clear();
+  for(Int_t p=0;p<event.fMult;p++)
+  {
+   Double_t dPt = this->SamplePt(pRandom);
+   if(fPtDependentV2 && !fUniformFluctuationsV2)
+   {
+    // v2(pt): for pt < fV2vsPtCutOff v2 increases linearly, for pt >= fV2vsPtCutOff v2 = fV2vsPtMax
+    dV2 = (dPt < fV2vsPtCutOff ? dPt*fV2vsPtMax/fV2vsPtCutOff : fV2vsPtMax);
+   } 
+   Double_t dPhi = this->SamplePhi(pRandom,event.fReactionPlane,dV2);
+   Double_t dEta = pRandom->Uniform(-1.,1.);
+   Int_t iCharge = (pRandom->Integer(2)>0.5 ? 1 : -1);
+   // Check uniform acceptance (as in AcceptPhi):
+   if(!fUniformAcceptance)
+   {
+    if((dPhi >= fPhiMin1*fPi/180.) && (dPhi < fPhiMax1*fPi/180.) && pRandom->Uniform(0,1) > fProbability1){continue;}
+    else if((dPhi >= fPhiMin2*fPi/180.) && (dPhi < fPhiMax2*fPi/180.) && pRandom->Uniform(0,1) > fProbability2){continue;}
+   }
+   // Check pT efficiency (as in AcceptPt):
+   if(!fUniformEfficiency && (dPt >= fPtMin) && (dPt < fPtMax) && pRandom->Uniform(0,1) > fPtProbability){continue;}
+   event.fPt.push_back(dPt);
+   event.fPhi.push_back(dPhi);
+   event.fEta.push_back(dEta);
+   event.fCharge.push_back(iCharge);
+  } // end of for(Int_t p=0;p<event.fMult;p++)
+ } // end of for(Int_t e=iFirst;e<iLast;e++)
+
+} // end of void AliFlowEventSimpleMakerOnTheFly::GenerateFastEvents(Int_t iStream, Int_t iFirst, Int_t iLast)
+
+//====================================================================================================================
+
+const AliFlowEventSimpleMakerOnTheFly::FastEvent& AliFlowEventSimpleMakerOnTheFly::NextFastEvent()
+{
+ // Take the next pre-generated event of the fast generator, generating
+ // the next block of events (in parallel, one random stream per thread) if needed.
+
+ if(fPtCDF.empty()){this->InitFastGenerator();}
+ if(fNextFastEvent >= fEventsPerBlock)
+ {
+  Int_t nThreads = fNThreads;
+  Int_t nPerThread = (fEventsPerBlock+nThreads-1)/nThreads;
+#ifdef ALIFLOWEVENTSIMPLEMAKERONTHEFLY_THREAD
+  std::vector<std::thread> threads;
+  for(Int_t t=1;t<nThreads;t++)
+  {
+   threads.push_back(std::thread(&AliFlowEventSimpleMakerOnTheFly::GenerateFastEvents,this,t,
+                                 TMath::Min(t*nPerThread,fEventsPerBlock),TMath::Min((t+1)*nPerThread,fEventsPerBlock)));
+  }
+  this->GenerateFastEvents(0,0,TMath::Min(nPerThread,fEventsPerBlock));
+  for(UInt_t t=0;t<threads.size();t++){threads[t].join();}
+#else
+  for(Int_t t=0;t<nThreads;t++)
+  {
+   this->GenerateFastEvents(t,TMath::Min(t*nPerThread,fEventsPerBlock),TMath::Min((t+1)*nPerThread,fEventsPerBlock));
+  }
+#endif
+  fNextFastEvent = 0;
+ } // end of if(fNextFastEvent >= fEventsPerBlock)
+
+ return fFastEvents[fNextFastEvent++];
+
+} // end of const AliFlowEventSimpleMakerOnTheFly::FastEvent& AliFlowEventSimpleMakerOnTheFly::NextFastEvent()
+
+//====================================================================================================================
+
+void AliFlowEventSimpleMakerOnTheFly::FillEventOnTheFly(AliFlowEventSimple *pEvent, const FastEvent &event, AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI)
+{
+ // Fill the event with a pre-generated event of the fast generator.
  
+ // a) Fill the event, reusing the tracks already allocated in it;
+ // b) Cosmetics for the printout on the screen.
+
+ // a) Fill the event:
+ pEvent->ClearFast();
+ pEvent->SetReferenceMultiplicity(event.fMult);
+ pEvent->SetMCReactionPlaneAngle(event.fReactionPlane); 
+ Int_t nRPs = 0; // number of particles tagged RP in this event
+ Int_t nPOIs = 0; // number of particles tagged POI in this event
+ for(UInt_t p=0;p<event.fPt.size();p++)
+ {
+  AliFlowTrackSimple *pTrack = pEvent->MakeNewTrack();
+  pTrack->Clear();
+  pTrack->SetPt(event.fPt[p]); 
+  pTrack->SetPhi(event.fPhi[p]);
+  pTrack->SetEta(event.fEta[p]);
+  pTrack->SetCharge(event.fCharge[p]);
+  // Checking the RP cuts:  	 
+  if(cutsRP->PassesCuts(pTrack))
+  {
+   pTrack->TagRP(kTRUE); 
+   nRPs++; 
+  }
+  // Checking the POI cuts:  	 
+  if(cutsPOI->PassesCuts(pTrack))
+  {
+   pTrack->TagPOI(kTRUE); 
+   nPOIs++;
+  }
+  // Assign particles to eta subevents (needed only for Scalar Product method):
+  if(pTrack->Eta()>=fEtaMinA && pTrack->Eta()<fEtaMaxA) 
+  {
+   pTrack->SetForSubevent(0);
+  }
+  if(pTrack->Eta()>=fEtaMinB && pTrack->Eta()<fEtaMaxB) 
+  {
+   pTrack->SetForSubevent(1);
+  }  
+  pEvent->AddTrack(pTrack);
+  // Simulating nonflow:
+  for(Int_t nt=1;nt<fNTimes;nt++)
+  {
+   AliFlowTrackSimple *pCopy = pEvent->MakeNewTrack();
+   *pCopy = *pTrack;
+   pEvent->AddTrack(pCopy);  
+  } 
+ } // end of for(UInt_t p=0;p<event.fPt.size();p++)
+ pEvent->SetNumberOfRPs(fNTimes*nRPs);
+ pEvent->SetNumberOfPOIs(fNTimes*nPOIs);
+
+ // b) Cosmetics for the printout on the screen:
+ this->PrintEventInfo(event.fReactionPlane,event.fMult,nRPs,nPOIs);
+
+} // end of void AliFlowEventSimpleMakerOnTheFly::FillEventOnTheFly(AliFlowEventSimple *pEvent, const FastEvent &event, AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI)
+
 //====================================================================================================================
 
@@ -15,6 +15,8 @@
 #ifndef ALIFLOWEVENTSIMPLEMAKERONTHEFLY_H
 #define ALIFLOWEVENTSIMPLEMAKERONTHEFLY_H
 
+#include <vector>
+
 class TF1;
 class TRandom3;
 class TH3F;
@@ -31,6 +33,8 @@ class AliFlowEventSimpleMakerOnTheFly{
   Bool_t AcceptPhi(AliFlowTrackSimple *pTrack);  
   Bool_t AcceptPt(AliFlowTrackSimple *pTrack);  
   AliFlowEventSimple* CreateEventOnTheFly(AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI); 
+  AliFlowEventSimple* GetEventOnTheFly(AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI); // fast generator only, event is owned and reused by the maker
+  Bool_t ValidateFastGenerator(Int_t nSamples = 1000000, Double_t dMinProbability = 1.e-3); // compare pt and phi of the fast generator with the TF1 sampling
   // Setters and getters:
   void SetMinMult(Int_t iMinMult) {this->fMinMult = iMinMult;}
   Int_t GetMinMult() const {return this->fMinMult;} 
@@ -90,10 +94,33 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t GetPtMax() const {return this->fPtMax;} 
   void SetPtProbability(Double_t ptp) {this->fPtProbability = ptp;}
   Double_t GetPtProbability() const {return this->fPtProbability;} 
+  void SetFastGenerator(Bool_t fg) {this->fFastGenerator = fg;}
+  Bool_t GetFastGenerator() const {return this->fFastGenerator;} 
+  void SetNThreads(Int_t nth) {this->fNThreads = nth;}
+  Int_t GetNThreads() const {return this->fNThreads;} 
+  void SetEventsPerBlock(Int_t epb) {this->fEventsPerBlock = epb;}
+  Int_t GetEventsPerBlock() const {return this->fEventsPerBlock;} 
 
  private:
   AliFlowEventSimpleMakerOnTheFly(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // copy constructor
   AliFlowEventSimpleMakerOnTheFly& operator=(const AliFlowEventSimpleMakerOnTheFly& anAnalysis); // assignment operator
+  // Fast generator:
+  struct FastEvent // kinematics of one event generated by the fast generator
+  {
+   Int_t fMult; // sampled multiplicity
+   Double_t fReactionPlane; // sampled reaction plane
+   std::vector<Double_t> fPt; // pt of the accepted particles
+   std::vector<Double_t> fPhi; // phi of the accepted particles
+   std::vector<Double_t> fEta; // eta of the accepted particles
+   std::vector<Int_t> fCharge; // charge of the accepted particles
+  };
+  void InitFastGenerator(); 
+  void GenerateFastEvents(Int_t iStream, Int_t iFirst, Int_t iLast); 
+  Double_t SamplePt(TRandom3 *pRandom) const; 
+  Double_t SamplePhi(TRandom3 *pRandom, Double_t dReactionPlane, Double_t dV2) const; 
+  const FastEvent& NextFastEvent(); 
+  void FillEventOnTheFly(AliFlowEventSimple *pEvent, const FastEvent &event, AliFlowTrackSimpleCuts const *cutsRP, AliFlowTrackSimpleCuts const *cutsPOI); 
+  void PrintEventInfo(Double_t dReactionPlane, Int_t iMult, Int_t nRPs, Int_t nPOIs); 
   Int_t fCount; // count number of events 
   Int_t fMinMult; // uniformly sampled multiplicity is >= iMinMult
   Int_t fMaxMult; // uniformly sampled multiplicity is < iMaxMult
@@ -130,8 +157,18 @@ class AliFlowEventSimpleMakerOnTheFly{
   Double_t fPtMin; // non-uniform efficiency vs pT starts at pT = fPtMin
   Double_t fPtMax; // non-uniform efficiency vs pT ends at pT = fPtMax
   Double_t fPtProbability; // particles emitted in fPtMin <= pT < fPtMax are taken with probability fPtProbability 
+  UInt_t fSeed; // seed passed to the constructor
+  Bool_t fFastGenerator; // sample pt from a tabulated inverse CDF and phi by accept-reject, instead of TF1::GetRandom
+  Int_t fNThreads; // number of threads used by the fast generator
+  Int_t fEventsPerBlock; // number of events generated in one go by the fast generator
+  std::vector<Double_t> fPtTable; //! pt grid of the tabulated pt spectra
+  std::vector<Double_t> fPtCDF; //! cumulative distribution of the tabulated pt spectra
+  std::vector<TRandom3*> fStreams; //! independent random streams of the fast generator, one per thread
+  std::vector<FastEvent> fFastEvents; //! block of events generated by the fast generator
+  Int_t fNextFastEvent; //! next event to be taken from the block
+  AliFlowEventSimple *fReusableEvent; //! event returned by GetEventOnTheFly
 
-  ClassDef(AliFlowEventSimpleMakerOnTheFly,1) // macro for rootcint
+  ClassDef(AliFlowEventSimpleMakerOnTheFly,2) // macro for rootcint
 };
  
 #endif
@@ -2,6 +2,7 @@
 #define AliEventClassifierSpherocity_cxx
 
 #include "AliEventClassifierBase.h"
+#include "AliEventShapeCalculator.h"
 
 class AliEventClassifierSpherocity : public AliEventClassifierBase {
  public:
@@ -14,8 +15,10 @@ class AliEventClassifierSpherocity : public AliEventClassifierBase {
  private:
   Bool_t TrackPassesSelection(AliMCParticle* track, AliStack *stack, Int_t iTrack);
   void CalculateClassifierValue(AliMCEvent *event, AliStack *stack);
-  
-  ClassDef(AliEventClassifierSpherocity, 1);
+
+  AliEventShapeCalculator fShape;  //! selected tracks of the current event
+
+  ClassDef(AliEventClassifierSpherocity, 2);
 };
 
 #endif
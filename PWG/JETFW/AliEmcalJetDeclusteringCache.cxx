@@ -0,0 +1,282 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "AliEmcalJetDeclusteringCache.h"
+
+const Int_t AliEmcalJetDeclusteringCache::kNoNode;
+
+/**
+ * Constructor.
+ * @param[in] radius Radius of the Cambridge/Aachen reclustering
+ */
+AliEmcalJetDeclusteringCache::AliEmcalJetDeclusteringCache(Double_t radius) :
+  fRadius(radius),
+  fEvent(0),
+  fEntry(-1),
+  fNJets(-1),
+  fValid(kFALSE),
+  fSplittings(),
+  fConstituentPt(),
+  fConstituentIndex(),
+  fJetRoot(),
+  fNodes(),
+  fNN(),
+  fNNDist()
+{
+}
+
+/**
+ * Start a new event: drop all declustered jets.
+ * @param[in] event Current event
+ * @param[in] entry Current entry of the analysis manager
+ * @param[in] njets Number of jets in the container
+ */
+void AliEmcalJetDeclusteringCache::Reset(const AliVEvent *event, Long64_t entry, Int_t njets)
+{
+  fSplittings.clear();
+  fConstituentPt.clear();
+  fConstituentIndex.clear();
+  fJetRoot.clear();
+  fEvent = event;
+  fEntry = entry;
+  fNJets = njets;
+  fValid = kTRUE;
+}
+
+/**
+ * Root of the declustering tree of a jet.
+ * @param[in] jet Jet
+ * @return Node code of the root, kNoNode if the jet is not in the cache or has no constituents
+ */
+Int_t AliEmcalJetDeclusteringCache::GetRoot(const AliEmcalJet *jet) const
+{
+  std::unordered_map<const AliEmcalJet *, Int_t>::const_iterator it = fJetRoot.find(jet);
+  return it == fJetRoot.end() ? kNoNode : it->second;
+}
+
+/**
+ * Recluster the constituents of a jet and store its declustering tree.
+ * @param[in] jet Jet (used as key)
+ * @param[in] n Number of constituents
+ * @param[in] px,py,pz,e Four-momenta of the constituents
+ * @return Node code of the root, kNoNode if there are no constituents
+ */
+Int_t AliEmcalJetDeclusteringCache::AddJet(const AliEmcalJet *jet, Int_t n, const Double_t *px, const Double_t *py, const Double_t *pz, const Double_t *e)
+{
+  fNodes.resize(n);
+  for (Int_t i = 0; i < n; i++) {
+    Node &node = fNodes[i];
+    node.fPx = px[i];
+    node.fPy = py[i];
+    node.fPz = pz[i];
+    node.fE = e[i];
+    SetKinematics(node);
+    node.fCode = -Int_t(fConstituentPt.size()) - 1;
+    fConstituentPt.push_back(node.fPt);
+    fConstituentIndex.push_back(i);
+  }
+
+  Int_t root = n > 0 ? Cluster() : kNoNode;
+  fJetRoot[jet] = root;
+  return root;
+}
+
+/**
+ * Cambridge/Aachen clustering of the objects in fNodes with radius fRadius,
+ * keeping the nearest neighbour of each object (O(n^2) operations). Two objects
+ * are merged while their distance is smaller than the radius (\f$ \Delta R^{2}/R^{2} < 1 \f$,
+ * as in fastjet), the remaining objects are the inclusive jets.
+ * @return Node code of the hardest inclusive jet
+ */
+Int_t AliEmcalJetDeclusteringCache::Cluster()
+{
+  const Double_t R2 = fRadius * fRadius;
+  Int_t n = fNodes.size();
+  fNN.assign(n, -1);
+  fNNDist.assign(n, 1e300);
+  for (Int_t i = 0; i < n; i++) {
+    for (Int_t j = i + 1; j < n; j++) {
+      Double_t d = DeltaR2(fNodes[i], fNodes[j]);
+      if (d < fNNDist[i]) { fNNDist[i] = d; fNN[i] = j; }
+      if (d < fNNDist[j]) { fNNDist[j] = d; fNN[j] = i; }
+    }
+  }
+
+  while (n > 1) {
+    // closest pair
+    Int_t a = 0;
+    for (Int_t i = 1; i < n; i++) {
+      if (fNNDist[i] < fNNDist[a]) a = i;
+    }
+    if (!(fNNDist[a] < R2)) break;
+    Int_t b = fNN[a];
+    if (b < a) std::swap(a, b);
+
+    const Node &na = fNodes[a];
+    const Node &nb = fNodes[b];
+    const Node &hard = na.fPt >= nb.fPt ? na : nb;
+    const Node &soft = na.fPt >= nb.fPt ? nb : na;
+
+    Node merged;
+    merged.fPx = na.fPx + nb.fPx;
+    merged.fPy = na.fPy + nb.fPy;
+    merged.fPz = na.fPz + nb.fPz;
+    merged.fE = na.fE + nb.fE;
+    SetKinematics(merged);
+
+    Splitting s;
+    s.fTheta = TMath::Sqrt(fNNDist[a]);
+    s.fZ = hard.fPt + soft.fPt > 0 ? soft.fPt / (hard.fPt + soft.fPt) : 0;
+    s.fKt = soft.fPt * s.fTheta;
+    s.fPt = merged.fPt;
+    Double_t m2 = merged.fE * merged.fE - merged.fPx * merged.fPx - merged.fPy * merged.fPy - merged.fPz * merged.fPz;
+    s.fM = m2 > 0 ? TMath::Sqrt(m2) : 0;
+    s.fHarder = hard.fCode;
+    s.fSofter = soft.fCode;
+    merged.fCode = fSplittings.size();
+    fSplittings.push_back(s);
+
+    // the merged object takes the place of a, the last object the place of b
+    fNodes[a] = merged;
+    n--;
+    if (b != n) {
+      fNodes[b] = fNodes[n];
+      fNN[b] = fNN[n];
+      fNNDist[b] = fNNDist[n];
+      for (Int_t i = 0; i < n; i++) {
+        if (fNN[i] == n) fNN[i] = b;
+      }
+    }
+
+    // update the nearest neighbours
+    fNN[a] = -1;
+    fNNDist[a] = 1e300;
+    for (Int_t i = 0; i < n; i++) {
+      if (i == a) continue;
+      Double_t d = DeltaR2(fNodes[i], fNodes[a]);
+      if (d < fNNDist[a]) { fNNDist[a] = d; fNN[a] = i; }
+      if (fNN[i] == a || fNN[i] == b) {
+        // neighbour was merged: full search
+        fNN[i] = -1;
+        fNNDist[i] = 1e300;
+        for (Int_t j = 0; j < n; j++) {
+          if (j == i) continue;
+          Double_t dj = DeltaR2(fNodes[i], fNodes[j]);
+          if (dj < fNNDist[i]) { fNNDist[i] = dj; fNN[i] = j; }
+        }
+      }
+      else if (d < fNNDist[i]) {
+        fNNDist[i] = d;
+        fNN[i] = a;
+      }
+    }
+  }
+
+  Int_t hardest = 0;
+  for (Int_t i = 1; i < n; i++) {
+    if (fNodes[i].fPt > fNodes[hardest].fPt) hardest = i;
+  }
+  return fNodes[hardest].fCode;
+}
+
+/**
+ * Compute rapidity, azimuth and transverse momentum from the four-momentum
+ * (same conventions as fastjet::PseudoJet).
+ * @param[in,out] node Object
+ */
+void AliEmcalJetDeclusteringCache::SetKinematics(Node &node)
+{
+  const Double_t maxRap = 1e5;
+  Double_t pt2 = node.fPx * node.fPx + node.fPy * node.fPy;
+  node.fPt = TMath::Sqrt(pt2);
+  node.fPhi = pt2 > 0 ? TMath::ATan2(node.fPy, node.fPx) : 0;
+  if (node.fPhi < 0) node.fPhi += TMath::TwoPi();
+  if (node.fE == TMath::Abs(node.fPz) && pt2 == 0) {
+    node.fRap = node.fPz >= 0 ? maxRap + node.fPz : -(maxRap - node.fPz);
+  }
+  else {
+    Double_t m2 = node.fE * node.fE - pt2 - node.fPz * node.fPz;
+    if (m2 < 0) m2 = 0;
+    Double_t ePlusPz = node.fE + TMath::Abs(node.fPz);
+    node.fRap = 0.5 * TMath::Log((pt2 + m2) / (ePlusPz * ePlusPz));
+    if (node.fPz > 0) node.fRap = -node.fRap;
+  }
+}
+
+/**
+ * Squared distance in rapidity and azimuth.
+ */
+Double_t AliEmcalJetDeclusteringCache::DeltaR2(const Node &a, const Node &b)
+{
+  Double_t dphi = TMath::Abs(a.fPhi - b.fPhi);
+  if (dphi > TMath::Pi()) dphi = TMath::TwoPi() - dphi;
+  Double_t drap = a.fRap - b.fRap;
+  return drap * drap + dphi * dphi;
+}
+
+/**
+ * Number of splittings along the harder branch (primary Lund declustering sequence).
+ * @param[in] node Node code to start from
+ * @param[in] zcut Count only splittings with z > zcut
+ * @return Number of splittings
+ */
+Int_t AliEmcalJetDeclusteringCache::GetNPrimarySplittings(Int_t node, Double_t zcut) const
+{
+  Int_t n = 0;
+  for (; node >= 0; node = fSplittings[node].fHarder) {
+    if (fSplittings[node].fZ > zcut) n++;
+  }
+  return n;
+}
+
+/**
+ * Soft drop grooming: follow the harder branch until a splitting fulfills
+ * \f$ z > z_{cut} (\theta/R_{0})^{\beta} \f$.
+ * @param[in] node Node code to start from
+ * @param[in] zcut,beta,R0 Soft drop parameters
+ * @param[out] nDropped Number of splittings dropped before the one found (optional)
+ * @return Index of the first splitting passing the condition (groomed jet: fPt, fM; zg: fZ, Rg: fTheta), -1 if none
+ */
+Int_t AliEmcalJetDeclusteringCache::SoftDrop(Int_t node, Double_t zcut, Double_t beta, Double_t R0, Int_t *nDropped) const
+{
+  Int_t n = 0;
+  for (; node >= 0; node = fSplittings[node].fHarder) {
+    const Splitting &s = fSplittings[node];
+    if (s.fZ > zcut * TMath::Power(s.fTheta / R0, beta)) break;
+    n++;
+  }
+  if (nDropped) *nDropped = n;
+  return node >= 0 ? node : -1;
+}
+
+/**
+ * Number of splittings along the harder branch fulfilling the soft drop condition
+ * (iterated soft drop multiplicity).
+ * @param[in] node Node code to start from
+ * @param[in] zcut,beta,R0 Soft drop parameters
+ * @return Number of splittings
+ */
+Int_t AliEmcalJetDeclusteringCache::GetNSoftDropSplittings(Int_t node, Double_t zcut, Double_t beta, Double_t R0) const
+{
+  Int_t n = 0;
+  for (; node >= 0; node = fSplittings[node].fHarder) {
+    const Splitting &s = fSplittings[node];
+    if (s.fZ > zcut * TMath::Power(s.fTheta / R0, beta)) n++;
+  }
+  return n;
+}
@@ -0,0 +1,136 @@
+#if !(defined(__CINT__) || defined(__MAKECINT__))
+#ifndef ALIEMCALJETDECLUSTERINGCACHE_H
+#define ALIEMCALJETDECLUSTERINGCACHE_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliEmcalJet;
+class AliVEvent;
+
+/**
+ * @class AliEmcalJetDeclusteringCache
+ * @brief Per-event cache of the Cambridge/Aachen declustering trees of the jets in a jet container
+ *
+ * The constituents of each jet are reclustered once per event with the Cambridge/Aachen
+ * algorithm (E-scheme, distance in rapidity and azimuth, radius R) at the first request
+ * (see AliJetContainer::GetDeclusteringRoot). The tree of a jet is the one of the hardest
+ * of the reclustered jets, as fastjet::sorted_by_pt(inclusive_jets())[0] with the same
+ * jet definition. The clustering history is stored in a flat array
+ * of splittings: each entry holds the momentum fraction z of the softer branch, the opening angle
+ * \f$ \theta = \Delta R \f$, \f$ k_{t} = z \theta (p_{t,1} + p_{t,2}) \f$, the transverse momentum and
+ * the mass of the declustered (parent) object and the two branches ordered in \f$ p_{t} \f$.
+ *
+ * Branches are referred to by node codes: a code >= 0 is the index of a splitting,
+ * a code < 0 is a single constituent (see IsConstituent / GetConstituentIndex). Following the
+ * harder branch from the root gives the primary Lund declustering sequence, the softer branches
+ * give the secondary sequences.
+ *
+ * The cache belongs to its jet container, or is shared via an AliEmcalJetDeclusteringCacheManager
+ * by the containers with the same jet and constituent arrays and the same radius, so that
+ * substructure tasks running on the same jets recluster each jet only once.
+ */
+class AliEmcalJetDeclusteringCache {
+public:
+  /**
+   * @struct Splitting
+   * @brief One step of the declustering
+   */
+  struct Splitting {
+    Double_t fZ;            ///< \f$ p_{t,soft} / (p_{t,hard} + p_{t,soft}) \f$
+    Double_t fTheta;        ///< \f$ \Delta R \f$ between the two branches
+    Double_t fKt;           ///< \f$ p_{t,soft} \Delta R \f$
+    Double_t fPt;           ///< \f$ p_{t} \f$ of the parent
+    Double_t fM;            ///< mass of the parent
+    Int_t    fHarder;       ///< node code of the harder branch
+    Int_t    fSofter;       ///< node code of the softer branch
+  };
+
+  static const Int_t kNoNode = -2147483647 - 1; ///< node code of the root of a jet without constituents
+
+  AliEmcalJetDeclusteringCache(Double_t radius = 1.);
+
+  /// Radius of the Cambridge/Aachen reclustering
+  Double_t GetRadius() const { return fRadius; }
+
+  /// Whether the cache was filled for the given event
+  Bool_t IsValidFor(const AliVEvent *event, Long64_t entry, Int_t njets) const
+  { return fValid && fEvent == event && fEntry == entry && fNJets == njets; }
+  void   Reset(const AliVEvent *event, Long64_t entry, Int_t njets);
+  /// Drop content (keeping the allocated memory)
+  void   Invalidate() { fValid = kFALSE; }
+
+  /// Whether the jet was declustered in the current event
+  Bool_t HasJet(const AliEmcalJet *jet) const { return fJetRoot.find(jet) != fJetRoot.end(); }
+  Int_t  GetRoot(const AliEmcalJet *jet) const;
+  Int_t  AddJet(const AliEmcalJet *jet, Int_t n, const Double_t *px, const Double_t *py, const Double_t *pz, const Double_t *e);
+
+  /// Whether the node code refers to a single constituent
+  static Bool_t IsConstituent(Int_t node) { return node < 0 && node != kNoNode; }
+  /// Index of the constituent (in the order given to AddJet) of a constituent node code
+  Int_t  GetConstituentIndex(Int_t node) const { return fConstituentIndex[-node - 1]; }
+  /// Splitting of a node code >= 0
+  const Splitting &GetSplitting(Int_t node) const { return fSplittings[node]; }
+  /// \f$ p_{t} \f$ of the object of a node code
+  Double_t GetPt(Int_t node) const { return node >= 0 ? fSplittings[node].fPt : fConstituentPt[-node - 1]; }
+
+  Int_t  GetNPrimarySplittings(Int_t node, Double_t zcut = 0) const;
+  Int_t  SoftDrop(Int_t node, Double_t zcut, Double_t beta, Double_t R0, Int_t *nDropped = 0) const;
+  Int_t  GetNSoftDropSplittings(Int_t node, Double_t zcut, Double_t beta, Double_t R0) const;
+
+private:
+  /// Object being clustered
+  struct Node {
+    Double_t fPx, fPy, fPz, fE;           ///< four-momentum
+    Double_t fRap, fPhi, fPt;             ///< rapidity, azimuth, transverse momentum
+    Int_t    fCode;                       ///< node code
+  };
+
+  Int_t  Cluster();
+  static void     SetKinematics(Node &node);
+  static Double_t DeltaR2(const Node &a, const Node &b);
+
+  Double_t                                          fRadius;         ///< Radius of the reclustering
+  const AliVEvent                                  *fEvent;          ///< Event the cache was filled for
+  Long64_t                                          fEntry;          ///< Entry of the analysis manager the cache was filled for
+  Int_t                                             fNJets;          ///< Number of jets in the container for that event
+  Bool_t                                            fValid;          ///< Cache filled for fEvent
+  std::vector<Splitting>                            fSplittings;     ///< splittings of all jets
+  std::vector<Double_t>                             fConstituentPt;  ///< \f$ p_{t} \f$ of the constituents of all jets
+  std::vector<Int_t>                                fConstituentIndex; ///< index of the constituents in their jet
+  std::unordered_map<const AliEmcalJet *, Int_t>    fJetRoot;        ///< node code of the root of each jet
+  std::vector<Node>                                 fNodes;          ///< work array: objects being clustered
+  std::vector<Int_t>                                fNN;             ///< work array: index of the nearest neighbour in fNodes
+  std::vector<Double_t>                             fNNDist;         ///< work array: \f$ \Delta R^{2} \f$ to the nearest neighbour
+};
+
+/**
+ * @struct AliEmcalJetDeclusteringCacheKey
+ * @brief Jet container configuration as seen by the declustering cache
+ *
+ * Containers with the same jet and constituent array names and the same
+ * reclustering radius get the same declustering trees.
+ */
+struct AliEmcalJetDeclusteringCacheKey {
+  AliEmcalJetDeclusteringCacheKey(const char *jets, const char *constituents, Double_t radius) :
+    fJets(jets), fConstituents(constituents), fRadius(radius) {}
+
+  bool operator<(const AliEmcalJetDeclusteringCacheKey &other) const
+  {
+    if (fJets != other.fJets) return fJets < other.fJets;
+    if (fConstituents != other.fConstituents) return fConstituents < other.fConstituents;
+    return fRadius < other.fRadius;
+  }
+
+  std::string                                       fJets;           ///< Name of the jet array
+  std::string                                       fConstituents;   ///< Name of the constituent (particle) array
+  Double_t                                          fRadius;         ///< Radius of the reclustering
+};
+
+#endif
+#endif
@@ -0,0 +1,99 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+#include <map>
+
+#include <RVersion.h>
+
+#include "AliEmcalJetDeclusteringCache.h"
+#include "AliEmcalJetDeclusteringCacheManager.h"
+
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIEMCALJETDECLUSTERINGCACHE_THREAD
+#include <mutex>
+#endif
+
+/// \cond CLASSIMP
+ClassImp(AliEmcalJetDeclusteringCacheManager);
+/// \endcond
+
+/**
+ * @struct AliEmcalJetDeclusteringCacheRegistry
+ * @brief Caches held by an AliEmcalJetDeclusteringCacheManager, by jet container configuration
+ */
+struct AliEmcalJetDeclusteringCacheRegistry {
+  std::map<AliEmcalJetDeclusteringCacheKey, AliEmcalJetDeclusteringCache *> fCaches; ///< Caches by configuration
+#ifdef ALIEMCALJETDECLUSTERINGCACHE_THREAD
+  std::mutex fMutex;                                                                   ///< Protects fCaches
+#endif
+};
+
+/**
+ * Default constructor, for ROOT I/O.
+ */
+AliEmcalJetDeclusteringCacheManager::AliEmcalJetDeclusteringCacheManager():
+  TNamed(),
+  fRegistry(new AliEmcalJetDeclusteringCacheRegistry)
+{
+}
+
+/**
+ * Standard constructor.
+ * @param[in] name Name of the manager
+ */
+AliEmcalJetDeclusteringCacheManager::AliEmcalJetDeclusteringCacheManager(const char *name):
+  TNamed(name, name),
+  fRegistry(new AliEmcalJetDeclusteringCacheRegistry)
+{
+}
+
+/**
+ * Destructor. Deletes all caches, the manager must therefore
+ * not be deleted before the jet containers connected to it.
+ */
+AliEmcalJetDeclusteringCacheManager::~AliEmcalJetDeclusteringCacheManager()
+{
+  for (std::map<AliEmcalJetDeclusteringCacheKey, AliEmcalJetDeclusteringCache *>::iterator it = fRegistry->fCaches.begin(); it != fRegistry->fCaches.end(); ++it) {
+    delete it->second;
+  }
+  delete fRegistry;
+}
+
+/**
+ * Get the cache for a given jet container configuration, creating it
+ * at the first request. The cache stays owned by the manager.
+ * @param[in] key Jet and constituent arrays and reclustering radius
+ * @return Cache shared by all jet containers with this configuration
+ */
+AliEmcalJetDeclusteringCache *AliEmcalJetDeclusteringCacheManager::GetCache(const AliEmcalJetDeclusteringCacheKey &key)
+{
+#ifdef ALIEMCALJETDECLUSTERINGCACHE_THREAD
+  std::lock_guard<std::mutex> lock(fRegistry->fMutex);
+#endif
+  AliEmcalJetDeclusteringCache *&cache = fRegistry->fCaches[key];
+  if (!cache) cache = new AliEmcalJetDeclusteringCache(key.fRadius);
+  return cache;
+}
+
+/**
+ * Get the number of different jet container configurations seen.
+ * @return Number of caches
+ */
+Int_t AliEmcalJetDeclusteringCacheManager::GetNCaches() const
+{
+#ifdef ALIEMCALJETDECLUSTERINGCACHE_THREAD
+  std::lock_guard<std::mutex> lock(fRegistry->fMutex);
+#endif
+  return fRegistry->fCaches.size();
+}
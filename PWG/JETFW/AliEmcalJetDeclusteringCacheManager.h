@@ -0,0 +1,48 @@
+#ifndef ALIEMCALJETDECLUSTERINGCACHEMANAGER_H
+#define ALIEMCALJETDECLUSTERINGCACHEMANAGER_H
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <TNamed.h>
+
+class AliEmcalJetDeclusteringCache;
+struct AliEmcalJetDeclusteringCacheKey;
+struct AliEmcalJetDeclusteringCacheRegistry;
+
+/**
+ * @class AliEmcalJetDeclusteringCacheManager
+ * @brief Owner of the declustering caches shared between jet containers
+ *
+ * Jet containers connected to the same manager (AliJetContainer::SetDeclusteringCacheManager)
+ * with the same jet and constituent arrays and the same reclustering radius use a single
+ * AliEmcalJetDeclusteringCache, so that each jet is reclustered once per event. The manager
+ * owns the caches and deletes them in its destructor, it has to outlive the containers.
+ * It is created in the steering macro and given to the jet containers of all tasks which
+ * should share their declustering trees:
+ *
+ * ~~~{.cxx}
+ * AliEmcalJetDeclusteringCacheManager *declusteringCaches = new AliEmcalJetDeclusteringCacheManager("declusteringCaches");
+ * jetCont1->SetDeclusteringCacheManager(declusteringCaches);
+ * jetCont2->SetDeclusteringCacheManager(declusteringCaches);
+ * ~~~
+ */
+class AliEmcalJetDeclusteringCacheManager : public TNamed {
+ public:
+  AliEmcalJetDeclusteringCacheManager();
+  AliEmcalJetDeclusteringCacheManager(const char *name);
+  virtual ~AliEmcalJetDeclusteringCacheManager();
+
+  AliEmcalJetDeclusteringCache *GetCache(const AliEmcalJetDeclusteringCacheKey &key);
+  Int_t                       GetNCaches() const;
+
+ private:
+  AliEmcalJetDeclusteringCacheRegistry *fRegistry; //!<! Caches by jet container configuration
+
+  AliEmcalJetDeclusteringCacheManager(const AliEmcalJetDeclusteringCacheManager&);            // not implemented
+  AliEmcalJetDeclusteringCacheManager& operator=(const AliEmcalJetDeclusteringCacheManager&); // not implemented
+
+  /// \cond CLASSIMP
+  ClassDef(AliEmcalJetDeclusteringCacheManager, 1);
+  /// \endcond
+};
+#endif
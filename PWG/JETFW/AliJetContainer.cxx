@@ -13,8 +13,11 @@
  * provided "as is" without express or implied warranty.                  *
  **************************************************************************/
 
+#include <vector>
+
 #include <TClonesArray.h>
 
+#include "AliAnalysisManager.h"
 #include "AliVEvent.h"
 #include "AliLog.h"
 #include "AliEMCALGeometry.h"
@@ -24,6 +27,8 @@
 #include "AliTLorentzVector.h"
 
 #include "AliJetContainer.h"
+#include "AliEmcalJetDeclusteringCache.h"
+#include "AliEmcalJetDeclusteringCacheManager.h"
 
 /// \cond CLASSIMP
 ClassImp(AliJetContainer);
@@ -63,7 +68,11 @@ AliJetContainer::AliJetContainer():
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fDeclusteringRadius(1.),
+  fDeclusteringCacheManager(0),
+  fDeclusteringCache(0),
+  fOwnDeclusteringCache(kFALSE)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -104,13 +113,25 @@ AliJetContainer::AliJetContainer(const char *name):
   fGeom(0),
   fRunNumber(0),
   fTpcHolePos(0),
-  fTpcHoleWidth(0)
+  fTpcHoleWidth(0),
+  fDeclusteringRadius(1.),
+  fDeclusteringCacheManager(0),
+  fDeclusteringCache(0),
+  fOwnDeclusteringCache(kFALSE)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
   SetMinPt(1);
 }
 
+/**
+ * Destructor. Deletes the declustering cache if it is not shared.
+ */
+AliJetContainer::~AliJetContainer()
+{
+  if (fOwnDeclusteringCache) delete fDeclusteringCache;
+}
+
 /**
  * Jet definition constructor.
  *
@@ -154,7 +175,11 @@ AliJetContainer::AliJetContainer(EJetType_t jetType, EJetAlgo_t jetAlgo, ERecoSc
   fLocalRho(0),
   fRhoMass(0),
   fGeom(0),
-  fRunNumber(0)
+  fRunNumber(0),
+  fDeclusteringRadius(1.),
+  fDeclusteringCacheManager(0),
+  fDeclusteringCache(0),
+  fOwnDeclusteringCache(kFALSE)
 {
   fBaseClassName = "AliEmcalJet";
   SetClassName("AliEmcalJet");
@@ -849,6 +874,92 @@ Double_t AliJetContainer::GetFractionSharedPt(const AliEmcalJet *jet1, AliPartic
   return fraction;
 }
 
+/**
+ * Preparation for the next event: the declustering trees
+ * of the previous event are dropped at the first access.
+ * @param[in] event The event to be processed.
+ */
+void AliJetContainer::NextEvent(const AliVEvent *event)
+{
+  AliParticleContainer::NextEvent(event);
+
+  if (fDeclusteringCache && fOwnDeclusteringCache) {
+    fDeclusteringCache->Invalidate();
+  }
+  else if (fDeclusteringCacheManager) {
+    // a shared cache is recognized as outdated by the event and entry it was filled for
+    AliAnalysisManager *mgr = AliAnalysisManager::GetAnalysisManager();
+    fCurrentEntry = mgr ? mgr->GetCurrentEntry() : -1;
+  }
+}
+
+/**
+ * Get the declustering cache for the current event. The cache is taken from the
+ * declustering cache manager, shared with the containers with the same jet and
+ * constituent arrays and the same radius, or created privately if no manager is set.
+ * It is emptied at the first access in a new event.
+ * @return Declustering cache, NULL if the container has no array
+ */
+const AliEmcalJetDeclusteringCache *AliJetContainer::GetDeclusteringCache() const
+{
+  if (!fClArray) return 0;
+  return AttachDeclusteringCache();
+}
+
+/**
+ * Get the root of the Cambridge/Aachen declustering tree of a jet, reclustering
+ * its track constituents (taken from the particle container) with radius
+ * fDeclusteringRadius at the first request in the event. The tree is then
+ * accessible via GetDeclusteringCache().
+ * @param jet Jet of this container
+ * @return Node code of the root, AliEmcalJetDeclusteringCache::kNoNode if the jet has no constituents
+ */
+Int_t AliJetContainer::GetDeclusteringRoot(const AliEmcalJet *jet) const
+{
+  if (!fClArray || !jet || !fParticleContainer) return AliEmcalJetDeclusteringCache::kNoNode;
+  AliEmcalJetDeclusteringCache *cache = AttachDeclusteringCache();
+  if (cache->HasJet(jet)) return cache->GetRoot(jet);
+
+  Int_t n = jet->GetNumberOfTracks();
+  std::vector<Double_t> p(4 * n);
+  Double_t *px = &p[0], *py = px + n, *pz = py + n, *e = pz + n;
+  Int_t nconst = 0;
+  for (Int_t i = 0; i < n; i++) {
+    AliVParticle *part = jet->TrackAt(i, fParticleContainer->GetArray());
+    if (!part) continue;
+    px[nconst] = part->Px();
+    py[nconst] = part->Py();
+    pz[nconst] = part->Pz();
+    e[nconst] = part->E();
+    nconst++;
+  }
+  return cache->AddJet(jet, nconst, px, py, pz, e);
+}
+
+/**
+ * Get the declustering cache (creating it at the first call)
+ * and empty it if it was filled for another event.
+ * @return Declustering cache
+ */
+AliEmcalJetDeclusteringCache *AliJetContainer::AttachDeclusteringCache() const
+{
+  if (!fDeclusteringCache) {
+    if (fDeclusteringCacheManager) {
+      AliEmcalJetDeclusteringCacheKey key(fClArrayName.Data(), fParticleContainer ? fParticleContainer->GetArrayName().Data() : "", fDeclusteringRadius);
+      fDeclusteringCache = fDeclusteringCacheManager->GetCache(key);
+    }
+    else {
+      fDeclusteringCache = new AliEmcalJetDeclusteringCache(fDeclusteringRadius);
+      fOwnDeclusteringCache = kTRUE;
+    }
+  }
+
+  Int_t njets = GetNEntries();
+  if (!fDeclusteringCache->IsValidFor(fCurrentEvent, fCurrentEntry, njets)) fDeclusteringCache->Reset(fCurrentEvent, fCurrentEntry, njets);
+
+  return fDeclusteringCache;
+}
+
 /**
  * Generate the jet branch name according to a given jet definition.
  * @param jetType Type of the jet (full, charged, neutral)
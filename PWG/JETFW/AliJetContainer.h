@@ -12,6 +12,8 @@ class AliVEvent;
 class AliParticleContainer;
 class AliClusterContainer;
 class AliLocalRhoParameter;
+class AliEmcalJetDeclusteringCache;
+class AliEmcalJetDeclusteringCacheManager;
 
 #include <TMath.h>
 #include <TLorentzVector.h>
@@ -87,8 +89,9 @@ class AliJetContainer : public AliParticleContainer {
   AliJetContainer();
   AliJetContainer(const char *name);
   AliJetContainer(EJetType_t jetType, EJetAlgo_t jetAlgo, ERecoScheme_t recoScheme, Double_t radius, AliParticleContainer* partCont, AliClusterContainer* clusCont, TString tag = "Jet");
-  virtual ~AliJetContainer() {;}
+  virtual ~AliJetContainer();
   
+  virtual void NextEvent(const AliVEvent *event);
   void LoadRho(const AliVEvent *event);
   void LoadLocalRho(const AliVEvent *event);
   void LoadRhoMass(const AliVEvent *event);
@@ -181,6 +184,13 @@ class AliJetContainer : public AliParticleContainer {
   AliClusterContainer        *GetClusterContainer() const                    {return fClusterContainer;}
   Double_t                    GetFractionSharedPt(const AliEmcalJet *jet, AliParticleContainer *cont2 = 0x0) const;
 
+  void                        SetDeclusteringRadius(Double_t r)              { fDeclusteringRadius = r; }
+  Double_t                    GetDeclusteringRadius() const                  { return fDeclusteringRadius; }
+  void                        SetDeclusteringCacheManager(AliEmcalJetDeclusteringCacheManager *m) { fDeclusteringCacheManager = m; }
+  AliEmcalJetDeclusteringCacheManager *GetDeclusteringCacheManager() const   { return fDeclusteringCacheManager; }
+  const AliEmcalJetDeclusteringCache *GetDeclusteringCache() const;
+  Int_t                       GetDeclusteringRoot(const AliEmcalJet *jet) const;
+
   const char*                 GetTitle() const;
 
   static TString              GenerateJetName(EJetType_t jetType, EJetAlgo_t jetAlgo, ERecoScheme_t recoScheme, Double_t radius, AliParticleContainer* partCont, AliClusterContainer* clusCont, TString tag);
@@ -224,11 +234,17 @@ class AliJetContainer : public AliParticleContainer {
   Int_t                       fRunNumber;            //!<! run number
   Double_t                    fTpcHolePos;           ///   position(in radians) of the malfunctioning TPC sector
   Double_t                    fTpcHoleWidth;         ///   width of the malfunctioning TPC area
+  Double_t                    fDeclusteringRadius;   ///   radius of the C/A reclustering of the declustering trees
+  AliEmcalJetDeclusteringCacheManager *fDeclusteringCacheManager; ///< owner of the declustering caches shared with other containers
+  mutable AliEmcalJetDeclusteringCache *fDeclusteringCache; //!<! declustering trees of the jets
+  mutable Bool_t              fOwnDeclusteringCache; //!<! declustering cache created by this container
  private:
+  AliEmcalJetDeclusteringCache *AttachDeclusteringCache() const;
+
   AliJetContainer(const AliJetContainer& obj); // copy constructor
   AliJetContainer& operator=(const AliJetContainer& other); // assignment
 
-  ClassDef(AliJetContainer, 18);
+  ClassDef(AliJetContainer, 20);
 };
 
 #endif
@@ -9,6 +9,7 @@
 #pragma link C++ class AliAnalysisTaskEmcalJet+;
 #pragma link C++ class AliAnalysisTaskEmcalJetLight+;
 #pragma link C++ class AliEmcalJet+;
+#pragma link C++ class AliEmcalJetDeclusteringCacheManager+;
 #pragma link C++ class AliJetContainer+;
 #pragma link C++ class AliLocalRhoParameter+;
 #pragma link C++ class AliRhoParameter+;
@@ -0,0 +1,200 @@
+// $Id: AliCounterCollectionFiller.cxx  $
+//
+// Buffered filling of an AliCounterCollection.
+//
+// AliCounterCollection::Count() takes the keys as a "rubric:key/..." string,
+// which has to be formatted, tokenised and looked up for each count. Here the
+// rubrics are declared once, with the same names and keys as in the counter
+// collection, and each count is given as integer coordinates, one per rubric:
+// the index of the key (GetKey()) for the rubrics with a list of keys, the key
+// itself for the rubrics with integer keys (run number, multiplicity...), or
+// kNoKey for a rubric not given. The counts are kept in dense blocks, one
+// block per combination of the integer keys, the block of the last count
+// (typically the current run) being reused without any lookup.
+// Flush() moves the content into the counter collection, with one string
+// count per non-empty cell, so that the collection is filled exactly as if
+// it had been counted directly.
+
+#include "AliCounterCollectionFiller.h"
+
+#include <TObjArray.h>
+#include <TObjString.h>
+
+#include "AliCounterCollection.h"
+
+ClassImp(AliCounterCollectionFiller)
+
+//________________________________________________________________________
+AliCounterCollectionFiller::AliCounterCollectionFiller() :
+  TObject(),
+  fRubricNames(),
+  fKeys(),
+  fEnumRubrics(),
+  fIntRubrics(),
+  fBlockSize(1),
+  fBlockIndex(),
+  fBlockKeys(),
+  fContent(),
+  fLastKeys(),
+  fLastBlock(-1)
+{
+  // Default constructor.
+}
+
+//________________________________________________________________________
+AliCounterCollectionFiller::~AliCounterCollectionFiller()
+{
+  // Destructor.
+}
+
+//________________________________________________________________________
+Int_t AliCounterCollectionFiller::AddRubric(TString name, TString listOfKeys)
+{
+  // Add a rubric with the given list of keys, returns its index.
+
+  Int_t rubric = fRubricNames.size();
+  fRubricNames.push_back(name);
+  fKeys.push_back(std::vector<TString>());
+  TObjArray *keys = listOfKeys.Tokenize("/");
+  for (Int_t i = 0; i < keys->GetEntriesFast(); i++)
+    fKeys.back().push_back(static_cast<TObjString*>(keys->UncheckedAt(i))->GetString());
+  delete keys;
+  fEnumRubrics.push_back(rubric);
+  UpdateLayout(); // the size of the blocks changes, the content is dropped
+  return rubric;
+}
+
+//________________________________________________________________________
+Int_t AliCounterCollectionFiller::AddRubric(TString name)
+{
+  // Add a rubric with integer keys, returns its index.
+
+  Int_t rubric = fRubricNames.size();
+  fRubricNames.push_back(name);
+  fKeys.push_back(std::vector<TString>());
+  fIntRubrics.push_back(rubric);
+  UpdateLayout();
+  return rubric;
+}
+
+//________________________________________________________________________
+Int_t AliCounterCollectionFiller::GetKey(Int_t rubric, TString key) const
+{
+  // Index of the key in the rubric (case insensitive, as in AliCounterCollection), -1 if not found.
+
+  if (rubric < 0 || rubric >= GetNRubrics()) return -1;
+  const std::vector<TString> &keys = fKeys[rubric];
+  for (UInt_t i = 0; i < keys.size(); i++)
+    if (!keys[i].CompareTo(key, TString::kIgnoreCase)) return i;
+  return -1;
+}
+
+//________________________________________________________________________
+void AliCounterCollectionFiller::Count(const Int_t *coord, Int_t value)
+{
+  // Add value to the cell at the given coordinates, one per rubric.
+
+  Int_t nInt = fIntRubrics.size();
+
+  Bool_t sameBlock = (fLastBlock >= 0);
+  for (Int_t i = 0; sameBlock && i < nInt; i++) sameBlock = (coord[fIntRubrics[i]] == fLastKeys[i]);
+
+  if (!sameBlock) {
+    for (Int_t i = 0; i < nInt; i++) fLastKeys[i] = coord[fIntRubrics[i]];
+    std::map<std::vector<Int_t>,Int_t>::const_iterator it = fBlockIndex.find(fLastKeys);
+    if (it != fBlockIndex.end()) fLastBlock = it->second;
+    else {
+      fLastBlock = fBlockIndex.size();
+      fBlockIndex[fLastKeys] = fLastBlock;
+      fBlockKeys.insert(fBlockKeys.end(), fLastKeys.begin(), fLastKeys.end());
+      fContent.resize(fContent.size()+fBlockSize, 0);
+    }
+  }
+
+  Int_t cell = 0;
+  for (UInt_t e = 0; e < fEnumRubrics.size(); e++) {
+    Int_t key = coord[fEnumRubrics[e]];
+    cell = cell*(fKeys[fEnumRubrics[e]].size()+1) + (key == kNoKey ? 0 : key+1);
+  }
+
+  fContent[fLastBlock*fBlockSize+cell] += value;
+}
+
+//________________________________________________________________________
+void AliCounterCollectionFiller::Flush(AliCounterCollection &counters)
+{
+  // Count the content in the collection and clear it.
+  // The blocks are flushed in the order they were created, so the integer
+  // keys are added to the collection in the order they were first counted.
+
+  Int_t nRubrics = GetNRubrics();
+  Int_t nInt = fIntRubrics.size();
+  Int_t nEnum = fEnumRubrics.size();
+  Int_t nBlocks = fBlockIndex.size();
+  std::vector<Int_t> coord(nRubrics, kNoKey);
+
+  for (Int_t b = 0; b < nBlocks; b++) {
+    for (Int_t i = 0; i < nInt; i++) coord[fIntRubrics[i]] = fBlockKeys[b*nInt+i];
+
+    for (Int_t cell = 0; cell < fBlockSize; cell++) {
+      Int_t value = fContent[b*fBlockSize+cell];
+      if (value == 0) continue;
+
+      Int_t rest = cell;
+      for (Int_t e = nEnum-1; e >= 0; e--) {
+        Int_t nKeys = fKeys[fEnumRubrics[e]].size()+1;
+        Int_t key = rest%nKeys - 1;
+        rest /= nKeys;
+        coord[fEnumRubrics[e]] = (key < 0) ? Int_t(kNoKey) : key;
+      }
+
+      TString externalKey;
+      for (Int_t r = 0; r < nRubrics; r++) {
+        if (coord[r] == kNoKey) continue;
+        if (!externalKey.IsNull()) externalKey += "/";
+        externalKey += fRubricNames[r];
+        externalKey += ":";
+        if (fKeys[r].empty()) externalKey += coord[r];
+        else externalKey += fKeys[r][coord[r]];
+      }
+
+      counters.Count(externalKey, value);
+    }
+  }
+
+  Clear();
+}
+
+//________________________________________________________________________
+void AliCounterCollectionFiller::Clear(Option_t * /*option*/)
+{
+  // Drop the content, the rubrics are kept.
+
+  fBlockIndex.clear();
+  fBlockKeys.clear();
+  fContent.clear();
+  fLastKeys.assign(fIntRubrics.size(), kNoKey);
+  fLastBlock = -1;
+}
+
+//________________________________________________________________________
+void AliCounterCollectionFiller::Reset()
+{
+  // Drop the content and the rubrics.
+
+  fRubricNames.clear();
+  fKeys.clear();
+  fEnumRubrics.clear();
+  fIntRubrics.clear();
+  UpdateLayout();
+}
+
+//________________________________________________________________________
+void AliCounterCollectionFiller::UpdateLayout()
+{
+  // Size of the blocks from the rubrics, the content is dropped.
+
+  fBlockSize = 1;
+  for (UInt_t e = 0; e < fEnumRubrics.size(); e++) fBlockSize *= fKeys[fEnumRubrics[e]].size()+1;
+  Clear();
+}
@@ -0,0 +1,53 @@
+#ifndef ALICOUNTERCOLLECTIONFILLER_H
+#define ALICOUNTERCOLLECTIONFILLER_H
+
+// $Id: AliCounterCollectionFiller.h  $
+
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+#include <TString.h>
+
+class AliCounterCollection;
+
+class AliCounterCollectionFiller : public TObject {
+ public:
+  enum { kNoKey = kMinInt }; // coordinate of a rubric not given in a count
+
+  AliCounterCollectionFiller();
+  virtual ~AliCounterCollectionFiller();
+
+  // rubrics, in the order of the coordinates given to Count()
+  Int_t AddRubric(TString name, TString listOfKeys); // keys separated by "/"
+  Int_t AddRubric(TString name);                     // integer keys (run number, multiplicity...)
+  Int_t GetNRubrics() const { return fRubricNames.size(); }
+  Int_t GetKey(Int_t rubric, TString key) const;
+
+  void  Count(const Int_t *coord, Int_t value = 1);
+  Bool_t IsEmpty() const { return fContent.empty(); }
+  void  Flush(AliCounterCollection &counters);
+
+  void  Clear(Option_t *option="");
+  void  Reset();
+
+ private:
+  AliCounterCollectionFiller(const AliCounterCollectionFiller&);             // not implemented
+  AliCounterCollectionFiller& operator=(const AliCounterCollectionFiller&);  // not implemented
+
+  void  UpdateLayout();
+
+  std::vector<TString>               fRubricNames;  //! name of each rubric
+  std::vector<std::vector<TString> > fKeys;         //! keys of each rubric, empty for the integer ones
+  std::vector<Int_t>                 fEnumRubrics;  //! rubrics with a list of keys
+  std::vector<Int_t>                 fIntRubrics;   //! rubrics with integer keys
+  Int_t                              fBlockSize;    //! cells per block (key combinations of the listed rubrics)
+  std::map<std::vector<Int_t>,Int_t> fBlockIndex;   //! integer keys -> block
+  std::vector<Int_t>                 fBlockKeys;    //! integer keys of each block
+  std::vector<Int_t>                 fContent;      //! counts, block after block
+  std::vector<Int_t>                 fLastKeys;     //! integer keys of the last block used
+  Int_t                              fLastBlock;    //! last block used
+
+  ClassDef(AliCounterCollectionFiller, 1); // Buffered filling of an AliCounterCollection
+};
+#endif
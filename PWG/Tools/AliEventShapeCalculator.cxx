@@ -0,0 +1,276 @@
+/**************************************************************************
+ * Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//
+// Transverse event shape variables (spherocity, thrust, sphericity)
+// computed from the flat arrays of the selected transverse momenta.
+//
+
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "AliEventShapeCalculator.h"
+
+ClassImp(AliEventShapeCalculator)
+
+namespace {
+
+/// Particle sorted by azimuth
+struct SortedParticle {
+  Double_t fPhi;
+  Double_t fPx;
+  Double_t fPy;
+  Double_t fPt;
+  bool operator<(const SortedParticle &o) const { return fPhi < o.fPhi; }
+};
+
+/**
+ * Grid scan of the spherocity axis, with the arithmetic of the step based implementations.
+ * @param[in] px,py,pt Transverse momenta
+ * @param[in] stepDeg Step size (degrees)
+ * @param[in] squares If true, minimise the ratio of the squares instead of the square of the ratio
+ * @param[out] minimum Minimum found (not scaled by pi^2/4)
+ * @param[out] phiAxis Azimuth of the axis (only set if a minimum was found)
+ */
+template <typename T>
+void ScanGrid(const std::vector<Double_t> &px, const std::vector<Double_t> &py, const std::vector<Double_t> &pt,
+              Double_t stepDeg, Bool_t squares, Double_t &minimum, Double_t *phiAxis)
+{
+  Int_t n = pt.size();
+  T step = stepDeg;
+
+  T sumapt = 0;
+  std::vector<T> x(n), y(n);
+  for (Int_t i = 0; i < n; i++) {
+    sumapt = sumapt + pt[i];
+    x[i] = px[i];
+    y[i] = py[i];
+  }
+
+  T spherocity = 2;
+  for (Int_t i = 0; i < 360/step; ++i) {
+    T phiparam = (TMath::Pi() * i * step) / 180;
+    T nx = TMath::Cos(phiparam);
+    T ny = TMath::Sin(phiparam);
+    T numerator = 0;
+    for (Int_t j = 0; j < n; ++j) {
+      numerator += TMath::Abs(ny * x[j] - nx * y[j]);
+    }
+    T pFull = squares ? numerator * numerator / (sumapt * sumapt) : T(TMath::Power((numerator / sumapt), 2));
+    if (pFull < spherocity) {
+      spherocity = pFull;
+      if (phiAxis) *phiAxis = phiparam;
+    }
+  }
+  minimum = spherocity;
+}
+
+}
+
+//________________________________________________________________________
+AliEventShapeCalculator::AliEventShapeCalculator() :
+  fPx(),
+  fPy(),
+  fPt(),
+  fSumPt(0)
+{
+  // Default constructor.
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::Clear()
+{
+  // Remove all particles (the memory is kept for the next event).
+
+  fPx.clear();
+  fPy.clear();
+  fPt.clear();
+  fSumPt = 0;
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::AddParticle(Double_t px, Double_t py)
+{
+  // Add a particle.
+
+  AddParticle(px, py, TMath::Sqrt(px * px + py * py));
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::AddParticle(Double_t px, Double_t py, Double_t pt)
+{
+  // Add a particle with a given transverse momentum (used for the normalisation).
+
+  fPx.push_back(px);
+  fPy.push_back(py);
+  fPt.push_back(pt);
+  fSumPt += pt;
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::AddParticlePtPhi(Double_t pt, Double_t phi)
+{
+  // Add a particle given by its transverse momentum and azimuth.
+
+  AddParticle(pt * TMath::Cos(phi), pt * TMath::Sin(phi), pt);
+}
+
+//________________________________________________________________________
+void AliEventShapeCalculator::Sweep(Double_t &minCross, Double_t &phiCross, Double_t &maxDot, Double_t &phiDot) const
+{
+  // Sweep over the half planes [phi_j, phi_j + pi) starting at each particle j.
+  // With the sum W_j of the momenta in the half plane and V_j = 2 W_j - sum p_T:
+  // - sum_i |p_i x n_j| = |V_j x n_j| for the axis n_j along particle j,
+  // - sum_i |p_i . n| is maximal for n along the largest V_j.
+  // Particles on the boundary do not contribute to the first sum, and the complement
+  // of a half plane gives the same |V|, so all candidate axes are covered.
+
+  minCross = -1;
+  phiCross = 0;
+  maxDot = -1;
+  phiDot = 0;
+
+  std::vector<SortedParticle> particles;
+  particles.reserve(fPt.size());
+  for (UInt_t i = 0; i < fPt.size(); i++) {
+    if (!(fPt[i] > 0)) continue;
+    SortedParticle p;
+    p.fPhi = TMath::ATan2(fPy[i], fPx[i]);
+    if (p.fPhi < 0) p.fPhi += TMath::TwoPi();
+    p.fPx = fPx[i];
+    p.fPy = fPy[i];
+    p.fPt = fPt[i];
+    particles.push_back(p);
+  }
+  Int_t n = particles.size();
+  if (n == 0) return;
+  std::sort(particles.begin(), particles.end());
+
+  // prefix sums over the particles followed by their copies at phi + 2 pi
+  std::vector<Double_t> sumX(2 * n + 1, 0.), sumY(2 * n + 1, 0.);
+  for (Int_t k = 0; k < 2 * n; k++) {
+    sumX[k + 1] = sumX[k] + particles[k % n].fPx;
+    sumY[k + 1] = sumY[k] + particles[k % n].fPy;
+  }
+  Double_t totX = sumX[n];
+  Double_t totY = sumY[n];
+
+  Int_t end = 0;
+  for (Int_t j = 0; j < n; j++) {
+    const SortedParticle &pj = particles[j];
+    Double_t limit = pj.fPhi + TMath::Pi();
+    if (end < j) end = j;
+    while (end < j + n && particles[end % n].fPhi + (end >= n ? TMath::TwoPi() : 0.) < limit) end++;
+
+    Double_t vx = 2 * (sumX[end] - sumX[j]) - totX;
+    Double_t vy = 2 * (sumY[end] - sumY[j]) - totY;
+
+    Double_t cross = TMath::Abs(vy * pj.fPx - vx * pj.fPy) / pj.fPt;
+    if (minCross < 0 || cross < minCross) {
+      minCross = cross;
+      phiCross = pj.fPhi < TMath::Pi() ? pj.fPhi : pj.fPhi - TMath::Pi();
+    }
+
+    Double_t dot = TMath::Sqrt(vx * vx + vy * vy);
+    if (dot > maxDot) {
+      maxDot = dot;
+      phiDot = TMath::ATan2(vy, vx);
+      if (phiDot < 0) phiDot += TMath::Pi();
+      if (phiDot >= TMath::Pi()) phiDot -= TMath::Pi();
+    }
+  }
+}
+
+//________________________________________________________________________
+Double_t AliEventShapeCalculator::GetSpherocity(Double_t *phiAxis) const
+{
+  // Exact spherocity.
+  // phiAxis (optional) is set to the azimuth of the spherocity axis in [0, pi).
+  // Returns -1 if there is no particle with p_T > 0.
+
+  Double_t minCross = 0, phiCross = 0, maxDot = 0, phiDot = 0;
+  Sweep(minCross, phiCross, maxDot, phiDot);
+  if (minCross < 0 || !(fSumPt > 0)) return -1;
+
+  if (phiAxis) *phiAxis = phiCross;
+  Double_t ratio = minCross / fSumPt;
+  return TMath::Pi() * TMath::Pi() / 4. * ratio * ratio;
+}
+
+//________________________________________________________________________
+Double_t AliEventShapeCalculator::GetThrust(Double_t *phiAxis) const
+{
+  // Exact transverse thrust.
+  // phiAxis (optional) is set to the azimuth of the thrust axis in [0, pi).
+  // Returns -1 if there is no particle with p_T > 0.
+
+  Double_t minCross = 0, phiCross = 0, maxDot = 0, phiDot = 0;
+  Sweep(minCross, phiCross, maxDot, phiDot);
+  if (maxDot < 0 || !(fSumPt > 0)) return -1;
+
+  if (phiAxis) *phiAxis = phiDot;
+  return maxDot / fSumPt;
+}
+
+//________________________________________________________________________
+Double_t AliEventShapeCalculator::GetSphericity() const
+{
+  // Transverse sphericity of the linearised momentum tensor.
+  // Returns -1 if the sum of the transverse momenta is not positive.
+
+  Double_t s00 = 0.;
+  Double_t s01 = 0.;
+  Double_t s11 = 0.;
+  for (UInt_t i = 0; i < fPt.size(); i++) {
+    if (!(fPt[i] > 0)) continue;
+    s00 += (fPx[i] * fPx[i]) / fPt[i];
+    s01 += (fPy[i] * fPx[i]) / fPt[i];
+    s11 += (fPy[i] * fPy[i]) / fPt[i];
+  }
+  if (!(fSumPt > 0)) return -1;
+  s00 /= fSumPt;
+  s01 /= fSumPt;
+  s11 /= fSumPt;
+
+  Double_t sphericity = -10;
+  Double_t lambda1 = ((s00 + s11) + TMath::Sqrt((s00 + s11) * (s00 + s11) - 4 * (s00 * s11 - s01 * s01))) / 2.;
+  Double_t lambda2 = ((s00 + s11) - TMath::Sqrt((s00 + s11) * (s00 + s11) - 4 * (s00 * s11 - s01 * s01))) / 2.;
+  if (TMath::Abs(lambda2) < 0.00001 && TMath::Abs(lambda1) < 0.00001) sphericity = 0;
+  if (TMath::Abs(lambda1 + lambda2) > 0.000001) sphericity = 2 * TMath::Min(lambda1, lambda2) / (lambda1 + lambda2);
+  return sphericity;
+}
+
+//________________________________________________________________________
+Double_t AliEventShapeCalculator::GetSpherocityGrid(Double_t stepDeg, EGridArithmetic_t arithmetic, Double_t *phiAxis) const
+{
+  // Spherocity minimised over the axes at azimuth i * stepDeg (degrees), i < 360 / stepDeg.
+  // The arithmetic reproduces the step based implementations:
+  // - kFloat:         PWGLF/SPECTRA/Spherocity, PWG/HMTF
+  // - kDouble:        AliFemtoSpherocityEventCut
+  // - kDoubleSquares: AliVertexingHFUtils
+  // phiAxis (optional) is set to the azimuth of the first axis with the minimal value.
+
+  Double_t minimum = 0;
+  if (arithmetic == kFloat) {
+    ScanGrid<Float_t>(fPx, fPy, fPt, stepDeg, kFALSE, minimum, phiAxis);
+  }
+  else {
+    ScanGrid<Double_t>(fPx, fPy, fPt, stepDeg, arithmetic == kDoubleSquares, minimum, phiAxis);
+  }
+
+  if (arithmetic == kDoubleSquares) return minimum * (TMath::Pi() * TMath::Pi() / 4.);
+  return ((minimum) * TMath::Pi() * TMath::Pi()) / 4.0;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file AliEventShapeCalculator.h
+ * \brief Declaration of class AliEventShapeCalculator
+ *
+ * In this header file the class AliEventShapeCalculator is declared.
+ * It computes transverse event shape variables (spherocity, thrust and sphericity)
+ * from the transverse momenta of the selected particles.
+ */
+#ifndef ALIEVENTSHAPECALCULATOR_H
+#define ALIEVENTSHAPECALCULATOR_H
+
+/* Copyright(c) 1998-2016, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#include <vector>
+
+#include <Rtypes.h>
+
+/**
+ * \class AliEventShapeCalculator
+ * \brief Transverse event shape variables of a set of particles.
+ *
+ * The transverse momenta of the selected particles are added once per event
+ * (AddParticle(), AddParticlePtPhi()); the event shape variables are then computed
+ * from these flat arrays:
+ * - spherocity \f$ S_{0} = \frac{\pi^{2}}{4} \min_{\hat{n}} \left( \frac{\sum_{i} |\vec{p}_{T,i} \times \hat{n}|}{\sum_{i} p_{T,i}} \right)^{2} \f$
+ * - thrust \f$ T = \max_{\hat{n}} \frac{\sum_{i} |\vec{p}_{T,i} \cdot \hat{n}|}{\sum_{i} p_{T,i}} \f$
+ * - sphericity \f$ S_{T} = \frac{2 \lambda_{2}}{\lambda_{1} + \lambda_{2}} \f$ of the linearised
+ *   transverse momentum tensor \f$ S_{ab} = \frac{1}{\sum_{i} p_{T,i}} \sum_{i} \frac{p_{a,i} p_{b,i}}{p_{T,i}} \f$
+ *
+ * Spherocity and thrust are minimised / maximised exactly: the spherocity axis is parallel to one of
+ * the particles and the thrust axis is parallel to the sum of the momenta in a half plane. Both only
+ * need the O(N) half planes starting at a particle, which are obtained from a sweep over the particles
+ * sorted in azimuth (O(N log N)).
+ *
+ * GetSpherocityGrid() instead scans a grid of axes with a fixed step size, reproducing bit by bit the
+ * results of the step based implementations used so far in the analysis code.
+ */
+class AliEventShapeCalculator {
+public:
+  /// Arithmetic of the grid scan (see GetSpherocityGrid())
+  enum EGridArithmetic_t {
+    kFloat,          ///< Single precision, minimum of \f$ (\sum |p_{T} \times n| / \sum p_{T})^{2} \f$
+    kDouble,         ///< Double precision, minimum of \f$ (\sum |p_{T} \times n| / \sum p_{T})^{2} \f$
+    kDoubleSquares   ///< Double precision, minimum of \f$ (\sum |p_{T} \times n|)^{2} / (\sum p_{T})^{2} \f$
+  };
+
+  AliEventShapeCalculator();
+  virtual ~AliEventShapeCalculator() {}
+
+  void     Clear();
+  void     AddParticle(Double_t px, Double_t py);
+  void     AddParticle(Double_t px, Double_t py, Double_t pt);
+  void     AddParticlePtPhi(Double_t pt, Double_t phi);
+
+  Int_t    GetNParticles()                                      const { return fPx.size(); }
+  Double_t GetSumPt()                                           const { return fSumPt    ; }
+
+  Double_t GetSpherocity(Double_t *phiAxis = 0)                 const;
+  Double_t GetThrust(Double_t *phiAxis = 0)                     const;
+  Double_t GetSphericity()                                      const;
+  Double_t GetSpherocityGrid(Double_t stepDeg, EGridArithmetic_t arithmetic = kDouble, Double_t *phiAxis = 0) const;
+
+private:
+  void     Sweep(Double_t &minCross, Double_t &phiCross, Double_t &maxDot, Double_t &phiDot) const;
+
+  std::vector<Double_t>       fPx;          ///< x component of the transverse momenta
+  std::vector<Double_t>       fPy;          ///< y component of the transverse momenta
+  std::vector<Double_t>       fPt;          ///< Transverse momenta
+  Double_t                    fSumPt;       ///< Sum of the transverse momenta
+
+  ClassDef(AliEventShapeCalculator, 1); // Transverse event shape variables
+};
+
+#endif /* ALIEVENTSHAPECALCULATOR_H */
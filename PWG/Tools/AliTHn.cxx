@@ -282,9 +282,9 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
 }
 
 template <class TemplateArray, typename TemplateType>
-void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+Long64_t AliTHnT<TemplateArray, TemplateType>::GetFillBinIndex(const Double_t *var)
 {
-  // fills an entry
+  // calculates the global bin index of an entry (-1 if outside of the axis ranges)
 
   // fill axis cache
   if (!axisCache)
@@ -327,13 +327,25 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 
     // under/overflow not supported
     if (tmpBin < 1 || tmpBin > fNbinsCache[i])
-      return;
+      return -1;
     
     // bins start from 0 here
     bin += tmpBin - 1;
 //     Printf("%lld", bin);
   }
 
+  return bin;
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
+{
+  // fills an entry
+
+  Long64_t bin = GetFillBinIndex(var);
+  if (bin < 0)
+    return;
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -360,6 +372,37 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //   AliCFContainer::Fill(var, istep, weight);
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight, Double_t weight2)
+{
+  // adds several entries to one bin at once:
+  // weight is the sum of their weights, weight2 the sum of their squared weights
+
+  Long64_t bin = GetFillBinIndex(var);
+  if (bin < 0)
+    return;
+
+  if (!fValues[istep])
+  {
+    fValues[istep] = new TemplateArray(fNBins);
+    AliInfo(Form("Created values container for step %d", istep));
+  }
+
+  if (weight2 != weight)
+  {
+    // as above: entries with unit weights have sum of weights == sum of squared weights
+    if (!fSumw2[istep])
+    {
+      fSumw2[istep] = new TemplateArray(*fValues[istep]);
+      AliInfo(Form("Created sumw2 container for step %d", istep));
+    }
+  }
+
+  fValues[istep]->GetArray()[bin] += weight;
+  if (fSumw2[istep])
+    fSumw2[istep]->GetArray()[bin] += weight2;
+}
+
 template <class TemplateArray, typename TemplateType>
 Long64_t AliTHnT<TemplateArray, TemplateType>::GetGlobalBinIndex(const Int_t* binIdx)
 {
@@ -26,6 +26,7 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void Fill(const Double_t *var, Int_t istep, Double_t weight, Double_t weight2) = 0;
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -48,6 +49,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void Fill(const Double_t *var, Int_t istep, Double_t weight, Double_t weight2) ;
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -66,6 +68,7 @@ class AliTHnT : public AliTHnBase
 protected:
   void Init();
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
+  Long64_t GetFillBinIndex(const Double_t *var);
   
   Long64_t fNBins;   // number of total bins
   Int_t    fNVars;   // number of variables
@@ -41,6 +41,7 @@ AliJFFlucAnalysis::AliJFFlucAnalysis()
 	fCBin(0),
 	fEffMode(0),
 	fEffFilterBit(0),
+	fCorrelator(kNQSub,kNH-1,nKL-1),
 	fHMG(0),
 	fBin_Subset(),
 	fBin_h(),
@@ -85,6 +86,7 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const char *name)
 	fCBin(0),
 	fEffMode(0),
 	fEffFilterBit(0),
+	fCorrelator(kNQSub,kNH-1,nKL-1),
 	fHMG(0),
 	fBin_Subset(),
 	fBin_h(),
@@ -138,6 +140,7 @@ AliJFFlucAnalysis::AliJFFlucAnalysis(const AliJFFlucAnalysis& a):
 	fCBin(a.fCBin),
 	fEffMode(a.fEffMode),
 	fEffFilterBit(a.fEffFilterBit),
+	fCorrelator(kNQSub,kNH-1,nKL-1),
 	fHMG(a.fHMG),
 	fBin_Subset(a.fBin_Subset),
 	fBin_h(a.fBin_h),
@@ -350,6 +353,49 @@ void AliJFFlucAnalysis::UserCreateOutputObjects(){
 	fHMG->Print();
 	fHMG->WriteConfig();
 
+	InitCorrelators();
+}
+//________________________________________________________________________
+void AliJFFlucAnalysis::InitCorrelators(){
+	// register the SC/AC correlators, evaluated together once per event in CalculateQvectorsQC
+	// gap correlators: harmonics a from subevent i, b from subevent 1-i, Q_i(a)*conj(Q_1-i(b))
+	const Int_t zero[4] = {0,0,0,0};
+	const Int_t threeGap[kNThreeGap][3] = {{4,2,2},{5,2,3},{6,3,3},{6,2,4},{7,2,5},{7,3,4}};
+	const Int_t fourGap13[kNFourGap13][4] = {{6,2,2,2},{7,2,2,3},{8,2,3,3}};
+	for(UInt_t i = 0; i < 2; ++i){
+		fIdxRef[i][kRef2p] = fCorrelator.AddGap(i,1,zero,1-i,1,zero);
+		fIdxRef[i][kRef3p] = fCorrelator.AddGap(i,1,zero,1-i,2,zero);
+		fIdxRef[i][kRef4p] = fCorrelator.AddGap(i,2,zero,1-i,2,zero);
+		fIdxRef[i][kRef4pB] = fCorrelator.AddGap(i,1,zero,1-i,3,zero);
+		fIdxRef[i][kRef6p] = fCorrelator.AddGap(i,3,zero,1-i,3,zero);
+		for(int ih=2; ih<kNH; ih++){
+			fIdxTwoGap[i][ih] = fCorrelator.AddGap(i,1,&ih,1-i,1,&ih);
+			for(int ihh=2; ihh<kNH; ihh++){
+				const Int_t h22[2] = {ih,ihh};
+				const Int_t h33[2][3] = {{ih,ihh,ihh},{ih,ih,ihh}};
+				fIdxFourGap22[i][ih][ihh] = fCorrelator.AddGap(i,2,h22,1-i,2,h22);
+				for(int j=0; j<2; j++)
+					fIdxSixGap33[i][ih][ihh][j] = fCorrelator.AddGap(i,3,h33[j],1-i,3,h33[j]);
+			}
+		}
+		for(int j=0; j<kNThreeGap; j++)
+			fIdxThreeGap[i][j] = fCorrelator.AddGap(i,1,threeGap[j],1-i,2,threeGap[j]+1);
+		for(int j=0; j<kNFourGap13; j++)
+			fIdxFourGap13[i][j] = fCorrelator.AddGap(i,1,fourGap13[j],1-i,3,fourGap13[j]+1);
+	}
+
+	// no gap
+	fIdxTwoRef = fCorrelator.Add(kSubFull,2,zero);
+	fIdxFourRef = fCorrelator.Add(kSubFull,4,zero);
+	for(int ih=2; ih<kNH; ih++){
+		const Int_t h2[2] = {ih,-ih};
+		fIdxTwo[ih] = fCorrelator.Add(kSubFull,2,h2);
+		for(int ihh=2; ihh<ih; ihh++){
+			const Int_t h4[4] = {ih,ihh,-ih,-ihh};
+			fIdxFour[ih][ihh] = fCorrelator.Add(kSubFull,4,h4);
+		}
+	}
+	AliInfo(Form("%u correlators from %u terms, harmonics up to %u",fCorrelator.GetNCorrelators(),fCorrelator.GetNNodes(),fCorrelator.GetMaxHarmonic()));
 }
 
 //________________________________________________________________________
@@ -361,28 +407,6 @@ AliJFFlucAnalysis::~AliJFFlucAnalysis() {
 
 #define A i
 #define B (1-i)
-#define C(u) TComplex::Conjugate(u)
-//TODO: conjugate macro
-inline TComplex TwoGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b){
-	return pQq[A][a][1]*C(pQq[B][b][1]);
-}
-
-inline TComplex ThreeGap(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]-pQq[B][b+c][2]);
-}
-
-inline TComplex FourGap22(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a+b][2]*C(pQq[B][c][1]*pQq[B][d][1])-pQq[A][a][1]*pQq[A][b][1]*C(pQq[B][c+d][2])+pQq[A][a+b][2]*C(pQq[B][c+d][2]);
-}
-
-inline TComplex FourGap13(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint a, uint b, uint c, uint d){
-	return pQq[A][a][1]*C(pQq[B][b][1]*pQq[B][c][1]*pQq[B][d][1]-pQq[B][b+c][2]*pQq[B][d][1]-pQq[B][b+d][2]*pQq[B][c][1]-pQq[B][c+d][2]*pQq[B][b][1]+2.0*pQq[B][b+c+d][3]);
-}
-
-inline TComplex SixGap33(const TComplex (*pQq)[AliJFFlucAnalysis::kNH][AliJFFlucAnalysis::nKL], uint i, uint n1, uint n2, uint n3, uint n4, uint n5, uint n6){
-	return pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+2.0*pQq[A][n1][1]*pQq[A][n2][1]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n2][2]*pQq[A][n3][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n1+n3][2]*pQq[A][n2][1]*C(pQq[B][n4+n5+n6][3])-pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])+pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])-2.0*pQq[A][n2+n3][2]*pQq[A][n1][1]*C(pQq[B][n4+n5+n6][3])+2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4][1]*pQq[B][n5][1]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5][2]*pQq[B][n6][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n6][2]*pQq[B][n5][1])-2.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n5+n6][2]*pQq[B][n4][1])+4.0*pQq[A][n1+n2+n3][3]*C(pQq[B][n4+n5+n6][3]);
-}
-#undef C
 
 //________________________________________________________________________
 void AliJFFlucAnalysis::UserExec(Option_t *) {
@@ -432,15 +456,19 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	TComplex ncorr[kNH][nKL];
 	TComplex ncorr2[kNH][nKL][kNH][nKL];
 
-	const TComplex (*pQq)[kNH][nKL] = QvectorQCeta10;
+	// power 1 flow vectors of the two eta gap subevents
+	TComplex pQq[2][kNH];
+	for(int isub = 0; isub < 2; ++isub)
+		for(int ih = 0; ih < kNH; ++ih)
+			pQq[isub][ih] = fCorrelator.GetQ(isub,ih,1);
 
 	for(int i = 0; i < 2; ++i){
 		//Double_t ref_2p = N[i][0]*N[i][1];//TwoGap(pQq,i,0,0).Re();
-		Double_t ref_2p = TwoGap(pQq,i,0,0).Re();
-		Double_t ref_3p = ThreeGap(pQq,i,0,0,0).Re();
-		Double_t ref_4p = FourGap22(pQq,i,0,0,0,0).Re();
-		Double_t ref_4pB = FourGap13(pQq,i,0,0,0,0).Re();
-		Double_t ref_6p = SixGap33(pQq,i,0,0,0,0,0,0).Re();
+		Double_t ref_2p = fCorrelator.GetCorrelatorRe(fIdxRef[i][kRef2p]);
+		Double_t ref_3p = fCorrelator.GetCorrelatorRe(fIdxRef[i][kRef3p]);
+		Double_t ref_4p = fCorrelator.GetCorrelatorRe(fIdxRef[i][kRef4p]);
+		Double_t ref_4pB = fCorrelator.GetCorrelatorRe(fIdxRef[i][kRef4pB]);
+		Double_t ref_6p = fCorrelator.GetCorrelatorRe(fIdxRef[i][kRef6p]);
 
 		Double_t ebe_2p_weight = 1.0;
 		Double_t ebe_3p_weight = 1.0;
@@ -467,30 +495,30 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		if(flags & FLUC_EBE_WEIGHTING){
 			for(int ik=3; ik<2*nKL; ik++){
 				double dk = (double)ik;
-				ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
-				ebe_2Np_weight[ik] = ebe_2Np_weight[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
+				ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0].Re()-dk,1.0)*max(pQq[B][0].Re()-dk,1.0);
+				ebe_2Np_weight[ik] = ebe_2Np_weight[ik-1]*max(pQq[A][0].Re()-dk,1.0)*max(pQq[B][0].Re()-dk,1.0);
 			}
 		}else for(int ik=3; ik<2*nKL; ik++){
 			double dk = (double)ik;
-			ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0][1].Re()-dk,1.0)*max(pQq[B][0][1].Re()-dk,1.0);
+			ref_2Np[ik] = ref_2Np[ik-1]*max(pQq[A][0].Re()-dk,1.0)*max(pQq[B][0].Re()-dk,1.0);
 			ebe_2Np_weight[ik] = 1.0;
 		}
 
 		for(int ih=2; ih<kNH; ih++){
 			//corr[ih][1] = pQn[i][0][ih]*pQn[i][1][ih]*N[i][0]*N[i][1];//QnA[ih]*QnB_star[ih];
-			corr[ih][1] = TwoGap(pQq,i,ih,ih);
+			corr[ih][1] = fCorrelator.GetCorrelator(fIdxTwoGap[i][ih]);
 			for(int ik=2; ik<nKL; ik++)
 				corr[ih][ik] = corr[ih][ik-1]*corr[ih][1];//TComplex::Power(corr[ih][1],ik);
 			ncorr[ih][1] = corr[ih][1];
-			ncorr[ih][2] = FourGap22(pQq,i,ih,ih,ih,ih);//mf*(corr[ih][2]*N[i][0]*N[i][1]-pQn[i][1][2*ih]*pQn[i][0][ih]*pQn[i][0][ih]*N[i][0]-pQn[i][0][2*ih]*pQn[i][1][ih]*pQn[i][1][ih]*N[i][1]+pQn[i][1][2*ih]*pQn[i][0][2*ih]);
-			ncorr[ih][3] = SixGap33(pQq,i,ih,ih,ih,ih,ih,ih);
+			ncorr[ih][2] = fCorrelator.GetCorrelator(fIdxFourGap22[i][ih][ih]);//mf*(corr[ih][2]*N[i][0]*N[i][1]-pQn[i][1][2*ih]*pQn[i][0][ih]*pQn[i][0][ih]*N[i][0]-pQn[i][0][2*ih]*pQn[i][1][ih]*pQn[i][1][ih]*N[i][1]+pQn[i][1][2*ih]*pQn[i][0][2*ih]);
+			ncorr[ih][3] = fCorrelator.GetCorrelator(fIdxSixGap33[i][ih][ih][0]);
 			for(int ik=4; ik<nKL; ik++)
 				ncorr[ih][ik] = corr[ih][ik]; //for 8,...-particle correlations, ignore the autocorrelation / weight dependency for now
 
 			for(int ihh=2; ihh<kNH; ihh++){
-				ncorr2[ih][1][ihh][1] = FourGap22(pQq,i,ih,ihh,ih,ihh);
-				ncorr2[ih][1][ihh][2] = SixGap33(pQq,i,ih,ihh,ihh,ih,ihh,ihh);
-				ncorr2[ih][2][ihh][1] = SixGap33(pQq,i,ih,ih,ihh,ih,ih,ihh);
+				ncorr2[ih][1][ihh][1] = fCorrelator.GetCorrelator(fIdxFourGap22[i][ih][ihh]);
+				ncorr2[ih][1][ihh][2] = fCorrelator.GetCorrelator(fIdxSixGap33[i][ih][ihh][0]);
+				ncorr2[ih][2][ihh][1] = fCorrelator.GetCorrelator(fIdxSixGap33[i][ih][ihh][1]);
 				for(int ik=2; ik<nKL; ik++)
 					for(int ikk=2; ikk<nKL; ikk++)
 						ncorr2[ih][ik][ihh][ikk] = ncorr[ih][ik]*ncorr[ihh][ikk];
@@ -513,44 +541,44 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		}
 
 		//************************************************************************
-		TComplex V4V2star_2 = pQq[A][4][1] * pQq[B][2][1] * pQq[B][2][1];
+		TComplex V4V2star_2 = pQq[A][4] * pQq[B][2] * pQq[B][2];
 		TComplex V4V2starv2_2 =	V4V2star_2 * corr[2][1]/ref_2Np[0];//vn[2][1]
 		TComplex V4V2starv2_4 = V4V2star_2 * corr[2][2]/ref_2Np[1];//vn2[2][2]
-		TComplex V5V2starV3starv2_2 = pQq[A][5][1] * pQq[B][2][1] * pQq[B][3][1] * corr[2][1]/ref_2Np[0]; //vn2[2][1]
-		TComplex V5V2starV3star = pQq[A][5][1] * pQq[B][2][1] * pQq[B][3][1];
+		TComplex V5V2starV3starv2_2 = pQq[A][5] * pQq[B][2] * pQq[B][3] * corr[2][1]/ref_2Np[0]; //vn2[2][1]
+		TComplex V5V2starV3star = pQq[A][5] * pQq[B][2] * pQq[B][3];
 		TComplex V5V2starV3startv3_2 = V5V2starV3star * corr[3][1]/ref_2Np[0]; //vn2[3][1]
-		TComplex V6V2star_3 = pQq[A][6][1] * pQq[B][2][1] * pQq[B][2][1] * pQq[B][2][1];
-		TComplex V6V3star_2 = pQq[A][6][1] * pQq[B][3][1] * pQq[B][3][1];
-		TComplex V6V2starV4star = pQq[A][6][1] * pQq[B][2][1] * pQq[B][4][1];
-		TComplex V7V2star_2V3star = pQq[A][7][1] * pQq[B][2][1] * pQq[B][2][1] * pQq[B][3][1];
-		TComplex V7V2starV5star = pQq[A][7][1] * pQq[B][2][1] * pQq[B][5][1];
-		TComplex V7V3starV4star = pQq[A][7][1] * pQq[B][3][1] * pQq[B][4][1];
-		TComplex V8V2starV3star_2 = pQq[A][8][1] * pQq[B][2][1] * pQq[B][3][1] * pQq[B][3][1];
-		TComplex V8V2star_4 = pQq[A][8][1] * TComplex::Power(pQq[B][2][1],4);
+		TComplex V6V2star_3 = pQq[A][6] * pQq[B][2] * pQq[B][2] * pQq[B][2];
+		TComplex V6V3star_2 = pQq[A][6] * pQq[B][3] * pQq[B][3];
+		TComplex V6V2starV4star = pQq[A][6] * pQq[B][2] * pQq[B][4];
+		TComplex V7V2star_2V3star = pQq[A][7] * pQq[B][2] * pQq[B][2] * pQq[B][3];
+		TComplex V7V2starV5star = pQq[A][7] * pQq[B][2] * pQq[B][5];
+		TComplex V7V3starV4star = pQq[A][7] * pQq[B][3] * pQq[B][4];
+		TComplex V8V2starV3star_2 = pQq[A][8] * pQq[B][2] * pQq[B][3] * pQq[B][3];
+		TComplex V8V2star_4 = pQq[A][8] * TComplex::Power(pQq[B][2],4);
 
 		// New correlators (Modified by You's correction term for self-correlations)
 		//double nf = 1.0/(N[i][1]-1.0);
 		///double ef = nf/(N[i][1]-2.0);
-		TComplex nV4V2star_2 = ThreeGap(pQq,i,4,2,2)/ref_3p;//V4V2_star2-pQq[i][A][4][1]*pQq[i][B][4][2]; //nf*( V4V2star_2*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );
+		TComplex nV4V2star_2 = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap422])/ref_3p;//V4V2_star2-pQq[i][A][4][1]*pQq[i][B][4][2]; //nf*( V4V2star_2*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );
 		//TComplex nV4V2star_2 = nf*( pQn[i][0][4]*pQn[i][1][2]*pQn[i][1][2]*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );//nf*( V4V2star_2*N[i][1] - pQn[i][0][4]*pQn[i][1][4] );
-		TComplex nV5V2starV3star = ThreeGap(pQq,i,5,2,3)/ref_3p;//V5V2starV3star-pQq[i][A][5][1]*pQq[i][B][5][2]; //nf*( V5V2starV3star*N[i][1] - pQn[i][0][5]*pQn[i][1][5] );
-		TComplex nV6V2star_3 = FourGap13(pQq,i,6,2,2,2)/ref_4pB;//V6V2star_3-pQq[i][A][6][2]*pQq[i][B][4][2]*pQq[i][B][2][1]- //pQn[i][0][6]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][2]*N[i][1]*N[i][1] - 3.0*pQn[i][1][2]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][6] );
-		TComplex nV6V3star_2 = ThreeGap(pQq,i,6,3,3)/ref_3p;//nf*(V6V3star_2*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
-		TComplex nV6V2starV4star = ThreeGap(pQq,i,6,2,4)/ref_3p;//nf*(V6V2starV4star*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
-		TComplex nV7V2star_2V3star = FourGap13(pQq,i,7,2,2,3)/ref_4pB;//pQn[i][0][7]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][2]*pQn[i][1][5]*N[i][1] - pQn[i][1][3]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][7] );
-		TComplex nV7V2starV5star = ThreeGap(pQq,i,7,2,5)/ref_3p;//nf*(V7V2starV5star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
-		TComplex nV7V3starV4star = ThreeGap(pQq,i,7,3,4)/ref_3p;//nf*(V7V3starV4star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
-		TComplex nV8V2starV3star_2 = FourGap13(pQq,i,8,2,3,3)/ref_4pB;//pQn[i][0][8]*ef*( pQn[i][1][2]*pQn[i][1][3]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][3]*pQn[i][1][5]*N[i][1] - pQn[i][1][2]*pQn[i][1][6]*N[i][1] + 2.0*pQn[i][1][8] );
-
-		TComplex nV4V4V2V2 = FourGap22(pQq,i,4,2,4,2)/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][6] * pQn[i][0][4] *pQn[i][0][2] ))
+		TComplex nV5V2starV3star = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap523])/ref_3p;//V5V2starV3star-pQq[i][A][5][1]*pQq[i][B][5][2]; //nf*( V5V2starV3star*N[i][1] - pQn[i][0][5]*pQn[i][1][5] );
+		TComplex nV6V2star_3 = fCorrelator.GetCorrelator(fIdxFourGap13[i][kFourGap6222])/ref_4pB;//V6V2star_3-pQq[i][A][6][2]*pQq[i][B][4][2]*pQq[i][B][2][1]- //pQn[i][0][6]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][2]*N[i][1]*N[i][1] - 3.0*pQn[i][1][2]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][6] );
+		TComplex nV6V3star_2 = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap633])/ref_3p;//nf*(V6V3star_2*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
+		TComplex nV6V2starV4star = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap624])/ref_3p;//nf*(V6V2starV4star*N[i][1] - pQn[i][0][6]*pQn[i][1][6]);
+		TComplex nV7V2star_2V3star = fCorrelator.GetCorrelator(fIdxFourGap13[i][kFourGap7223])/ref_4pB;//pQn[i][0][7]*ef*( pQn[i][1][2]*pQn[i][1][2]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][2]*pQn[i][1][5]*N[i][1] - pQn[i][1][3]*pQn[i][1][4]*N[i][1] + 2.0*pQn[i][1][7] );
+		TComplex nV7V2starV5star = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap725])/ref_3p;//nf*(V7V2starV5star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
+		TComplex nV7V3starV4star = fCorrelator.GetCorrelator(fIdxThreeGap[i][kThreeGap734])/ref_3p;//nf*(V7V3starV4star*N[i][1] - pQn[i][0][7]*pQn[i][1][7]);
+		TComplex nV8V2starV3star_2 = fCorrelator.GetCorrelator(fIdxFourGap13[i][kFourGap8233])/ref_4pB;//pQn[i][0][8]*ef*( pQn[i][1][2]*pQn[i][1][3]*pQn[i][1][3]*N[i][1]*N[i][1] - 2.0*pQn[i][1][3]*pQn[i][1][5]*N[i][1] - pQn[i][1][2]*pQn[i][1][6]*N[i][1] + 2.0*pQn[i][1][8] );
+
+		TComplex nV4V4V2V2 = fCorrelator.GetCorrelator(fIdxFourGap22[i][4][2])/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][6] * pQn[i][0][4] *pQn[i][0][2] ))
 			//- ((1/(N[i][0]-1) * pQn[i][0][6]*pQn[i][1][4] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][6]*pQn[i][1][6] );
-		TComplex nV3V3V2V2 = FourGap22(pQq,i,3,2,3,2)/ref_4p;//(pQn[i][0][3]*pQn[i][1][3]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][5] * pQn[i][0][3] *pQn[i][0][2] ))
+		TComplex nV3V3V2V2 = fCorrelator.GetCorrelator(fIdxFourGap22[i][3][2])/ref_4p;//(pQn[i][0][3]*pQn[i][1][3]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][5] * pQn[i][0][3] *pQn[i][0][2] ))
 			//- ((1/(N[i][0]-1) * pQn[i][0][5]*pQn[i][1][3] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][5]*pQn[i][1][5] );
-		TComplex nV5V5V2V2 = FourGap22(pQq,i,5,2,5,2)/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][5] *pQn[i][0][2] ))
+		TComplex nV5V5V2V2 = fCorrelator.GetCorrelator(fIdxFourGap22[i][5][2])/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][2]*pQn[i][1][2]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][5] *pQn[i][0][2] ))
 			//- ((1/(N[i][0]-1) * pQn[i][0][7]*pQn[i][1][5] * pQn[i][1][2])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][7]*pQn[i][1][7] );
-		TComplex nV5V5V3V3 = FourGap22(pQq,i,5,3,5,3)/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][8] * pQn[i][0][5] *pQn[i][0][3] ))
+		TComplex nV5V5V3V3 = fCorrelator.GetCorrelator(fIdxFourGap22[i][5][3])/ref_4p;//(pQn[i][0][5]*pQn[i][1][5]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][8] * pQn[i][0][5] *pQn[i][0][3] ))
 			//- ((1/(N[i][0]-1) * pQn[i][0][8]*pQn[i][1][5] * pQn[i][1][3])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][8]*pQn[i][1][8] );
-		TComplex nV4V4V3V3 = FourGap22(pQq,i,4,3,4,3)/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][4] *pQn[i][0][3] ))
+		TComplex nV4V4V3V3 = fCorrelator.GetCorrelator(fIdxFourGap22[i][4][3])/ref_4p;//(pQn[i][0][4]*pQn[i][1][4]*pQn[i][0][3]*pQn[i][1][3]) - ((1/(N[i][1]-1) * pQn[i][1][7] * pQn[i][0][4] *pQn[i][0][3] ))
 			//- ((1/(N[i][0]-1) * pQn[i][0][7]*pQn[i][1][4] * pQn[i][1][3])) + (1/((N[i][0]-1)*(N[i][1]-1))*pQn[i][0][7]*pQn[i][1][7] );
 
 		fh_correlator[0][fCBin]->Fill( V4V2starv2_2.Re() );
@@ -594,14 +622,14 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 	Double_t event_weight_two = 1.0;
 	Double_t event_weight_two_eta10 = 1.0;
 	if(flags & FLUC_EBE_WEIGHTING){
-		event_weight_four = Four(0,0,0,0).Re();
-		event_weight_two = Two(0,0).Re();
-		event_weight_two_eta10 = (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		event_weight_four = fCorrelator.GetCorrelatorRe(fIdxFourRef);
+		event_weight_two = fCorrelator.GetCorrelatorRe(fIdxTwoRef);
+		event_weight_two_eta10 = fCorrelator.GetCorrelatorRe(fIdxRef[kSubA][kRef2p]);
 	}
 
 	for(int ih=2; ih < kNH; ih++){
 		for(int ihh=2; ihh<ih; ihh++){
-			TComplex scfour = Four( ih, ihh, -ih, -ihh ) / Four(0,0,0,0).Re();
+			TComplex scfour = fCorrelator.GetCorrelator(fIdxFour[ih][ihh]) / fCorrelator.GetCorrelatorRe(fIdxFourRef);
 			
 			fh_SC_with_QC_4corr[ih][ihh][fCBin]->Fill( scfour.Re(), event_weight_four );
 			//QC_4p_value[ih][ihh] = scfour.Re();
@@ -612,13 +640,13 @@ void AliJFFlucAnalysis::UserExec(Option_t *) {
 		// two(2,2) = Q2 Q2* - Q0 = Q2Q2* - M
 		// two(0,0) = Q0 Q0* - Q0 = M^2 - M
 		//two[ih] = Two(ih, -ih) / Two(0,0).Re();
-		TComplex sctwo = Two(ih, -ih) / Two(0,0).Re();
+		TComplex sctwo = fCorrelator.GetCorrelator(fIdxTwo[ih]) / fCorrelator.GetCorrelatorRe(fIdxTwoRef);
 		fh_SC_with_QC_2corr[ih][fCBin]->Fill( sctwo.Re(), event_weight_two );
 		//QC_2p_value[ih] = sctwo.Re();
 		// fill single vn  with QC without EtaGap as method 2
 		fSingleVn[ih][2] = TMath::Sqrt(sctwo.Re());
 		
-		TComplex sctwo10 = (QvectorQCeta10[kSubA][ih][1]*TComplex::Conjugate(QvectorQCeta10[kSubB][ih][1])) / (QvectorQCeta10[kSubA][0][1]*QvectorQCeta10[kSubB][0][1]).Re();
+		TComplex sctwo10 = fCorrelator.GetCorrelator(fIdxTwoGap[kSubA][ih]) / fCorrelator.GetCorrelatorRe(fIdxRef[kSubA][kRef2p]);
 		fh_SC_with_QC_2corr_eta10[ih][fCBin]->Fill( sctwo10.Re(), event_weight_two_eta10 );
 		// fill single vn with QC method with Eta Gap as method 1
 		fSingleVn[ih][1] = TMath::Sqrt(sctwo10.Re());
@@ -845,14 +873,7 @@ TComplex AliJFFlucAnalysis::Get_Qn_pt(Double_t eta1, Double_t eta2, int harmonic
 void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 	// calcualte Q-vector for QC method ( no subgroup )
 	//init
-	for(int ih=0; ih<kNH; ih++){
-		for(int ik=0; ik<nKL; ++ik){
-			QvectorQC[ih][ik] = TComplex(0,0);
-			for(int isub=0; isub<2; isub++){
-				QvectorQCeta10[isub][ih][ik] = TComplex(0,0);
-			}
-		}
-	} // for max harmonics
+	fCorrelator.Reset();
 	//Calculate Q-vector with particle loop
 	Long64_t ntracks = fInputList->GetEntriesFast(); // all tracks from Task input
 	for( Long64_t it=0; it<ntracks; it++){
@@ -883,46 +904,31 @@ void AliJFFlucAnalysis::CalculateQvectorsQC(double etamin, double etamax){
 		}
 		Double_t effCorr = fEfficiency->GetCorrection( pt, fEffFilterBit, fCent);
 
-		for(int ih=0; ih<kNH; ih++){
-			Double_t tf = 1.0;
-			TComplex q[nKL];
-			for(int ik=0; ik<nKL; ik++){
-				q[ik] = TComplex(tf*TMath::Cos(ih*phi),tf*TMath::Sin(ih*phi));
-				QvectorQC[ih][ik] += q[ik];
-
-				//this is for normalized SC ( denominator needs an eta gap )
-				if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
-					QvectorQCeta10[isub][ih][ik] += q[ik];
-
-				tf *= 1.0/(phi_module_corr*effCorr);
-			}
-		}
+		Double_t weight = 1.0/(phi_module_corr*effCorr);
+		fCorrelator.Fill(kSubFull,phi,weight);
+		//this is for normalized SC ( denominator needs an eta gap )
+		if(TMath::Abs(eta) > etamin)//fQC_eta_gap_half)
+			fCorrelator.Fill(isub,phi,weight);
 	} // track loop done.
+	fCorrelator.Evaluate();
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Q(int n, int p){
 	// Return QvectorQC
 	// Q{-n, p} = Q{n, p}*
-	if(n >= 0)
-		return QvectorQC[n][p];
-	return TComplex::Conjugate(QvectorQC[-n][p]);
+	return fCorrelator.GetQ(kSubFull,n,p);
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Two(int n1, int n2 ){
 	// two-particle correlation <exp[i(n1*phi1 + n2*phi2)]>
-	//	cout << "TWO FUNCTION " << Q(n1,1) << "*" << Q(n2,1) << " - " << Q(n1+n2 , 2) << endl;
-	TComplex two = Q(n1, 1) * Q(n2, 1) - Q( n1+n2, 2);
-	return two;
+	// = Q(n1,1)*Q(n2,1) - Q(n1+n2,2)
+	Int_t h[2] = {n1, n2};
+	return fCorrelator.Compute(kSubFull,2,h);
 }
 //________________________________________________________________________
 TComplex AliJFFlucAnalysis::Four( int n1, int n2, int n3, int n4){
-	TComplex four =
-		Q(n1,1)*Q(n2,1)*Q(n3,1)*Q(n4,1)-Q(n1+n2,2)*Q(n3,1)*Q(n4,1)-Q(n2,1)*Q(n1+n3,2)*Q(n4,1)
-		- Q(n1,1)*Q(n2+n3,2)*Q(n4,1)+2.*Q(n1+n2+n3,3)*Q(n4,1)-Q(n2,1)*Q(n3,1)*Q(n1+n4,2)
-		+ Q(n2+n3,2)*Q(n1+n4,2)-Q(n1,1)*Q(n3,1)*Q(n2+n4,2)+Q(n1+n3,2)*Q(n2+n4,2)
-		+ 2.*Q(n3,1)*Q(n1+n2+n4,3)-Q(n1,1)*Q(n2,1)*Q(n3+n4,2)+Q(n1+n2,2)*Q(n3+n4,2)
-		+ 2.*Q(n2,1)*Q(n1+n3+n4,3)+2.*Q(n1,1)*Q(n2+n3+n4,3)-6.*Q(n1+n2+n3+n4,4);
-	return four;
+	Int_t h[4] = {n1, n2, n3, n4};
+	return fCorrelator.Compute(kSubFull,4,h);
 }
 //__________________________________________________________________________
 /*void AliJFFlucAnalysis::SetPhiModuleHistos( int cent, int sub, TH1D *hModuledPhi){
@@ -8,6 +8,7 @@
 #include "AliJEfficiency.h"
 #include "AliJHistManager.h"
 #include "AliVVertex.h"
+#include "AliJMultiCorrelator.h"
 #include <TComplex.h>
 
 class TClonesArray;
@@ -122,8 +123,25 @@ private:
 	Double_t fQC_eta_cut_max;
 	Double_t fQC_eta_gap_half;
 
-	TComplex QvectorQC[kNH][nKL];
-	TComplex QvectorQCeta10[2][kNH][nKL]; // ksub
+	// flow vector subevents: eta<0 and eta>0 outside of the eta gap, full range
+	enum{kSubGap0, kSubGap1, kSubFull, kNQSub};
+	enum{kRef2p, kRef3p, kRef4p, kRef4pB, kRef6p, kNRef};
+	enum{kThreeGap422, kThreeGap523, kThreeGap633, kThreeGap624, kThreeGap725, kThreeGap734, kNThreeGap};
+	enum{kFourGap6222, kFourGap7223, kFourGap8233, kNFourGap13};
+	void InitCorrelators();
+
+	AliJMultiCorrelator fCorrelator;//! // flow vectors and all correlators of the event
+	// correlator indices, gap correlators for [isub of the non-conjugated harmonics]
+	Int_t fIdxRef[2][kNRef];//! // all harmonics 0, 2p:1+1, 3p:1+2, 4p:2+2, 4pB:1+3, 6p:3+3 particles
+	Int_t fIdxTwoGap[2][kNH];//! // (ih|ih)
+	Int_t fIdxFourGap22[2][kNH][kNH];//! // (ih,ihh|ih,ihh)
+	Int_t fIdxSixGap33[2][kNH][kNH][2];//! // (ih,ihh,ihh|ih,ihh,ihh), (ih,ih,ihh|ih,ih,ihh)
+	Int_t fIdxThreeGap[2][kNThreeGap];//! // (a|b,c)
+	Int_t fIdxFourGap13[2][kNFourGap13];//! // (a|b,c,d)
+	Int_t fIdxTwo[kNH];//! // no gap (ih,-ih)
+	Int_t fIdxTwoRef;//!
+	Int_t fIdxFour[kNH][kNH];//! // no gap (ih,ihh,-ih,-ihh)
+	Int_t fIdxFourRef;//!
 
 	//TH1D *h_phi_module[CENTN][2]; //7 // cent, isub
 
@@ -177,7 +195,7 @@ private:
 	//AliJTH1D fh_QvectorQCphi;//!
 	AliJTH1D fh_evt_SP_QC_ratio_2p;//! // check SP QC evt by evt ratio
 	AliJTH1D fh_evt_SP_QC_ratio_4p;//! // check SP QC evt by evt ratio
-	ClassDef(AliJFFlucAnalysis, 1); // example of analysis
+	ClassDef(AliJFFlucAnalysis, 2); // example of analysis
 };
 
 #endif
@@ -0,0 +1,279 @@
+/**************************************************************************
+ * Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+// Generic multi-particle correlators from flow vectors, see header
+
+#include <algorithm>
+#include <TMath.h>
+#include "AliJMultiCorrelator.h"
+
+ClassImp(AliJMultiCorrelator)
+
+//________________________________________________________________________
+AliJMultiCorrelator::AliJMultiCorrelator(UInt_t nsub, UInt_t maxHarmonic, UInt_t maxPower)
+	: fNSub(nsub),
+	fMaxHarmonic(maxHarmonic),
+	fMaxPower(maxPower),
+	fCompiled(kFALSE),
+	fQRe(),
+	fQIm(),
+	fWeightPowers(),
+	fNodeMap(),
+	fNodeFirst(),
+	fNodeRe(),
+	fNodeIm(),
+	fTermCoef(),
+	fTermSub(),
+	fTermHarmonic(),
+	fTermPower(),
+	fTermQ(),
+	fTermChild(),
+	fCorrMap(),
+	fCorrFirst(),
+	fCorrNode(),
+	fRe(),
+	fIm()
+{
+	// node 0 is the empty set, N({}) = 1
+	fNodeFirst.push_back(0);
+	fNodeFirst.push_back(0);
+	fCorrFirst.push_back(0);
+}
+
+//________________________________________________________________________
+Int_t AliJMultiCorrelator::Add(UInt_t sub, UInt_t m, const Int_t *harmonics){
+	// m-particle correlator of subevent sub
+	std::vector<Int_t> key;
+	key.push_back(sub);
+	key.push_back(m);
+	key.insert(key.end(),harmonics,harmonics+m);
+	return AddGroups(key);
+}
+
+//________________________________________________________________________
+Int_t AliJMultiCorrelator::AddGap(UInt_t subA, UInt_t mA, const Int_t *harmonicsA, UInt_t subB, UInt_t mB, const Int_t *harmonicsB){
+	// N_A(harmonicsA)*conj(N_B(harmonicsB)), mA particles from subevent subA and mB from subB
+	std::vector<Int_t> key;
+	key.push_back(subA);
+	key.push_back(mA);
+	key.insert(key.end(),harmonicsA,harmonicsA+mA);
+	key.push_back(subB);
+	key.push_back(mB);
+	for(UInt_t i = 0; i < mB; ++i)
+		key.push_back(-harmonicsB[i]);
+	return AddGroups(key);
+}
+
+//________________________________________________________________________
+Int_t AliJMultiCorrelator::AddGroups(const std::vector<Int_t> &key){
+	// key: (sub, m, harmonics[m]) for each group
+	std::vector<UInt_t> nodes;
+	std::vector<Int_t> skey;
+	for(UInt_t i = 0; i < key.size(); i += 2+key[i+1]){
+		std::vector<Int_t> h(key.begin()+i+2,key.begin()+i+2+key[i+1]);
+		std::sort(h.begin(),h.end());
+		skey.push_back(key[i]);
+		skey.push_back(key[i+1]);
+		skey.insert(skey.end(),h.begin(),h.end());
+		nodes.push_back(GetNode(key[i],h));
+	}
+	std::map<std::vector<Int_t>,Int_t>::const_iterator it = fCorrMap.find(skey);
+	if(it != fCorrMap.end())
+		return it->second;
+
+	Int_t ic = fRe.size();
+	fCorrNode.insert(fCorrNode.end(),nodes.begin(),nodes.end());
+	fCorrFirst.push_back(fCorrNode.size());
+	fRe.push_back(0.);
+	fIm.push_back(0.);
+	fCorrMap[skey] = ic;
+	return ic;
+}
+
+//________________________________________________________________________
+Int_t AliJMultiCorrelator::GetNode(UInt_t sub, std::vector<Int_t> &harmonics){
+	// node of the sorted harmonics of subevent sub, created with its sub-nodes if needed
+	if(harmonics.empty())
+		return 0;
+	if(sub >= fNSub)
+		fNSub = sub+1;
+	std::vector<Int_t> key(1,sub);
+	key.insert(key.end(),harmonics.begin(),harmonics.end());
+	std::map<std::vector<Int_t>,Int_t>::const_iterator it = fNodeMap.find(key);
+	if(it != fNodeMap.end())
+		return it->second;
+
+	// blocks containing the first particle: {0} + any subset of the others.
+	// Equal harmonics give identical terms, which are merged.
+	UInt_t m = harmonics.size();
+	std::map<std::vector<Int_t>,Double_t> terms; // (harmonic, power, child) -> coefficient
+	for(UInt_t mask = 0; mask < (1u<<(m-1)); ++mask){
+		Int_t n = harmonics[0];
+		UInt_t k = 1;
+		std::vector<Int_t> rest;
+		for(UInt_t j = 1; j < m; ++j){
+			if(mask & (1u<<(j-1))){
+				n += harmonics[j];
+				k++;
+			}else rest.push_back(harmonics[j]);
+		}
+		std::vector<Int_t> term(3);
+		term[0] = n;
+		term[1] = k;
+		term[2] = GetNode(sub,rest);
+		terms[term] += ((k%2 == 1)?1.0:-1.0)*TMath::Factorial(k-1);
+	}
+
+	// sub-nodes come first, so that Evaluate() is a single pass
+	for(std::map<std::vector<Int_t>,Double_t>::const_iterator jt = terms.begin(); jt != terms.end(); ++jt){
+		fTermCoef.push_back(jt->second);
+		fTermSub.push_back(sub);
+		fTermHarmonic.push_back(jt->first[0]);
+		fTermPower.push_back(jt->first[1]);
+		fTermChild.push_back(jt->first[2]);
+		fMaxHarmonic = TMath::Max(fMaxHarmonic,(UInt_t)TMath::Abs(jt->first[0]));
+		fMaxPower = TMath::Max(fMaxPower,(UInt_t)jt->first[1]);
+	}
+	Int_t node = fNodeFirst.size()-1;
+	fNodeFirst.push_back(fTermCoef.size());
+	fNodeMap[key] = node;
+	fCompiled = kFALSE;
+	return node;
+}
+
+//________________________________________________________________________
+void AliJMultiCorrelator::Compile(){
+	// size the Q table and resolve the Q indices of the terms
+	fQRe.assign(fNSub*(fMaxPower+1)*(2*fMaxHarmonic+1),0.);
+	fQIm.assign(fQRe.size(),0.);
+	fWeightPowers.assign(fMaxPower+1,1.);
+	fTermQ.resize(fTermCoef.size());
+	for(UInt_t t = 0; t < fTermCoef.size(); ++t)
+		fTermQ[t] = QIndex(fTermSub[t],fTermHarmonic[t],fTermPower[t]);
+	fNodeRe.assign(fNodeFirst.size()-1,0.);
+	fNodeIm.assign(fNodeRe.size(),0.);
+	fNodeRe[0] = 1.;
+	fCompiled = kTRUE;
+}
+
+//________________________________________________________________________
+void AliJMultiCorrelator::Reset(){
+	// clear the Q table for a new event
+	if(!fCompiled){
+		Compile();
+		return;
+	}
+	std::fill(fQRe.begin(),fQRe.end(),0.);
+	std::fill(fQIm.begin(),fQIm.end(),0.);
+}
+
+//________________________________________________________________________
+void AliJMultiCorrelator::Fill(UInt_t sub, Double_t phi, Double_t weight){
+	// add a particle to the non-negative harmonics of subevent sub;
+	// exp(i*n*phi) and w^p by recurrence instead of a cos/sin for each entry
+	for(UInt_t p = 1; p <= fMaxPower; ++p)
+		fWeightPowers[p] = fWeightPowers[p-1]*weight;
+	Double_t c1 = TMath::Cos(phi), s1 = TMath::Sin(phi);
+	UInt_t nn = 2*fMaxHarmonic+1;
+	Double_t *qre = &fQRe[QIndex(sub,0,0)];
+	Double_t *qim = &fQIm[QIndex(sub,0,0)];
+	Double_t c = 1., s = 0.;
+	for(UInt_t n = 0; n <= fMaxHarmonic; ++n){
+		for(UInt_t p = 0; p <= fMaxPower; ++p){
+			qre[p*nn+n] += fWeightPowers[p]*c;
+			qim[p*nn+n] += fWeightPowers[p]*s;
+		}
+		Double_t t = c*c1-s*s1;
+		s = s*c1+c*s1;
+		c = t;
+	}
+}
+
+//________________________________________________________________________
+void AliJMultiCorrelator::Evaluate(){
+	// Q(-n,p) = conj(Q(n,p)), then all nodes and all correlators in one pass
+	UInt_t nn = 2*fMaxHarmonic+1;
+	for(UInt_t i = 0; i < fQRe.size(); i += nn){
+		for(UInt_t n = 1; n <= fMaxHarmonic; ++n){
+			fQRe[i+fMaxHarmonic-n] = fQRe[i+fMaxHarmonic+n];
+			fQIm[i+fMaxHarmonic-n] = -fQIm[i+fMaxHarmonic+n];
+		}
+	}
+
+	for(UInt_t node = 1; node < fNodeRe.size(); ++node){
+		Double_t re = 0., im = 0.;
+		for(UInt_t t = fNodeFirst[node]; t < fNodeFirst[node+1]; ++t){
+			UInt_t q = fTermQ[t], ch = fTermChild[t];
+			re += fTermCoef[t]*(fQRe[q]*fNodeRe[ch]-fQIm[q]*fNodeIm[ch]);
+			im += fTermCoef[t]*(fQRe[q]*fNodeIm[ch]+fQIm[q]*fNodeRe[ch]);
+		}
+		fNodeRe[node] = re;
+		fNodeIm[node] = im;
+	}
+
+	for(UInt_t ic = 0; ic < fRe.size(); ++ic){
+		Double_t re = 1., im = 0.;
+		for(UInt_t j = fCorrFirst[ic]; j < fCorrFirst[ic+1]; ++j){
+			UInt_t node = fCorrNode[j];
+			Double_t t = re*fNodeRe[node]-im*fNodeIm[node];
+			im = re*fNodeIm[node]+im*fNodeRe[node];
+			re = t;
+		}
+		fRe[ic] = re;
+		fIm[ic] = im;
+	}
+}
+
+//________________________________________________________________________
+TComplex AliJMultiCorrelator::GetQ(UInt_t sub, Int_t n, UInt_t p) const{
+	// Q(n,p) of subevent sub, zero outside of the table
+	if(!fCompiled || sub >= fNSub || p > fMaxPower || (UInt_t)TMath::Abs(n) > fMaxHarmonic)
+		return TComplex(0,0);
+	UInt_t q = QIndex(sub,TMath::Abs(n),p);
+	return TComplex(fQRe[q],n < 0?-fQIm[q]:fQIm[q]);
+}
+
+//________________________________________________________________________
+TComplex AliJMultiCorrelator::Compute(UInt_t sub, UInt_t m, const Int_t *harmonics) const{
+	// m-particle numerator of harmonics from the current Q table, without memoisation
+	return Numerator(sub,harmonics,(1u<<m)-1);
+}
+
+//________________________________________________________________________
+TComplex AliJMultiCorrelator::Numerator(UInt_t sub, const Int_t *harmonics, UInt_t mask) const{
+	// N(S) of the particles in mask
+	if(mask == 0)
+		return TComplex(1,0);
+	UInt_t first = 0;
+	while(!(mask & (1u<<first)))
+		first++;
+	UInt_t others = mask & ~(1u<<first);
+	TComplex sum(0,0);
+	// all subsets of the other particles, including the empty one
+	for(UInt_t b = others;; b = (b-1) & others){
+		Int_t n = harmonics[first];
+		UInt_t k = 1;
+		for(UInt_t j = first+1; (1u<<j) <= b; ++j)
+			if(b & (1u<<j)){
+				n += harmonics[j];
+				k++;
+			}
+		Double_t coef = ((k%2 == 1)?1.0:-1.0)*TMath::Factorial(k-1);
+		sum += coef*GetQ(sub,n,k)*Numerator(sub,harmonics,others & ~b);
+		if(b == 0)
+			break;
+	}
+	return sum;
+}
@@ -0,0 +1,89 @@
+/* Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice */
+
+// Generic multi-particle correlators from flow vectors
+//
+// Flow vectors Q(n,p) = sum_i w_i^p exp(i*n*phi_i) are kept in a flat table, one
+// block per subevent. A correlator is a product of groups; each group is the
+// m-particle numerator <exp(i(n1*phi1+...+nm*phim))> of one subevent with the
+// self-correlations removed (generic framework, Bilandzic et al., PRC 89 064904):
+//   N(S) = sum over blocks B of S containing its first particle
+//          (-1)^(|B|-1) (|B|-1)! Q(sum_B n, |B|) N(S\B),  N({}) = 1
+// Correlators with eta gaps have one group per subevent. The conjugated side of
+// a gap correlator, conj(N_B(n)) = N_B(-n), is given by AddGap().
+//
+// The recursion is unrolled once, when the correlators are added: every distinct
+// sub-multiset of harmonics of a subevent becomes one node, shared between all
+// correlators which contain it. Evaluate() is then a single pass over the nodes
+// and correlators (flat arrays), done once per event for all correlators.
+
+#ifndef ALIJMULTICORRELATOR_H
+#define ALIJMULTICORRELATOR_H
+
+#include <map>
+#include <vector>
+#include <TComplex.h>
+
+class AliJMultiCorrelator {
+public:
+	AliJMultiCorrelator(UInt_t nsub = 1, UInt_t maxHarmonic = 0, UInt_t maxPower = 0);
+	virtual ~AliJMultiCorrelator(){}
+
+	// configuration, the correlator index is returned
+	Int_t Add(UInt_t sub, UInt_t m, const Int_t *harmonics);
+	Int_t AddGap(UInt_t subA, UInt_t mA, const Int_t *harmonicsA, UInt_t subB, UInt_t mB, const Int_t *harmonicsB);
+
+	// event loop: Reset(), Fill() for each track, Evaluate()
+	void Reset();
+	void Fill(UInt_t sub, Double_t phi, Double_t weight);
+	void Evaluate();
+
+	TComplex GetCorrelator(Int_t ic) const{ return TComplex(fRe[ic],fIm[ic]); }
+	Double_t GetCorrelatorRe(Int_t ic) const{ return fRe[ic]; }
+	TComplex GetQ(UInt_t sub, Int_t n, UInt_t p) const;
+	TComplex Compute(UInt_t sub, UInt_t m, const Int_t *harmonics) const; // not registered correlator, direct recursion
+
+	UInt_t GetNCorrelators() const{ return fRe.size(); }
+	UInt_t GetNNodes() const{ return fNodeFirst.size()-1; }
+	UInt_t GetMaxHarmonic() const{ return fMaxHarmonic; }
+	UInt_t GetMaxPower() const{ return fMaxPower; }
+
+private:
+	Int_t GetNode(UInt_t sub, std::vector<Int_t> &harmonics);
+	Int_t AddGroups(const std::vector<Int_t> &key);
+	void Compile();
+	UInt_t QIndex(UInt_t sub, Int_t n, UInt_t p) const{ return (sub*(fMaxPower+1)+p)*(2*fMaxHarmonic+1)+fMaxHarmonic+n; }
+	TComplex Numerator(UInt_t sub, const Int_t *harmonics, UInt_t mask) const;
+
+	UInt_t fNSub; // number of subevents
+	UInt_t fMaxHarmonic; // Q table covers -fMaxHarmonic..fMaxHarmonic
+	UInt_t fMaxPower; // Q table covers weight powers 0..fMaxPower
+	Bool_t fCompiled; // Q table and term indices match fMaxHarmonic, fMaxPower
+
+	std::vector<Double_t> fQRe; //! Q table, [sub][p][n]
+	std::vector<Double_t> fQIm; //!
+	std::vector<Double_t> fWeightPowers; //! buffer for Fill()
+
+	// nodes: N(S) = sum_t fTermCoef[t]*Q[fTermQ[t]]*N(fTermChild[t]), t in [fNodeFirst[node],fNodeFirst[node+1])
+	std::map<std::vector<Int_t>,Int_t> fNodeMap; //! (sub, sorted harmonics) -> node
+	std::vector<UInt_t> fNodeFirst; //!
+	std::vector<Double_t> fNodeRe; //!
+	std::vector<Double_t> fNodeIm; //!
+	std::vector<Double_t> fTermCoef; //!
+	std::vector<Int_t> fTermSub; //!
+	std::vector<Int_t> fTermHarmonic; //!
+	std::vector<Int_t> fTermPower; //!
+	std::vector<UInt_t> fTermQ; //!
+	std::vector<UInt_t> fTermChild; //!
+
+	// correlators: product of the nodes fCorrNode[j], j in [fCorrFirst[ic],fCorrFirst[ic+1])
+	std::map<std::vector<Int_t>,Int_t> fCorrMap; //! groups -> correlator
+	std::vector<UInt_t> fCorrFirst; //!
+	std::vector<UInt_t> fCorrNode; //!
+	std::vector<Double_t> fRe; //!
+	std::vector<Double_t> fIm; //!
+
+	ClassDef(AliJMultiCorrelator, 1);
+};
+
+#endif
@@ -25,6 +25,7 @@
 #pragma link C++ class AliJHistManager+;
 #pragma link C++ class AliJFFlucTask+;
 #pragma link C++ class AliJFFlucAnalysis+;
+#pragma link C++ class AliJMultiCorrelator+;
 #pragma link C++ class AliJXtTask+;
 #pragma link C++ class AliJXtAnalysis+;
 #pragma link C++ class AliJHistogramInterface+;
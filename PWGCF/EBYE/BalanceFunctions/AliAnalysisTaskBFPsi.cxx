@@ -595,6 +595,8 @@ void AliAnalysisTaskBFPsi::UserCreateOutputObjects() {
   fList->Add(fBalance->GetQAHistResonancesLambda());
   fList->Add(fBalance->GetQAHistQbefore());
   fList->Add(fBalance->GetQAHistQafter());
+  if (fBalance->GetQAHistBinnedPairCheck())
+    fList->Add(fBalance->GetQAHistBinnedPairCheck());
 
   //for(Int_t a = 0; a < ANALYSIS_TYPES; a++){
   fListBF->Add(fBalance->GetHistNp());
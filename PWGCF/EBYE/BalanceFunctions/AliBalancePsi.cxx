@@ -20,11 +20,14 @@
 //-----------------------------------------------------------------
 
 
+#include <algorithm>
+
 //ROOT
 #include <Riostream.h>
 #include <TCanvas.h>
 #include <TMath.h>
 #include <TAxis.h>
+#include <TH1D.h>
 #include <TH2D.h>
 #include <TH3D.h>
 #include <TLorentzVector.h>
@@ -33,6 +36,7 @@
 #include <TString.h>
 #include <TSpline.h>
 #include <TRandom3.h>
+#include <TVirtualFFT.h>
 
 #include "AliVParticle.h"
 #include "AliMCParticle.h"
@@ -48,6 +52,601 @@ using std::cerr;
 
 ClassImp(AliBalancePsi)
 
+//____________________________________________________________________//
+// AliBalancePsiBinnedPairs
+//   Pair counting of AliBalancePsi from binned single particle
+//   distributions (see AliBalancePsi::UseBinnedPairCounting).
+//   For each combination of trigger (event class, pT, charge) and
+//   associated (pT, charge) particles, the (Delta eta, Delta phi)
+//   distribution of the pairs is the cross-correlation of the
+//   correction weighted (eta, phi) histograms of the two sets,
+//   computed with 2D FFTs (the sums of the squared weights are
+//   correlated at the same time for the errors).
+//   With momentum ordering, the sets of the same pT bin are split
+//   recursively at a pT value, so that all pairs of the trigger
+//   particles above and the associated particles below qualify.
+//   Small sets use the pair loop.
+//   The trigger cells are shifted by half a cell with respect to the
+//   associated cells, so that the centre of each cell offset lies
+//   inside of exactly one (Delta eta, Delta phi) bin, which gets all
+//   pairs of this offset.
+//____________________________________________________________________//
+class AliBalancePsiBinnedPairs {
+ public:
+  AliBalancePsiBinnedPairs(AliTHn *histPP, AliTHn *histPN, AliTHn *histNP, AliTHn *histNN,
+			   Int_t subBins, Long64_t minPairs, Bool_t momentumOrdering);
+  ~AliBalancePsiBinnedPairs();
+
+  TString Init();
+  void    Reset() {fTrig.clear(); fAssoc.clear();}
+  void    AddTrigger(Float_t eta, Float_t phi, Float_t pt, Short_t charge, Float_t correction, Double_t eventClass, Int_t index);
+  void    AddAssociated(Float_t eta, Float_t phi, Float_t pt, Short_t charge, Double_t correction, Int_t index);
+  void    Process(Bool_t sameEvent, Double_t vertexZ);
+  void    SetCheckHistogram(TH1 *hist) {fCheckHist = hist;}
+
+ private:
+  struct Particle {
+    Float_t  fEta;        // pseudorapidity
+    Float_t  fPhi;        // azimuth
+    Float_t  fPt;         // transverse momentum
+    Double_t fWeight;     // correction
+    Double_t fClass;      // event class variable (trigger)
+    Int_t    fCellEta;    // eta cell
+    Int_t    fCellPhi;    // phi cell
+    Int_t    fGroup;      // trigger: (event class, pT, charge), associated: (pT, charge)
+    Int_t    fAssocGroup; // trigger in same event: group as associated particle (-1: none)
+    Double_t fSelfWeight; // trigger in same event: weight of the pair with itself
+    Int_t    fSelfCell;   // trigger in same event: cell offset of the pair with itself
+    Int_t    fIndex;      // index in the particle array
+    bool operator<(const Particle &o) const {
+      return fGroup < o.fGroup || (fGroup == o.fGroup && fPt < o.fPt);}
+  };
+  struct PtLess {
+    bool operator()(const Particle &p, Float_t pt) const {return p.fPt < pt;}
+    bool operator()(Float_t pt, const Particle &p) const {return pt < p.fPt;}
+  };
+  // Fourier transforms of the weights and of the squared weights of a set
+  struct Spectrum {
+    std::vector<Double_t> fWRe, fWIm, fW2Re, fW2Im;
+  };
+
+  AliBalancePsiBinnedPairs(const AliBalancePsiBinnedPairs&);            // not implemented
+  AliBalancePsiBinnedPairs& operator=(const AliBalancePsiBinnedPairs&); // not implemented
+
+  static Bool_t CheckAxis(const TAxis *axis, Double_t &width, Int_t &first);
+  Bool_t InitFFT(Int_t nCellsEta);
+  void   Correlate(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist,
+		   Spectrum *trigSpectrum, Spectrum *assocSpectrum, Int_t assocGroup);
+  void   CorrelateOrdered(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist);
+  void   Transform(const std::vector<Particle> &particles, Int_t begin, Int_t end, Spectrum &spectrum);
+  void   FillPairs(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist);
+  Int_t  PairBin(const Particle &t, const Particle &a, Double_t *trackVariablesPair) const;
+  void   Check(Int_t tb, Int_t te, Int_t ab, Int_t ae, Bool_t ordered);
+  void   FillResult(AliTHn *hist, Int_t classBin, Int_t ptTrigBin, Int_t ptAssocBin);
+
+  AliTHn  *fHists[4];        // ++, +-, -+, -- pairs
+  Int_t    fSubBins;         // cells per Delta eta (Delta phi) bin
+  Long64_t fMinPairs;        // sets with at most this number of pairs use the pair loop
+  Bool_t   fMomentumOrdering;// pT,trig >= pT,assoc
+
+  TAxis   *fAxisClass;       // event class axis
+  TAxis   *fAxisEta;         // Delta eta axis
+  TAxis   *fAxisPhi;         // Delta phi axis
+  TAxis   *fAxisPtTrig;      // pT,trig axis
+  TAxis   *fAxisPtAssoc;     // pT,assoc axis
+  TAxis   *fAxisVertex;      // vertex z axis
+  Int_t    fNBinsEta;        // Delta eta bins
+  Int_t    fNBinsPhi;        // Delta phi bins
+  Int_t    fFirstBinEta;     // lower edge of the Delta eta axis in units of the bin width
+  Int_t    fFirstBinPhi;     // lower edge of the Delta phi axis in units of the bin width
+  Double_t fCellEta;         // eta cell width
+  Double_t fCellPhi;         // phi cell width
+  Int_t    fNCellsPhi;       // phi cells (full azimuth)
+
+  Bool_t   fSameEvent;       // trigger and associated particles from the same event
+  Double_t fVertexZ;         // vertex z of the event
+  Int_t    fCellEtaMin;      // first eta cell of the event
+  Int_t    fNCellsEta;       // eta cells of the event
+  Int_t    fLEta;            // eta size of the FFT grid (no wrap around of the Delta eta cells)
+
+  TVirtualFFT *fForward;     // forward 2D FFT
+  TVirtualFFT *fBackward;    // backward 2D FFT
+  std::vector<Double_t> fRe; // FFT buffer
+  std::vector<Double_t> fIm; // FFT buffer
+  std::vector<Double_t> fSumW;  // weights per (Delta eta, Delta phi) bin of the current combination
+  std::vector<Double_t> fSumW2; // squared weights per (Delta eta, Delta phi) bin of the current combination
+
+  TH1     *fCheckHist;       // comparison with the pair loop (0: no comparison)
+  std::vector<Double_t> fLoopW; // check: weights per bin filled by the pair loop of small sets
+  std::vector<Double_t> fRefW;  // check: weights per bin of the full pair loop
+
+  std::vector<Particle> fTrig;  // trigger particles
+  std::vector<Particle> fAssoc; // associated particles
+};
+
+//____________________________________________________________________//
+AliBalancePsiBinnedPairs::AliBalancePsiBinnedPairs(AliTHn *histPP, AliTHn *histPN, AliTHn *histNP, AliTHn *histNN,
+						   Int_t subBins, Long64_t minPairs, Bool_t momentumOrdering) :
+  fSubBins(subBins),
+  fMinPairs(minPairs),
+  fMomentumOrdering(momentumOrdering),
+  fAxisClass(0),
+  fAxisEta(0),
+  fAxisPhi(0),
+  fAxisPtTrig(0),
+  fAxisPtAssoc(0),
+  fAxisVertex(0),
+  fNBinsEta(0),
+  fNBinsPhi(0),
+  fFirstBinEta(0),
+  fFirstBinPhi(0),
+  fCellEta(0),
+  fCellPhi(0),
+  fNCellsPhi(0),
+  fSameEvent(kTRUE),
+  fVertexZ(0),
+  fCellEtaMin(0),
+  fNCellsEta(0),
+  fLEta(0),
+  fForward(0),
+  fBackward(0),
+  fRe(),
+  fIm(),
+  fSumW(),
+  fSumW2(),
+  fCheckHist(0),
+  fLoopW(),
+  fRefW(),
+  fTrig(),
+  fAssoc() {
+  // Constructor
+  fHists[0] = histPP;
+  fHists[1] = histPN;
+  fHists[2] = histNP;
+  fHists[3] = histNN;
+}
+
+//____________________________________________________________________//
+AliBalancePsiBinnedPairs::~AliBalancePsiBinnedPairs() {
+  // Destructor
+  delete fForward;
+  delete fBackward;
+}
+
+//____________________________________________________________________//
+Bool_t AliBalancePsiBinnedPairs::CheckAxis(const TAxis *axis, Double_t &width, Int_t &first) {
+  // Equidistant bins with edges at multiples of the bin width
+  Int_t nBins = axis->GetNbins();
+  width = (axis->GetXmax() - axis->GetXmin())/nBins;
+  Double_t tolerance = 1e-3*width;
+  first = TMath::Nint(axis->GetXmin()/width);
+  for (Int_t i = 1; i <= nBins + 1; i++) {
+    if (TMath::Abs(axis->GetBinLowEdge(i) - (first + i - 1)*width) > tolerance)
+      return kFALSE;
+  }
+  return kTRUE;
+}
+
+//____________________________________________________________________//
+TString AliBalancePsiBinnedPairs::Init() {
+  // Check the binning of the pair histograms, returns the reason if the binned pair counting cannot be used
+  if (fSubBins < 1)
+    return "Number of cells per bin < 1";
+
+  fAxisClass   = fHists[0]->GetAxis(0, 0);
+  fAxisEta     = fHists[0]->GetAxis(1, 0);
+  fAxisPhi     = fHists[0]->GetAxis(2, 0);
+  fAxisPtTrig  = fHists[0]->GetAxis(3, 0);
+  fAxisPtAssoc = fHists[0]->GetAxis(4, 0);
+  fAxisVertex  = fHists[0]->GetAxis(5, 0);
+
+  Double_t widthEta = 0, widthPhi = 0;
+  if (!CheckAxis(fAxisEta, widthEta, fFirstBinEta))
+    return "Delta eta bins are not equidistant with edges at multiples of the bin width";
+  if (!CheckAxis(fAxisPhi, widthPhi, fFirstBinPhi))
+    return "Delta phi bins are not equidistant with edges at multiples of the bin width";
+  fNBinsEta = fAxisEta->GetNbins();
+  fNBinsPhi = fAxisPhi->GetNbins();
+  if (TMath::Abs(fNBinsPhi*widthPhi - TMath::TwoPi()) > 1e-3*widthPhi)
+    return "Delta phi axis does not cover 2 pi";
+
+  if (fMomentumOrdering) {
+    if (fAxisPtTrig->GetNbins() != fAxisPtAssoc->GetNbins())
+      return "Momentum ordering needs the same pT,trig and pT,assoc bins";
+    for (Int_t i = 1; i <= fAxisPtTrig->GetNbins() + 1; i++) {
+      if (fAxisPtTrig->GetBinLowEdge(i) != fAxisPtAssoc->GetBinLowEdge(i))
+	return "Momentum ordering needs the same pT,trig and pT,assoc bins";
+    }
+  }
+
+  fCellEta   = widthEta/fSubBins;
+  fNCellsPhi = fNBinsPhi*fSubBins;
+  fCellPhi   = TMath::TwoPi()/fNCellsPhi;
+
+  if (!InitFFT(1))
+    return "No FFT implementation available (TVirtualFFT)";
+
+  fSumW.assign(fNBinsEta*fNBinsPhi, 0.);
+  fSumW2.assign(fNBinsEta*fNBinsPhi, 0.);
+  fLoopW.assign(fNBinsEta*fNBinsPhi, 0.);
+  fRefW.assign(fNBinsEta*fNBinsPhi, 0.);
+  return "";
+}
+
+//____________________________________________________________________//
+Bool_t AliBalancePsiBinnedPairs::InitFFT(Int_t nCellsEta) {
+  // FFTs on a grid of (at least) 2 nCellsEta - 1 eta cells times fNCellsPhi phi cells
+  Int_t lEta = ((2*nCellsEta - 1 + 7)/8)*8;
+  if (fForward && fBackward && lEta == fLEta) return kTRUE;
+
+  delete fForward;
+  delete fBackward;
+  Int_t n[2] = {lEta, fNCellsPhi};
+  fForward  = TVirtualFFT::FFT(2, n, "C2CFORWARD ES K");
+  fBackward = TVirtualFFT::FFT(2, n, "C2CBACKWARD ES K");
+  if (!fForward || !fBackward) {
+    delete fForward;
+    delete fBackward;
+    fForward = 0;
+    fBackward = 0;
+    fLEta = 0;
+    return kFALSE;
+  }
+  fLEta = lEta;
+  fRe.assign(fLEta*fNCellsPhi, 0.);
+  fIm.assign(fLEta*fNCellsPhi, 0.);
+  return kTRUE;
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::AddTrigger(Float_t eta, Float_t phi, Float_t pt, Short_t charge, Float_t correction, Double_t eventClass, Int_t index) {
+  // Trigger particle (charged, inside of the event class and pT,trig axes)
+  if (charge == 0) return;
+  Int_t classBin = fAxisClass->FindBin(eventClass);
+  Int_t ptBin    = fAxisPtTrig->FindBin(pt);
+  if (classBin < 1 || classBin > fAxisClass->GetNbins() || ptBin < 1 || ptBin > fAxisPtTrig->GetNbins()) return;
+
+  Particle p;
+  p.fEta        = eta;
+  p.fPhi        = phi;
+  p.fPt         = pt;
+  p.fWeight     = correction;
+  p.fClass      = eventClass;
+  // cells centred at multiples of the cell width (associated particles: edges at multiples of the cell width)
+  p.fCellEta    = TMath::FloorNint(eta/fCellEta + 0.5);
+  p.fCellPhi    = TMath::FloorNint(phi/fCellPhi + 0.5)%fNCellsPhi;
+  if (p.fCellPhi < 0) p.fCellPhi += fNCellsPhi;
+  p.fGroup      = (((classBin - 1)*fAxisPtTrig->GetNbins() + ptBin - 1) << 1) + (charge < 0);
+  p.fAssocGroup = -1;
+  p.fSelfWeight = 0;
+  p.fSelfCell   = 0;
+  p.fIndex      = index;
+  fTrig.push_back(p);
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::AddAssociated(Float_t eta, Float_t phi, Float_t pt, Short_t charge, Double_t correction, Int_t index) {
+  // Associated particle (charged, inside of the pT,assoc axis)
+  if (charge == 0) return;
+  Int_t ptBin = fAxisPtAssoc->FindBin(pt);
+  if (ptBin < 1 || ptBin > fAxisPtAssoc->GetNbins()) return;
+
+  Particle p;
+  p.fEta        = eta;
+  p.fPhi        = phi;
+  p.fPt         = pt;
+  p.fWeight     = correction;
+  p.fClass      = 0;
+  p.fCellEta    = TMath::FloorNint(eta/fCellEta);
+  p.fCellPhi    = TMath::FloorNint(phi/fCellPhi)%fNCellsPhi;
+  if (p.fCellPhi < 0) p.fCellPhi += fNCellsPhi;
+  p.fGroup      = ((ptBin - 1) << 1) + (charge < 0);
+  p.fAssocGroup = -1;
+  p.fSelfWeight = 0;
+  p.fSelfCell   = 0;
+  p.fIndex      = index;
+  fAssoc.push_back(p);
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::Process(Bool_t sameEvent, Double_t vertexZ) {
+  // Fill the pair histograms with all pairs of trigger and associated particles
+  fSameEvent = sameEvent;
+  fVertexZ   = vertexZ;
+  Int_t vertexBin = fAxisVertex->FindBin(vertexZ);
+  if (vertexBin < 1 || vertexBin > fAxisVertex->GetNbins() || fTrig.empty() || fAssoc.empty()) return;
+
+  // eta cells of this event
+  Int_t cellMin = fTrig[0].fCellEta, cellMax = fTrig[0].fCellEta;
+  for (UInt_t i = 0; i < fTrig.size(); i++) {
+    cellMin = TMath::Min(cellMin, fTrig[i].fCellEta);
+    cellMax = TMath::Max(cellMax, fTrig[i].fCellEta);
+  }
+  for (UInt_t i = 0; i < fAssoc.size(); i++) {
+    cellMin = TMath::Min(cellMin, fAssoc[i].fCellEta);
+    cellMax = TMath::Max(cellMax, fAssoc[i].fCellEta);
+  }
+  fCellEtaMin = cellMin;
+  fNCellsEta  = cellMax - cellMin + 1;
+  if (!InitFFT(fNCellsEta))
+    AliWarningGeneral("AliBalancePsiBinnedPairs", "FFT initialization failed, using the pair loop");
+
+  // the pair of a trigger particle with itself (same event)
+  if (fSameEvent) {
+    Int_t maxIndex = 0;
+    for (UInt_t j = 0; j < fAssoc.size(); j++) maxIndex = TMath::Max(maxIndex, fAssoc[j].fIndex);
+    std::vector<Int_t> assocOf(maxIndex + 1, -1);
+    for (UInt_t j = 0; j < fAssoc.size(); j++) assocOf[fAssoc[j].fIndex] = j;
+    for (UInt_t i = 0; i < fTrig.size(); i++) {
+      Int_t j = (fTrig[i].fIndex <= maxIndex) ? assocOf[fTrig[i].fIndex] : -1;
+      if (j < 0) continue;
+      fTrig[i].fAssocGroup = fAssoc[j].fGroup;
+      fTrig[i].fSelfWeight = fTrig[i].fWeight*fAssoc[j].fWeight;
+      // offset of the trigger and associated cells of the same particle (0 or 1 cell)
+      Int_t dEta = fTrig[i].fCellEta - fAssoc[j].fCellEta;
+      Int_t dPhi = (fTrig[i].fCellPhi - fAssoc[j].fCellPhi + fNCellsPhi)%fNCellsPhi;
+      if (fLEta > 0) fTrig[i].fSelfCell = ((dEta + fLEta)%fLEta)*fNCellsPhi + dPhi;
+    }
+  }
+
+  std::sort(fTrig.begin(), fTrig.end());
+  std::sort(fAssoc.begin(), fAssoc.end());
+
+  // associated particle sets
+  std::vector<Int_t> assocBegin;
+  for (UInt_t j = 0; j < fAssoc.size(); j++) {
+    if (j == 0 || fAssoc[j].fGroup != fAssoc[j-1].fGroup) assocBegin.push_back(j);
+  }
+  assocBegin.push_back(fAssoc.size());
+  std::vector<Spectrum> assocSpectra(assocBegin.size() - 1);
+
+  Int_t nPtTrig = fAxisPtTrig->GetNbins();
+  for (UInt_t tb = 0; tb < fTrig.size(); ) {
+    Int_t group = fTrig[tb].fGroup;
+    UInt_t te = tb;
+    while (te < fTrig.size() && fTrig[te].fGroup == group) te++;
+
+    Int_t classBin  = (group >> 1)/nPtTrig;
+    Int_t ptTrigBin = (group >> 1)%nPtTrig;
+    Int_t chargeTrig = group & 1;
+    Spectrum trigSpectrum;
+
+    for (UInt_t k = 0; k + 1 < assocBegin.size(); k++) {
+      Int_t ab = assocBegin[k], ae = assocBegin[k+1];
+      Int_t ptAssocBin = fAssoc[ab].fGroup >> 1;
+      Int_t chargeAssoc = fAssoc[ab].fGroup & 1;
+      if (fMomentumOrdering && ptTrigBin < ptAssocBin) continue;
+
+      AliTHn *hist = fHists[2*chargeTrig + chargeAssoc];
+      std::fill(fSumW.begin(), fSumW.end(), 0.);
+      std::fill(fSumW2.begin(), fSumW2.end(), 0.);
+      if (fCheckHist) std::fill(fLoopW.begin(), fLoopW.end(), 0.);
+      if (fMomentumOrdering && ptTrigBin == ptAssocBin)
+	CorrelateOrdered(tb, te, ab, ae, hist);
+      else
+	Correlate(tb, te, ab, ae, hist, &trigSpectrum, &assocSpectra[k], fAssoc[ab].fGroup);
+      if (fCheckHist) Check(tb, te, ab, ae, fMomentumOrdering && ptTrigBin == ptAssocBin);
+      FillResult(hist, classBin, ptTrigBin, ptAssocBin);
+    }
+    tb = te;
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::Transform(const std::vector<Particle> &particles, Int_t begin, Int_t end, Spectrum &spectrum) {
+  // Fourier transforms of the weights and of the squared weights of the particles [begin, end)
+  // (one complex FFT of weight + i weight^2, separated by symmetry)
+  Int_t size = fLEta*fNCellsPhi;
+  std::fill(fRe.begin(), fRe.end(), 0.);
+  std::fill(fIm.begin(), fIm.end(), 0.);
+  for (Int_t i = begin; i < end; i++) {
+    const Particle &p = particles[i];
+    Int_t cell = (p.fCellEta - fCellEtaMin)*fNCellsPhi + p.fCellPhi;
+    fRe[cell] += p.fWeight;
+    fIm[cell] += p.fWeight*p.fWeight;
+  }
+  fForward->SetPointsComplex(&fRe[0], &fIm[0]);
+  fForward->Transform();
+  fForward->GetPointsComplex(&fRe[0], &fIm[0]);
+
+  spectrum.fWRe.resize(size);
+  spectrum.fWIm.resize(size);
+  spectrum.fW2Re.resize(size);
+  spectrum.fW2Im.resize(size);
+  for (Int_t k = 0; k < size; k++) {
+    Int_t kEta = k/fNCellsPhi;
+    Int_t kPhi = k%fNCellsPhi;
+    Int_t mk = ((fLEta - kEta)%fLEta)*fNCellsPhi + (fNCellsPhi - kPhi)%fNCellsPhi;
+    spectrum.fWRe[k]  = 0.5*(fRe[k] + fRe[mk]);
+    spectrum.fWIm[k]  = 0.5*(fIm[k] - fIm[mk]);
+    spectrum.fW2Re[k] = 0.5*(fIm[k] + fIm[mk]);
+    spectrum.fW2Im[k] = -0.5*(fRe[k] - fRe[mk]);
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::Correlate(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist,
+					 Spectrum *trigSpectrum, Spectrum *assocSpectrum, Int_t assocGroup) {
+  // All pairs of the trigger particles [tb, te) and of the associated particles [ab, ae)
+  // (assocGroup >= 0: the associated particles are the set of this group, to remove the pairs of a particle with itself)
+  if (te <= tb || ae <= ab) return;
+  Long64_t nPairs = (Long64_t)(te - tb)*(ae - ab);
+  if (!fForward || nPairs <= fMinPairs || nPairs <= (Long64_t)fLEta*fNCellsPhi) {
+    FillPairs(tb, te, ab, ae, hist);
+    return;
+  }
+
+  Spectrum trigLocal, assocLocal;
+  if (!trigSpectrum) trigSpectrum = &trigLocal;
+  if (!assocSpectrum) assocSpectrum = &assocLocal;
+  if (trigSpectrum->fWRe.empty()) Transform(fTrig, tb, te, *trigSpectrum);
+  if (assocSpectrum->fWRe.empty()) Transform(fAssoc, ab, ae, *assocSpectrum);
+  const Spectrum &t = *trigSpectrum;
+  const Spectrum &a = *assocSpectrum;
+
+  // cross-correlation (Delta = trigger - associated) of the weights + i of the squared weights
+  Int_t size = fLEta*fNCellsPhi;
+  for (Int_t k = 0; k < size; k++) {
+    Double_t wRe  = t.fWRe[k]*a.fWRe[k] + t.fWIm[k]*a.fWIm[k];
+    Double_t wIm  = t.fWIm[k]*a.fWRe[k] - t.fWRe[k]*a.fWIm[k];
+    Double_t w2Re = t.fW2Re[k]*a.fW2Re[k] + t.fW2Im[k]*a.fW2Im[k];
+    Double_t w2Im = t.fW2Im[k]*a.fW2Re[k] - t.fW2Re[k]*a.fW2Im[k];
+    fRe[k] = wRe - w2Im;
+    fIm[k] = wIm + w2Re;
+  }
+  fBackward->SetPointsComplex(&fRe[0], &fIm[0]);
+  fBackward->Transform();
+  fBackward->GetPointsComplex(&fRe[0], &fIm[0]);
+  for (Int_t k = 0; k < size; k++) {
+    fRe[k] /= size;
+    fIm[k] /= size;
+  }
+
+  // no pairs of a particle with itself
+  if (fSameEvent && assocGroup >= 0) {
+    for (Int_t i = tb; i < te; i++) {
+      if (fTrig[i].fAssocGroup != assocGroup) continue;
+      fRe[fTrig[i].fSelfCell] -= fTrig[i].fSelfWeight;
+      fIm[fTrig[i].fSelfCell] -= fTrig[i].fSelfWeight*fTrig[i].fSelfWeight;
+    }
+  }
+
+  // cell offsets -> (Delta eta, Delta phi) bins: the pairs of the offset d (trigger - associated cell)
+  // have Delta = (d - 1/2) +- 1 cell widths, the centre is inside of the bin of floor((d - 1/2)/subBins)
+  Double_t threshold = 1e-12*TMath::Abs(t.fWRe[0]*a.fWRe[0]);
+  for (Int_t iEta = 0; iEta < fLEta; iEta++) {
+    Int_t dEta = (iEta < fNCellsEta) ? iEta : iEta - fLEta;
+    if (dEta <= -fNCellsEta) continue;
+    Int_t binEta = TMath::FloorNint((dEta - 0.5)/fSubBins) - fFirstBinEta;
+    if (binEta < 0 || binEta >= fNBinsEta) continue;
+    for (Int_t iPhi = 0; iPhi < fNCellsPhi; iPhi++) {
+      Double_t w  = fRe[iEta*fNCellsPhi + iPhi];
+      Double_t w2 = fIm[iEta*fNCellsPhi + iPhi];
+      if (TMath::Abs(w) <= threshold && TMath::Abs(w2) <= threshold) continue;
+      Int_t binPhi = ((TMath::FloorNint((iPhi - 0.5)/fSubBins) - fFirstBinPhi)%fNBinsPhi + fNBinsPhi)%fNBinsPhi;
+      fSumW[binEta*fNBinsPhi + binPhi]  += w;
+      fSumW2[binEta*fNBinsPhi + binPhi] += w2;
+    }
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::CorrelateOrdered(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist) {
+  // Pairs with pT,trig >= pT,assoc of the trigger particles [tb, te) and of the associated particles [ab, ae),
+  // both sorted in pT
+  if (te <= tb || ae <= ab) return;
+  if (!fForward || (Long64_t)(te - tb)*(ae - ab) <= fMinPairs) {
+    FillPairs(tb, te, ab, ae, hist);
+    return;
+  }
+
+  // split at the median pT of the associated particles
+  Float_t split = fAssoc[(ab + ae)/2].fPt;
+  Int_t am = std::lower_bound(fAssoc.begin() + ab, fAssoc.begin() + ae, split, PtLess()) - fAssoc.begin();
+  if (am == ab) {
+    am = std::upper_bound(fAssoc.begin() + ab, fAssoc.begin() + ae, split, PtLess()) - fAssoc.begin();
+    if (am == ae) {
+      FillPairs(tb, te, ab, ae, hist);
+      return;
+    }
+    split = fAssoc[am].fPt;
+  }
+  Int_t tm = std::lower_bound(fTrig.begin() + tb, fTrig.begin() + te, split, PtLess()) - fTrig.begin();
+
+  // pT,trig >= split > pT,assoc: all pairs, no pair of a particle with itself
+  Correlate(tm, te, ab, am, hist, 0, 0, -1);
+  CorrelateOrdered(tb, tm, ab, am, hist);
+  CorrelateOrdered(tm, te, am, ae, hist);
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::FillPairs(Int_t tb, Int_t te, Int_t ab, Int_t ae, AliTHn *hist) {
+  // Pair loop (as in AliBalancePsi::CalculateBalance)
+  Double_t trackVariablesPair[kTrackVariablesPair];
+  trackVariablesPair[5] = fVertexZ;
+  for (Int_t i = tb; i < te; i++) {
+    const Particle &t = fTrig[i];
+    trackVariablesPair[0] = t.fClass;
+    trackVariablesPair[3] = t.fPt;
+    for (Int_t j = ab; j < ae; j++) {
+      const Particle &a = fAssoc[j];
+      if (fSameEvent && t.fIndex == a.fIndex) continue;
+      if (fMomentumOrdering && t.fPt < a.fPt) continue;
+
+      Int_t bin = PairBin(t, a, trackVariablesPair);
+      hist->Fill(trackVariablesPair, 0, t.fWeight*a.fWeight);
+      if (fCheckHist && bin >= 0) fLoopW[bin] += t.fWeight*a.fWeight;
+    }
+  }
+}
+
+//____________________________________________________________________//
+Int_t AliBalancePsiBinnedPairs::PairBin(const Particle &t, const Particle &a, Double_t *trackVariablesPair) const {
+  // Delta eta, Delta phi (as in AliBalancePsi::CalculateBalance) and pT,assoc of a pair,
+  // returns the (Delta eta, Delta phi) bin (-1: outside of the axes)
+  trackVariablesPair[1] = t.fEta - a.fEta;
+  trackVariablesPair[2] = t.fPhi - a.fPhi;
+  if (trackVariablesPair[2] > TMath::Pi())
+    trackVariablesPair[2] -= 2.*TMath::Pi();
+  if (trackVariablesPair[2] < - TMath::Pi())
+    trackVariablesPair[2] += 2.*TMath::Pi();
+  if (trackVariablesPair[2] < - TMath::Pi()/2.)
+    trackVariablesPair[2] += 2.*TMath::Pi();
+  trackVariablesPair[4] = a.fPt;
+
+  Int_t binEta = fAxisEta->FindBin(trackVariablesPair[1]);
+  Int_t binPhi = fAxisPhi->FindBin(trackVariablesPair[2]);
+  if (binEta < 1 || binEta > fNBinsEta || binPhi < 1 || binPhi > fNBinsPhi) return -1;
+  return (binEta - 1)*fNBinsPhi + binPhi - 1;
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::Check(Int_t tb, Int_t te, Int_t ab, Int_t ae, Bool_t ordered) {
+  // Compare the pairs of one combination bin by bin with the pair loop:
+  // (binned - pair loop)/pair loop for each (Delta eta, Delta phi) bin with pairs
+  // (bins filled only by the binned pair counting go to the overflow)
+  Double_t trackVariablesPair[kTrackVariablesPair];
+  std::fill(fRefW.begin(), fRefW.end(), 0.);
+  Double_t total = 0;
+  for (Int_t i = tb; i < te; i++) {
+    for (Int_t j = ab; j < ae; j++) {
+      if (fSameEvent && fTrig[i].fIndex == fAssoc[j].fIndex) continue;
+      if (ordered && fTrig[i].fPt < fAssoc[j].fPt) continue;
+      Int_t bin = PairBin(fTrig[i], fAssoc[j], trackVariablesPair);
+      if (bin < 0) continue;
+      fRefW[bin] += fTrig[i].fWeight*fAssoc[j].fWeight;
+      total += TMath::Abs(fTrig[i].fWeight*fAssoc[j].fWeight);
+    }
+  }
+
+  Double_t threshold = 1e-9*total;
+  for (UInt_t bin = 0; bin < fRefW.size(); bin++) {
+    Double_t binned = fSumW[bin] + fLoopW[bin];
+    if (TMath::Abs(fRefW[bin]) <= threshold && TMath::Abs(binned) <= threshold) continue;
+    if (TMath::Abs(fRefW[bin]) <= threshold) fCheckHist->Fill(fCheckHist->GetXaxis()->GetXmax() + 1.);
+    else fCheckHist->Fill((binned - fRefW[bin])/fRefW[bin]);
+  }
+}
+
+//____________________________________________________________________//
+void AliBalancePsiBinnedPairs::FillResult(AliTHn *hist, Int_t classBin, Int_t ptTrigBin, Int_t ptAssocBin) {
+  // Add the binned pairs of one combination to the pair histogram
+  Double_t trackVariablesPair[kTrackVariablesPair];
+  trackVariablesPair[0] = fAxisClass->GetBinCenter(classBin + 1);
+  trackVariablesPair[3] = fAxisPtTrig->GetBinCenter(ptTrigBin + 1);
+  trackVariablesPair[4] = fAxisPtAssoc->GetBinCenter(ptAssocBin + 1);
+  trackVariablesPair[5] = fVertexZ;
+  for (Int_t iEta = 0; iEta < fNBinsEta; iEta++) {
+    trackVariablesPair[1] = fAxisEta->GetBinCenter(iEta + 1);
+    for (Int_t iPhi = 0; iPhi < fNBinsPhi; iPhi++) {
+      Int_t bin = iEta*fNBinsPhi + iPhi;
+      if (fSumW[bin] == 0 && fSumW2[bin] == 0) continue;
+      trackVariablesPair[2] = fAxisPhi->GetBinCenter(iPhi + 1);
+      hist->Fill(trackVariablesPair, 0, fSumW[bin], fSumW2[bin]);
+    }
+  }
+}
+
 //____________________________________________________________________//
 AliBalancePsi::AliBalancePsi() :
   TObject(), 
@@ -78,6 +677,7 @@ AliBalancePsi::AliBalancePsi() :
   fHistResonancesLambda(0),
   fHistQbefore(0),
   fHistQafter(0),
+  fHistBinnedPairCheck(0),
   fPsiInterval(15.),
   fDeltaEtaMax(2.0),
   fMomentumOrdering(kTRUE),
@@ -92,7 +692,12 @@ AliBalancePsi::AliBalancePsi() :
   fVertexBinning(kFALSE),
   fCustomBinning(""),
   fBinningString(""),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fBinnedPairCounting(kFALSE),
+  fBinnedSubBins(8),
+  fBinnedMinPairs(20000),
+  fBinnedCheck(kFALSE),
+  fBinnedPairs(0){
   // Default constructor
 }
 
@@ -125,6 +730,7 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fHistResonancesLambda(balance.fHistResonancesLambda),
   fHistQbefore(balance.fHistQbefore),
   fHistQafter(balance.fHistQafter),
+  fHistBinnedPairCheck(balance.fHistBinnedPairCheck),
   fPsiInterval(balance.fPsiInterval),
   fDeltaEtaMax(balance.fDeltaEtaMax),
   fMomentumOrdering(balance.fMomentumOrdering),
@@ -138,7 +744,12 @@ AliBalancePsi::AliBalancePsi(const AliBalancePsi& balance):
   fVertexBinning(balance.fVertexBinning),
   fCustomBinning(balance.fCustomBinning),
   fBinningString(balance.fBinningString),
-  fEventClass("EventPlane"){
+  fEventClass("EventPlane"),
+  fBinnedPairCounting(balance.fBinnedPairCounting),
+  fBinnedSubBins(balance.fBinnedSubBins),
+  fBinnedMinPairs(balance.fBinnedMinPairs),
+  fBinnedCheck(balance.fBinnedCheck),
+  fBinnedPairs(0){
   //copy constructor
 }
 
@@ -167,7 +778,9 @@ AliBalancePsi::~AliBalancePsi() {
   delete fHistResonancesLambda;
   delete fHistQbefore;
   delete fHistQafter;
-    
+  delete fHistBinnedPairCheck;
+
+  delete fBinnedPairs;
 }
 
 //____________________________________________________________________//
@@ -408,6 +1021,8 @@ void AliBalancePsi::InitHistograms() {
   fHistResonancesLambda = new TH3D("fHistResonancesLambda","after #rho, K0, Lambda resonance cut;#Delta#eta;#Delta#phi;M_{inv}",50,-2.0,2.0,50,-TMath::Pi()/2.,3.*TMath::Pi()/2.,300,0,1.5);
   fHistQbefore          = new TH3D("fHistQbefore","before momentum difference cut;#Delta#eta;#Delta#phi;|#Delta p_{T}| (GeV/c)",50,-2.0,2.0,50,-TMath::Pi()/2.,3.*TMath::Pi()/2.,300,0,1.5);
   fHistQafter           = new TH3D("fHistQafter","after momentum difference cut;#Delta#eta;#Delta#phi;|#Delta p_{T}| (GeV/c)",50,-2.0,2.0,50,-TMath::Pi()/2.,3.*TMath::Pi()/2.,300,0,1.5);
+  if (fBinnedPairCounting && fBinnedCheck)
+    fHistBinnedPairCheck  = new TH1D("fHistBinnedPairCheck","binned pair counting vs pair loop;(binned - pair loop)/pair loop per (#Delta#eta,#Delta#phi) bin;bins",200,-1.,1.);
 
   TH1::AddDirectory(oldStatus);
 
@@ -476,6 +1091,11 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
   Double_t gWidthForLambda = 0.006;
   Double_t nSigmaRejection = 3.0;
 
+  // pair counting from the binned distributions (only without pair cuts)
+  Bool_t binnedPairs = (fBinnedPairCounting && !fResonancesCut && !fHBTCut && !fConversionCut && !fQCut &&
+			(particlesMixed || !fSameLabelMCCut) && InitBinnedPairCounting());
+  if (binnedPairs) fBinnedPairs->Reset();
+
   // 1st particle loop
   for (Int_t i = 0; i < iMax; i++) {
     //AliVParticle* firstParticle = (AliVParticle*) particles->At(i);
@@ -524,6 +1144,11 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
     //fill single particle histograms
     if(charge1 > 0)      fHistP->Fill(trackVariablesSingle,0,firstCorrection); //==========================correction
     else if(charge1 < 0) fHistN->Fill(trackVariablesSingle,0,firstCorrection);  //==========================correction
+
+    if (binnedPairs) {
+      fBinnedPairs->AddTrigger(firstEta,firstPhi,firstPt,charge1,firstCorrection,trackVariablesSingle[0],i);
+      continue;
+    }
     
     // 2nd particle loop
     for(Int_t j = 0; j < jMax; j++) {   
@@ -732,8 +1357,32 @@ void AliBalancePsi::CalculateBalance(Double_t gReactionPlane,
       }
     }//end of 2nd particle loop
   }//end of 1st particle loop
+
+  if (binnedPairs) {
+    for (Int_t j = 0; j < jMax; j++)
+      fBinnedPairs->AddAssociated(secondEta[j],secondPhi[j],secondPt[j],secondCharge[j],secondCorrection[j],j);
+    fBinnedPairs->Process(!particlesMixed,vertexZ);
+  }
 }  
 
+//____________________________________________________________________//
+Bool_t AliBalancePsi::InitBinnedPairCounting() {
+  // Create the binned pair counting (switched off if the binning of the pair histograms does not allow it)
+  if (fBinnedPairs) return kTRUE;
+
+  fBinnedPairs = new AliBalancePsiBinnedPairs(fHistPP,fHistPN,fHistNP,fHistNN,fBinnedSubBins,fBinnedMinPairs,fMomentumOrdering);
+  TString reason = fBinnedPairs->Init();
+  if (!reason.IsNull()) {
+    AliWarning(Form("Binned pair counting not possible: %s --> using the pair loop",reason.Data()));
+    fBinnedPairCounting = kFALSE;
+    delete fBinnedPairs;
+    fBinnedPairs = 0;
+    return kFALSE;
+  }
+  if (fBinnedCheck) fBinnedPairs->SetCheckHistogram(fHistBinnedPairCheck);
+  return kTRUE;
+}
+
 //____________________________________________________________________//
 TH1D *AliBalancePsi::GetBalanceFunctionHistogram(Int_t iVariableSingle,
 						 Int_t iVariablePair,
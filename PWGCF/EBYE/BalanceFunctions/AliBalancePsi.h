@@ -28,6 +28,7 @@ using std::vector;
 class TH1D;
 class TH2D;
 class TH3D;
+class AliBalancePsiBinnedPairs;
 
 const Int_t kTrackVariablesSingle = 3;       // track variables in histogram (event class, pTtrig, vertexZ)
 const Int_t kTrackVariablesPair   = 6;       // track variables in histogram (event class, dEta, dPhi, pTtrig, ptAssociated, vertexZ)
@@ -224,6 +225,7 @@ class AliBalancePsi : public TObject {
   TH3D *GetQAHistResonancesLambda() {return fHistResonancesLambda;}
   TH3D *GetQAHistQbefore() {return fHistQbefore;}
   TH3D *GetQAHistQafter() {return fHistQafter;}
+  TH1D *GetQAHistBinnedPairCheck() {return fHistBinnedPairCheck;}
 
   void UseMomentumOrdering(Bool_t momentumOrdering = kTRUE) {fMomentumOrdering = momentumOrdering;}
   void UseResonancesCut() {fResonancesCut = kTRUE;}
@@ -235,6 +237,19 @@ class AliBalancePsi : public TObject {
   void UseMomentumDifferenceCut(Double_t gDeltaPtCutMin) {
     fQCut = kTRUE; fDeltaPtMin = gDeltaPtCutMin;}
 
+  // pair counting from binned single particle distributions (2D FFT), used if no pair cut is active:
+  // - the eta and phi cells are 1/subBins of the Delta eta and Delta phi bins; all pairs of a cell offset
+  //   go to the bin of its centre, so a pair is counted at most one cell width away from its Delta eta,
+  //   Delta phi. Remaining bias: in each direction, 1/(4 subBins) of the pairs (3% for 8 cells) end up in
+  //   the neighbouring bin. This cancels for a distribution linear across the bin edges, otherwise it
+  //   smooths the distribution over one cell width (check with CheckBinnedPairCounting)
+  // - trigger/associated sets with at most minPairs pairs, or with fewer pairs than cells in the FFT grid,
+  //   still use the pair loop
+  void UseBinnedPairCounting(Int_t subBins = 8, Long64_t minPairs = 20000) {
+    fBinnedPairCounting = kTRUE; fBinnedSubBins = subBins; fBinnedMinPairs = minPairs;}
+  // compare the binned pair counting bin by bin with the pair loop (fHistBinnedPairCheck, slow: validation only)
+  void CheckBinnedPairCounting(Bool_t check = kTRUE) {fBinnedCheck = check;}
+
   // related to customized binning of output AliTHn
   Bool_t    IsUseVertexBinning() { return fVertexBinning; }
   TString   GetBinningString()   { return fBinningString; }
@@ -242,6 +257,7 @@ class AliBalancePsi : public TObject {
 
  private:
   Float_t   GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign); 
+  Bool_t    InitBinnedPairCounting();
 
   Bool_t fShuffle; //shuffled balance function object
   TString fAnalysisLevel; //ESD, AOD or MC
@@ -275,6 +291,7 @@ class AliBalancePsi : public TObject {
   TH3D *fHistResonancesLambda; // 3D histogram (Deta,Dphi,Invmass) after removing rho, K0, and Lambda
   TH3D *fHistQbefore; // Delta Eta vs. Delta Phi before cut on momentum difference
   TH3D *fHistQafter; // Delta Eta vs. Delta Phi after cut on momentum difference
+  TH1D *fHistBinnedPairCheck; // (binned - pair loop)/pair loop per Delta Eta, Delta Phi bin
 
   Double_t fPsiInterval;// interval in Psi-phi1
   Double_t fDeltaEtaMax;// maximum delta eta for output THnSparse
@@ -292,11 +309,17 @@ class AliBalancePsi : public TObject {
   TString fCustomBinning;//for setting customized binning
   TString fBinningString;//final binning string
 
+  Bool_t fBinnedPairCounting;//pair counting from binned single particle distributions
+  Int_t fBinnedSubBins;//number of eta (phi) cells per Delta eta (Delta phi) bin
+  Long64_t fBinnedMinPairs;//minimum number of pairs of a trigger/associated set for the binned pair counting
+  Bool_t fBinnedCheck;//compare the binned pair counting with the pair loop
+  AliBalancePsiBinnedPairs *fBinnedPairs;//! binned pair counting
+
   TString fEventClass;
 
   AliBalancePsi & operator=(const AliBalancePsi & ) {return *this;}
 
-  ClassDef(AliBalancePsi, 3)
+  ClassDef(AliBalancePsi, 5)
 };
 
 #endif
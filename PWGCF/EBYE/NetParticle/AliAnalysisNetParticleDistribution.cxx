@@ -20,6 +20,7 @@
 #include "AliAODTrack.h"
 #include "AliAODMCParticle.h"
 
+#include "AliEbyEMomentAccumulator.h"
 #include "AliAnalysisNetParticleDistribution.h"
 
 using namespace std;
@@ -53,6 +54,7 @@ AliAnalysisNetParticleDistribution::AliAnalysisNetParticleDistribution() :
   fMCNp(NULL),
   fMCNpPt(NULL),
   fRedFactp(NULL),
+  fUseMomentAccumulator(kFALSE),
   fHnTrackUnCorr(NULL) {
   // Constructor   
   
@@ -636,6 +638,17 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCent(const Char_t *name, con
 		     Form("(%s)/(%s) : %s;Centrality;(%s)/(%s)", sNetTitle.Data(), sSumTitle.Data(), sTitle.Data(), sNetTitle.Data(), sSumTitle.Data()), 
 		       nBinsCent, centBinRange[0], centBinRange[1], 41, -2.5, 2.49));
 
+  // -----------------------------------------------------------------------------------------------
+  // -- Add moment accumulator for <NetParticle^k> and <f_ik> for all SubSamples
+  //    replaces the TProfiles below
+  // -----------------------------------------------------------------------------------------------
+  if (fUseMomentAccumulator) {
+    list->Add(new AliEbyEMomentAccumulator(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()),
+					   Form("%s : %s", sNetTitle.Data(), sTitle.Data()),
+					   fOrder, fHelper->GetNSubSamples(), nBinsCent, centBinRange[0], centBinRange[1]));
+    return;
+  }
+
   // -----------------------------------------------------------------------------------------------
   // -- Add TProfiles for <NetParticle^k>
   // -----------------------------------------------------------------------------------------------
@@ -747,6 +760,18 @@ void  AliAnalysisNetParticleDistribution::AddHistSetCentPt(const Char_t *name, c
 		     Form("(%s)/(%s) : %s;Centrality;(%s)/(%s)", sNetTitle.Data(), sSumTitle.Data(), sTitle.Data(), sNetTitle.Data(), sSumTitle.Data()), 
 		     nBinsCent, centBinRange[0], centBinRange[1], nBinsPt, ptBinRange[0], ptBinRange[1], 41, -2.5, 2.49));
 
+  // -----------------------------------------------------------------------------------------------
+  // -- Add moment accumulator for <NetParticle^k> and <f_ik> for all SubSamples
+  //    replaces the TProfiles below
+  // -----------------------------------------------------------------------------------------------
+  if (fUseMomentAccumulator) {
+    list->Add(new AliEbyEMomentAccumulator(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()),
+					   Form("%s : %s", sNetTitle.Data(), sTitle.Data()),
+					   fOrder, fHelper->GetNSubSamples(), nBinsCent, centBinRange[0], centBinRange[1], 
+					   nBinsPt, ptBinRange[0], ptBinRange[1]));
+    return;
+  }
+
   // -----------------------------------------------------------------------------------------------
   // -- Add TProfiles for <NetParticle^k>
   // -----------------------------------------------------------------------------------------------
@@ -866,6 +891,12 @@ void AliAnalysisNetParticleDistribution::FillHistSetCent(const Char_t *name, Int
 
   // -----------------------------------------------------------------------------------------------
 
+  // -- Fill moment accumulator for <NetParticle^k> and <f_ik>
+  if (fUseMomentAccumulator) {
+    (static_cast<AliEbyEMomentAccumulator*>(list->FindObject(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()))))->Fill(centralityBin, fHelper->GetSubSampleIdx(), np[idx][1], np[idx][0]);
+    return;
+  }
+
   // -- Fill TProfile for <NetParticle^k>
   Double_t delta = 1.;
   for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
@@ -925,6 +956,10 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
   // -- Select MC or Data
   Int_t ***npPt = (isMC) ? fMCNpPt : fNpPt;
 
+  // -- Get moment accumulator
+  AliEbyEMomentAccumulator *moments = (fUseMomentAccumulator) ? 
+    static_cast<AliEbyEMomentAccumulator*>(list->FindObject(Form("m%sNet%s", name, fHelper->GetParticleName(1).Data()))) : NULL;
+
   // -----------------------------------------------------------------------------------------------
 
   // -- Loop over the pt bins
@@ -946,6 +981,12 @@ void AliAnalysisNetParticleDistribution::FillHistSetCentPt(const Char_t *name, I
 
     // -----------------------------------------------------------------------------------------------
 
+    // -- Fill moment accumulator for <NetParticle^k> and <f_ik>
+    if (moments) {
+      moments->Fill(centralityBin, idxPt, fHelper->GetSubSampleIdx(), npPt[idx][1][idxPt], npPt[idx][0][idxPt]);
+      continue;
+    }
+
     // -- Fill TProfile for <NetParticle^k>
     Double_t delta = 1.;
     for (Int_t idxOrder = 1; idxOrder <= fOrder; ++idxOrder) {
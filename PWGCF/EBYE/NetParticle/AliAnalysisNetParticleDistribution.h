@@ -42,6 +42,9 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
 
   void SetOutList(TList* l) {fOutList = l;}
 
+  /** Use AliEbyEMomentAccumulator instead of TProfiles for <NetParticle^k> and <f_ik> */
+  void SetUseMomentAccumulator(Bool_t b) {fUseMomentAccumulator = b;}
+
   ///////////////////////////////////////////////////////////////////////////////////
 
  private:
@@ -109,11 +112,13 @@ class AliAnalysisNetParticleDistribution : public AliAnalysisNetParticleBase {
   Int_t              ***fMCNpPt;                //  Array of MC particle/anti-particle per ptBin counts
   // -----------------------------------------------------------------------
   Double_t            **fRedFactp;              //  Array of particle/anti-particle reduced factorial
+  // -----------------------------------------------------------------------
+  Bool_t                fUseMomentAccumulator;  //  Fill moment accumulators instead of TProfiles
   // =======================================================================
   THnSparseD           *fHnTrackUnCorr;         //  THnSparseD : uncorrected probe particles
   // -----------------------------------------------------------------------
 
-  ClassDef(AliAnalysisNetParticleDistribution, 1);
+  ClassDef(AliAnalysisNetParticleDistribution, 2);
 };
 
 #endif
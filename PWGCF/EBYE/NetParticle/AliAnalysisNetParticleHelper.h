@@ -252,7 +252,7 @@ class AliAnalysisNetParticleHelper : public TNamed {
    *                             Members - private
    * ---------------------------------------------------------------------------------
    */
-  Int_t                 fModeDistCreation;         //  Dist creation mode       : 1 = on | 0 = off 
+  Int_t                 fModeDistCreation;         //  Dist creation mode       : 2 = on, with moment accumulators | 1 = on | 0 = off 
   // =======================================================================
   AliInputEventHandler *fInputEventHandler;        //! Ptr to input event handler (ESD or AOD)
   AliPIDResponse       *fPIDResponse;              //! Ptr to PID response Object
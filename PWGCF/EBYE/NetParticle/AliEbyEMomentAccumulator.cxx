@@ -0,0 +1,388 @@
+//-*- Mode: C++ -*-
+
+#include "TMath.h"
+#include "TCollection.h"
+#include "TH1D.h"
+#include "TH2D.h"
+
+#include "AliLog.h"
+
+#include "AliEbyEMomentAccumulator.h"
+
+using namespace std;
+
+/**
+ * Event-by-event moment accumulator with subsampling
+ * -- Replaces the TProfiles of <(N1-N2)^k> and <f_ik> per subsample
+ *    by one flat array of sums, filled with a single bin lookup per event
+ */
+
+ClassImp(AliEbyEMomentAccumulator)
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                            Constructor / Destructor
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+AliEbyEMomentAccumulator::AliEbyEMomentAccumulator() :
+  TNamed(),
+  fOrder(0),
+  fNSubSamples(0),
+  fNBinsX(0),
+  fXMin(0.),
+  fXMax(0.),
+  fNBinsY(0),
+  fYMin(0.),
+  fYMax(0.),
+  fSums() {
+  // Default constructor - for I/O
+}
+
+//________________________________________________________________________
+AliEbyEMomentAccumulator::AliEbyEMomentAccumulator(const char *name, const char *title, Int_t order, Int_t nSubSamples,
+						   Int_t nBinsX, Double_t xMin, Double_t xMax,
+						   Int_t nBinsY, Double_t yMin, Double_t yMax) :
+  TNamed(name, title),
+  fOrder(order),
+  fNSubSamples(nSubSamples),
+  fNBinsX(nBinsX),
+  fXMin(xMin),
+  fXMax(xMax),
+  fNBinsY(nBinsY),
+  fYMin(yMin),
+  fYMax(yMax),
+  fSums() {
+  // Constructor
+
+  if (fOrder < 1 || fOrder > fgkMaxOrder) {
+    AliWarningF("Order %d out of range [1,%d] - set to %d", fOrder, fgkMaxOrder, fgkMaxOrder);
+    fOrder = fgkMaxOrder;
+  }
+  if (fNSubSamples < 1) fNSubSamples = 1;
+  if (fNBinsX < 1)      fNBinsX      = 1;
+  if (fNBinsY < 1)      fNBinsY      = 1;
+
+  fSums.Set(fNSubSamples * fNBinsX * fNBinsY * CellSize());
+}
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                                 Fill / Merge
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+Int_t AliEbyEMomentAccumulator::FindBin(Double_t x, Double_t y) const {
+  // -- Get flat bin index (x fastest), -1 if outside
+
+  if (x < fXMin || x >= fXMax || y < fYMin || y >= fYMax)
+    return -1;
+
+  Int_t ix = Int_t(fNBinsX * (x - fXMin) / (fXMax - fXMin));
+  Int_t iy = Int_t(fNBinsY * (y - fYMin) / (fYMax - fYMin));
+  if (ix >= fNBinsX) ix = fNBinsX - 1;
+  if (iy >= fNBinsY) iy = fNBinsY - 1;
+
+  return ix + fNBinsX * iy;
+}
+
+//________________________________________________________________________
+void AliEbyEMomentAccumulator::Fill(Double_t x, Double_t y, Int_t subSample, Int_t n1, Int_t n2) {
+  // -- Add one event with n1 particles and n2 anti-particles
+
+  Int_t bin = FindBin(x, y);
+  if (bin < 0 || subSample < 0 || subSample >= fNSubSamples)
+    return;
+
+  Double_t *cell = fSums.GetArray() + (Long64_t(subSample) * GetNBins() + bin) * CellSize();
+
+  // -- Number of events
+  cell[PowIdx(0)] += 1.;
+
+  // -- Power sums of the net number
+  Double_t delta = n1 - n2;
+  Double_t pow   = 1.;
+  for (Int_t ii = 1; ii <= fOrder; ++ii) {
+    pow *= delta;
+    cell[PowIdx(ii)] += pow;
+  }
+
+  // -- Reduced factorials n!/(n-i)!
+  Double_t redFact1[fgkMaxOrder+1];
+  Double_t redFact2[fgkMaxOrder+1];
+  redFact1[0] = 1.;
+  redFact2[0] = 1.;
+  for (Int_t ii = 1; ii <= fOrder; ++ii) {
+    redFact1[ii] = redFact1[ii-1] * Double_t(n1-(ii-1));
+    redFact2[ii] = redFact2[ii-1] * Double_t(n2-(ii-1));
+  }
+
+  // -- Sums of f_ik and number of non-zero f_ik
+  for (Int_t ii = 0; ii <= fOrder; ++ii) {   // ii -> n1
+    if (redFact1[ii] == 0.) break;           // all higher orders vanish as well
+    for (Int_t kk = 0; kk <= fOrder; ++kk) { // kk -> n2
+      Double_t fik = redFact1[ii] * redFact2[kk];
+      if (fik == 0.) break;
+      cell[FikIdx(ii, kk)] += fik;
+      cell[CntIdx(ii, kk)] += 1.;
+    }
+  }
+}
+
+//________________________________________________________________________
+Long64_t AliEbyEMomentAccumulator::Merge(TCollection *list) {
+  // -- Merge accumulators with the same layout
+
+  if (!list)
+    return 0;
+
+  TIter next(list);
+  TObject *obj = NULL;
+  while ((obj = next())) {
+    AliEbyEMomentAccumulator *other = dynamic_cast<AliEbyEMomentAccumulator*>(obj);
+    if (!other || other == this)
+      continue;
+
+    if (other->fOrder != fOrder || other->fNSubSamples != fNSubSamples ||
+	other->fNBinsX != fNBinsX || other->fNBinsY != fNBinsY || other->fSums.GetSize() != fSums.GetSize()) {
+      AliErrorF("Cannot merge %s : different layout", other->GetName());
+      continue;
+    }
+
+    Double_t       *sums      = fSums.GetArray();
+    const Double_t *otherSums = other->fSums.GetArray();
+    for (Int_t idx = 0; idx < fSums.GetSize(); ++idx)
+      sums[idx] += otherSums[idx];
+  }
+
+  Double_t nEvents = 0.;
+  for (Int_t bin = 0; bin < GetNBins(); ++bin)
+    nEvents += GetNEvents(bin);
+
+  return Long64_t(nEvents);
+}
+
+//________________________________________________________________________
+void AliEbyEMomentAccumulator::Reset(Option_t * /*option*/) {
+  // -- Reset all sums
+
+  fSums.Reset();
+}
+
+/*
+ * ---------------------------------------------------------------------------------
+ *                                 Results
+ * ---------------------------------------------------------------------------------
+ */
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::Sum(Int_t idx, Int_t bin, Int_t subSample) const {
+  // -- Sum of a cell entry over one (subSample >= 0) or all subsamples
+
+  if (bin < 0 || bin >= GetNBins() || subSample >= fNSubSamples)
+    return 0.;
+
+  Int_t firstSub = (subSample < 0) ? 0 : subSample;
+  Int_t lastSub  = (subSample < 0) ? fNSubSamples - 1 : subSample;
+
+  Double_t sum = 0.;
+  for (Int_t idxSub = firstSub; idxSub <= lastSub; ++idxSub)
+    sum += fSums[(idxSub * GetNBins() + bin) * CellSize() + idx];
+
+  return sum;
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetNEvents(Int_t bin, Int_t subSample) const {
+  // -- Number of events
+
+  return Sum(PowIdx(0), bin, subSample);
+}
+
+//________________________________________________________________________
+Bool_t AliEbyEMomentAccumulator::RawMoments(Int_t bin, Int_t subSample, Double_t *raw) const {
+  // -- Raw moments <(N1-N2)^i>, i = 0..fOrder
+
+  Double_t nEvents = GetNEvents(bin, subSample);
+  if (nEvents <= 0.)
+    return kFALSE;
+
+  raw[0] = 1.;
+  for (Int_t ii = 1; ii <= fOrder; ++ii)
+    raw[ii] = Sum(PowIdx(ii), bin, subSample) / nEvents;
+
+  return kTRUE;
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetMoment(EMoment_t type, Int_t i, Int_t k, Int_t bin, Int_t subSample) const {
+  // -- Get moment of order i (and k for factorial moments)
+  //    returns 0 if there are no events
+
+  if (i < 0 || i > fOrder || k < 0 || k > fOrder)
+    return 0.;
+
+  if (type == kFactorial) {
+    Double_t nEvents = GetNEvents(bin, subSample);
+    return (nEvents > 0.) ? Sum(FikIdx(i, k), bin, subSample) / nEvents : 0.;
+  }
+
+  Double_t raw[fgkMaxOrder+1];
+  if (!RawMoments(bin, subSample, raw))
+    return 0.;
+
+  if (type == kRaw)
+    return raw[i];
+
+  if (type == kCentral) {
+    // -- mu_i = sum_j C(i,j) (-mu'_1)^(i-j) mu'_j
+    Double_t central = 0.;
+    for (Int_t jj = 0; jj <= i; ++jj)
+      central += TMath::Binomial(i, jj) * TMath::Power(-raw[1], i-jj) * raw[jj];
+    return central;
+  }
+
+  // -- kappa_n = mu'_n - sum_{m=1}^{n-1} C(n-1,m-1) kappa_m mu'_(n-m)
+  Double_t kappa[fgkMaxOrder+1];
+  kappa[0] = 0.;
+  for (Int_t nn = 1; nn <= i; ++nn) {
+    kappa[nn] = raw[nn];
+    for (Int_t mm = 1; mm < nn; ++mm)
+      kappa[nn] -= TMath::Binomial(nn-1, mm-1) * kappa[mm] * raw[nn-mm];
+  }
+  return kappa[i];
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetCumulantRatio(Int_t n, Int_t m, Int_t bin, Int_t subSample) const {
+  // -- Get kappa_n / kappa_m, 0 if kappa_m vanishes
+
+  Double_t denominator = GetMoment(kCumulant, m, 0, bin, subSample);
+  return (denominator != 0.) ? GetMoment(kCumulant, n, 0, bin, subSample) / denominator : 0.;
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetNonZeroFraction(Int_t i, Int_t k, Int_t bin, Int_t subSample) const {
+  // -- Fraction of events with non-zero f_ik
+
+  if (i < 0 || i > fOrder || k < 0 || k > fOrder)
+    return 0.;
+
+  Double_t nEvents = GetNEvents(bin, subSample);
+  return (nEvents > 0.) ? Sum(CntIdx(i, k), bin, subSample) / nEvents : 0.;
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::SubSampleError(const Double_t *values, const Bool_t *valid) const {
+  // -- Standard error of the mean of the valid subsample values
+
+  Int_t    nValid = 0;
+  Double_t mean   = 0.;
+  for (Int_t idxSub = 0; idxSub < fNSubSamples; ++idxSub) {
+    if (!valid[idxSub]) continue;
+    mean += values[idxSub];
+    ++nValid;
+  }
+  if (nValid < 2)
+    return 0.;
+  mean /= nValid;
+
+  Double_t variance = 0.;
+  for (Int_t idxSub = 0; idxSub < fNSubSamples; ++idxSub) {
+    if (!valid[idxSub]) continue;
+    variance += (values[idxSub] - mean) * (values[idxSub] - mean);
+  }
+
+  return TMath::Sqrt(variance / (nValid * (nValid - 1.)));
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetMomentError(EMoment_t type, Int_t i, Int_t k, Int_t bin) const {
+  // -- Subsample error of a moment
+
+  Double_t *values = new Double_t[fNSubSamples];
+  Bool_t   *valid  = new Bool_t[fNSubSamples];
+  for (Int_t idxSub = 0; idxSub < fNSubSamples; ++idxSub) {
+    valid[idxSub]  = (GetNEvents(bin, idxSub) > 0.);
+    values[idxSub] = (valid[idxSub]) ? GetMoment(type, i, k, bin, idxSub) : 0.;
+  }
+
+  Double_t error = SubSampleError(values, valid);
+
+  delete[] values;
+  delete[] valid;
+  return error;
+}
+
+//________________________________________________________________________
+Double_t AliEbyEMomentAccumulator::GetCumulantRatioError(Int_t n, Int_t m, Int_t bin) const {
+  // -- Subsample error of kappa_n / kappa_m
+
+  Double_t *values = new Double_t[fNSubSamples];
+  Bool_t   *valid  = new Bool_t[fNSubSamples];
+  for (Int_t idxSub = 0; idxSub < fNSubSamples; ++idxSub) {
+    valid[idxSub]  = (GetNEvents(bin, idxSub) > 0.) && (GetMoment(kCumulant, m, 0, bin, idxSub) != 0.);
+    values[idxSub] = (valid[idxSub]) ? GetCumulantRatio(n, m, bin, idxSub) : 0.;
+  }
+
+  Double_t error = SubSampleError(values, valid);
+
+  delete[] values;
+  delete[] valid;
+  return error;
+}
+
+//________________________________________________________________________
+TH1* AliEbyEMomentAccumulator::MakeHistogram(const char *name, const char *title) const {
+  // -- Create empty result histogram : TH1D in x, or TH2D in x and y
+
+  TH1 *hist = NULL;
+  if (fNBinsY == 1)
+    hist = new TH1D(name, title, fNBinsX, fXMin, fXMax);
+  else
+    hist = new TH2D(name, title, fNBinsX, fXMin, fXMax, fNBinsY, fYMin, fYMax);
+  hist->SetDirectory(0);
+
+  return hist;
+}
+
+//________________________________________________________________________
+TH1* AliEbyEMomentAccumulator::MakeMomentHistogram(const char *name, EMoment_t type, Int_t i, Int_t k) const {
+  // -- Moment vs. bin with subsample errors
+
+  static const Char_t *typeName[] = {"#LT(N_{1}-N_{2})^{%d}#GT", "#mu_{%d}", "#kappa_{%d}", "#LTf_{%d%d}#GT"};
+  TString sTitle(Form(typeName[type], i, k));
+
+  TH1 *hist = MakeHistogram(name, Form("%s : %s", sTitle.Data(), GetTitle()));
+  for (Int_t iy = 0; iy < fNBinsY; ++iy) {
+    for (Int_t ix = 0; ix < fNBinsX; ++ix) {
+      Int_t bin     = ix + fNBinsX * iy;
+      Int_t histBin = (fNBinsY == 1) ? hist->GetBin(ix+1) : hist->GetBin(ix+1, iy+1);
+      if (GetNEvents(bin) <= 0.) continue;
+      hist->SetBinContent(histBin, GetMoment(type, i, k, bin));
+      hist->SetBinError(histBin, GetMomentError(type, i, k, bin));
+    }
+  }
+
+  return hist;
+}
+
+//________________________________________________________________________
+TH1* AliEbyEMomentAccumulator::MakeCumulantRatioHistogram(const char *name, Int_t n, Int_t m) const {
+  // -- kappa_n / kappa_m vs. bin with subsample errors
+
+  TH1 *hist = MakeHistogram(name, Form("#kappa_{%d}/#kappa_{%d} : %s", n, m, GetTitle()));
+  for (Int_t iy = 0; iy < fNBinsY; ++iy) {
+    for (Int_t ix = 0; ix < fNBinsX; ++ix) {
+      Int_t bin     = ix + fNBinsX * iy;
+      Int_t histBin = (fNBinsY == 1) ? hist->GetBin(ix+1) : hist->GetBin(ix+1, iy+1);
+      if (GetNEvents(bin) <= 0.) continue;
+      hist->SetBinContent(histBin, GetCumulantRatio(n, m, bin));
+      hist->SetBinError(histBin, GetCumulantRatioError(n, m, bin));
+    }
+  }
+
+  return hist;
+}
@@ -0,0 +1,128 @@
+//-*- Mode: C++ -*-
+
+#ifndef ALIEBYEMOMENTACCUMULATOR_H
+#define ALIEBYEMOMENTACCUMULATOR_H
+
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+/**
+ * Event-by-event moment accumulator with subsampling
+ * -- Holds per subsample and bin the number of events, the power sums
+ *    of the net number N1-N2 and the sums of the factorial products
+ *    f_ik = N1!/(N1-i)! * N2!/(N2-k)!
+ * -- Filled once per event, raw / central / factorial moments, cumulants,
+ *    cumulant ratios and their subsample errors are computed from the sums
+ *    (e.g. at Terminate)
+ * -- Mergeable, replaces one TProfile per moment and subsample
+ */
+
+#include "TNamed.h"
+#include "TArrayD.h"
+
+class TCollection;
+class TH1;
+
+class AliEbyEMomentAccumulator : public TNamed {
+
+ public:
+
+  /** Type of moment */
+  enum EMoment_t {
+    kRaw,         // <(N1-N2)^i>
+    kCentral,     // <(N1-N2 - <N1-N2>)^i>
+    kCumulant,    // kappa_i of N1-N2
+    kFactorial    // <f_ik>
+  };
+
+  static const Int_t fgkMaxOrder = 16; // Maximum order
+
+  AliEbyEMomentAccumulator();
+  AliEbyEMomentAccumulator(const char *name, const char *title, Int_t order, Int_t nSubSamples,
+			   Int_t nBinsX, Double_t xMin, Double_t xMax,
+			   Int_t nBinsY = 1, Double_t yMin = 0., Double_t yMax = 1.);
+  virtual ~AliEbyEMomentAccumulator() {}
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                 Fill / Merge
+   * ---------------------------------------------------------------------------------
+   */
+
+  /** Add one event with N1 particles and N2 anti-particles */
+  void     Fill(Double_t x, Int_t subSample, Int_t n1, Int_t n2)              { Fill(x, 0.5*(fYMin+fYMax), subSample, n1, n2); }
+  void     Fill(Double_t x, Double_t y, Int_t subSample, Int_t n1, Int_t n2);
+
+  /** Merge accumulators with the same layout */
+  Long64_t Merge(TCollection *list);
+
+  /** Reset all sums */
+  void     Reset(Option_t *option = "");
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                 Results
+   * ---------------------------------------------------------------------------------
+   *  bin       : FindBin(x, y)
+   *  subSample : -1 = all subsamples
+   */
+
+  Int_t    FindBin(Double_t x, Double_t y = 0.) const;
+
+  Double_t GetNEvents(Int_t bin, Int_t subSample = -1) const;
+  Double_t GetMoment(EMoment_t type, Int_t i, Int_t k, Int_t bin, Int_t subSample = -1) const;
+  Double_t GetCumulantRatio(Int_t n, Int_t m, Int_t bin, Int_t subSample = -1) const;
+  Double_t GetNonZeroFraction(Int_t i, Int_t k, Int_t bin, Int_t subSample = -1) const;
+
+  /** Standard error of the mean of the subsample results */
+  Double_t GetMomentError(EMoment_t type, Int_t i, Int_t k, Int_t bin) const;
+  Double_t GetCumulantRatioError(Int_t n, Int_t m, Int_t bin) const;
+
+  /** Histograms vs. x (or x and y) with subsample errors - owned by the caller */
+  TH1*     MakeMomentHistogram(const char *name, EMoment_t type, Int_t i, Int_t k = 0) const;
+  TH1*     MakeCumulantRatioHistogram(const char *name, Int_t n, Int_t m) const;
+
+  /*
+   * ---------------------------------------------------------------------------------
+   *                                 Getter
+   * ---------------------------------------------------------------------------------
+   */
+
+  Int_t    GetOrder()         const {return fOrder;}
+  Int_t    GetNSubSamples()   const {return fNSubSamples;}
+  Int_t    GetNBins()         const {return fNBinsX*fNBinsY;}
+
+  ///////////////////////////////////////////////////////////////////////////////////
+
+ private:
+
+  /** Size of one cell (bin, subsample) */
+  Int_t    CellSize()         const {return 1 + fOrder + 2*(fOrder+1)*(fOrder+1);}
+  /** Offsets inside a cell */
+  Int_t    PowIdx(Int_t i)                const {return i;}
+  Int_t    FikIdx(Int_t i, Int_t k)       const {return 1 + fOrder + i*(fOrder+1) + k;}
+  Int_t    CntIdx(Int_t i, Int_t k)       const {return 1 + fOrder + (fOrder+1)*(fOrder+1) + i*(fOrder+1) + k;}
+
+  /** Sum of a cell entry over one or all subsamples */
+  Double_t Sum(Int_t idx, Int_t bin, Int_t subSample) const;
+  /** Raw moments <(N1-N2)^i>, i = 0..order */
+  Bool_t   RawMoments(Int_t bin, Int_t subSample, Double_t *raw) const;
+  /** Standard error of the mean of per subsample values */
+  Double_t SubSampleError(const Double_t *values, const Bool_t *valid) const;
+  /** Create empty result histogram */
+  TH1*     MakeHistogram(const char *name, const char *title) const;
+
+  Int_t    fOrder;              //  Maximum order
+  Int_t    fNSubSamples;        //  Number of subsamples
+  Int_t    fNBinsX;             //  Number of bins in x (e.g. centrality)
+  Double_t fXMin;               //  Lower edge in x
+  Double_t fXMax;               //  Upper edge in x
+  Int_t    fNBinsY;             //  Number of bins in y (e.g. pt bin)
+  Double_t fYMin;               //  Lower edge in y
+  Double_t fYMax;               //  Upper edge in y
+  TArrayD  fSums;               //  Sums: [subsample][bin][cell]
+
+  ClassDef(AliEbyEMomentAccumulator, 1);
+};
+
+#endif
@@ -74,6 +74,7 @@
 #pragma link C++ class AliAnalysisNetParticleEffCont+;
 #pragma link C++ class AliAnalysisNetParticleHelper+;
 #pragma link C++ class AliAnalysisTaskNetParticle+;
+#pragma link C++ class AliEbyEMomentAccumulator+;
 
 #pragma link C++ class AliAnalysisTempFluc+;
 
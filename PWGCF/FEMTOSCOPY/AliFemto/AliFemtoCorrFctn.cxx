@@ -34,6 +34,23 @@ void AliFemtoCorrFctn::AddMixedPair(AliFemtoPair*)
   cout << "AliFemtoCorrFctn::AddMixedPair -- Not implemented\n";
 }
 
+void AliFemtoCorrFctn::AddRealPairs(AliFemtoPairBatch& batch)
+{
+  for (UInt_t i = 0; i < batch.Size(); ++i) {
+    AddRealPair(batch.Pair(i));
+  }
+}
+void AliFemtoCorrFctn::AddMixedPairs(AliFemtoPairBatch& batch)
+{
+  for (UInt_t i = 0; i < batch.Size(); ++i) {
+    AddMixedPair(batch.Pair(i));
+  }
+}
+bool AliFemtoCorrFctn::UsesPairBatch(bool) const
+{
+  return false;
+}
+
 void AliFemtoCorrFctn::AddFirstParticle(AliFemtoParticle*, bool)
 {
   cout << "AliFemtoCorrFctn::AddFirstParticle -- Not implemented\n";
@@ -10,6 +10,7 @@
 #include "AliFemtoAnalysis.h"
 #include "AliFemtoEvent.h"
 #include "AliFemtoPair.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoPairCut.h"
 
 
@@ -42,6 +43,20 @@ public:
   /// Not Implemented - Add background pair
   virtual void AddMixedPair(AliFemtoPair* aPir);
 
+  /// Add a block of signal pairs which passed the analysis pair cut.
+  /// The default implementation calls AddRealPair on every pair; correlation
+  /// functions may override it to fill directly from the precomputed
+  /// kinematics of the batch.
+  virtual void AddRealPairs(AliFemtoPairBatch& aBatch);
+  /// Add a block of background pairs - see AddRealPairs
+  virtual void AddMixedPairs(AliFemtoPairBatch& aBatch);
+
+  /// True if AddRealPairs (mixed=false) / AddMixedPairs (mixed=true) is
+  /// implemented for this function and only fills its own histograms, so
+  /// that it may receive a block at once. The other functions are given the
+  /// pairs one by one, in the order of the per-pair loop.
+  virtual bool UsesPairBatch(bool mixed) const;
+
   /// Not Implemented - Add pair with optional
   virtual void AddFirstParticle(AliFemtoParticle *particle, bool mixing);
   virtual void AddSecondParticle(AliFemtoParticle *particle);
@@ -33,6 +33,13 @@ bool AliFemtoDummyPairCut::Pass(const AliFemtoPair* /* pair */)
   return true;
 }
 //__________________
+void AliFemtoDummyPairCut::PassBatch(AliFemtoPairBatch &batch, std::vector<bool> &pass)
+{
+  // Pass all pairs of the block
+  pass.assign(batch.Size(), true);
+  fNPairsPassed += batch.Size();
+}
+//__________________
 AliFemtoString AliFemtoDummyPairCut::Report()
 {
   // prepare a report from the execution
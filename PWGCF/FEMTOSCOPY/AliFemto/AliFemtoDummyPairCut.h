@@ -82,6 +82,7 @@ public:
   AliFemtoDummyPairCut& operator=(const AliFemtoDummyPairCut&);
 
   virtual bool Pass(const AliFemtoPair*);
+  virtual void PassBatch(AliFemtoPairBatch &batch, std::vector<bool> &pass);
   virtual AliFemtoString Report();
   virtual TList *ListSettings();
   AliFemtoDummyPairCut* Clone();
@@ -153,16 +153,31 @@ void AliFemtoKTPairCut::SetPTMin(double ptmin, double ptmax)
 //______________________________________________________
 bool AliFemtoKTPairCut::Pass(const AliFemtoPair* pair)
 {
-  bool temp = true;
-
 //Taking care of the Kt cut
   if (pair->KT() < fKTMin)
-    temp = false;
+    return false;
 
   if (pair->KT() > fKTMax)
-    temp = false;
+    return false;
+
+  return PassPtAndPhi(pair);
+}
 
-  if (!temp) return temp;
+void AliFemtoKTPairCut::PassBatch(AliFemtoPairBatch &batch, std::vector<bool> &pass)
+{
+  // kT cut on the kT of the block, the single-particle pT and reaction-plane
+  // cuts only for the pairs in the kT range
+  const UInt_t n = batch.Size();
+  const double *kt = batch.KT();
+  pass.resize(n);
+  for (UInt_t i = 0; i < n; ++i) {
+    pass[i] = !(kt[i] < fKTMin) && !(kt[i] > fKTMax) && PassPtAndPhi(batch.Pair(i));
+  }
+}
+
+bool AliFemtoKTPairCut::PassPtAndPhi(const AliFemtoPair* pair)
+{
+  bool temp = true;
 
   if ((fPtMin > 0.0) || (fPtMax<1000.0)) {
 //     double px1 = pair->Track1()->Track()->P().x();
@@ -0,0 +1,117 @@
+///
+/// \file AliFemtoPairBatch.cxx
+///
+
+#include "AliFemtoPairBatch.h"
+
+#include <TMath.h>
+
+
+AliFemtoPairBatch::AliFemtoPairBatch(UInt_t capacity):
+  fPairs(capacity > 0 ? capacity : 1),
+  fQInv(fPairs.size()),
+  fKT(fPairs.size()),
+  fMInv(fPairs.size()),
+  fQOut(fPairs.size()),
+  fQSide(fPairs.size()),
+  fQLong(fPairs.size()),
+  fDEta(fPairs.size()),
+  fDPhi(fPairs.size()),
+  fSize(0),
+  fComputed(0)
+{
+}
+
+AliFemtoPairBatch::~AliFemtoPairBatch()
+{ /* no-op */
+}
+
+// The AliFemtoPair formulas are used as-is so that the values are
+// bit-identical to what the per-pair interface returns
+
+void AliFemtoPairBatch::ComputeQInv()
+{
+  for (UInt_t i = 0; i < fSize; ++i) {
+    fQInv[i] = fPairs[i].QInv();
+  }
+  fComputed |= kQInv;
+}
+
+void AliFemtoPairBatch::ComputeKT()
+{
+  for (UInt_t i = 0; i < fSize; ++i) {
+    fKT[i] = fPairs[i].KT();
+  }
+  fComputed |= kKT;
+}
+
+void AliFemtoPairBatch::ComputeMInv()
+{
+  for (UInt_t i = 0; i < fSize; ++i) {
+    fMInv[i] = fPairs[i].MInv();
+  }
+  fComputed |= kMInv;
+}
+
+void AliFemtoPairBatch::ComputeLCMS()
+{
+  for (UInt_t i = 0; i < fSize; ++i) {
+    const AliFemtoPair &pair = fPairs[i];
+    fQOut[i] = pair.QOutCMS();
+    fQSide[i] = pair.QSideCMS();
+    fQLong[i] = pair.QLongCMS();
+  }
+  fComputed |= kLCMS;
+}
+
+void AliFemtoPairBatch::ComputeDEtaDPhi()
+{
+  for (UInt_t i = 0; i < fSize; ++i) {
+    const AliFemtoPair &pair = fPairs[i];
+    const AliFemtoLorentzVector &p1 = pair.Track1()->FourMomentum(),
+                                &p2 = pair.Track2()->FourMomentum();
+
+    fDEta[i] = p2.PseudoRapidity() - p1.PseudoRapidity();
+
+    double dphi = p2.Phi() - p1.Phi();
+    while (dphi < -TMath::Pi()) dphi += TMath::TwoPi();
+    while (dphi >= TMath::Pi()) dphi -= TMath::TwoPi();
+    fDPhi[i] = dphi;
+  }
+  fComputed |= kDEtaDPhi;
+}
+
+void AliFemtoPairBatch::Compact(const std::vector<bool> &pass)
+{
+  // only the arrays computed so far are moved, the others stay lazy
+  UInt_t out = 0;
+  for (UInt_t i = 0; i < fSize; ++i) {
+    if (!pass[i]) {
+      continue;
+    }
+    if (out != i) {
+      fPairs[out].SetTrack1(fPairs[i].Track1());
+      fPairs[out].SetTrack2(fPairs[i].Track2());
+      if (fComputed & kQInv) {
+        fQInv[out] = fQInv[i];
+      }
+      if (fComputed & kKT) {
+        fKT[out] = fKT[i];
+      }
+      if (fComputed & kMInv) {
+        fMInv[out] = fMInv[i];
+      }
+      if (fComputed & kLCMS) {
+        fQOut[out] = fQOut[i];
+        fQSide[out] = fQSide[i];
+        fQLong[out] = fQLong[i];
+      }
+      if (fComputed & kDEtaDPhi) {
+        fDEta[out] = fDEta[i];
+        fDPhi[out] = fDPhi[i];
+      }
+    }
+    ++out;
+  }
+  fSize = out;
+}
@@ -0,0 +1,108 @@
+///
+/// \file AliFemtoPairBatch.h
+///
+
+#ifndef ALIFEMTOPAIRBATCH_H
+#define ALIFEMTOPAIRBATCH_H
+
+#include <vector>
+
+#include "AliFemtoPair.h"
+
+
+/// \class AliFemtoPairBatch
+/// \brief A block of pairs with their standard kinematics in SoA layout
+///
+/// The pair engine of AliFemtoSimpleAnalysis::MakePairs collects pairs into
+/// this block, runs the pair cut on the block and hands the surviving pairs
+/// to the correlation functions via AliFemtoCorrFctn::AddRealPairs and
+/// AliFemtoCorrFctn::AddMixedPairs.
+///
+/// The standard pair kinematics (qinv, kT, minv, LCMS components, delta-eta
+/// and delta-phi) are computed with the formulas of AliFemtoPair the first
+/// time their array is requested, for all pairs of the block at once - a
+/// quantity which no cut or correlation function asks for is never computed.
+///
+/// The AliFemtoPair objects are kept alongside the arrays, so correlation
+/// functions which need more than the precomputed quantities can still use
+/// the full pair interface.
+///
+class AliFemtoPairBatch {
+public:
+
+  /// Create an empty batch able to hold `capacity` pairs before a flush
+  AliFemtoPairBatch(UInt_t capacity=512);
+  virtual ~AliFemtoPairBatch();
+
+  /// Append pair (p1, p2) - returns true if the batch is now full
+  bool Add(const AliFemtoParticle* p1, const AliFemtoParticle* p2);
+
+  /// Keep only the pairs with pass[i] true, preserving order
+  void Compact(const std::vector<bool> &pass);
+
+  /// Remove all pairs (keeps the allocated storage)
+  void Clear();
+
+  UInt_t Size() const { return fSize; }
+  UInt_t Capacity() const { return fPairs.size(); }
+  bool Empty() const { return fSize == 0; }
+  bool Full() const { return fSize == fPairs.size(); }
+
+  AliFemtoPair* Pair(UInt_t i) { return &fPairs[i]; }
+  const AliFemtoPair* Pair(UInt_t i) const { return &fPairs[i]; }
+
+  // SoA accessors - the array is computed on the first call for the block
+  const double* QInv() { if (!(fComputed & kQInv)) ComputeQInv(); return &fQInv[0]; }
+  const double* KT() { if (!(fComputed & kKT)) ComputeKT(); return &fKT[0]; }
+  const double* MInv() { if (!(fComputed & kMInv)) ComputeMInv(); return &fMInv[0]; }
+  const double* QOutLCMS() { if (!(fComputed & kLCMS)) ComputeLCMS(); return &fQOut[0]; }
+  const double* QSideLCMS() { if (!(fComputed & kLCMS)) ComputeLCMS(); return &fQSide[0]; }
+  const double* QLongLCMS() { if (!(fComputed & kLCMS)) ComputeLCMS(); return &fQLong[0]; }
+  const double* DEta() { if (!(fComputed & kDEtaDPhi)) ComputeDEtaDPhi(); return &fDEta[0]; }
+  const double* DPhi() { if (!(fComputed & kDEtaDPhi)) ComputeDEtaDPhi(); return &fDPhi[0]; }
+
+protected:
+  /// Arrays of the block which are up to date
+  enum EKinematics { kQInv = 1, kKT = 2, kMInv = 4, kLCMS = 8, kDEtaDPhi = 16 };
+
+  void ComputeQInv();
+  void ComputeKT();
+  void ComputeMInv();
+  void ComputeLCMS();
+  void ComputeDEtaDPhi();
+
+  std::vector<AliFemtoPair> fPairs;  ///< reused pair objects
+
+  std::vector<double> fQInv;         ///< invariant relative momentum (signed as AliFemtoPair::QInv)
+  std::vector<double> fKT;           ///< pair transverse momentum / 2
+  std::vector<double> fMInv;         ///< pair invariant mass
+  std::vector<double> fQOut;         ///< out component in LCMS
+  std::vector<double> fQSide;        ///< side component in LCMS
+  std::vector<double> fQLong;        ///< long component in LCMS
+  std::vector<double> fDEta;         ///< eta2 - eta1
+  std::vector<double> fDPhi;         ///< phi2 - phi1 in [-pi, pi)
+
+  UInt_t fSize;                      ///< number of pairs in use
+  UInt_t fComputed;                  ///< EKinematics bits of the computed arrays
+
+private:
+  AliFemtoPairBatch(const AliFemtoPairBatch&);
+  AliFemtoPairBatch& operator=(const AliFemtoPairBatch&);
+};
+
+inline bool AliFemtoPairBatch::Add(const AliFemtoParticle* p1, const AliFemtoParticle* p2)
+{
+  AliFemtoPair &pair = fPairs[fSize++];
+  pair.SetTrack1(p1);
+  pair.SetTrack2(p2);
+  fComputed = 0;
+  return Full();
+}
+
+inline void AliFemtoPairBatch::Clear()
+{
+  fSize = 0;
+  fComputed = 0;
+}
+
+#endif
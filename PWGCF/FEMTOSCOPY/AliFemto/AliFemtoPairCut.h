@@ -17,6 +17,7 @@ class AliFemtoAnalysis;
 #include "AliFemtoString.h"
 #include "AliFemtoEvent.h"
 #include "AliFemtoPair.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoCutMonitorHandler.h"
 #include <TList.h>
 #include <TObjString.h>
@@ -38,6 +39,12 @@ public:
 
   virtual bool Pass(const AliFemtoPair* pair) = 0;  ///< true if pair passes, false if not
 
+  /// Evaluate the cut on a whole block of pairs, storing the decision of
+  /// pair i in pass[i]. Kinematics of the batch are already computed, so
+  /// cuts on qinv, kT, etc. may read the SoA arrays directly. The default
+  /// implementation calls Pass() on every pair.
+  virtual void PassBatch(AliFemtoPairBatch &batch, std::vector<bool> &pass);
+
   virtual AliFemtoString Report() = 0;              ///< user-written method to return string describing cuts
   virtual TList *ListSettings() = 0;                ///< Return a TList of settings
 
@@ -66,6 +73,15 @@ inline AliFemtoPairCut::~AliFemtoPairCut(){ /* no-op */ }
 inline void AliFemtoPairCut::SetAnalysis(AliFemtoAnalysis* analysis) { fyAnalysis = analysis; }
 inline AliFemtoPairCut& AliFemtoPairCut::operator=(const AliFemtoPairCut &aCut) { if (this == &aCut) return *this; fyAnalysis = aCut.fyAnalysis; return *this; }
 
+inline void AliFemtoPairCut::PassBatch(AliFemtoPairBatch &batch, std::vector<bool> &pass)
+{
+  const UInt_t n = batch.Size();
+  pass.resize(n);
+  for (UInt_t i = 0; i < n; ++i) {
+    pass[i] = Pass(batch.Pair(i));
+  }
+}
+
 inline void AliFemtoPairCut::EventBegin(const AliFemtoEvent* /* aEvent */ ) { /* no-op */ }
 
 inline void AliFemtoPairCut::EventEnd(const AliFemtoEvent* /* aEvent */ ) { /* no-op */ }
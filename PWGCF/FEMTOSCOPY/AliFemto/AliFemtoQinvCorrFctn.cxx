@@ -26,7 +26,8 @@ AliFemtoQinvCorrFctn::AliFemtoQinvCorrFctn(const char* title, const int& nbins,
   fRaddedps(1.2),
   fNumDEtaDPhiS(0),
   fDenDEtaDPhiS(0),
-  PairReader(0)// ,
+  PairReader(0),
+  fBatchPass()// ,
   // fTrack1(NULL),
   // fTrack2(NULL)
 
@@ -93,7 +94,8 @@ AliFemtoQinvCorrFctn::AliFemtoQinvCorrFctn(const AliFemtoQinvCorrFctn& aCorrFctn
   fRaddedps(1.2),
   fNumDEtaDPhiS(0),
   fDenDEtaDPhiS(0),
-  PairReader(0)// ,
+  PairReader(0),
+  fBatchPass()// ,
   // fTrack1(NULL),
   // fTrack2(NULL)
 
@@ -328,6 +330,51 @@ void AliFemtoQinvCorrFctn::AddMixedPair(AliFemtoPair* pair){
   }
 //_______________________________________________________________
 
+}
+//____________________________
+void AliFemtoQinvCorrFctn::AddRealPairs(AliFemtoPairBatch& batch){
+  // add a block of true pairs, reading qinv and kT from the block
+  if (fDetaDphiscal) {
+    AliFemtoCorrFctn::AddRealPairs(batch);
+    return;
+  }
+
+  if (fPairCut) {
+    fPairCut->PassBatch(batch, fBatchPass);
+  }
+  const double *qinv = batch.QInv(),
+               *kt = batch.KT();
+  for (UInt_t i = 0; i < batch.Size(); ++i) {
+    if (fPairCut && !fBatchPass[i]) {
+      continue;
+    }
+    fNumerator->Fill(fabs(qinv[i]));
+    fkTMonitor->Fill(kt[i]);
+  }
+}
+//____________________________
+void AliFemtoQinvCorrFctn::AddMixedPairs(AliFemtoPairBatch& batch){
+  // add a block of mixed pairs, reading qinv from the block
+  if (fDetaDphiscal || fPairKinematics) {
+    AliFemtoCorrFctn::AddMixedPairs(batch);
+    return;
+  }
+
+  if (fPairCut) {
+    fPairCut->PassBatch(batch, fBatchPass);
+  }
+  const double *qinv = batch.QInv();
+  for (UInt_t i = 0; i < batch.Size(); ++i) {
+    if (fPairCut && !fBatchPass[i]) {
+      continue;
+    }
+    fDenominator->Fill(fabs(qinv[i]), 1.0);
+  }
+}
+//____________________________
+bool AliFemtoQinvCorrFctn::UsesPairBatch(bool mixed) const{
+  // the deta-dphi* and pair kinematics outputs are only filled pair by pair
+  return mixed ? !(fDetaDphiscal || fPairKinematics) : !fDetaDphiscal;
 }
 //____________________________
 void AliFemtoQinvCorrFctn::Write(){
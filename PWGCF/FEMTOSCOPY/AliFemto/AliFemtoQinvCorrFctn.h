@@ -50,6 +50,8 @@
 #include "TH2D.h"
 #include "TNtuple.h"
 
+#include <vector>
+
 #include "AliFemtoCorrFctn.h"
 
 #include "AliAODInputHandler.h"
@@ -67,6 +69,9 @@ public:
   virtual AliFemtoString Report();
   virtual void AddRealPair(AliFemtoPair* aPair);
   virtual void AddMixedPair(AliFemtoPair* aPair);
+  virtual void AddRealPairs(AliFemtoPairBatch& aBatch);
+  virtual void AddMixedPairs(AliFemtoPairBatch& aBatch);
+  virtual bool UsesPairBatch(bool mixed) const;
 
   virtual void Finish();
 
@@ -97,9 +102,11 @@ private:
 
   TNtuple* PairReader; //PairReader for CorrFit
 
+  std::vector<bool> fBatchPass; //! decisions of fPairCut on the current pair block
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoQinvCorrFctn, 1);
+  ClassDef(AliFemtoQinvCorrFctn, 2);
   /// \endcond
 #endif
 };
@@ -183,7 +183,13 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fUseBatchedPairs(kFALSE),
+  fPairBatchSize(512),
+  fPairBatch(nullptr),
+  fPairBatchPass(),
+  fPairBatchCorrFctns(),
+  fPairBatchPairByPair()
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -205,7 +211,13 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fUseBatchedPairs(a.fUseBatchedPairs),
+  fPairBatchSize(a.fPairBatchSize),
+  fPairBatch(nullptr),
+  fPairBatchPass(),
+  fPairBatchCorrFctns(),
+  fPairBatchPairByPair()
 {
   /// Copy constructor
 
@@ -317,6 +329,8 @@ AliFemtoSimpleAnalysis::~AliFemtoSimpleAnalysis()
     }
     delete fMixingBuffer;
   }
+
+  delete fPairBatch;
 }
 //______________________
 AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAnalysis& aAna)
@@ -402,6 +416,7 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  SetUseBatchedPairs(aAna.fUseBatchedPairs, aAna.fPairBatchSize);
 
   return *this;
 }
@@ -616,6 +631,48 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
     tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
   }
 
+  // Batched pair engine - collect pairs into blocks, flushed when full
+  if (fUseBatchedPairs) {
+    if (type != "real" && type != "mixed") {
+      cout << "Problem with pair type, type = " << type << endl;
+      return;
+    }
+    const bool mixed = (type == "mixed");
+
+    if (!fPairBatch) {
+      fPairBatch = new AliFemtoPairBatch(fPairBatchSize);
+    }
+    fPairBatch->Clear();
+
+    for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
+                                       tPartIter1 != tEndOuterLoop;
+                                       ++tPartIter1) {
+      if (!partCollection2) {
+        tStartInnerLoop = tPartIter1;
+        tStartInnerLoop++;
+      }
+
+      for (AliFemtoParticleConstIterator tPartIter2 = tStartInnerLoop;
+                                         tPartIter2 != tEndInnerLoop;
+                                         ++tPartIter2) {
+        bool full;
+        if (partCollection2 != nullptr) {
+          full = fPairBatch->Add(*tPartIter1, *tPartIter2);
+        } else {
+          full = fPairBatch->Add(swpart ? *tPartIter2 : *tPartIter1,
+                                 swpart ? *tPartIter1 : *tPartIter2);
+          swpart = !swpart;
+        }
+        if (full) {
+          FlushPairBatch(mixed, enablePairMonitors);
+        }
+      }
+    }
+
+    FlushPairBatch(mixed, enablePairMonitors);
+    return;
+  }
+
   // Create the pair outside the loop - only allocate once
   AliFemtoPair* tPair = new AliFemtoPair;
 
@@ -678,6 +735,62 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
   delete tPair;
 }
 //_________________________
+void AliFemtoSimpleAnalysis::FlushPairBatch(bool mixed, Bool_t enablePairMonitors)
+{
+  if (fPairBatch->Empty()) {
+    return;
+  }
+
+  // the kinematics of the block are computed on demand by the cuts
+  fPairCut->PassBatch(*fPairBatch, fPairBatchPass);
+
+  if (enablePairMonitors) {
+    for (UInt_t i = 0; i < fPairBatch->Size(); ++i) {
+      fPairCut->FillCutMonitor(fPairBatch->Pair(i), fPairBatchPass[i]);
+    }
+  }
+
+  fPairBatchCorrFctns.clear();
+  fPairBatchPairByPair.clear();
+  for (auto &tCorrFctn : *fCorrFctnCollection) {
+    if (tCorrFctn->UsesPairBatch(mixed))
+      fPairBatchCorrFctns.push_back(tCorrFctn);
+    else
+      fPairBatchPairByPair.push_back(tCorrFctn);
+  }
+
+  // functions without a block implementation get the passing pairs one by
+  // one, in the same interleaved order as in the per-pair loop
+  if (!fPairBatchPairByPair.empty()) {
+    for (UInt_t i = 0; i < fPairBatch->Size(); ++i) {
+      if (!fPairBatchPass[i]) {
+        continue;
+      }
+      for (auto &tCorrFctn : fPairBatchPairByPair) {
+        if (mixed)
+          tCorrFctn->AddMixedPair(fPairBatch->Pair(i));
+        else
+          tCorrFctn->AddRealPair(fPairBatch->Pair(i));
+      }
+    }
+  }
+
+  // the others get the passing pairs as a block, in their original order
+  if (!fPairBatchCorrFctns.empty()) {
+    fPairBatch->Compact(fPairBatchPass);
+    if (!fPairBatch->Empty()) {
+      for (auto &tCorrFctn : fPairBatchCorrFctns) {
+        if (mixed)
+          tCorrFctn->AddMixedPairs(*fPairBatch);
+        else
+          tCorrFctn->AddRealPairs(*fPairBatch);
+      }
+    }
+  }
+
+  fPairBatch->Clear();
+}
+//_________________________
 void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
 {
   /// Perform initialization operations at the beginning of the event processing
@@ -11,6 +11,7 @@
 #include "AliFemtoParticleCut.h"
 #include "AliFemtoCorrFctn.h"
 #include "AliFemtoCorrFctnCollection.h"
+#include "AliFemtoPairBatch.h"
 #include "AliFemtoPicoEventCollection.h"
 #include "AliFemtoParticleCollection.h"
 #include "AliFemtoV0SharedDaughterCut.h"
@@ -99,6 +100,14 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Use the batched pair engine in MakePairs: pairs are collected into
+  /// blocks of `aBatchSize` and passed to the pair cut (PassBatch) and to the
+  /// correlation functions which support it (AddRealPairs / AddMixedPairs)
+  /// block-wise, the kinematics being computed once per block when first
+  /// needed. The filled histograms are identical to the per-pair mode.
+  void SetUseBatchedPairs(Bool_t aUse, UInt_t aBatchSize=512);
+  Bool_t UseBatchedPairs() const;
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -159,6 +168,10 @@ protected:
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Evaluate pair cut on the pending batch and hand the surviving pairs to
+  /// the correlation functions; leaves the batch empty
+  void FlushPairBatch(bool mixed, Bool_t enablePairMonitors);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -178,6 +191,13 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  Bool_t fUseBatchedPairs;                           ///< Use the batched pair engine in MakePairs
+  UInt_t fPairBatchSize;                             ///< Number of pairs per batch
+  AliFemtoPairBatch* fPairBatch;                     //!<! Pair block reused by MakePairs (created on demand)
+  std::vector<bool> fPairBatchPass;                  //!<! Pair cut decisions of the current block
+  std::vector<AliFemtoCorrFctn*> fPairBatchCorrFctns;  //!<! Correlation functions filled block-wise
+  std::vector<AliFemtoCorrFctn*> fPairBatchPairByPair; //!<! Correlation functions filled pair by pair
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -305,4 +325,19 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetUseBatchedPairs(Bool_t aUse, UInt_t aBatchSize)
+{
+  fUseBatchedPairs = aUse;
+  if (aBatchSize != fPairBatchSize) {
+    delete fPairBatch;
+    fPairBatch = nullptr;
+  }
+  fPairBatchSize = aBatchSize > 0 ? aBatchSize : 1;
+}
+
+inline Bool_t AliFemtoSimpleAnalysis::UseBatchedPairs() const
+{
+  return fUseBatchedPairs;
+}
+
 #endif
@@ -7,6 +7,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "AliFemtoSpherocityEventCut.h"
+#include "AliEventShapeCalculator.h"
 //#include <cstdio>
 
 #ifdef __ROOT__
@@ -25,6 +26,7 @@ AliFemtoSpherocityEventCut::AliFemtoSpherocityEventCut():
   fAcceptOnlyPhysics(0),
   fSoCutMin(0.0),
   fSoCutMax(1.0),
+  fSoStepSize(1.0),
   fSelectTrigger(0)
 {
   // Default constructor
@@ -51,83 +53,30 @@ bool AliFemtoSpherocityEventCut::Pass(const AliFemtoEvent* event)
   int mult = (int) event->UncorrectedNumberOfPrimaries();
   double vertexZPos = event->PrimVertPos().z();
   double spherocity = -10;
-  int MULT = 0;
 
+  AliEventShapeCalculator shape;
   AliFemtoTrackCollection *tracks = event->TrackCollection();
   for (AliFemtoTrackIterator iter = tracks->begin(); iter != tracks->end(); iter++) {
 
     Double_t NewPt = (*iter)->Pt();
+    Double_t NewPhi = (*iter)->P().Phi();
     Double_t NewEta = (*iter)->P().PseudoRapidity();
     if (TMath::Abs(NewEta) > 0.8 || NewPt < 0.5) {
       continue;
     }
 
-    MULT++;
-
+    shape.AddParticlePtPhi(NewPt, NewPhi);
   }
   //if(SumPt==0){return kFALSE;}
-  if (MULT < 3) {
+  if (shape.GetNParticles() < 3) {
     return kFALSE;
   }
 
-  Double_t *pxA = new Double_t[MULT]();
-  Double_t *pyA = new Double_t[MULT]();
-
-  Double_t sumapt = 0;
-  Int_t counter = 0;
-
-  AliFemtoTrackCollection *tracks2 = event->TrackCollection();
-  for (AliFemtoTrackIterator iter2 = tracks2->begin(); iter2 != tracks2->end(); iter2++) {
-
-    Double_t NewPt2 = (*iter2)->Pt();
-    Double_t NewPhi2 = (*iter2)->P().Phi();
-    Double_t NewEta2 = (*iter2)->P().PseudoRapidity();
-    if (TMath::Abs(NewEta2) > 0.8 || NewPt2 < 0.5) {
-      continue;
-    }
-
-    Double_t Px;
-    Double_t Py;
-
-    Px= NewPt2 * TMath::Cos(NewPhi2);
-    Py= NewPt2 * TMath::Sin(NewPhi2);
-
-    pxA[counter] = Px;
-    pyA[counter] = Py;
-    sumapt += NewPt2;
-    counter++;
-  }
-
-  Double_t pFull = 0;
-  Double_t Spherocity = 2;
-  //Getting thrust
-  for (Int_t i = 0; i < 360; ++i) {
-    Double_t numerador = 0;
-    Double_t phiparam  = 0;
-    Double_t nx = 0;
-    Double_t ny = 0;
-    phiparam = ((TMath::Pi()) * i) / 180; // parametrization of the angle
-    nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-    ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-    for (Int_t i1 = 0; i1 < MULT; ++i1) {
-      numerador += TMath::Abs(ny * pxA[i1] - nx * pyA[i1]);//product between momentum proyection in XY plane and the unitari vector.
-    }
-    pFull = TMath::Power(numerador / sumapt, 2);
-    if (pFull < Spherocity) {//maximization of pFull
-      Spherocity = pFull;
-    }
-  }
-
-
-  spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
-
-  if (pxA) {// clean up array memory used for TMath::Sort
-    delete[] pxA;
-    pxA = 0;
-  }
-  if (pyA) {// clean up array memory used for TMath::Sort
-    delete[] pyA;
-    pyA = 0;
+  // scan of the axis in steps of fSoStepSize degrees, exact minimisation for fSoStepSize <= 0
+  if (fSoStepSize > 0) {
+    spherocity = shape.GetSpherocityGrid(fSoStepSize, AliEventShapeCalculator::kDouble);
+  } else {
+    spherocity = shape.GetSpherocity();
   }
 
   if(spherocity>fSoCutMax || spherocity<fSoCutMin) {
@@ -27,6 +27,7 @@ public:
   bool GetAcceptOnlyPhysics() {return kFALSE;} // Not implemented
   void SetSoMin(double soMin );
   void SetSoMax(double soMax );
+  void SetSoStepSize(double stepDeg);
   void SetTriggerSelection(int trig);
 
   void SetEPVZERO(const float& lo, const float& hi);
@@ -47,11 +48,12 @@ private:   // here are the quantities I want to cut on...
   bool fAcceptOnlyPhysics; ///< Accept only physics events
   double fSoCutMin;        ///< transverse sphericity minimum
   double fSoCutMax;        ///< transverse sphericity maximum
+  double fSoStepSize;      ///< step of the spherocity axis scan in degrees (<= 0: exact)
   int  fSelectTrigger;     ///< If set, only given trigger will be selected
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
-  ClassDef(AliFemtoSpherocityEventCut, 1);
+  ClassDef(AliFemtoSpherocityEventCut, 2);
   /// \endcond
 #endif
 
@@ -64,6 +66,7 @@ inline int  AliFemtoSpherocityEventCut::NEventsPassed() const {return fNEventsPa
 inline int  AliFemtoSpherocityEventCut::NEventsFailed() const {return fNEventsFailed;}
 inline void AliFemtoSpherocityEventCut::SetSoMin(double soMin) {fSoCutMin=soMin;}
 inline void AliFemtoSpherocityEventCut::SetSoMax(double soMax) {fSoCutMax=soMax;}
+inline void AliFemtoSpherocityEventCut::SetSoStepSize(double stepDeg) {fSoStepSize=stepDeg;}
 inline void AliFemtoSpherocityEventCut::SetTriggerSelection(int trig) { fSelectTrigger = trig; }
 inline AliFemtoEventCut* AliFemtoSpherocityEventCut::Clone() const { AliFemtoSpherocityEventCut* c = new AliFemtoSpherocityEventCut(*this); return c;}
 inline AliFemtoSpherocityEventCut::AliFemtoSpherocityEventCut(const AliFemtoSpherocityEventCut& c):
@@ -74,6 +77,7 @@ inline AliFemtoSpherocityEventCut::AliFemtoSpherocityEventCut(const AliFemtoSphe
   fAcceptOnlyPhysics(c.fAcceptOnlyPhysics),
   fSoCutMin(c.fSoCutMin),
   fSoCutMax(c.fSoCutMax),
+  fSoStepSize(c.fSoStepSize),
   fSelectTrigger(c.fSelectTrigger)
 {
   fEventMult[0] = c.fEventMult[0];
@@ -100,6 +104,7 @@ inline AliFemtoSpherocityEventCut& AliFemtoSpherocityEventCut::operator=(const A
     fAcceptOnlyPhysics = c.fAcceptOnlyPhysics;
     fSoCutMin = c.fSoCutMin;
     fSoCutMax = c.fSoCutMax;
+    fSoStepSize = c.fSoStepSize;
     fSelectTrigger = c.fSelectTrigger;
   }
 
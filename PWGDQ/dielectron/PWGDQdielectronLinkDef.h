@@ -8,6 +8,7 @@
 
 #pragma link C++ class AliDielectron+;
 #pragma link C++ class AliDielectronPair+;
+#pragma link C++ class AliDielectronLegCache+;
 #pragma link C++ class AliDielectronHistos+;
 #pragma link C++ class AliDielectronCF+;
 #pragma link C++ class AliDielectronCFdraw+;
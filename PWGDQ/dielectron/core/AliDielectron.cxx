@@ -160,6 +160,7 @@ AliDielectron::AliDielectron() :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fLegCache(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -171,6 +172,11 @@ AliDielectron::AliDielectron() :
   //
   // Default constructor
   //
+  for (Int_t i=0; i<2; ++i) {
+    fPairPreCutMass[i]=0.;
+    fPairPreCutPt[i]=0.;
+    fPairPreCutOpeningAngle[i]=0.;
+  }
 
 }
 
@@ -237,6 +243,7 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   fDontClearArrays(kFALSE),
   fEventProcess(kTRUE),
   fUseGammaTracks(kTRUE),
+  fLegCache(),
   fEstimatorFilename(""),
   fEstimatorObjArray(0x0),
   fTRDpidCorrectionFilename(""),
@@ -247,6 +254,11 @@ AliDielectron::AliDielectron(const char* name, const char* title) :
   //
   // Named constructor
   //
+  for (Int_t i=0; i<2; ++i) {
+    fPairPreCutMass[i]=0.;
+    fPairPreCutPt[i]=0.;
+    fPairPreCutOpeningAngle[i]=0.;
+  }
 
 }
 
@@ -462,6 +474,9 @@ Bool_t AliDielectron::Process(AliVEvent *ev1, AliVEvent *ev2)
     fEvtVsTrkHist->FillHistograms(ev1);
   }
 
+  //legs of the previous event are not valid anymore
+  fLegCache.Clear();
+
   //fill track arrays for the first event
   if (ev1){
     FillTrackArrays(ev1);
@@ -1209,6 +1224,10 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
   Int_t nRejPasses = 1; //for fPreFilterUnlikeOnly and no set flag
   if (prefilterAllSigns) nRejPasses = 3;
 
+  //without MC event no mother label can be found
+  Bool_t hasMCEvent = (AliDielectronMC::Instance()->GetMCEvent()!=0x0);
+  std::vector<Int_t> legs1, legs2;
+
   for (Int_t iRP=0; iRP < nRejPasses; ++iRP) {
     Int_t arr1RP=arr1, arr2RP=arr2;
     TObjArray *arrTracks1RP=&arrTracks1;
@@ -1235,6 +1254,10 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
 
     Int_t pairIndex=GetPairIndex(arr1RP,arr2RP);
 
+    //KF particles of the tracks, built once per event
+    fLegCache.Fill(*arrTracks1RP,fPdgLeg1,legs1);
+    fLegCache.Fill(*arrTracks2RP,fPdgLeg2,legs2);
+
     if( prefilterOnlyOnePair ){
       Double_t maxLikelihood1[ntrack1RP];
       Double_t maxLikelihood2[ntrack2RP];
@@ -1251,22 +1274,22 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
         Int_t end=ntrack2RP;
         if (arr1RP==arr2RP) end=itrack1;
         for (Int_t itrack2=0; itrack2<end; ++itrack2){
-          TObject *track1=(*arrTracks1RP).UncheckedAt(itrack1);
-          TObject *track2=(*arrTracks2RP).UncheckedAt(itrack2);
-          if (!track1 || !track2) continue;
+          Int_t leg1=legs1[itrack1];
+          Int_t leg2=legs2[itrack2];
+          if (leg1<0 || leg2<0) continue;
           maxLikelihood2[itrack2] = -999.;
           //create the pair
           if(prefilterPhotons){
-            candidate.SetGammaTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
+            candidate.SetGammaTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                                     fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
           }
           else{
-            candidate.SetTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
+            candidate.SetTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                                fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
           }
 
           candidate.SetType(pairIndex);
-          candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
+          candidate.SetLabel(hasMCEvent ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother) : -1);
           //relate to the production vertex
           //       if (AliDielectronVarManager::GetKFVertex()) candidate.SetProductionVertex(*AliDielectronVarManager::GetKFVertex());
 
@@ -1304,21 +1327,21 @@ void AliDielectron::PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1,
         Int_t end=ntrack2RP;
         if (arr1RP==arr2RP) end=itrack1;
         for (Int_t itrack2=0; itrack2<end; ++itrack2){
-          TObject *track1=(*arrTracks1RP).UncheckedAt(itrack1);
-          TObject *track2=(*arrTracks2RP).UncheckedAt(itrack2);
-          if (!track1 || !track2) continue;
+          Int_t leg1=legs1[itrack1];
+          Int_t leg2=legs2[itrack2];
+          if (leg1<0 || leg2<0) continue;
           //create the pair
           if(prefilterPhotons){
-            candidate.SetGammaTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
+            candidate.SetGammaTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                                     fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
           }
           else{
-            candidate.SetTracks(static_cast<AliVTrack*>(track1), fPdgLeg1,
-                              static_cast<AliVTrack*>(track2), fPdgLeg2);
+            candidate.SetTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                                fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
           }
 
           candidate.SetType(pairIndex);
-          candidate.SetLabel(AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother));
+          candidate.SetLabel(hasMCEvent ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(&candidate,fPdgMother) : -1);
           //relate to the production vertex
           //       if (AliDielectronVarManager::GetKFVertex()) candidate.SetProductionVertex(*AliDielectronVarManager::GetKFVertex());
 
@@ -1416,6 +1439,17 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   Int_t ntrack1=arrTracks1.GetEntriesFast();
   Int_t ntrack2=arrTracks2.GetEntriesFast();
 
+  //KF particles and momenta of the tracks, built once per event
+  std::vector<Int_t> legs1, legs2;
+  fLegCache.Fill(arrTracks1,fPdgLeg1,legs1);
+  fLegCache.Fill(arrTracks2,fPdgLeg2,legs2);
+
+  //the pre-cuts only reject pairs which fail the pair filter: not used if the failing pairs
+  //are monitored or if the daughters are randomized (one random number per pair)
+  Bool_t usePreCuts = !fCfManagerPair && !(pairIndex==kEv1PM && fCutQA) && !AliDielectronPair::GetRandomizeDaughters();
+  //without MC event no mother label can be found
+  Bool_t hasMCEvent = (AliDielectronMC::Instance()->GetMCEvent()!=0x0);
+
   AliDielectronPair *candidate=new AliDielectronPair;
   candidate->SetKFUsage(fUseKF);
 
@@ -1424,22 +1458,26 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   for (Int_t itrack1=0; itrack1<ntrack1; ++itrack1){
     Int_t end=ntrack2;
     if (arr1==arr2) end=itrack1;
+    Int_t leg1=legs1[itrack1];
     for (Int_t itrack2=0; itrack2<end; ++itrack2){
+      Int_t leg2=legs2[itrack2];
+      if (usePreCuts && !PassPairPreCuts(leg1,leg2)) continue;
+
       //create the pair (direct pointer to the memory by this daughter reference are kept also for ME)
-      candidate->SetTracks(&(*static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1))), fPdgLeg1,
-                           &(*static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2))), fPdgLeg2);
+      candidate->SetTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                           fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
       candidate->SetType(pairIndex);
 
-      Int_t label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother);
+      Int_t label=hasMCEvent ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,fPdgMother) : -1;
       candidate->SetLabel(label);
       if (label>-1) candidate->SetPdgCode(fPdgMother);
       else candidate->SetPdgCode(0);
 
       // check for gamma kf particle
-      label=AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22);
+      label=hasMCEvent ? AliDielectronMC::Instance()->GetLabelMotherWithPdg(candidate,22) : -1;
       if (label>-1 && fUseGammaTracks) {
-        candidate->SetGammaTracks(static_cast<AliVTrack*>(arrTracks1.UncheckedAt(itrack1)), fPdgLeg1,
-                                  static_cast<AliVTrack*>(arrTracks2.UncheckedAt(itrack2)), fPdgLeg2);
+        candidate->SetGammaTracks(fLegCache.GetKFParticle(leg1), fLegCache.GetTrack(leg1),
+                                  fLegCache.GetKFParticle(leg2), fLegCache.GetTrack(leg2));
       // should we set the pdgmothercode and the label
       }
 
@@ -1472,6 +1510,33 @@ void AliDielectron::FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev)
   delete candidate;
 }
 
+//________________________________________________________________
+Bool_t AliDielectron::PassPairPreCuts(Int_t leg1, Int_t leg2) const
+{
+  //
+  // analytic pre-cuts on the leg momenta, false if the pair cannot pass the pair filter.
+  // The tolerance covers the rounding differences to AliDielectronVarManager
+  //
+  const Double_t kTolerance=1e-9;
+
+  if (fPairPreCutOpeningAngle[0]<fPairPreCutOpeningAngle[1]) {
+    Double_t angle=fLegCache.OpeningAngle(leg1,leg2);
+    if (angle<fPairPreCutOpeningAngle[0]-kTolerance || angle>fPairPreCutOpeningAngle[1]+kTolerance) return kFALSE;
+  }
+  //with KF the pair momentum comes from the vertex fit
+  if (fUseKF) return kTRUE;
+
+  if (fPairPreCutPt[0]<fPairPreCutPt[1]) {
+    Double_t pt=fLegCache.Pt(leg1,leg2);
+    if (pt<fPairPreCutPt[0]-kTolerance || pt>fPairPreCutPt[1]+kTolerance) return kFALSE;
+  }
+  if (fPairPreCutMass[0]<fPairPreCutMass[1]) {
+    Double_t mass=fLegCache.M(leg1,leg2);
+    if (mass<fPairPreCutMass[0]-kTolerance || mass>fPairPreCutMass[1]+kTolerance) return kFALSE;
+  }
+  return kTRUE;
+}
+
 //________________________________________________________________
 void AliDielectron::FillPairArrayTR()
 {
@@ -28,6 +28,7 @@
 #include "AliDielectronHF.h"
 #include "AliDielectronCutQA.h"
 #include "AliDielectronEvtVsTrkHist.h"
+#include "AliDielectronLegCache.h"
 
 class AliEventplane;
 class AliVEvent;
@@ -89,6 +90,13 @@ public:
   void SetNoPairing(Bool_t noPairing=kTRUE) { fNoPairing=noPairing; }
   void SetProcessLS(Bool_t doLS=kTRUE) { fProcessLS=doLS; }
   void SetUseKF(Bool_t useKF=kTRUE) { fUseKF=useKF; }
+
+  // analytic pair pre-cuts on the leg momenta, applied before the pair filter.
+  // A range is active if min<max. The ranges must be at least as wide as the pair filter cuts
+  // on the same variables; mass and pt pre-cuts are only exact without KF (SetUseKF(kFALSE))
+  void SetPairPreCutMass(Double_t min, Double_t max)         { fPairPreCutMass[0]=min; fPairPreCutMass[1]=max; }
+  void SetPairPreCutPt(Double_t min, Double_t max)           { fPairPreCutPt[0]=min; fPairPreCutPt[1]=max; }
+  void SetPairPreCutOpeningAngle(Double_t min, Double_t max) { fPairPreCutOpeningAngle[0]=min; fPairPreCutOpeningAngle[1]=max; }
   const TObjArray* GetTrackArray(Int_t i) const {return (i>=0&&i<4)?&fTracks[i]:0;}
   const TObjArray* GetPairArray(Int_t i)  const {return (i>=0&&i<11)?
       static_cast<TObjArray*>(fPairCandidates->UncheckedAt(i)):0;}
@@ -273,12 +281,18 @@ private:
   Bool_t fDontClearArrays;      //Don't clear the arrays at the end of the Process function, needed for external use of pair and tracks
   Bool_t fEventProcess;         //Process event (or pair array)
   Bool_t fUseGammaTracks;       // use function SetGammaTracks for MCtruth photons
+  Double_t fPairPreCutMass[2];         // pair pre-cut on the mass of the legs (no KF only)
+  Double_t fPairPreCutPt[2];           // pair pre-cut on the pt of the legs (no KF only)
+  Double_t fPairPreCutOpeningAngle[2]; // pair pre-cut on the opening angle of the legs
+
+  AliDielectronLegCache fLegCache; //! KF particles and momenta of the tracks of the current event
 
   void FillTrackArrays(AliVEvent * const ev, Int_t eventNr=0);
   void EventPlanePreFilter(Int_t arr1, Int_t arr2, TObjArray arrTracks1, TObjArray arrTracks2, const AliVEvent *ev);
   void PairPreFilter(Int_t arr1, Int_t arr2, TObjArray &arrTracks1, TObjArray &arrTracks2, const AliVEvent *ev, Int_t prefilterN);
   void FillPairArrays(Int_t arr1, Int_t arr2, const AliVEvent *ev = 0x0);
   void FillPairArrayTR();
+  Bool_t PassPairPreCuts(Int_t leg1, Int_t leg2) const;
 
   Int_t GetPairIndex(Int_t arr1, Int_t arr2) const {return arr1>=arr2?arr1*(arr1+1)/2+arr2:arr2*(arr2+1)/2+arr1;}
 
@@ -312,7 +326,7 @@ private:
   AliDielectron(const AliDielectron &c);
   AliDielectron &operator=(const AliDielectron &c);
 
-  ClassDef(AliDielectron,17);
+  ClassDef(AliDielectron,18);
 };
 
 inline void AliDielectron::InitPairCandidateArrays()
@@ -0,0 +1,149 @@
+/*************************************************************************
+* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+//                Dielectron leg cache                                   //
+//                                                                       //
+/*
+Per event leg data for the pair loops of AliDielectron.
+
+Fill() returns for each track of an array the index of its leg; the KF
+particle (with the given pdg code) and the four-momentum of a track are
+only built the first time the track is seen in the event. Clear() has to
+be called for each new event, the tracks are identified by their address.
+*/
+//                                                                       //
+///////////////////////////////////////////////////////////////////////////
+
+#include <TMath.h>
+#include <TObjArray.h>
+
+#include <AliPID.h>
+#include <AliVTrack.h>
+
+#include "AliDielectronLegCache.h"
+
+ClassImp(AliDielectronLegCache)
+
+AliDielectronLegCache::AliDielectronLegCache() :
+  TObject(),
+  fIndex(),
+  fTracks(),
+  fKF(),
+  fMom()
+{
+  //
+  // Default Constructor
+  //
+}
+
+//______________________________________________
+AliDielectronLegCache::~AliDielectronLegCache()
+{
+  //
+  // Default Destructor
+  //
+}
+
+//______________________________________________
+void AliDielectronLegCache::Clear(Option_t */*opt*/)
+{
+  //
+  // Remove the legs of the previous event, the memory is kept
+  //
+  fIndex.clear();
+  fTracks.clear();
+  fKF.clear();
+  fMom.clear();
+}
+
+//______________________________________________
+void AliDielectronLegCache::Fill(const TObjArray &tracks, Int_t pdg, std::vector<Int_t> &legs)
+{
+  //
+  // leg index of each track of the array (-1 for empty slots),
+  // the legs not yet in the cache are built
+  //
+  static const Double_t mElectron = AliPID::ParticleMass(AliPID::kElectron);
+
+  Int_t ntracks=tracks.GetEntriesFast();
+  legs.resize(ntracks);
+  for (Int_t itrack=0; itrack<ntracks; ++itrack){
+    AliVTrack *track=static_cast<AliVTrack*>(tracks.UncheckedAt(itrack));
+    if (!track) {
+      legs[itrack]=-1;
+      continue;
+    }
+    std::pair<const TObject*,Int_t> key(track,pdg);
+    std::map<std::pair<const TObject*,Int_t>,Int_t>::const_iterator it=fIndex.find(key);
+    if (it!=fIndex.end()) {
+      legs[itrack]=it->second;
+      continue;
+    }
+
+    Int_t leg=fTracks.size();
+    fTracks.push_back(track);
+    fKF.push_back(AliKFParticle(*track,pdg));
+    const AliKFParticle &kf=fKF.back();
+    Double_t px=kf.GetPx(), py=kf.GetPy(), pz=kf.GetPz();
+    fMom.push_back(px);
+    fMom.push_back(py);
+    fMom.push_back(pz);
+    fMom.push_back(TMath::Sqrt(mElectron*mElectron+px*px+py*py+pz*pz));
+    fIndex[key]=leg;
+    legs[itrack]=leg;
+  }
+}
+
+//______________________________________________
+Double_t AliDielectronLegCache::M(Int_t leg1, Int_t leg2) const
+{
+  //
+  // invariant mass of the two legs, negative for space-like sums as TLorentzVector::M()
+  //
+  const Double_t *p1=&fMom[4*leg1];
+  const Double_t *p2=&fMom[4*leg2];
+  Double_t px=p1[0]+p2[0], py=p1[1]+p2[1], pz=p1[2]+p2[2], e=p1[3]+p2[3];
+  Double_t mm=e*e-px*px-py*py-pz*pz;
+  return mm<0. ? -TMath::Sqrt(-mm) : TMath::Sqrt(mm);
+}
+
+//______________________________________________
+Double_t AliDielectronLegCache::Pt(Int_t leg1, Int_t leg2) const
+{
+  //
+  // transverse momentum of the two legs
+  //
+  const Double_t *p1=&fMom[4*leg1];
+  const Double_t *p2=&fMom[4*leg2];
+  Double_t px=p1[0]+p2[0], py=p1[1]+p2[1];
+  return TMath::Sqrt(px*px+py*py);
+}
+
+//______________________________________________
+Double_t AliDielectronLegCache::OpeningAngle(Int_t leg1, Int_t leg2) const
+{
+  //
+  // angle between the momenta of the two legs
+  //
+  const Double_t *p1=&fMom[4*leg1];
+  const Double_t *p2=&fMom[4*leg2];
+  Double_t norm2=(p1[0]*p1[0]+p1[1]*p1[1]+p1[2]*p1[2])*(p2[0]*p2[0]+p2[1]*p2[1]+p2[2]*p2[2]);
+  if (norm2<=0.) return 0.;
+  Double_t arg=(p1[0]*p2[0]+p1[1]*p2[1]+p1[2]*p2[2])/TMath::Sqrt(norm2);
+  if (arg>1.) arg=1.;
+  if (arg<-1.) arg=-1.;
+  return TMath::ACos(arg);
+}
@@ -0,0 +1,58 @@
+#ifndef ALIDIELECTRONLEGCACHE_H
+#define ALIDIELECTRONLEGCACHE_H
+/* Copyright(c) 1998-2009, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//#############################################################
+//#                                                           #
+//#         Class AliDielectronLegCache                       #
+//#       Per event leg data for the pairing                  #
+//#                                                           #
+//#  The KF particle and the four-momentum (electron mass,    #
+//#  as in AliDielectronVarManager without KF) of each track  #
+//#  are built once per event and leg pdg code, the pair      #
+//#  loops then only combine these flat leg data.             #
+//#                                                           #
+//#############################################################
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <TObject.h>
+
+#include <AliKFParticle.h>
+
+class TObjArray;
+class AliVTrack;
+
+class AliDielectronLegCache : public TObject {
+public:
+  AliDielectronLegCache();
+  virtual ~AliDielectronLegCache();
+
+  virtual void Clear(Option_t *opt="");
+  void Fill(const TObjArray &tracks, Int_t pdg, std::vector<Int_t> &legs);
+
+  Int_t GetNLegs() const { return fTracks.size(); }
+  AliVTrack* GetTrack(Int_t leg) const { return fTracks[leg]; }
+  const AliKFParticle& GetKFParticle(Int_t leg) const { return fKF[leg]; }
+
+  // pair variables from the leg momenta, same definitions as AliDielectronVarManager without KF
+  Double_t M(Int_t leg1, Int_t leg2) const;
+  Double_t Pt(Int_t leg1, Int_t leg2) const;
+  Double_t OpeningAngle(Int_t leg1, Int_t leg2) const;
+
+private:
+  std::map<std::pair<const TObject*,Int_t>,Int_t> fIndex; //! (track, pdg) -> leg
+  std::vector<AliVTrack*>     fTracks;   //! track of each leg
+  std::vector<AliKFParticle>  fKF;       //! KF particle of each leg
+  std::vector<Double_t>       fMom;      //! px, py, pz, E of each leg
+
+  AliDielectronLegCache(const AliDielectronLegCache &c);
+  AliDielectronLegCache &operator=(const AliDielectronLegCache &c);
+
+  ClassDef(AliDielectronLegCache,1)         // per event leg data for the pairing
+};
+
+#endif
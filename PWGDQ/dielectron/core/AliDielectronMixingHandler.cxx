@@ -323,6 +323,9 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
       ev2N.Reset();
     }
 
+    //the pool tracks are reused and moved, their legs are rebuilt for each event
+    diele->fLegCache.Clear();
+
     //mixing of ev1- ev2+ (pair type4). This is common for all mixing types
     while ( (o=ev1N()) ) diele->fTracks[1].Add(o);
     while ( (o=ev2P()) ) diele->fTracks[2].Add(o);
@@ -111,13 +111,24 @@ void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+
+  SetTracks(kf1, particle1, kf2, particle2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetTracks(const AliKFParticle &kf1, AliVTrack * const particle1,
+                                  const AliKFParticle &kf2, AliVTrack * const particle2)
+{
+  //
+  // As SetTracks(particle1, pid1, particle2, pid2), with kf1 and kf2
+  // the KF particles of particle1 and particle2
+  //
   fPair.Initialize();
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
-
   fPair.AddDaughter(kf1);
   fPair.AddDaughter(kf2);
 
@@ -148,6 +159,7 @@ void AliDielectronPair::SetTracks(AliVTrack * const particle1, Int_t pid1,
     }
   }
 }
+
 //______________________________________________
 void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
 				       AliVTrack * const particle2, Int_t pid2)
@@ -158,11 +170,23 @@ void AliDielectronPair::SetGammaTracks(AliVTrack * const particle1, Int_t pid1,
   // refParticle1 and 2 are the original tracks. In the case of track rotation
   // they are needed in the framework
   //
+  AliKFParticle kf1(*particle1,pid1);
+  AliKFParticle kf2(*particle2,pid2);
+
+  SetGammaTracks(kf1, particle1, kf2, particle2);
+}
+
+//______________________________________________
+void AliDielectronPair::SetGammaTracks(const AliKFParticle &kf1, AliVTrack * const particle1,
+                                       const AliKFParticle &kf2, AliVTrack * const particle2)
+{
+  //
+  // As SetGammaTracks(particle1, pid1, particle2, pid2), with kf1 and kf2
+  // the KF particles of particle1 and particle2
+  //
   fD1.Initialize();
   fD2.Initialize();
 
-  AliKFParticle kf1(*particle1,pid1);
-  AliKFParticle kf2(*particle2,pid2);
   fPair.ConstructGamma(kf1,kf2);
 
   if (fRandomizeDaughters) {
@@ -62,8 +62,15 @@ public:
                  AliVTrack * const refParticle1,
                  AliVTrack * const refParticle2);
 
+  // same as above with the KF particles of the tracks already built (see AliDielectronLegCache)
+  void SetTracks(const AliKFParticle &kf1, AliVTrack * const particle1,
+                 const AliKFParticle &kf2, AliVTrack * const particle2);
+
+  void SetGammaTracks(const AliKFParticle &kf1, AliVTrack * const particle1,
+                      const AliKFParticle &kf2, AliVTrack * const particle2);
+
   static void SetRandomizeDaughters(Bool_t random=kTRUE) { fRandomizeDaughters=random; }
-  //static Bool_t GetRandomizeDaughters() { return fRandomizeDaughters; }
+  static Bool_t GetRandomizeDaughters() { return fRandomizeDaughters; }
 
   //AliVParticle interface
   // kinematics
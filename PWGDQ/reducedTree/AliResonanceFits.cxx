@@ -24,27 +24,36 @@ using std::setw;
 #include <TH2D.h>
 #include <THn.h>
 #include <TMath.h>
-#include <TRandom.h>
 #include <TMinuit.h>
+#include <TVirtualMutex.h>
 
 #include "AliReducedVarManager.h"
 
+// NOTE: TH1::Fit uses the global default minimizer and the TMinuit constructor sets the global gMinuit,
+//       so these are done one at a time by instances running at the same time (see AliResonanceFitsScan).
+//       The MIGRAD of FitScale() runs on the private AliResonanceFitsMinuit and is not locked.
+//       The lock is only active when the ROOT thread safety is enabled.
+static TVirtualMutex* gResonanceFitsMinuitMutex = 0;
 
 ClassImp(AliResonanceFits)
 
-// initialization of static members needed by the Minuit fitter
-TH1* AliResonanceFits::fgTempSignal = 0x0;
-TH1* AliResonanceFits::fgTempBkg = 0x0;
-TH1* AliResonanceFits::fSignalMCshape = 0x0;
-TF1* AliResonanceFits::fBkgFitFunction = 0x0;
-TF1* AliResonanceFits::fGlobalFitFunction = 0x0;
-Bool_t AliResonanceFits::fgOptionUse2DMatching = kFALSE;
-Double_t AliResonanceFits::fgPtFitRange[2] = {0.0, 100.};
-Double_t AliResonanceFits::fgMassFitRange[2] = {0.0, 15.};
-Int_t AliResonanceFits::fgOptionMEMatching = AliResonanceFits::kMatchSEOS;
-Double_t AliResonanceFits::fgMassExclusionRanges[10][2] = {{0.}};
-Int_t AliResonanceFits::fgNMassExclusionRanges = 0;
-Bool_t AliResonanceFits::fgOptionUseSignificantZero = kFALSE;
+//_______________________________________________________________________________
+class AliResonanceFitsMinuit : public TMinuit {
+  //
+  // Minuit fitter evaluating the chi2 of its own AliResonanceFits instance,
+  // instead of a static FCN working on static data (needed to run several fits at once)
+  //
+ public:
+  AliResonanceFitsMinuit(const AliResonanceFits* fits) : TMinuit(1), fFits(fits) {}
+  virtual Int_t Eval(Int_t, Double_t*, Double_t &f, Double_t *par, Int_t) {
+    f = fFits->ScaleChi2(par[0]);
+    return 0;
+  }
+ private:
+  AliResonanceFitsMinuit(const AliResonanceFitsMinuit&);
+  AliResonanceFitsMinuit& operator=(const AliResonanceFitsMinuit&);
+  const AliResonanceFits* fFits;     // fitter providing the chi2
+};
 
 //_______________________________________________________________________________
 AliResonanceFits::AliResonanceFits() :
@@ -65,16 +74,26 @@ AliResonanceFits::AliResonanceFits() :
   fNLoopingVariables(0),
   fCurrentVariable(0),
   fIter(),
+  fTempSignal(0x0),
+  fTempBkg(0x0),
+  fNUniqueNames(0),
+  fOptionUse2DMatching(kFALSE),
   fOptionBkgMethod(kBkgMixedEvent),
+  fOptionMEMatching(kMatchSEOS),
   fOptionUseRfactorCorrection(kFALSE),
   fOptionScale(kScaleEntries),
   fOptionLSmethod(kLSGeometricMean),
   fWeightedAveragePower(2.0),
   fOptionMinuit(kMinuitMethodChi2),
+  fOptionUseSignificantZero(kFALSE),
   fOptionScaleSummedBkg(kFALSE),
   fOptionDebug(kFALSE),
+  fMassFitRange(),
   fUserEnabledMassFitRange(kFALSE),
+  fPtFitRange(),
   fUserEnabledPtFitRange(kFALSE),
+  fMassExclusionRanges(),
+  fNMassExclusionRanges(0),
   fSplusB(0x0),
   fBkg(0x0),
   fSig(0x0),
@@ -82,12 +101,15 @@ AliResonanceFits::AliResonanceFits() :
   fBkgLikeSignLeg1(0x0),
   fBkgLikeSignLeg2(0x0),
   fBkgMixedEvent(0x0),
+  fBkgFitFunction(0x0),
+  fGlobalFitFunction(0x0),
   fFitResult(0),
   fSplusResidualBkg(0x0),
   fSplusBblind(0x0),
   fBkgCombinatorial(0x0),
   fBkgResidual(0x0),
   fSoverB(0x0),
+  fSignalMCshape(0x0),
   fFitValues(),
   fMatchingIsDone(kFALSE),
   fMinuitFitter(0x0),
@@ -102,6 +124,9 @@ AliResonanceFits::AliResonanceFits() :
       fIter[i] = -1; fVarBinLimits[i][0] = -1; fVarBinLimits[i][1] = -1;
    }
    for(Int_t i=0; i<kNFitValues; ++i) fFitValues[i] = 0.;
+   fMassFitRange[0] = 0.0; fMassFitRange[1] = 15.;
+   fPtFitRange[0] = 0.0; fPtFitRange[1] = 100.;
+   for(Int_t i=0; i<10; ++i) {fMassExclusionRanges[i][0] = 0.; fMassExclusionRanges[i][1] = 0.;}
 }
 
 //_______________________________________________________________________________
@@ -119,6 +144,8 @@ AliResonanceFits::~AliResonanceFits()
   if(fSEOS_MCtruth) delete fSEOS_MCtruth;
   if(fMinuitFitter) delete fMinuitFitter;
   if(fResidualFitFunc) delete fResidualFitFunc;
+  if(fBkgFitFunction) delete fBkgFitFunction;
+  if(fGlobalFitFunction) delete fGlobalFitFunction;
 }
 
 //_______________________________________________________________________________
@@ -255,8 +282,6 @@ Bool_t AliResonanceFits::Initialize() {
    //
    // make sure all prerequisites for signal extraction are met
    //   
-   AliReducedVarManager::SetDefaultVarNames();
-   
    // clean up the output histograms
    if(fSplusB) {delete fSplusB; fSplusB = 0;}
    if(fSig) {delete fSig; fSig = 0;}
@@ -284,7 +309,7 @@ Bool_t AliResonanceFits::Initialize() {
    if(fOptionBkgMethod==kBkgLikeSign || 
       fOptionBkgMethod==kBkgMixedEventAndResidualFit || 
       fOptionDebug ||
-      (fOptionBkgMethod==kBkgMixedEvent && fgOptionMEMatching==kMatchSELS)) {
+      (fOptionBkgMethod==kBkgMixedEvent && fOptionMEMatching==kMatchSELS)) {
       if(!fSELSleg1) {
          cout << "AliResonanceFits::Initialize() Fatal: No SE-LS leg1 histogram provided! This is needed with the current matching options" << endl;
          return kFALSE;
@@ -294,7 +319,7 @@ Bool_t AliResonanceFits::Initialize() {
          return kFALSE;
       }
    }
-   if((fOptionBkgMethod==kBkgMixedEvent && fgOptionMEMatching==kMatchSELS && fOptionUseRfactorCorrection) ||
+   if((fOptionBkgMethod==kBkgMixedEvent && fOptionMEMatching==kMatchSELS && fOptionUseRfactorCorrection) ||
       (fOptionBkgMethod==kBkgLikeSign && fOptionUseRfactorCorrection) ||
       fOptionBkgMethod==kBkgMixedEventAndResidualFit ||
       fOptionDebug) {
@@ -337,16 +362,17 @@ Bool_t AliResonanceFits::Initialize() {
       }
    }
    if(!massVarFound) {
+      // NOTE: the variable names are not set here, they are static and shared with the fits running at the same time
       cout << "AliResonanceFits::Initialize() Fatal: Mass dimension was not found in the list of user defined dimensions. " << endl;
-      cout << "                      The current needed mass variable is " << AliReducedVarManager::fgVariableNames[fMassVariable] << endl;
+      cout << "                      The current needed mass variable is AliReducedVarManager variable " << fMassVariable << endl;
       cout << "                 Use SetMassVariable() to change the desired mass variable, or define the mass dimension via AddVariable(s)()" << endl;
       return kFALSE;
    }
    if(!fUserEnabledMassFitRange) {
       cout << "AliResonanceFits::Initialize() Info: Mass fit range used from default values or those set via SetVarRange()" << endl;
       cout << "                    Use SetMassFitRange() if you want a different mass fit range" << endl;
-      fgMassFitRange[0] = fVarLimits[fNVariables-1][0];
-      fgMassFitRange[1] = fVarLimits[fNVariables-1][1];
+      fMassFitRange[0] = fVarLimits[fNVariables-1][0];
+      fMassFitRange[1] = fVarLimits[fNVariables-1][1];
    }
    
    // Look for the pt variable
@@ -362,9 +388,9 @@ Bool_t AliResonanceFits::Initialize() {
          break;
       }
    }
-   if(!ptVarFound && (fgOptionUse2DMatching || fUserEnabledPtFitRange)) {
+   if(!ptVarFound && (fOptionUse2DMatching || fUserEnabledPtFitRange)) {
       cout << "AliResonanceFits::Initialize() Fatal: Pt dimension needed with the current options but was not found in the list of user defined dimensions  !" << endl;
-      cout << "                      The current needed pt variable is " << AliReducedVarManager::fgVariableNames[fPtVariable] << endl;
+      cout << "                      The current needed pt variable is AliReducedVarManager variable " << fPtVariable << endl;
       cout << "                 Use SetPtVariable() to change the desired pt variable, or define the pt dimension via AddVariable(s)()" << endl;
       return kFALSE;       // pt dimension needed for 2D matching or for selected fit pt range
    }
@@ -375,8 +401,8 @@ Bool_t AliResonanceFits::Initialize() {
    if(ptVarFound && !fUserEnabledPtFitRange) {
       cout << "AliResonanceFits::Initialize() Info: Pt fit range used from default values or those set via SetVarRange()" << endl;
       cout << "                    Use SetPtFitRange() if you want a pt fit range different from the one used for signal counting" << endl;
-      fgPtFitRange[0] = fVarLimits[fNVariables-2][0];
-      fgPtFitRange[1] = fVarLimits[fNVariables-2][1];
+      fPtFitRange[0] = fVarLimits[fNVariables-2][0];
+      fPtFitRange[1] = fVarLimits[fNVariables-2][1];
    }    
       
    // Initialize looping variables =======================================
@@ -467,103 +493,103 @@ void AliResonanceFits::AddSlice() {
    TH1* projMELSleg1_ptRange = 0x0; TH1* projMELSleg2_ptRange = 0x0;
    
    // NOTE: Remember, last variable in array is mass (fNVariables-1), and next to last, if its the case, is pt (fNVariables-2) 
-   if(fgOptionUse2DMatching || fUserEnabledPtFitRange) {
+   if(fOptionUse2DMatching || fUserEnabledPtFitRange) {
       // SE-OS slices
       projSEOS = (TH2D*)fSEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-      projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
-      if(!fgOptionUse2DMatching) 
-         projSEOS_ptRange = ((TH2D*)projSEOS)->ProjectionX(Form("projSEOS_ptRange_%.6f", gRandom->Rndm()), 
-                                                                                projSEOS->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                                projSEOS->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+      projSEOS->SetName(UniqueName("projSEOS"));
+      if(!fOptionUse2DMatching) 
+         projSEOS_ptRange = ((TH2D*)projSEOS)->ProjectionX(UniqueName("projSEOS_ptRange"), 
+                                                                                projSEOS->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                                projSEOS->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
       // ME-OS slices
       if(fMEOS) {
          projMEOS = (TH2D*)fMEOS->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
-         if(!fgOptionUse2DMatching)
-            projMEOS_ptRange = ((TH2D*)projMEOS)->ProjectionX(Form("projMEOS_ptRange_%.6f", gRandom->Rndm()), 
-                                                                                    projMEOS->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                                    projMEOS->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+         projMEOS->SetName(UniqueName("projMEOS"));
+         if(!fOptionUse2DMatching)
+            projMEOS_ptRange = ((TH2D*)projMEOS)->ProjectionX(UniqueName("projMEOS_ptRange"), 
+                                                                                    projMEOS->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                                    projMEOS->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
       }
       
       // SE-LS slices
       if(fSELSleg1) {
          projSELSleg1 = (TH2D*)fSELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
+         projSELSleg1->SetName(UniqueName("projSELSleg1"));
          
-         if(!fgOptionUse2DMatching)
-            projSELSleg1_ptRange = ((TH2D*)projSELSleg1)->ProjectionX(Form("projSELSleg1_ptRange_%.6f", gRandom->Rndm()), 
-                                                                                                projSELSleg1->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                                                projSELSleg1->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+         if(!fOptionUse2DMatching)
+            projSELSleg1_ptRange = ((TH2D*)projSELSleg1)->ProjectionX(UniqueName("projSELSleg1_ptRange"), 
+                                                                                                projSELSleg1->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                                                projSELSleg1->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
       }
       if(fSELSleg2) {
          projSELSleg2 = (TH2D*)fSELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
-         if(!fgOptionUse2DMatching)
-            projSELSleg2_ptRange = ((TH2D*)projSELSleg2)->ProjectionX(Form("projSELSleg2_ptRange_%.6f", gRandom->Rndm()), 
-                                                                      projSELSleg2->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                      projSELSleg2->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+         projSELSleg2->SetName(UniqueName("projSELSleg2"));
+         if(!fOptionUse2DMatching)
+            projSELSleg2_ptRange = ((TH2D*)projSELSleg2)->ProjectionX(UniqueName("projSELSleg2_ptRange"), 
+                                                                      projSELSleg2->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                      projSELSleg2->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
       }
       
       // ME-LS slices
       if(fMELSleg1) {
          projMELSleg1 = (TH2D*)fMELSleg1->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
-         if(!fgOptionUse2DMatching) {
-            projMELSleg1_ptRange = ((TH2D*)projMELSleg1)->ProjectionX(Form("projMELSleg1_ptRange_%.6f", gRandom->Rndm()), 
-                                                                                                projMELSleg1->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                                                projMELSleg1->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+         projMELSleg1->SetName(UniqueName("projMELSleg1"));
+         if(!fOptionUse2DMatching) {
+            projMELSleg1_ptRange = ((TH2D*)projMELSleg1)->ProjectionX(UniqueName("projMELSleg1_ptRange"), 
+                                                                                                projMELSleg1->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                                                projMELSleg1->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
          }
       }
       if(fMELSleg2) {
          projMELSleg2 = (TH2D*)fMELSleg2->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
-         if(!fgOptionUse2DMatching)
-            projMELSleg2_ptRange = ((TH2D*)projMELSleg2)->ProjectionX(Form("projMELSleg2_ptRange_%.6f", gRandom->Rndm()), 
-                                                                      projMELSleg2->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                                      projMELSleg2->GetYaxis()->FindBin(fgPtFitRange[1]), "eo");
+         projMELSleg2->SetName(UniqueName("projMELSleg2"));
+         if(!fOptionUse2DMatching)
+            projMELSleg2_ptRange = ((TH2D*)projMELSleg2)->ProjectionX(UniqueName("projMELSleg2_ptRange"), 
+                                                                      projMELSleg2->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                                      projMELSleg2->GetYaxis()->FindBin(fPtFitRange[1]), "eo");
       }
-   }        // end if fgOptionUse2DMatching || fUserEnabledPtFitRange
+   }        // end if fOptionUse2DMatching || fUserEnabledPtFitRange
    else {        // use just 1D matching
       projSEOS = (TH1D*)fSEOS->Projection(fVarIndices[fNVariables-1]);
-      projSEOS->SetName(Form("projSEOS_%.6f", gRandom->Rndm()));
+      projSEOS->SetName(UniqueName("projSEOS"));
       
       if(fMEOS) {
          projMEOS = (TH1D*)fMEOS->Projection(fVarIndices[fNVariables-1]);
-         projMEOS->SetName(Form("projMEOS_%.6f", gRandom->Rndm()));
+         projMEOS->SetName(UniqueName("projMEOS"));
       }
       if(fSELSleg1) {
          projSELSleg1 = (TH1D*)fSELSleg1->Projection(fVarIndices[fNVariables-1]);
-         projSELSleg1->SetName(Form("projSELSleg1_%.6f", gRandom->Rndm()));
+         projSELSleg1->SetName(UniqueName("projSELSleg1"));
       }
       if(fSELSleg2) {
          projSELSleg2 = (TH1D*)fSELSleg2->Projection(fVarIndices[fNVariables-1]);
-         projSELSleg2->SetName(Form("projSELSleg2_%.6f", gRandom->Rndm()));
+         projSELSleg2->SetName(UniqueName("projSELSleg2"));
       }
       if(fMELSleg1) {
          projMELSleg1 = (TH1D*)fMELSleg1->Projection(fVarIndices[fNVariables-1]);
-         projMELSleg1->SetName(Form("projMELSleg1_%.6f", gRandom->Rndm()));
+         projMELSleg1->SetName(UniqueName("projMELSleg1"));
       }
       if(fMELSleg2) {
          projMELSleg2 = (TH1D*)fMELSleg2->Projection(fVarIndices[fNVariables-1]);
-         projMELSleg2->SetName(Form("projMELSleg2_%.6f", gRandom->Rndm()));
+         projMELSleg2->SetName(UniqueName("projMELSleg2"));
       }
    }          // end else
    
    // Add the temporary SEOS slice to the S+B histogram(s)
    if(!fSplusB) {
-      if(fgOptionUse2DMatching) 
-         fSplusB = (TH2D*)projSEOS->Clone(Form("fSplusB_%.6f", gRandom->Rndm()));
+      if(fOptionUse2DMatching) 
+         fSplusB = (TH2D*)projSEOS->Clone(UniqueName("fSplusB"));
       else {
-         if(!fUserEnabledPtFitRange) fSplusB = (TH1D*)projSEOS->Clone(Form("fSplusB_%.6f", gRandom->Rndm()));
-         else fSplusB = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", gRandom->Rndm()), 0, -1, "eo");
+         if(!fUserEnabledPtFitRange) fSplusB = (TH1D*)projSEOS->Clone(UniqueName("fSplusB"));
+         else fSplusB = ((TH2D*)projSEOS)->ProjectionX(UniqueName("fSplusB"), 0, -1, "eo");
       }
       fSplusB->SetDirectory(0x0);
    }
    else {
-      if(fgOptionUse2DMatching || (!fgOptionUse2DMatching && !fUserEnabledPtFitRange))
+      if(fOptionUse2DMatching || (!fOptionUse2DMatching && !fUserEnabledPtFitRange))
          fSplusB->Add(projSEOS);
       else {
-         TH1D* tempHist = ((TH2D*)projSEOS)->ProjectionX(Form("fSplusB_%.6f", gRandom->Rndm()), 0, -1, "eo");
+         TH1D* tempHist = ((TH2D*)projSEOS)->ProjectionX(UniqueName("fSplusB"), 0, -1, "eo");
          fSplusB->Add(tempHist);
          delete tempHist;
       }
@@ -574,16 +600,16 @@ void AliResonanceFits::AddSlice() {
    if(fOptionBkgMethod==kBkgMixedEvent) {
       TH1* scaleHist = 0x0;
       // Scale to the SE-OS in the mass bands
-      if(fgOptionMEMatching==kMatchSEOS) scaleHist = (!fgOptionUse2DMatching && fUserEnabledPtFitRange ? projSEOS_ptRange : projSEOS);
+      if(fOptionMEMatching==kMatchSEOS) scaleHist = (!fOptionUse2DMatching && fUserEnabledPtFitRange ? projSEOS_ptRange : projSEOS);
       // Scale to the SE-LS in the full allowed mass range
-      if(fgOptionMEMatching==kMatchSELS) { 
-         if(!fgOptionUse2DMatching && fUserEnabledPtFitRange)
+      if(fOptionMEMatching==kMatchSELS) { 
+         if(!fOptionUse2DMatching && fUserEnabledPtFitRange)
             scaleHist = BuildLSbkg(projSELSleg1_ptRange, projSELSleg2_ptRange, projMEOS_ptRange, projMELSleg1_ptRange, projMELSleg2_ptRange);
          else
             scaleHist = BuildLSbkg(projSELSleg1, projSELSleg2, projMEOS, projMELSleg1, projMELSleg2);
       }
       TH1* bkgHist = projMEOS;
-      if(!fgOptionUse2DMatching && fUserEnabledPtFitRange) bkgHist = projMEOS_ptRange;
+      if(!fOptionUse2DMatching && fUserEnabledPtFitRange) bkgHist = projMEOS_ptRange;
       
       // compute background scale factor; scale factor is temporarilly stored in fFitValues[kBkgScale]
       ComputeScale(scaleHist, bkgHist);      
@@ -594,13 +620,13 @@ void AliResonanceFits::AddSlice() {
    
    // Construct the mixed event background from LS pairs
    if(fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
-      TH1* scaleHist = (!fgOptionUse2DMatching && fUserEnabledPtFitRange ? projSELSleg1_ptRange : projSELSleg1);
-      TH1* bkgHist = (!fgOptionUse2DMatching && fUserEnabledPtFitRange ? projMELSleg1_ptRange : projMELSleg1);
+      TH1* scaleHist = (!fOptionUse2DMatching && fUserEnabledPtFitRange ? projSELSleg1_ptRange : projSELSleg1);
+      TH1* bkgHist = (!fOptionUse2DMatching && fUserEnabledPtFitRange ? projMELSleg1_ptRange : projMELSleg1);
       ComputeScale(scaleHist, bkgHist);
       projMELSleg1->Scale(fFitValues[kBkgScale]);
             
-      scaleHist = (!fgOptionUse2DMatching && fUserEnabledPtFitRange ? projSELSleg2_ptRange : projSELSleg2);
-      bkgHist = (!fgOptionUse2DMatching && fUserEnabledPtFitRange ? projMELSleg2_ptRange : projMELSleg2);
+      scaleHist = (!fOptionUse2DMatching && fUserEnabledPtFitRange ? projSELSleg2_ptRange : projSELSleg2);
+      bkgHist = (!fOptionUse2DMatching && fUserEnabledPtFitRange ? projMELSleg2_ptRange : projMELSleg2);
       ComputeScale(scaleHist, bkgHist);
       projMELSleg2->Scale(fFitValues[kBkgScale]);      
       
@@ -617,7 +643,7 @@ void AliResonanceFits::AddSlice() {
    
    // Construct the like-sign background
    if(fOptionBkgMethod==kBkgLikeSign) {
-      if(!fgOptionUse2DMatching && fUserEnabledPtFitRange)
+      if(!fOptionUse2DMatching && fUserEnabledPtFitRange)
          bkgSlice = BuildLSbkg(projSELSleg1_ptRange, projSELSleg2_ptRange, projMEOS_ptRange, projMELSleg1_ptRange, projMELSleg2_ptRange);
       else
          bkgSlice = BuildLSbkg(projSELSleg1, projSELSleg2, projMEOS, projMELSleg1, projMELSleg2);
@@ -626,10 +652,10 @@ void AliResonanceFits::AddSlice() {
    // Add the current bkg slice to the total
    if(bkgSlice) {
       if(!fBkg) {
-         if(fgOptionUse2DMatching) 
-            fBkg = (TH2D*)bkgSlice->Clone(Form("fBkg_%.6f", gRandom->Rndm()));
+         if(fOptionUse2DMatching) 
+            fBkg = (TH2D*)bkgSlice->Clone(UniqueName("fBkg"));
          else 
-            fBkg = (TH1D*)bkgSlice->Clone(Form("fBkg_%.6f", gRandom->Rndm()));
+            fBkg = (TH1D*)bkgSlice->Clone(UniqueName("fBkg"));
       }
       else
          fBkg->Add(bkgSlice);
@@ -655,12 +681,12 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
    // Compute the SE-LS projection with R-factor correction if its the case 
    //
    TH1* mels = 0x0; TH1* sels = 0x0;
-   if(fgOptionUse2DMatching) sels = (TH2D*)selsLeg1->Clone(Form("sels%.6f", gRandom->Rndm()));
-   else                      sels = (TH1D*)selsLeg1->Clone(Form("sels%.6f", gRandom->Rndm()));
+   if(fOptionUse2DMatching) sels = (TH2D*)selsLeg1->Clone(UniqueName("sels"));
+   else                      sels = (TH1D*)selsLeg1->Clone(UniqueName("sels"));
    
    if(fOptionUseRfactorCorrection) {
-      if(fgOptionUse2DMatching)  mels = (TH2D*)melsLeg1->Clone(Form("mels%.6f", gRandom->Rndm()));
-      else                       mels = (TH1D*)melsLeg1->Clone(Form("mels%.6f", gRandom->Rndm()));
+      if(fOptionUse2DMatching)  mels = (TH2D*)melsLeg1->Clone(UniqueName("mels"));
+      else                       mels = (TH1D*)melsLeg1->Clone(UniqueName("mels"));
    }
    
    sels->Sumw2();
@@ -680,8 +706,8 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
       mels->Scale(0.5);
             
       TH1* rFactor = 0x0;
-      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm()));
-      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm())); 
+      if(fOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(UniqueName("rFactor"));
+      else                      rFactor = (TH1D*)meos->Clone(UniqueName("rFactor")); 
       rFactor->Sumw2();
       rFactor->Divide(mels);
       sels->Multiply(rFactor);
@@ -702,8 +728,8 @@ TH1* AliResonanceFits::BuildLSbkg(TH1* selsLeg1, TH1* selsLeg2, TH1* meos /*=0x0
       mels->Multiply(melsLeg2);
       SqrtTH1(mels);    
       TH1* rFactor = 0x0;
-      if(fgOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm()));
-      else                      rFactor = (TH1D*)meos->Clone(Form("rFactor%.6f", gRandom->Rndm())); 
+      if(fOptionUse2DMatching) rFactor = (TH2D*)meos->Clone(UniqueName("rFactor"));
+      else                      rFactor = (TH1D*)meos->Clone(UniqueName("rFactor")); 
       rFactor->Sumw2();
       rFactor->Divide(mels);
       sels->Multiply(rFactor);
@@ -753,51 +779,51 @@ void AliResonanceFits::ComputeScale(TH1* scaleHist, TH1* bkgHist) {
 //____________________________________________________________________________________
 void AliResonanceFits::ComputeEntryScale(TH1* sig, TH1* bkg) {
    //
-   // Compute the scale of the bkg histogram to sig based on the number of entries in the fitting range fgMassFitRange
+   // Compute the scale of the bkg histogram to sig based on the number of entries in the fitting range fMassFitRange
    //    and excluding fgMassExclusionRange(s)
-   // NOTE: The exclusion ranges are considered to be non-overlapping sub-intervals of the fgMassFitRange
+   // NOTE: The exclusion ranges are considered to be non-overlapping sub-intervals of the fMassFitRange
    //
    Double_t entriesSig = 0.; Double_t entriesSigErr = 0.;
    Double_t entriesSigExcl = 0.; Double_t entriesSigExclErr = 0.;
    Double_t entriesBkg = 0.; Double_t entriesBkgErr = 0.;
    Double_t entriesBkgExcl = 0.; Double_t entriesBkgExclErr = 0.;
-   if(fgOptionUse2DMatching) {
-      entriesSig = ((TH2*)sig)->IntegralAndError(sig->GetXaxis()->FindBin(fgMassFitRange[0]), sig->GetXaxis()->FindBin(fgMassFitRange[1]),
-                                                 sig->GetYaxis()->FindBin(fgPtFitRange[0]), sig->GetYaxis()->FindBin(fgPtFitRange[1]), entriesSigErr);
-      entriesBkg = ((TH2*)bkg)->IntegralAndError(bkg->GetXaxis()->FindBin(fgMassFitRange[0]), bkg->GetXaxis()->FindBin(fgMassFitRange[1]),
-                                                 bkg->GetYaxis()->FindBin(fgPtFitRange[0]), bkg->GetYaxis()->FindBin(fgPtFitRange[1]), entriesBkgErr);
-      if(fgOptionMEMatching == kMatchSEOS) {
-         for(Int_t i=0; i<fgNMassExclusionRanges; ++i) {     // sum over all defined mass exclusion ranges
+   if(fOptionUse2DMatching) {
+      entriesSig = ((TH2*)sig)->IntegralAndError(sig->GetXaxis()->FindBin(fMassFitRange[0]), sig->GetXaxis()->FindBin(fMassFitRange[1]),
+                                                 sig->GetYaxis()->FindBin(fPtFitRange[0]), sig->GetYaxis()->FindBin(fPtFitRange[1]), entriesSigErr);
+      entriesBkg = ((TH2*)bkg)->IntegralAndError(bkg->GetXaxis()->FindBin(fMassFitRange[0]), bkg->GetXaxis()->FindBin(fMassFitRange[1]),
+                                                 bkg->GetYaxis()->FindBin(fPtFitRange[0]), bkg->GetYaxis()->FindBin(fPtFitRange[1]), entriesBkgErr);
+      if(fOptionMEMatching == kMatchSEOS) {
+         for(Int_t i=0; i<fNMassExclusionRanges; ++i) {     // sum over all defined mass exclusion ranges
             Double_t tempErr = 0.0;
-            entriesSigExcl += ((TH2*)sig)->IntegralAndError(sig->GetXaxis()->FindBin(fgMassExclusionRanges[i][0]), 
-                                                            sig->GetXaxis()->FindBin(fgMassExclusionRanges[i][1]),
-                                                            sig->GetYaxis()->FindBin(fgPtFitRange[0]), 
-                                                            sig->GetYaxis()->FindBin(fgPtFitRange[1]), tempErr);
+            entriesSigExcl += ((TH2*)sig)->IntegralAndError(sig->GetXaxis()->FindBin(fMassExclusionRanges[i][0]), 
+                                                            sig->GetXaxis()->FindBin(fMassExclusionRanges[i][1]),
+                                                            sig->GetYaxis()->FindBin(fPtFitRange[0]), 
+                                                            sig->GetYaxis()->FindBin(fPtFitRange[1]), tempErr);
             entriesSigExclErr += tempErr*tempErr;
             
-            entriesBkgExcl += ((TH2*)bkg)->IntegralAndError(bkg->GetXaxis()->FindBin(fgMassExclusionRanges[i][0]), bkg->GetXaxis()->FindBin(fgMassExclusionRanges[i][1]),
-                                                            bkg->GetXaxis()->FindBin(fgPtFitRange[0]), bkg->GetXaxis()->FindBin(fgPtFitRange[1]), tempErr);
+            entriesBkgExcl += ((TH2*)bkg)->IntegralAndError(bkg->GetXaxis()->FindBin(fMassExclusionRanges[i][0]), bkg->GetXaxis()->FindBin(fMassExclusionRanges[i][1]),
+                                                            bkg->GetXaxis()->FindBin(fPtFitRange[0]), bkg->GetXaxis()->FindBin(fPtFitRange[1]), tempErr);
             entriesBkgExclErr += tempErr*tempErr;
          }
       }         
    }
    else {
-      entriesSig = sig->IntegralAndError(sig->GetXaxis()->FindBin(fgMassFitRange[0]), sig->GetXaxis()->FindBin(fgMassFitRange[1]), entriesSigErr);
-      entriesBkg = bkg->IntegralAndError(bkg->GetXaxis()->FindBin(fgMassFitRange[0]), bkg->GetXaxis()->FindBin(fgMassFitRange[1]), entriesBkgErr);
+      entriesSig = sig->IntegralAndError(sig->GetXaxis()->FindBin(fMassFitRange[0]), sig->GetXaxis()->FindBin(fMassFitRange[1]), entriesSigErr);
+      entriesBkg = bkg->IntegralAndError(bkg->GetXaxis()->FindBin(fMassFitRange[0]), bkg->GetXaxis()->FindBin(fMassFitRange[1]), entriesBkgErr);
       
-      if(fgOptionMEMatching == kMatchSEOS) {
-         for(Int_t i=0; i<fgNMassExclusionRanges; ++i) {    // sum over all defined mass exclusion ranges
+      if(fOptionMEMatching == kMatchSEOS) {
+         for(Int_t i=0; i<fNMassExclusionRanges; ++i) {    // sum over all defined mass exclusion ranges
             Double_t tempErr = 0.0;
-            entriesSigExcl += sig->IntegralAndError(sig->GetXaxis()->FindBin(fgMassExclusionRanges[i][0]), sig->GetXaxis()->FindBin(fgMassExclusionRanges[i][1]), tempErr);
+            entriesSigExcl += sig->IntegralAndError(sig->GetXaxis()->FindBin(fMassExclusionRanges[i][0]), sig->GetXaxis()->FindBin(fMassExclusionRanges[i][1]), tempErr);
             entriesSigExclErr += tempErr*tempErr;
             
-            entriesBkgExcl = bkg->IntegralAndError(bkg->GetXaxis()->FindBin(fgMassExclusionRanges[i][0]), bkg->GetXaxis()->FindBin(fgMassExclusionRanges[i][1]), tempErr);
+            entriesBkgExcl = bkg->IntegralAndError(bkg->GetXaxis()->FindBin(fMassExclusionRanges[i][0]), bkg->GetXaxis()->FindBin(fMassExclusionRanges[i][1]), tempErr);
             entriesBkgExclErr += tempErr*tempErr;
          }
       }
    }
    // If not matching to the SE-LS subtract the yield in the exclusion range from the total; recompute uncertainty using quadrature
-   if(fgOptionMEMatching == kMatchSEOS) {
+   if(fOptionMEMatching == kMatchSEOS) {
       entriesSig -= entriesSigExcl;
       entriesBkg -= entriesBkgExcl;
       entriesSigErr = TMath::Sqrt(entriesSigErr*entriesSigErr + entriesSigExclErr);
@@ -814,34 +840,34 @@ void AliResonanceFits::ComputeEntryScale(TH1* sig, TH1* bkg) {
 //____________________________________________________________________________________
 void AliResonanceFits::ComputeWeightedScale(TH1* sig, TH1* bkg) {
    //
-   // Compute the scale of the bkg histogram to sig based on the number of entries in the fitting range fgMassFitRange
+   // Compute the scale of the bkg histogram to sig based on the number of entries in the fitting range fMassFitRange
    //    and excluding fgMassExclusionRange(s)
-   // NOTE: The exclusion range is considered to be a sub-interval of the fgMassFitRange
+   // NOTE: The exclusion range is considered to be a sub-interval of the fMassFitRange
    //
    
    // obtain the S/B histogram
    TH1* soverb = 0x0;
-   if(fgOptionUse2DMatching) 
-      soverb = (TH2D*)sig->Clone(Form("soverb_%.6f", gRandom->Rndm()));
+   if(fOptionUse2DMatching) 
+      soverb = (TH2D*)sig->Clone(UniqueName("soverb"));
    else
-      soverb = (TH1D*)sig->Clone(Form("soverb_%.6f", gRandom->Rndm()));
+      soverb = (TH1D*)sig->Clone(UniqueName("soverb"));
    soverb->Divide(bkg);   
    
    // loop to compute the weighted average
    Double_t sweights = 0.0; Double_t avWeights = 0.0; Double_t nMassBins=0;
    Double_t serror = 0.0;
    
-   for(Int_t ipt=1; ipt<=(fgOptionUse2DMatching ? soverb->GetYaxis()->GetNbins() : 1); ++ipt) {
-      Float_t pt = (fgOptionUse2DMatching ? soverb->GetYaxis()->GetBinCenter(ipt) : 0.0);
-      if(fgOptionUse2DMatching && (pt<fgPtFitRange[0] || pt>fgPtFitRange[1])) continue;      // only the selected pt fit range 
+   for(Int_t ipt=1; ipt<=(fOptionUse2DMatching ? soverb->GetYaxis()->GetNbins() : 1); ++ipt) {
+      Float_t pt = (fOptionUse2DMatching ? soverb->GetYaxis()->GetBinCenter(ipt) : 0.0);
+      if(fOptionUse2DMatching && (pt<fPtFitRange[0] || pt>fPtFitRange[1])) continue;      // only the selected pt fit range 
       
       for(Int_t im=1; im<=sig->GetXaxis()->GetNbins(); ++im) {
          Double_t m = soverb->GetXaxis()->GetBinCenter(im);
-         if(m<fgMassFitRange[0] || m>fgMassFitRange[1]) continue;    // only the selected mass fit range
-         if(fgOptionMEMatching == kMatchSEOS) {                 // exclude the region around the peak only if matching to SE-OS
+         if(m<fMassFitRange[0] || m>fMassFitRange[1]) continue;    // only the selected mass fit range
+         if(fOptionMEMatching == kMatchSEOS) {                 // exclude the region around the peak only if matching to SE-OS
             Bool_t exclude = kFALSE;
-            for(Int_t i=0; i<fgNMassExclusionRanges; ++i) {
-               if(m>fgMassExclusionRanges[i][0] && m<fgMassExclusionRanges[i][1]) {
+            for(Int_t i=0; i<fNMassExclusionRanges; ++i) {
+               if(m>fMassExclusionRanges[i][0] && m<fMassExclusionRanges[i][1]) {
                   exclude = kTRUE;
                   break;     // exclude the fgMassExclusionRange
                }
@@ -849,8 +875,8 @@ void AliResonanceFits::ComputeWeightedScale(TH1* sig, TH1* bkg) {
             if(exclude) continue;
          }
          
-         Double_t s = (fgOptionUse2DMatching ? soverb->GetBinContent(im,ipt) : soverb->GetBinContent(im)); 
-         Double_t sErr = (fgOptionUse2DMatching ? soverb->GetBinError(im,ipt) : soverb->GetBinError(im));
+         Double_t s = (fOptionUse2DMatching ? soverb->GetBinContent(im,ipt) : soverb->GetBinContent(im)); 
+         Double_t sErr = (fOptionUse2DMatching ? soverb->GetBinError(im,ipt) : soverb->GetBinError(im));
          if(sErr<1.0e-5) continue;          // 1.0e-5 is supposed to mean a very small number; here we actually deal with counts, so numbers of 1 or above
          
          // weighting using S/B error
@@ -876,15 +902,15 @@ void AliResonanceFits::FitScale(TH1* sig, TH1* bkg, Bool_t fixScale /*=kFALSE*/)
    //
    // Compute the bkg scaling by fitting
    //
-   fgTempSignal = sig;
-   fgTempBkg = bkg;
+   fTempSignal = sig;
+   fTempBkg = bkg;
    
    Double_t arglist[2];
    Int_t ierflg=0;
    // NOTE: Initialize Minuit to fit one single parameter (the scale)
    if(!fMinuitFitter) {
-      fMinuitFitter = new TMinuit(1);
-      fMinuitFitter->SetFCN(Fcn);
+      R__LOCKGUARD2(gResonanceFitsMinuitMutex);
+      fMinuitFitter = new AliResonanceFitsMinuit(this);
       
       if(fOptionMinuit==kMinuitMethodChi2) arglist[0] = 1.0;
       if(fOptionMinuit==kMinuitMethodLikelihood) arglist[0] = 0.5;
@@ -910,16 +936,16 @@ void AliResonanceFits::FitScale(TH1* sig, TH1* bkg, Bool_t fixScale /*=kFALSE*/)
 }
 
 //____________________________________________________________________________________
-void AliResonanceFits::Fcn(Int_t&, Double_t*, Double_t &f, Double_t *par, Int_t) {
+Double_t AliResonanceFits::ScaleChi2(Double_t scale) const {
    //
-   // chi2 function used as interface with minuit
-   // par[0] - scale factor for the background histogram
+   // chi2 function used as interface with minuit (see AliResonanceFitsMinuit)
+   // scale - scale factor for the background histogram
    //
-   f = AliResonanceFits::Chi2(fgTempSignal, fgTempBkg, par[0]);
+   return Chi2(fTempSignal, fTempBkg, scale);
 }
 
 //____________________________________________________________________________________
-Double_t AliResonanceFits::Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t scaleError /*=0.0*/) {
+Double_t AliResonanceFits::Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t scaleError /*=0.0*/) const {
    //
    // Compute the chi2 for the difference between the signal and scaled background
    // Assume signal and background uncertainties are uncorrelated
@@ -930,17 +956,17 @@ Double_t AliResonanceFits::Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t sca
    Float_t chi2 = 0.0;
    Int_t ndf = 0;
    
-   for(Int_t ipt=1; ipt<=(fgOptionUse2DMatching ? sig->GetYaxis()->GetNbins() : 1); ++ipt) {
-      Float_t pt = (fgOptionUse2DMatching ? sig->GetYaxis()->GetBinCenter(ipt) : 0.0);
-      if(fgOptionUse2DMatching && (pt<fgPtFitRange[0] || pt>fgPtFitRange[1])) continue;      // only the selected pt fit range 
+   for(Int_t ipt=1; ipt<=(fOptionUse2DMatching ? sig->GetYaxis()->GetNbins() : 1); ++ipt) {
+      Float_t pt = (fOptionUse2DMatching ? sig->GetYaxis()->GetBinCenter(ipt) : 0.0);
+      if(fOptionUse2DMatching && (pt<fPtFitRange[0] || pt>fPtFitRange[1])) continue;      // only the selected pt fit range 
       
       for(Int_t im=1; im<=sig->GetXaxis()->GetNbins(); ++im) {
          Double_t m = sig->GetXaxis()->GetBinCenter(im);
-         if(m<fgMassFitRange[0] || m>fgMassFitRange[1]) continue;    // only the selected mass fit range
-         if(fgOptionMEMatching == kMatchSEOS) {                 // exclude the region around the peak only if matching to SE-OS
+         if(m<fMassFitRange[0] || m>fMassFitRange[1]) continue;    // only the selected mass fit range
+         if(fOptionMEMatching == kMatchSEOS) {                 // exclude the region around the peak only if matching to SE-OS
             Bool_t exclude = kFALSE;
-            for(Int_t i=0; i<fgNMassExclusionRanges; ++i) {
-               if(m>fgMassExclusionRanges[i][0] && m<fgMassExclusionRanges[i][1]) {
+            for(Int_t i=0; i<fNMassExclusionRanges; ++i) {
+               if(m>fMassExclusionRanges[i][0] && m<fMassExclusionRanges[i][1]) {
                   exclude = kTRUE;
                   break;     // exclude the fgMassExclusionRange
                }
@@ -948,14 +974,14 @@ Double_t AliResonanceFits::Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t sca
             if(exclude) continue;
          }
          
-         Double_t sigVal = (fgOptionUse2DMatching ? sig->GetBinContent(im,ipt) : sig->GetBinContent(im));
-         if(!fgOptionUseSignificantZero && sigVal<0.0001) continue;
-         Double_t bkgVal = (fgOptionUse2DMatching ? bkg->GetBinContent(im,ipt) : bkg->GetBinContent(im));
+         Double_t sigVal = (fOptionUse2DMatching ? sig->GetBinContent(im,ipt) : sig->GetBinContent(im));
+         if(!fOptionUseSignificantZero && sigVal<0.0001) continue;
+         Double_t bkgVal = (fOptionUse2DMatching ? bkg->GetBinContent(im,ipt) : bkg->GetBinContent(im));
          if(bkgVal<=0.0001) continue;
-         Double_t sigErr = (fgOptionUse2DMatching ? sig->GetBinError(im,ipt) : sig->GetBinError(im));
+         Double_t sigErr = (fOptionUse2DMatching ? sig->GetBinError(im,ipt) : sig->GetBinError(im));
          if(sigVal<0.0001)   // when considering zero entry bins as significant, assume error to be 1
             sigErr = 1.0;
-         Double_t bkgErr = (fgOptionUse2DMatching ? bkg->GetBinError(im,ipt) : bkg->GetBinError(im));
+         Double_t bkgErr = (fOptionUse2DMatching ? bkg->GetBinError(im,ipt) : bkg->GetBinError(im));
          
          Float_t err = 0.0;
          if(scale>0.0)
@@ -982,7 +1008,7 @@ Double_t AliResonanceFits::GlobalFitFunction(Double_t *x, Double_t* par) {
    //cout << "par0 = " << par[0] << endl;
    Double_t val = fSignalMCshape->GetBinContent(fSignalMCshape->FindBin(x[0]));
    val *= par[0];
-   //val += par[1]*fgTempBkg->GetBinContent(fgTempBkg->FindBin(x[0]));
+   //val += par[1]*fTempBkg->GetBinContent(fTempBkg->FindBin(x[0]));
    //cout << "sigVal = " << val << endl;
    for(Int_t i=0;i<fBkgFitFunction->GetNpar();++i) {
       fBkgFitFunction->SetParameter(i, par[i+1]);
@@ -993,6 +1019,15 @@ Double_t AliResonanceFits::GlobalFitFunction(Double_t *x, Double_t* par) {
    return val;
 }
 
+//_______________________________________________________________________________
+const Char_t* AliResonanceFits::UniqueName(const Char_t* prefix) {
+   //
+   // name for the temporary histograms and functions, unique among all the AliResonanceFits instances
+   // NOTE: used instead of random names, since gRandom must not be used from several threads
+   //
+   return Form("%s_%p_%d", prefix, (void*)this, fNUniqueNames++);
+}
+
 //_______________________________________________________________________________
 void AliResonanceFits::FitInvMass() {
    //
@@ -1000,13 +1035,15 @@ void AliResonanceFits::FitInvMass() {
    //
    if(!fSignalMCshape && fSEOS_MCtruth) {
       fSignalMCshape = (TH1D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-1]);
-      fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+      fSignalMCshape->SetName(UniqueName("fSignalMCshape"));
    }
    
    if(fGlobalFitFunction) delete fGlobalFitFunction;
    
-   fGlobalFitFunction = new TF1("GlobalFitFunction", GlobalFitFunction, 0.0, 10.0, 1+fBkgFitFunction->GetNpar());
-   //fgTempBkg = fBkg;
+   // NOTE: the function is bound to this instance and has a unique name, so that several fitters can be used at once
+   fGlobalFitFunction = new TF1(UniqueName("GlobalFitFunction"), this, &AliResonanceFits::GlobalFitFunction, 0.0, 10.0, 1+fBkgFitFunction->GetNpar(),
+                                "AliResonanceFits", "GlobalFitFunction");
+   //fTempBkg = fBkg;
    fGlobalFitFunction->SetParameter(0, 1.);
    //fGlobalFitFunction->SetParameter(1, 1.);
    fGlobalFitFunction->SetNpx(10000.);
@@ -1026,8 +1063,11 @@ void AliResonanceFits::FitInvMass() {
    
    if(fOptionBkgMethod==kBkgFitFunction) {
       // fit of S+B
-      fSplusB->Fit("GlobalFitFunction", "ME0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
-      fFitResult = fSplusB->Fit("GlobalFitFunction", "SME0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
+      {
+         R__LOCKGUARD2(gResonanceFitsMinuitMutex);
+         fSplusB->Fit(fGlobalFitFunction, "ME0", "Q", fMassFitRange[0], fMassFitRange[1]);
+         fFitResult = fSplusB->Fit(fGlobalFitFunction, "SME0", "Q", fMassFitRange[0], fMassFitRange[1]);
+      }
       for(Int_t i=0;i<fBkgFitFunction->GetNpar();++i) 
          fBkgFitFunction->SetParameter(i, fGlobalFitFunction->GetParameter(i+1));
       //fSplusB->Draw();
@@ -1037,9 +1077,9 @@ void AliResonanceFits::FitInvMass() {
    
    if(fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
       // fit the residual bkg + signal distribution
-      fSplusResidualBkg = (TH1*)fSplusB->Clone(Form("ResidualBkg_%.6f", gRandom->Rndm()));
+      fSplusResidualBkg = (TH1*)fSplusB->Clone(UniqueName("ResidualBkg"));
       fSplusResidualBkg->Add(fBkg, -1.0);
-      fSplusBblind = (TH1*)fSplusB->Clone(Form("SplusBblind_%.6f", gRandom->Rndm()));
+      fSplusBblind = (TH1*)fSplusB->Clone(UniqueName("SplusBblind"));
       fSplusBblind->Add(fBkg, -1.0);
       // protect against bins where there are no entries in the SE, but the ME bkg is very small and with small errors
       //  set the uncertainty in those bins to 1
@@ -1048,27 +1088,33 @@ void AliResonanceFits::FitInvMass() {
             fSplusResidualBkg->SetBinError(ib,1.0);
             fSplusBblind->SetBinError(ib,1.0);
          }
-         if(fSplusResidualBkg->GetXaxis()->GetBinCenter(ib) >= fgMassExclusionRanges[0][0] &&
-            fSplusResidualBkg->GetXaxis()->GetBinCenter(ib) <= fgMassExclusionRanges[0][1]) {
+         if(fSplusResidualBkg->GetXaxis()->GetBinCenter(ib) >= fMassExclusionRanges[0][0] &&
+            fSplusResidualBkg->GetXaxis()->GetBinCenter(ib) <= fMassExclusionRanges[0][1]) {
                fSplusBblind->SetBinContent(ib, 0.0);
                fSplusBblind->SetBinError(ib, 0.0);
          }
       }
       //fBkgFitFunction->SetParameters(1.6, -0.8);
-      fSplusBblind->Fit(fBkgFitFunction, "MEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
-      fSplusBblind->Fit(fBkgFitFunction, "MEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
+      {
+         R__LOCKGUARD2(gResonanceFitsMinuitMutex);
+         fSplusBblind->Fit(fBkgFitFunction, "MEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
+         fSplusBblind->Fit(fBkgFitFunction, "MEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
+      }
       for(Int_t i=0;i<fBkgFitFunction->GetNpar();++i) {
          fGlobalFitFunction->SetParameter(i+1, fBkgFitFunction->GetParameter(i));
       }
-      //fGlobalFitFunction->SetParameter(0, fSplusResidualBkg->Integral(fSplusResidualBkg->GetXaxis()->FindBin(fgMassExclusionRanges[0][0]), fSplusResidualBkg->GetXaxis()->FindBin(fgMassExclusionRanges[0][1]))/ fSignalMCshape->Integral(fSignalMCshape->GetXaxis()->FindBin(fgMassExclusionRanges[0][0]), fSignalMCshape->GetXaxis()->FindBin(fgMassExclusionRanges[0][1])));
+      //fGlobalFitFunction->SetParameter(0, fSplusResidualBkg->Integral(fSplusResidualBkg->GetXaxis()->FindBin(fMassExclusionRanges[0][0]), fSplusResidualBkg->GetXaxis()->FindBin(fMassExclusionRanges[0][1]))/ fSignalMCshape->Integral(fSignalMCshape->GetXaxis()->FindBin(fMassExclusionRanges[0][0]), fSignalMCshape->GetXaxis()->FindBin(fMassExclusionRanges[0][1])));
       
       
       fGlobalFitFunction->SetParameter(0, 0.0004);
       //fGlobalFitFunction->SetParameter(1, 1.6);
       //fGlobalFitFunction->SetParameter(2, -0.8);
       //fGlobalFitFunction->SetParameter(0, 0.0005);
-      fSplusResidualBkg->Fit(fGlobalFitFunction, "MEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
-      fFitResult = fSplusResidualBkg->Fit(fGlobalFitFunction, "SMEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
+      {
+         R__LOCKGUARD2(gResonanceFitsMinuitMutex);
+         fSplusResidualBkg->Fit(fGlobalFitFunction, "MEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
+         fFitResult = fSplusResidualBkg->Fit(fGlobalFitFunction, "SMEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
+      }
       for(Int_t i=0;i<fBkgFitFunction->GetNpar();++i)
          fBkgFitFunction->SetParameter(i, fGlobalFitFunction->GetParameter(i+1));
       //fBkg->Scale(fGlobalFitFunction->GetParameter(1));
@@ -1078,8 +1124,8 @@ void AliResonanceFits::FitInvMass() {
       
       /*fGlobalFitFunction->SetParameters(0.0007, 1.0, -0.3, -0.8);
       fGlobalFitFunction->SetParLimits(1, 0.95, 1.05);
-      fSplusB->Fit("GlobalFitFunction", "MEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
-      fFitResult = fSplusB->Fit("GlobalFitFunction", "SMEI0", "Q", fgMassFitRange[0], fgMassFitRange[1]);
+      fSplusB->Fit("GlobalFitFunction", "MEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
+      fFitResult = fSplusB->Fit("GlobalFitFunction", "SMEI0", "Q", fMassFitRange[0], fMassFitRange[1]);
       for(Int_t i=0;i<fBkgFitFunction->GetNpar();++i)
          fBkgFitFunction->SetParameter(i, fGlobalFitFunction->GetParameter(i+2));
       fBkg->Scale(fGlobalFitFunction->GetParameter(1));
@@ -1106,7 +1152,7 @@ Bool_t AliResonanceFits::Process() {
       fOptionDebug)
    Slice();
    
-   if(!fgOptionUse2DMatching && (fOptionBkgMethod==kBkgFitFunction || fOptionBkgMethod==kBkgMixedEventAndResidualFit))
+   if(!fOptionUse2DMatching && (fOptionBkgMethod==kBkgFitFunction || fOptionBkgMethod==kBkgMixedEventAndResidualFit))
       FitInvMass();
    
    if(fOptionScaleSummedBkg && !(fOptionBkgMethod==kBkgFitFunction || fOptionBkgMethod==kBkgMixedEventAndResidualFit)) {
@@ -1118,28 +1164,28 @@ Bool_t AliResonanceFits::Process() {
    if(fSoverB) {delete fSoverB; fSoverB = 0;}
    if(!(fOptionBkgMethod==kBkgFitFunction || fOptionBkgMethod==kBkgMixedEventAndResidualFit)) {
       // build the signal projection
-      if(fgOptionUse2DMatching)
-         fSig = (TH2D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+      if(fOptionUse2DMatching)
+         fSig = (TH2D*)fSplusB->Clone(UniqueName("fSig"));
       else
-         fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+         fSig = (TH1D*)fSplusB->Clone(UniqueName("fSig"));
       fSig->Add(fBkg, -1.0);
    
       // build the S/B projection
-      if(fgOptionUse2DMatching)
-         fSoverB = (TH2D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+      if(fOptionUse2DMatching)
+         fSoverB = (TH2D*)fSig->Clone(UniqueName("fSoverB"));
       else {
-         fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+         fSoverB = (TH1D*)fSig->Clone(UniqueName("fSoverB"));
       }
       fSoverB->Divide(fBkg);    // TODO:  the fBkg should also contain the residual bkg
    }
-   if(!fgOptionUse2DMatching && fOptionBkgMethod==kBkgFitFunction) {
-      fSig = (TH1D*)fSplusB->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+   if(!fOptionUse2DMatching && fOptionBkgMethod==kBkgFitFunction) {
+      fSig = (TH1D*)fSplusB->Clone(UniqueName("fSig"));
       fSig->Reset();
       for(Int_t ib=1; ib<=fSig->GetXaxis()->GetNbins(); ++ib) {
          fSig->SetBinContent(ib, fSplusB->GetBinContent(ib)-fBkgFitFunction->Eval(fSig->GetXaxis()->GetBinCenter(ib)));
          fSig->SetBinError(ib, fSplusB->GetBinError(ib));
       }
-      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+      fSoverB = (TH1D*)fSig->Clone(UniqueName("fSoverB"));
       for(Int_t ib=1; ib<=fSoverB->GetXaxis()->GetNbins(); ++ib) {
          if(TMath::Abs(fBkgFitFunction->Eval(fSoverB->GetXaxis()->GetBinCenter(ib)))>1.0e-8) {
             fSoverB->SetBinContent(ib, fSoverB->GetBinContent(ib) / fBkgFitFunction->Eval(fSoverB->GetXaxis()->GetBinCenter(ib)));
@@ -1153,12 +1199,12 @@ Bool_t AliResonanceFits::Process() {
       //fSig->Draw();
       //fSoverB->Draw();
    }
-   if(!fgOptionUse2DMatching && fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
-      fSig = (TH1D*)fSplusResidualBkg->Clone(Form("fSig_%.6f", gRandom->Rndm()));
+   if(!fOptionUse2DMatching && fOptionBkgMethod==kBkgMixedEventAndResidualFit) {
+      fSig = (TH1D*)fSplusResidualBkg->Clone(UniqueName("fSig"));
       for(Int_t ib=1; ib<=fSig->GetXaxis()->GetNbins(); ++ib) {
          fSig->SetBinContent(ib, fSig->GetBinContent(ib)-fBkgFitFunction->Eval(fSig->GetXaxis()->GetBinCenter(ib)));
       }
-      fSoverB = (TH1D*)fSig->Clone(Form("fSoverB_%.6f", gRandom->Rndm()));
+      fSoverB = (TH1D*)fSig->Clone(UniqueName("fSoverB"));
       for(Int_t ib=1; ib<=fSoverB->GetXaxis()->GetNbins(); ++ib) {
          if(TMath::Abs(fBkg->GetBinContent(ib) + fBkgFitFunction->Eval(fSoverB->GetXaxis()->GetBinCenter(ib)))>1.0e-8) {
             fSoverB->SetBinContent(ib, fSoverB->GetBinContent(ib) / (fBkg->GetBinContent(ib) + fBkgFitFunction->Eval(fSoverB->GetXaxis()->GetBinCenter(ib))));
@@ -1196,7 +1242,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
    
    Int_t minMassBin = fSig->GetXaxis()->FindBin(minMass+1.0e-6);
    Int_t maxMassBin = fSig->GetXaxis()->FindBin(maxMass-1.0e-6);
-   if(fgOptionUse2DMatching) {
+   if(fOptionUse2DMatching) {
       // if min and max pt are not specified, then integrate over the full available pt range
       Int_t minPtBin = (minPt<0. ? 1 : fSig->GetYaxis()->FindBin(minPt+1.0e-6));
       Int_t maxPtBin = (maxPt<0. ? fSig->GetYaxis()->GetNbins() : fSig->GetYaxis()->FindBin(maxPt-1.0e-6));
@@ -1208,7 +1254,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
       // make the projection of the signal MC
       if(!fSignalMCshape && fSEOS_MCtruth) {
          fSignalMCshape = (TH2D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-2], fVarIndices[fNVariables-1]);
-         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+         fSignalMCshape->SetName(UniqueName("fSignalMCshape"));
       }
    }
    else {
@@ -1283,7 +1329,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
       // make the projection of the signal MC
       if(!fSignalMCshape && fSEOS_MCtruth) {
          fSignalMCshape = (TH1D*)fSEOS_MCtruth->Projection(fVarIndices[fNVariables-1]);
-         fSignalMCshape->SetName(Form("fSignalMCshape_%.6f", gRandom->Rndm()));
+         fSignalMCshape->SetName(UniqueName("fSignalMCshape"));
       }
    }
 
@@ -1313,7 +1359,7 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
       Double_t sigMCtotal = 0.0;
       Int_t minMassBinMC = fSignalMCshape->GetXaxis()->FindBin(minMass+1.0e-6);
       Int_t maxMassBinMC = fSignalMCshape->GetXaxis()->FindBin(maxMass-1.0e-6);
-      if(fgOptionUse2DMatching) {
+      if(fOptionUse2DMatching) {
          Int_t minPtBinMC = fSignalMCshape->GetYaxis()->FindBin(minPt+1.0e-6);
          Int_t maxPtBinMC = fSignalMCshape->GetYaxis()->FindBin(maxPt-1.0e-6);
          sigMCtotal = ((TH2*)fSignalMCshape)->IntegralAndError(1, fSignalMCshape->GetXaxis()->GetNbins(), minPtBinMC, maxPtBinMC, errSigMC);
@@ -1329,12 +1375,12 @@ Double_t* AliResonanceFits::ComputeOutputValues(Double_t minMass, Double_t maxMa
          fOptionBkgMethod==kBkgLikeSign)
          fSignalMCshape->Scale(scaleMC);
       // compute the chi2 between the MC signal shape and the signal
-      Double_t oldExclRange[2] = {fgMassExclusionRanges[0][0], fgMassExclusionRanges[0][1]};
-      fgMassExclusionRanges[0][0] = -1.; fgMassExclusionRanges[0][1] = -1;  // to allow computing the Chi2 over the full mass range
+      Double_t oldExclRange[2] = {fMassExclusionRanges[0][0], fMassExclusionRanges[0][1]};
+      fMassExclusionRanges[0][0] = -1.; fMassExclusionRanges[0][1] = -1;  // to allow computing the Chi2 over the full mass range
       if(fOptionBkgMethod==kBkgMixedEvent ||
          fOptionBkgMethod==kBkgLikeSign)
          fFitValues[kChisqMCTotal] = Chi2(fSig, fSignalMCshape, 1.0, 0.0);
-      fgMassExclusionRanges[0][0] = oldExclRange[0]; fgMassExclusionRanges[0][1] = oldExclRange[1];
+      fMassExclusionRanges[0][0] = oldExclRange[0]; fMassExclusionRanges[0][1] = oldExclRange[1];
       fFitValues[kMCYieldFraction] = (sigMCtotal>0. ? sigMC / sigMCtotal : 0.);
    }
    
@@ -1372,7 +1418,9 @@ void AliResonanceFits::PrintFitValues() {
 void AliResonanceFits::Print() {
    //
    // Print all user options
+   // NOTE: sets the static variable names, not to be called while an AliResonanceFitsScan is running
    //
+   AliReducedVarManager::SetDefaultVarNames();
    cout << endl;
    cout << "AliResonanceFits summary of all user options ======================================" << endl;
    cout << "fSEOS ::\t" << fSEOS << endl;
@@ -1393,11 +1441,11 @@ void AliResonanceFits::Print() {
    cout << std::left << setw(43) << "fMassVariable" << " :: " << AliReducedVarManager::fgVariableNames[fMassVariable] << endl;
    cout << std::left << setw(43) << "fPtVariable" << " :: " << AliReducedVarManager::fgVariableNames[fPtVariable] << endl;
    cout << std::left << setw(43) << "fNLoopingVariables" << " :: " << fNLoopingVariables << endl;
-   cout << std::left << setw(43) << "Use 2D matching" << " :: " << fgOptionUse2DMatching << endl;
+   cout << std::left << setw(43) << "Use 2D matching" << " :: " << fOptionUse2DMatching << endl;
    cout << std::left << setw(43) << "Bkg method" << " :: " << (fOptionBkgMethod==kBkgMixedEvent ? "Mixed event" : (fOptionBkgMethod==kBkgLikeSign ? "Like-sign" : "Fit function")) << endl;
    if(fOptionBkgMethod==kBkgMixedEvent)
-      cout << std::left << setw(43) << "Mixed event bkg matching" << " :: " << (fgOptionMEMatching==kMatchSEOS ? "Sidebands of SE-OS" : "Full range of SE-LS") << endl;
-   if(fOptionBkgMethod==kBkgLikeSign || fgOptionMEMatching==kMatchSELS)
+      cout << std::left << setw(43) << "Mixed event bkg matching" << " :: " << (fOptionMEMatching==kMatchSEOS ? "Sidebands of SE-OS" : "Full range of SE-LS") << endl;
+   if(fOptionBkgMethod==kBkgLikeSign || fOptionMEMatching==kMatchSELS)
       cout << std::left << setw(43) << "Use R-factor correction for LS bkg" << " :: " << fOptionUseRfactorCorrection << endl;
    if(fOptionBkgMethod==kBkgMixedEvent)
       cout << std::left << setw(43) << "Bkg scaling option" << " :: " << (fOptionScale==kScaleEntries ? "Counts" : (fOptionScale==kScaleWeightedAverage ? "Weighted average" : "Fit")) << endl;
@@ -1406,16 +1454,16 @@ void AliResonanceFits::Print() {
    if(fOptionBkgMethod==kBkgMixedEvent && fOptionScale==kScaleFit)
       cout << std::left << setw(43) << "Minuit fit method" << " :: " << (fOptionMinuit==kMinuitMethodChi2 ? "Chi2 minimization" : "Likelihood maximization") << endl;
    if(fOptionBkgMethod==kBkgMixedEvent && fOptionScale==kScaleFit)
-      cout << std::left << setw(43) << "Set zero entry bins as significant in Minuit fit" << " :: " << fgOptionUseSignificantZero << endl;
-   if(fOptionBkgMethod==kBkgLikeSign || fgOptionMEMatching==kMatchSELS)
+      cout << std::left << setw(43) << "Set zero entry bins as significant in Minuit fit" << " :: " << fOptionUseSignificantZero << endl;
+   if(fOptionBkgMethod==kBkgLikeSign || fOptionMEMatching==kMatchSELS)
       cout << std::left << setw(43) << "Like-sign bkg method" << " :: " << (fOptionLSmethod==kLSGeometricMean ? "Geometric mean" : "Arithmetic mean") << endl;
    if(fOptionBkgMethod==kBkgMixedEvent || fOptionBkgMethod==kBkgLikeSign)
       cout << std::left << setw(43) << "Run additional scaling after all summations" << " :: " << fOptionScaleSummedBkg << endl;
    
    cout << "Mass fit range " << (fUserEnabledMassFitRange ? "(Set via SetMassFitRange()) :: [" : " :: [") 
-   << fgMassFitRange[0] << " - " << fgMassFitRange[1] << "] GeV/c^2" << endl;
+   << fMassFitRange[0] << " - " << fMassFitRange[1] << "] GeV/c^2" << endl;
    cout << "Pt fit range " << (fUserEnabledPtFitRange ? "(Set via SetPtFitRange()) :: [" : " :: [") 
-   << fgPtFitRange[0] << " - " << fgPtFitRange[1] << "] GeV/c" << endl;
+   << fPtFitRange[0] << " - " << fPtFitRange[1] << "] GeV/c" << endl;
    /*cout << "Mass exclusion range " << (fUserEnabledMassExclusionRange ? "(Set via SetMassExclusionRange()) :: [" : " :: [") 
    << fgMassExclusionRange[0] << " - " << fgMassExclusionRange[1] << "] GeV/c^2" << endl;*/
    
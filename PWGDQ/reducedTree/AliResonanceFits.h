@@ -165,36 +165,36 @@ class AliResonanceFits : public TObject {
   
   // set various options (see also defaults)
   void SetBkgMethod(Int_t method) {fOptionBkgMethod = method; fMatchingIsDone = kFALSE;}
-  void SetMEMatchingMethod(Int_t option) {fgOptionMEMatching = option; fMatchingIsDone = kFALSE;}
+  void SetMEMatchingMethod(Int_t option) {fOptionMEMatching = option; fMatchingIsDone = kFALSE;}
   void SetUseRfactorCorrection(Bool_t use=kTRUE) {fOptionUseRfactorCorrection = use; fMatchingIsDone = kFALSE;}
-  void SetUse2DMatching(Bool_t flag=kTRUE) {fgOptionUse2DMatching = flag; fMatchingIsDone = kFALSE;}
+  void SetUse2DMatching(Bool_t flag=kTRUE) {fOptionUse2DMatching = flag; fMatchingIsDone = kFALSE;}
   void SetScalingOption(Int_t option) {fOptionScale = option; fMatchingIsDone = kFALSE;}
   void SetLSmethod(Int_t option) {fOptionLSmethod = option; fMatchingIsDone = kFALSE;}
   void SetWeightedAveragePower(Double_t power) {fWeightedAveragePower = power; fMatchingIsDone = kFALSE;}
   void SetMinuitFitOption(Float_t option) {fOptionMinuit = option; fMatchingIsDone = kFALSE;}
-  void SetUseSignificantZero(Bool_t option) {fgOptionUseSignificantZero = option; fMatchingIsDone = kFALSE;}
+  void SetUseSignificantZero(Bool_t option) {fOptionUseSignificantZero = option; fMatchingIsDone = kFALSE;}
   void SetScaleSummedBkg(Bool_t option) {fOptionScaleSummedBkg = option; fMatchingIsDone = kFALSE;}
   void SetDebugMode(Bool_t option) {fOptionDebug=option; fMatchingIsDone = kFALSE;}
   
   // set various ranges
-  void SetMassFitRange(Double_t min, Double_t max) {fgMassFitRange[0] = min+1.0e-6; fgMassFitRange[1] = max-1.0e-6; fUserEnabledMassFitRange = kTRUE; fMatchingIsDone = kFALSE;}
-  void SetPtFitRange(Double_t min, Double_t max) {fgPtFitRange[0] = min+1.0e-6; fgPtFitRange[1] = max-1.0e-6; fUserEnabledPtFitRange = kTRUE; fMatchingIsDone = kFALSE;}
+  void SetMassFitRange(Double_t min, Double_t max) {fMassFitRange[0] = min+1.0e-6; fMassFitRange[1] = max-1.0e-6; fUserEnabledMassFitRange = kTRUE; fMatchingIsDone = kFALSE;}
+  void SetPtFitRange(Double_t min, Double_t max) {fPtFitRange[0] = min+1.0e-6; fPtFitRange[1] = max-1.0e-6; fUserEnabledPtFitRange = kTRUE; fMatchingIsDone = kFALSE;}
   void AddMassExclusionRange(Double_t min, Double_t max) {
-     if(fgNMassExclusionRanges==10) return;        // maximum 10 mass exclusion ranges
-     fgMassExclusionRanges[fgNMassExclusionRanges][0] = min + 1.0e-6; fgMassExclusionRanges[fgNMassExclusionRanges][1] = max -1.0e-6;
-     fgNMassExclusionRanges++;
+     if(fNMassExclusionRanges==10) return;        // maximum 10 mass exclusion ranges
+     fMassExclusionRanges[fNMassExclusionRanges][0] = min + 1.0e-6; fMassExclusionRanges[fNMassExclusionRanges][1] = max -1.0e-6;
+     fNMassExclusionRanges++;
      fMatchingIsDone = kFALSE;
   }
   void SetMassExclusionRange(Double_t min, Double_t max) {
-     fgMassExclusionRanges[0][0] = min + 1.0e-6; fgMassExclusionRanges[0][1] = max -1.0e-6;
-     fgNMassExclusionRanges = 1;
+     fMassExclusionRanges[0][0] = min + 1.0e-6; fMassExclusionRanges[0][1] = max -1.0e-6;
+     fNMassExclusionRanges = 1;
      fMatchingIsDone = kFALSE;
   }
-  void SetResidualFitFunction(TF1* fitFunc) {fResidualFitFunc = (TF1*)fitFunc->Clone("ResidualFitFunction");}
+  void SetResidualFitFunction(TF1* fitFunc) {fResidualFitFunc = (TF1*)fitFunc->Clone(UniqueName("ResidualFitFunction"));}
   void SetBkgFitFunction(TF1* fitFunc, Bool_t forceNew=kFALSE) {
      if(!forceNew && fBkgFitFunction) return;
      if(fBkgFitFunction) delete fBkgFitFunction;
-     fBkgFitFunction = (TF1*)fitFunc->Clone("BkgFitFunction");
+     fBkgFitFunction = (TF1*)fitFunc->Clone(UniqueName("BkgFitFunction"));
   }
   
   Bool_t Process();
@@ -219,11 +219,11 @@ class AliResonanceFits : public TObject {
   
   Int_t GetBkgMethod() const {return fOptionBkgMethod;}
   Int_t GetScalingOption() const {return fOptionScale;}
-  Int_t GetMEMatchingMethod() const {return fgOptionMEMatching;}
+  Int_t GetMEMatchingMethod() const {return fOptionMEMatching;}
   Int_t GetMinuitFitOption() const {return fOptionMinuit;}
-  Double_t* GetMassFitRange() const {return fgMassFitRange;}
-  Int_t     GetNMassExclusionRanges() const {return fgNMassExclusionRanges;}
-  Double_t* GetMassExclusionRange(Int_t i=0) const {return (i<fgNMassExclusionRanges ? fgMassExclusionRanges[i] : 0x0);}
+  const Double_t* GetMassFitRange() const {return fMassFitRange;}
+  Int_t     GetNMassExclusionRanges() const {return fNMassExclusionRanges;}
+  const Double_t* GetMassExclusionRange(Int_t i=0) const {return (i<fNMassExclusionRanges ? fMassExclusionRanges[i] : 0x0);}
   const Double_t* GetFitValues() const {return fFitValues;}
   TF1* GetResidualFitFunction() const {return fResidualFitFunc;}
   TF1* GetBkgFitFunction() const {return fBkgFitFunction;}
@@ -255,32 +255,33 @@ class AliResonanceFits : public TObject {
    Int_t fNLoopingVariables;     
    Int_t fCurrentVariable;
    Int_t fIter[kNMaxVariables];
-   static TH1*  fgTempSignal;             // pointer to temporary signal histogram used during fitting
-   static TH1*  fgTempBkg;             // pointer to temporary bkg histogram used during fitting
+   TH1*  fTempSignal;             //! pointer to temporary signal histogram used during fitting
+   TH1*  fTempBkg;             //! pointer to temporary bkg histogram used during fitting
+   Int_t fNUniqueNames;       //! counter used to build unique names of the temporary objects
   
    // User options --------------------------------------------------------------------------------------------------
-   static Bool_t     fgOptionUse2DMatching;        // FALSE (default): match inv.mass projections;  TRUE: match (m,pt) projections
+             Bool_t     fOptionUse2DMatching;        // FALSE (default): match inv.mass projections;  TRUE: match (m,pt) projections
              Int_t        fOptionBkgMethod;               // either one of these: kBkgMixedEvent (default), kBkgLikeSign, kBkgFunction
-   static Int_t        fgOptionMEMatching;               // either one of these: kMatchSEOS (default), kMatchSELS
+             Int_t        fOptionMEMatching;               // either one of these: kMatchSEOS (default), kMatchSELS
              Bool_t     fOptionUseRfactorCorrection;     // if true apply R-factor correction; default is FALSE
              Int_t        fOptionScale;                         // either one of these: kScaleEntries (default), kScaleWeightedAverage, kScaleFit
              Int_t        fOptionLSmethod;                 // either one of : kLSGeometricMean (default), kLSArithmeticMean (used for low stat situations)
              Double_t fWeightedAveragePower;    // (default is 2.0) power of the inverse statistical error used as weights for the weighted average
              Int_t        fOptionMinuit;                // either kMinuitMethodChi2 (default) or kMinuitMethodLikelihood
-   static Bool_t      fgOptionUseSignificantZero;    // if true, assume zero entries as significant and error of 1 during the chi2 calculation
+             Bool_t      fOptionUseSignificantZero;    // if true, assume zero entries as significant and error of 1 during the chi2 calculation
              Bool_t      fOptionScaleSummedBkg;       // if true, run the matching procedure on the summed S+B and bkg (default is false)
              Bool_t      fOptionDebug;                       // if true, construct all possible distributions
              
    // Matching / fit ranges
    // NOTE: Mass and pt ranges used for matching / fitting can in principle be different (a sub-interval only) wrt ranges in fVarLimits
    //            If the dedicated setter function are not called by user, these ranges will be made same as in fVarLimits at Initialize() time
-   static Double_t fgMassFitRange[2];             // mass range used in the bkg to signal matching or in the fit procedure
+   Double_t fMassFitRange[2];             // mass range used in the bkg to signal matching or in the fit procedure
    Bool_t     fUserEnabledMassFitRange;   // default false, enabled when SetMassFitRange() is called
-   static Double_t fgPtFitRange[2];                  // pt range used in the bkg to signal matching or in the fit procedure
+   Double_t fPtFitRange[2];                  // pt range used in the bkg to signal matching or in the fit procedure
    Bool_t     fUserEnabledPtFitRange;        // default false, enabled when SetPtFitRange() is called
    //static Double_t fgMassExclusionRange[2];         // mass exclusion range, used in matching / fitting
-   static Double_t fgMassExclusionRanges[10][2];     // mass exclusion range, used in matching / fitting
-   static Int_t fgNMassExclusionRanges;                // number of mass exclusion ranges
+   Double_t fMassExclusionRanges[10][2];     // mass exclusion range, used in matching / fitting
+   Int_t fNMassExclusionRanges;                // number of mass exclusion ranges
   
    // Utility data members
    TH1* fSplusB;               //  total signal + bkg projection
@@ -292,8 +293,8 @@ class AliResonanceFits : public TObject {
    TH1* fBkgLikeSignLeg2;
    TH1* fBkgMixedEvent;
    
-   static TF1* fBkgFitFunction;
-   static TF1* fGlobalFitFunction;
+   TF1* fBkgFitFunction;                    // bkg fit function
+   TF1* fGlobalFitFunction;                 //! signal + bkg fit function
    TFitResultPtr fFitResult;                // fit result of the residual fit
    
    /////////////////////////////////
@@ -304,7 +305,7 @@ class AliResonanceFits : public TObject {
    ////////////////////////////////
    
    TH1* fSoverB;              // S/B projection
-   static TH1* fSignalMCshape;    // MC truth signal shape
+   TH1* fSignalMCshape;    //! MC truth signal shape
    Double_t fFitValues[kNFitValues];       // array used to store information on the signal fit
    Bool_t fMatchingIsDone;                  // set to true if the matching procedure was succesfully run; false if the object is in any other state
    
@@ -314,6 +315,9 @@ class AliResonanceFits : public TObject {
    
    ////////////////////////////////////////////////////
    
+   friend class AliResonanceFitsMinuit;
+   friend class AliResonanceFitsScan;     // swaps in per-thread copies of shared input histograms
+   
    // Private utility functions
    Bool_t Initialize();            // returns true if all prerequisites for signal extraction are met
    void Slice();
@@ -325,13 +329,14 @@ class AliResonanceFits : public TObject {
    void  ComputeWeightedScale(TH1* sig, TH1* bkg);
    void  FitScale(TH1* sig, TH1* bkg, Bool_t fixScale=kFALSE);
    void  ComputeScale(TH1* scaleHist, TH1* bkgHist);
-   static void Fcn(Int_t&, Double_t*, Double_t &f, Double_t *par, Int_t);
-   static Double_t Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t scaleError=0.0);
+   Double_t ScaleChi2(Double_t scale) const;
+   Double_t Chi2(TH1* sig, TH1* bkg, Double_t scale, Double_t scaleError=0.0) const;
    void FitInvMass();
    void FitResidualBkg();
-   static Double_t GlobalFitFunction(Double_t *x, Double_t* par);
+   Double_t GlobalFitFunction(Double_t *x, Double_t* par);
+   const Char_t* UniqueName(const Char_t* prefix);
 
-   ClassDef(AliResonanceFits, 5);
+   ClassDef(AliResonanceFits, 6);
 };
 
 #endif
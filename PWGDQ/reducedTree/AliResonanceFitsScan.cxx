@@ -0,0 +1,269 @@
+/*
+***********************************************************
+  Implementation of the AliResonanceFitsScan
+  Runs many AliResonanceFits signal extractions, optionally on several threads
+  *********************************************************
+*/
+
+#ifndef ALIRESONANCEFITSSCAN_H
+#include "AliResonanceFitsScan.h"
+#endif
+
+#include <iostream>
+#include <map>
+using std::cout;
+using std::endl;
+
+#include <RVersion.h>
+#include <TF1.h>
+#include <TH1.h>
+#include <TMath.h>
+#include <TMinuit.h>
+#include <THn.h>
+#include <TNtupleD.h>
+#include <TVirtualMutex.h>
+
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIRESONANCEFITSSCAN_THREAD
+#include <atomic>
+#include <thread>
+#endif
+
+ClassImp(AliResonanceFitsScan)
+
+//_______________________________________________________________________________
+AliResonanceFitsScan::AliResonanceFitsScan() :
+  TObject(),
+  fJobs(),
+  fRanges(),
+  fValues(),
+  fDone(),
+  fNThreads(1),
+  fCheckSerial(kFALSE),
+  fNMismatches(0)
+{
+  //
+  // Default constructor
+  //
+}
+
+//_______________________________________________________________________________
+AliResonanceFitsScan::~AliResonanceFitsScan()
+{
+  //
+  // De-constructor
+  // NOTE: the AliResonanceFits objects of the jobs are not owned
+  //
+}
+
+//_______________________________________________________________________________
+Int_t AliResonanceFitsScan::AddJob(AliResonanceFits* fits, Double_t minMass, Double_t maxMass, Double_t minPt /*=-1.*/, Double_t maxPt /*=-1.*/)
+{
+  //
+  // Add a job: process fits and count the signal in the given mass (and pt) range
+  // Returns the index of the job, -1 if fits is not given
+  //
+  if(!fits) {
+    cout << "AliResonanceFitsScan::AddJob() Error: No AliResonanceFits provided!" << endl;
+    return -1;
+  }
+  fJobs.push_back(fits);
+  fRanges.push_back(minMass); fRanges.push_back(maxMass);
+  fRanges.push_back(minPt); fRanges.push_back(maxPt);
+  fValues.resize(fJobs.size()*AliResonanceFits::kNFitValues, 0.);
+  fDone.push_back(0);
+  return fJobs.size()-1;
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsScan::Clear(Option_t*)
+{
+  //
+  // Remove all the jobs
+  //
+  fJobs.clear();
+  fRanges.clear();
+  fValues.clear();
+  fDone.clear();
+  fNMismatches = 0;
+}
+
+//_______________________________________________________________________________
+Bool_t AliResonanceFitsScan::Run()
+{
+  //
+  // Run all the jobs. Returns true if all of them were successful
+  // (and, with SetCheckSerial(), gave the same results as the serial run)
+  //
+  for(UInt_t i=0; i<fDone.size(); ++i) fDone[i] = 0;
+  fNMismatches = 0;
+
+  // distinct fitters, in the order of their first job, and the inputs used by more than one of them
+  std::vector<AliResonanceFits*> fitters;
+  std::map<const TObject*, Int_t> nUses;
+  for(UInt_t i=0; i<fJobs.size(); ++i) {
+    AliResonanceFits* fits = fJobs[i];
+    Bool_t isNew = kTRUE;
+    for(UInt_t j=0; j<fitters.size(); ++j)
+      if(fitters[j]==fits) {isNew = kFALSE; break;}
+    if(!isNew) continue;
+    fitters.push_back(fits);
+    std::set<const TObject*> inputs;
+    inputs.insert(fits->fSEOS); inputs.insert(fits->fMEOS);
+    inputs.insert(fits->fSELSleg1); inputs.insert(fits->fSELSleg2);
+    inputs.insert(fits->fMELSleg1); inputs.insert(fits->fMELSleg2);
+    inputs.insert(fits->fSEOS_MCtruth); inputs.insert(fits->fSignalMCshape);
+    inputs.erase((const TObject*)0x0);
+    for(std::set<const TObject*>::const_iterator it=inputs.begin(); it!=inputs.end(); ++it) nUses[*it]++;
+  }
+
+  Int_t nThreads = TMath::Min(fNThreads, (Int_t)fitters.size());
+#ifndef ALIRESONANCEFITSSCAN_THREAD
+  nThreads = 1;
+#endif
+  if(nThreads>1 && !gGlobalMutex) {
+    cout << "AliResonanceFitsScan::Run() Warning: ROOT thread safety not enabled in the steering macro, running serially" << endl;
+    nThreads = 1;
+  }
+
+  std::set<const TObject*> sharedInputs;
+  if(nThreads<=1) {
+    // serial: same as processing the fitters one after the other
+    for(UInt_t i=0; i<fitters.size(); ++i) RunFits(fitters[i], sharedInputs, kFALSE, fValues, fDone);
+  }
+  else {
+#ifdef ALIRESONANCEFITSSCAN_THREAD
+    // reference: serial run leaving the inputs and the state of the fitters as they are
+    std::vector<Double_t> refValues(fValues.size(), 0.);
+    std::vector<Int_t> refDone(fDone.size(), 0);
+    if(fCheckSerial)
+      for(UInt_t i=0; i<fitters.size(); ++i) RunReference(fitters[i], refValues, refDone);
+
+    for(std::map<const TObject*, Int_t>::const_iterator it=nUses.begin(); it!=nUses.end(); ++it)
+      if(it->second>1) sharedInputs.insert(it->first);
+
+    std::atomic<Int_t> next(0);
+    std::vector<std::thread> threads;
+    for(Int_t t=0; t<nThreads; ++t) {
+      threads.push_back(std::thread([&]() {
+        for(Int_t i=next++; i<(Int_t)fitters.size(); i=next++) RunFits(fitters[i], sharedInputs, kFALSE, fValues, fDone);
+      }));
+    }
+    for(UInt_t t=0; t<threads.size(); ++t) threads[t].join();
+
+    if(fCheckSerial) {
+      for(UInt_t job=0; job<fJobs.size(); ++job) {
+        Bool_t same = (fDone[job]==refDone[job]);
+        for(Int_t i=0; same && i<AliResonanceFits::kNFitValues; ++i)
+          same = (fValues[job*AliResonanceFits::kNFitValues+i]==refValues[job*AliResonanceFits::kNFitValues+i]);
+        if(same) continue;
+        cout << "AliResonanceFitsScan::Run() Error: job " << job << " differs between the threaded and the serial run" << endl;
+        fNMismatches++;
+      }
+    }
+#endif
+  }
+
+  Bool_t allDone = (fNMismatches==0);
+  for(UInt_t i=0; i<fDone.size(); ++i) allDone = allDone && fDone[i];
+  return allDone;
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsScan::RunReference(AliResonanceFits* fits, std::vector<Double_t>& values, std::vector<Int_t>& done)
+{
+  //
+  // Run the jobs of fits on copies of all its inputs and restore the state of fits afterwards,
+  // such that the following run starts from the same conditions (bkg fit function parameters,
+  // Minuit fitter, MC signal shape, fit values)
+  //
+  TF1* bkgFunction = fits->fBkgFitFunction;
+  std::vector<Double_t> bkgPars;
+  if(bkgFunction) bkgPars.assign(bkgFunction->GetParameters(), bkgFunction->GetParameters()+bkgFunction->GetNpar());
+  TMinuit* minuit = fits->fMinuitFitter;
+  fits->fMinuitFitter = 0x0;
+  TH1* shape = fits->fSignalMCshape;
+  std::vector<Double_t> fitValues(fits->fFitValues, fits->fFitValues+AliResonanceFits::kNFitValues);
+
+  std::set<const TObject*> noSharedInputs;
+  RunFits(fits, noSharedInputs, kTRUE, values, done);
+
+  if(bkgFunction) bkgFunction->SetParameters(&bkgPars[0]);
+  if(fits->fMinuitFitter) delete fits->fMinuitFitter;
+  fits->fMinuitFitter = minuit;
+  // the signal shape projected from the MC truth during the reference run
+  if(!shape && fits->fSignalMCshape) delete fits->fSignalMCshape;
+  fits->fSignalMCshape = shape;
+  for(Int_t i=0; i<AliResonanceFits::kNFitValues; ++i) fits->fFitValues[i] = fitValues[i];
+}
+
+//_______________________________________________________________________________
+void AliResonanceFitsScan::RunFits(AliResonanceFits* fits, const std::set<const TObject*>& sharedInputs, Bool_t copyAll,
+                                   std::vector<Double_t>& values, std::vector<Int_t>& done)
+{
+  //
+  // Process fits and compute the output values of all its jobs.
+  // The shared inputs (all the inputs if copyAll) are replaced by copies while fits is processed.
+  //
+  THnF** inputs[7] = {&fits->fSEOS, &fits->fMEOS, &fits->fSELSleg1, &fits->fSELSleg2,
+                      &fits->fMELSleg1, &fits->fMELSleg2, &fits->fSEOS_MCtruth};
+  THnF* originals[7];
+  std::map<const TObject*, TObject*> copies;
+  for(Int_t i=0; i<7; ++i) {
+    originals[i] = *inputs[i];
+    if(!originals[i] || !(copyAll || sharedInputs.count(originals[i]))) continue;
+    if(!copies.count(originals[i])) copies[originals[i]] = originals[i]->Clone(fits->UniqueName(originals[i]->GetName()));
+    *inputs[i] = (THnF*)copies[originals[i]];
+  }
+  TH1* originalShape = fits->fSignalMCshape;
+  if(originalShape && (copyAll || sharedInputs.count(originalShape)))
+    fits->fSignalMCshape = (TH1*)originalShape->Clone(fits->UniqueName(originalShape->GetName()));
+  TH1* shapeCopy = (fits->fSignalMCshape!=originalShape ? fits->fSignalMCshape : 0x0);
+
+  if(fits->Process()) {
+    for(UInt_t job=0; job<fJobs.size(); ++job) {
+      if(fJobs[job]!=fits) continue;
+      const Double_t* range = &fRanges[4*job];
+      const Double_t* jobValues = fits->ComputeOutputValues(range[0], range[1], range[2], range[3]);
+      if(!jobValues) continue;
+      for(Int_t i=0; i<AliResonanceFits::kNFitValues; ++i) values[job*AliResonanceFits::kNFitValues+i] = jobValues[i];
+      done[job] = 1;
+    }
+  }
+  else
+    cout << "AliResonanceFitsScan::RunFits() Error: AliResonanceFits::Process() failed" << endl;
+
+  // restore the user inputs
+  for(Int_t i=0; i<7; ++i) *inputs[i] = originals[i];
+  for(std::map<const TObject*, TObject*>::iterator it=copies.begin(); it!=copies.end(); ++it) delete it->second;
+  if(shapeCopy) {
+    if(fits->fSignalMCshape==shapeCopy) fits->fSignalMCshape = originalShape;
+    delete shapeCopy;
+  }
+}
+
+//_______________________________________________________________________________
+TNtupleD* AliResonanceFitsScan::BuildTable(const Char_t* name /*="fitValues"*/) const
+{
+  //
+  // Table with one entry per job: job index, signal counting ranges, status and the AliResonanceFits::FitValues
+  //
+  const Char_t* valueNames[AliResonanceFits::kNFitValues] = {
+    "sig", "sigErr", "bkg", "bkgErr", "bkgResidual", "bkgResidualErr", "splusb", "splusbErr",
+    "soverb", "soverbErr", "signif", "signifErr", "chisqSideBands", "chisqMCPeak", "chisqMCTotal",
+    "fitProbability", "mcYieldFraction", "bkgScale", "bkgScaleErr"
+  };
+  TString varlist = "job:minMass:maxMass:minPt:maxPt:done";
+  for(Int_t i=0; i<AliResonanceFits::kNFitValues; ++i) varlist += Form(":%s", valueNames[i]);
+
+  TNtupleD* table = new TNtupleD(name, "AliResonanceFits output values", varlist.Data());
+  std::vector<Double_t> row(6+AliResonanceFits::kNFitValues);
+  for(UInt_t job=0; job<fJobs.size(); ++job) {
+    row[0] = job;
+    for(Int_t i=0; i<4; ++i) row[1+i] = fRanges[4*job+i];
+    row[5] = fDone[job];
+    for(Int_t i=0; i<AliResonanceFits::kNFitValues; ++i) row[6+i] = fValues[job*AliResonanceFits::kNFitValues+i];
+    table->Fill(&row[0]);
+  }
+  return table;
+}
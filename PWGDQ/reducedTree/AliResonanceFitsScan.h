@@ -0,0 +1,81 @@
+// Class used for running many AliResonanceFits signal extractions (slices, systematic variations) at once
+//
+/*
+   Brief usage guide
+
+   1) Jobs
+       Each job is a fully configured AliResonanceFits (histograms, variables, ranges, options) plus the
+       mass and (optionally) pt range used to count the signal, as given to AliResonanceFits::ComputeOutputValues().
+       Jobs are added via AddJob() and the AliResonanceFits objects are not owned by the scan.
+       The same AliResonanceFits object can be added more than once (e.g. for several signal counting windows);
+       its jobs are then run one after the other, in the order they were added.
+   2) Running
+       Run() processes all the jobs, spreading the AliResonanceFits objects over SetNThreads() threads
+       (default 1, i.e. serial). Each AliResonanceFits is processed once and then the signal is counted for each of its jobs.
+       When running on several threads, the input histograms (THnF and the MC signal shape) shared by several
+       AliResonanceFits objects are copied for each of them, since the fitter changes the axis ranges of its inputs
+       and scales the MC shape; inputs used by a single AliResonanceFits are used directly.
+       Without C++11 or with ROOT 5, or if the ROOT thread safety was not enabled (ROOT::EnableThreadSafety()
+       in the steering macro), the jobs are run serially.
+       The minimizations (TMinuit, TH1::Fit) use the global gMinuit and are done one thread at a time.
+       With SetCheckSerial(), a threaded Run() first runs all the jobs serially on copies of the inputs
+       and then checks that the threaded results are identical; the mismatching jobs are counted in GetNMismatches().
+   3) Output
+       The AliResonanceFits::FitValues of each job are available via GetFitValues() and can be collected
+       in a single table (TNtupleD, one entry per job) via BuildTable().
+ */
+
+#ifndef ALIRESONANCEFITSSCAN_H
+#define ALIRESONANCEFITSSCAN_H
+
+#include <set>
+#include <vector>
+
+#include <TObject.h>
+
+#include "AliResonanceFits.h"
+
+class TNtupleD;
+
+//_____________________________________________________________________
+class AliResonanceFitsScan : public TObject {
+
+ public:
+  AliResonanceFitsScan();
+  virtual ~AliResonanceFitsScan();
+
+  Int_t AddJob(AliResonanceFits* fits, Double_t minMass, Double_t maxMass, Double_t minPt=-1., Double_t maxPt=-1.);
+  void SetNThreads(Int_t n) {fNThreads = (n>0 ? n : 1);}
+  void SetCheckSerial(Bool_t check=kTRUE) {fCheckSerial = check;}
+  void Clear(Option_t* option="");
+
+  Bool_t Run();
+
+  Int_t GetNJobs() const {return fJobs.size();}
+  Int_t GetNThreads() const {return fNThreads;}
+  Int_t GetNMismatches() const {return fNMismatches;}
+  AliResonanceFits* GetJob(Int_t job) const {return fJobs[job];}
+  Bool_t IsJobDone(Int_t job) const {return fDone[job];}
+  const Double_t* GetFitValues(Int_t job) const {return (fDone[job] ? &fValues[job*AliResonanceFits::kNFitValues] : 0x0);}
+  TNtupleD* BuildTable(const Char_t* name="fitValues") const;
+
+ private:
+  std::vector<AliResonanceFits*> fJobs;      //! fitter of each job (not owned)
+  std::vector<Double_t>          fRanges;    // signal counting ranges (min mass, max mass, min pt, max pt) of each job
+  std::vector<Double_t>          fValues;    // AliResonanceFits::FitValues of each job
+  std::vector<Int_t>             fDone;      // 1 if the job was run successfully
+  Int_t                          fNThreads;  // number of threads used in Run()
+  Bool_t                         fCheckSerial; // compare the threaded results with a serial run
+  Int_t                          fNMismatches; // jobs with different results in the threaded and serial runs
+
+  void RunFits(AliResonanceFits* fits, const std::set<const TObject*>& sharedInputs, Bool_t copyAll,
+               std::vector<Double_t>& values, std::vector<Int_t>& done);
+  void RunReference(AliResonanceFits* fits, std::vector<Double_t>& values, std::vector<Int_t>& done);
+
+  AliResonanceFitsScan(const AliResonanceFitsScan& c);
+  AliResonanceFitsScan& operator= (const AliResonanceFitsScan& c);
+
+  ClassDef(AliResonanceFitsScan, 2);
+};
+
+#endif
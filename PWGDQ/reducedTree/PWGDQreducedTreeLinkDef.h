@@ -34,6 +34,7 @@
 #pragma link C++ class AliReducedVarCut+;
 #pragma link C++ class AliReducedVarManager+;
 #pragma link C++ class AliResonanceFits+;
+#pragma link C++ class AliResonanceFitsScan+;
 #pragma link C++ class AliSignalMC+;
 
 #endif
@@ -65,6 +65,616 @@
 
 ClassImp(AliAnalysisTaskPi0Flow);
 
+namespace {
+  // Handles of the histograms filled in the event loop (see AliCaloHistogramTable)
+  enum EHistogram_t {
+    kHCenPHOSCells,
+    kHCenTrack,
+    kHCellEnergy,
+    kHCellEnergyM1,
+    kHCellNXZM1,
+    kHCellEXZM1,
+    kHCellEnergyM2,
+    kHCellNXZM2,
+    kHCellEXZM2,
+    kHCellEnergyM3,
+    kHCellNXZM3,
+    kHCellEXZM3,
+    kHCellEnergyM4,
+    kHCellNXZM4,
+    kHCellEXZM4,
+    kHCellMultEvent,
+    kHCellMultEventM1,
+    kHCellMultEventM2,
+    kHCellMultEventM3,
+    kHCellMultEventM4,
+    kHCluEvsClu,
+    kHCluLowM,
+    kHCluHighM,
+    kHCluDispM,
+    kHCluVetoM,
+    kHCenPHOS,
+    kHPhotWideTOF_cen,
+    kHPhotPhiV0AWideTOF_cen,
+    kHPhotPhiV0CWideTOF_cen,
+    kHPhotPhiTPCWideTOF_cen,
+    kHPhotPhiV0AAll_cen,
+    kHPhotPhiV0CAll_cen,
+    kHPhotPhiTPCAll_cen,
+    kHPhotPhiV0AAllcore_cen,
+    kHPhotPhiV0CAllcore_cen,
+    kHPhotPhiTPCAllcore_cen,
+    kHPhotAll_cen,
+    kHPhotAllcore_cen,
+    kHPhotAllwou_cen,
+    kHPhotPhiV0AAllwou_cen,
+    kHPhotPhiV0CAllwou_cen,
+    kHPhotPhiTPCAllwou_cen,
+    kHPhotPhiV0ACPV_cen,
+    kHPhotPhiV0CCPV_cen,
+    kHPhotPhiTPCCPV_cen,
+    kHPhotPhiV0ACPVcore_cen,
+    kHPhotPhiV0CCPVcore_cen,
+    kHPhotPhiTPCCPVcore_cen,
+    kHPhotCPV_cen,
+    kHPhotCPVcore_cen,
+    kHPhotPhiV0ACPV2_cen,
+    kHPhotPhiV0CCPV2_cen,
+    kHPhotPhiTPCCPV2_cen,
+    kHPhotPhiV0ACPV2core_cen,
+    kHPhotPhiV0CCPV2core_cen,
+    kHPhotPhiTPCCPV2core_cen,
+    kHPhotCPV2_cen,
+    kHPhotCPV2core_cen,
+    kHPhotPhiV0ADisp_cen,
+    kHPhotPhiV0CDisp_cen,
+    kHPhotPhiTPCDisp_cen,
+    kHPhotPhiV0ADispcore_cen,
+    kHPhotPhiV0CDispcore_cen,
+    kHPhotPhiTPCDispcore_cen,
+    kHPhotPhiV0ADispwou_cen,
+    kHPhotPhiV0CDispwou_cen,
+    kHPhotPhiTPCDispwou_cen,
+    kHPhotDisp_cen,
+    kHPhotDispcore_cen,
+    kHPhotDispwou_cen,
+    kHPhotPhiV0ABoth_cen,
+    kHPhotPhiV0CBoth_cen,
+    kHPhotPhiTPCBoth_cen,
+    kHPhotPhiV0ABothcore_cen,
+    kHPhotPhiV0CBothcore_cen,
+    kHPhotPhiTPCBothcore_cen,
+    kHPhotBoth_cen,
+    kHPhotBothcore_cen,
+    kHPhotPhiV0ADisp2_cen,
+    kHPhotPhiV0CDisp2_cen,
+    kHPhotPhiTPCDisp2_cen,
+    kHPhotPhiV0ADisp2core_cen,
+    kHPhotPhiV0CDisp2core_cen,
+    kHPhotPhiTPCDisp2core_cen,
+    kHPhotDisp2_cen,
+    kHPhotDisp2core_cen,
+    kHPhotPhiV0ABoth2_cen,
+    kHPhotPhiV0CBoth2_cen,
+    kHPhotPhiTPCBoth2_cen,
+    kHPhotPhiV0ABoth2core_cen,
+    kHPhotPhiV0CBoth2core_cen,
+    kHPhotPhiTPCBoth2core_cen,
+    kHPhotBoth2_cen,
+    kHPhotBoth2core_cen,
+    kHPHOSphi,
+    kHPi0WideTOF_cen,
+    kHSingleWideTOF_cen,
+    kHMassPtTPCWideTOF_cen,
+    kHMassPtV0AAll_cen,
+    kHMassPtV0CAll_cen,
+    kHMassPtTPCAll_cen,
+    kHMassPtV0AAllcore_cen,
+    kHMassPtV0CAllcore_cen,
+    kHMassPtTPCAllcore_cen,
+    kHPi0All_cen,
+    kHPi0Allcore_cen,
+    kHPi0Allwou_cen,
+    kHMassPtV0AAllwou_cen,
+    kHMassPtV0CAllwou_cen,
+    kHMassPtTPCAllwou_cen,
+    kHSingleAll_cen,
+    kHSingleAllcore_cen,
+    kHSingleAllwou_cen,
+    kHSingleCPV_cen,
+    kHSingleCPVcore_cen,
+    kHSingleCPV2_cen,
+    kHSingleCPV2core_cen,
+    kHSingleDisp_cen,
+    kHSingleDispwou_cen,
+    kHSingleDispcore_cen,
+    kHSingleDisp2_cen,
+    kHSingleDisp2core_cen,
+    kHSingleBoth_cen,
+    kHSingleBothcore_cen,
+    kHSingleBoth2_cen,
+    kHSingleBoth2core_cen,
+    kHPi0All_a07_cen,
+    kHMassPtV0ACPV_cen,
+    kHMassPtV0CCPV_cen,
+    kHMassPtTPCCPV_cen,
+    kHMassPtV0ACPVcore_cen,
+    kHMassPtV0CCPVcore_cen,
+    kHMassPtTPCCPVcore_cen,
+    kHPi0CPV_cen,
+    kHPi0CPVcore_cen,
+    kHPi0CPV_a07_cen,
+    kHMassPtV0ACPV2_cen,
+    kHMassPtV0CCPV2_cen,
+    kHMassPtTPCCPV2_cen,
+    kHMassPtV0ACPV2core_cen,
+    kHMassPtV0CCPV2core_cen,
+    kHMassPtTPCCPV2core_cen,
+    kHPi0CPV2_cen,
+    kHPi0CPV2core_cen,
+    kHPi0CPV2_a07_cen,
+    kHMassPtV0ADisp_cen,
+    kHMassPtV0CDisp_cen,
+    kHMassPtTPCDisp_cen,
+    kHMassPtV0ADispcore_cen,
+    kHMassPtV0CDispcore_cen,
+    kHMassPtTPCDispcore_cen,
+    kHPi0Disp_cen,
+    kHPi0Dispcore_cen,
+    kHPi0Dispwou_cen,
+    kHMassPtV0ADispwou_cen,
+    kHMassPtV0CDispwou_cen,
+    kHMassPtTPCDispwou_cen,
+    kHPi0Disp_a07_cen,
+    kHMassPtV0ABoth_cen,
+    kHMassPtV0CBoth_cen,
+    kHMassPtTPCBoth_cen,
+    kHMassPtV0ABothcore_cen,
+    kHMassPtV0CBothcore_cen,
+    kHMassPtTPCBothcore_cen,
+    kHPi0Both_cen,
+    kHPi0Bothcore_cen,
+    kHPi0Both_a07_cen,
+    kHPi0M11,
+    kHPi0M22,
+    kHPi0M33,
+    kHPi0M44,
+    kHPi0M12,
+    kHPi0M13,
+    kHPi0M14,
+    kHPi0M23,
+    kHPi0M24,
+    kHPi0M34,
+    kHPi0Disp2_cen,
+    kHPi0Disp2core_cen,
+    kHMassPtV0ADisp2_cen,
+    kHMassPtV0CDisp2_cen,
+    kHMassPtTPCDisp2_cen,
+    kHMassPtV0ADisp2core_cen,
+    kHMassPtV0CDisp2core_cen,
+    kHMassPtTPCDisp2core_cen,
+    kHMassPtV0ABoth2_cen,
+    kHMassPtV0CBoth2_cen,
+    kHMassPtTPCBoth2_cen,
+    kHMassPtV0ABoth2core_cen,
+    kHMassPtV0CBoth2core_cen,
+    kHMassPtTPCBoth2core_cen,
+    kHPi0Both2_cen,
+    kHPi0Both2core_cen,
+    kHMiPi0WideTOF_cen,
+    kHMiSingleWideTOF_cen,
+    kHMiMassPtTPCWideTOF_cen,
+    kHMiMassPtV0AAll_cen,
+    kHMiMassPtV0CAll_cen,
+    kHMiMassPtTPCAll_cen,
+    kHMiMassPtV0AAllcore_cen,
+    kHMiMassPtV0CAllcore_cen,
+    kHMiMassPtTPCAllcore_cen,
+    kHMiPi0All_cen,
+    kHMiPi0Allcore_cen,
+    kHMiPi0Allwou_cen,
+    kHMiMassPtV0AAllwou_cen,
+    kHMiMassPtV0CAllwou_cen,
+    kHMiMassPtTPCAllwou_cen,
+    kHMiSingleAll_cen,
+    kHMiSingleAllcore_cen,
+    kHMiSingleAllwou_cen,
+    kHMiSingleCPV_cen,
+    kHMiSingleCPVcore_cen,
+    kHMiSingleCPV2_cen,
+    kHMiSingleCPV2core_cen,
+    kHMiSingleDisp_cen,
+    kHMiSingleDispwou_cen,
+    kHMiSingleDispcore_cen,
+    kHMiSingleDisp2_cen,
+    kHMiSingleDisp2core_cen,
+    kHMiSingleBoth_cen,
+    kHMiSingleBothcore_cen,
+    kHMiSingleBoth2_cen,
+    kHMiSingleBoth2core_cen,
+    kHMiPi0All_a07_cen,
+    kHMiMassPtV0ACPV_cen,
+    kHMiMassPtV0CCPV_cen,
+    kHMiMassPtTPCCPV_cen,
+    kHMiMassPtV0ACPVcore_cen,
+    kHMiMassPtV0CCPVcore_cen,
+    kHMiMassPtTPCCPVcore_cen,
+    kHMiPi0CPV_cen,
+    kHMiPi0CPVcore_cen,
+    kHMiPi0CPV_a07_cen,
+    kHMiPi0CPV2_cen,
+    kHMiPi0CPV2core_cen,
+    kHMiMassPtV0ACPV2_cen,
+    kHMiMassPtV0CCPV2_cen,
+    kHMiMassPtTPCCPV2_cen,
+    kHMiMassPtV0ACPV2core_cen,
+    kHMiMassPtV0CCPV2core_cen,
+    kHMiMassPtTPCCPV2core_cen,
+    kHMiPi0CPV2_a07_cen,
+    kHMiMassPtV0ADisp_cen,
+    kHMiMassPtV0CDisp_cen,
+    kHMiMassPtTPCDisp_cen,
+    kHMiMassPtV0ADispcore_cen,
+    kHMiMassPtV0CDispcore_cen,
+    kHMiMassPtTPCDispcore_cen,
+    kHMiPi0Disp_cen,
+    kHMiPi0Dispcore_cen,
+    kHMiPi0Dispwou_cen,
+    kHMiMassPtV0ADispwou_cen,
+    kHMiMassPtV0CDispwou_cen,
+    kHMiMassPtTPCDispwou_cen,
+    kHMiPi0Disp_a07_cen,
+    kHMiMassPtV0ABoth_cen,
+    kHMiMassPtV0CBoth_cen,
+    kHMiMassPtTPCBoth_cen,
+    kHMiMassPtV0ABothcore_cen,
+    kHMiMassPtV0CBothcore_cen,
+    kHMiMassPtTPCBothcore_cen,
+    kHMiPi0Both_cen,
+    kHMiPi0Bothcore_cen,
+    kHMiPi0Both_a07_cen,
+    kHMiMassPtV0ADisp2_cen,
+    kHMiMassPtV0CDisp2_cen,
+    kHMiMassPtTPCDisp2_cen,
+    kHMiMassPtV0ADisp2core_cen,
+    kHMiMassPtV0CDisp2core_cen,
+    kHMiMassPtTPCDisp2core_cen,
+    kHMiPi0Disp2_cen,
+    kHMiPi0Disp2core_cen,
+    kHMiMassPtV0ABoth2_cen,
+    kHMiMassPtV0CBoth2_cen,
+    kHMiMassPtTPCBoth2_cen,
+    kHMiMassPtV0ABoth2core_cen,
+    kHMiMassPtV0CBoth2core_cen,
+    kHMiMassPtTPCBoth2core_cen,
+    kHMiPi0Both2_cen,
+    kHMiPi0Both2core_cen,
+    kHSelEvents,
+    kHTotSelEvents,
+    kHZvertex,
+    kHCentrality,
+    kHPhiRP,
+    kHPhiRPflat,
+    kHCos2AC,
+    kHPhiRPV0A,
+    kHPhiRPV0C,
+    kHPhiRPV0AC,
+    kHPhiRPV0Aflat,
+    kHCos2V0AC,
+    kHPhiRPV0ATPC,
+    kHCos2V0ATPC,
+    kHPhiRPV0Cflat,
+    kHPhiRPV0CTPC,
+    kHCos2V0CTPC,
+    kNHistograms
+  };
+
+  // Names of the histograms, %d: centrality bin or module
+  const struct {
+    Int_t        fHandle;
+    const char * fName;
+  } gkHistogramNames[] = {
+    { kHCenPHOSCells,                  "hCenPHOSCells" },
+    { kHCenTrack,                      "hCenTrack" },
+    { kHCellEnergy,                    "hCellEnergy" },
+    { kHCellEnergyM1,                  "hCellEnergyM1" },
+    { kHCellNXZM1,                     "hCellNXZM1" },
+    { kHCellEXZM1,                     "hCellEXZM1" },
+    { kHCellEnergyM2,                  "hCellEnergyM2" },
+    { kHCellNXZM2,                     "hCellNXZM2" },
+    { kHCellEXZM2,                     "hCellEXZM2" },
+    { kHCellEnergyM3,                  "hCellEnergyM3" },
+    { kHCellNXZM3,                     "hCellNXZM3" },
+    { kHCellEXZM3,                     "hCellEXZM3" },
+    { kHCellEnergyM4,                  "hCellEnergyM4" },
+    { kHCellNXZM4,                     "hCellNXZM4" },
+    { kHCellEXZM4,                     "hCellEXZM4" },
+    { kHCellMultEvent,                 "hCellMultEvent" },
+    { kHCellMultEventM1,               "hCellMultEventM1" },
+    { kHCellMultEventM2,               "hCellMultEventM2" },
+    { kHCellMultEventM3,               "hCellMultEventM3" },
+    { kHCellMultEventM4,               "hCellMultEventM4" },
+    { kHCluEvsClu,                     "hCluEvsClu" },
+    { kHCluLowM,                       "hCluLowM%d" },
+    { kHCluHighM,                      "hCluHighM%d" },
+    { kHCluDispM,                      "hCluDispM%d" },
+    { kHCluVetoM,                      "hCluVetoM%d" },
+    { kHCenPHOS,                       "hCenPHOS" },
+    { kHPhotWideTOF_cen,               "hPhotWideTOF_cen%d" },
+    { kHPhotPhiV0AWideTOF_cen,         "hPhotPhiV0AWideTOF_cen%d" },
+    { kHPhotPhiV0CWideTOF_cen,         "hPhotPhiV0CWideTOF_cen%d" },
+    { kHPhotPhiTPCWideTOF_cen,         "hPhotPhiTPCWideTOF_cen%d" },
+    { kHPhotPhiV0AAll_cen,             "hPhotPhiV0AAll_cen%d" },
+    { kHPhotPhiV0CAll_cen,             "hPhotPhiV0CAll_cen%d" },
+    { kHPhotPhiTPCAll_cen,             "hPhotPhiTPCAll_cen%d" },
+    { kHPhotPhiV0AAllcore_cen,         "hPhotPhiV0AAllcore_cen%d" },
+    { kHPhotPhiV0CAllcore_cen,         "hPhotPhiV0CAllcore_cen%d" },
+    { kHPhotPhiTPCAllcore_cen,         "hPhotPhiTPCAllcore_cen%d" },
+    { kHPhotAll_cen,                   "hPhotAll_cen%d" },
+    { kHPhotAllcore_cen,               "hPhotAllcore_cen%d" },
+    { kHPhotAllwou_cen,                "hPhotAllwou_cen%d" },
+    { kHPhotPhiV0AAllwou_cen,          "hPhotPhiV0AAllwou_cen%d" },
+    { kHPhotPhiV0CAllwou_cen,          "hPhotPhiV0CAllwou_cen%d" },
+    { kHPhotPhiTPCAllwou_cen,          "hPhotPhiTPCAllwou_cen%d" },
+    { kHPhotPhiV0ACPV_cen,             "hPhotPhiV0ACPV_cen%d" },
+    { kHPhotPhiV0CCPV_cen,             "hPhotPhiV0CCPV_cen%d" },
+    { kHPhotPhiTPCCPV_cen,             "hPhotPhiTPCCPV_cen%d" },
+    { kHPhotPhiV0ACPVcore_cen,         "hPhotPhiV0ACPVcore_cen%d" },
+    { kHPhotPhiV0CCPVcore_cen,         "hPhotPhiV0CCPVcore_cen%d" },
+    { kHPhotPhiTPCCPVcore_cen,         "hPhotPhiTPCCPVcore_cen%d" },
+    { kHPhotCPV_cen,                   "hPhotCPV_cen%d" },
+    { kHPhotCPVcore_cen,               "hPhotCPVcore_cen%d" },
+    { kHPhotPhiV0ACPV2_cen,            "hPhotPhiV0ACPV2_cen%d" },
+    { kHPhotPhiV0CCPV2_cen,            "hPhotPhiV0CCPV2_cen%d" },
+    { kHPhotPhiTPCCPV2_cen,            "hPhotPhiTPCCPV2_cen%d" },
+    { kHPhotPhiV0ACPV2core_cen,        "hPhotPhiV0ACPV2core_cen%d" },
+    { kHPhotPhiV0CCPV2core_cen,        "hPhotPhiV0CCPV2core_cen%d" },
+    { kHPhotPhiTPCCPV2core_cen,        "hPhotPhiTPCCPV2core_cen%d" },
+    { kHPhotCPV2_cen,                  "hPhotCPV2_cen%d" },
+    { kHPhotCPV2core_cen,              "hPhotCPV2core_cen%d" },
+    { kHPhotPhiV0ADisp_cen,            "hPhotPhiV0ADisp_cen%d" },
+    { kHPhotPhiV0CDisp_cen,            "hPhotPhiV0CDisp_cen%d" },
+    { kHPhotPhiTPCDisp_cen,            "hPhotPhiTPCDisp_cen%d" },
+    { kHPhotPhiV0ADispcore_cen,        "hPhotPhiV0ADispcore_cen%d" },
+    { kHPhotPhiV0CDispcore_cen,        "hPhotPhiV0CDispcore_cen%d" },
+    { kHPhotPhiTPCDispcore_cen,        "hPhotPhiTPCDispcore_cen%d" },
+    { kHPhotPhiV0ADispwou_cen,         "hPhotPhiV0ADispwou_cen%d" },
+    { kHPhotPhiV0CDispwou_cen,         "hPhotPhiV0CDispwou_cen%d" },
+    { kHPhotPhiTPCDispwou_cen,         "hPhotPhiTPCDispwou_cen%d" },
+    { kHPhotDisp_cen,                  "hPhotDisp_cen%d" },
+    { kHPhotDispcore_cen,              "hPhotDispcore_cen%d" },
+    { kHPhotDispwou_cen,               "hPhotDispwou_cen%d" },
+    { kHPhotPhiV0ABoth_cen,            "hPhotPhiV0ABoth_cen%d" },
+    { kHPhotPhiV0CBoth_cen,            "hPhotPhiV0CBoth_cen%d" },
+    { kHPhotPhiTPCBoth_cen,            "hPhotPhiTPCBoth_cen%d" },
+    { kHPhotPhiV0ABothcore_cen,        "hPhotPhiV0ABothcore_cen%d" },
+    { kHPhotPhiV0CBothcore_cen,        "hPhotPhiV0CBothcore_cen%d" },
+    { kHPhotPhiTPCBothcore_cen,        "hPhotPhiTPCBothcore_cen%d" },
+    { kHPhotBoth_cen,                  "hPhotBoth_cen%d" },
+    { kHPhotBothcore_cen,              "hPhotBothcore_cen%d" },
+    { kHPhotPhiV0ADisp2_cen,           "hPhotPhiV0ADisp2_cen%d" },
+    { kHPhotPhiV0CDisp2_cen,           "hPhotPhiV0CDisp2_cen%d" },
+    { kHPhotPhiTPCDisp2_cen,           "hPhotPhiTPCDisp2_cen%d" },
+    { kHPhotPhiV0ADisp2core_cen,       "hPhotPhiV0ADisp2core_cen%d" },
+    { kHPhotPhiV0CDisp2core_cen,       "hPhotPhiV0CDisp2core_cen%d" },
+    { kHPhotPhiTPCDisp2core_cen,       "hPhotPhiTPCDisp2core_cen%d" },
+    { kHPhotDisp2_cen,                 "hPhotDisp2_cen%d" },
+    { kHPhotDisp2core_cen,             "hPhotDisp2core_cen%d" },
+    { kHPhotPhiV0ABoth2_cen,           "hPhotPhiV0ABoth2_cen%d" },
+    { kHPhotPhiV0CBoth2_cen,           "hPhotPhiV0CBoth2_cen%d" },
+    { kHPhotPhiTPCBoth2_cen,           "hPhotPhiTPCBoth2_cen%d" },
+    { kHPhotPhiV0ABoth2core_cen,       "hPhotPhiV0ABoth2core_cen%d" },
+    { kHPhotPhiV0CBoth2core_cen,       "hPhotPhiV0CBoth2core_cen%d" },
+    { kHPhotPhiTPCBoth2core_cen,       "hPhotPhiTPCBoth2core_cen%d" },
+    { kHPhotBoth2_cen,                 "hPhotBoth2_cen%d" },
+    { kHPhotBoth2core_cen,             "hPhotBoth2core_cen%d" },
+    { kHPHOSphi,                       "hPHOSphi" },
+    { kHPi0WideTOF_cen,                "hPi0WideTOF_cen%d" },
+    { kHSingleWideTOF_cen,             "hSingleWideTOF_cen%d" },
+    { kHMassPtTPCWideTOF_cen,          "hMassPtTPCWideTOF_cen%d" },
+    { kHMassPtV0AAll_cen,              "hMassPtV0AAll_cen%d" },
+    { kHMassPtV0CAll_cen,              "hMassPtV0CAll_cen%d" },
+    { kHMassPtTPCAll_cen,              "hMassPtTPCAll_cen%d" },
+    { kHMassPtV0AAllcore_cen,          "hMassPtV0AAllcore_cen%d" },
+    { kHMassPtV0CAllcore_cen,          "hMassPtV0CAllcore_cen%d" },
+    { kHMassPtTPCAllcore_cen,          "hMassPtTPCAllcore_cen%d" },
+    { kHPi0All_cen,                    "hPi0All_cen%d" },
+    { kHPi0Allcore_cen,                "hPi0Allcore_cen%d" },
+    { kHPi0Allwou_cen,                 "hPi0Allwou_cen%d" },
+    { kHMassPtV0AAllwou_cen,           "hMassPtV0AAllwou_cen%d" },
+    { kHMassPtV0CAllwou_cen,           "hMassPtV0CAllwou_cen%d" },
+    { kHMassPtTPCAllwou_cen,           "hMassPtTPCAllwou_cen%d" },
+    { kHSingleAll_cen,                 "hSingleAll_cen%d" },
+    { kHSingleAllcore_cen,             "hSingleAllcore_cen%d" },
+    { kHSingleAllwou_cen,              "hSingleAllwou_cen%d" },
+    { kHSingleCPV_cen,                 "hSingleCPV_cen%d" },
+    { kHSingleCPVcore_cen,             "hSingleCPVcore_cen%d" },
+    { kHSingleCPV2_cen,                "hSingleCPV2_cen%d" },
+    { kHSingleCPV2core_cen,            "hSingleCPV2core_cen%d" },
+    { kHSingleDisp_cen,                "hSingleDisp_cen%d" },
+    { kHSingleDispwou_cen,             "hSingleDispwou_cen%d" },
+    { kHSingleDispcore_cen,            "hSingleDispcore_cen%d" },
+    { kHSingleDisp2_cen,               "hSingleDisp2_cen%d" },
+    { kHSingleDisp2core_cen,           "hSingleDisp2core_cen%d" },
+    { kHSingleBoth_cen,                "hSingleBoth_cen%d" },
+    { kHSingleBothcore_cen,            "hSingleBothcore_cen%d" },
+    { kHSingleBoth2_cen,               "hSingleBoth2_cen%d" },
+    { kHSingleBoth2core_cen,           "hSingleBoth2core_cen%d" },
+    { kHPi0All_a07_cen,                "hPi0All_a07_cen%d" },
+    { kHMassPtV0ACPV_cen,              "hMassPtV0ACPV_cen%d" },
+    { kHMassPtV0CCPV_cen,              "hMassPtV0CCPV_cen%d" },
+    { kHMassPtTPCCPV_cen,              "hMassPtTPCCPV_cen%d" },
+    { kHMassPtV0ACPVcore_cen,          "hMassPtV0ACPVcore_cen%d" },
+    { kHMassPtV0CCPVcore_cen,          "hMassPtV0CCPVcore_cen%d" },
+    { kHMassPtTPCCPVcore_cen,          "hMassPtTPCCPVcore_cen%d" },
+    { kHPi0CPV_cen,                    "hPi0CPV_cen%d" },
+    { kHPi0CPVcore_cen,                "hPi0CPVcore_cen%d" },
+    { kHPi0CPV_a07_cen,                "hPi0CPV_a07_cen%d" },
+    { kHMassPtV0ACPV2_cen,             "hMassPtV0ACPV2_cen%d" },
+    { kHMassPtV0CCPV2_cen,             "hMassPtV0CCPV2_cen%d" },
+    { kHMassPtTPCCPV2_cen,             "hMassPtTPCCPV2_cen%d" },
+    { kHMassPtV0ACPV2core_cen,         "hMassPtV0ACPV2core_cen%d" },
+    { kHMassPtV0CCPV2core_cen,         "hMassPtV0CCPV2core_cen%d" },
+    { kHMassPtTPCCPV2core_cen,         "hMassPtTPCCPV2core_cen%d" },
+    { kHPi0CPV2_cen,                   "hPi0CPV2_cen%d" },
+    { kHPi0CPV2core_cen,               "hPi0CPV2core_cen%d" },
+    { kHPi0CPV2_a07_cen,               "hPi0CPV2_a07_cen%d" },
+    { kHMassPtV0ADisp_cen,             "hMassPtV0ADisp_cen%d" },
+    { kHMassPtV0CDisp_cen,             "hMassPtV0CDisp_cen%d" },
+    { kHMassPtTPCDisp_cen,             "hMassPtTPCDisp_cen%d" },
+    { kHMassPtV0ADispcore_cen,         "hMassPtV0ADispcore_cen%d" },
+    { kHMassPtV0CDispcore_cen,         "hMassPtV0CDispcore_cen%d" },
+    { kHMassPtTPCDispcore_cen,         "hMassPtTPCDispcore_cen%d" },
+    { kHPi0Disp_cen,                   "hPi0Disp_cen%d" },
+    { kHPi0Dispcore_cen,               "hPi0Dispcore_cen%d" },
+    { kHPi0Dispwou_cen,                "hPi0Dispwou_cen%d" },
+    { kHMassPtV0ADispwou_cen,          "hMassPtV0ADispwou_cen%d" },
+    { kHMassPtV0CDispwou_cen,          "hMassPtV0CDispwou_cen%d" },
+    { kHMassPtTPCDispwou_cen,          "hMassPtTPCDispwou_cen%d" },
+    { kHPi0Disp_a07_cen,               "hPi0Disp_a07_cen%d" },
+    { kHMassPtV0ABoth_cen,             "hMassPtV0ABoth_cen%d" },
+    { kHMassPtV0CBoth_cen,             "hMassPtV0CBoth_cen%d" },
+    { kHMassPtTPCBoth_cen,             "hMassPtTPCBoth_cen%d" },
+    { kHMassPtV0ABothcore_cen,         "hMassPtV0ABothcore_cen%d" },
+    { kHMassPtV0CBothcore_cen,         "hMassPtV0CBothcore_cen%d" },
+    { kHMassPtTPCBothcore_cen,         "hMassPtTPCBothcore_cen%d" },
+    { kHPi0Both_cen,                   "hPi0Both_cen%d" },
+    { kHPi0Bothcore_cen,               "hPi0Bothcore_cen%d" },
+    { kHPi0Both_a07_cen,               "hPi0Both_a07_cen%d" },
+    { kHPi0M11,                        "hPi0M11" },
+    { kHPi0M22,                        "hPi0M22" },
+    { kHPi0M33,                        "hPi0M33" },
+    { kHPi0M44,                        "hPi0M44" },
+    { kHPi0M12,                        "hPi0M12" },
+    { kHPi0M13,                        "hPi0M13" },
+    { kHPi0M14,                        "hPi0M14" },
+    { kHPi0M23,                        "hPi0M23" },
+    { kHPi0M24,                        "hPi0M24" },
+    { kHPi0M34,                        "hPi0M34" },
+    { kHPi0Disp2_cen,                  "hPi0Disp2_cen%d" },
+    { kHPi0Disp2core_cen,              "hPi0Disp2core_cen%d" },
+    { kHMassPtV0ADisp2_cen,            "hMassPtV0ADisp2_cen%d" },
+    { kHMassPtV0CDisp2_cen,            "hMassPtV0CDisp2_cen%d" },
+    { kHMassPtTPCDisp2_cen,            "hMassPtTPCDisp2_cen%d" },
+    { kHMassPtV0ADisp2core_cen,        "hMassPtV0ADisp2core_cen%d" },
+    { kHMassPtV0CDisp2core_cen,        "hMassPtV0CDisp2core_cen%d" },
+    { kHMassPtTPCDisp2core_cen,        "hMassPtTPCDisp2core_cen%d" },
+    { kHMassPtV0ABoth2_cen,            "hMassPtV0ABoth2_cen%d" },
+    { kHMassPtV0CBoth2_cen,            "hMassPtV0CBoth2_cen%d" },
+    { kHMassPtTPCBoth2_cen,            "hMassPtTPCBoth2_cen%d" },
+    { kHMassPtV0ABoth2core_cen,        "hMassPtV0ABoth2core_cen%d" },
+    { kHMassPtV0CBoth2core_cen,        "hMassPtV0CBoth2core_cen%d" },
+    { kHMassPtTPCBoth2core_cen,        "hMassPtTPCBoth2core_cen%d" },
+    { kHPi0Both2_cen,                  "hPi0Both2_cen%d" },
+    { kHPi0Both2core_cen,              "hPi0Both2core_cen%d" },
+    { kHMiPi0WideTOF_cen,              "hMiPi0WideTOF_cen%d" },
+    { kHMiSingleWideTOF_cen,           "hMiSingleWideTOF_cen%d" },
+    { kHMiMassPtTPCWideTOF_cen,        "hMiMassPtTPCWideTOF_cen%d" },
+    { kHMiMassPtV0AAll_cen,            "hMiMassPtV0AAll_cen%d" },
+    { kHMiMassPtV0CAll_cen,            "hMiMassPtV0CAll_cen%d" },
+    { kHMiMassPtTPCAll_cen,            "hMiMassPtTPCAll_cen%d" },
+    { kHMiMassPtV0AAllcore_cen,        "hMiMassPtV0AAllcore_cen%d" },
+    { kHMiMassPtV0CAllcore_cen,        "hMiMassPtV0CAllcore_cen%d" },
+    { kHMiMassPtTPCAllcore_cen,        "hMiMassPtTPCAllcore_cen%d" },
+    { kHMiPi0All_cen,                  "hMiPi0All_cen%d" },
+    { kHMiPi0Allcore_cen,              "hMiPi0Allcore_cen%d" },
+    { kHMiPi0Allwou_cen,               "hMiPi0Allwou_cen%d" },
+    { kHMiMassPtV0AAllwou_cen,         "hMiMassPtV0AAllwou_cen%d" },
+    { kHMiMassPtV0CAllwou_cen,         "hMiMassPtV0CAllwou_cen%d" },
+    { kHMiMassPtTPCAllwou_cen,         "hMiMassPtTPCAllwou_cen%d" },
+    { kHMiSingleAll_cen,               "hMiSingleAll_cen%d" },
+    { kHMiSingleAllcore_cen,           "hMiSingleAllcore_cen%d" },
+    { kHMiSingleAllwou_cen,            "hMiSingleAllwou_cen%d" },
+    { kHMiSingleCPV_cen,               "hMiSingleCPV_cen%d" },
+    { kHMiSingleCPVcore_cen,           "hMiSingleCPVcore_cen%d" },
+    { kHMiSingleCPV2_cen,              "hMiSingleCPV2_cen%d" },
+    { kHMiSingleCPV2core_cen,          "hMiSingleCPV2core_cen%d" },
+    { kHMiSingleDisp_cen,              "hMiSingleDisp_cen%d" },
+    { kHMiSingleDispwou_cen,           "hMiSingleDispwou_cen%d" },
+    { kHMiSingleDispcore_cen,          "hMiSingleDispcore_cen%d" },
+    { kHMiSingleDisp2_cen,             "hMiSingleDisp2_cen%d" },
+    { kHMiSingleDisp2core_cen,         "hMiSingleDisp2core_cen%d" },
+    { kHMiSingleBoth_cen,              "hMiSingleBoth_cen%d" },
+    { kHMiSingleBothcore_cen,          "hMiSingleBothcore_cen%d" },
+    { kHMiSingleBoth2_cen,             "hMiSingleBoth2_cen%d" },
+    { kHMiSingleBoth2core_cen,         "hMiSingleBoth2core_cen%d" },
+    { kHMiPi0All_a07_cen,              "hMiPi0All_a07_cen%d" },
+    { kHMiMassPtV0ACPV_cen,            "hMiMassPtV0ACPV_cen%d" },
+    { kHMiMassPtV0CCPV_cen,            "hMiMassPtV0CCPV_cen%d" },
+    { kHMiMassPtTPCCPV_cen,            "hMiMassPtTPCCPV_cen%d" },
+    { kHMiMassPtV0ACPVcore_cen,        "hMiMassPtV0ACPVcore_cen%d" },
+    { kHMiMassPtV0CCPVcore_cen,        "hMiMassPtV0CCPVcore_cen%d" },
+    { kHMiMassPtTPCCPVcore_cen,        "hMiMassPtTPCCPVcore_cen%d" },
+    { kHMiPi0CPV_cen,                  "hMiPi0CPV_cen%d" },
+    { kHMiPi0CPVcore_cen,              "hMiPi0CPVcore_cen%d" },
+    { kHMiPi0CPV_a07_cen,              "hMiPi0CPV_a07_cen%d" },
+    { kHMiPi0CPV2_cen,                 "hMiPi0CPV2_cen%d" },
+    { kHMiPi0CPV2core_cen,             "hMiPi0CPV2core_cen%d" },
+    { kHMiMassPtV0ACPV2_cen,           "hMiMassPtV0ACPV2_cen%d" },
+    { kHMiMassPtV0CCPV2_cen,           "hMiMassPtV0CCPV2_cen%d" },
+    { kHMiMassPtTPCCPV2_cen,           "hMiMassPtTPCCPV2_cen%d" },
+    { kHMiMassPtV0ACPV2core_cen,       "hMiMassPtV0ACPV2core_cen%d" },
+    { kHMiMassPtV0CCPV2core_cen,       "hMiMassPtV0CCPV2core_cen%d" },
+    { kHMiMassPtTPCCPV2core_cen,       "hMiMassPtTPCCPV2core_cen%d" },
+    { kHMiPi0CPV2_a07_cen,             "hMiPi0CPV2_a07_cen%d" },
+    { kHMiMassPtV0ADisp_cen,           "hMiMassPtV0ADisp_cen%d" },
+    { kHMiMassPtV0CDisp_cen,           "hMiMassPtV0CDisp_cen%d" },
+    { kHMiMassPtTPCDisp_cen,           "hMiMassPtTPCDisp_cen%d" },
+    { kHMiMassPtV0ADispcore_cen,       "hMiMassPtV0ADispcore_cen%d" },
+    { kHMiMassPtV0CDispcore_cen,       "hMiMassPtV0CDispcore_cen%d" },
+    { kHMiMassPtTPCDispcore_cen,       "hMiMassPtTPCDispcore_cen%d" },
+    { kHMiPi0Disp_cen,                 "hMiPi0Disp_cen%d" },
+    { kHMiPi0Dispcore_cen,             "hMiPi0Dispcore_cen%d" },
+    { kHMiPi0Dispwou_cen,              "hMiPi0Dispwou_cen%d" },
+    { kHMiMassPtV0ADispwou_cen,        "hMiMassPtV0ADispwou_cen%d" },
+    { kHMiMassPtV0CDispwou_cen,        "hMiMassPtV0CDispwou_cen%d" },
+    { kHMiMassPtTPCDispwou_cen,        "hMiMassPtTPCDispwou_cen%d" },
+    { kHMiPi0Disp_a07_cen,             "hMiPi0Disp_a07_cen%d" },
+    { kHMiMassPtV0ABoth_cen,           "hMiMassPtV0ABoth_cen%d" },
+    { kHMiMassPtV0CBoth_cen,           "hMiMassPtV0CBoth_cen%d" },
+    { kHMiMassPtTPCBoth_cen,           "hMiMassPtTPCBoth_cen%d" },
+    { kHMiMassPtV0ABothcore_cen,       "hMiMassPtV0ABothcore_cen%d" },
+    { kHMiMassPtV0CBothcore_cen,       "hMiMassPtV0CBothcore_cen%d" },
+    { kHMiMassPtTPCBothcore_cen,       "hMiMassPtTPCBothcore_cen%d" },
+    { kHMiPi0Both_cen,                 "hMiPi0Both_cen%d" },
+    { kHMiPi0Bothcore_cen,             "hMiPi0Bothcore_cen%d" },
+    { kHMiPi0Both_a07_cen,             "hMiPi0Both_a07_cen%d" },
+    { kHMiMassPtV0ADisp2_cen,          "hMiMassPtV0ADisp2_cen%d" },
+    { kHMiMassPtV0CDisp2_cen,          "hMiMassPtV0CDisp2_cen%d" },
+    { kHMiMassPtTPCDisp2_cen,          "hMiMassPtTPCDisp2_cen%d" },
+    { kHMiMassPtV0ADisp2core_cen,      "hMiMassPtV0ADisp2core_cen%d" },
+    { kHMiMassPtV0CDisp2core_cen,      "hMiMassPtV0CDisp2core_cen%d" },
+    { kHMiMassPtTPCDisp2core_cen,      "hMiMassPtTPCDisp2core_cen%d" },
+    { kHMiPi0Disp2_cen,                "hMiPi0Disp2_cen%d" },
+    { kHMiPi0Disp2core_cen,            "hMiPi0Disp2core_cen%d" },
+    { kHMiMassPtV0ABoth2_cen,          "hMiMassPtV0ABoth2_cen%d" },
+    { kHMiMassPtV0CBoth2_cen,          "hMiMassPtV0CBoth2_cen%d" },
+    { kHMiMassPtTPCBoth2_cen,          "hMiMassPtTPCBoth2_cen%d" },
+    { kHMiMassPtV0ABoth2core_cen,      "hMiMassPtV0ABoth2core_cen%d" },
+    { kHMiMassPtV0CBoth2core_cen,      "hMiMassPtV0CBoth2core_cen%d" },
+    { kHMiMassPtTPCBoth2core_cen,      "hMiMassPtTPCBoth2core_cen%d" },
+    { kHMiPi0Both2_cen,                "hMiPi0Both2_cen%d" },
+    { kHMiPi0Both2core_cen,            "hMiPi0Both2core_cen%d" },
+    { kHSelEvents,                     "hSelEvents" },
+    { kHTotSelEvents,                  "hTotSelEvents" },
+    { kHZvertex,                       "hZvertex" },
+    { kHCentrality,                    "hCentrality" },
+    { kHPhiRP,                         "phiRP" },
+    { kHPhiRPflat,                     "phiRPflat" },
+    { kHCos2AC,                        "cos2AC" },
+    { kHPhiRPV0A,                      "phiRPV0A" },
+    { kHPhiRPV0C,                      "phiRPV0C" },
+    { kHPhiRPV0AC,                     "phiRPV0AC" },
+    { kHPhiRPV0Aflat,                  "phiRPV0Aflat" },
+    { kHCos2V0AC,                      "cos2V0AC" },
+    { kHPhiRPV0ATPC,                   "phiRPV0ATPC" },
+    { kHCos2V0ATPC,                    "cos2V0ATPC" },
+    { kHPhiRPV0Cflat,                  "phiRPV0Cflat" },
+    { kHPhiRPV0CTPC,                   "phiRPV0CTPC" },
+    { kHCos2V0CTPC,                    "cos2V0CTPC" },
+  };
+}
+
 const Double_t AliAnalysisTaskPi0Flow::kLogWeight         = 4.5 ;
 const Double_t AliAnalysisTaskPi0Flow::kAlphaCut          = 0.1 ;
 const Bool_t   AliAnalysisTaskPi0Flow::doESDReCalibration = kTRUE;
@@ -99,6 +709,7 @@ AliAnalysisTaskPi0Flow::AliAnalysisTaskPi0Flow(const char *name, Period period)
   fFillWideTOF(false),
   fTrigName(0x0),
   fOutputContainer(0x0),
+  fHistograms(),
   fNonLinCorr(0),
   fEvent(0x0),
   fEventESD(0x0),
@@ -192,6 +803,10 @@ void AliAnalysisTaskPi0Flow::UserCreateOutputObjects()
   fOutputContainer = new THashList();
   fOutputContainer->SetOwner(kTRUE);
 
+  fHistograms.Clear();
+  for(UInt_t i=0; i<sizeof(gkHistogramNames)/sizeof(gkHistogramNames[0]); i++)
+    fHistograms.Register(gkHistogramNames[i].fHandle, fOutputContainer, gkHistogramNames[i].fName);
+
   //========QA histograms=======
 
   //Event selection
@@ -587,8 +1202,8 @@ void AliAnalysisTaskPi0Flow::FillPHOSCellQAHists()
 
   AliVCaloCells * cells = fEvent->GetPHOSCells();
 
-  FillHistogram("hCenPHOSCells",fCentrality,cells->GetNumberOfCells()) ;
-  FillHistogram("hCenTrack",fCentrality,fEvent->GetNumberOfTracks()) ;
+  FillHistogram(fHistograms.Get(kHCenPHOSCells),fCentrality,cells->GetNumberOfCells()) ;
+  FillHistogram(fHistograms.Get(kHCenTrack),fCentrality,fEvent->GetNumberOfTracks()) ;
 
 
   Int_t nCellModule[4] = {0,0,0,0};
@@ -600,37 +1215,37 @@ void AliAnalysisTaskPi0Flow::FillPHOSCellQAHists()
     Int_t cellX = relId[2];
     Int_t cellZ = relId[3] ;
     Float_t energy = cells->GetAmplitude(iCell);
-    FillHistogram("hCellEnergy",energy);
+    FillHistogram(fHistograms.Get(kHCellEnergy),energy);
     if(mod1==1) {
       nCellModule[0]++;
-      FillHistogram("hCellEnergyM1",cells->GetAmplitude(iCell));
-      FillHistogram("hCellNXZM1",cellX,cellZ,1.);
-      FillHistogram("hCellEXZM1",cellX,cellZ,energy);
+      FillHistogram(fHistograms.Get(kHCellEnergyM1),cells->GetAmplitude(iCell));
+      FillHistogram(fHistograms.Get(kHCellNXZM1),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCellEXZM1),cellX,cellZ,energy);
     }
     else if (mod1==2) {
       nCellModule[1]++;
-      FillHistogram("hCellEnergyM2",cells->GetAmplitude(iCell));
-      FillHistogram("hCellNXZM2",cellX,cellZ,1.);
-      FillHistogram("hCellEXZM2",cellX,cellZ,energy);
+      FillHistogram(fHistograms.Get(kHCellEnergyM2),cells->GetAmplitude(iCell));
+      FillHistogram(fHistograms.Get(kHCellNXZM2),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCellEXZM2),cellX,cellZ,energy);
     }
     else if (mod1==3) {
       nCellModule[2]++;
-      FillHistogram("hCellEnergyM3",cells->GetAmplitude(iCell));
-      FillHistogram("hCellNXZM3",cellX,cellZ,1.);
-      FillHistogram("hCellEXZM3",cellX,cellZ,energy);
+      FillHistogram(fHistograms.Get(kHCellEnergyM3),cells->GetAmplitude(iCell));
+      FillHistogram(fHistograms.Get(kHCellNXZM3),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCellEXZM3),cellX,cellZ,energy);
     }
     else if (mod1==4) {
       nCellModule[3]++;
-      FillHistogram("hCellEnergyM4",cells->GetAmplitude(iCell));
-      FillHistogram("hCellNXZM4",cellX,cellZ,1.);
-      FillHistogram("hCellEXZM4",cellX,cellZ,energy);
+      FillHistogram(fHistograms.Get(kHCellEnergyM4),cells->GetAmplitude(iCell));
+      FillHistogram(fHistograms.Get(kHCellNXZM4),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCellEXZM4),cellX,cellZ,energy);
     }
   }
-  FillHistogram("hCellMultEvent",nCellModule[0]+nCellModule[1]+nCellModule[2]+nCellModule[3]);
-  FillHistogram("hCellMultEventM1",nCellModule[0]);
-  FillHistogram("hCellMultEventM2",nCellModule[1]);
-  FillHistogram("hCellMultEventM3",nCellModule[2]);
-  FillHistogram("hCellMultEventM4",nCellModule[3]);
+  FillHistogram(fHistograms.Get(kHCellMultEvent),nCellModule[0]+nCellModule[1]+nCellModule[2]+nCellModule[3]);
+  FillHistogram(fHistograms.Get(kHCellMultEventM1),nCellModule[0]);
+  FillHistogram(fHistograms.Get(kHCellMultEventM2),nCellModule[1]);
+  FillHistogram(fHistograms.Get(kHCellMultEventM3),nCellModule[2]);
+  FillHistogram(fHistograms.Get(kHCellMultEventM4),nCellModule[3]);
 
 }
 //_____________________________________________________________________________
@@ -672,7 +1287,7 @@ void AliAnalysisTaskPi0Flow::SelectPhotonClusters()
     if(distBC<kMinBCDistance)
       continue ;
       
-    FillHistogram("hCluEvsClu", clu->E(), clu->GetNCells()) ;
+    FillHistogram(fHistograms.Get(kHCluEvsClu), clu->E(), clu->GetNCells()) ;
 
     if(clu->GetNCells() < kMinNCells) continue ;
     if(clu->GetM02() < kMinM02)   continue ;
@@ -686,9 +1301,9 @@ void AliAnalysisTaskPi0Flow::SelectPhotonClusters()
     AliESDCaloCluster* aodCluster = (AliESDCaloCluster*) (clu);
     aodCluster->GetMomentum(lorentzMomentum ,origo);
 
-    FillHistogram(Form("hCluLowM%d",mod),cellX,cellZ,1.);
+    FillHistogram(fHistograms.Get(kHCluLowM, mod),cellX,cellZ,1.);
     if(lorentzMomentum.E()>1.5){
-      FillHistogram(Form("hCluHighM%d",mod),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCluHighM, mod),cellX,cellZ,1.);
     }
 
     fCaloPhotonsPHOS->Add(new  AliCaloPhoton(lorentzMomentum.X(),lorentzMomentum.Py(),lorentzMomentum.Z(),lorentzMomentum.E()) );
@@ -706,7 +1321,7 @@ void AliAnalysisTaskPi0Flow::SelectPhotonClusters()
     ph->SetDisp2Bit(TestCoreLambda(clu->E(),m20,m02)) ; //Correct order m20,m02
 //    ph->SetDisp2Bit(TestCoreLambda(clu->E(),clu->GetM20(),clu->GetM02())) ;
     if(ph->IsDispOK()){
-      FillHistogram(Form("hCluDispM%d",mod),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCluDispM, mod),cellX,cellZ,1.);
     }
 
     // Track Matching
@@ -745,7 +1360,7 @@ void AliAnalysisTaskPi0Flow::SelectPhotonClusters()
     ph->SetCPVBit(cpvBit) ;
     ph->SetCPV2Bit(cpvBit2) ;
     if(cpvBit){
-      FillHistogram(Form("hCluVetoM%d",mod),cellX,cellZ,1.);
+      FillHistogram(fHistograms.Get(kHCluVetoM, mod),cellX,cellZ,1.);
     }
     ph->SetEMCx(float(cellX)) ;
     ph->SetEMCz(float(cellZ)) ;
@@ -756,7 +1371,7 @@ void AliAnalysisTaskPi0Flow::SelectPhotonClusters()
     Double_t tof = clu->GetTOF();
     ph->SetTOFBit( TMath::Abs(tof) < fTOFCut );
   }
-  FillHistogram("hCenPHOS",fCentrality, fCaloPhotonsPHOS->GetEntriesFast()) ;
+  FillHistogram(fHistograms.Get(kHCenPHOS),fCentrality, fCaloPhotonsPHOS->GetEntriesFast()) ;
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::FillSelectedClusterHistograms()
@@ -780,123 +1395,123 @@ void AliAnalysisTaskPi0Flow::FillSelectedClusterHistograms()
     Double_t ptcore = ph1->GetMomV2()->Pt() ;
 
     if( fFillWideTOF ) {
-      FillHistogram(Form("hPhotWideTOF_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotPhiV0AWideTOF_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CWideTOF_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotWideTOF_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0AWideTOF_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CWideTOF_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-	FillHistogram(Form("hPhotPhiTPCWideTOF_cen%d",fCentBin),pt,dphiT) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiTPCWideTOF_cen, fCentBin),pt,dphiT) ;
     }
     if(fTOFCutEnabled && !ph1->IsTOFOK() )
       continue;
 
-    FillHistogram(Form("hPhotPhiV0AAll_cen%d",fCentBin),pt,dphiA) ;
-    FillHistogram(Form("hPhotPhiV0CAll_cen%d",fCentBin),pt,dphiC) ;
+    FillHistogram(fHistograms.Get(kHPhotPhiV0AAll_cen, fCentBin),pt,dphiA) ;
+    FillHistogram(fHistograms.Get(kHPhotPhiV0CAll_cen, fCentBin),pt,dphiC) ;
     if(fHaveTPCRP)
-      FillHistogram(Form("hPhotPhiTPCAll_cen%d",fCentBin),pt,dphiT) ;
-    FillHistogram(Form("hPhotPhiV0AAllcore_cen%d",fCentBin),ptcore,dphiA) ;
-    FillHistogram(Form("hPhotPhiV0CAllcore_cen%d",fCentBin),ptcore,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiTPCAll_cen, fCentBin),pt,dphiT) ;
+    FillHistogram(fHistograms.Get(kHPhotPhiV0AAllcore_cen, fCentBin),ptcore,dphiA) ;
+    FillHistogram(fHistograms.Get(kHPhotPhiV0CAllcore_cen, fCentBin),ptcore,dphiC) ;
     if(fHaveTPCRP)
-      FillHistogram(Form("hPhotPhiTPCAllcore_cen%d",fCentBin),ptcore,dphiT) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiTPCAllcore_cen, fCentBin),ptcore,dphiT) ;
 
-    FillHistogram(Form("hPhotAll_cen%d",fCentBin),pt) ;
-    FillHistogram(Form("hPhotAllcore_cen%d",fCentBin),ptcore) ;
+    FillHistogram(fHistograms.Get(kHPhotAll_cen, fCentBin),pt) ;
+    FillHistogram(fHistograms.Get(kHPhotAllcore_cen, fCentBin),ptcore) ;
     if(ph1->IsntUnfolded()){
-      FillHistogram(Form("hPhotAllwou_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotPhiV0AAllwou_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CAllwou_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotAllwou_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0AAllwou_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CAllwou_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCAllwou_cen%d",fCentBin),pt,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCAllwou_cen, fCentBin),pt,dphiT) ;
     }
     if(ph1->IsCPVOK()){
-      FillHistogram(Form("hPhotPhiV0ACPV_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CCPV_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ACPV_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CCPV_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCCPV_cen%d",fCentBin),pt,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCCPV_cen, fCentBin),pt,dphiT) ;
 
-      FillHistogram(Form("hPhotPhiV0ACPVcore_cen%d",fCentBin),ptcore,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CCPVcore_cen%d",fCentBin),ptcore,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ACPVcore_cen, fCentBin),ptcore,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CCPVcore_cen, fCentBin),ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCCPVcore_cen%d",fCentBin),ptcore,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCCPVcore_cen, fCentBin),ptcore,dphiT) ;
 
-      FillHistogram(Form("hPhotCPV_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotCPVcore_cen%d",fCentBin),ptcore) ;
+      FillHistogram(fHistograms.Get(kHPhotCPV_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotCPVcore_cen, fCentBin),ptcore) ;
     }
     if(ph1->IsCPV2OK()){
-      FillHistogram(Form("hPhotPhiV0ACPV2_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CCPV2_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ACPV2_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CCPV2_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCCPV2_cen%d",fCentBin),pt,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCCPV2_cen, fCentBin),pt,dphiT) ;
 
-      FillHistogram(Form("hPhotPhiV0ACPV2core_cen%d",fCentBin),ptcore,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CCPV2core_cen%d",fCentBin),ptcore,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ACPV2core_cen, fCentBin),ptcore,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CCPV2core_cen, fCentBin),ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCCPV2core_cen%d",fCentBin),ptcore,dphiT) ;
-      FillHistogram(Form("hPhotCPV2_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotCPV2core_cen%d",fCentBin),ptcore) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCCPV2core_cen, fCentBin),ptcore,dphiT) ;
+      FillHistogram(fHistograms.Get(kHPhotCPV2_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotCPV2core_cen, fCentBin),ptcore) ;
     }
     if(ph1->IsDispOK()){
-      FillHistogram(Form("hPhotPhiV0ADisp_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CDisp_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ADisp_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CDisp_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCDisp_cen%d",fCentBin),pt,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCDisp_cen, fCentBin),pt,dphiT) ;
 
-      FillHistogram(Form("hPhotPhiV0ADispcore_cen%d",fCentBin),ptcore,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CDispcore_cen%d",fCentBin),ptcore,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ADispcore_cen, fCentBin),ptcore,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CDispcore_cen, fCentBin),ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCDispcore_cen%d",fCentBin),ptcore,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCDispcore_cen, fCentBin),ptcore,dphiT) ;
 
       if(ph1->IsntUnfolded()){
-        FillHistogram(Form("hPhotPhiV0ADispwou_cen%d",fCentBin),pt,dphiA) ;
-        FillHistogram(Form("hPhotPhiV0CDispwou_cen%d",fCentBin),pt,dphiC) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiV0ADispwou_cen, fCentBin),pt,dphiA) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiV0CDispwou_cen, fCentBin),pt,dphiC) ;
         if(fHaveTPCRP)
-          FillHistogram(Form("hPhotPhiTPCDispwou_cen%d",fCentBin),pt,dphiT) ;
+          FillHistogram(fHistograms.Get(kHPhotPhiTPCDispwou_cen, fCentBin),pt,dphiT) ;
 
       }
-      FillHistogram(Form("hPhotDisp_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotDispcore_cen%d",fCentBin),ptcore) ;
+      FillHistogram(fHistograms.Get(kHPhotDisp_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotDispcore_cen, fCentBin),ptcore) ;
       if(ph1->IsntUnfolded()){
-        FillHistogram(Form("hPhotDispwou_cen%d",fCentBin),pt) ;
+        FillHistogram(fHistograms.Get(kHPhotDispwou_cen, fCentBin),pt) ;
       }
       if(ph1->IsCPVOK()){
-	FillHistogram(Form("hPhotPhiV0ABoth_cen%d",fCentBin),pt,dphiA) ;
-	FillHistogram(Form("hPhotPhiV0CBoth_cen%d",fCentBin),pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0ABoth_cen, fCentBin),pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0CBoth_cen, fCentBin),pt,dphiC) ;
         if(fHaveTPCRP)
-  	  FillHistogram(Form("hPhotPhiTPCBoth_cen%d",fCentBin),pt,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHPhotPhiTPCBoth_cen, fCentBin),pt,dphiT) ;
 
-	FillHistogram(Form("hPhotPhiV0ABothcore_cen%d",fCentBin),ptcore,dphiA) ;
-	FillHistogram(Form("hPhotPhiV0CBothcore_cen%d",fCentBin),ptcore,dphiC) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0ABothcore_cen, fCentBin),ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0CBothcore_cen, fCentBin),ptcore,dphiC) ;
         if(fHaveTPCRP)
-	  FillHistogram(Form("hPhotPhiTPCBothcore_cen%d",fCentBin),ptcore,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHPhotPhiTPCBothcore_cen, fCentBin),ptcore,dphiT) ;
 
-	FillHistogram(Form("hPhotBoth_cen%d",fCentBin),pt) ;
-	FillHistogram(Form("hPhotBothcore_cen%d",fCentBin),ptcore) ;
+	FillHistogram(fHistograms.Get(kHPhotBoth_cen, fCentBin),pt) ;
+	FillHistogram(fHistograms.Get(kHPhotBothcore_cen, fCentBin),ptcore) ;
       }
     }
     if(ph1->IsDisp2OK()){
-      FillHistogram(Form("hPhotPhiV0ADisp2_cen%d",fCentBin),pt,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CDisp2_cen%d",fCentBin),pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ADisp2_cen, fCentBin),pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CDisp2_cen, fCentBin),pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCDisp2_cen%d",fCentBin),pt,dphiT) ;
-      FillHistogram(Form("hPhotPhiV0ADisp2core_cen%d",fCentBin),ptcore,dphiA) ;
-      FillHistogram(Form("hPhotPhiV0CDisp2core_cen%d",fCentBin),ptcore,dphiC) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCDisp2_cen, fCentBin),pt,dphiT) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0ADisp2core_cen, fCentBin),ptcore,dphiA) ;
+      FillHistogram(fHistograms.Get(kHPhotPhiV0CDisp2core_cen, fCentBin),ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hPhotPhiTPCDisp2core_cen%d",fCentBin),ptcore,dphiT) ;
+        FillHistogram(fHistograms.Get(kHPhotPhiTPCDisp2core_cen, fCentBin),ptcore,dphiT) ;
 
-      FillHistogram(Form("hPhotDisp2_cen%d",fCentBin),pt) ;
-      FillHistogram(Form("hPhotDisp2core_cen%d",fCentBin),ptcore) ;
+      FillHistogram(fHistograms.Get(kHPhotDisp2_cen, fCentBin),pt) ;
+      FillHistogram(fHistograms.Get(kHPhotDisp2core_cen, fCentBin),ptcore) ;
       if(ph1->IsCPVOK()){
-	FillHistogram(Form("hPhotPhiV0ABoth2_cen%d",fCentBin),pt,dphiA) ;
-	FillHistogram(Form("hPhotPhiV0CBoth2_cen%d",fCentBin),pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0ABoth2_cen, fCentBin),pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0CBoth2_cen, fCentBin),pt,dphiC) ;
         if(fHaveTPCRP)
-  	  FillHistogram(Form("hPhotPhiTPCBoth2_cen%d",fCentBin),pt,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHPhotPhiTPCBoth2_cen, fCentBin),pt,dphiT) ;
 
-	FillHistogram(Form("hPhotPhiV0ABoth2core_cen%d",fCentBin),ptcore,dphiA) ;
-	FillHistogram(Form("hPhotPhiV0CBoth2core_cen%d",fCentBin),ptcore,dphiC) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0ABoth2core_cen, fCentBin),ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHPhotPhiV0CBoth2core_cen, fCentBin),ptcore,dphiC) ;
         if(fHaveTPCRP)
-	  FillHistogram(Form("hPhotPhiTPCBoth2core_cen%d",fCentBin),ptcore,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHPhotPhiTPCBoth2core_cen, fCentBin),ptcore,dphiT) ;
 
-	FillHistogram(Form("hPhotBoth2_cen%d",fCentBin),pt) ;
-	FillHistogram(Form("hPhotBoth2core_cen%d",fCentBin),ptcore) ;
+	FillHistogram(fHistograms.Get(kHPhotBoth2_cen, fCentBin),pt) ;
+	FillHistogram(fHistograms.Get(kHPhotBoth2core_cen, fCentBin),ptcore) ;
       }
     }
   }
@@ -904,14 +1519,13 @@ void AliAnalysisTaskPi0Flow::FillSelectedClusterHistograms()
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0s()
 {
-  char key[55];
   for (Int_t i1=0; i1 < fCaloPhotonsPHOS->GetEntriesFast()-1; i1++) {
     AliCaloPhoton * ph1=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i1) ;
     for (Int_t i2=i1+1; i2<fCaloPhotonsPHOS->GetEntriesFast(); i2++) {
       AliCaloPhoton * ph2=(AliCaloPhoton*)fCaloPhotonsPHOS->At(i2) ;
       TLorentzVector p12  = *ph1  + *ph2;
       TLorentzVector pv12 = *(ph1->GetMomV2()) + *(ph2->GetMomV2());
-      FillHistogram("hPHOSphi",fCentrality,p12.Pt(),p12.Phi());
+      FillHistogram(fHistograms.Get(kHPHOSphi),fCentrality,p12.Pt(),p12.Phi());
       Double_t dphiA=p12.Phi()-fRPV0A ;
       while(dphiA<0)dphiA+=TMath::Pi() ;
       while(dphiA>TMath::Pi())dphiA-=TMath::Pi() ;
@@ -935,237 +1549,234 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0s()
       Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
       if( fFillWideTOF ) {
-	FillHistogram(Form("hPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	FillHistogram(Form("hSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	FillHistogram(fHistograms.Get(kHPi0WideTOF_cen, fCentBin),m,pt) ;
+	FillHistogram(fHistograms.Get(kHSingleWideTOF_cen, fCentBin),m,pt1) ;
+	FillHistogram(fHistograms.Get(kHSingleWideTOF_cen, fCentBin),m,pt2) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHMassPtTPCWideTOF_cen, fCentBin),m,pt,dphiT) ;
       }
 
       if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
 	continue;
 
-      FillHistogram(Form("hMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
+      FillHistogram(fHistograms.Get(kHMassPtV0AAll_cen, fCentBin),m,pt,dphiA) ;
+      FillHistogram(fHistograms.Get(kHMassPtV0CAll_cen, fCentBin),m,pt,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
+        FillHistogram(fHistograms.Get(kHMassPtTPCAll_cen, fCentBin),m,pt,dphiT) ;
 
-      FillHistogram(Form("hMassPtV0AAllcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-      FillHistogram(Form("hMassPtV0CAllcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+      FillHistogram(fHistograms.Get(kHMassPtV0AAllcore_cen, fCentBin),mcore,ptcore,dphiA) ;
+      FillHistogram(fHistograms.Get(kHMassPtV0CAllcore_cen, fCentBin),mcore,ptcore,dphiC) ;
       if(fHaveTPCRP)
-        FillHistogram(Form("hMassPtTPCAllcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+        FillHistogram(fHistograms.Get(kHMassPtTPCAllcore_cen, fCentBin),mcore,ptcore,dphiT) ;
 
 
-      FillHistogram(Form("hPi0All_cen%d",fCentBin),m,pt) ;
-      FillHistogram(Form("hPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
+      FillHistogram(fHistograms.Get(kHPi0All_cen, fCentBin),m,pt) ;
+      FillHistogram(fHistograms.Get(kHPi0Allcore_cen, fCentBin),mcore,ptcore) ;
       if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-        FillHistogram(Form("hPi0Allwou_cen%d",fCentBin),m,pt) ;
-        FillHistogram(Form("hMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-        FillHistogram(Form("hMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
+        FillHistogram(fHistograms.Get(kHPi0Allwou_cen, fCentBin),m,pt) ;
+        FillHistogram(fHistograms.Get(kHMassPtV0AAllwou_cen, fCentBin),m,pt,dphiA) ;
+        FillHistogram(fHistograms.Get(kHMassPtV0CAllwou_cen, fCentBin),m,pt,dphiC) ;
         if(fHaveTPCRP)
-          FillHistogram(Form("hMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
+          FillHistogram(fHistograms.Get(kHMassPtTPCAllwou_cen, fCentBin),m,pt,dphiT) ;
       }
 
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt1) ;
-      FillHistogram(Form("hSingleAll_cen%d",fCentBin),m,pt2) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-      FillHistogram(Form("hSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+      FillHistogram(fHistograms.Get(kHSingleAll_cen, fCentBin),m,pt1) ;
+      FillHistogram(fHistograms.Get(kHSingleAll_cen, fCentBin),m,pt2) ;
+      FillHistogram(fHistograms.Get(kHSingleAllcore_cen, fCentBin),mcore,ptcore1) ;
+      FillHistogram(fHistograms.Get(kHSingleAllcore_cen, fCentBin),mcore,ptcore2) ;
       if(ph1->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleAllwou_cen, fCentBin),m,pt1) ;
       if(ph2->IsntUnfolded())
-        FillHistogram(Form("hSingleAllwou_cen%d",fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleAllwou_cen, fCentBin),m,pt2) ;
       if(ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleCPVcore_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleCPV_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleCPVcore_cen, fCentBin),mcore,ptcore2) ;
       }
       if(ph1->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV2_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV2core_cen, fCentBin),mcore,ptcore2) ;
       }
       if(ph2->IsCPV2OK()){
-        FillHistogram(Form("hSingleCPV2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV2_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleCPV2core_cen, fCentBin),mcore,ptcore2) ;
       }
       if(ph1->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp_cen, fCentBin),m,pt1) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHSingleDispwou_cen, fCentBin),m,pt1) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleDispcore_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph2->IsDispOK()){
-        FillHistogram(Form("hSingleDisp_cen%d",fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp_cen, fCentBin),m,pt2) ;
         if(ph1->IsntUnfolded()){
-          FillHistogram(Form("hSingleDispwou_cen%d",fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHSingleDispwou_cen, fCentBin),m,pt2) ;
 	}
-        FillHistogram(Form("hSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleDispcore_cen, fCentBin),mcore,ptcore2) ;
       }
       if(ph1->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp2_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp2core_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph2->IsDisp2OK()){
-        FillHistogram(Form("hSingleDisp2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp2_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleDisp2core_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph1->IsDispOK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleBothcore_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph2->IsDispOK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBothcore_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleBothcore_cen, fCentBin),mcore,ptcore2) ;
       }
       if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth2_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth2core_cen, fCentBin),mcore,ptcore1) ;
       }
       if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-        FillHistogram(Form("hSingleBoth2_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth2_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHSingleBoth2core_cen, fCentBin),mcore,ptcore2) ;
       }
 
 
       if(a<kAlphaCut){
-        FillHistogram(Form("hPi0All_a07_cen%d",fCentBin),m,pt) ;
+        FillHistogram(fHistograms.Get(kHPi0All_a07_cen, fCentBin),m,pt) ;
       }
 
       if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	snprintf(key,55,"hMassPtCPV_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ACPV_cen, fCentBin),m,pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CCPV_cen, fCentBin),m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCCPV_cen, fCentBin),m,pt,dphiT) ;
 
-	FillHistogram(Form("hMassPtV0ACPVcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPVcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ACPVcore_cen, fCentBin),mcore,ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CCPVcore_cen, fCentBin),mcore,ptcore,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPVcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCCPVcore_cen, fCentBin),mcore,ptcore,dphiT) ;
 
-	FillHistogram(Form("hPi0CPV_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
+	FillHistogram(fHistograms.Get(kHPi0CPV_cen, fCentBin),m,pt) ;
+	FillHistogram(fHistograms.Get(kHPi0CPVcore_cen, fCentBin),mcore, ptcore) ;
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV_a07_cen%d",fCentBin),m,pt) ;
+          FillHistogram(fHistograms.Get(kHPi0CPV_a07_cen, fCentBin),m,pt) ;
         }
       }
       if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	FillHistogram(Form("hMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ACPV2_cen, fCentBin),m,pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CCPV2_cen, fCentBin),m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	FillHistogram(Form("hMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCCPV2_cen, fCentBin),m,pt,dphiT) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ACPV2core_cen, fCentBin),mcore,ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CCPV2core_cen, fCentBin),mcore,ptcore,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCCPV2core_cen, fCentBin),mcore,ptcore,dphiT) ;
 	
-	FillHistogram(Form("hPi0CPV2_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
+	FillHistogram(fHistograms.Get(kHPi0CPV2_cen, fCentBin),m,pt) ;
+	FillHistogram(fHistograms.Get(kHPi0CPV2core_cen, fCentBin),mcore, ptcore) ;
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
+          FillHistogram(fHistograms.Get(kHPi0CPV2_a07_cen, fCentBin),m,pt) ;
         }
       }
       if(ph1->IsDispOK() && ph2->IsDispOK()){
-	snprintf(key,55,"hMassPtDisp_cen%d",fCentBin) ;
-	FillHistogram(Form("hMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ADisp_cen, fCentBin),m,pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CDisp_cen, fCentBin),m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCDisp_cen, fCentBin),m,pt,dphiT) ;
 	
-	FillHistogram(Form("hMassPtV0ADispcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDispcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ADispcore_cen, fCentBin),mcore, ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CDispcore_cen, fCentBin),mcore, ptcore,dphiC) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDispcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHMassPtTPCDispcore_cen, fCentBin),mcore, ptcore,dphiT) ;
 
-	FillHistogram(Form("hPi0Disp_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hPi0Dispcore_cen%d",fCentBin),mcore, ptcore) ;
+	FillHistogram(fHistograms.Get(kHPi0Disp_cen, fCentBin),m,pt) ;
+	FillHistogram(fHistograms.Get(kHPi0Dispcore_cen, fCentBin),mcore, ptcore) ;
 	
 	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hPi0Dispwou_cen%d",fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHPi0Dispwou_cen, fCentBin),m,pt) ;
 
-	  FillHistogram(Form("hMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
- 	  FillHistogram(Form("hMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0ADispwou_cen, fCentBin),m,pt,dphiA) ;
+ 	  FillHistogram(fHistograms.Get(kHMassPtV0CDispwou_cen, fCentBin),m,pt,dphiC) ;
 	  if(fHaveTPCRP)
-  	    FillHistogram(Form("hMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
+  	    FillHistogram(fHistograms.Get(kHMassPtTPCDispwou_cen, fCentBin),m,pt,dphiT) ;
 	}
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hPi0Disp_a07_cen%d",fCentBin),m,pt) ;
+          FillHistogram(fHistograms.Get(kHPi0Disp_a07_cen, fCentBin),m,pt) ;
         }
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0ABoth_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0CBoth_cen, fCentBin),m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMassPtTPCBoth_cen, fCentBin),m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMassPtV0ABothcore_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBothcore_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0ABothcore_cen, fCentBin),mcore,ptcore,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0CBothcore_cen, fCentBin),mcore,ptcore,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBothcore_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMassPtTPCBothcore_cen, fCentBin),mcore,ptcore,dphiT) ;
 
-	  FillHistogram(Form("hPi0Both_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Bothcore_cen%d",fCentBin),mcore,ptcore) ;
+	  FillHistogram(fHistograms.Get(kHPi0Both_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHPi0Bothcore_cen, fCentBin),mcore,ptcore) ;
 
           if(a<kAlphaCut){
-            snprintf(key,55,"hPi0Both_a07_cen%d",fCentBin) ;
-            FillHistogram(Form("hPi0Both_a07_cen%d",fCentBin),m,pt) ;
+            FillHistogram(fHistograms.Get(kHPi0Both_a07_cen, fCentBin),m,pt) ;
           }
           if(ph1->Module()==1 && ph2->Module()==1)
-	    FillHistogram("hPi0M11",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M11),m,pt );
           else if(ph1->Module()==2 && ph2->Module()==2)
-	    FillHistogram("hPi0M22",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M22),m,pt );
           else if(ph1->Module()==3 && ph2->Module()==3)
-	    FillHistogram("hPi0M33",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M33),m,pt );
           else if(ph1->Module()==4 && ph2->Module()==4)
-	    FillHistogram("hPi0M44",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M44),m,pt );
           else if(ph1->Module()==1 && ph2->Module()==2)
-	    FillHistogram("hPi0M12",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M12),m,pt );
           else if(ph1->Module()==1 && ph2->Module()==3)
-	    FillHistogram("hPi0M13",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M13),m,pt );
           else if(ph1->Module()==1 && ph2->Module()==4)
-	    FillHistogram("hPi0M14",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M14),m,pt );
           else if(ph1->Module()==2 && ph2->Module()==3)
-	    FillHistogram("hPi0M23",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M23),m,pt );
           else if(ph1->Module()==2 && ph2->Module()==4)
-	    FillHistogram("hPi0M24",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M24),m,pt );
           else if(ph1->Module()==3 && ph2->Module()==4)
-	    FillHistogram("hPi0M34",m,pt );
+	    FillHistogram(fHistograms.Get(kHPi0M34),m,pt );
         }
 	
       }
       
       
       if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	FillHistogram(Form("hPi0Disp2_cen%d",fCentBin),m,pt) ;
-  	FillHistogram(Form("hPi0Disp2core_cen%d",fCentBin),mcore, ptcore) ;	
+	FillHistogram(fHistograms.Get(kHPi0Disp2_cen, fCentBin),m,pt) ;
+  	FillHistogram(fHistograms.Get(kHPi0Disp2core_cen, fCentBin),mcore, ptcore) ;	
 
-	FillHistogram(Form("hMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ADisp2_cen, fCentBin),m,pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CDisp2_cen, fCentBin),m,pt,dphiC) ;
 	if(fHaveTPCRP)
-  	  FillHistogram(Form("hMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
+  	  FillHistogram(fHistograms.Get(kHMassPtTPCDisp2_cen, fCentBin),m,pt,dphiT) ;
 
-	FillHistogram(Form("hMassPtV0ADisp2core_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	FillHistogram(Form("hMassPtV0CDisp2core_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0ADisp2core_cen, fCentBin),mcore, ptcore,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMassPtV0CDisp2core_cen, fCentBin),mcore, ptcore,dphiC) ;
 	if(fHaveTPCRP)
-	  FillHistogram(Form("hMassPtTPCDisp2core_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHMassPtTPCDisp2core_cen, fCentBin),mcore, ptcore,dphiT) ;
 	  
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0ABoth2_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0CBoth2_cen, fCentBin),m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMassPtTPCBoth2_cen, fCentBin),m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMassPtV0ABoth2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMassPtV0CBoth2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0ABoth2core_cen, fCentBin),mcore,ptcore,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMassPtV0CBoth2core_cen, fCentBin),mcore,ptcore,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMassPtTPCBoth2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMassPtTPCBoth2core_cen, fCentBin),mcore,ptcore,dphiT) ;
 
-	  FillHistogram(Form("hPi0Both2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hPi0Both2core_cen%d",fCentBin),mcore,ptcore) ;
+	  FillHistogram(fHistograms.Get(kHPi0Both2_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHPi0Both2core_cen, fCentBin),mcore,ptcore) ;
 	}
 
       }
@@ -1175,7 +1786,6 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0s()
 //_____________________________________________________________________________
 void AliAnalysisTaskPi0Flow::ConsiderPi0sMix()
 {
-  char key[55];
 
   TList * arrayList = GetCaloPhotonsPHOSList(fVtxBin, fCentBin, fEMRPBin);
 
@@ -1211,218 +1821,213 @@ void AliAnalysisTaskPi0Flow::ConsiderPi0sMix()
         Double_t ptcore1=ph1->GetMomV2()->Pt() ;
         Double_t ptcore2=ph2->GetMomV2()->Pt() ;
 
-	snprintf(key,55,"hMiMassPtAll_cen%d",fCentBin) ; // probably not needed, consider removing this line!
 	if( fFillWideTOF ) {
-	  FillHistogram(Form("hMiPi0WideTOF_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt1) ;
-	  FillHistogram(Form("hMiSingleWideTOF_cen%d",fCentBin),m,pt2) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0WideTOF_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHMiSingleWideTOF_cen, fCentBin),m,pt1) ;
+	  FillHistogram(fHistograms.Get(kHMiSingleWideTOF_cen, fCentBin),m,pt2) ;
 	  if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCWideTOF_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtTPCWideTOF_cen, fCentBin),m,pt,dphiT) ;
 	}
 
 	if( fTOFCutEnabled && !(ph1->IsTOFOK() && ph2->IsTOFOK()) )
 	  continue;
 
-	FillHistogram(Form("hMiMassPtV0AAll_cen%d",fCentBin),m,pt,dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAll_cen%d",fCentBin),m,pt,dphiC) ;
+	FillHistogram(fHistograms.Get(kHMiMassPtV0AAll_cen, fCentBin),m,pt,dphiA) ;
+	FillHistogram(fHistograms.Get(kHMiMassPtV0CAll_cen, fCentBin),m,pt,dphiC) ;
 	if(fHaveTPCRP)
- 	  FillHistogram(Form("hMiMassPtTPCAll_cen%d",fCentBin),m,pt,dphiT) ;
+ 	  FillHistogram(fHistograms.Get(kHMiMassPtTPCAll_cen, fCentBin),m,pt,dphiT) ;
 
-	FillHistogram(Form("hMiMassPtV0AAllcore_cen%d",fCentBin),mcore, ptcore, dphiA) ;
-	FillHistogram(Form("hMiMassPtV0CAllcore_cen%d",fCentBin),mcore, ptcore, dphiC) ;
+	FillHistogram(fHistograms.Get(kHMiMassPtV0AAllcore_cen, fCentBin),mcore, ptcore, dphiA) ;
+	FillHistogram(fHistograms.Get(kHMiMassPtV0CAllcore_cen, fCentBin),mcore, ptcore, dphiC) ;
         if(fHaveTPCRP)
-	  FillHistogram(Form("hMiMassPtTPCAllcore_cen%d",fCentBin),mcore, ptcore, dphiT) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtTPCAllcore_cen, fCentBin),mcore, ptcore, dphiT) ;
 
-	FillHistogram(Form("hMiPi0All_cen%d",fCentBin),m,pt) ;
-	FillHistogram(Form("hMiPi0Allcore_cen%d",fCentBin),mcore,ptcore) ;
+	FillHistogram(fHistograms.Get(kHMiPi0All_cen, fCentBin),m,pt) ;
+	FillHistogram(fHistograms.Get(kHMiPi0Allcore_cen, fCentBin),mcore,ptcore) ;
 	if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	  FillHistogram(Form("hMiPi0Allwou_cen%d",fCentBin),m,pt) ;
-          FillHistogram(Form("hMiMassPtV0AAllwou_cen%d",fCentBin),m,pt,dphiA) ;
-          FillHistogram(Form("hMiMassPtV0CAllwou_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0Allwou_cen, fCentBin),m,pt) ;
+          FillHistogram(fHistograms.Get(kHMiMassPtV0AAllwou_cen, fCentBin),m,pt,dphiA) ;
+          FillHistogram(fHistograms.Get(kHMiMassPtV0CAllwou_cen, fCentBin),m,pt,dphiC) ;
           if(fHaveTPCRP)
-            FillHistogram(Form("hMiMassPtTPCAllwou_cen%d",fCentBin),m,pt,dphiT) ;
+            FillHistogram(fHistograms.Get(kHMiMassPtTPCAllwou_cen, fCentBin),m,pt,dphiT) ;
 	}
 
-	FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt1) ;
-        FillHistogram(Form("hMiSingleAll_cen%d",fCentBin),m,pt2) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore1) ;
-        FillHistogram(Form("hMiSingleAllcore_cen%d",fCentBin),mcore,ptcore2) ;
+	FillHistogram(fHistograms.Get(kHMiSingleAll_cen, fCentBin),m,pt1) ;
+        FillHistogram(fHistograms.Get(kHMiSingleAll_cen, fCentBin),m,pt2) ;
+        FillHistogram(fHistograms.Get(kHMiSingleAllcore_cen, fCentBin),mcore,ptcore1) ;
+        FillHistogram(fHistograms.Get(kHMiSingleAllcore_cen, fCentBin),mcore,ptcore2) ;
         if(ph1->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleAllwou_cen, fCentBin),m,pt1) ;
         if(ph2->IsntUnfolded())
-          FillHistogram(Form("hMiSingleAllwou_cen%d",fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleAllwou_cen, fCentBin),m,pt2) ;
         if(ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV_cen, fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPVcore_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleCPV_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPVcore_cen%d",fCentBin),mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV_cen, fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPVcore_cen, fCentBin),mcore,ptcore2) ;
         }
         if(ph1->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV2_cen, fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV2core_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsCPV2OK()){
-          FillHistogram(Form("hMiSingleCPV2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleCPV2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV2_cen, fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleCPV2core_cen, fCentBin),mcore,ptcore2) ;
         }
         if(ph1->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp_cen, fCentBin),m,pt1) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt1) ;
+            FillHistogram(fHistograms.Get(kHMiSingleDispwou_cen, fCentBin),m,pt1) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDispcore_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsDispOK()){
-          FillHistogram(Form("hMiSingleDisp_cen%d",fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp_cen, fCentBin),m,pt2) ;
           if(ph1->IsntUnfolded()){
-            FillHistogram(Form("hMiSingleDispwou_cen%d",fCentBin),m,pt2) ;
+            FillHistogram(fHistograms.Get(kHMiSingleDispwou_cen, fCentBin),m,pt2) ;
 	  }
-          FillHistogram(Form("hMiSingleDispcore_cen%d",fCentBin),mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDispcore_cen, fCentBin),mcore,ptcore2) ;
         }
         if(ph1->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp2_cen, fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp2core_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsDisp2OK()){
-          FillHistogram(Form("hMiSingleDisp2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleDisp2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp2_cen, fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleDisp2core_cen, fCentBin),mcore,ptcore2) ;
         }
         if(ph1->IsDispOK() && ph1->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt1) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth_cen, fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBothcore_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsDispOK() && ph2->IsCPVOK()){
-          snprintf(key,55,"hMiSingleBoth_cen%d",fCentBin) ;
-          FillHistogram(key,m,pt2) ;
-          snprintf(key,55,"hMiSingleBothcore_cen%d",fCentBin) ;
-          FillHistogram(key,mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth_cen, fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBothcore_cen, fCentBin),mcore,ptcore2) ;
         }
         if(ph1->IsDisp2OK() && ph1->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt1) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth2_cen, fCentBin),m,pt1) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth2core_cen, fCentBin),mcore,ptcore1) ;
         }
         if(ph2->IsDisp2OK() && ph2->IsCPVOK()){
-          FillHistogram(Form("hMiSingleBoth2_cen%d",fCentBin),m,pt2) ;
-          FillHistogram(Form("hMiSingleBoth2core_cen%d",fCentBin),mcore,ptcore2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth2_cen, fCentBin),m,pt2) ;
+          FillHistogram(fHistograms.Get(kHMiSingleBoth2core_cen, fCentBin),mcore,ptcore2) ;
         }
 
 
 
         if(a<kAlphaCut){
-          FillHistogram(Form("hMiPi0All_a07_cen%d",fCentBin),m,pt) ;
+          FillHistogram(fHistograms.Get(kHMiPi0All_a07_cen, fCentBin),m,pt) ;
         }
 	if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	  FillHistogram(Form("hMiMassPtV0ACPV_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ACPV_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CCPV_cen, fCentBin),m,pt,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV_cen%d",fCentBin),m,pt,dphiT) ;
+ 	    FillHistogram(fHistograms.Get(kHMiMassPtTPCCPV_cen, fCentBin),m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ACPVcore_cen%d",fCentBin),mcore, ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPVcore_cen%d",fCentBin),mcore, ptcore,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ACPVcore_cen, fCentBin),mcore, ptcore,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CCPVcore_cen, fCentBin),mcore, ptcore,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPVcore_cen%d",fCentBin),mcore, ptcore,dphiT) ;
+ 	    FillHistogram(fHistograms.Get(kHMiMassPtTPCCPVcore_cen, fCentBin),mcore, ptcore,dphiT) ;
 
-	  FillHistogram(Form("hMiPi0CPV_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPVcore_cen%d",fCentBin),mcore, ptcore) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0CPV_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0CPVcore_cen, fCentBin),mcore, ptcore) ;
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV_a07_cen%d",fCentBin),m,pt) ;
+            FillHistogram(fHistograms.Get(kHMiPi0CPV_a07_cen, fCentBin),m,pt) ;
           }
 	}
 	if(ph1->IsCPV2OK() && ph2->IsCPV2OK()){
-	  FillHistogram(Form("hMiPi0CPV2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0CPV2core_cen%d",fCentBin),mcore, ptcore) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0CPV2_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0CPV2core_cen, fCentBin),mcore, ptcore) ;
 
-	  FillHistogram(Form("hMiMassPtV0ACPV2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ACPV2_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CCPV2_cen, fCentBin),m,pt,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2_cen%d",fCentBin),m,pt,dphiT) ;
-	  FillHistogram(Form("hMiMassPtV0ACPV2core_cen%d",fCentBin),mcore,ptcore,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CCPV2core_cen%d",fCentBin),mcore,ptcore,dphiC) ;
+ 	    FillHistogram(fHistograms.Get(kHMiMassPtTPCCPV2_cen, fCentBin),m,pt,dphiT) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ACPV2core_cen, fCentBin),mcore,ptcore,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CCPV2core_cen, fCentBin),mcore,ptcore,dphiC) ;
 	  if(fHaveTPCRP)
- 	    FillHistogram(Form("hMiMassPtTPCCPV2core_cen%d",fCentBin),mcore,ptcore,dphiT) ;
+ 	    FillHistogram(fHistograms.Get(kHMiMassPtTPCCPV2core_cen, fCentBin),mcore,ptcore,dphiT) ;
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0CPV2_a07_cen%d",fCentBin),m,pt) ;
+            FillHistogram(fHistograms.Get(kHMiPi0CPV2_a07_cen, fCentBin),m,pt) ;
           }
 	}
 	if(ph1->IsDispOK() && ph2->IsDispOK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ADisp_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CDisp_cen, fCentBin),m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtTPCDisp_cen, fCentBin),m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ADispcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CDispcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDispcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtTPCDispcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
 
 
-	  FillHistogram(Form("hMiPi0Disp_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Dispcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0Disp_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0Dispcore_cen, fCentBin),pv12.M(),pv12.Pt()) ;
           if(ph1->IsntUnfolded() && ph2->IsntUnfolded()){
-	    FillHistogram(Form("hMiPi0Dispwou_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiMassPtV0ADispwou_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CDispwou_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillHistogram(fHistograms.Get(kHMiPi0Dispwou_cen, fCentBin),m,pt) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0ADispwou_cen, fCentBin),m,pt,dphiA) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0CDispwou_cen, fCentBin),m,pt,dphiC) ;
             if(fHaveTPCRP)
-	      FillHistogram(Form("hMiMassPtTPCDispwou_cen%d",fCentBin),m,pt,dphiT) ;
+	      FillHistogram(fHistograms.Get(kHMiMassPtTPCDispwou_cen, fCentBin),m,pt,dphiT) ;
 	  }
 
 	  if(a<kAlphaCut){
-            FillHistogram(Form("hMiPi0Disp_a07_cen%d",fCentBin),m,pt) ;
+            FillHistogram(fHistograms.Get(kHMiPi0Disp_a07_cen, fCentBin),m,pt) ;
           }
 	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0ABoth_cen, fCentBin),m,pt,dphiA) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0CBoth_cen, fCentBin),m,pt,dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth_cen%d",fCentBin),m,pt,dphiT) ;
+  	      FillHistogram(fHistograms.Get(kHMiMassPtTPCBoth_cen, fCentBin),m,pt,dphiT) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0ABothcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0CBothcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBothcore_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+  	      FillHistogram(fHistograms.Get(kHMiMassPtTPCBothcore_cen, fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
 
-	    FillHistogram(Form("hMiPi0Both_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Bothcore_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	    FillHistogram(fHistograms.Get(kHMiPi0Both_cen, fCentBin),m,pt) ;
+	    FillHistogram(fHistograms.Get(kHMiPi0Bothcore_cen, fCentBin),pv12.M(),pv12.Pt()) ;
 
 	    if(a<kAlphaCut){
-              FillHistogram(Form("hMiPi0Both_a07_cen%d",fCentBin),m,pt) ;
+              FillHistogram(fHistograms.Get(kHMiPi0Both_a07_cen, fCentBin),m,pt) ;
             }
 	  }
 	}
 	
   	if(ph1->IsDisp2OK() && ph2->IsDisp2OK()){
-	  FillHistogram(Form("hMiMassPtV0ADisp2_cen%d",fCentBin),m,pt,dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2_cen%d",fCentBin),m,pt,dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ADisp2_cen, fCentBin),m,pt,dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CDisp2_cen, fCentBin),m,pt,dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2_cen%d",fCentBin),m,pt,dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtTPCDisp2_cen, fCentBin),m,pt,dphiT) ;
 
-	  FillHistogram(Form("hMiMassPtV0ADisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	  FillHistogram(Form("hMiMassPtV0CDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0ADisp2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
+	  FillHistogram(fHistograms.Get(kHMiMassPtV0CDisp2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
           if(fHaveTPCRP)
-	    FillHistogram(Form("hMiMassPtTPCDisp2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtTPCDisp2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
 
 
-	  FillHistogram(Form("hMiPi0Disp2_cen%d",fCentBin),m,pt) ;
-	  FillHistogram(Form("hMiPi0Disp2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0Disp2_cen, fCentBin),m,pt) ;
+	  FillHistogram(fHistograms.Get(kHMiPi0Disp2core_cen, fCentBin),pv12.M(),pv12.Pt()) ;
 
 	  if(ph1->IsCPVOK() && ph2->IsCPVOK()){
-	    FillHistogram(Form("hMiMassPtV0ABoth2_cen%d",fCentBin),m,pt,dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2_cen%d",fCentBin),m,pt,dphiC) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0ABoth2_cen, fCentBin),m,pt,dphiA) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0CBoth2_cen, fCentBin),m,pt,dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2_cen%d",fCentBin),m,pt,dphiT) ;
+  	      FillHistogram(fHistograms.Get(kHMiMassPtTPCBoth2_cen, fCentBin),m,pt,dphiT) ;
 
-	    FillHistogram(Form("hMiMassPtV0ABoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
-	    FillHistogram(Form("hMiMassPtV0CBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0ABoth2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiA) ;
+	    FillHistogram(fHistograms.Get(kHMiMassPtV0CBoth2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiC) ;
 	    if(fHaveTPCRP)
-  	      FillHistogram(Form("hMiMassPtTPCBoth2core_cen%d",fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
+  	      FillHistogram(fHistograms.Get(kHMiMassPtTPCBoth2core_cen, fCentBin),pv12.M(),pv12.Pt(),dphiT) ;
 
-	    FillHistogram(Form("hMiPi0Both2_cen%d",fCentBin),m,pt) ;
-	    FillHistogram(Form("hMiPi0Both2core_cen%d",fCentBin),pv12.M(),pv12.Pt()) ;
+	    FillHistogram(fHistograms.Get(kHMiPi0Both2_cen, fCentBin),m,pt) ;
+	    FillHistogram(fHistograms.Get(kHMiPi0Both2core_cen, fCentBin),pv12.M(),pv12.Pt()) ;
 
 	  }
 	}
@@ -1503,6 +2108,41 @@ void AliAnalysisTaskPi0Flow::FillHistogram(const char * key,Double_t x,Double_t
   AliError(Form("can not find histogram (of instance TH3) <%s> ",key)) ;
 }
 
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillHistogram(TH1 * hist,Double_t x)const{
+  //Fills histogram of fHistograms (0 if not found, reported by fHistograms)
+  if(hist)
+    hist->Fill(x) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillHistogram(TH1 * hist,Double_t x,Double_t y)const{
+  //Fills histogram of fHistograms (0 if not found, reported by fHistograms)
+  if(hist)
+    hist->Fill(x, y) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillHistogram(TH1 * hist,Double_t x,Double_t y, Double_t z) const{
+  //Fills 2D (weighted) or 3D histogram of fHistograms
+  if(!hist)
+    return;
+  if(hist->GetDimension() == 2)
+    static_cast<TH2*>(hist)->Fill(x, y, z) ;
+  else if(hist->GetDimension() == 3)
+    static_cast<TH3*>(hist)->Fill(x, y, z) ;
+  else
+    AliError(Form("can not find histogram (of instance TH2) <%s> ",hist->GetName())) ;
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPi0Flow::FillHistogram(TH1 * hist,Double_t x,Double_t y, Double_t z, Double_t w) const{
+  //Fills 3D histogram of fHistograms
+  if(!hist)
+    return;
+  if(hist->GetDimension() == 3)
+    static_cast<TH3*>(hist)->Fill(x, y, z, w) ;
+  else
+    AliError(Form("can not find histogram (of instance TH3) <%s> ",hist->GetName())) ;
+}
+
 
 //_____________________________________________________________________________
 AliVEvent* AliAnalysisTaskPi0Flow::GetEvent()
@@ -1585,8 +2225,8 @@ void AliAnalysisTaskPi0Flow::LogProgress(int step)
     AliInfo(Form("step %d completed", step));
   }
   // the +0.5 is not realy neccisarry, but oh well... -henrik
-  //FillHistogram("hSelEvents", step+0.5, internalRunNumber-0.5);
-  //FillHistogram("hTotSelEvents", step+0.5);
+  //FillHistogram(fHistograms.Get(kHSelEvents), step+0.5, internalRunNumber-0.5);
+  //FillHistogram(fHistograms.Get(kHTotSelEvents), step+0.5);
 }
 
 void AliAnalysisTaskPi0Flow::LogSelection(int step, int internalRunNumber)
@@ -1595,8 +2235,8 @@ void AliAnalysisTaskPi0Flow::LogSelection(int step, int internalRunNumber)
   //   AliInfo(Form("step %d completed", step));
   // }
   // the +0.5 is not realy neccisarry, but oh well... -henrik
-  FillHistogram("hSelEvents", step+0.5, internalRunNumber-0.5);
-  FillHistogram("hTotSelEvents", step+0.5);
+  FillHistogram(fHistograms.Get(kHSelEvents), step+0.5, internalRunNumber-0.5);
+  FillHistogram(fHistograms.Get(kHTotSelEvents), step+0.5);
 }
 
 
@@ -2645,7 +3285,7 @@ void AliAnalysisTaskPi0Flow::SetVertex()
     fVertex[2] = 0;
   }
   fVertexVector = TVector3(fVertex);
-  FillHistogram("hZvertex", fVertexVector.z(), fInternalRunNumber-0.5);
+  FillHistogram(fHistograms.Get(kHZvertex), fVertexVector.z(), fInternalRunNumber-0.5);
   
   if( fDebug >= 2 )
     AliInfo(Form("Vertex is set to (%.1f,%.1f,%.1f)", fVertex[0], fVertex[1], fVertex[2]));
@@ -2684,7 +3324,7 @@ void AliAnalysisTaskPi0Flow::SetCentrality()
     AliError("Event has 0x0 centrality");
     fCentrality = -1.;
   }
-  FillHistogram("hCentrality",fCentrality,fInternalRunNumber-0.5) ;
+  FillHistogram(fHistograms.Get(kHCentrality),fCentrality,fInternalRunNumber-0.5) ;
 
   fCentBin = GetCentralityBin(fCentrality);
 
@@ -2710,7 +3350,7 @@ void AliAnalysisTaskPi0Flow::SetCentralityRun2()
         fCentrality = MultSelection->GetMultiplicityPercentile(fCentralityEstimator);
     }
     
-    FillHistogram("hCentrality",fCentrality,fInternalRunNumber-0.5) ;
+    FillHistogram(fHistograms.Get(kHCentrality),fCentrality,fInternalRunNumber-0.5) ;
     fCentBin = GetCentralityBin(fCentrality);
     
     if ( fDebug >= 2 )
@@ -2761,7 +3401,7 @@ void AliAnalysisTaskPi0Flow::EvalReactionPlane()
   if( ! eventPlane ) { AliError("Event has no event plane"); return; }
   
   Double_t reactionPlaneQ = eventPlane->GetEventplane("Q");
-  FillHistogram("phiRP",reactionPlaneQ,fCentrality) ;
+  FillHistogram(fHistograms.Get(kHPhiRP),reactionPlaneQ,fCentrality) ;
 
   if(reactionPlaneQ==999 || reactionPlaneQ < 0.){ //reaction plain was not defined
     if( fDebug ) AliInfo(Form("No Q Reaction Plane, value is %f", reactionPlaneQ));
@@ -2777,9 +3417,9 @@ void AliAnalysisTaskPi0Flow::EvalReactionPlane()
 
     while(fRP<0)  fRP+=TMath::Pi();
     while(fRP>TMath::Pi())  fRP-=TMath::Pi();
-    FillHistogram("phiRPflat",fRP,fCentrality) ;
+    FillHistogram(fHistograms.Get(kHPhiRPflat),fRP,fCentrality) ;
     Double_t dPsi = eventPlane->GetQsubRes() ;
-    FillHistogram("cos2AC",TMath::Cos(2.*dPsi),fCentrality) ;
+    FillHistogram(fHistograms.Get(kHCos2AC),TMath::Cos(2.*dPsi),fCentrality) ;
   }
   else
     fRP=0.;
@@ -2865,9 +3505,9 @@ void  AliAnalysisTaskPi0Flow::EvalV0ReactionPlane(){
   if( fDebug >= 2 )
     AliInfo(Form("V0 Reaction Plane before flattening: A side: %f, C side: %f", fRPV0A, fRPV0C));
 
-  FillHistogram("phiRPV0A" ,fRPV0A,fCentrality);
-  FillHistogram("phiRPV0C" ,fRPV0C,fCentrality);
-  FillHistogram("phiRPV0AC",fRPV0A,fRPV0C,fCentrality) ;
+  FillHistogram(fHistograms.Get(kHPhiRPV0A),fRPV0A,fCentrality);
+  FillHistogram(fHistograms.Get(kHPhiRPV0C),fRPV0C,fCentrality);
+  FillHistogram(fHistograms.Get(kHPhiRPV0AC),fRPV0A,fRPV0C,fCentrality) ;
 
   // Flattening
   fRPV0A=ApplyFlatteningV0A(fRPV0A,fCentrality) ;
@@ -2881,17 +3521,17 @@ void  AliAnalysisTaskPi0Flow::EvalV0ReactionPlane(){
   if( fDebug >= 2 )
     AliInfo(Form("V0 Reaction Plane after  flattening: A side: %f, C side: %f", fRPV0A, fRPV0C));
 
-  FillHistogram("phiRPV0Aflat",fRPV0A,fCentrality) ;
-  FillHistogram("cos2V0AC",TMath::Cos(2.*(fRPV0A-fRPV0C)),fCentrality) ;
+  FillHistogram(fHistograms.Get(kHPhiRPV0Aflat),fRPV0A,fCentrality) ;
+  FillHistogram(fHistograms.Get(kHCos2V0AC),TMath::Cos(2.*(fRPV0A-fRPV0C)),fCentrality) ;
   if(fHaveTPCRP){
-    FillHistogram("phiRPV0ATPC",fRP,fRPV0A,fCentrality) ;
-    FillHistogram("cos2V0ATPC",TMath::Cos(2.*(fRP-fRPV0A)),fCentrality) ;
+    FillHistogram(fHistograms.Get(kHPhiRPV0ATPC),fRP,fRPV0A,fCentrality) ;
+    FillHistogram(fHistograms.Get(kHCos2V0ATPC),TMath::Cos(2.*(fRP-fRPV0A)),fCentrality) ;
   }
 
-  FillHistogram("phiRPV0Cflat",fRPV0C,fCentrality) ;
+  FillHistogram(fHistograms.Get(kHPhiRPV0Cflat),fRPV0C,fCentrality) ;
   if(fHaveTPCRP){
-    FillHistogram("phiRPV0CTPC",fRP,fRPV0C,fCentrality) ;
-    FillHistogram("cos2V0CTPC",TMath::Cos(2.*(fRP-fRPV0C)),fCentrality) ;
+    FillHistogram(fHistograms.Get(kHPhiRPV0CTPC),fRP,fRPV0C,fCentrality) ;
+    FillHistogram(fHistograms.Get(kHCos2V0CTPC),TMath::Cos(2.*(fRP-fRPV0C)),fCentrality) ;
   }
 }
 //____________________________________________________________________________
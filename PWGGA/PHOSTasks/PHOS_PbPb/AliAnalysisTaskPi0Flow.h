@@ -11,6 +11,7 @@
 /* $Id$ */
 
 class TObjArray;
+class TH1;
 class TH1F;
 class TH2I;
 class TH2F;
@@ -29,6 +30,7 @@ class AliAnalysisUtils;
 #include "TArrayD.h"
 
 #include "AliAnalysisTaskSE.h"
+#include "AliCaloHistogramTable.h"
 
 class AliAnalysisTaskPi0Flow : public AliAnalysisTaskSE {
 public:
@@ -128,6 +130,10 @@ protected:
     void FillHistogram(const char * key,Double_t x, Double_t y) const ; //Fill 2D histogram witn name key
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram witn name key
     void FillHistogram(const char * key,Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram witn name key
+    void FillHistogram(TH1 * hist,Double_t x) const ; //Fill 1D histogram of fHistograms
+    void FillHistogram(TH1 * hist,Double_t x, Double_t y) const ; //Fill 2D histogram of fHistograms
+    void FillHistogram(TH1 * hist,Double_t x, Double_t y, Double_t z) const ; //Fill 3D histogram of fHistograms
+    void FillHistogram(TH1 * hist,Double_t x, Double_t y, Double_t z, Double_t w) const ; //Fill 3D histogram of fHistograms
 
     TVector3 GetVertexVector(const AliVVertex* vertex);
     Int_t GetCentralityBin(Float_t centralityV0M);
@@ -187,6 +193,7 @@ protected:
   
 
     TList * fOutputContainer;        //final histogram container
+    AliCaloHistogramTable fHistograms; //! histograms of fOutputContainer filled in the event loop, by handle
 
     TF1 *fNonLinCorr;          // Non-linearity correction
 //TF1 * fRecent[5][12] ;//Recentering corrections
@@ -241,7 +248,7 @@ protected:
     TObjArray* fCaloPhotonsPHOSLists; //! array of TList, Containers for events with PHOS photons
 
 
-    ClassDef(AliAnalysisTaskPi0Flow, 3); // PHOS analysis task
+    ClassDef(AliAnalysisTaskPi0Flow, 4); // PHOS analysis task
 };
 
 #endif
@@ -80,6 +80,548 @@
 
 ClassImp(AliAnalysisTaskPHOSPi0EtaToGammaGamma)
 
+namespace {
+  // Generated particles (MC), in the order of their histograms
+  enum EGenParticle_t {
+    kGenPi0, kGenEta, kGenGamma, kGenOmega, kGenChargedPion, kGenChargedKaon, kGenK0S, kGenK0L,
+    kGenLambda0, kGenSigma0, kGenProton, kGenAntiProton, kGenNeutron, kGenAntiNeutron,
+    kNGenParticles
+  };
+  const char * gkGenParticleNames[kNGenParticles] = {
+    "Pi0","Eta","Gamma","Omega","ChargedPion","ChargedKaon","K0S","K0L",
+    "Lambda0","Sigma0","Proton","AntiProton","Neutron","AntiNeutron"
+  };
+
+  // Trigger types of the matched cluster energy, index L1+1
+  const char * gkTriggerTypeNames[4] = {"L0","L1H","L1M","L1L"};
+
+  // Handles of the histograms filled in the event loop (see AliCaloHistogramTable)
+  enum EHistogram_t {
+    kHNTrial,
+    kHEventSummary,
+    kHVertexZ,
+    kHCentralityvsNContributor,
+    kHCentralityV0MvsCL0,
+    kHCentralityV0MvsCL1,
+    kHCentralityCL0vsCL1,
+    kHCentralityV0AvsV0C,
+    kHCentralityZNAvsZNC,
+    kHVertexZSelectEvent,
+    kHCentralityvsPHOSClusterMultiplicityMC,
+    kHTrackTPCdEdx,
+    kHHybridTrackPt,
+    kHHybridTrackEtaPhi,
+    kHGlobalTrackPt,
+    kHGlobalTrackEtaPhi,
+    kHComplementaryTrackPt,
+    kHComplementaryTrackEtaPhi,
+    kHGlobalNoDCATrackPt,
+    kHGlobalNoDCATrackEtaPhi,
+    kHGlobalNoDCATrackDCA,
+    kHGlobalNoDCATrackTPCdEdx,
+    kHGlobalTrackDCA,
+    kHGlobalTrackTPCdEdx,
+    kHGlobalTrackMult,
+    kHGlobalNoDCATrackMult,
+    kHCentralityvsTrackMultiplicity,
+    kHCentralityvsSPDTracklet,
+    kHCellAmpTimeM_HG,
+    kHCellAmpTimeM_LG,
+    kHCellNXZM,
+    kHCellEXZM,
+    kHCellMultEventM1,
+    kHCellMultEventM2,
+    kHCellMultEventM3,
+    kHCellMultEventM4,
+    kHNFiredTRUChannel,
+    kHPHI7Summary,
+    kHFiredTRUChannelM,
+    kHDistanceXZMTRU,
+    kHDeltaRMTRU,
+    kHClusterEnergyM,
+    kHClusterEnergyMTRU,
+    kHClusterHitM,
+    kHMatchedFiredTRUChannelM,
+    kHMatchedDistanceXZMTRU,
+    kHMatchedDeltaRMTRU,
+    kHMatchedClusterEnergyM,
+    kHMatchedClusterEnergyMTRU,
+    kHMatchedClusterHitM,
+    kHAllClusterEnergy,
+    kHEnergyvsDistanceToBadChannel,
+    kHClusterEtaPhi,
+    kHClusterEvsTM,
+    kHCluNXZM,
+    kHCluEXZM,
+    kHClusterEvsN,
+    kHClusterEvsM02,
+    kHClusterEvsM20,
+    kHFullDispvsFullE,
+    kHCoreDispvsCoreE,
+    kHFullDispvsCoreE,
+    kHCoreDispvsFullE,
+    kHPHOSClusterEnergyM,
+    kHCluNXZTOFM,
+    kHCluEXZTOFM,
+    kHPHOSClusterEnergyTOFM,
+    kHCluLowNXZM,
+    kHCluLowEXZM,
+    kHCluHighNXZM,
+    kHCluHighEXZM,
+    kHPHOSClusterMultM1,
+    kHPHOSClusterMultM2,
+    kHPHOSClusterMultM3,
+    kHPHOSClusterMultM4,
+    kHPHOSClusterMultTOFM1,
+    kHPHOSClusterMultTOFM2,
+    kHPHOSClusterMultTOFM3,
+    kHPHOSClusterMultTOFM4,
+    kHCentralityvsPHOSClusterMultiplicity,
+    kHCentralityvsPHOSClusterMultiplicityTOF,
+    kHPHOSClusterMultiplicityvsTrackMultiplicity,
+    kHPHOSClusterMultiplicityTOFvsTrackMultiplicity,
+    kHMultiplicityV0AvsPHOSClusterMultiplicity,
+    kHMultiplicityV0CvsPHOSClusterMultiplicity,
+    kHMultiplicityV0vsPHOSClusterMultiplicity,
+    kHMultiplicityV0AvsPHOSClusterMultiplicityTOF,
+    kHMultiplicityV0CvsPHOSClusterMultiplicityTOF,
+    kHMultiplicityV0vsPHOSClusterMultiplicityTOF,
+    kHMultiplicityV0AvsTrackMultiplicity,
+    kHMultiplicityV0CvsTrackMultiplicity,
+    kHMultiplicityV0vsTrackMultiplicity,
+    kHPhotonPt_noPID,
+    kHPhotonPt_CPV,
+    kHPhotonPt_Disp,
+    kHPhotonPt_PID,
+    kHGammaFromK0S,
+    kHMggFromPi0,
+    kHMggFromPi0_asym08,
+    kHMggFromK0S,
+    kHMggFromK0S_asym08,
+    kHMggFromLambda0,
+    kHMggFromLambda0_asym08,
+    kHMgg_OA,
+    kHMgg_M,
+    kHMgg_M_TOF,
+    kHMixMgg_OA,
+    kHMixMgg_M,
+    kHMixMgg_M_TOF,
+    kHDZvsZvsTrackPt_M,
+    kHDXvsXvsTrackPt_plus_M,
+    kHDXvsXvsTrackPt_minus_M,
+    kHEpRatiovsNsigmaElectronTPC,
+    kHEpRatiovsEnergy_M_Electron,
+    kHEpRatiovsTrackPt_M_Electron,
+    kHTPCdEdx_Electron,
+    kHDZvsZvsTrackPtElectron_M,
+    kHEpRatiovsEnergy_M_Others,
+    kHEpRatiovsTrackPt_M_Others,
+    kHTPCdEdx_Others,
+    kHMgg_Probe_PID,
+    kHMgg_PassingProbe_CPV,
+    kHMgg_PassingProbe_Disp,
+    kHMgg_PassingProbe_PID,
+    kHMixMgg_Probe_PID,
+    kHMixMgg_PassingProbe_CPV,
+    kHMixMgg_PassingProbe_Disp,
+    kHMixMgg_PassingProbe_PID,
+    kHMgg_Probe_TOF,
+    kHMgg_PassingProbe_TOF,
+    kHMixMgg_Probe_TOF,
+    kHMixMgg_PassingProbe_TOF,
+    kHMatchedElectron,
+    kHMatchedPion,
+    kHMatchedKaon,
+    kHMatchedProton,
+    kHMatchedAntiProton,
+    kHMatchedElectron_Disp,
+    kHMatchedPion_Disp,
+    kHMatchedKaon_Disp,
+    kHMatchedProton_Disp,
+    kHMatchedAntiProton_Disp,
+    kHPurityGamma_noPID,
+    kHElectronRxy_noPID,
+    kHConvertedElectronRxy_noPID,
+    kHPurityElectron_noPID,
+    kHPurityLCE_noPID,
+    kHPurityPion_noPID,
+    kHPurityKaon_noPID,
+    kHPurityK0L_noPID,
+    kHPurityProton_noPID,
+    kHPurityAntiProton_noPID,
+    kHPurityNeutron_noPID,
+    kHPurityAntiNeutron_noPID,
+    kHPurityOthers_noPID,
+    kHPurityGamma_CPV,
+    kHElectronRxy_CPV,
+    kHConvertedElectronRxy_CPV,
+    kHPurityElectron_CPV,
+    kHPurityLCE_CPV,
+    kHPurityPion_CPV,
+    kHPurityKaon_CPV,
+    kHPurityK0L_CPV,
+    kHPurityProton_CPV,
+    kHPurityAntiProton_CPV,
+    kHPurityNeutron_CPV,
+    kHPurityAntiNeutron_CPV,
+    kHPurityOthers_CPV,
+    kHPurityGamma_Disp,
+    kHElectronRxy_Disp,
+    kHConvertedElectronRxy_Disp,
+    kHPurityElectron_Disp,
+    kHPurityLCE_Disp,
+    kHPurityPion_Disp,
+    kHPurityKaon_Disp,
+    kHPurityK0L_Disp,
+    kHPurityProton_Disp,
+    kHPurityAntiProton_Disp,
+    kHPurityNeutron_Disp,
+    kHPurityAntiNeutron_Disp,
+    kHPurityOthers_Disp,
+    kHPurityGamma_PID,
+    kHElectronRxy_PID,
+    kHConvertedElectronRxy_PID,
+    kHPurityElectron_PID,
+    kHPurityLCE_PID,
+    kHPurityPion_PID,
+    kHPurityKaon_PID,
+    kHPurityK0L_PID,
+    kHPurityProton_PID,
+    kHPurityAntiProton_PID,
+    kHPurityNeutron_PID,
+    kHPurityAntiNeutron_PID,
+    kHPurityOthers_PID,
+    kHClusterE_M_TRU,
+    kHTriggeredClusterE_M_TRU,
+    kHClusterE_TOF_M_TRU,
+    kHTriggeredClusterE_TOF_M_TRU,
+    kHMgg_Probe_Trg,
+    kHMgg_Probe_Trg_M_TRU,
+    kHMgg_PassingProbe_Trg,
+    kHMgg_PassingProbe_Trg_M_TRU,
+    kHMixMgg_Probe_Trg,
+    kHMixMgg_Probe_Trg_M_TRU,
+    kHMixMgg_PassingProbe_Trg,
+    kHMixMgg_PassingProbe_Trg_M_TRU,
+    kHPtHard,
+    kHPDGPhysicalPrimary,
+    kHPDGPhysicalPrimaryStable,
+    kHMgg_a_b,
+    kHMixMgg_a_b,
+    kHCentralityvsNormQ1,
+    kHCentralityvsNormQ2,
+    kHCentralityvsNormQ3,
+    kHCentralityvsQ1x,
+    kHCentralityvsQ1y,
+    kHCentralityvsQ2x,
+    kHCentralityvsQ2y,
+    kHCentralityvsQ3x,
+    kHCentralityvsQ3y,
+    kHCentralityvsSPQ1Q2,
+    kHCentralityvsSPQ2Q3,
+    kHCentralityvsSPQ3Q1,
+    kHCentralityvsCosDeltaEventPlane12,
+    kHCentralityvsCosDeltaEventPlane23,
+    kHCentralityvsCosDeltaEventPlane31,
+    kHCentralityvsSinDeltaEventPlane12,
+    kHCentralityvsSinDeltaEventPlane23,
+    kHCentralityvsSinDeltaEventPlane31,
+    kHRvsTrackPt_Electron,
+    kHRvsClusterPt_Electron,
+    kHRvsTrackPt_Pion,
+    kHRvsClusterPt_Pion,
+    kHRvsTrackPt_Kaon,
+    kHRvsClusterPt_Kaon,
+    kHRvsTrackPt_Proton,
+    kHRvsClusterPt_Proton,
+    kHRvsTrackPt_AntiProton,
+    kHRvsClusterPt_AntiProton,
+    kHRvsClusterPt,
+    kHMixRvsTrackPt,
+    kHMixRvsClusterPt,
+    kHMixRvsTrackPt_Electron,
+    kHMixRvsClusterPt_Electron,
+    kHMixRvsTrackPt_Pion,
+    kHMixRvsClusterPt_Pion,
+    kHMixRvsTrackPt_Kaon,
+    kHMixRvsClusterPt_Kaon,
+    kHMixRvsTrackPt_Proton,
+    kHMixRvsClusterPt_Proton,
+    kHMixRvsTrackPt_AntiProton,
+    kHMixRvsClusterPt_AntiProton,
+    kNHistograms,
+    // names built from run time strings, registered in UserCreateOutputObjects
+    kHGenPt = kNHistograms,                            // + EGenParticle_t
+    kHGenEtaPhi = kHGenPt + kNGenParticles,
+    kHGenEtaPt = kHGenEtaPhi + kNGenParticles,
+    kHGenPtACC = kHGenEtaPt + kNGenParticles,
+    kHGenEtaPhiACC = kHGenPtACC + kNGenParticles,
+    kHGenEtaPtACC = kHGenEtaPhiACC + kNGenParticles,
+    kHMatchedClusterEnergyType = kHGenEtaPtACC + kNGenParticles, // + L1+1
+    kHCentralityvsEventPlaneTPC = kHMatchedClusterEnergyType + 4,  // + sub detector
+    kHCentralityvsEventPlaneV0 = kHCentralityvsEventPlaneTPC + 3   // + sub detector
+  };
+
+  // Names of the histograms, %d: module, TRU or pT bin, %s: centrality estimator
+  const struct {
+    Int_t        fHandle;
+    const char * fName;
+  } gkHistogramNames[] = {
+    { kHNTrial,                                        "hNTrial" },
+    { kHEventSummary,                                  "hEventSummary" },
+    { kHVertexZ,                                       "hVertexZ" },
+    { kHCentralityvsNContributor,                      "hCentrality%svsNContributor" },
+    { kHCentralityV0MvsCL0,                            "hCentralityV0MvsCL0" },
+    { kHCentralityV0MvsCL1,                            "hCentralityV0MvsCL1" },
+    { kHCentralityCL0vsCL1,                            "hCentralityCL0vsCL1" },
+    { kHCentralityV0AvsV0C,                            "hCentralityV0AvsV0C" },
+    { kHCentralityZNAvsZNC,                            "hCentralityZNAvsZNC" },
+    { kHVertexZSelectEvent,                            "hVertexZSelectEvent" },
+    { kHCentralityvsPHOSClusterMultiplicityMC,         "hCentrality%svsPHOSClusterMultiplicityMC" },
+    { kHTrackTPCdEdx,                                  "hTrackTPCdEdx" },
+    { kHHybridTrackPt,                                 "hHybridTrackPt" },
+    { kHHybridTrackEtaPhi,                             "hHybridTrackEtaPhi" },
+    { kHGlobalTrackPt,                                 "hGlobalTrackPt" },
+    { kHGlobalTrackEtaPhi,                             "hGlobalTrackEtaPhi" },
+    { kHComplementaryTrackPt,                          "hComplementaryTrackPt" },
+    { kHComplementaryTrackEtaPhi,                      "hComplementaryTrackEtaPhi" },
+    { kHGlobalNoDCATrackPt,                            "hGlobalNoDCATrackPt" },
+    { kHGlobalNoDCATrackEtaPhi,                        "hGlobalNoDCATrackEtaPhi" },
+    { kHGlobalNoDCATrackDCA,                           "hGlobalNoDCATrackDCA" },
+    { kHGlobalNoDCATrackTPCdEdx,                       "hGlobalNoDCATrackTPCdEdx" },
+    { kHGlobalTrackDCA,                                "hGlobalTrackDCA" },
+    { kHGlobalTrackTPCdEdx,                            "hGlobalTrackTPCdEdx" },
+    { kHGlobalTrackMult,                               "hGlobalTrackMult" },
+    { kHGlobalNoDCATrackMult,                          "hGlobalNoDCATrackMult" },
+    { kHCentralityvsTrackMultiplicity,                 "hCentrality%svsTrackMultiplicity" },
+    { kHCentralityvsSPDTracklet,                       "hCentrality%svsSPDTracklet" },
+    { kHCellAmpTimeM_HG,                               "hCellAmpTimeM%d_HG" },
+    { kHCellAmpTimeM_LG,                               "hCellAmpTimeM%d_LG" },
+    { kHCellNXZM,                                      "hCellNXZM%d" },
+    { kHCellEXZM,                                      "hCellEXZM%d" },
+    { kHCellMultEventM1,                               "hCellMultEventM1" },
+    { kHCellMultEventM2,                               "hCellMultEventM2" },
+    { kHCellMultEventM3,                               "hCellMultEventM3" },
+    { kHCellMultEventM4,                               "hCellMultEventM4" },
+    { kHNFiredTRUChannel,                              "hNFiredTRUChannel" },
+    { kHPHI7Summary,                                   "hPHI7Summary" },
+    { kHFiredTRUChannelM,                              "hFiredTRUChannelM%d" },
+    { kHDistanceXZMTRU,                                "hDistanceXZM%dTRU%d" },
+    { kHDeltaRMTRU,                                    "hDeltaRM%dTRU%d" },
+    { kHClusterEnergyM,                                "hClusterEnergyM%d" },
+    { kHClusterEnergyMTRU,                             "hClusterEnergyM%dTRU%d" },
+    { kHClusterHitM,                                   "hClusterHitM%d" },
+    { kHMatchedFiredTRUChannelM,                       "hMatchedFiredTRUChannelM%d" },
+    { kHMatchedDistanceXZMTRU,                         "hMatchedDistanceXZM%dTRU%d" },
+    { kHMatchedDeltaRMTRU,                             "hMatchedDeltaRM%dTRU%d" },
+    { kHMatchedClusterEnergyM,                         "hMatchedClusterEnergyM%d" },
+    { kHMatchedClusterEnergyMTRU,                      "hMatchedClusterEnergyM%dTRU%d" },
+    { kHMatchedClusterHitM,                            "hMatchedClusterHitM%d" },
+    { kHAllClusterEnergy,                              "hAllClusterEnergy" },
+    { kHEnergyvsDistanceToBadChannel,                  "hEnergyvsDistanceToBadChannel" },
+    { kHClusterEtaPhi,                                 "hClusterEtaPhi" },
+    { kHClusterEvsTM,                                  "hClusterEvsTM%d" },
+    { kHCluNXZM,                                       "hCluNXZM%d" },
+    { kHCluEXZM,                                       "hCluEXZM%d" },
+    { kHClusterEvsN,                                   "hClusterEvsN" },
+    { kHClusterEvsM02,                                 "hClusterEvsM02" },
+    { kHClusterEvsM20,                                 "hClusterEvsM20" },
+    { kHFullDispvsFullE,                               "hFullDispvsFullE" },
+    { kHCoreDispvsCoreE,                               "hCoreDispvsCoreE" },
+    { kHFullDispvsCoreE,                               "hFullDispvsCoreE" },
+    { kHCoreDispvsFullE,                               "hCoreDispvsFullE" },
+    { kHPHOSClusterEnergyM,                            "hPHOSClusterEnergyM%d" },
+    { kHCluNXZTOFM,                                    "hCluNXZTOFM%d" },
+    { kHCluEXZTOFM,                                    "hCluEXZTOFM%d" },
+    { kHPHOSClusterEnergyTOFM,                         "hPHOSClusterEnergyTOFM%d" },
+    { kHCluLowNXZM,                                    "hCluLowNXZM%d" },
+    { kHCluLowEXZM,                                    "hCluLowEXZM%d" },
+    { kHCluHighNXZM,                                   "hCluHighNXZM%d" },
+    { kHCluHighEXZM,                                   "hCluHighEXZM%d" },
+    { kHPHOSClusterMultM1,                             "hPHOSClusterMultM1" },
+    { kHPHOSClusterMultM2,                             "hPHOSClusterMultM2" },
+    { kHPHOSClusterMultM3,                             "hPHOSClusterMultM3" },
+    { kHPHOSClusterMultM4,                             "hPHOSClusterMultM4" },
+    { kHPHOSClusterMultTOFM1,                          "hPHOSClusterMultTOFM1" },
+    { kHPHOSClusterMultTOFM2,                          "hPHOSClusterMultTOFM2" },
+    { kHPHOSClusterMultTOFM3,                          "hPHOSClusterMultTOFM3" },
+    { kHPHOSClusterMultTOFM4,                          "hPHOSClusterMultTOFM4" },
+    { kHCentralityvsPHOSClusterMultiplicity,           "hCentrality%svsPHOSClusterMultiplicity" },
+    { kHCentralityvsPHOSClusterMultiplicityTOF,        "hCentrality%svsPHOSClusterMultiplicityTOF" },
+    { kHPHOSClusterMultiplicityvsTrackMultiplicity,    "hPHOSClusterMultiplicityvsTrackMultiplicity" },
+    { kHPHOSClusterMultiplicityTOFvsTrackMultiplicity, "hPHOSClusterMultiplicityTOFvsTrackMultiplicity" },
+    { kHMultiplicityV0AvsPHOSClusterMultiplicity,      "hMultiplicityV0AvsPHOSClusterMultiplicity" },
+    { kHMultiplicityV0CvsPHOSClusterMultiplicity,      "hMultiplicityV0CvsPHOSClusterMultiplicity" },
+    { kHMultiplicityV0vsPHOSClusterMultiplicity,       "hMultiplicityV0vsPHOSClusterMultiplicity" },
+    { kHMultiplicityV0AvsPHOSClusterMultiplicityTOF,   "hMultiplicityV0AvsPHOSClusterMultiplicityTOF" },
+    { kHMultiplicityV0CvsPHOSClusterMultiplicityTOF,   "hMultiplicityV0CvsPHOSClusterMultiplicityTOF" },
+    { kHMultiplicityV0vsPHOSClusterMultiplicityTOF,    "hMultiplicityV0vsPHOSClusterMultiplicityTOF" },
+    { kHMultiplicityV0AvsTrackMultiplicity,            "hMultiplicityV0AvsTrackMultiplicity" },
+    { kHMultiplicityV0CvsTrackMultiplicity,            "hMultiplicityV0CvsTrackMultiplicity" },
+    { kHMultiplicityV0vsTrackMultiplicity,             "hMultiplicityV0vsTrackMultiplicity" },
+    { kHPhotonPt_noPID,                                "hPhotonPt_noPID" },
+    { kHPhotonPt_CPV,                                  "hPhotonPt_CPV" },
+    { kHPhotonPt_Disp,                                 "hPhotonPt_Disp" },
+    { kHPhotonPt_PID,                                  "hPhotonPt_PID" },
+    { kHGammaFromK0S,                                  "hGammaFromK0S" },
+    { kHMggFromPi0,                                    "hMggFromPi0" },
+    { kHMggFromPi0_asym08,                             "hMggFromPi0_asym08" },
+    { kHMggFromK0S,                                    "hMggFromK0S" },
+    { kHMggFromK0S_asym08,                             "hMggFromK0S_asym08" },
+    { kHMggFromLambda0,                                "hMggFromLambda0" },
+    { kHMggFromLambda0_asym08,                         "hMggFromLambda0_asym08" },
+    { kHMgg_OA,                                        "hMgg_OA" },
+    { kHMgg_M,                                         "hMgg_M%d%d" },
+    { kHMgg_M_TOF,                                     "hMgg_M%d%d_TOF" },
+    { kHMixMgg_OA,                                     "hMixMgg_OA" },
+    { kHMixMgg_M,                                      "hMixMgg_M%d%d" },
+    { kHMixMgg_M_TOF,                                  "hMixMgg_M%d%d_TOF" },
+    { kHDZvsZvsTrackPt_M,                              "hdZvsZvsTrackPt_M%d" },
+    { kHDXvsXvsTrackPt_plus_M,                         "hdXvsXvsTrackPt_plus_M%d" },
+    { kHDXvsXvsTrackPt_minus_M,                        "hdXvsXvsTrackPt_minus_M%d" },
+    { kHEpRatiovsNsigmaElectronTPC,                    "hEpRatiovsNsigmaElectronTPC" },
+    { kHEpRatiovsEnergy_M_Electron,                    "hEpRatiovsEnergy_M%d_Electron" },
+    { kHEpRatiovsTrackPt_M_Electron,                   "hEpRatiovsTrackPt_M%d_Electron" },
+    { kHTPCdEdx_Electron,                              "hTPCdEdx_Electron" },
+    { kHDZvsZvsTrackPtElectron_M,                      "hdZvsZvsTrackPtElectron_M%d" },
+    { kHEpRatiovsEnergy_M_Others,                      "hEpRatiovsEnergy_M%d_Others" },
+    { kHEpRatiovsTrackPt_M_Others,                     "hEpRatiovsTrackPt_M%d_Others" },
+    { kHTPCdEdx_Others,                                "hTPCdEdx_Others" },
+    { kHMgg_Probe_PID,                                 "hMgg_Probe_PID" },
+    { kHMgg_PassingProbe_CPV,                          "hMgg_PassingProbe_CPV" },
+    { kHMgg_PassingProbe_Disp,                         "hMgg_PassingProbe_Disp" },
+    { kHMgg_PassingProbe_PID,                          "hMgg_PassingProbe_PID" },
+    { kHMixMgg_Probe_PID,                              "hMixMgg_Probe_PID" },
+    { kHMixMgg_PassingProbe_CPV,                       "hMixMgg_PassingProbe_CPV" },
+    { kHMixMgg_PassingProbe_Disp,                      "hMixMgg_PassingProbe_Disp" },
+    { kHMixMgg_PassingProbe_PID,                       "hMixMgg_PassingProbe_PID" },
+    { kHMgg_Probe_TOF,                                 "hMgg_Probe_TOF" },
+    { kHMgg_PassingProbe_TOF,                          "hMgg_PassingProbe_TOF" },
+    { kHMixMgg_Probe_TOF,                              "hMixMgg_Probe_TOF" },
+    { kHMixMgg_PassingProbe_TOF,                       "hMixMgg_PassingProbe_TOF" },
+    { kHMatchedElectron,                               "hMatchedElectron" },
+    { kHMatchedPion,                                   "hMatchedPion" },
+    { kHMatchedKaon,                                   "hMatchedKaon" },
+    { kHMatchedProton,                                 "hMatchedProton" },
+    { kHMatchedAntiProton,                             "hMatchedAntiProton" },
+    { kHMatchedElectron_Disp,                          "hMatchedElectron_Disp" },
+    { kHMatchedPion_Disp,                              "hMatchedPion_Disp" },
+    { kHMatchedKaon_Disp,                              "hMatchedKaon_Disp" },
+    { kHMatchedProton_Disp,                            "hMatchedProton_Disp" },
+    { kHMatchedAntiProton_Disp,                        "hMatchedAntiProton_Disp" },
+    { kHPurityGamma_noPID,                             "hPurityGamma_noPID" },
+    { kHElectronRxy_noPID,                             "hElectronRxy_noPID" },
+    { kHConvertedElectronRxy_noPID,                    "hConvertedElectronRxy_noPID" },
+    { kHPurityElectron_noPID,                          "hPurityElectron_noPID" },
+    { kHPurityLCE_noPID,                               "hPurityLCE_noPID" },
+    { kHPurityPion_noPID,                              "hPurityPion_noPID" },
+    { kHPurityKaon_noPID,                              "hPurityKaon_noPID" },
+    { kHPurityK0L_noPID,                               "hPurityK0L_noPID" },
+    { kHPurityProton_noPID,                            "hPurityProton_noPID" },
+    { kHPurityAntiProton_noPID,                        "hPurityAntiProton_noPID" },
+    { kHPurityNeutron_noPID,                           "hPurityNeutron_noPID" },
+    { kHPurityAntiNeutron_noPID,                       "hPurityAntiNeutron_noPID" },
+    { kHPurityOthers_noPID,                            "hPurityOthers_noPID" },
+    { kHPurityGamma_CPV,                               "hPurityGamma_CPV" },
+    { kHElectronRxy_CPV,                               "hElectronRxy_CPV" },
+    { kHConvertedElectronRxy_CPV,                      "hConvertedElectronRxy_CPV" },
+    { kHPurityElectron_CPV,                            "hPurityElectron_CPV" },
+    { kHPurityLCE_CPV,                                 "hPurityLCE_CPV" },
+    { kHPurityPion_CPV,                                "hPurityPion_CPV" },
+    { kHPurityKaon_CPV,                                "hPurityKaon_CPV" },
+    { kHPurityK0L_CPV,                                 "hPurityK0L_CPV" },
+    { kHPurityProton_CPV,                              "hPurityProton_CPV" },
+    { kHPurityAntiProton_CPV,                          "hPurityAntiProton_CPV" },
+    { kHPurityNeutron_CPV,                             "hPurityNeutron_CPV" },
+    { kHPurityAntiNeutron_CPV,                         "hPurityAntiNeutron_CPV" },
+    { kHPurityOthers_CPV,                              "hPurityOthers_CPV" },
+    { kHPurityGamma_Disp,                              "hPurityGamma_Disp" },
+    { kHElectronRxy_Disp,                              "hElectronRxy_Disp" },
+    { kHConvertedElectronRxy_Disp,                     "hConvertedElectronRxy_Disp" },
+    { kHPurityElectron_Disp,                           "hPurityElectron_Disp" },
+    { kHPurityLCE_Disp,                                "hPurityLCE_Disp" },
+    { kHPurityPion_Disp,                               "hPurityPion_Disp" },
+    { kHPurityKaon_Disp,                               "hPurityKaon_Disp" },
+    { kHPurityK0L_Disp,                                "hPurityK0L_Disp" },
+    { kHPurityProton_Disp,                             "hPurityProton_Disp" },
+    { kHPurityAntiProton_Disp,                         "hPurityAntiProton_Disp" },
+    { kHPurityNeutron_Disp,                            "hPurityNeutron_Disp" },
+    { kHPurityAntiNeutron_Disp,                        "hPurityAntiNeutron_Disp" },
+    { kHPurityOthers_Disp,                             "hPurityOthers_Disp" },
+    { kHPurityGamma_PID,                               "hPurityGamma_PID" },
+    { kHElectronRxy_PID,                               "hElectronRxy_PID" },
+    { kHConvertedElectronRxy_PID,                      "hConvertedElectronRxy_PID" },
+    { kHPurityElectron_PID,                            "hPurityElectron_PID" },
+    { kHPurityLCE_PID,                                 "hPurityLCE_PID" },
+    { kHPurityPion_PID,                                "hPurityPion_PID" },
+    { kHPurityKaon_PID,                                "hPurityKaon_PID" },
+    { kHPurityK0L_PID,                                 "hPurityK0L_PID" },
+    { kHPurityProton_PID,                              "hPurityProton_PID" },
+    { kHPurityAntiProton_PID,                          "hPurityAntiProton_PID" },
+    { kHPurityNeutron_PID,                             "hPurityNeutron_PID" },
+    { kHPurityAntiNeutron_PID,                         "hPurityAntiNeutron_PID" },
+    { kHPurityOthers_PID,                              "hPurityOthers_PID" },
+    { kHClusterE_M_TRU,                                "hClusterE_M%d_TRU%d" },
+    { kHTriggeredClusterE_M_TRU,                       "hTriggeredClusterE_M%d_TRU%d" },
+    { kHClusterE_TOF_M_TRU,                            "hClusterE_TOF_M%d_TRU%d" },
+    { kHTriggeredClusterE_TOF_M_TRU,                   "hTriggeredClusterE_TOF_M%d_TRU%d" },
+    { kHMgg_Probe_Trg,                                 "hMgg_Probe_Trg" },
+    { kHMgg_Probe_Trg_M_TRU,                           "hMgg_Probe_Trg_M%d_TRU%d" },
+    { kHMgg_PassingProbe_Trg,                          "hMgg_PassingProbe_Trg" },
+    { kHMgg_PassingProbe_Trg_M_TRU,                    "hMgg_PassingProbe_Trg_M%d_TRU%d" },
+    { kHMixMgg_Probe_Trg,                              "hMixMgg_Probe_Trg" },
+    { kHMixMgg_Probe_Trg_M_TRU,                        "hMixMgg_Probe_Trg_M%d_TRU%d" },
+    { kHMixMgg_PassingProbe_Trg,                       "hMixMgg_PassingProbe_Trg" },
+    { kHMixMgg_PassingProbe_Trg_M_TRU,                 "hMixMgg_PassingProbe_Trg_M%d_TRU%d" },
+    { kHPtHard,                                        "hPtHard" },
+    { kHPDGPhysicalPrimary,                            "hPDGPhysicalPrimary" },
+    { kHPDGPhysicalPrimaryStable,                      "hPDGPhysicalPrimaryStable" },
+    { kHMgg_a_b,                                       "hMgg_a%d_b%d" },
+    { kHMixMgg_a_b,                                    "hMixMgg_a%d_b%d" },
+    { kHCentralityvsNormQ1,                            "hCentrality%svsNormQ1" },
+    { kHCentralityvsNormQ2,                            "hCentrality%svsNormQ2" },
+    { kHCentralityvsNormQ3,                            "hCentrality%svsNormQ3" },
+    { kHCentralityvsQ1x,                               "hCentrality%svsQ1x" },
+    { kHCentralityvsQ1y,                               "hCentrality%svsQ1y" },
+    { kHCentralityvsQ2x,                               "hCentrality%svsQ2x" },
+    { kHCentralityvsQ2y,                               "hCentrality%svsQ2y" },
+    { kHCentralityvsQ3x,                               "hCentrality%svsQ3x" },
+    { kHCentralityvsQ3y,                               "hCentrality%svsQ3y" },
+    { kHCentralityvsSPQ1Q2,                            "hCentrality%svsSPQ1Q2" },
+    { kHCentralityvsSPQ2Q3,                            "hCentrality%svsSPQ2Q3" },
+    { kHCentralityvsSPQ3Q1,                            "hCentrality%svsSPQ3Q1" },
+    { kHCentralityvsCosDeltaEventPlane12,              "hCentrality%svsCosDeltaEventPlane12" },
+    { kHCentralityvsCosDeltaEventPlane23,              "hCentrality%svsCosDeltaEventPlane23" },
+    { kHCentralityvsCosDeltaEventPlane31,              "hCentrality%svsCosDeltaEventPlane31" },
+    { kHCentralityvsSinDeltaEventPlane12,              "hCentrality%svsSinDeltaEventPlane12" },
+    { kHCentralityvsSinDeltaEventPlane23,              "hCentrality%svsSinDeltaEventPlane23" },
+    { kHCentralityvsSinDeltaEventPlane31,              "hCentrality%svsSinDeltaEventPlane31" },
+    { kHRvsTrackPt_Electron,                           "hRvsTrackPt_Electron" },
+    { kHRvsClusterPt_Electron,                         "hRvsClusterPt_Electron" },
+    { kHRvsTrackPt_Pion,                               "hRvsTrackPt_Pion" },
+    { kHRvsClusterPt_Pion,                             "hRvsClusterPt_Pion" },
+    { kHRvsTrackPt_Kaon,                               "hRvsTrackPt_Kaon" },
+    { kHRvsClusterPt_Kaon,                             "hRvsClusterPt_Kaon" },
+    { kHRvsTrackPt_Proton,                             "hRvsTrackPt_Proton" },
+    { kHRvsClusterPt_Proton,                           "hRvsClusterPt_Proton" },
+    { kHRvsTrackPt_AntiProton,                         "hRvsTrackPt_AntiProton" },
+    { kHRvsClusterPt_AntiProton,                       "hRvsClusterPt_AntiProton" },
+    { kHRvsClusterPt,                                  "hRvsClusterPt" },
+    { kHMixRvsTrackPt,                                 "hMixRvsTrackPt" },
+    { kHMixRvsClusterPt,                               "hMixRvsClusterPt" },
+    { kHMixRvsTrackPt_Electron,                        "hMixRvsTrackPt_Electron" },
+    { kHMixRvsClusterPt_Electron,                      "hMixRvsClusterPt_Electron" },
+    { kHMixRvsTrackPt_Pion,                            "hMixRvsTrackPt_Pion" },
+    { kHMixRvsClusterPt_Pion,                          "hMixRvsClusterPt_Pion" },
+    { kHMixRvsTrackPt_Kaon,                            "hMixRvsTrackPt_Kaon" },
+    { kHMixRvsClusterPt_Kaon,                          "hMixRvsClusterPt_Kaon" },
+    { kHMixRvsTrackPt_Proton,                          "hMixRvsTrackPt_Proton" },
+    { kHMixRvsClusterPt_Proton,                        "hMixRvsClusterPt_Proton" },
+    { kHMixRvsTrackPt_AntiProton,                      "hMixRvsTrackPt_AntiProton" },
+    { kHMixRvsClusterPt_AntiProton,                    "hMixRvsClusterPt_AntiProton" },
+  };
+}
+
 //________________________________________________________________________
 AliAnalysisTaskPHOSPi0EtaToGammaGamma::AliAnalysisTaskPHOSPi0EtaToGammaGamma(const char *name):
   AliAnalysisTaskSE(name),
@@ -109,6 +651,7 @@ AliAnalysisTaskPHOSPi0EtaToGammaGamma::AliAnalysisTaskPHOSPi0EtaToGammaGamma(con
   fCentArrayL0(0x0),
 
   fOutputContainer(0x0),
+  fHistograms(),
   fEvent(0x0),
   fESDEvent(0x0),
   fAODEvent(0x0),
@@ -332,6 +875,27 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserCreateOutputObjects()
   fOutputContainer = new THashList();
   fOutputContainer->SetOwner(kTRUE);
 
+  fHistograms.Clear();
+  for(UInt_t i=0;i<sizeof(gkHistogramNames)/sizeof(gkHistogramNames[0]);i++){
+    TString hname = gkHistogramNames[i].fName;
+    hname.ReplaceAll("%s",fEstimator);
+    fHistograms.Register(gkHistogramNames[i].fHandle,fOutputContainer,hname);
+  }
+  for(Int_t ipar=0;ipar<kNGenParticles;ipar++){
+    fHistograms.Register(kHGenPt         + ipar,fOutputContainer,Form("hGen%sPt"        ,gkGenParticleNames[ipar]));
+    fHistograms.Register(kHGenEtaPhi     + ipar,fOutputContainer,Form("hGen%sEtaPhi"    ,gkGenParticleNames[ipar]));
+    fHistograms.Register(kHGenEtaPt      + ipar,fOutputContainer,Form("hGen%sEtaPt"     ,gkGenParticleNames[ipar]));
+    fHistograms.Register(kHGenPtACC      + ipar,fOutputContainer,Form("hGen%sPtACC"     ,gkGenParticleNames[ipar]));
+    fHistograms.Register(kHGenEtaPhiACC  + ipar,fOutputContainer,Form("hGen%sEtaPhiACC" ,gkGenParticleNames[ipar]));
+    fHistograms.Register(kHGenEtaPtACC   + ipar,fOutputContainer,Form("hGen%sEtaPtACC"  ,gkGenParticleNames[ipar]));
+  }
+  for(Int_t it=0;it<4;it++)
+    fHistograms.Register(kHMatchedClusterEnergyType + it,fOutputContainer,Form("hMatchedClusterEnergy%s",gkTriggerTypeNames[it]));
+  for(Int_t i=0;i<3;i++){
+    fHistograms.Register(kHCentralityvsEventPlaneTPC + i,fOutputContainer,Form("hCentrality%svsEventPlane%s%s",fEstimator.Data(),fTPCEPName[i].Data(),fQNormalization.Data()));
+    fHistograms.Register(kHCentralityvsEventPlaneV0  + i,fOutputContainer,Form("hCentrality%svsEventPlane%s%s",fEstimator.Data(),fV0EPName[i].Data(),fQNormalization.Data()));
+  }
+
   TH1F *hEventSummary = new TH1F("hEventSummary","Event Summary",10,0.5,10.5);
   hEventSummary->GetXaxis()->SetBinLabel(1 ,"all");
   hEventSummary->GetXaxis()->SetBinLabel(2 ,"selected");
@@ -852,8 +1416,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserCreateOutputObjects()
     //fOutputContainer->Add(new TH1F("hPDGPhysicalPrimary","PDG code of Phyical Primary",8001,-4000-0.5,4000+0.5));
     //fOutputContainer->Add(new TH1F("hPDGPhysicalPrimaryStable","PDG code of Phyical Primary",8001,-4000-0.5,4000+0.5));
 
-    const TString parname[] = {"Pi0","Eta","Gamma","Omega","ChargedPion","ChargedKaon","K0S","K0L","Lambda0","Sigma0","Proton","AntiProton","Neutron","AntiNeutron"};
-    const Int_t Npar = sizeof(parname)/sizeof(parname[0]);
+    const TString parname[kNGenParticles] = {"Pi0","Eta","Gamma","Omega","ChargedPion","ChargedKaon","K0S","K0L","Lambda0","Sigma0","Proton","AntiProton","Neutron","AntiNeutron"};
+    const Int_t Npar = kNGenParticles;
 
     for(Int_t ipar=0;ipar<Npar;ipar++){
       TH1F *h1Pt = new TH1F(Form("hGen%sPt",parname[ipar].Data()),Form("generated %s pT;p_{T} (GeV/c)",parname[ipar].Data()),NpTgg-1,pTgg);
@@ -1108,7 +1672,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserExec(Option_t *option)
     Int_t nTrial     = pythiaGenHeader->Trials();
 
     AliInfo(Form("pT-hard-bin = %d , pThard = %f GeV/c , xsection = %f mb , nTrial = %d.",fPtHardBin, pThard, xsection, nTrial));
-    FillHistogramTH1(fOutputContainer,"hNTrial",fPtHardBin,nTrial);//this should be filled in all events (no rejected/selected events).
+    FillHistogramTH1(fHistograms.Get(kHNTrial),fPtHardBin,nTrial);//this should be filled in all events (no rejected/selected events).
     FillProfile(fOutputContainer,"hProfCrossSection",fPtHardBin,xsection);//this should be filled in all events (no rejected/selected events).
 
     if(!(fJJMCHandler->ComparePtHardBin(fEvent))) return;
@@ -1193,9 +1757,9 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserExec(Option_t *option)
     return;
   }
 
-  FillHistogramTH1(fOutputContainer,"hEventSummary",1);//all
-  FillHistogramTH1(fOutputContainer,"hVertexZ" ,fVertex[2]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsNContributor",fEstimator.Data()),fCentralityMain,Ncontributor);
+  FillHistogramTH1(fHistograms.Get(kHEventSummary),1);//all
+  FillHistogramTH1(fHistograms.Get(kHVertexZ),fVertex[2]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsNContributor),fCentralityMain,Ncontributor);
 
   fPHOSClusterArray = (TClonesArray*)fEvent->FindListObject("PHOSClusterArray");
   if(!fPHOSClusterArray){
@@ -1239,10 +1803,10 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserExec(Option_t *option)
   }
 
   //fill fired trigger statistics right after basic event selection, but before PHI7 event selection.
-  if(Is0PH0fired) FillHistogramTH1(fOutputContainer,"hEventSummary",3);//0PH0
-  if(Is1PHLfired) FillHistogramTH1(fOutputContainer,"hEventSummary",4);//1PHL
-  if(Is1PHMfired) FillHistogramTH1(fOutputContainer,"hEventSummary",5);//1PHM
-  if(Is1PHHfired) FillHistogramTH1(fOutputContainer,"hEventSummary",6);//1PHH
+  if(Is0PH0fired) FillHistogramTH1(fHistograms.Get(kHEventSummary),3);//0PH0
+  if(Is1PHLfired) FillHistogramTH1(fHistograms.Get(kHEventSummary),4);//1PHL
+  if(Is1PHMfired) FillHistogramTH1(fHistograms.Get(kHEventSummary),5);//1PHM
+  if(Is1PHHfired) FillHistogramTH1(fHistograms.Get(kHEventSummary),6);//1PHH
 
   if(fIsPHOSTriggerAnalysis && !(fPHOSTriggerHelper->IsPHI7(fEvent,fPHOSClusterCuts,fEmin,fEnergyThreshold,fUseCoreEnergy))){
     AliInfo("event is rejected. IsPHI7 = kFALSE.");
@@ -1254,14 +1818,14 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserExec(Option_t *option)
   //<- end of event selection
   //-> start physics analysis
 
-  FillHistogramTH2(fOutputContainer,"hCentralityV0MvsCL0",fCentralityV0M,fCentralityCL0);
-  FillHistogramTH2(fOutputContainer,"hCentralityV0MvsCL1",fCentralityV0M,fCentralityCL1);
-  FillHistogramTH2(fOutputContainer,"hCentralityCL0vsCL1",fCentralityCL0,fCentralityCL1);
-  FillHistogramTH2(fOutputContainer,"hCentralityV0AvsV0C",fCentralityV0A,fCentralityV0C);
-  FillHistogramTH2(fOutputContainer,"hCentralityZNAvsZNC",fCentralityZNA,fCentralityZNC);
+  FillHistogramTH2(fHistograms.Get(kHCentralityV0MvsCL0),fCentralityV0M,fCentralityCL0);
+  FillHistogramTH2(fHistograms.Get(kHCentralityV0MvsCL1),fCentralityV0M,fCentralityCL1);
+  FillHistogramTH2(fHistograms.Get(kHCentralityCL0vsCL1),fCentralityCL0,fCentralityCL1);
+  FillHistogramTH2(fHistograms.Get(kHCentralityV0AvsV0C),fCentralityV0A,fCentralityV0C);
+  FillHistogramTH2(fHistograms.Get(kHCentralityZNAvsZNC),fCentralityZNA,fCentralityZNC);
 
-  FillHistogramTH1(fOutputContainer,"hVertexZSelectEvent" ,fVertex[2]);
-  FillHistogramTH1(fOutputContainer,"hEventSummary",2);//selected event
+  FillHistogramTH1(fHistograms.Get(kHVertexZSelectEvent),fVertex[2]);
+  FillHistogramTH1(fHistograms.Get(kHEventSummary),2);//selected event
  
   AliInfo(Form("Collision system = %d | fCentralityMain estimated by %s = %f %% | Zvtx = %f cm , fZvtx = %d | Harmonics = %d , fEventPlane = %f (rad.) , fEPBin = %d |",fCollisionSystem,fEstimator.Data(),fCentralityMain,fVertex[2],fZvtx,fHarmonics,fEventPlane,fEPBin));
  
@@ -1281,7 +1845,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::UserExec(Option_t *option)
 
       multPHOSClustAll++;
     }
-    FillHistogramTH2(fOutputContainer,Form("hCentrality%svsPHOSClusterMultiplicityMC",fEstimator.Data()),fCentralityMain,multPHOSClustAll);
+    FillHistogramTH2(fHistograms.Get(kHCentralityvsPHOSClusterMultiplicityMC),fCentralityMain,multPHOSClustAll);
   }
 
   if(fIsMC && fIsJJMC){
@@ -1423,20 +1987,20 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TrackQA()
       if(phi<0) phi += TMath::TwoPi();
       p = esdtrack->P();
       dEdx = esdtrack->GetTPCsignal();
-      FillHistogramTH2(fOutputContainer,"hTrackTPCdEdx",p,dEdx);
+      FillHistogramTH2(fHistograms.Get(kHTrackTPCdEdx),p,dEdx);
 
-      FillHistogramTH1(fOutputContainer,"hHybridTrackPt",pT);
-      FillHistogramTH2(fOutputContainer,"hHybridTrackEtaPhi",phi,eta);
+      FillHistogramTH1(fHistograms.Get(kHHybridTrackPt),pT);
+      FillHistogramTH2(fHistograms.Get(kHHybridTrackEtaPhi),phi,eta);
 
       if(fESDtrackCutsGlobal->AcceptTrack(esdtrack)){//global track
         NGlobal++;
-        FillHistogramTH1(fOutputContainer,"hGlobalTrackPt",pT);
-        FillHistogramTH2(fOutputContainer,"hGlobalTrackEtaPhi",phi,eta);
+        FillHistogramTH1(fHistograms.Get(kHGlobalTrackPt),pT);
+        FillHistogramTH2(fHistograms.Get(kHGlobalTrackEtaPhi),phi,eta);
       }
       if(fESDtrackCutsGlobalConstrained->AcceptTrack(esdtrack)){//global-constrained = complementary track
         NComplementary++;
-        FillHistogramTH1(fOutputContainer,"hComplementaryTrackPt",pT);
-        FillHistogramTH2(fOutputContainer,"hComplementaryTrackEtaPhi",phi,eta);
+        FillHistogramTH1(fHistograms.Get(kHComplementaryTrackPt),pT);
+        FillHistogramTH2(fHistograms.Get(kHComplementaryTrackEtaPhi),phi,eta);
       }
     }//end of track loop
   }//end of ESD
@@ -1458,27 +2022,27 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TrackQA()
 
       if(aodtrack->TestFilterMask(AliAODTrack::kTrkGlobalNoDCA)){//standard cuts with very loose DCA cut
         NGlobalNoDCA++;
-        FillHistogramTH1(fOutputContainer,"hGlobalNoDCATrackPt",pT);
-        FillHistogramTH2(fOutputContainer,"hGlobalNoDCATrackEtaPhi",phi,eta);
-        FillHistogramTH2(fOutputContainer,"hGlobalNoDCATrackDCA",dca_xy,dca_z);
-        FillHistogramTH2(fOutputContainer,"hGlobalNoDCATrackTPCdEdx",p,dEdx);
+        FillHistogramTH1(fHistograms.Get(kHGlobalNoDCATrackPt),pT);
+        FillHistogramTH2(fHistograms.Get(kHGlobalNoDCATrackEtaPhi),phi,eta);
+        FillHistogramTH2(fHistograms.Get(kHGlobalNoDCATrackDCA),dca_xy,dca_z);
+        FillHistogramTH2(fHistograms.Get(kHGlobalNoDCATrackTPCdEdx),p,dEdx);
       }//end of loose DCA
       if(aodtrack->TestFilterMask(AliAODTrack::kTrkGlobal)){//standard cuts with tight DCA cut (AliESDtrackCuts::GetStandardITSTPCTrackCuts2011())
         NGlobal++;
-        FillHistogramTH1(fOutputContainer,"hGlobalTrackPt",pT);
-        FillHistogramTH2(fOutputContainer,"hGlobalTrackEtaPhi",phi,eta);
-        FillHistogramTH2(fOutputContainer,"hGlobalTrackDCA",dca_xy,dca_z);
-        FillHistogramTH2(fOutputContainer,"hGlobalTrackTPCdEdx",p,dEdx);
+        FillHistogramTH1(fHistograms.Get(kHGlobalTrackPt),pT);
+        FillHistogramTH2(fHistograms.Get(kHGlobalTrackEtaPhi),phi,eta);
+        FillHistogramTH2(fHistograms.Get(kHGlobalTrackDCA),dca_xy,dca_z);
+        FillHistogramTH2(fHistograms.Get(kHGlobalTrackTPCdEdx),p,dEdx);
       }//end of tight DCA
 
     }//end of track loop
 
   }//end of AOD
 
-  FillHistogramTH1(fOutputContainer,"hGlobalTrackMult",NGlobal);
-  FillHistogramTH1(fOutputContainer,"hGlobalNoDCATrackMult",NGlobalNoDCA);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsTrackMultiplicity",fEstimator.Data()),fCentralityMain,NGlobalNoDCA);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSPDTracklet",fEstimator.Data()),fCentralityMain,Ntracklet);
+  FillHistogramTH1(fHistograms.Get(kHGlobalTrackMult),NGlobal);
+  FillHistogramTH1(fHistograms.Get(kHGlobalNoDCATrackMult),NGlobalNoDCA);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsTrackMultiplicity),fCentralityMain,NGlobalNoDCA);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSPDTracklet),fCentralityMain,Ntracklet);
   fNHybridTrack = NGlobalNoDCA;
 
 }
@@ -1515,18 +2079,18 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::CellQA()
       return;
     }
 
-    if(isHG) FillHistogramTH2(fOutputContainer,Form("hCellAmpTimeM%d_HG",module),cellamp,celltime*1e+9);
-    else     FillHistogramTH2(fOutputContainer,Form("hCellAmpTimeM%d_LG",module),cellamp,celltime*1e+9);
+    if(isHG) FillHistogramTH2(fHistograms.Get(kHCellAmpTimeM_HG, module),cellamp,celltime*1e+9);
+    else     FillHistogramTH2(fHistograms.Get(kHCellAmpTimeM_LG, module),cellamp,celltime*1e+9);
 
     nCellModule[module]++;
-    FillHistogramTH2(fOutputContainer,Form("hCellNXZM%d",module),cellx,cellz);
-    FillHistogramTH2(fOutputContainer,Form("hCellEXZM%d",module),cellx,cellz,cellamp);
+    FillHistogramTH2(fHistograms.Get(kHCellNXZM, module),cellx,cellz);
+    FillHistogramTH2(fHistograms.Get(kHCellEXZM, module),cellx,cellz,cellamp);
   }
 
-  FillHistogramTH1(fOutputContainer,"hCellMultEventM1",nCellModule[1]);
-  FillHistogramTH1(fOutputContainer,"hCellMultEventM2",nCellModule[2]);
-  FillHistogramTH1(fOutputContainer,"hCellMultEventM3",nCellModule[3]);
-  FillHistogramTH1(fOutputContainer,"hCellMultEventM4",nCellModule[4]);
+  FillHistogramTH1(fHistograms.Get(kHCellMultEventM1),nCellModule[1]);
+  FillHistogramTH1(fHistograms.Get(kHCellMultEventM2),nCellModule[2]);
+  FillHistogramTH1(fHistograms.Get(kHCellMultEventM3),nCellModule[3]);
+  FillHistogramTH1(fHistograms.Get(kHCellMultEventM4),nCellModule[4]);
 
 }
 //________________________________________________________________________
@@ -1538,7 +2102,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TriggerQA()
   trg->Reset();
 
   const Int_t Nfired = trg->GetEntries();
-  FillHistogramTH1(fOutputContainer,"hNFiredTRUChannel",Nfired);
+  FillHistogramTH1(fHistograms.Get(kHNFiredTRUChannel),Nfired);
 
   Int_t trgrelId[4]={};
   Int_t tmod=0; //"Online" module number
@@ -1576,7 +2140,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TriggerQA()
 
   while(trg->Next()){
 
-    FillHistogramTH1(fOutputContainer,"hPHI7Summary",trg->GetL1TimeSum());
+    FillHistogramTH1(fHistograms.Get(kHPHI7Summary),trg->GetL1TimeSum());
 
     if(trg->GetL1TimeSum() != L1) continue;
     trg->GetPosition(tmod,trgabsId);//tmod is online module numbering. i.e., tmod=1 means half module.
@@ -1602,7 +2166,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TriggerQA()
       return;
     }
 
-    FillHistogramTH1(fOutputContainer,Form("hFiredTRUChannelM%d",trgmodule),trgcellx,trgcellz);
+    FillHistogramTH1(fHistograms.Get(kHFiredTRUChannelM, trgmodule),trgcellx,trgcellz);
 
     for(Int_t i=0;i<multClust;i++){
       AliCaloPhoton *ph = (AliCaloPhoton*)fPHOSClusterArray->At(i);
@@ -1640,39 +2204,39 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::TriggerQA()
       DeltaR = TMath::Sqrt( TMath::Power(eta_trigger - eta_cluster,2) +  TMath::Power(phi_trigger - phi_cluster,2) );
       //DeltaR = fPHOSTriggerHelper->GetDistanceToClosestTRUChannel(ph);
 
-      FillHistogramTH3(fOutputContainer,Form("hDistanceXZM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
-      FillHistogramTH2(fOutputContainer,Form("hDeltaRM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
+      FillHistogramTH3(fHistograms.Get(kHDistanceXZMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
+      FillHistogramTH2(fHistograms.Get(kHDeltaRMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
 
       if(!IsFilledOnce){//to avoid double counting of energy
-        FillHistogramTH1(fOutputContainer,Form("hClusterEnergyM%d",module),energy);
-        FillHistogramTH1(fOutputContainer,Form("hClusterEnergyM%dTRU%d",module,fPHOSTriggerHelper->WhichTRU(cellx,cellz)),energy);
-        FillHistogramTH3(fOutputContainer,Form("hClusterHitM%d",module),cellx,cellz,energy);
+        FillHistogramTH1(fHistograms.Get(kHClusterEnergyM, module),energy);
+        FillHistogramTH1(fHistograms.Get(kHClusterEnergyMTRU, module, fPHOSTriggerHelper->WhichTRU(cellx,cellz)),energy);
+        FillHistogramTH3(fHistograms.Get(kHClusterHitM, module),cellx,cellz,energy);
       }
 
       if(fPHOSTriggerHelper->IsDeltaRUsed()){
         if(fPHOSTriggerHelper->IsMatchedDeltaR(trgrelId,global1)){
-          FillHistogramTH3(fOutputContainer,Form("hMatchedFiredTRUChannelM%d",trgmodule),trgcellx,trgcellz,energy);
-          FillHistogramTH3(fOutputContainer,Form("hMatchedDistanceXZM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
-          FillHistogramTH2(fOutputContainer,Form("hMatchedDeltaRM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
+          FillHistogramTH3(fHistograms.Get(kHMatchedFiredTRUChannelM, trgmodule),trgcellx,trgcellz,energy);
+          FillHistogramTH3(fHistograms.Get(kHMatchedDistanceXZMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
+          FillHistogramTH2(fHistograms.Get(kHMatchedDeltaRMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
 
           if(kUsedCluster[i] == 0){
-            FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergyM%d",module),energy);
-            FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergyM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),energy);
-            FillHistogramTH3(fOutputContainer,Form("hMatchedClusterHitM%d",module),cellx,cellz,energy);
+            FillHistogramTH1(fHistograms.Get(kHMatchedClusterEnergyM, module),energy);
+            FillHistogramTH1(fHistograms.Get(kHMatchedClusterEnergyMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),energy);
+            FillHistogramTH3(fHistograms.Get(kHMatchedClusterHitM, module),cellx,cellz,energy);
           }
           kUsedCluster[i] = 1;
         }
       }
       else{
         if(fPHOSTriggerHelper->IsMatched(trgrelId,relId)){
-          FillHistogramTH3(fOutputContainer,Form("hMatchedFiredTRUChannelM%d",trgmodule),trgcellx,trgcellz,energy);
-          FillHistogramTH3(fOutputContainer,Form("hMatchedDistanceXZM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
-          FillHistogramTH2(fOutputContainer,Form("hMatchedDeltaRM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
+          FillHistogramTH3(fHistograms.Get(kHMatchedFiredTRUChannelM, trgmodule),trgcellx,trgcellz,energy);
+          FillHistogramTH3(fHistograms.Get(kHMatchedDistanceXZMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),diffx,diffz,energy);
+          FillHistogramTH2(fHistograms.Get(kHMatchedDeltaRMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),DeltaR,energy);
 
           if(kUsedCluster[i] == 0){
-            FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergyM%d",module),energy);
-            FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergyM%dTRU%d",trgmodule,fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),energy);
-            FillHistogramTH3(fOutputContainer,Form("hMatchedClusterHitM%d",module),cellx,cellz,energy);
+            FillHistogramTH1(fHistograms.Get(kHMatchedClusterEnergyM, module),energy);
+            FillHistogramTH1(fHistograms.Get(kHMatchedClusterEnergyMTRU, trgmodule, fPHOSTriggerHelper->WhichTRU(trgcellx,trgcellz)),energy);
+            FillHistogramTH3(fHistograms.Get(kHMatchedClusterHitM, module),cellx,cellz,energy);
           }
           kUsedCluster[i] = 1;
         }
@@ -1741,89 +2305,89 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ClusterQA()
     }
 
     if(ph->IsTOFOK()){
-      FillHistogramTH1(fOutputContainer,"hAllClusterEnergy",energy);//only for trigger efficiency in MB in data
+      FillHistogramTH1(fHistograms.Get(kHAllClusterEnergy),energy);//only for trigger efficiency in MB in data
     }
 
-    FillHistogramTH2(fOutputContainer,"hEnergyvsDistanceToBadChannel",energy,ph->DistToBadfp()); //in unit of cell with floating point
+    FillHistogramTH2(fHistograms.Get(kHEnergyvsDistanceToBadChannel),energy,ph->DistToBadfp()); //in unit of cell with floating point
 
     eta = global1.Eta();
     phi = global1.Phi();
     if(phi<0) phi += TMath::TwoPi();
-    FillHistogramTH2(fOutputContainer,"hClusterEtaPhi",phi,eta);
-    FillHistogramTH2(fOutputContainer,Form("hClusterEvsTM%d",module),energy,tof*1e+9);
-    FillHistogramTH2(fOutputContainer,Form("hCluNXZM%d",module),cellx,cellz);
-    FillHistogramTH2(fOutputContainer,Form("hCluEXZM%d",module),cellx,cellz,energy);
+    FillHistogramTH2(fHistograms.Get(kHClusterEtaPhi),phi,eta);
+    FillHistogramTH2(fHistograms.Get(kHClusterEvsTM, module),energy,tof*1e+9);
+    FillHistogramTH2(fHistograms.Get(kHCluNXZM, module),cellx,cellz);
+    FillHistogramTH2(fHistograms.Get(kHCluEXZM, module),cellx,cellz,energy);
 
     R     = ph->GetNsigmaFullDisp();
     coreR = ph->GetNsigmaCoreDisp();
     coreE = (ph->GetMomV2())->Energy();
  
-    FillHistogramTH2(fOutputContainer,"hClusterEvsN",energy,digMult);
-    FillHistogramTH2(fOutputContainer,"hClusterEvsM02",energy,M02);
-    FillHistogramTH2(fOutputContainer,"hClusterEvsM20",energy,M20);
-    FillHistogramTH2(fOutputContainer,"hFullDispvsFullE",energy,R);
-    FillHistogramTH2(fOutputContainer,"hCoreDispvsCoreE",coreE,coreR);
-    FillHistogramTH2(fOutputContainer,"hFullDispvsCoreE",coreE,R);
-    FillHistogramTH2(fOutputContainer,"hCoreDispvsFullE",energy,coreR);
+    FillHistogramTH2(fHistograms.Get(kHClusterEvsN),energy,digMult);
+    FillHistogramTH2(fHistograms.Get(kHClusterEvsM02),energy,M02);
+    FillHistogramTH2(fHistograms.Get(kHClusterEvsM20),energy,M20);
+    FillHistogramTH2(fHistograms.Get(kHFullDispvsFullE),energy,R);
+    FillHistogramTH2(fHistograms.Get(kHCoreDispvsCoreE),coreE,coreR);
+    FillHistogramTH2(fHistograms.Get(kHFullDispvsCoreE),coreE,R);
+    FillHistogramTH2(fHistograms.Get(kHCoreDispvsFullE),energy,coreR);
 
     multPHOSClust[0]++;
     multPHOSClust[module]++;
 
-    FillHistogramTH1(fOutputContainer,Form("hPHOSClusterEnergyM%d",module),energy);
+    FillHistogramTH1(fHistograms.Get(kHPHOSClusterEnergyM, module),energy);
     if(ph->IsTOFOK()){// unit in ns.
       multPHOSClustTOF[0]++;
       multPHOSClustTOF[module]++;
-      FillHistogramTH2(fOutputContainer,Form("hCluNXZTOFM%d",module),cellx,cellz);
-      FillHistogramTH2(fOutputContainer,Form("hCluEXZTOFM%d",module),cellx,cellz,energy);
-      FillHistogramTH1(fOutputContainer,Form("hPHOSClusterEnergyTOFM%d",module),energy);
+      FillHistogramTH2(fHistograms.Get(kHCluNXZTOFM, module),cellx,cellz);
+      FillHistogramTH2(fHistograms.Get(kHCluEXZTOFM, module),cellx,cellz,energy);
+      FillHistogramTH1(fHistograms.Get(kHPHOSClusterEnergyTOFM, module),energy);
     }
 
     if(energy > 0.5){
       if(energy < 2.){// 0.5 < energy < 2GeV
-        FillHistogramTH2(fOutputContainer,Form("hCluLowNXZM%d",module),cellx,cellz);
-        FillHistogramTH2(fOutputContainer,Form("hCluLowEXZM%d",module),cellx,cellz,energy);
+        FillHistogramTH2(fHistograms.Get(kHCluLowNXZM, module),cellx,cellz);
+        FillHistogramTH2(fHistograms.Get(kHCluLowEXZM, module),cellx,cellz,energy);
       }
       else{//energy>=2GeV
-        FillHistogramTH2(fOutputContainer,Form("hCluHighNXZM%d",module),cellx,cellz);
-        FillHistogramTH2(fOutputContainer,Form("hCluHighEXZM%d",module),cellx,cellz,energy);
+        FillHistogramTH2(fHistograms.Get(kHCluHighNXZM, module),cellx,cellz);
+        FillHistogramTH2(fHistograms.Get(kHCluHighEXZM, module),cellx,cellz,energy);
       }
     }
 
   }//end of cluster loop
 
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultM1",multPHOSClust[1]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultM2",multPHOSClust[2]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultM3",multPHOSClust[3]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultM4",multPHOSClust[4]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultM1),multPHOSClust[1]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultM2),multPHOSClust[2]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultM3),multPHOSClust[3]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultM4),multPHOSClust[4]);
 
   //for TOF cut
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultTOFM1",multPHOSClustTOF[1]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultTOFM2",multPHOSClustTOF[2]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultTOFM3",multPHOSClustTOF[3]);
-  FillHistogramTH1(fOutputContainer,"hPHOSClusterMultTOFM4",multPHOSClustTOF[4]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultTOFM1),multPHOSClustTOF[1]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultTOFM2),multPHOSClustTOF[2]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultTOFM3),multPHOSClustTOF[3]);
+  FillHistogramTH1(fHistograms.Get(kHPHOSClusterMultTOFM4),multPHOSClustTOF[4]);
   //for tof cut end
 
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsPHOSClusterMultiplicity"   ,fEstimator.Data()),fCentralityMain,multPHOSClust[0]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsPHOSClusterMultiplicityTOF",fEstimator.Data()),fCentralityMain,multPHOSClustTOF[0]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsPHOSClusterMultiplicity),fCentralityMain,multPHOSClust[0]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsPHOSClusterMultiplicityTOF),fCentralityMain,multPHOSClustTOF[0]);
 
-  FillHistogramTH2(fOutputContainer,"hPHOSClusterMultiplicityvsTrackMultiplicity",fNHybridTrack,multPHOSClust[0]);
-  FillHistogramTH2(fOutputContainer,"hPHOSClusterMultiplicityTOFvsTrackMultiplicity",fNHybridTrack,multPHOSClustTOF[0]);
+  FillHistogramTH2(fHistograms.Get(kHPHOSClusterMultiplicityvsTrackMultiplicity),fNHybridTrack,multPHOSClust[0]);
+  FillHistogramTH2(fHistograms.Get(kHPHOSClusterMultiplicityTOFvsTrackMultiplicity),fNHybridTrack,multPHOSClustTOF[0]);
 
   AliVVZERO *V0info = (AliVVZERO*)fEvent->GetVZEROData();
   Float_t mtotV0A = V0info->GetMTotV0A();
   Float_t mtotV0C = V0info->GetMTotV0C();
   Float_t mtotV0 = mtotV0A + mtotV0C;
 
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0AvsPHOSClusterMultiplicity",mtotV0A,multPHOSClust[0]);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0CvsPHOSClusterMultiplicity",mtotV0C,multPHOSClust[0]);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0vsPHOSClusterMultiplicity" ,mtotV0 ,multPHOSClust[0]);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0AvsPHOSClusterMultiplicityTOF",mtotV0A,multPHOSClustTOF[0]);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0CvsPHOSClusterMultiplicityTOF",mtotV0C,multPHOSClustTOF[0]);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0vsPHOSClusterMultiplicityTOF" ,mtotV0 ,multPHOSClustTOF[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0AvsPHOSClusterMultiplicity),mtotV0A,multPHOSClust[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0CvsPHOSClusterMultiplicity),mtotV0C,multPHOSClust[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0vsPHOSClusterMultiplicity),mtotV0 ,multPHOSClust[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0AvsPHOSClusterMultiplicityTOF),mtotV0A,multPHOSClustTOF[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0CvsPHOSClusterMultiplicityTOF),mtotV0C,multPHOSClustTOF[0]);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0vsPHOSClusterMultiplicityTOF),mtotV0 ,multPHOSClustTOF[0]);
 
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0AvsTrackMultiplicity",mtotV0A,fNHybridTrack);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0CvsTrackMultiplicity",mtotV0C,fNHybridTrack);
-  FillHistogramTH2(fOutputContainer,"hMultiplicityV0vsTrackMultiplicity" ,mtotV0 ,fNHybridTrack);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0AvsTrackMultiplicity),mtotV0A,fNHybridTrack);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0CvsTrackMultiplicity),mtotV0C,fNHybridTrack);
+  FillHistogramTH2(fHistograms.Get(kHMultiplicityV0vsTrackMultiplicity),mtotV0 ,fNHybridTrack);
 
 }
 //________________________________________________________________________
@@ -1874,10 +2438,10 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillPhoton()
     if(!fIsMC && fIsPHOSTriggerAnalysis && fTRFM == AliAnalysisTaskPHOSPi0EtaToGammaGamma::kTAP) trgeff = f1trg->Eval(energy);
 
     if(fIsMC || (!fIsMC && ph->IsTOFOK())){
-                                             FillHistogramTH1(fOutputContainer,"hPhotonPt_noPID",pT,1/eff * weight * 1/trgeff);
-      if(fPHOSClusterCuts->IsNeutral(ph))    FillHistogramTH1(fOutputContainer,"hPhotonPt_CPV"  ,pT,1/eff * weight * 1/trgeff);
-      if(fPHOSClusterCuts->AcceptDisp(ph))   FillHistogramTH1(fOutputContainer,"hPhotonPt_Disp" ,pT,1/eff * weight * 1/trgeff);
-      if(fPHOSClusterCuts->AcceptPhoton(ph)) FillHistogramTH1(fOutputContainer,"hPhotonPt_PID"  ,pT,1/eff * weight * 1/trgeff);
+                                             FillHistogramTH1(fHistograms.Get(kHPhotonPt_noPID),pT,1/eff * weight * 1/trgeff);
+      if(fPHOSClusterCuts->IsNeutral(ph))    FillHistogramTH1(fHistograms.Get(kHPhotonPt_CPV),pT,1/eff * weight * 1/trgeff);
+      if(fPHOSClusterCuts->AcceptDisp(ph))   FillHistogramTH1(fHistograms.Get(kHPhotonPt_Disp),pT,1/eff * weight * 1/trgeff);
+      if(fPHOSClusterCuts->AcceptPhoton(ph)) FillHistogramTH1(fHistograms.Get(kHPhotonPt_PID),pT,1/eff * weight * 1/trgeff);
     }
 
     if(!fPHOSClusterCuts->AcceptPhoton(ph)) continue;
@@ -1900,7 +2464,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillPhoton()
     }
 
     if(fIsMC){
-      if(IsFrom(primary,TrueK0SPt,310) && IsPhoton(primary)) FillHistogramTH1(fOutputContainer,"hGammaFromK0S",pT,weight); 
+      if(IsFrom(primary,TrueK0SPt,310) && IsPhoton(primary)) FillHistogramTH1(fHistograms.Get(kHGammaFromK0S),pT,weight); 
     }
 
     value[0] = pT;
@@ -2023,8 +2587,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMgg()
           AliAODMCParticle *p = (AliAODMCParticle*)fMCArrayAOD->At(commonID);
           Int_t pdg = p->PdgCode(); 
           if(pdg1 == 22 && pdg2 == 22 && pdg == 111){
-            FillHistogramTH2(fOutputContainer,"hMggFromPi0",m12,pt12,weight);
-            if(asym < 0.8) FillHistogramTH2(fOutputContainer,"hMggFromPi0_asym08",m12,pt12,weight);
+            FillHistogramTH2(fHistograms.Get(kHMggFromPi0),m12,pt12,weight);
+            if(asym < 0.8) FillHistogramTH2(fHistograms.Get(kHMggFromPi0_asym08),m12,pt12,weight);
           }
         }
         if(IsFrom(primary1,TrueK0SPt,310) && IsFrom(primary2,TrueK0SPt,310) && commonID > -1){
@@ -2036,8 +2600,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMgg()
           AliAODMCParticle *p = (AliAODMCParticle*)fMCArrayAOD->At(commonID);
           Int_t pdg = p->PdgCode(); 
           if(pdg1 == 22 && pdg2 == 22 && pdg == 111){
-            FillHistogramTH2(fOutputContainer,"hMggFromK0S",m12,pt12,weight);
-            if(asym < 0.8) FillHistogramTH2(fOutputContainer,"hMggFromK0S_asym08",m12,pt12,weight);
+            FillHistogramTH2(fHistograms.Get(kHMggFromK0S),m12,pt12,weight);
+            if(asym < 0.8) FillHistogramTH2(fHistograms.Get(kHMggFromK0S_asym08),m12,pt12,weight);
           }
         }
         if(IsFrom(primary1,TrueL0Pt,3122) && IsFrom(primary2,TrueL0Pt,3122) && commonID > -1){
@@ -2049,8 +2613,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMgg()
           AliAODMCParticle *p = (AliAODMCParticle*)fMCArrayAOD->At(commonID);
           Int_t pdg = p->PdgCode(); 
           if(pdg1 == 22 && pdg2 == 22 && pdg == 111){
-            FillHistogramTH2(fOutputContainer,"hMggFromLambda0",m12,pt12,weight);
-            if(asym < 0.8) FillHistogramTH2(fOutputContainer,"hMggFromLambda0_asym08",m12,pt12,weight);
+            FillHistogramTH2(fHistograms.Get(kHMggFromLambda0),m12,pt12,weight);
+            if(asym < 0.8) FillHistogramTH2(fHistograms.Get(kHMggFromLambda0_asym08),m12,pt12,weight);
           }
         }
 
@@ -2078,17 +2642,17 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMgg()
 
       if(fIsOAStudy){
         Double_t oa = TMath::Abs(ph1->Angle(ph2->Vect())) * 1e+3;//rad->mrad
-        FillHistogramTH3(fOutputContainer,"hMgg_OA",m12,pt12,oa,weight);
+        FillHistogramTH3(fHistograms.Get(kHMgg_OA),m12,pt12,oa,weight);
       }
       if(m12 > 0.96) continue;//reduce entry in THnSparse
 
-      if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMgg_M%d%d",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,weight * 1/trgeff12);
+      if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fHistograms.Get(kHMgg_M, TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,weight * 1/trgeff12);
       FillSparse(fOutputContainer,"hSparseMgg",value,weight * 1/trgeff12);
 
       if(ph1->IsTOFOK() && ph2->IsTOFOK()){
         FillSparse(fOutputContainer,"hSparseMgg_TOF",value,1/eff12 * weight * 1/trgeff12);
 
-        if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMgg_M%d%d_TOF",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,1/eff12 * weight * 1/trgeff12);
+        if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fHistograms.Get(kHMgg_M_TOF, TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,1/eff12 * weight * 1/trgeff12);
 
       }//end of TOF cut
 
@@ -2214,19 +2778,19 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixMgg()
 
         if(fIsOAStudy){
           Double_t oa = TMath::Abs(ph1->Angle(ph2->Vect())) * 1e+3;//rad->mrad
-          FillHistogramTH3(fOutputContainer,"hMixMgg_OA",m12,pt12,oa,weight);
+          FillHistogramTH3(fHistograms.Get(kHMixMgg_OA),m12,pt12,oa,weight);
         }
 
         if(m12 > 0.96) continue;//reduce entry in THnSparse
 
         FillSparse(fOutputContainer,"hSparseMixMgg",value,weight * 1/trgeff12);
 
-        if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12, weight * 1/trgeff12);
+        if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fHistograms.Get(kHMixMgg_M, TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12, weight * 1/trgeff12);
 
         if(ph1->IsTOFOK() && ph2->IsTOFOK()){
           FillSparse(fOutputContainer,"hSparseMixMgg_TOF",value,1/eff12 * weight * 1/trgeff12);
 
-          if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fOutputContainer,Form("hMixMgg_M%d%d_TOF",TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,1/eff12 * weight * 1/trgeff12);
+          if(TMath::Abs(ph1->Module()-ph2->Module()) < 2) FillHistogramTH2(fHistograms.Get(kHMixMgg_M_TOF, TMath::Min(ph1->Module(),ph2->Module()), TMath::Max(ph1->Module(),ph2->Module())),m12,pt12,1/eff12 * weight * 1/trgeff12);
 
         }//end of TOF cut
 
@@ -2565,27 +3129,27 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillEpRatio()
       TVector3 global1(position);
       fPHOSGeo->Global2Local(localPos,global1,module);
 
-      FillHistogramTH3(fOutputContainer,Form("hdZvsZvsTrackPt_M%d",module),localPos.Z(),trackDz,trackPt);//tracks bended to only phi direction
+      FillHistogramTH3(fHistograms.Get(kHDZvsZvsTrackPt_M, module),localPos.Z(),trackDz,trackPt);//tracks bended to only phi direction
 
-      if(trackC > 0) FillHistogramTH3(fOutputContainer,Form("hdXvsXvsTrackPt_plus_M%d",module) ,localPos.X(),trackDx,trackPt);//positive
-      else           FillHistogramTH3(fOutputContainer,Form("hdXvsXvsTrackPt_minus_M%d",module),localPos.X(),trackDx,trackPt);//negative
+      if(trackC > 0) FillHistogramTH3(fHistograms.Get(kHDXvsXvsTrackPt_plus_M, module),localPos.X(),trackDx,trackPt);//positive
+      else           FillHistogramTH3(fHistograms.Get(kHDXvsXvsTrackPt_minus_M, module),localPos.X(),trackDx,trackPt);//negative
 
       if(!cuts->AcceptElectron(ph)) continue;
 
       nsigmaElectron = fPIDResponse->NumberOfSigmasTPC(track,AliPID::kElectron);
-      FillHistogramTH2(fOutputContainer,"hEpRatiovsNsigmaElectronTPC",energy/trackP,nsigmaElectron);
+      FillHistogramTH2(fHistograms.Get(kHEpRatiovsNsigmaElectronTPC),energy/trackP,nsigmaElectron);
       if(-2 < nsigmaElectron && nsigmaElectron < 3) PID_ele = kTRUE;
 
       if(PID_ele){
-        FillHistogramTH2(fOutputContainer,Form("hEpRatiovsEnergy_M%d_Electron" ,module),energy/trackP,energy);
-        FillHistogramTH2(fOutputContainer,Form("hEpRatiovsTrackPt_M%d_Electron",module),energy/trackP,trackPt);
-        FillHistogramTH2(fOutputContainer,"hTPCdEdx_Electron",trackP,dEdx);
-        if(0.8 < energy/trackP && energy/trackP < 1.2) FillHistogramTH3(fOutputContainer,Form("hdZvsZvsTrackPtElectron_M%d",module),localPos.Z(),trackDz,trackPt);//for alignment study
+        FillHistogramTH2(fHistograms.Get(kHEpRatiovsEnergy_M_Electron, module),energy/trackP,energy);
+        FillHistogramTH2(fHistograms.Get(kHEpRatiovsTrackPt_M_Electron, module),energy/trackP,trackPt);
+        FillHistogramTH2(fHistograms.Get(kHTPCdEdx_Electron),trackP,dEdx);
+        if(0.8 < energy/trackP && energy/trackP < 1.2) FillHistogramTH3(fHistograms.Get(kHDZvsZvsTrackPtElectron_M, module),localPos.Z(),trackDz,trackPt);//for alignment study
       }
       if(nsigmaElectron < -3 || 5 < nsigmaElectron){//non-electron and far from border
-        FillHistogramTH2(fOutputContainer,Form("hEpRatiovsEnergy_M%d_Others" ,module),energy/trackP,energy);
-        FillHistogramTH2(fOutputContainer,Form("hEpRatiovsTrackPt_M%d_Others",module),energy/trackP,trackPt);
-        FillHistogramTH2(fOutputContainer,"hTPCdEdx_Others",trackP,dEdx);
+        FillHistogramTH2(fHistograms.Get(kHEpRatiovsEnergy_M_Others, module),energy/trackP,energy);
+        FillHistogramTH2(fHistograms.Get(kHEpRatiovsTrackPt_M_Others, module),energy/trackP,trackPt);
+        FillHistogramTH2(fHistograms.Get(kHTPCdEdx_Others),trackP,dEdx);
       }
 
     }//end of track matching
@@ -2664,11 +3228,11 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimatePIDCutEfficiency()
       value[4] = ph2->GetLambda2();
       if(fPIDStudy) FillSparse(fOutputContainer,"hSparseMgg_PID",value,weight);
 
-      FillHistogramTH2(fOutputContainer,"hMgg_Probe_PID",m12,pT,weight);
+      FillHistogramTH2(fHistograms.Get(kHMgg_Probe_PID),m12,pT,weight);
 
-      if(fPHOSClusterCuts->IsNeutral(ph2))    FillHistogramTH2(fOutputContainer,"hMgg_PassingProbe_CPV" ,m12,pT,weight);
-      if(fPHOSClusterCuts->AcceptDisp(ph2))   FillHistogramTH2(fOutputContainer,"hMgg_PassingProbe_Disp",m12,pT,weight);
-      if(fPHOSClusterCuts->AcceptPhoton(ph2)) FillHistogramTH2(fOutputContainer,"hMgg_PassingProbe_PID" ,m12,pT,weight);
+      if(fPHOSClusterCuts->IsNeutral(ph2))    FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_CPV),m12,pT,weight);
+      if(fPHOSClusterCuts->AcceptDisp(ph2))   FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_Disp),m12,pT,weight);
+      if(fPHOSClusterCuts->AcceptPhoton(ph2)) FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_PID),m12,pT,weight);
 
     }//end of ph2
 
@@ -2720,10 +3284,10 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimatePIDCutEfficiency()
         value[4] = ph2->GetLambda2();
         if(fPIDStudy) FillSparse(fOutputContainer,"hSparseMixMgg_PID",value,weight);
 
-        FillHistogramTH2(fOutputContainer,"hMixMgg_Probe_PID",m12,pT,weight);
-        if(fPHOSClusterCuts->IsNeutral(ph2))    FillHistogramTH2(fOutputContainer,"hMixMgg_PassingProbe_CPV" ,m12,pT,weight);
-        if(fPHOSClusterCuts->AcceptDisp(ph2))   FillHistogramTH2(fOutputContainer,"hMixMgg_PassingProbe_Disp",m12,pT,weight);
-        if(fPHOSClusterCuts->AcceptPhoton(ph2)) FillHistogramTH2(fOutputContainer,"hMixMgg_PassingProbe_PID" ,m12,pT,weight);
+        FillHistogramTH2(fHistograms.Get(kHMixMgg_Probe_PID),m12,pT,weight);
+        if(fPHOSClusterCuts->IsNeutral(ph2))    FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_CPV),m12,pT,weight);
+        if(fPHOSClusterCuts->AcceptDisp(ph2))   FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_Disp),m12,pT,weight);
+        if(fPHOSClusterCuts->AcceptPhoton(ph2)) FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_PID),m12,pT,weight);
 
       }//end of mix
 
@@ -2769,8 +3333,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimateTOFCutEfficiency()
         energy = (ph2->GetMomV2())->Energy();
       }
 
-      FillHistogramTH2(fOutputContainer,"hMgg_Probe_TOF",m12,energy);
-      if(ph2->IsTOFOK()) FillHistogramTH2(fOutputContainer,"hMgg_PassingProbe_TOF",m12,energy);
+      FillHistogramTH2(fHistograms.Get(kHMgg_Probe_TOF),m12,energy);
+      if(ph2->IsTOFOK()) FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_TOF),m12,energy);
 
     }//end of ph2
 
@@ -2805,8 +3369,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimateTOFCutEfficiency()
           energy = (ph2->GetMomV2())->Energy();
         }
 
-        FillHistogramTH2(fOutputContainer,"hMixMgg_Probe_TOF",m12,energy);
-        if(ph2->IsTOFOK()) FillHistogramTH2(fOutputContainer,"hMixMgg_PassingProbe_TOF",m12,energy);
+        FillHistogramTH2(fHistograms.Get(kHMixMgg_Probe_TOF),m12,energy);
+        if(ph2->IsTOFOK()) FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_TOF),m12,energy);
 
       }//end of mix
 
@@ -2908,21 +3472,21 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::DDAPhotonPurity()
       if((nsigmaProton   < TMath::Abs(nsigmaElectron)) && (nsigmaProton   < nsigmaPion) && (nsigmaProton   < nsigmaKaon)   && (nsigmaProton   < NsigmaCut)) pidProton = kTRUE;
 
       if(ph->GetNsigmaCPV() < fMatchingR){//matching cut to evaluate dispersion cut efficiency for charged particle.
-        if(pidElectron && (0.8 < cluE/trackP && cluE/trackP < 1.2))  FillHistogramTH1(fOutputContainer,"hMatchedElectron",pT,weight);
-        else if(pidPion) FillHistogramTH1(fOutputContainer,"hMatchedPion",pT,weight);
-        else if(pidKaon) FillHistogramTH1(fOutputContainer,"hMatchedKaon",pT,weight);
+        if(pidElectron && (0.8 < cluE/trackP && cluE/trackP < 1.2))  FillHistogramTH1(fHistograms.Get(kHMatchedElectron),pT,weight);
+        else if(pidPion) FillHistogramTH1(fHistograms.Get(kHMatchedPion),pT,weight);
+        else if(pidKaon) FillHistogramTH1(fHistograms.Get(kHMatchedKaon),pT,weight);
         else if(pidProton){
-          if(charge > 0) FillHistogramTH1(fOutputContainer,"hMatchedProton",pT,weight);
-          else           FillHistogramTH1(fOutputContainer,"hMatchedAntiProton",pT,weight);
+          if(charge > 0) FillHistogramTH1(fHistograms.Get(kHMatchedProton),pT,weight);
+          else           FillHistogramTH1(fHistograms.Get(kHMatchedAntiProton),pT,weight);
         }
 
         if(fPHOSClusterCuts->AcceptDisp(ph)){
-          if(pidElectron && (0.8 < cluE/trackP && cluE/trackP < 1.2))  FillHistogramTH1(fOutputContainer,"hMatchedElectron_Disp",pT,weight);
-          else if(pidPion) FillHistogramTH1(fOutputContainer,"hMatchedPion_Disp",pT,weight);
-          else if(pidKaon) FillHistogramTH1(fOutputContainer,"hMatchedKaon_Disp",pT,weight);
+          if(pidElectron && (0.8 < cluE/trackP && cluE/trackP < 1.2))  FillHistogramTH1(fHistograms.Get(kHMatchedElectron_Disp),pT,weight);
+          else if(pidPion) FillHistogramTH1(fHistograms.Get(kHMatchedPion_Disp),pT,weight);
+          else if(pidKaon) FillHistogramTH1(fHistograms.Get(kHMatchedKaon_Disp),pT,weight);
           else if(pidProton){
-            if(charge > 0) FillHistogramTH1(fOutputContainer,"hMatchedProton_Disp",pT,weight);
-            else           FillHistogramTH1(fOutputContainer,"hMatchedAntiProton_Disp",pT,weight);
+            if(charge > 0) FillHistogramTH1(fHistograms.Get(kHMatchedProton_Disp),pT,weight);
+            else           FillHistogramTH1(fHistograms.Get(kHMatchedAntiProton_Disp),pT,weight);
           }
         }//end of disp
 
@@ -2948,63 +3512,63 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::DDAPhotonPurity()
       //border of Rxy is 250 cm from (0,0,0) where TPC outer frame is.
       //only for safety mergin, 240 cm is used.
 
-      if(pdg == 22) FillHistogramTH1(fOutputContainer,"hPurityGamma_noPID",pT,weight);
+      if(pdg == 22) FillHistogramTH1(fHistograms.Get(kHPurityGamma_noPID),pT,weight);
 
       else if(TMath::Abs(pdg) == 11){
-        FillHistogramTH2(fOutputContainer,"hElectronRxy_noPID",pT,Rxy,weight);
+        FillHistogramTH2(fHistograms.Get(kHElectronRxy_noPID),pT,Rxy,weight);
         if(motherid > -1 && pdg_mother == 22){//conversion gamma->ee
-          FillHistogramTH2(fOutputContainer,"hConvertedElectronRxy_noPID",pT,Rxy,weight);
-          if(Rxy < Rcut_CE) FillHistogramTH1(fOutputContainer,"hPurityElectron_noPID",pT,weight);
-          else              FillHistogramTH1(fOutputContainer,"hPurityLCE_noPID",pT,weight);
+          FillHistogramTH2(fHistograms.Get(kHConvertedElectronRxy_noPID),pT,Rxy,weight);
+          if(Rxy < Rcut_CE) FillHistogramTH1(fHistograms.Get(kHPurityElectron_noPID),pT,weight);
+          else              FillHistogramTH1(fHistograms.Get(kHPurityLCE_noPID),pT,weight);
         }
-        else FillHistogramTH1(fOutputContainer,"hPurityElectron_noPID",pT,weight);
+        else FillHistogramTH1(fHistograms.Get(kHPurityElectron_noPID),pT,weight);
       }
-      else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fOutputContainer,"hPurityPion_noPID",pT,weight);
-      else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fOutputContainer,"hPurityKaon_noPID",pT,weight);
-      else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fOutputContainer,"hPurityK0L_noPID",pT,weight);
-      else if(pdg ==  2212)           FillHistogramTH1(fOutputContainer,"hPurityProton_noPID",pT,weight);
-      else if(pdg == -2212)           FillHistogramTH1(fOutputContainer,"hPurityAntiProton_noPID",pT,weight);
-      else if(pdg ==  2112)           FillHistogramTH1(fOutputContainer,"hPurityNeutron_noPID",pT,weight);
-      else if(pdg == -2112)           FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_noPID",pT,weight);
+      else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fHistograms.Get(kHPurityPion_noPID),pT,weight);
+      else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fHistograms.Get(kHPurityKaon_noPID),pT,weight);
+      else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fHistograms.Get(kHPurityK0L_noPID),pT,weight);
+      else if(pdg ==  2212)           FillHistogramTH1(fHistograms.Get(kHPurityProton_noPID),pT,weight);
+      else if(pdg == -2212)           FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_noPID),pT,weight);
+      else if(pdg ==  2112)           FillHistogramTH1(fHistograms.Get(kHPurityNeutron_noPID),pT,weight);
+      else if(pdg == -2112)           FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_noPID),pT,weight);
       else{
         if(pdg == 111){//hadronic interaction
           //printf("mother pdg of %d is %d and production vertex = %4.3f\n",pdg,pdg_mother,Rxy);
-          if(pdg_mother ==  2212)      FillHistogramTH1(fOutputContainer,"hPurityProton_noPID",pT,weight);
-          else if(pdg_mother == -2212) FillHistogramTH1(fOutputContainer,"hPurityAntiProton_noPID",pT,weight);
-          else if(pdg_mother ==  2112) FillHistogramTH1(fOutputContainer,"hPurityNeutron_noPID",pT,weight);
-          else if(pdg_mother == -2112) FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_noPID",pT,weight);
-          else                         FillHistogramTH1(fOutputContainer,"hPurityOthers_noPID",pT,weight);
+          if(pdg_mother ==  2212)      FillHistogramTH1(fHistograms.Get(kHPurityProton_noPID),pT,weight);
+          else if(pdg_mother == -2212) FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_noPID),pT,weight);
+          else if(pdg_mother ==  2112) FillHistogramTH1(fHistograms.Get(kHPurityNeutron_noPID),pT,weight);
+          else if(pdg_mother == -2112) FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_noPID),pT,weight);
+          else                         FillHistogramTH1(fHistograms.Get(kHPurityOthers_noPID),pT,weight);
         }
-        else                           FillHistogramTH1(fOutputContainer,"hPurityOthers_noPID",pT,weight);
+        else                           FillHistogramTH1(fHistograms.Get(kHPurityOthers_noPID),pT,weight);
       }
 
       if(fPHOSClusterCuts->IsNeutral(ph)){
-        if(pdg == 22) FillHistogramTH1(fOutputContainer,"hPurityGamma_CPV",pT,weight);
+        if(pdg == 22) FillHistogramTH1(fHistograms.Get(kHPurityGamma_CPV),pT,weight);
         else if(TMath::Abs(pdg) == 11){
-          FillHistogramTH2(fOutputContainer,"hElectronRxy_CPV",pT,Rxy,weight);
+          FillHistogramTH2(fHistograms.Get(kHElectronRxy_CPV),pT,Rxy,weight);
           if(motherid > -1 && pdg_mother == 22){//conversion gamma->ee
-            FillHistogramTH2(fOutputContainer,"hConvertedElectronRxy_CPV",pT,Rxy,weight);
-            if(Rxy < Rcut_CE) FillHistogramTH1(fOutputContainer,"hPurityElectron_CPV",pT,weight);
-            else              FillHistogramTH1(fOutputContainer,"hPurityLCE_CPV",pT,weight);
+            FillHistogramTH2(fHistograms.Get(kHConvertedElectronRxy_CPV),pT,Rxy,weight);
+            if(Rxy < Rcut_CE) FillHistogramTH1(fHistograms.Get(kHPurityElectron_CPV),pT,weight);
+            else              FillHistogramTH1(fHistograms.Get(kHPurityLCE_CPV),pT,weight);
           }
-          else FillHistogramTH1(fOutputContainer,"hPurityElectron_CPV",pT,weight);
+          else FillHistogramTH1(fHistograms.Get(kHPurityElectron_CPV),pT,weight);
         }
-        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fOutputContainer,"hPurityPion_CPV",pT,weight);
-        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fOutputContainer,"hPurityKaon_CPV",pT,weight);
-        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fOutputContainer,"hPurityK0L_CPV",pT,weight);
-        else if(pdg ==  2212)           FillHistogramTH1(fOutputContainer,"hPurityProton_CPV",pT,weight);
-        else if(pdg == -2212)           FillHistogramTH1(fOutputContainer,"hPurityAntiProton_CPV",pT,weight);
-        else if(pdg ==  2112)           FillHistogramTH1(fOutputContainer,"hPurityNeutron_CPV",pT,weight);
-        else if(pdg == -2112)           FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_CPV",pT,weight);
+        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fHistograms.Get(kHPurityPion_CPV),pT,weight);
+        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fHistograms.Get(kHPurityKaon_CPV),pT,weight);
+        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fHistograms.Get(kHPurityK0L_CPV),pT,weight);
+        else if(pdg ==  2212)           FillHistogramTH1(fHistograms.Get(kHPurityProton_CPV),pT,weight);
+        else if(pdg == -2212)           FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_CPV),pT,weight);
+        else if(pdg ==  2112)           FillHistogramTH1(fHistograms.Get(kHPurityNeutron_CPV),pT,weight);
+        else if(pdg == -2112)           FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_CPV),pT,weight);
         else{
           if(pdg == 111){//hadronic interaction
-            if(pdg_mother ==  2212)      FillHistogramTH1(fOutputContainer,"hPurityProton_CPV",pT,weight);
-            else if(pdg_mother == -2212) FillHistogramTH1(fOutputContainer,"hPurityAntiProton_CPV",pT,weight);
-            else if(pdg_mother ==  2112) FillHistogramTH1(fOutputContainer,"hPurityNeutron_CPV",pT,weight);
-            else if(pdg_mother == -2112) FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_CPV",pT,weight);
-            else                         FillHistogramTH1(fOutputContainer,"hPurityOthers_CPV",pT,weight);
+            if(pdg_mother ==  2212)      FillHistogramTH1(fHistograms.Get(kHPurityProton_CPV),pT,weight);
+            else if(pdg_mother == -2212) FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_CPV),pT,weight);
+            else if(pdg_mother ==  2112) FillHistogramTH1(fHistograms.Get(kHPurityNeutron_CPV),pT,weight);
+            else if(pdg_mother == -2112) FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_CPV),pT,weight);
+            else                         FillHistogramTH1(fHistograms.Get(kHPurityOthers_CPV),pT,weight);
           }
-          else                           FillHistogramTH1(fOutputContainer,"hPurityOthers_CPV",pT,weight);
+          else                           FillHistogramTH1(fHistograms.Get(kHPurityOthers_CPV),pT,weight);
         }
 
 
@@ -3013,64 +3577,64 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::DDAPhotonPurity()
       }//end of CPV
 
       if(fPHOSClusterCuts->AcceptDisp(ph)){
-        if(pdg == 22)                   FillHistogramTH1(fOutputContainer,"hPurityGamma_Disp",pT,weight);
+        if(pdg == 22)                   FillHistogramTH1(fHistograms.Get(kHPurityGamma_Disp),pT,weight);
         else if(TMath::Abs(pdg) == 11){
-          FillHistogramTH2(fOutputContainer,"hElectronRxy_Disp",pT,Rxy,weight);
+          FillHistogramTH2(fHistograms.Get(kHElectronRxy_Disp),pT,Rxy,weight);
           if(motherid > -1 && pdg_mother == 22){//conversion gamma->ee
-            FillHistogramTH2(fOutputContainer,"hConvertedElectronRxy_Disp",pT,Rxy,weight);
-            if(Rxy < Rcut_CE) FillHistogramTH1(fOutputContainer,"hPurityElectron_Disp",pT,weight);
-            else              FillHistogramTH1(fOutputContainer,"hPurityLCE_Disp",pT,weight);
+            FillHistogramTH2(fHistograms.Get(kHConvertedElectronRxy_Disp),pT,Rxy,weight);
+            if(Rxy < Rcut_CE) FillHistogramTH1(fHistograms.Get(kHPurityElectron_Disp),pT,weight);
+            else              FillHistogramTH1(fHistograms.Get(kHPurityLCE_Disp),pT,weight);
           }
-          else FillHistogramTH1(fOutputContainer,"hPurityElectron_Disp",pT,weight);
+          else FillHistogramTH1(fHistograms.Get(kHPurityElectron_Disp),pT,weight);
         }
-        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fOutputContainer,"hPurityPion_Disp",pT,weight);
-        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fOutputContainer,"hPurityKaon_Disp",pT,weight);
-        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fOutputContainer,"hPurityK0L_Disp",pT,weight);
-        else if(pdg ==  2212)           FillHistogramTH1(fOutputContainer,"hPurityProton_Disp",pT,weight);
-        else if(pdg == -2212)           FillHistogramTH1(fOutputContainer,"hPurityAntiProton_Disp",pT,weight);
-        else if(pdg ==  2112)           FillHistogramTH1(fOutputContainer,"hPurityNeutron_Disp",pT,weight);
-        else if(pdg == -2112)           FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_Disp",pT,weight);
+        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fHistograms.Get(kHPurityPion_Disp),pT,weight);
+        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fHistograms.Get(kHPurityKaon_Disp),pT,weight);
+        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fHistograms.Get(kHPurityK0L_Disp),pT,weight);
+        else if(pdg ==  2212)           FillHistogramTH1(fHistograms.Get(kHPurityProton_Disp),pT,weight);
+        else if(pdg == -2212)           FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_Disp),pT,weight);
+        else if(pdg ==  2112)           FillHistogramTH1(fHistograms.Get(kHPurityNeutron_Disp),pT,weight);
+        else if(pdg == -2112)           FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_Disp),pT,weight);
         else{
           if(pdg == 111){//hadronic interaction
-            if(pdg_mother ==  2212)      FillHistogramTH1(fOutputContainer,"hPurityProton_Disp",pT,weight);
-            else if(pdg_mother == -2212) FillHistogramTH1(fOutputContainer,"hPurityAntiProton_Disp",pT,weight);
-            else if(pdg_mother ==  2112) FillHistogramTH1(fOutputContainer,"hPurityNeutron_Disp",pT,weight);
-            else if(pdg_mother == -2112) FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_Disp",pT,weight);
-            else                         FillHistogramTH1(fOutputContainer,"hPurityOthers_Disp",pT,weight);
+            if(pdg_mother ==  2212)      FillHistogramTH1(fHistograms.Get(kHPurityProton_Disp),pT,weight);
+            else if(pdg_mother == -2212) FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_Disp),pT,weight);
+            else if(pdg_mother ==  2112) FillHistogramTH1(fHistograms.Get(kHPurityNeutron_Disp),pT,weight);
+            else if(pdg_mother == -2112) FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_Disp),pT,weight);
+            else                         FillHistogramTH1(fHistograms.Get(kHPurityOthers_Disp),pT,weight);
           }
-          else                           FillHistogramTH1(fOutputContainer,"hPurityOthers_Disp",pT,weight);
+          else                           FillHistogramTH1(fHistograms.Get(kHPurityOthers_Disp),pT,weight);
         }
 
 
       }//end of Disp
 
       if(fPHOSClusterCuts->AcceptPhoton(ph)){
-        if(pdg == 22)                   FillHistogramTH1(fOutputContainer,"hPurityGamma_PID",pT,weight);
+        if(pdg == 22)                   FillHistogramTH1(fHistograms.Get(kHPurityGamma_PID),pT,weight);
         else if(TMath::Abs(pdg) == 11){
-          FillHistogramTH2(fOutputContainer,"hElectronRxy_PID",pT,Rxy,weight);
+          FillHistogramTH2(fHistograms.Get(kHElectronRxy_PID),pT,Rxy,weight);
           if(motherid > -1 && pdg_mother == 22){//conversion gamma->ee
-            FillHistogramTH2(fOutputContainer,"hConvertedElectronRxy_PID",pT,Rxy,weight);
-            if(Rxy < Rcut_CE) FillHistogramTH1(fOutputContainer,"hPurityElectron_PID",pT,weight);
-            else              FillHistogramTH1(fOutputContainer,"hPurityLCE_PID",pT,weight);
+            FillHistogramTH2(fHistograms.Get(kHConvertedElectronRxy_PID),pT,Rxy,weight);
+            if(Rxy < Rcut_CE) FillHistogramTH1(fHistograms.Get(kHPurityElectron_PID),pT,weight);
+            else              FillHistogramTH1(fHistograms.Get(kHPurityLCE_PID),pT,weight);
           }
-          else FillHistogramTH1(fOutputContainer,"hPurityElectron_PID",pT,weight);
+          else FillHistogramTH1(fHistograms.Get(kHPurityElectron_PID),pT,weight);
         }
-        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fOutputContainer,"hPurityPion_PID",pT,weight);
-        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fOutputContainer,"hPurityKaon_PID",pT,weight);
-        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fOutputContainer,"hPurityK0L_PID",pT,weight);
-        else if(pdg ==  2212)           FillHistogramTH1(fOutputContainer,"hPurityProton_PID",pT,weight);
-        else if(pdg == -2212)           FillHistogramTH1(fOutputContainer,"hPurityAntiProton_PID",pT,weight);
-        else if(pdg ==  2112)           FillHistogramTH1(fOutputContainer,"hPurityNeutron_PID",pT,weight);
-        else if(pdg == -2112)           FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_PID",pT,weight);
+        else if(TMath::Abs(pdg) == 211) FillHistogramTH1(fHistograms.Get(kHPurityPion_PID),pT,weight);
+        else if(TMath::Abs(pdg) == 321) FillHistogramTH1(fHistograms.Get(kHPurityKaon_PID),pT,weight);
+        else if(TMath::Abs(pdg) == 130) FillHistogramTH1(fHistograms.Get(kHPurityK0L_PID),pT,weight);
+        else if(pdg ==  2212)           FillHistogramTH1(fHistograms.Get(kHPurityProton_PID),pT,weight);
+        else if(pdg == -2212)           FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_PID),pT,weight);
+        else if(pdg ==  2112)           FillHistogramTH1(fHistograms.Get(kHPurityNeutron_PID),pT,weight);
+        else if(pdg == -2112)           FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_PID),pT,weight);
         else{
           if(pdg == 111){//hadronic interaction
-            if(pdg_mother ==  2212)      FillHistogramTH1(fOutputContainer,"hPurityProton_PID",pT,weight);
-            else if(pdg_mother == -2212) FillHistogramTH1(fOutputContainer,"hPurityAntiProton_PID",pT,weight);
-            else if(pdg_mother ==  2112) FillHistogramTH1(fOutputContainer,"hPurityNeutron_PID",pT,weight);
-            else if(pdg_mother == -2112) FillHistogramTH1(fOutputContainer,"hPurityAntiNeutron_PID",pT,weight);
-            else                         FillHistogramTH1(fOutputContainer,"hPurityOthers_PID",pT,weight);
+            if(pdg_mother ==  2212)      FillHistogramTH1(fHistograms.Get(kHPurityProton_PID),pT,weight);
+            else if(pdg_mother == -2212) FillHistogramTH1(fHistograms.Get(kHPurityAntiProton_PID),pT,weight);
+            else if(pdg_mother ==  2112) FillHistogramTH1(fHistograms.Get(kHPurityNeutron_PID),pT,weight);
+            else if(pdg_mother == -2112) FillHistogramTH1(fHistograms.Get(kHPurityAntiNeutron_PID),pT,weight);
+            else                         FillHistogramTH1(fHistograms.Get(kHPurityOthers_PID),pT,weight);
           }
-          else                           FillHistogramTH1(fOutputContainer,"hPurityOthers_PID",pT,weight);
+          else                           FillHistogramTH1(fHistograms.Get(kHPurityOthers_PID),pT,weight);
         }
 
       }//end of PID
@@ -3200,12 +3764,12 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::SelectTriggeredCluster()
     cellz  = relId[3];
     tru = fPHOSTriggerHelper->WhichTRU(cellx,cellz);
 
-    FillHistogramTH1(fOutputContainer,Form("hClusterE_M%d_TRU%d",module,tru),energy);
-    if(ph->IsTrig()) FillHistogramTH1(fOutputContainer,Form("hTriggeredClusterE_M%d_TRU%d",module,tru),energy);
+    FillHistogramTH1(fHistograms.Get(kHClusterE_M_TRU, module, tru),energy);
+    if(ph->IsTrig()) FillHistogramTH1(fHistograms.Get(kHTriggeredClusterE_M_TRU, module, tru),energy);
     //for the QA purpose, TOF cut efficiency is not corrected.
     if(ph->IsTOFOK()){
-      FillHistogramTH1(fOutputContainer,Form("hClusterE_TOF_M%d_TRU%d",module,tru),energy);
-      if(ph->IsTrig()) FillHistogramTH1(fOutputContainer,Form("hTriggeredClusterE_TOF_M%d_TRU%d",module,tru),energy);
+      FillHistogramTH1(fHistograms.Get(kHClusterE_TOF_M_TRU, module, tru),energy);
+      if(ph->IsTrig()) FillHistogramTH1(fHistograms.Get(kHTriggeredClusterE_TOF_M_TRU, module, tru),energy);
     }
   }//end of cluster loop
 
@@ -3329,12 +3893,12 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimateTriggerEfficiency()
       //AliInfo(Form("DeltaR between 2 gammas = %e, DeltaR_tag = %e , DeltaR_probe = = %e.",DeltaRgg,DeltaR_tag,DeltaR_probe));
       //if(DeltaRgg < Rlimit) continue;//efficiency can be measured at low pT by pi0 and at high pT by eta meson.
 
-      FillHistogramTH2(fOutputContainer,"hMgg_Probe_Trg",m12,energy);
-      FillHistogramTH2(fOutputContainer,Form("hMgg_Probe_Trg_M%d_TRU%d",module,tru),m12,energy);
+      FillHistogramTH2(fHistograms.Get(kHMgg_Probe_Trg),m12,energy);
+      FillHistogramTH2(fHistograms.Get(kHMgg_Probe_Trg_M_TRU, module, tru),m12,energy);
 
       if(ph2->IsTrig()){
-        FillHistogramTH2(fOutputContainer,"hMgg_PassingProbe_Trg",m12,energy);
-        FillHistogramTH2(fOutputContainer,Form("hMgg_PassingProbe_Trg_M%d_TRU%d",module,tru),m12,energy);
+        FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_Trg),m12,energy);
+        FillHistogramTH2(fHistograms.Get(kHMgg_PassingProbe_Trg_M_TRU, module, tru),m12,energy);
       }
 
     }//end of ph2
@@ -3401,11 +3965,11 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::EstimateTriggerEfficiency()
         //DeltaRgg = TMath::Sqrt(TMath::Power(eta_tag - eta_probe,2) + TMath::Power(phi_tag - phi_probe,2));
         //if(DeltaRgg < Rlimit) continue;
 
-        FillHistogramTH2(fOutputContainer,"hMixMgg_Probe_Trg",m12,energy);
-        FillHistogramTH2(fOutputContainer,Form("hMixMgg_Probe_Trg_M%d_TRU%d",module,tru),m12,energy);
+        FillHistogramTH2(fHistograms.Get(kHMixMgg_Probe_Trg),m12,energy);
+        FillHistogramTH2(fHistograms.Get(kHMixMgg_Probe_Trg_M_TRU, module, tru),m12,energy);
         if(ph2->IsTrig()){
-          FillHistogramTH2(fOutputContainer,"hMixMgg_PassingProbe_Trg",m12,energy);
-          FillHistogramTH2(fOutputContainer,Form("hMixMgg_PassingProbe_Trg_M%d_TRU%d",module,tru),m12,energy);
+          FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_Trg),m12,energy);
+          FillHistogramTH2(fHistograms.Get(kHMixMgg_PassingProbe_Trg_M_TRU, module, tru),m12,energy);
         }
       }//end of mix
 
@@ -3434,7 +3998,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
     else if(fAODEvent) pythiaGenHeader = fJJMCHandler->GetPythiaEventHeader(fAODEvent);
 
     Float_t pThard   = pythiaGenHeader->GetPtHard();
-    FillHistogramTH1(fOutputContainer,"hPtHard",pThard);
+    FillHistogramTH1(fHistograms.Get(kHPtHard),pThard);
 
     firstJetindex = fJJMCHandler->GetFirstJetIndex();
     lastJetindex  = fJJMCHandler->GetLastJetIndex();
@@ -3462,7 +4026,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
   Double_t pT=0, rapidity=0, phi=0;
   Double_t weight = 1;
   Int_t pdg = 0;
-  TString parname = "";
+  Int_t ipar = -1;
   TString genname = "";
   //Int_t motherid = -1;
   //AliAODMCParticle *mp = 0x0;//mother particle
@@ -3492,7 +4056,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       pdg = p->GetPdgCode();
 
 //      if(fMCArrayESD->IsPhysicalPrimary(i))
-//      FillHistogramTH1(fOutputContainer,"hPDGPhysicalPrimary",pdg);
+//      FillHistogramTH1(fHistograms.Get(kHPDGPhysicalPrimary),pdg);
 
       //rapidity is Y(), but, pseudo-rapidity is Eta();
 
@@ -3511,7 +4075,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       weight = 1.;
 
       if(pdg==111){//pi0
-        parname = "Pi0";
+        ipar = kGenPi0;
         weight = f1Pi0Weight->Eval(pT);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
@@ -3519,12 +4083,12 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
 
       }
       else if(pdg==221){//eta
-        parname = "Eta";
+        ipar = kGenEta;
         weight = f1EtaWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
 
       }
       else if(pdg==22){//gamma
-        parname = "Gamma";
+        ipar = kGenGamma;
         if(IsFrom(i,TruePi0Pt,111)) weight = f1Pi0Weight->Eval(TruePi0Pt);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
@@ -3532,13 +4096,13 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       }
   
       else if(pdg==223){//omega 782 meson
-        parname = "Omega";
+        ipar = kGenOmega;
         weight = 1.;
       }
 
       else if(pdg==211 || pdg==-211){//pi+ or pi-
         //c x tau = 7.8m
-        parname = "ChargedPion";
+        ipar = kGenChargedPion;
         weight = f1Pi0Weight->Eval(pT);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
@@ -3546,51 +4110,51 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       }
       else if(pdg==321 || pdg==-321){//K+ or K-
         //c x tau = 3.7m
-        parname = "ChargedKaon";
+        ipar = kGenChargedKaon;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(pdg==310){//K0S
         //c x tau = 2.7cm
-        parname = "K0S";
+        ipar = kGenK0S;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(pdg==130){//K0L
         //c x tau = 15.34m
-        parname = "K0L";
+        ipar = kGenK0L;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(TMath::Abs(pdg) == 3122){//Lmabda0
         //c x tau = 7.89cm
-        parname = "Lambda0";
+        ipar = kGenLambda0;
         weight = f1L0Weight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(TMath::Abs(pdg) == 3212){//Sigma0
-        parname = "Sigma0";
+        ipar = kGenSigma0;
         weight = 1.;
       }
       else if(pdg == 2212){//proton
-        parname = "Proton";
+        ipar = kGenProton;
         weight = 1.;
       }
       else if(pdg == -2212){//anti-proton
-        parname = "AntiProton";
+        ipar = kGenAntiProton;
         weight = 1.;
       }
       else if(pdg == 2112){//neutron
-        parname = "Neutron";
+        ipar = kGenNeutron;
         weight = 1.;
       }
       else if(pdg == -2112){//anti-neutron
-        parname = "AntiNeutron";
+        ipar = kGenAntiNeutron;
         weight = 1.;
       }
       else{
         continue;
       }
 
-      FillHistogramTH1(fOutputContainer,Form("hGen%sPt"    ,parname.Data()),pT          ,weight);
-      FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPhi",parname.Data()),phi,rapidity,weight);
-      FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPt" ,parname.Data()),rapidity,pT ,weight);
+      FillHistogramTH1(fHistograms.Get(kHGenPt + ipar),pT          ,weight);
+      FillHistogramTH2(fHistograms.Get(kHGenEtaPhi + ipar),phi,rapidity,weight);
+      FillHistogramTH2(fHistograms.Get(kHGenEtaPt + ipar),rapidity,pT ,weight);
 
     }//end of generated particle loop
 
@@ -3620,7 +4184,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       pdg = p->PdgCode();
 
       //if(p->IsPhysicalPrimary())
-      //  FillHistogramTH1(fOutputContainer,"hPDGPhysicalPrimary",pdg);
+      //  FillHistogramTH1(fHistograms.Get(kHPDGPhysicalPrimary),pdg);
 
       //rapidity is Y(), but, pseudo-rapidity is Eta();
 
@@ -3633,88 +4197,88 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
       weight = 1.;
 
       if(pdg==111){//pi0
-        parname = "Pi0";
+        ipar = kGenPi0;
         weight = f1Pi0Weight->Eval(pT);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
         if(IsFrom(i,TrueL0Pt,3122)) weight = f1L0Weight->Eval(TrueL0Pt)   * f1Pi0Weight->Eval(TrueL0Pt);
 
         if(Are2GammasInPHOSAcceptance(i)){
-          FillHistogramTH1(fOutputContainer,Form("hGen%sPtACC"    ,parname.Data()),pT          ,weight);
-          FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPhiACC",parname.Data()),phi,rapidity,weight);
-          FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPtACC" ,parname.Data()),rapidity,pT ,weight);
+          FillHistogramTH1(fHistograms.Get(kHGenPtACC + ipar),pT          ,weight);
+          FillHistogramTH2(fHistograms.Get(kHGenEtaPhiACC + ipar),phi,rapidity,weight);
+          FillHistogramTH2(fHistograms.Get(kHGenEtaPtACC + ipar),rapidity,pT ,weight);
         }
 
       }
       else if(pdg==221){//eta
-        parname = "Eta";
+        ipar = kGenEta;
         weight = f1EtaWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
         if(Are2GammasInPHOSAcceptance(i)){
-          FillHistogramTH1(fOutputContainer,Form("hGen%sPtACC"    ,parname.Data()),pT          ,weight);
-          FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPhiACC",parname.Data()),phi,rapidity,weight);
-          FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPtACC" ,parname.Data()),rapidity,pT ,weight);
+          FillHistogramTH1(fHistograms.Get(kHGenPtACC + ipar),pT          ,weight);
+          FillHistogramTH2(fHistograms.Get(kHGenEtaPhiACC + ipar),phi,rapidity,weight);
+          FillHistogramTH2(fHistograms.Get(kHGenEtaPtACC + ipar),rapidity,pT ,weight);
         }
       }
       else if(pdg==22){//gamma
-        parname = "Gamma";
+        ipar = kGenGamma;
         if(IsFrom(i,TruePi0Pt,111)) weight = f1Pi0Weight->Eval(TruePi0Pt);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
         if(IsFrom(i,TrueL0Pt,3122)) weight = f1L0Weight->Eval(TrueL0Pt)   * f1Pi0Weight->Eval(TrueL0Pt);
       }
       else if(pdg==223){//omega 782 meson
-        parname = "Omega";
+        ipar = kGenOmega;
         weight = 1.;
       }
       else if(pdg==211 || pdg==-211){//pi+ or pi-
-        parname = "ChargedPion";
+        ipar = kGenChargedPion;
         weight = f1Pi0Weight->Eval(pT);
         if(IsFrom(i,TrueK0SPt,310)) weight = f1K0SWeight->Eval(TrueK0SPt) * f1Pi0Weight->Eval(TrueK0SPt);
         if(IsFrom(i,TrueEtaPt,221)) weight = f1EtaWeight->Eval(TrueEtaPt) * f1Pi0Weight->Eval(TrueEtaPt);
         if(IsFrom(i,TrueL0Pt,3122)) weight = f1L0Weight->Eval(TrueL0Pt)   * f1Pi0Weight->Eval(TrueL0Pt);
       }
       else if(pdg==321 || pdg==-321){//K+ or K-
-        parname = "ChargedKaon";
+        ipar = kGenChargedKaon;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(pdg==310){//K0S
-        parname = "K0S";
+        ipar = kGenK0S;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(pdg==130){//K0L
-        parname = "K0L";
+        ipar = kGenK0L;
         weight = f1K0SWeight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(TMath::Abs(pdg) == 3122){//Lmabda0
-        parname = "Lambda0";
+        ipar = kGenLambda0;
         weight = f1L0Weight->Eval(pT) * f1Pi0Weight->Eval(pT);
       }
       else if(TMath::Abs(pdg) == 3212){//Sigma0
-        parname = "Sigma0";
+        ipar = kGenSigma0;
       }
       else if(pdg == 2212){//proton
-        parname = "Proton";
+        ipar = kGenProton;
         weight = 1.;
       }
       else if(pdg == -2212){//anti-proton
-        parname = "AntiProton";
+        ipar = kGenAntiProton;
         weight = 1.;
       }
       else if(pdg == 2112){//neutron
-        parname = "Neutron";
+        ipar = kGenNeutron;
         weight = 1.;
       }
       else if(pdg == -2112){//anti-neutron
-        parname = "AntiNeutron";
+        ipar = kGenAntiNeutron;
         weight = 1.;
       }
       else{
         continue;
       }
 
-      FillHistogramTH1(fOutputContainer,Form("hGen%sPt"    ,parname.Data()),pT          ,weight);
-      FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPhi",parname.Data()),phi,rapidity,weight);
-      FillHistogramTH2(fOutputContainer,Form("hGen%sEtaPt" ,parname.Data()),rapidity,pT ,weight);
+      FillHistogramTH1(fHistograms.Get(kHGenPt + ipar),pT          ,weight);
+      FillHistogramTH2(fHistograms.Get(kHGenEtaPhi + ipar),phi,rapidity,weight);
+      FillHistogramTH2(fHistograms.Get(kHGenEtaPt + ipar),rapidity,pT ,weight);
 
     }//end of generated particle loop
    
@@ -3734,8 +4298,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::ProcessMC()
     //  genID = p->GetGeneratorIndex();
 
     //  pdg = p->PdgCode();
-    //  FillHistogramTH1(fOutputContainer,"hPDGPhysicalPrimary",pdg);
-    //  if(p->MCStatusCode() == 1) FillHistogramTH1(fOutputContainer,"hPDGPhysicalPrimaryStable",pdg);
+    //  FillHistogramTH1(fHistograms.Get(kHPDGPhysicalPrimary),pdg);
+    //  if(p->MCStatusCode() == 1) FillHistogramTH1(fHistograms.Get(kHPDGPhysicalPrimaryStable),pdg);
 
     //  }
 
@@ -3936,21 +4500,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH1(TList *list, const
     AliError(Form("can not find histogram (of instance TH1) <%s> ",hname));
     return;
   }
-  else{
-    TString optstring(opt);
-    Double_t myweight = optstring.Contains("w") ? 1. : w;
-    if(optstring.Contains("wx")){
-      // use bin width as weight
-      Int_t bin = hist->GetXaxis()->FindBin(x);
-      // check if not overflow or underflow bin
-      if(bin != 0 && bin != hist->GetXaxis()->GetNbins()){
-        Double_t binwidth = hist->GetXaxis()->GetBinWidth(bin);
-        myweight = w/binwidth;
-      }
-    }
-    hist->Fill(x, myweight);
-    return;
-  }
+  FillHistogramTH1(hist,x,w,opt);
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH2(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t w, Option_t *opt) const
@@ -3960,20 +4510,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH2(TList *list, const
     AliError(Form("can not find histogram (of instance TH2) <%s> ",name));
     return;
   }
-  else{
-    TString optstring(opt);
-    Double_t myweight = optstring.Contains("w") ? 1. : w;
-    if(optstring.Contains("wx")){
-      Int_t binx = hist->GetXaxis()->FindBin(x);
-      if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-    }
-    if(optstring.Contains("wy")){
-      Int_t biny = hist->GetYaxis()->FindBin(y);
-      if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-    }
-    hist->Fill(x, y, myweight);
-    return;
-  }
+  FillHistogramTH2(hist,x,y,w,opt);
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH3(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t z, Double_t w, Option_t *opt) const
@@ -3983,24 +4520,71 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH3(TList *list, const
     AliError(Form("can not find histogram (of instance TH3) <%s> ",name));
     return;
   }
-  else{
-    TString optstring(opt);
-    Double_t myweight = optstring.Contains("w") ? 1. : w;
-    if(optstring.Contains("wx")){
-      Int_t binx = hist->GetXaxis()->FindBin(x);
-      if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
-    }
-    if(optstring.Contains("wy")){
-      Int_t biny = hist->GetYaxis()->FindBin(y);
-      if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
-    }
-    if(optstring.Contains("wz")){
-      Int_t binz = hist->GetZaxis()->FindBin(z);
-      if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
+  FillHistogramTH3(hist,x,y,z,w,opt);
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH1(TH1 *hist, Double_t x, Double_t w, Option_t *opt) const
+{
+  //Fill histogram of fHistograms (0 if not found, already reported by fHistograms)
+  if(!hist) return;
+
+  Double_t myweight = (opt && strchr(opt,'w')) ? 1. : w;
+  if(opt && strstr(opt,"wx")){
+    // use bin width as weight
+    Int_t bin = hist->GetXaxis()->FindBin(x);
+    // check if not overflow or underflow bin
+    if(bin != 0 && bin != hist->GetXaxis()->GetNbins()){
+      Double_t binwidth = hist->GetXaxis()->GetBinWidth(bin);
+      myweight = w/binwidth;
     }
-    hist->Fill(x, y, z, myweight);
+  }
+  hist->Fill(x, myweight);
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH2(TH1 *h, Double_t x, Double_t y, Double_t w, Option_t *opt) const
+{
+  if(!h) return;
+  if(h->GetDimension() != 2){
+    AliError(Form("can not find histogram (of instance TH2) <%s> ",h->GetName()));
     return;
   }
+
+  TH2 * hist = static_cast<TH2*>(h);
+  Double_t myweight = (opt && strchr(opt,'w')) ? 1. : w;
+  if(opt && strstr(opt,"wx")){
+    Int_t binx = hist->GetXaxis()->FindBin(x);
+    if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
+  }
+  if(optstring.Contains("wy")){
+    Int_t biny = hist->GetYaxis()->FindBin(y);
+    if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
+  }
+  hist->Fill(x, y, myweight);
+}
+//_____________________________________________________________________________
+void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillHistogramTH3(TH1 *h, Double_t x, Double_t y, Double_t z, Double_t w, Option_t *opt) const
+{
+  if(!h) return;
+  if(h->GetDimension() != 3){
+    AliError(Form("can not find histogram (of instance TH3) <%s> ",h->GetName()));
+    return;
+  }
+
+  TH3 * hist = static_cast<TH3*>(h);
+  Double_t myweight = (opt && strchr(opt,'w')) ? 1. : w;
+  if(opt && strstr(opt,"wx")){
+    Int_t binx = hist->GetXaxis()->FindBin(x);
+    if(binx != 0 && binx != hist->GetXaxis()->GetNbins()) myweight *= 1./hist->GetXaxis()->GetBinWidth(binx);
+  }
+  if(optstring.Contains("wy")){
+    Int_t biny = hist->GetYaxis()->FindBin(y);
+    if(biny != 0 && biny != hist->GetYaxis()->GetNbins()) myweight *= 1./hist->GetYaxis()->GetBinWidth(biny);
+  }
+  if(optstring.Contains("wz")){
+    Int_t binz = hist->GetZaxis()->FindBin(z);
+    if(binz != 0 && binz != hist->GetZaxis()->GetNbins()) myweight *= 1./hist->GetZaxis()->GetBinWidth(binz);
+  }
+  hist->Fill(x, y, z, myweight);
 }
 //_____________________________________________________________________________
 void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillProfile(TList *list, const Char_t *name, Double_t x, Double_t y) const
@@ -4210,10 +4794,10 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillRejectionFactorMB()
   Bool_t Is1PHMmatched = fPHOSTriggerHelperL1M->IsPHI7(fEvent,fPHOSClusterCuts,fEmin,fEnergyThreshold,fUseCoreEnergy);
   Bool_t Is1PHLmatched = fPHOSTriggerHelperL1L->IsPHI7(fEvent,fPHOSClusterCuts,fEmin,fEnergyThreshold,fUseCoreEnergy);
 
-  if(Is0PH0fired && Is0PH0matched) FillHistogramTH1(fOutputContainer,"hEventSummary", 7);//0PH0
-  if(Is1PHLfired && Is1PHHmatched) FillHistogramTH1(fOutputContainer,"hEventSummary", 8);//1PHL
-  if(Is1PHMfired && Is1PHMmatched) FillHistogramTH1(fOutputContainer,"hEventSummary", 9);//1PHM
-  if(Is1PHHfired && Is1PHLmatched) FillHistogramTH1(fOutputContainer,"hEventSummary",10);//1PHH
+  if(Is0PH0fired && Is0PH0matched) FillHistogramTH1(fHistograms.Get(kHEventSummary), 7);//0PH0
+  if(Is1PHLfired && Is1PHHmatched) FillHistogramTH1(fHistograms.Get(kHEventSummary), 8);//1PHL
+  if(Is1PHMfired && Is1PHMmatched) FillHistogramTH1(fHistograms.Get(kHEventSummary), 9);//1PHM
+  if(Is1PHHfired && Is1PHLmatched) FillHistogramTH1(fHistograms.Get(kHEventSummary),10);//1PHH
 
   if(Is0PH0fired) FillTriggerInfoMB(fPHOSTriggerHelperL0,-1);
   if(Is1PHLfired) FillTriggerInfoMB(fPHOSTriggerHelperL1L,2);
@@ -4236,12 +4820,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillTriggerInfoMB(AliPHOSTriggerHelp
   Int_t relId[4]={};
   Int_t module=0,cellx=0,cellz=0,tru=0;
 
-  TString type = "";
-  if(L1== -1) type = "L0";
-  else if(L1== 0) type = "L1H";
-  else if(L1== 1) type = "L1M";
-  else if(L1== 2) type = "L1L";
-  else{
+  if(L1 < -1 || L1 > 2){
     AliInfo(Form("Your choice of trigger type %d is wrong. return.",L1));
     return;
   }
@@ -4308,7 +4887,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillTriggerInfoMB(AliPHOSTriggerHelp
       }
 
       if(helper->IsMatched(trgrelId,relId)){
-        FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergy%s",type.Data()),energy);//matched cluster
+        FillHistogramTH1(fHistograms.Get(kHMatchedClusterEnergyType + L1 + 1),energy);//matched cluster
         //FillHistogramTH1(fOutputContainer,Form("hMatchedClusterEnergy%sM%dTRU%d",type.Data(),module,tru),energy);//all cluster
         break;//exit from trigger patch loop
       }
@@ -4397,7 +4976,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::DoNonLinearityStudy()
 
           }//end of if fIsMC
 
-          FillHistogramTH2(fOutputContainer,Form("hMgg_a%d_b%d",ia,ib),m12,pt12,weight);
+          FillHistogramTH2(fHistograms.Get(kHMgg_a_b, ia, ib),m12,pt12,weight);
 
         }//end of ph2
       }//end of ph1
@@ -4437,7 +5016,7 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::DoNonLinearityStudy()
               pt12 = p12core.Pt();
             }
 
-            FillHistogramTH2(fOutputContainer,Form("hMixMgg_a%d_b%d",ia,ib),m12,pt12);
+            FillHistogramTH2(fHistograms.Get(kHMixMgg_a_b, ia, ib),m12,pt12);
 
           }//end of mix
         }//end of ph2
@@ -4466,7 +5045,7 @@ Bool_t AliAnalysisTaskPHOSPi0EtaToGammaGamma::ExtractQnVector()
     }
     TPCEP[i] = QnVectorTPCDet[i]->EventPlane(fHarmonics);
     if(TPCEP[i] < 0) TPCEP[i] += 2./(Double_t) fHarmonics * TMath::Pi();
-    FillHistogramTH2(fOutputContainer,Form("hCentrality%svsEventPlane%s%s",fEstimator.Data(),fTPCEPName[i].Data(),fQNormalization.Data()),fCentralityMain,TPCEP[i]);
+    FillHistogramTH2(fHistograms.Get(kHCentralityvsEventPlaneTPC + i),fCentralityMain,TPCEP[i]);
     AliInfo(Form("harmonics %d | TPC sub detector name %s%s : event plane = %f (rad).",fHarmonics,fTPCEPName[i].Data(),fQNormalization.Data(),TPCEP[i]));
   }
 
@@ -4480,7 +5059,7 @@ Bool_t AliAnalysisTaskPHOSPi0EtaToGammaGamma::ExtractQnVector()
     }
     V0EP[i] = QnVectorV0Det[i]->EventPlane(fHarmonics);
     if(V0EP[i] < 0)  V0EP[i]  += 2./(Double_t) fHarmonics * TMath::Pi();
-    FillHistogramTH2(fOutputContainer,Form("hCentrality%svsEventPlane%s%s",fEstimator.Data(),fV0EPName[i].Data(),fQNormalization.Data()),fCentralityMain,V0EP[i]);
+    FillHistogramTH2(fHistograms.Get(kHCentralityvsEventPlaneV0 + i),fCentralityMain,V0EP[i]);
     AliInfo(Form("harmonics %d | V0  sub detector name %s%s : event plane = %f (rad).",fHarmonics,fV0EPName[i].Data(),fQNormalization.Data(),V0EP[i]));
   }
 
@@ -4564,25 +5143,25 @@ Bool_t AliAnalysisTaskPHOSPi0EtaToGammaGamma::ExtractQnVector()
   TVector2 QVector3(Q3[0],Q3[1]);
 
 
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsNormQ1",fEstimator.Data()),fCentralityMain,fQVector1.Mod());
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsNormQ2",fEstimator.Data()),fCentralityMain, QVector2.Mod());
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsNormQ3",fEstimator.Data()),fCentralityMain, QVector3.Mod());
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsNormQ1),fCentralityMain,fQVector1.Mod());
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsNormQ2),fCentralityMain, QVector2.Mod());
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsNormQ3),fCentralityMain, QVector3.Mod());
 
 
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ1x",fEstimator.Data()),fCentralityMain,Q1[0]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ1y",fEstimator.Data()),fCentralityMain,Q1[1]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ2x",fEstimator.Data()),fCentralityMain,Q2[0]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ2y",fEstimator.Data()),fCentralityMain,Q2[1]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ3x",fEstimator.Data()),fCentralityMain,Q3[0]);
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsQ3y",fEstimator.Data()),fCentralityMain,Q3[1]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ1x),fCentralityMain,Q1[0]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ1y),fCentralityMain,Q1[1]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ2x),fCentralityMain,Q2[0]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ2y),fCentralityMain,Q2[1]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ3x),fCentralityMain,Q3[0]);
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsQ3y),fCentralityMain,Q3[1]);
 
   Double_t sp12 = fQVector1 *  QVector2;//scalar product between Q1 vector and Q2 vector
   Double_t sp23 =  QVector2 *  QVector3;//scalar product between Q2 vector and Q3 vector
   Double_t sp31 =  QVector3 * fQVector1;//scalar product between Q3 vector and Q1 vector
 
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSPQ1Q2",fEstimator.Data()),fCentralityMain,sp12);//mean value of sp is denominator of SP method
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSPQ2Q3",fEstimator.Data()),fCentralityMain,sp23);//mean value of sp is denominator of SP method
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSPQ3Q1",fEstimator.Data()),fCentralityMain,sp31);//mean value of sp is denominator of SP method
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSPQ1Q2),fCentralityMain,sp12);//mean value of sp is denominator of SP method
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSPQ2Q3),fCentralityMain,sp23);//mean value of sp is denominator of SP method
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSPQ3Q1),fCentralityMain,sp31);//mean value of sp is denominator of SP method
   AliInfo(Form("Q1x = %e , Q1y = %e , Q2x = %e , Q2y = %e , Q3x = %e , Q3y = %e ,  SP12 = %e ,  SP23 = %e ,  SP31 = %e",Q1[0],Q1[1],Q2[0],Q2[1],Q3[0],Q3[1],sp12,sp23,sp31));
   
   const Double_t delta = 2. * TMath::Pi() / Double_t(fHarmonics) / 12.;
@@ -4591,12 +5170,12 @@ Bool_t AliAnalysisTaskPHOSPi0EtaToGammaGamma::ExtractQnVector()
   if(fEPBin > 11) fEPBin = 11;//protection to avoid fEPBin = 12.
   
   //for event plane resolution
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsCosDeltaEventPlane12",fEstimator.Data()),fCentralityMain,TMath::Cos(fHarmonics * (fEventPlane - EP2)));
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsCosDeltaEventPlane23",fEstimator.Data()),fCentralityMain,TMath::Cos(fHarmonics * (EP2         - EP3)));
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsCosDeltaEventPlane31",fEstimator.Data()),fCentralityMain,TMath::Cos(fHarmonics * (EP3 - fEventPlane)));
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSinDeltaEventPlane12",fEstimator.Data()),fCentralityMain,TMath::Sin(fHarmonics * (fEventPlane - EP2)));
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSinDeltaEventPlane23",fEstimator.Data()),fCentralityMain,TMath::Sin(fHarmonics * (EP2         - EP3)));
-  FillHistogramTH2(fOutputContainer,Form("hCentrality%svsSinDeltaEventPlane31",fEstimator.Data()),fCentralityMain,TMath::Sin(fHarmonics * (EP3 - fEventPlane)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsCosDeltaEventPlane12),fCentralityMain,TMath::Cos(fHarmonics * (fEventPlane - EP2)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsCosDeltaEventPlane23),fCentralityMain,TMath::Cos(fHarmonics * (EP2         - EP3)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsCosDeltaEventPlane31),fCentralityMain,TMath::Cos(fHarmonics * (EP3 - fEventPlane)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSinDeltaEventPlane12),fCentralityMain,TMath::Sin(fHarmonics * (fEventPlane - EP2)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSinDeltaEventPlane23),fCentralityMain,TMath::Sin(fHarmonics * (EP2         - EP3)));
+  FillHistogramTH2(fHistograms.Get(kHCentralityvsSinDeltaEventPlane31),fCentralityMain,TMath::Sin(fHarmonics * (EP3 - fEventPlane)));
 
   return kTRUE;
 }
@@ -4696,30 +5275,30 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillTrackMatching()
       if((nsigmaProton   < TMath::Abs(nsigmaElectron)) && (nsigmaProton   < nsigmaPion) && (nsigmaProton   < nsigmaKaon)   && (nsigmaProton   < NsigmaCut)) pidProton = kTRUE;
 
       if(pidElectron){
-        FillHistogramTH2(fOutputContainer,"hRvsTrackPt_Electron",trackPt,r);
-        FillHistogramTH2(fOutputContainer,"hRvsClusterPt_Electron",pT,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsTrackPt_Electron),trackPt,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsClusterPt_Electron),pT,r);
       }
       else if(pidPion){
-        FillHistogramTH2(fOutputContainer,"hRvsTrackPt_Pion",trackPt,r);
-        FillHistogramTH2(fOutputContainer,"hRvsClusterPt_Pion",pT,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsTrackPt_Pion),trackPt,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsClusterPt_Pion),pT,r);
       }
       else if(pidKaon){
-        FillHistogramTH2(fOutputContainer,"hRvsTrackPt_Kaon",trackPt,r);
-        FillHistogramTH2(fOutputContainer,"hRvsClusterPt_Kaon",pT,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsTrackPt_Kaon),trackPt,r);
+        FillHistogramTH2(fHistograms.Get(kHRvsClusterPt_Kaon),pT,r);
       }
       else if(pidProton){
         if(charge > 0){
-          FillHistogramTH2(fOutputContainer,"hRvsTrackPt_Proton",trackPt,r);
-          FillHistogramTH2(fOutputContainer,"hRvsClusterPt_Proton",pT,r);
+          FillHistogramTH2(fHistograms.Get(kHRvsTrackPt_Proton),trackPt,r);
+          FillHistogramTH2(fHistograms.Get(kHRvsClusterPt_Proton),pT,r);
         }
         else{
-          FillHistogramTH2(fOutputContainer,"hRvsTrackPt_AntiProton",trackPt,r);
-          FillHistogramTH2(fOutputContainer,"hRvsClusterPt_AntiProton",pT,r);
+          FillHistogramTH2(fHistograms.Get(kHRvsTrackPt_AntiProton),trackPt,r);
+          FillHistogramTH2(fHistograms.Get(kHRvsClusterPt_AntiProton),pT,r);
         }
       }
     }//end of track matching
 
-    //FillHistogramTH2(fOutputContainer,"hRvsClusterPt",pT,r);
+    //FillHistogramTH2(fHistograms.Get(kHRvsClusterPt),pT,r);
  
   }//end of cluster loop
 
@@ -4794,8 +5373,8 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixTrackMatching()
           cpv = supply->TestCPV(dx,dz,pttrack,charge);
           //AliInfo(Form("dx = %3.2f cm , dz = %3.2f cm , distance in sigma = %3.2f",dx,dz,cpv));
 
-          //FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt",pttrack,cpv);
-          //FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt",pTcluster,cpv);
+          //FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt),pttrack,cpv);
+          //FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt),pTcluster,cpv);
 
           pidPion = kFALSE;
           pidKaon = kFALSE;
@@ -4815,25 +5394,25 @@ void AliAnalysisTaskPHOSPi0EtaToGammaGamma::FillMixTrackMatching()
           if((nsigmaProton   < TMath::Abs(nsigmaElectron)) && (nsigmaProton   < nsigmaPion) && (nsigmaProton   < nsigmaKaon)   && (nsigmaProton   < NsigmaCut)) pidProton = kTRUE;
 
           if(pidElectron){
-            FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt_Electron",pttrack,cpv);
-            FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt_Electron",pT,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt_Electron),pttrack,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt_Electron),pT,cpv);
           }
           else if(pidPion){
-            FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt_Pion",pttrack,cpv);
-            FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt_Pion",pT,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt_Pion),pttrack,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt_Pion),pT,cpv);
           }
           else if(pidKaon){
-            FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt_Kaon",pttrack,cpv);
-            FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt_Kaon",pT,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt_Kaon),pttrack,cpv);
+            FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt_Kaon),pT,cpv);
           }
           else if(pidProton){
             if(charge > 0){
-              FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt_Proton",pttrack,cpv);
-              FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt_Proton",pT,cpv);
+              FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt_Proton),pttrack,cpv);
+              FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt_Proton),pT,cpv);
             }
             else{
-              FillHistogramTH2(fOutputContainer,"hMixRvsTrackPt_AntiProton",pttrack,cpv);
-              FillHistogramTH2(fOutputContainer,"hMixRvsClusterPt_AntiProton",pT,cpv);
+              FillHistogramTH2(fHistograms.Get(kHMixRvsTrackPt_AntiProton),pttrack,cpv);
+              FillHistogramTH2(fHistograms.Get(kHMixRvsClusterPt_AntiProton),pT,cpv);
             }
           }
 
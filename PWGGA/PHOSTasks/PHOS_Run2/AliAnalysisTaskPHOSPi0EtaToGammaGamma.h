@@ -4,6 +4,7 @@
 // Author: Daiki Sekihata (Hiroshima University)
 
 class TList;
+class TH1;
 class AliVEvent;
 class AliESDEvent;
 class AliAODEvent;
@@ -22,6 +23,7 @@ class AliQnCorrectionsManager;
 #include "AliPHOSEventCuts.h"
 #include "AliPHOSClusterCuts.h"
 #include "AliPHOSJetJetMC.h"
+#include "AliCaloHistogramTable.h"
 
 class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
   public:
@@ -343,6 +345,9 @@ class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
     void FillHistogramTH1(TList *list, const Char_t *name, Double_t x, Double_t w=1., Option_t *opt = "") const ;
     void FillHistogramTH2(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t w=1., Option_t *opt = "") const ;
     void FillHistogramTH3(TList *list, const Char_t *name, Double_t x, Double_t y, Double_t z, Double_t w=1., Option_t *opt = "") const ;
+    void FillHistogramTH1(TH1 *hist, Double_t x, Double_t w=1., Option_t *opt = "") const ;//histogram of fHistograms
+    void FillHistogramTH2(TH1 *hist, Double_t x, Double_t y, Double_t w=1., Option_t *opt = "") const ;//histogram of fHistograms
+    void FillHistogramTH3(TH1 *hist, Double_t x, Double_t y, Double_t z, Double_t w=1., Option_t *opt = "") const ;//histogram of fHistograms
     void FillProfile(TList *list, const Char_t *name, Double_t x, Double_t y) const ;
     void FillSparse(TList *list, const Char_t *name, Double_t *x, Double_t w=1.) const;
 
@@ -452,6 +457,7 @@ class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
     TArrayD *fCentArrayL0;
 
     THashList *fOutputContainer;
+    AliCaloHistogramTable fHistograms;//! histograms of fOutputContainer filled in the event loop, by handle
     AliVEvent *fEvent;
     AliESDEvent *fESDEvent;
     AliAODEvent *fAODEvent;
@@ -513,7 +519,7 @@ class AliAnalysisTaskPHOSPi0EtaToGammaGamma : public AliAnalysisTaskSE {
     AliAnalysisTaskPHOSPi0EtaToGammaGamma(const AliAnalysisTaskPHOSPi0EtaToGammaGamma&);
     AliAnalysisTaskPHOSPi0EtaToGammaGamma& operator=(const AliAnalysisTaskPHOSPi0EtaToGammaGamma&);
 
-    ClassDef(AliAnalysisTaskPHOSPi0EtaToGammaGamma, 68);
+    ClassDef(AliAnalysisTaskPHOSPi0EtaToGammaGamma, 69);
 };
 
 #endif
@@ -0,0 +1,143 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+//_________________________________________________________________________
+//  Table of histograms addressed by a handle and up to two integer indices
+//  (see header). Typical use in an analysis task:
+//
+//    enum { kPhot, kMgg } ;                               // handles
+//    fHistograms.Register(kPhot, fOutputContainer, "hPhotAll_cen%d") ;
+//    fHistograms.Register(kMgg,  fOutputContainer, "hMgg_M%d%d") ;
+//    ...
+//    TH1 * h = fHistograms.Get(kMgg, m1, m2) ;            // "hMgg_M<m1><m2>"
+//    if(h) h->Fill(m, pt) ;
+//
+
+// --- ROOT system ---
+#include "TH1.h"
+#include "TList.h"
+#include "TMath.h"
+
+#include "AliCaloHistogramTable.h"
+
+ClassImp(AliCaloHistogramTable)
+
+//____________________________________________________________________________
+AliCaloHistogramTable::AliCaloHistogramTable() :
+  TObject(),
+  fTemplates(),
+  fLists(),
+  fMin1(),
+  fN1(),
+  fMin2(),
+  fN2(),
+  fHists()
+{
+  //Default constructor
+}
+//____________________________________________________________________________
+void AliCaloHistogramTable::Clear(Option_t *)
+{
+  //Forget all handles and histograms
+  fTemplates.clear() ;
+  fLists.clear() ;
+  fMin1.clear() ;
+  fN1.clear() ;
+  fMin2.clear() ;
+  fN2.clear() ;
+  fHists.clear() ;
+}
+//____________________________________________________________________________
+void AliCaloHistogramTable::Register(Int_t handle, TList * list, const char * nameTemplate)
+{
+  //Register the histograms Form(nameTemplate,i,j) of list as handle.
+  //nameTemplate contains up to two %d (or none for a single histogram).
+  //The histograms are searched only when they are used first, so they
+  //may be added to the list after the registration.
+  if(handle < 0){
+    Error("Register", "invalid handle %d for <%s>", handle, nameTemplate) ;
+    return ;
+  }
+  if(handle >= (Int_t)fTemplates.size()){
+    fTemplates.resize(handle+1) ;
+    fLists.resize(handle+1, 0) ;
+    fMin1.resize(handle+1, 0) ;
+    fN1.resize(handle+1, 0) ;
+    fMin2.resize(handle+1, 0) ;
+    fN2.resize(handle+1, 0) ;
+    fHists.resize(handle+1) ;
+  }
+  fTemplates[handle] = nameTemplate ;
+  fLists[handle] = list ;
+  fMin1[handle] = 0 ;
+  fN1[handle] = 0 ;
+  fMin2[handle] = 0 ;
+  fN2[handle] = 0 ;
+  fHists[handle].clear() ;
+}
+//____________________________________________________________________________
+TH1 * AliCaloHistogramTable::Get(Int_t handle, Int_t i, Int_t j) const
+{
+  //Histogram Form(template of handle, i, j), 0 if it does not exist
+  if(handle >= 0 && handle < (Int_t)fHists.size()){
+    Int_t i1 = i - fMin1[handle] ;
+    Int_t j1 = j - fMin2[handle] ;
+    if(i1 >= 0 && i1 < fN1[handle] && j1 >= 0 && j1 < fN2[handle]){
+      TH1 * hist = fHists[handle][i1*fN2[handle]+j1] ;
+      if(hist)
+        return hist ;
+    }
+  }
+  return Resolve(handle, i, j) ;
+}
+//____________________________________________________________________________
+TH1 * AliCaloHistogramTable::Resolve(Int_t handle, Int_t i, Int_t j) const
+{
+  //Search the histogram in the list and add it to the table
+  if(handle < 0 || handle >= (Int_t)fLists.size() || !fLists[handle]){
+    Error("Get", "histogram handle %d not registered", handle) ;
+    return 0 ;
+  }
+  const char * name = Form(fTemplates[handle].Data(), i, j) ;
+  TH1 * hist = dynamic_cast<TH1*>(fLists[handle]->FindObject(name)) ;
+  if(!hist){
+    Error("Get", "can not find histogram (of instance TH1) <%s>", name) ;
+    return 0 ;
+  }
+
+  //Extend the table to include (i,j)
+  Int_t min1 = fMin1[handle], n1 = fN1[handle] ;
+  Int_t min2 = fMin2[handle], n2 = fN2[handle] ;
+  if(n1 == 0){
+    min1 = i ; n1 = 1 ;
+    min2 = j ; n2 = 1 ;
+  }
+  Int_t newMin1 = TMath::Min(min1, i), newN1 = TMath::Max(min1 + n1, i + 1) - newMin1 ;
+  Int_t newMin2 = TMath::Min(min2, j), newN2 = TMath::Max(min2 + n2, j + 1) - newMin2 ;
+  std::vector<TH1*> & table = fHists[handle] ;
+  if(newN1 != fN1[handle] || newN2 != fN2[handle] || newMin1 != fMin1[handle] || newMin2 != fMin2[handle]){
+    std::vector<TH1*> newTable(newN1*newN2, (TH1*)0) ;
+    for(Int_t i1 = 0 ; i1 < fN1[handle] ; i1++)
+      for(Int_t j1 = 0 ; j1 < fN2[handle] ; j1++)
+        newTable[(i1 + fMin1[handle] - newMin1)*newN2 + j1 + fMin2[handle] - newMin2] = table[i1*fN2[handle] + j1] ;
+    table.swap(newTable) ;
+    fMin1[handle] = newMin1 ;
+    fN1[handle] = newN1 ;
+    fMin2[handle] = newMin2 ;
+    fN2[handle] = newN2 ;
+  }
+  table[(i - newMin1)*newN2 + j - newMin2] = hist ;
+  return hist ;
+}
@@ -0,0 +1,53 @@
+#ifndef ALICALOHISTOGRAMTABLE_H
+#define ALICALOHISTOGRAMTABLE_H
+/* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+//_________________________________________________________________________
+//  Table of histograms addressed by a handle and up to two integer indices
+//  instead of by name.
+//  A handle is registered once with the output list and the name template
+//  of the histograms, e.g. Register(kPhot, list, "hPhotAll_cen%d").
+//  Get(kPhot, cen) formats the name and searches the list only the first
+//  time a (handle, indices) combination is used; afterwards the histogram
+//  is taken from a dense table, so no string is formatted or hashed per fill.
+//
+// --- ROOT system ---
+#include <vector>
+#include "TObject.h"
+#include "TString.h"
+
+class TH1 ;
+class TList ;
+
+class AliCaloHistogramTable : public TObject {
+
+ public:
+
+  AliCaloHistogramTable() ;
+  virtual ~AliCaloHistogramTable() {}
+
+  void   Clear(Option_t * option = "") ;                              //Forget all handles
+  void   Register(Int_t handle, TList * list, const char * nameTemplate) ; //Histograms Form(nameTemplate,i,j) in list
+  TH1 *  Get(Int_t handle, Int_t i = 0, Int_t j = 0) const ;          //Histogram of handle and indices (0 if not found)
+  Int_t  GetNHandles() const { return fTemplates.size() ; }
+
+private:
+  AliCaloHistogramTable(const AliCaloHistogramTable &) ;             //Not implemented
+  AliCaloHistogramTable & operator = (const AliCaloHistogramTable &) ; //Not implemented
+
+  TH1 *  Resolve(Int_t handle, Int_t i, Int_t j) const ;              //Search the list and update the table
+
+  // per handle
+  std::vector<TString> fTemplates ; //! Name templates
+  std::vector<TList*>  fLists ;     //! Lists containing the histograms
+  mutable std::vector<Int_t> fMin1 ;//! Smallest first index in the table
+  mutable std::vector<Int_t> fN1 ;  //! Number of first indices in the table
+  mutable std::vector<Int_t> fMin2 ;//! Smallest second index in the table
+  mutable std::vector<Int_t> fN2 ;  //! Number of second indices in the table
+  mutable std::vector< std::vector<TH1*> > fHists ; //! Histograms [i-min1][j-min2] (0: not resolved or not found)
+
+  ClassDef(AliCaloHistogramTable,1)
+} ;
+
+#endif // #ifdef ALICALOHISTOGRAMTABLE_H
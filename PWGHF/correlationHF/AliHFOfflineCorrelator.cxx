@@ -23,8 +23,19 @@
 //  fabio.colamaria@cern.ch
 //-----------------------------------------------------------------------
 
+#include <algorithm>
+#include <map>
+#include <RVersion.h>
+#include <TROOT.h>
+#include <TVirtualMutex.h>
 #include "AliHFOfflineCorrelator.h"
 
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIHFOFFLINECORRELATOR_THREAD
+#include <atomic>
+#include <thread>
+#endif
+
 //___________________________________________________________________________________________
 AliHFCorrelationBranchD::AliHFCorrelationBranchD():
 // default constructor
@@ -115,7 +126,9 @@ fNameCutObj(0),
 fUseEff(0),
 fMake2DPlots(kFALSE),
 fWeightPeriods(kTRUE),
-fRejectSoftPi(kTRUE)
+fRejectSoftPi(kTRUE),
+fColumnarLoop(kFALSE),
+fNThreads(1)
 {
 
 }
@@ -171,7 +184,9 @@ fNameCutObj(source.fNameCutObj),
 fUseEff(source.fUseEff),
 fMake2DPlots(source.fMake2DPlots),
 fWeightPeriods(source.fWeightPeriods),
-fRejectSoftPi(source.fRejectSoftPi)
+fRejectSoftPi(source.fRejectSoftPi),
+fColumnarLoop(source.fColumnarLoop),
+fNThreads(source.fNThreads)
 {
 
 }
@@ -231,6 +246,8 @@ fUseEff = orig.fUseEff;
 fMake2DPlots = orig.fMake2DPlots;
 fWeightPeriods = orig.fWeightPeriods;
 fRejectSoftPi = orig.fRejectSoftPi;
+fColumnarLoop = orig.fColumnarLoop;
+fNThreads = orig.fNThreads;
 
 return *this; //returns pointer of the class
 }
@@ -459,7 +476,7 @@ Bool_t AliHFOfflineCorrelator::Correlate() {
   }
 
   for(Int_t iFile=0; iFile<(int)fFileList.size(); iFile++) {
-    Bool_t success = CorrelateSingleFile(iFile);
+    Bool_t success = fColumnarLoop ? CorrelateSingleFileColumnar(iFile) : CorrelateSingleFile(iFile);
     if(!success) {
       std::cout << "Error in the evaluation of correlations for file #" << iFile << ". Exiting..." << std::endl;
       return kFALSE;
@@ -476,7 +493,8 @@ Bool_t AliHFOfflineCorrelator::Correlate() {
 }
 
 //___________________________________________________________________________________________
-Bool_t AliHFOfflineCorrelator::CorrelateSingleFile(Int_t iFile) {
+Bool_t AliHFOfflineCorrelator::OpenInputFile(Int_t iFile, TDirectoryFile *&dir) {
+  //Opens the file and retrieves the TTrees (and the efficiency maps, if used)
 
   std::cout << "Opening file: " << fFileList.at(iFile) << std::endl;
 
@@ -486,7 +504,7 @@ Bool_t AliHFOfflineCorrelator::CorrelateSingleFile(Int_t iFile) {
     return kFALSE;
   }
 
-  TDirectoryFile *dir = (TDirectoryFile*)fFile->Get(fDirName.Data());
+  dir = (TDirectoryFile*)fFile->Get(fDirName.Data());
   if(!dir){
     std::cout << "Directory " << fDirName << " is missing! Check its spelling/the file content" << std::endl;
     fFile->ls();
@@ -517,6 +535,15 @@ Bool_t AliHFOfflineCorrelator::CorrelateSingleFile(Int_t iFile) {
     }  
   }
 
+  return kTRUE;
+}
+
+//___________________________________________________________________________________________
+Bool_t AliHFOfflineCorrelator::CorrelateSingleFile(Int_t iFile) {
+
+  TDirectoryFile *dir = 0x0;
+  if(!OpenInputFile(iFile,dir)) return kFALSE;
+
   AliHFCorrelationBranchD *brD = 0;
   AliHFCorrelationBranchTr *brTr = 0;
 
@@ -690,14 +717,411 @@ Bool_t AliHFOfflineCorrelator::CorrelateSingleFile(Int_t iFile) {
   return kTRUE;
 }
 
+//___________________________________________________________________________________________
+// D mesons and associated tracks of a file, kept in memory by CorrelateSingleFileColumnar.
+// The D mesons of pool p are [fDFirst[p],fDFirst[p+1]), in TTree order; the tracks of pool p are
+// [fTrFirst[p],fTrFirst[p+1]), in TTree order for ME and grouped by event (then in TTree order) for SE.
+struct AliHFOfflineCorrelator::ColumnarData {
+  std::vector<AliHFCorrelationBranchD> fD;	//selected D mesons
+  std::vector<Int_t> fDPtBin;		//pT bin of the D meson
+  std::vector<Int_t> fDEvent;		//event of the D meson (-1 if no selected track belongs to it)
+  std::vector<Int_t> fDMinTr;		//TTree entries of the tracks correlated with the D meson (see SetMaxTracksToCorrelate)
+  std::vector<Int_t> fDMaxTr;
+  std::vector<Int_t> fDFirst;
+
+  std::vector<Float_t> fPhi;		//selected associated tracks
+  std::vector<Float_t> fEta;
+  std::vector<Float_t> fPt;
+  std::vector<Float_t> fZVtx;
+  std::vector<Short_t> fIDtrig[4];
+  std::vector<Int_t> fEntry;		//TTree entry of the track
+  std::vector<Int_t> fEvent;		//event of the track
+  std::vector<Int_t> fTrFirst;
+
+  //output plots, index (ptBin*nAssocRanges+assocRange)*nPools+pool (0x0 if not produced)
+  std::vector<TH3F*> fH3D;
+  std::vector<TH3F*> fH3DSoftPi;
+  std::vector<TH2F*> fH2DSign;
+  std::vector<TH2F*> fH2DSB;
+  std::vector<TH2F*> fH2DSignSoftPi;
+  std::vector<TH2F*> fH2DSBSoftPi;
+  std::vector<TH1F*> fHEtaD;
+  std::vector<TH1F*> fHEtaTr;
+  std::vector<TH1F*> fHEtaDSign;
+  std::vector<TH1F*> fHEtaTrSign;
+  std::vector<TH1F*> fHEtaDSB;
+  std::vector<TH1F*> fHEtaTrSB;
+};
+
+namespace {
+  //orders entries by pool, and optionally by event inside a pool (stable: TTree order is kept otherwise)
+  struct PoolOrder {
+    const std::vector<Int_t> *fPool;
+    const std::vector<Int_t> *fEvent;
+    Bool_t operator()(Int_t a, Int_t b) const {
+      if((*fPool)[a]!=(*fPool)[b]) return (*fPool)[a]<(*fPool)[b];
+      return fEvent && (*fEvent)[a]<(*fEvent)[b];
+    }
+  };
+
+  template<class T> void Reorder(std::vector<T> &v, const std::vector<Int_t> &order) {
+    std::vector<T> tmp; tmp.reserve(order.size());
+    for(UInt_t i=0; i<order.size(); i++) tmp.push_back(v[order[i]]);
+    v.swap(tmp);
+  }
+
+  //first entry of each pool (plus the end), for entries sorted by pool
+  void PoolOffsets(const std::vector<Int_t> &pool, const std::vector<Int_t> &order, Int_t nPools, std::vector<Int_t> &first) {
+    first.assign(nPools+1,0);
+    for(UInt_t i=0; i<order.size(); i++) first[pool[order[i]]+1]++;
+    for(Int_t p=0; p<nPools; p++) first[p+1]+=first[p];
+  }
+}
+
+//___________________________________________________________________________________________
+Bool_t AliHFOfflineCorrelator::CorrelateSingleFileColumnar(Int_t iFile) {
+  //Same output as CorrelateSingleFile, but each TTree is read only once: the selected D mesons and tracks are
+  //stored in memory grouped by pool, and the pairs are built pool by pool from the arrays (fNThreads pools in parallel)
+
+  TDirectoryFile *dir = 0x0;
+  if(!OpenInputFile(iFile,dir)) return kFALSE;
+
+  AliHFCorrelationBranchD *brD = 0;
+  AliHFCorrelationBranchTr *brTr = 0;
+
+  fTreeD->SetBranchAddress("branchD",&brD);
+  fTreeTr->SetBranchAddress("branchTr",&brTr);
+
+  Int_t nEntriesD = fTreeD->GetEntries();
+  Int_t nEntriesTr = fTreeTr->GetEntries();
+  std::cout << "File contains a total of " << nEntriesD << " D mesons and of " << nEntriesTr << " associated tracks" << std::endl;
+
+  Int_t minDLoop = 0, maxDLoop = nEntriesD;
+  Int_t minTrackLoop = 0, maxTrackLoop = nEntriesTr;
+
+  if(fMinD>=0) minDLoop=fMinD;
+  if(fMaxD>=0) maxDLoop=fMaxD;
+  if(fMinD>fMaxD) {printf("Warning! Wrong settings of D-meson loop edges! Exiting...\n"); return kFALSE;}
+  if(fMinD>nEntriesD) {printf("Warning! The lower edge of D meson loop exceeds the number of D in the TTree! No loop will be done\n"); return kTRUE;}
+  if(fMaxD>nEntriesD) {printf("Warning! The upper edge of D meson loop exceeds the number of D in the TTree!\n"); maxDLoop = nEntriesD;}
+
+  TStopwatch tim;
+  tim.Start();
+
+  ColumnarData col;
+  std::map<std::pair<ULong64_t,UShort_t>,Int_t> events; //(period,orbit),BC -> event
+  std::vector<Int_t> pools;
+  std::vector<Int_t> order;
+  PoolOrder poolOrder;
+  poolOrder.fPool = &pools;
+
+  //Associated tracks: their selection and pool do not depend on the trigger
+  std::cout << "Reading associated tracks..." << std::endl;
+  for(Int_t iTr=0; iTr<nEntriesTr; iTr++) {
+
+    fTreeTr->GetEntry(iTr);
+    if(fNumSelTr>=0 && (brTr->sel_Tr>>fNumSelTr)%2!=1) continue; //important in case of multiple selection (default selection is 0)
+    if(fMinCent!=0 && fMaxCent!=0) {if(brTr->cent_Tr < fMinCent || brTr->cent_Tr > fMaxCent) continue;} //skip tracks outside centrality range
+    Int_t poolTr = GetPoolBin(brTr->mult_Tr,brTr->zVtx_Tr);
+    if(poolTr<0) continue;
+
+    std::pair<ULong64_t,UShort_t> key((((ULong64_t)brTr->period_Tr)<<32)|brTr->orbit_Tr,brTr->BC_Tr);
+    std::map<std::pair<ULong64_t,UShort_t>,Int_t>::iterator it = events.find(key);
+    if(it==events.end()) it = events.insert(std::make_pair(key,(Int_t)events.size())).first;
+
+    col.fPhi.push_back(brTr->phi_Tr);
+    col.fEta.push_back(brTr->eta_Tr);
+    col.fPt.push_back(brTr->pT_Tr);
+    col.fZVtx.push_back(brTr->zVtx_Tr);
+    col.fIDtrig[0].push_back(brTr->IDtrig_Tr);
+    col.fIDtrig[1].push_back(brTr->IDtrig2_Tr);
+    col.fIDtrig[2].push_back(brTr->IDtrig3_Tr);
+    col.fIDtrig[3].push_back(brTr->IDtrig4_Tr);
+    col.fEntry.push_back(iTr);
+    col.fEvent.push_back(it->second);
+    pools.push_back(poolTr);
+  }
+
+  order.resize(pools.size());
+  for(UInt_t i=0; i<order.size(); i++) order[i]=i;
+  poolOrder.fEvent = (fAnType==kSE ? &col.fEvent : 0x0);
+  std::stable_sort(order.begin(),order.end(),poolOrder);
+  PoolOffsets(pools,order,fnPools,col.fTrFirst);
+  Reorder(col.fPhi,order);
+  Reorder(col.fEta,order);
+  Reorder(col.fPt,order);
+  Reorder(col.fZVtx,order);
+  for(Int_t i=0; i<4; i++) Reorder(col.fIDtrig[i],order);
+  Reorder(col.fEntry,order);
+  Reorder(col.fEvent,order);
+
+  //Mass plots
+  std::vector<TH1F*> hMass(fNBinsPt,(TH1F*)0x0), hMassW(fNBinsPt,(TH1F*)0x0);
+  for(Int_t iBin=0; iBin<fNBinsPt; iBin++) {
+    hMass[iBin] = (TH1F*)fOutputMass->FindObject(Form("histMass_%d",fFirstBinNum+iBin));
+    if(fUseEff) hMassW[iBin] = (TH1F*)fOutputMass->FindObject(Form("histMass_WeigD0Eff_%d",fFirstBinNum+iBin));
+  }
+
+  //D mesons: same selection and sequence of random track ranges as in CorrelateSingleFile
+  std::cout << "Reading D mesons..." << std::endl;
+  TRandom3 tRnd;
+  tRnd.SetSeed(1);
+  Bool_t warnMaxTracks = kFALSE;
+  pools.clear();
+
+  for(Int_t iD=minDLoop; iD<maxDLoop; iD++) {
+
+    fTreeD->GetEntry(iD);
+    Int_t ptBinD = PtBin(brD->pT_D);
+    if(ptBinD<0) continue;
+    if(fNumSelD>=0 && (brD->sel_D>>fNumSelD)%2!=1) continue; //important in case of multiple selection (default selection is 0)
+    if(fMinCent!=0 && fMaxCent!=0) {if(brD->cent_D < fMinCent || brD->cent_D > fMaxCent) continue;} //skip triggers outside centrality range
+
+    Int_t poolD = GetPoolBin(brD->mult_D,brD->zVtx_D);
+
+    if(fMaxTracks>0) { //select random range of 'fMaxTracks' tracks in the TTree of tracks (the range changes for each D meson to use all the sample)
+      if(fMaxTracks>=nEntriesTr) {
+        if(!warnMaxTracks) printf("Warning! Requested to loop on more tracks than the available number! Standard loop being done\n");
+        warnMaxTracks = kTRUE;
+      } else {
+        minTrackLoop = tRnd.Rndm()*(nEntriesTr-fMaxTracks);
+        maxTrackLoop = fMaxTracks+minTrackLoop;
+      }
+    }
+
+    //Fill mass plots
+    hMass[ptBinD]->Fill(brD->invMass_D);
+    if(fUseEff) hMassW[ptBinD]->Fill(brD->invMass_D,GetEfficiencyWeightDOnly(brD));
+
+    if(poolD<0) continue;
+    std::map<std::pair<ULong64_t,UShort_t>,Int_t>::const_iterator it = events.find(std::make_pair((((ULong64_t)brD->period_D)<<32)|brD->orbit_D,brD->BC_D));
+
+    col.fD.push_back(*brD);
+    col.fDPtBin.push_back(ptBinD);
+    col.fDEvent.push_back(it!=events.end() ? it->second : -1);
+    col.fDMinTr.push_back(minTrackLoop);
+    col.fDMaxTr.push_back(maxTrackLoop);
+    pools.push_back(poolD);
+  }
+
+  order.resize(pools.size());
+  for(UInt_t i=0; i<order.size(); i++) order[i]=i;
+  poolOrder.fEvent = 0x0;
+  std::stable_sort(order.begin(),order.end(),poolOrder);
+  PoolOffsets(pools,order,fnPools,col.fDFirst);
+  Reorder(col.fD,order);
+  Reorder(col.fDPtBin,order);
+  Reorder(col.fDEvent,order);
+  Reorder(col.fDMinTr,order);
+  Reorder(col.fDMaxTr,order);
+
+  std::cout << "Stored " << col.fD.size() << " D mesons and " << col.fPt.size() << " associated tracks from " << events.size() << " events" << std::endl;
+  tim.Print();
+  tim.Continue();
+
+  //Correlation plots, looked up once instead of for each pair
+  Int_t nRng = fPtBinsTrLow.size();
+  Int_t nPlots = fNBinsPt*nRng*fnPools;
+  col.fH3D.assign(nPlots,(TH3F*)0x0); col.fH3DSoftPi.assign(nPlots,(TH3F*)0x0);
+  col.fH2DSign.assign(nPlots,(TH2F*)0x0); col.fH2DSB.assign(nPlots,(TH2F*)0x0);
+  col.fH2DSignSoftPi.assign(nPlots,(TH2F*)0x0); col.fH2DSBSoftPi.assign(nPlots,(TH2F*)0x0);
+  col.fHEtaD.assign(nPlots,(TH1F*)0x0); col.fHEtaTr.assign(nPlots,(TH1F*)0x0);
+  col.fHEtaDSign.assign(nPlots,(TH1F*)0x0); col.fHEtaTrSign.assign(nPlots,(TH1F*)0x0);
+  col.fHEtaDSB.assign(nPlots,(TH1F*)0x0); col.fHEtaTrSB.assign(nPlots,(TH1F*)0x0);
+
+  for(Int_t iBin=0; iBin<fNBinsPt; iBin++) {
+    for(Int_t iRng=0; iRng<nRng; iRng++) {
+      for(Int_t iPool=0; iPool<fnPools; iPool++) {
+        Int_t h = (iBin*nRng+iRng)*fnPools+iPool;
+        TString suffix = Form("Bin%d_%1.1fto%1.1f_p%d",fFirstBinNum+iBin,fPtBinsTrLow.at(iRng),fPtBinsTrUp.at(iRng),iPool);
+        col.fH3D[h] = (TH3F*)fOutputDistr->FindObject("h3DCorrelations_"+suffix);
+        if(fAnType==kME) col.fH3DSoftPi[h] = (TH3F*)fOutputDistr->FindObject("h3DCorrelations_"+suffix+"_softpiME");
+        if(fMake2DPlots) {
+          col.fH2DSign[h] = (TH2F*)fOutputDistr->FindObject("h2DCorrelations_Sign_"+suffix);
+          col.fH2DSB[h] = (TH2F*)fOutputDistr->FindObject("h2DCorrelations_SB_"+suffix);
+          if(fAnType==kME) {
+            col.fH2DSignSoftPi[h] = (TH2F*)fOutputDistr->FindObject("h2DCorrelations_Sign_"+suffix+"_softpiME");
+            col.fH2DSBSoftPi[h] = (TH2F*)fOutputDistr->FindObject("h2DCorrelations_SB_"+suffix+"_softpiME");
+          }
+        }
+        if(fDebug) {
+          col.fHEtaD[h] = (TH1F*)fOutputDistr->FindObject("hEtaD_"+suffix);
+          col.fHEtaTr[h] = (TH1F*)fOutputDistr->FindObject("hEtaTr_"+suffix);
+          if(fMake2DPlots) {
+            col.fHEtaDSign[h] = (TH1F*)fOutputDistr->FindObject("hEtaD_Sign_"+suffix);
+            col.fHEtaTrSign[h] = (TH1F*)fOutputDistr->FindObject("hEtaTr_Sign_"+suffix);
+            col.fHEtaDSB[h] = (TH1F*)fOutputDistr->FindObject("hEtaD_SB_"+suffix);
+            col.fHEtaTrSB[h] = (TH1F*)fOutputDistr->FindObject("hEtaTr_SB_"+suffix);
+          }
+        }
+      }
+    }
+  }
+
+  //Each pool fills only its own plots, so that pools can be correlated in parallel
+  std::cout << "Correlating..." << std::endl;
+  Int_t nThreads = TMath::Min(fNThreads,fnPools);
+#ifndef ALIHFOFFLINECORRELATOR_THREAD
+  nThreads = 1;
+#endif
+  if(nThreads>1 && !gGlobalMutex) { //the thread safety is enabled by the steering macro (ROOT::EnableThreadSafety()), not here
+    static Bool_t warnThreadSafety = kFALSE;
+    if(!warnThreadSafety) printf("Warning! ROOT thread safety not enabled in the steering macro, the pools are correlated serially\n");
+    warnThreadSafety = kTRUE;
+    nThreads = 1;
+  }
+  if(nThreads<=1) {
+    for(Int_t iPool=0; iPool<fnPools; iPool++) CorrelatePool(iPool,col,iFile);
+  }
+  else {
+#ifdef ALIHFOFFLINECORRELATOR_THREAD
+    TDatabasePDG::Instance()->GetParticle(211); //the PDG table is read on first use
+    std::atomic<Int_t> next(0);
+    std::vector<std::thread> threads;
+    for(Int_t t=0; t<nThreads; t++) {
+      threads.push_back(std::thread([&]() {
+        for(Int_t iPool=next++; iPool<fnPools; iPool=next++) CorrelatePool(iPool,col,iFile);
+      }));
+    }
+    for(UInt_t t=0; t<threads.size(); t++) threads[t].join();
+#endif
+  }
+
+  tim.Stop();
+  tim.Print();
+  std::cout << "Done! Closing file." << std::endl;
+
+  fFile->TFile::Close();
+
+  return kTRUE;
+}
+
+//___________________________________________________________________________________________
+void AliHFOfflineCorrelator::CorrelatePool(Int_t pool, const ColumnarData &col, Int_t iFile) {
+  //Correlates the D mesons of a pool with the tracks of the same pool (same selections as in CorrelateSingleFile)
+
+  Int_t nRng = fPtBinsTrLow.size();
+  std::vector<Int_t> fillOnce(nRng);
+  Int_t firstTr = col.fTrFirst[pool], lastTr = col.fTrFirst[pool+1];
+
+  for(Int_t iD=col.fDFirst[pool]; iD<col.fDFirst[pool+1]; iD++) {  //loop on D-mesons of the pool
+
+    const AliHFCorrelationBranchD *brD = &col.fD[iD];
+    Int_t ptBinD = col.fDPtBin[iD];
+    Int_t eventD = col.fDEvent[iD];
+    Int_t minTrackLoop = col.fDMinTr[iD], maxTrackLoop = col.fDMaxTr[iD];
+
+    Int_t begin = firstTr, end = lastTr;
+    if(fAnType==kSE) { //only the tracks of the D-meson event (contiguous)
+      if(eventD<0) continue;
+      begin = std::lower_bound(col.fEvent.begin()+firstTr,col.fEvent.begin()+lastTr,eventD)-col.fEvent.begin();
+      end = std::upper_bound(col.fEvent.begin()+begin,col.fEvent.begin()+lastTr,eventD)-col.fEvent.begin();
+    } else { //tracks are in TTree order, keep those in the range of entries
+      begin = std::lower_bound(col.fEntry.begin()+firstTr,col.fEntry.begin()+lastTr,minTrackLoop)-col.fEntry.begin();
+      end = std::lower_bound(col.fEntry.begin()+begin,col.fEntry.begin()+lastTr,maxTrackLoop)-col.fEntry.begin();
+    }
+
+    Bool_t inSign = kFALSE, inSB1 = kFALSE, inSB2 = kFALSE;
+    if(fMake2DPlots) {
+      inSign = brD->invMass_D > fMassSignL.at(ptBinD) && brD->invMass_D < fMassSignR.at(ptBinD);
+      inSB1 = brD->invMass_D > fMassSB1L.at(ptBinD) && brD->invMass_D < fMassSB1R.at(ptBinD);
+      inSB2 = fDmesonSpecies!=kDStarD0pi && (brD->invMass_D > fMassSB2L.at(ptBinD) && brD->invMass_D < fMassSB2R.at(ptBinD));
+    }
+    Int_t hD = ptBinD*nRng*fnPools+pool; //plots of range iRng: hD+iRng*fnPools
+    for(Int_t iRng=0; iRng<nRng; iRng++) fillOnce[iRng]=0;
+
+    for(Int_t iTr=begin; iTr<end; iTr++) {  //loop on associated tracks of the pool
+
+      if(fAnType==kSE) {
+        if(col.fEntry[iTr]<minTrackLoop || col.fEntry[iTr]>=maxTrackLoop) continue;
+        if(brD->IDtrig_D==col.fIDtrig[0][iTr] || brD->IDtrig_D==col.fIDtrig[1][iTr] ||
+           brD->IDtrig_D==col.fIDtrig[2][iTr] || brD->IDtrig_D==col.fIDtrig[3][iTr]) continue; //skips D0 daughter association with their own trigger (or own soft-pion, for the D0)
+      }
+      if(fAnType==kME && col.fEvent[iTr]==eventD) continue; //skips D and tracks from same event in ME
+
+      Double_t weight = 1.;
+      if(fUseEff) weight = GetEfficiencyWeight(brD->pT_D,brD->mult_D,col.fPt[iTr],col.fEta[iTr],col.fZVtx[iTr]); //efficiency weighting
+      if(fWeightPeriods && fAnType==kME) weight*=fPrdWeights.at(iFile); //period-by-period weighting
+      Double_t deltaPhi, deltaEta;
+      GetCorrelationsValue(brD->phi_D,brD->eta_D,col.fPhi[iTr],col.fEta[iTr],deltaPhi,deltaEta);
+
+      Bool_t fillSoftpiME=kFALSE;
+      if(fRejectSoftPi && fDmesonSpecies==kD0toKpi) {
+        if(fAnType==kSE) { //reject softPi in SE events
+          if(IsSoftPionFromDstar(brD,col.fPt[iTr],col.fPhi[iTr],col.fEta[iTr])) continue;
+        }
+        if(fAnType==kME && deltaPhi > -0.4 && deltaPhi < 0.4 && deltaEta > -0.4 && deltaEta < 0.4) { //ME fake soft pi cut
+          if(IsSoftPionFromDstar(brD,col.fPt[iTr],col.fPhi[iTr],col.fEta[iTr])) fillSoftpiME=kTRUE; //to fill histograms containing only fake softpi in ME analysis
+        }
+      }
+
+      for(Int_t iRng=0; iRng<nRng; iRng++) {  //loop on associated track ranges
+
+        if(col.fPt[iTr] < fPtBinsTrLow.at(iRng) || col.fPt[iTr] > fPtBinsTrUp.at(iRng)) continue; //skip cases where associated track pT is out of range
+        Int_t h = hD+iRng*fnPools;
+
+        col.fH3D[h]->Fill(deltaPhi,deltaEta,brD->invMass_D,weight);
+        if(fillSoftpiME) col.fH3DSoftPi[h]->Fill(deltaPhi,deltaEta,brD->invMass_D,weight);
+
+        if(fMake2DPlots) {
+          if(inSign) {
+            col.fH2DSign[h]->Fill(deltaPhi,deltaEta,weight);
+            if(fillSoftpiME) col.fH2DSignSoftPi[h]->Fill(deltaPhi,deltaEta,weight);
+          }
+          if(inSB1) {
+            col.fH2DSB[h]->Fill(deltaPhi,deltaEta,weight);
+            if(fillSoftpiME) col.fH2DSBSoftPi[h]->Fill(deltaPhi,deltaEta,weight);
+          }
+          if(inSB2) {
+            col.fH2DSB[h]->Fill(deltaPhi,deltaEta,weight);
+            if(fillSoftpiME) col.fH2DSBSoftPi[h]->Fill(deltaPhi,deltaEta,weight);
+          }
+        } //end if 2D plots
+
+        //***fill debug plots***
+        if(fDebug) {
+          if(fillOnce[iRng]==0) col.fHEtaD[h]->Fill(brD->eta_D);  //in the track loop, fill only once for D-meson!
+          col.fHEtaTr[h]->Fill(col.fEta[iTr]);  //fill at each track iteration for the tracks!
+          if(fMake2DPlots) {
+            if(inSign) {
+              if(fillOnce[iRng]==0) col.fHEtaDSign[h]->Fill(brD->eta_D);
+              col.fHEtaTrSign[h]->Fill(col.fEta[iTr]);
+            }
+            if(inSB1) {
+              if(fillOnce[iRng]==0) col.fHEtaDSB[h]->Fill(brD->eta_D);
+              col.fHEtaTrSB[h]->Fill(col.fEta[iTr]);
+            }
+            if(inSB2) {
+              if(fillOnce[iRng]==0) col.fHEtaDSB[h]->Fill(brD->eta_D);
+              col.fHEtaTrSB[h]->Fill(col.fEta[iTr]);
+            }
+          } //end if 2D plots (for debug plots)
+          fillOnce[iRng]++; //to avoid re-filling of D-meson debug plots with further tracks for the same meson
+        } //***end fill debug plots***
+
+      } //end ass track ranges
+    } //end ass track loop
+  } //end D-meson loop
+
+  return;
+}
+
 //___________________________________________________________________________________________
 void AliHFOfflineCorrelator::GetCorrelationsValue(AliHFCorrelationBranchD *brD, AliHFCorrelationBranchTr *brTr, Double_t &deltaPhi, Double_t &deltaEta) {
 
-  deltaPhi = brD->phi_D - brTr->phi_Tr;
+  GetCorrelationsValue(brD->phi_D,brD->eta_D,brTr->phi_Tr,brTr->eta_Tr,deltaPhi,deltaEta);
+
+  return;
+}
+
+//___________________________________________________________________________________________
+void AliHFOfflineCorrelator::GetCorrelationsValue(Float_t phiD, Float_t etaD, Float_t phiTr, Float_t etaTr, Double_t &deltaPhi, Double_t &deltaEta) const {
+
+  deltaPhi = phiD - phiTr;
   if(deltaPhi < -TMath::Pi()/2.)   deltaPhi = deltaPhi + 2*TMath::Pi();
   if(deltaPhi > 3.*TMath::Pi()/2.) deltaPhi = deltaPhi - 2*TMath::Pi();
 
-  deltaEta =  brD->eta_D - brTr->eta_Tr;
+  deltaEta =  etaD - etaTr;
 
   return;
 }
@@ -705,13 +1129,19 @@ void AliHFOfflineCorrelator::GetCorrelationsValue(AliHFCorrelationBranchD *brD,
 //___________________________________________________________________________________________
 Double_t AliHFOfflineCorrelator::GetEfficiencyWeight(AliHFCorrelationBranchD *brD, AliHFCorrelationBranchTr *brTr) {
 
+  return GetEfficiencyWeight(brD->pT_D,brD->mult_D,brTr->pT_Tr,brTr->eta_Tr,brTr->zVtx_Tr);
+}
+
+//___________________________________________________________________________________________
+Double_t AliHFOfflineCorrelator::GetEfficiencyWeight(Double_t ptD, Double_t multD, Double_t ptTr, Double_t etaTr, Double_t zVtxTr) const {
+
   Double_t effD = 1, effTr = 1;
    
-  Int_t binD=fMapEffD->FindBin(brD->pT_D,brD->mult_D);
+  Int_t binD=fMapEffD->FindBin(ptD,multD);
   if(fMapEffD->IsBinUnderflow(binD)||fMapEffD->IsBinOverflow(binD))return 1.;
   effD = fMapEffD->GetBinContent(binD);
 
-  Int_t binTr=fMapEffTr->FindBin(brTr->pT_Tr,brTr->eta_Tr,brTr->zVtx_Tr);
+  Int_t binTr=fMapEffTr->FindBin(ptTr,etaTr,zVtxTr);
   if(fMapEffTr->IsBinUnderflow(binTr)||fMapEffTr->IsBinOverflow(binTr))return 1.;
   effTr = fMapEffTr->GetBinContent(binTr);
 
@@ -888,6 +1318,14 @@ Bool_t AliHFOfflineCorrelator::IsSoftPionFromDstar(AliHFCorrelationBranchD *brD,
 	// Calculates invmass of track+D0 and rejects if compatible with D*
 	// (to remove fake pions from D* in ME events, and true soft pions in SE the cut)
 	// 
+	return IsSoftPionFromDstar(brD,brTr->pT_Tr,brTr->phi_Tr,brTr->eta_Tr);
+}
+
+//___________________________________________________________________________________________
+Bool_t AliHFOfflineCorrelator::IsSoftPionFromDstar(const AliHFCorrelationBranchD *brD, Double_t ptTr, Double_t phiTr, Double_t etaTr) const {
+	//
+	// Same as above, from the track kinematics
+	// 
 	Double_t nsigma = 3.;
 	
 	Double_t mPi = TDatabasePDG::Instance()->GetParticle(211)->Mass();
@@ -895,9 +1333,9 @@ Bool_t AliHFOfflineCorrelator::IsSoftPionFromDstar(AliHFCorrelationBranchD *brD,
 	Double_t pxD = brD->pT_D*TMath::Cos(brD->phi_D);
 	Double_t pyD = brD->pT_D*TMath::Sin(brD->phi_D);
 	Double_t pzD = brD->pT_D*TMath::SinH(brD->eta_D);
-	Double_t pxTr = brTr->pT_Tr*TMath::Cos(brTr->phi_Tr);
-	Double_t pyTr = brTr->pT_Tr*TMath::Sin(brTr->phi_Tr);
-	Double_t pzTr = brTr->pT_Tr*TMath::SinH(brTr->eta_Tr);
+	Double_t pxTr = ptTr*TMath::Cos(phiTr);
+	Double_t pyTr = ptTr*TMath::Sin(phiTr);
+	Double_t pzTr = ptTr*TMath::SinH(etaTr);
 	Double_t invmassDstar1 = 0, invmassDstar2 = 0; 
 	
 	//hyp 1 (pi,K) - D0
@@ -124,16 +124,22 @@ public:
     void SetCentralitySelection(Double_t min, Double_t max) {fMinCent=min; fMaxCent=max;} //activated only if both values are != 0
     void SetRejectSoftPion(Bool_t store) {fRejectSoftPi=store;}
     void SetDebugLevel(Int_t deb=0) {fDebug=deb;}
+    void SetColumnarLoop(Bool_t col=kTRUE) {fColumnarLoop=col;} //read the TTrees once per file and correlate by pools (same output as the entry-by-entry loop)
+    void SetNThreads(Int_t n) {fNThreads=(n>0 ? n : 1);} //threads over the pools, used only with the columnar loop (needs ROOT::EnableThreadSafety() in the steering macro)
 
     Bool_t Correlate();
 
     void DefineOutputObjects();
     void PrintCfg() const;
     Bool_t CorrelateSingleFile(Int_t iFile);
+    Bool_t CorrelateSingleFileColumnar(Int_t iFile);
     void GetCorrelationsValue(AliHFCorrelationBranchD *brD, AliHFCorrelationBranchTr *brTr, Double_t &deltaPhi, Double_t &deltaEta);
+    void GetCorrelationsValue(Float_t phiD, Float_t etaD, Float_t phiTr, Float_t etaTr, Double_t &deltaPhi, Double_t &deltaEta) const;
     Double_t GetEfficiencyWeight(AliHFCorrelationBranchD *brD, AliHFCorrelationBranchTr *brTr);
+    Double_t GetEfficiencyWeight(Double_t ptD, Double_t multD, Double_t ptTr, Double_t etaTr, Double_t zVtxTr) const;
     Double_t GetEfficiencyWeightDOnly(AliHFCorrelationBranchD *brD);
     Bool_t IsSoftPionFromDstar(AliHFCorrelationBranchD *brD, AliHFCorrelationBranchTr *brTr);
+    Bool_t IsSoftPionFromDstar(const AliHFCorrelationBranchD *brD, Double_t ptTr, Double_t phiTr, Double_t etaTr) const;
     Int_t PtBin(Double_t pt) const;
     Int_t GetPoolBin(Double_t mult, Double_t zVtx) const;
     Bool_t DefinePeriodWeights();
@@ -141,6 +147,11 @@ public:
     void SaveOutputPlots();
 
 private:
+
+    struct ColumnarData; //D mesons and tracks of a file, grouped by pool (defined in the implementation file)
+
+    Bool_t OpenInputFile(Int_t iFile, TDirectoryFile *&dir);
+    void CorrelatePool(Int_t pool, const ColumnarData &col, Int_t iFile);
     
     std::vector<TString>  fFileList;    //container of input filenames
     Int_t fNinputFiles;			//number of input files
@@ -201,8 +212,10 @@ private:
     Bool_t fMake2DPlots; 		//flag to produce 2D plots for sign.region and SB
     Bool_t fWeightPeriods;		//flag to weight periods in ME analysis with max number of tracks used
     Bool_t fRejectSoftPi;	     //flag to remove soft pions in SE and ME analysis for D0 meson (ME rejection is done in extraction code)
+    Bool_t fColumnarLoop;	//flag to correlate from in-memory columns grouped by pool, instead of TTree::GetEntry for each pair
+    Int_t fNThreads;		//number of threads for the columnar loop (pools are processed in parallel)
 
-    ClassDef(AliHFOfflineCorrelator,4); // class for plotting HF correlations
+    ClassDef(AliHFOfflineCorrelator,5); // class for plotting HF correlations
 
 };
 
@@ -46,6 +46,11 @@
 ClassImp(AliNormalizationCounter);
 /// \endcond
 
+const char *AliNormalizationCounter::fgkEventKeys[AliNormalizationCounter::kNEventKeys] = {
+  "triggered","V0AND","PileUp","PbPbC0SMH-B-NOPF-ALLNOTRD","Candles0.3","PrimaryV","countForNorm",
+  "noPrimaryV","zvtxGT10","!V0A&Candle03","!V0A&PrimaryV",
+  "Candid(Filter)","Candid(Analysis)","NCandid(Filter)","NCandid(Analysis)"};
+
 //____________________________________________
 AliNormalizationCounter::AliNormalizationCounter(): 
 TNamed(),
@@ -61,7 +66,12 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fFiller(),
+fRubricEvent(-1),
+fRubricMultiplicity(-1),
+fRubricSpherocity(-1),
+fRubricRun(-1)
 {
   // empty constructor
 }
@@ -81,7 +91,12 @@ fHistTrackFilterSpdMult(0),
 fHistTrackAnaSpdMult(0),
 fHistGenVertexZ(0),
 fHistGenVertexZRecoPV(0),
-fHistRecoVertexZ(0)
+fHistRecoVertexZ(0),
+fFiller(),
+fRubricEvent(-1),
+fRubricMultiplicity(-1),
+fRubricSpherocity(-1),
+fRubricRun(-1)
 {
   ;
 }
@@ -115,11 +130,12 @@ AliNormalizationCounter::~AliNormalizationCounter()
 void AliNormalizationCounter::Init()
 {
   //variables initialization
-  fCounters.AddRubric("Event","triggered/V0AND/PileUp/PbPbC0SMH-B-NOPF-ALLNOTRD/Candles0.3/PrimaryV/countForNorm/noPrimaryV/zvtxGT10/!V0A&Candle03/!V0A&PrimaryV/Candid(Filter)/Candid(Analysis)/NCandid(Filter)/NCandid(Analysis)");
+  fCounters.AddRubric("Event",EventKeys());
   if(fMultiplicity)  fCounters.AddRubric("Multiplicity", 5000);
   if(fSpherocity)  fCounters.AddRubric("Spherocity", (Int_t)fSpherocitySteps+1);
   fCounters.AddRubric("Run", 1000000);
   fCounters.Init();
+  InitFiller();
   fHistTrackFilterEvMult=new TH2F("FiltCandidvsTracksinEv","FiltCandidvsTracksinEv",10000,-0.5,9999.5,200,-0.5,199.5);
   fHistTrackFilterEvMult->GetYaxis()->SetTitle("NCandidates");
   fHistTrackFilterEvMult->GetXaxis()->SetTitle("NTracksinEvent");
@@ -137,6 +153,49 @@ void AliNormalizationCounter::Init()
   fHistRecoVertexZ=new TH1F("hRecoVertexZ","reconstructed z vertex; z_{vertex}^{rec} (cm) ; counts",600,-30,30);
 }
 
+//______________________________________________
+TString AliNormalizationCounter::EventKeys()
+{
+  // keys of the Event rubric, "triggered/V0AND/..."
+  TString keys=fgkEventKeys[0];
+  for(Int_t i=1;i<kNEventKeys;i++) keys+=Form("/%s",fgkEventKeys[i]);
+  return keys;
+}
+
+//______________________________________________
+void AliNormalizationCounter::InitFiller()
+{
+  // per event counts go to fFiller, with the rubrics of fCounters
+  // resolved once here, and are moved to fCounters by FlushCounters()
+  fFiller.Reset();
+  fRubricEvent=fFiller.AddRubric("Event",EventKeys());
+  fRubricMultiplicity = fMultiplicity ? fFiller.AddRubric("Multiplicity") : -1;
+  fRubricSpherocity = fSpherocity ? fFiller.AddRubric("Spherocity") : -1;
+  fRubricRun=fFiller.AddRubric("Run");
+}
+
+//______________________________________________
+void AliNormalizationCounter::FlushCounters()
+{
+  // move the buffered counts to fCounters, to be called before any use of fCounters
+  if(!fFiller.IsEmpty()) fFiller.Flush(fCounters);
+}
+
+//______________________________________________
+void AliNormalizationCounter::Streamer(TBuffer &R__b)
+{
+  // Stream an object of class AliNormalizationCounter.
+  // The buffered counts are flushed before writing, the filler is
+  // set up again after reading.
+  if (R__b.IsReading()) {
+    R__b.ReadClassBuffer(AliNormalizationCounter::Class(),this);
+    InitFiller();
+  } else {
+    FlushCounters();
+    R__b.WriteClassBuffer(AliNormalizationCounter::Class(),this);
+  }
+}
+
 //______________________________________________
 Long64_t AliNormalizationCounter::Merge(TCollection* list){
   if (!list) return 0;
@@ -161,6 +220,9 @@ Long64_t AliNormalizationCounter::Merge(TCollection* list){
 }
 //_______________________________________
 void AliNormalizationCounter::Add(const AliNormalizationCounter *norm){
+  FlushCounters();
+  // the counts of norm are moved to its own collection first, its content is unchanged
+  const_cast<AliNormalizationCounter*>(norm)->FlushCounters();
   fCounters.Add(&(norm->fCounters));
   fHistTrackFilterEvMult->Add(norm->fHistTrackFilterEvMult);
   fHistTrackAnaEvMult->Add(norm->fHistTrackAnaEvMult);
@@ -202,7 +264,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   //event must be either physics or MC
   if(!(event->GetEventType() == 7||event->GetEventType() == 0))return;
   
-  FillCounters("triggered",runNumber,multiplicity,spherocity);
+  FillCounters(kTriggered,runNumber,multiplicity,spherocity);
 
   //Find V0AND
   AliTriggerAnalysis trAn; /// Trigger Analysis
@@ -213,7 +275,7 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
     v0B = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0C);
     v0A = trAn.IsOfflineTriggerFired(eventESD , AliTriggerAnalysis::kV0A);
   }
-  if(v0A&&v0B) FillCounters("V0AND",runNumber,multiplicity,spherocity);
+  if(v0A&&v0B) FillCounters(kV0AND,runNumber,multiplicity,spherocity);
   
   //FindPrimary vertex  
   // AliVVertex *vtrc =  (AliVVertex*)event->GetPrimaryVertex();
@@ -226,30 +288,30 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   AliAODEvent *eventAOD = (AliAODEvent*)event;
   TString trigclass=eventAOD->GetFiredTriggerClasses();
   if(trigclass.Contains("C0SMH-B-NOPF-ALLNOTRD")||trigclass.Contains("C0SMH-B-NOPF-ALL")){
-    FillCounters("PbPbC0SMH-B-NOPF-ALLNOTRD",runNumber,multiplicity,spherocity);
+    FillCounters(kPbPbC0SMH,runNumber,multiplicity,spherocity);
   }
 
   //FindPrimary vertex  
   if(isEventSelected){
-    FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
     flagPV=kTRUE;
   }else{
     if(rdCut->GetWhyRejection()==0){
-      FillCounters("noPrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kNoPrimaryV,runNumber,multiplicity,spherocity);
     }
     //find good vtx outside range
     if(rdCut->GetWhyRejection()==6){
-      FillCounters("zvtxGT10",runNumber,multiplicity,spherocity);
-      FillCounters("PrimaryV",runNumber,multiplicity,spherocity);
+      FillCounters(kZvtxGT10,runNumber,multiplicity,spherocity);
+      FillCounters(kPrimaryV,runNumber,multiplicity,spherocity);
       flagPV=kTRUE;
     }
     if(rdCut->GetWhyRejection()==1){
-      FillCounters("PileUp",runNumber,multiplicity,spherocity);
+      FillCounters(kPileUp,runNumber,multiplicity,spherocity);
     }
   }
   //to be counted for normalization
   if(rdCut->CountEventForNormalization()){
-    FillCounters("countForNorm",runNumber,multiplicity,spherocity);
+    FillCounters(kCountForNorm,runNumber,multiplicity,spherocity);
   }
   // fill histograms of vertex position
   if(mc){
@@ -270,17 +332,17 @@ void AliNormalizationCounter::StoreEvent(AliVEvent *event,AliRDHFCuts *rdCut,Boo
   for(Int_t i=0;i<trkEntries&&!flag03;i++){
     AliAODTrack *track=(AliAODTrack*)event->GetTrack(i);
     if((track->Pt()>0.3)&&(!flag03)){
-      FillCounters("Candles0.3",runNumber,multiplicity,spherocity);
+      FillCounters(kCandles03,runNumber,multiplicity,spherocity);
       flag03=kTRUE;
       break;
     }
   }
   
   if(!(v0A&&v0B)&&(flag03)){ 
-    FillCounters("!V0A&Candle03",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0ACandle03,runNumber,multiplicity,spherocity);
   }
   if(!(v0A&&v0B)&&flagPV){
-    FillCounters("!V0A&PrimaryV",runNumber,multiplicity,spherocity);
+    FillCounters(kNoV0APrimaryV,runNumber,multiplicity,spherocity);
   }
   
   return;
@@ -305,37 +367,26 @@ void AliNormalizationCounter::StoreCandidates(AliVEvent *event,Int_t nCand,Bool_
   if(flagFilter)fHistTrackFilterSpdMult->Fill(nSPD,nCand);
   else fHistTrackAnaSpdMult->Fill(nSPD,nCand);
   
-  Int_t runNumber = event->GetRunNumber();
-  Int_t multiplicity = Multiplicity(event);
   if(nCand==0)return;
-  if(flagFilter){
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else 
-      fCounters.Count(Form("Event:Candid(Filter)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else 
-	fCounters.Count(Form("Event:NCandid(Filter)/Run:%d",runNumber));
-    }
-  }else{
-    if(fMultiplicity) 
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-    else
-      fCounters.Count(Form("Event:Candid(Analysis)/Run:%d",runNumber));
-    for(Int_t i=0;i<nCand;i++){ 
-      if(fMultiplicity) 
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d/Multiplicity:%d",runNumber,multiplicity));
-      else
-	fCounters.Count(Form("Event:NCandid(Analysis)/Run:%d",runNumber));
-    }
+  if(fRubricRun<0){
+    AliError("Init() has not been called");
+    return;
   }
+  // "Event:[N]Candid(...)/Run:%d[/Multiplicity:%d]", the spherocity is not given for the candidates
+  Int_t coord[4];
+  coord[fRubricEvent] = flagFilter ? kCandidFilter : kCandidAnalysis;
+  coord[fRubricRun] = event->GetRunNumber();
+  if(fMultiplicity) coord[fRubricMultiplicity] = Multiplicity(event);
+  if(fSpherocity) coord[fRubricSpherocity] = AliCounterCollectionFiller::kNoKey;
+  fFiller.Count(coord);
+  coord[fRubricEvent] = flagFilter ? kNCandidFilter : kNCandidAnalysis;
+  fFiller.Count(coord,nCand);
   return;
 }
 //_______________________________________________________________________
 TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
   //
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString selection;
   selection.Form("event:%s",candle.Data());
@@ -348,6 +399,7 @@ TH1D* AliNormalizationCounter::DrawAgainstRuns(TString candle,Bool_t drawHist){
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
   //
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString name;
 
@@ -365,10 +417,12 @@ TH1D* AliNormalizationCounter::DrawRatio(TString candle1,TString candle2){
 }
 //___________________________________________________________________________
 void AliNormalizationCounter::PrintRubrics(){
+  FlushCounters();
   fCounters.PrintKeyWords();
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetSum(TString candle){
+  FlushCounters();
   TString selection="event:";
   selection.Append(candle);
   return fCounters.GetSum(selection.Data());
@@ -400,6 +454,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(){
 }
 //___________________________________________________________________________
 Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t runnumber){
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("RUN");
   if(!listofruns.Contains(Form("%d",runnumber))){
     printf("WARNING: %d is not a valid run number\n",runnumber);
@@ -423,6 +478,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
     return 0.;
   }
 
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
 
   Int_t nmultbins = maxmultiplicity - minmultiplicity;
@@ -454,6 +510,7 @@ Double_t AliNormalizationCounter::GetNEventsForNorm(Int_t minmultiplicity, Int_t
     return 0.;
   }
 
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
   TString listofruns2 = fCounters.GetKeyWords("Spherocity");
   TObjArray* arr=listofruns2.Tokenize(",");
@@ -495,6 +552,7 @@ Double_t AliNormalizationCounter::GetNEventsForNormSpheroOnly(Double_t minsphero
     return 0.;
   }
 
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("Spherocity");
   TObjArray* arr=listofruns.Tokenize(",");
   Int_t nSphVals=arr->GetEntries();
@@ -531,6 +589,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
     return 0.;
   }
 
+  FlushCounters();
   TString listofruns = fCounters.GetKeyWords("Multiplicity");
   Double_t sum=0.;
   for (Int_t ibin=minmultiplicity; ibin<=maxmultiplicity; ibin++) {
@@ -549,6 +608,7 @@ Double_t AliNormalizationCounter::GetSum(TString candle,Int_t minmultiplicity, I
 //___________________________________________________________________________
 TH1D* AliNormalizationCounter::DrawNEventsForNorm(Bool_t drawRatio){
   //usare algebra histos
+  FlushCounters();
   fCounters.SortRubric("Run");
   TString selection;
 
@@ -603,17 +663,18 @@ Int_t AliNormalizationCounter::Multiplicity(AliVEvent* event){
 }
 
 //___________________________________________________________________________
-void AliNormalizationCounter::FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
-
-
-  Int_t sphToInteger=spherocity*fSpherocitySteps;
-  if(fMultiplicity  && !fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d",name.Data(),runNumber,multiplicity));
-  else if(fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Multiplicity:%d/Spherocity:%d",name.Data(),runNumber,multiplicity,sphToInteger));
-  else if(!fMultiplicity  && fSpherocity) 
-    fCounters.Count(Form("Event:%s/Run:%d/Spherocity:%d",name.Data(),runNumber,sphToInteger));
-  else 
-    fCounters.Count(Form("Event:%s/Run:%d",name.Data(),runNumber));
+void AliNormalizationCounter::FillCounters(Int_t key, Int_t runNumber, Int_t multiplicity, Double_t spherocity){
+
+  if(fRubricRun<0){
+    AliError("Init() has not been called");
+    return;
+  }
+  // same keys as "Event:%s/Run:%d[/Multiplicity:%d][/Spherocity:%d]" in fCounters
+  Int_t coord[4];
+  coord[fRubricEvent]=key;
+  coord[fRubricRun]=runNumber;
+  if(fMultiplicity) coord[fRubricMultiplicity]=multiplicity;
+  if(fSpherocity) coord[fRubricSpherocity]=(Int_t)(spherocity*fSpherocitySteps);
+  fFiller.Count(coord);
   return;
 }
@@ -40,6 +40,7 @@
 #include <AliVParticle.h>
 #include "AliAnalysisTaskSE.h"
 #include "AliCounterCollection.h"
+#include "AliCounterCollectionFiller.h"
 #include "AliAnalysisDataSlot.h"
 #include "AliAnalysisDataContainer.h"
 #include "AliRDHFCuts.h"
@@ -54,7 +55,7 @@ class AliNormalizationCounter : public TNamed
   virtual ~AliNormalizationCounter();
   Long64_t Merge(TCollection* list);
 
-  AliCounterCollection* GetCounter(){return &fCounters;}
+  AliCounterCollection* GetCounter(){FlushCounters(); return &fCounters;}
   void Init();
   void Add(const AliNormalizationCounter*);
   void SetESD(Bool_t flag){fESD=flag;}
@@ -87,7 +88,16 @@ class AliNormalizationCounter : public TNamed
   AliNormalizationCounter(const AliNormalizationCounter &source);
   AliNormalizationCounter& operator=(const AliNormalizationCounter& source);
   Int_t Multiplicity(AliVEvent* event);
-  void FillCounters(TString name, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+  static TString EventKeys();
+  void InitFiller();
+  void FlushCounters();
+  void FillCounters(Int_t key, Int_t runNumber, Int_t multiplicity, Double_t spherocity);
+
+  /// keys of the Event rubric, in the order of fgkEventKeys
+  enum EEventKey {kTriggered, kV0AND, kPileUp, kPbPbC0SMH, kCandles03, kPrimaryV, kCountForNorm,
+		  kNoPrimaryV, kZvtxGT10, kNoV0ACandle03, kNoV0APrimaryV,
+		  kCandidFilter, kCandidAnalysis, kNCandidFilter, kNCandidAnalysis, kNEventKeys};
+  static const char *fgkEventKeys[kNEventKeys]; /// names of the keys of the Event rubric
 
 
   AliCounterCollection fCounters; /// internal counter
@@ -103,9 +113,14 @@ class AliNormalizationCounter : public TNamed
   TH1F *fHistGenVertexZ;       /// histo of generated z vertex
   TH1F *fHistGenVertexZRecoPV; /// histo of generated z vertex for events with reco vert
   TH1F *fHistRecoVertexZ;      /// histo of reconstructed z vertex
+  AliCounterCollectionFiller fFiller; //!<! counts of the current job, flushed into fCounters before any use
+  Int_t fRubricEvent;          //!<! coordinate of the Event rubric in fFiller
+  Int_t fRubricMultiplicity;   //!<! coordinate of the Multiplicity rubric in fFiller (-1 if not studied)
+  Int_t fRubricSpherocity;     //!<! coordinate of the Spherocity rubric in fFiller (-1 if not studied)
+  Int_t fRubricRun;            //!<! coordinate of the Run rubric in fFiller (-1 before Init)
 
   /// \cond CLASSIMP    
-  ClassDef(AliNormalizationCounter,8);
+  ClassDef(AliNormalizationCounter,9);
   /// \endcond
 };
 #endif
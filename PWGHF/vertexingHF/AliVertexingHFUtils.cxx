@@ -27,6 +27,7 @@
 #include "AliGenEventHeader.h"
 #include "AliAODMCParticle.h"
 #include "AliAODRecoDecayHF.h"
+#include "AliEventShapeCalculator.h"
 #include "AliVertexingHFUtils.h"
 
 /* $Id$ */
@@ -2113,10 +2114,7 @@ Double_t AliVertexingHFUtils::GetSphericity(AliAODEvent* aod,
   Int_t nTracks=aod->GetNumberOfTracks();
   Int_t nSelTracks=0;
 
-  Double_t sumpt=0.;
-  Double_t s00=0.;
-  Double_t s01=0.;
-  Double_t s11=0.;
+  AliEventShapeCalculator shape;
   if(ptMin<0.) ptMin=0.;
 
   for(Int_t it=0; it<nTracks; it++) {
@@ -2133,29 +2131,14 @@ Double_t AliVertexingHFUtils::GetSphericity(AliAODEvent* aod,
     if(filtbit1==1 && !tpcRefit) fb1=kFALSE;
     if(filtbit2==1 && !tpcRefit) fb2=kFALSE;
     if( !(fb1 || fb2) ) continue;
-    Double_t px=pt*TMath::Cos(phi);
-    Double_t py=pt*TMath::Sin(phi);
-    s00 += (px * px)/pt;
-    s01 += (py * px)/pt;
-    s11 += (py * py)/pt;
+    shape.AddParticlePtPhi(pt,phi);
     nSelTracks++;
-    sumpt+=pt;
   }
 
   if(nSelTracks<minMult) return -0.5;
+  if(!(shape.GetSumPt()>0.)) return -0.5;
 
-  if(sumpt>0.){
-    s00/=sumpt;
-    s01/=sumpt;
-    s11/=sumpt;
-  }else return -0.5;
-
-  Double_t sphericity = -10;
-  Double_t lambda1=((s00+s11)+TMath::Sqrt((s00+s11)*(s00+s11)-4*(s00*s11-s01*s01)))/2.;
-  Double_t lambda2=((s00+s11)-TMath::Sqrt((s00+s11)*(s00+s11)-4*(s00*s11-s01*s01)))/2.;
-  if(TMath::Abs(lambda2)<0.00001 && TMath::Abs(lambda1)<0.00001) sphericity=0;
-  if(TMath::Abs(lambda1+lambda2)>0.000001) sphericity=2*TMath::Min(lambda1,lambda2)/(lambda1+lambda2);
-  return sphericity;
+  return shape.GetSphericity();
 
 }
 
@@ -2173,9 +2156,7 @@ void AliVertexingHFUtils::GetSpherocity(AliAODEvent* aod,
   Int_t nTracks=aod->GetNumberOfTracks();
   Int_t nSelTracks=0;
 
-  Double_t* ptArr=new Double_t[nTracks];
-  Double_t* phiArr=new Double_t[nTracks];
-  Double_t sumpt=0.;
+  AliEventShapeCalculator shape;
 
   for(Int_t it=0; it<nTracks; it++) {
     AliAODTrack *tr=dynamic_cast<AliAODTrack*>(aod->GetTrack(it));
@@ -2199,37 +2180,15 @@ void AliVertexingHFUtils::GetSpherocity(AliAODEvent* aod,
     if(filtbit1==1 && !tpcRefit) fb1=kFALSE;
     if(filtbit2==1 && !tpcRefit) fb2=kFALSE;
     if( !(fb1 || fb2) ) continue;
-    ptArr[nSelTracks]=pt;
-    phiArr[nSelTracks]=phi;
+    shape.AddParticlePtPhi(pt,phi);
     nSelTracks++;
-    sumpt+=pt;
   }
 
   if(nSelTracks<minMult){spherocity = -0.5; return;}
 
-  //Getting thrust
-  spherocity=2.;
-  for(Int_t i=0; i<360/phiStepSizeDeg; ++i){
-    Double_t phistep=TMath::Pi()*(Double_t)i*phiStepSizeDeg/180.;
-    Double_t nx=TMath::Cos(phistep);
-    Double_t ny=TMath::Sin(phistep);
-    Double_t numer=0.;
-    for(Int_t j=0; j<nSelTracks; ++j){
-      Double_t pxA=ptArr[j]*TMath::Cos(phiArr[j]);  // x component of an unitary vector n
-      Double_t pyA=ptArr[j]*TMath::Sin(phiArr[j]);  // y component of an unitary vector n
-      numer+=TMath::Abs(ny*pxA - nx*pyA);
-    }
-    Double_t pFull=numer*numer/(sumpt*sumpt);
-    if(pFull<spherocity){
-        spherocity=pFull; // minimization;
-        phiRef=phistep;
-    }
-  }
-
-  delete [] ptArr;
-  delete [] phiArr;
-
-  spherocity*=(TMath::Pi()*TMath::Pi()/4.);
+  // phiStepSizeDeg>0: scan of the axis in steps of phiStepSizeDeg, otherwise exact minimisation
+  if(phiStepSizeDeg>0.) spherocity=shape.GetSpherocityGrid(phiStepSizeDeg,AliEventShapeCalculator::kDoubleSquares,&phiRef);
+  else spherocity=shape.GetSpherocity(&phiRef);
   return;
 
 }
@@ -2245,9 +2204,7 @@ void AliVertexingHFUtils::GetGeneratedSpherocity(TClonesArray *arrayMC,
   Int_t nParticles=arrayMC->GetEntriesFast();
   Int_t nSelParticles=0;
 
-  Double_t* ptArr=new Double_t[nParticles];
-  Double_t* phiArr=new Double_t[nParticles];
-  Double_t sumpt=0.;
+  AliEventShapeCalculator shape;
 
   for(Int_t ip=0; ip<nParticles; ip++) {
     AliAODMCParticle *part=(AliAODMCParticle*)arrayMC->UncheckedAt(ip);
@@ -2262,37 +2219,15 @@ void AliVertexingHFUtils::GetGeneratedSpherocity(TClonesArray *arrayMC,
     if(eta<etaMin || eta>etaMax) continue;
     if(pt<ptMin || pt>ptMax) continue;
 
-    ptArr[nSelParticles]=pt;
-    phiArr[nSelParticles]=phi;
+    shape.AddParticlePtPhi(pt,phi);
     nSelParticles++;
-    sumpt+=pt;
   }
 
   if(nSelParticles<minMult){spherocity = -0.5; return;}
 
-  //Getting thrust
-  spherocity=2.;
-  for(Int_t i=0; i<360/phiStepSizeDeg; ++i){
-    Double_t phistep=TMath::Pi()*(Double_t)i*phiStepSizeDeg/180.;
-    Double_t nx=TMath::Cos(phistep);
-    Double_t ny=TMath::Sin(phistep);
-    Double_t numer=0.;
-    for(Int_t j=0; j<nSelParticles; ++j){
-      Double_t pxA=ptArr[j]*TMath::Cos(phiArr[j]);  // x component of an unitary vector n
-      Double_t pyA=ptArr[j]*TMath::Sin(phiArr[j]);  // y component of an unitary vector n
-      numer+=TMath::Abs(ny*pxA - nx*pyA);
-    }
-    Double_t pFull=numer*numer/(sumpt*sumpt);
-    if(pFull<spherocity){
-        spherocity=pFull; // minimization;
-        phiRef=phistep;
-    }
-  }
-
-  delete [] ptArr;
-  delete [] phiArr;
-
-  spherocity*=(TMath::Pi()*TMath::Pi()/4.);
+  // phiStepSizeDeg>0: scan of the axis in steps of phiStepSizeDeg, otherwise exact minimisation
+  if(phiStepSizeDeg>0.) spherocity=shape.GetSpherocityGrid(phiStepSizeDeg,AliEventShapeCalculator::kDoubleSquares,&phiRef);
+  else spherocity=shape.GetSpherocity(&phiRef);
   return;
 
 }
@@ -91,6 +91,7 @@ class AliVertexingHFUtils : public TObject{
   static Int_t GetGeneratedPhysicalPrimariesInEtaRange(TClonesArray* arrayMC, Double_t mineta, Double_t maxeta);
 
   /// Functions for event shape variables
+  /// (spherocity: phiStepSizeDeg<=0 minimises exactly instead of scanning the axis)
   static void GetSpherocity(AliAODEvent* aod,
                             Double_t &spherocity, Double_t &phiRef,
                             Double_t etaMin=-0.8, Double_t etaMax=0.8,
@@ -52,7 +52,7 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho() :
   fUseScaledRho(0), fCentralityClasses(0), fUserSuppliedV2(0), fUserSuppliedV3(0), fUserSuppliedR2(0), 
   fUserSuppliedR3(0), fNAcceptedTracks(0), fNAcceptedTracksQCn(0), fInCentralitySelection(-1), 
   fFitModulationType(kNoFit), fQCRecovery(kTryFit), fUsePtWeight(kTRUE), fUsePtWeightErrorPropagation(kFALSE), fDetectorType(kTPC), 
-  fFitModulationOptions("WLQI"), fRunModeType(kGrid), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
+  fFitModulationOptions("WLQI"), fRunModeType(kGrid), fFitModulation(0), fUseLinearFit(kFALSE), fLinearFit(), fCheckLinearFit(kFALSE), fHistLinearFitCheck(0), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
   fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
   fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
@@ -74,7 +74,7 @@ AliAnalysisTaskLocalRho::AliAnalysisTaskLocalRho(const char* name, runModeType t
   fUseScaledRho(0), fCentralityClasses(0), fUserSuppliedV2(0), fUserSuppliedV3(0), fUserSuppliedR2(0), 
   fUserSuppliedR3(0), fNAcceptedTracks(0), fNAcceptedTracksQCn(0), fInCentralitySelection(-1), 
   fFitModulationType(kNoFit), fQCRecovery(kTryFit), fUsePtWeight(kTRUE), fUsePtWeightErrorPropagation(kFALSE), fDetectorType(kTPC), 
-  fFitModulationOptions("WLQI"), fRunModeType(type), fFitModulation(0), fMinPvalue(0.01), fMaxPvalue(1), 
+  fFitModulationOptions("WLQI"), fRunModeType(type), fFitModulation(0), fUseLinearFit(kFALSE), fLinearFit(), fCheckLinearFit(kFALSE), fHistLinearFitCheck(0), fMinPvalue(0.01), fMaxPvalue(1), 
   fLocalJetMinEta(-10), fLocalJetMaxEta(-10), fLocalJetMinPhi(-10), fLocalJetMaxPhi(-10), fSoftTrackMinPt(0.15), 
   fSoftTrackMaxPt(5.), fHistPvalueCDF(0), fHistRhoStatusCent(0), fAbsVnHarmonics(kTRUE), fExcludeLeadingJetsFromFit(1.), 
   fRebinSwapHistoOnTheFly(kTRUE), fPercentageOfFits(10.), fUseV0EventPlaneFromHeader(kTRUE), fOutputList(0), 
@@ -173,6 +173,11 @@ Bool_t AliAnalysisTaskLocalRho::InitializeAnalysis()
     fFitModulation->SetParameter(7, 0.2);      // v3
   } break;
   }
+  if(fUseLinearFit && !AliRhoModulationLinearFit::IsLinearFitOption(fFitModulationOptions.Data())) {
+    // the closed form needs a chi2 fit, use the one with the same weights
+    fFitModulationOptions = AliRhoModulationLinearFit::GetLinearFitOptions(fFitModulationOptions.Data());
+    AliInfo(Form("closed form fit of the modulation, fit options changed to %s", fFitModulationOptions.Data()));
+  }
   switch (fRunModeType) {
   case kGrid : { fFitModulationOptions += "N0"; } break;
   default : break;
@@ -208,6 +213,8 @@ void AliAnalysisTaskLocalRho::UserCreateOutputObjects()
   // cdf of chisquare distribution
   fHistPvalueCDF = BookTH1F("fHistPvalueCDF", "CDF #chi^{2}", 500, 0, 1);
   fHistRhoStatusCent = BookTH2F("fHistRhoStatusCent", "centrality", "status [0=ok, 1=failed]", 101, -1, 100, 2, -.5, 1.5);
+  // closed form fit compared with TH1::Fit: parameters in units of the error, chi2 relative
+  if(fUseLinearFit && fCheckLinearFit) fHistLinearFitCheck = BookTH2F("fHistLinearFitCheck", "[0=#rho_{0}, 1=v_{2}, 2=v_{3}, 3=#chi^{2}]", "closed form - TH1::Fit", 4, -.5, 3.5, 200, -.01, .01);
   // vn profiles
   Float_t temp[fCentralityClasses->GetSize()];
   for(Int_t i(0); i < fCentralityClasses->GetSize(); i++) temp[i] = fCentralityClasses->At(i);
@@ -921,7 +928,9 @@ Bool_t AliAnalysisTaskLocalRho::CorrectRho(Double_t psi2, Double_t psi3)
   } break;
   default : break;
   }
-  _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
+  Bool_t linear(fUseLinearFit && (fFitModulationType == kV2 || fFitModulationType == kV3 || fFitModulationType == kCombined));
+  if(linear) linear = fLinearFit.FitModulation(fFitModulation, (fFitModulationType == kCombined) ? AliRhoModulationLinearFit::kCombined : ((fFitModulationType == kV3) ? AliRhoModulationLinearFit::kV3 : AliRhoModulationLinearFit::kV2), &_tempSwap, 0, TMath::TwoPi(), fFitModulationOptions.Data(), fHistLinearFitCheck);
+  if(!linear) _tempSwap.Fit(fFitModulation, fFitModulationOptions.Data(), "", 0, TMath::TwoPi());
   // the quality of the fit is evaluated from 1 - the cdf of the chi square distribution
   Double_t CDF(1.-ChiSquareCDF(fFitModulation->GetNDF(), fFitModulation->GetChisquare()));
   if(fFillHistograms) fHistPvalueCDF->Fill(CDF);
@@ -16,6 +16,7 @@
 #include <TRandom3.h>
 #include <AliLog.h>
 #include <AliJetContainer.h>
+#include "AliRhoModulationLinearFit.h"
 
 class TF1;
 class THF1;
@@ -74,6 +75,8 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   void                    SetModulationFitType(fitModulationType type)    {fFitModulationType = type; }
   void                    SetQCnRecoveryType(qcRecovery type)             {fQCRecovery = type; }
   void                    SetModulationFitOptions(TString opt)            {fFitModulationOptions = opt; }
+  void                    SetUseLinearFit(Bool_t l)                       {fUseLinearFit = l; }
+  void                    SetCheckLinearFit(Bool_t c)                     {fCheckLinearFit = c; }
   void                    SetReferenceDetector(detectorType type)         {fDetectorType = type; }
   void                    SetUsePtWeight(Bool_t w)                        {fUsePtWeight = w; }
   void                    SetUsePtWeightErrorPropagation(Bool_t w)        {fUsePtWeightErrorPropagation = w;}
@@ -130,6 +133,10 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   TString                 fFitModulationOptions;  // fit options for modulation fit
   runModeType             fRunModeType;           // run mode type 
   TF1*                    fFitModulation;         // modulation fit for rho
+  Bool_t                  fUseLinearFit;          // fit kV2, kV3, kCombined in closed form instead of with minuit
+  AliRhoModulationLinearFit fLinearFit;           //! closed form fit of the modulation
+  Bool_t                  fCheckLinearFit;        // compare the closed form fit with TH1::Fit
+  TH2F*                   fHistLinearFitCheck;    //! closed form fit - TH1::Fit
   Float_t                 fMinPvalue;             // minimum value of p
   Float_t                 fMaxPvalue;             // maximum value of p
   // additional jet cuts (most are inherited)
@@ -164,6 +171,6 @@ class AliAnalysisTaskLocalRho : public AliAnalysisTaskEmcalJet {
   AliAnalysisTaskLocalRho(const AliAnalysisTaskLocalRho&);                  // not implemented
   AliAnalysisTaskLocalRho& operator=(const AliAnalysisTaskLocalRho&);       // not implemented
 
-  ClassDef(AliAnalysisTaskLocalRho, 6);
+  ClassDef(AliAnalysisTaskLocalRho, 8);
 };
 #endif
@@ -21,7 +21,8 @@ ClassImp(AliAnalysisTaskRho)
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho() : 
   AliAnalysisTaskRhoBase("AliAnalysisTaskRho"),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -29,7 +30,8 @@ AliAnalysisTaskRho::AliAnalysisTaskRho() :
 //________________________________________________________________________
 AliAnalysisTaskRho::AliAnalysisTaskRho(const char *name, Bool_t histo) :
   AliAnalysisTaskRhoBase(name, histo),
-  fNExclLeadJets(0)
+  fNExclLeadJets(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -79,8 +81,7 @@ Bool_t AliAnalysisTaskRho::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
+  fRhoKernel.Reset();
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -98,14 +99,13 @@ Bool_t AliAnalysisTaskRho::Run()
     if (!AcceptJet(jet))
       continue;
 
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    fRhoKernel.AddDensity(jet->Pt() / jet->Area());
   }
 
 
-  if (NjetAcc > 0) {
+  if (fRhoKernel.GetNDensities() > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = fRhoKernel.GetRho();
     fOutRho->SetVal(rho);
 
     if (fOutRhoScaled) {
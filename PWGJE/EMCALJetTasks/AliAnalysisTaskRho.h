@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoBase.h"
+#include "AliRhoKernel.h"
 
 class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
 
@@ -18,10 +19,11 @@ class AliAnalysisTaskRho : public AliAnalysisTaskRhoBase {
   Bool_t           Run();
 
   UInt_t           fNExclLeadJets;                 // number of leading jets to be excluded from the median calculation
+  AliRhoKernel     fRhoKernel;                     //!median and occupancy calculation
 
   AliAnalysisTaskRho(const AliAnalysisTaskRho&);             // not implemented
   AliAnalysisTaskRho& operator=(const AliAnalysisTaskRho&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRho, 10); // Rho task
+  ClassDef(AliAnalysisTaskRho, 11); // Rho task
 };
 #endif
@@ -39,7 +39,8 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev() :
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
   fOccupancyFactor(0),
-  fHistOccCorrvsCent(nullptr)
+  fHistOccCorrvsCent(nullptr),
+  fRhoKernel()
 {
 }
 
@@ -55,7 +56,8 @@ AliAnalysisTaskRhoDev::AliAnalysisTaskRhoDev(const char *name, Bool_t histo) :
   fRhoSparse(kFALSE),
   fExclJetOverlap(),
   fOccupancyFactor(0),
-  fHistOccCorrvsCent(nullptr)
+  fHistOccCorrvsCent(nullptr),
+  fRhoKernel()
 {
 }
 
@@ -104,11 +106,10 @@ void AliAnalysisTaskRhoDev::CalculateRho()
 
   auto maxJets = GetLeadingJets();
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
-  Double_t TotaljetArea = 0; // Total area of background jets (including ghost jets)
-  Double_t TotaljetAreaPhys = 0; // Total area of physical background jets (excluding ghost jets)
+  // Total area of background jets (including ghost jets) and of physical background jets
+  // (excluding ghost jets) and the densities are accumulated in the same pass.
   // Ghost jet is a jet made only of ghost particles
+  fRhoKernel.Reset();
 
   AliJetContainer* bkgJetCont = fJetCollArray["Background"];
   AliJetContainer* sigJetCont = nullptr;
@@ -117,45 +118,32 @@ void AliAnalysisTaskRhoDev::CalculateRho()
     if (sigJetContIt != fJetCollArray.end()) sigJetCont = sigJetContIt->second;
   }
 
+  // constituents of the signal jets, for the overlap test
+  if (sigJetCont) {
+    for (auto sigJet : sigJetCont->accepted()) fRhoKernel.AddSignalJet(sigJet);
+  }
+
   // push all jets within selected acceptance into stack
   for (auto jet : bkgJetCont->accepted()) {
 
-    TotaljetArea += jet->Area();
+    fRhoKernel.AddArea(jet->Area(), !jet->IsGhost());
 
     if (jet->IsGhost()) continue;
 
-    TotaljetAreaPhys += jet->Area();
-
     // excluding leading jets
     if (jet == maxJets.first || jet == maxJets.second) continue;
 
-    Bool_t overlapsWithSignal = kFALSE;
-    if (sigJetCont) {
-      for (auto sigJet : sigJetCont->accepted()) {
-        if (AreJetsOverlapping(jet, sigJet)) {
-          overlapsWithSignal = kTRUE;
-          break;
-        }
-      }
-    }
+    if (fRhoKernel.IsOverlappingSignal(jet)) continue;
 
-    if (overlapsWithSignal) continue;
-
-    rhovec[NjetAcc] = jet->Pt() / jet->Area();
-    ++NjetAcc;
+    fRhoKernel.AddDensity(jet->Pt() / jet->Area());
   }
 
   // Occupancy correction for sparse event described in https://arxiv.org/abs/1207.2392
-  if (TotaljetArea > 0) {
-    fOccupancyFactor = TotaljetAreaPhys / TotaljetArea;
-  }
-  else {
-    fOccupancyFactor = 0;
-  }
+  fOccupancyFactor = fRhoKernel.GetOccupancy();
 
-  if (NjetAcc > 0) {
+  if (fRhoKernel.GetNDensities() > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = fRhoKernel.GetRho();
 
     if (fRhoSparse) rho = rho * fOccupancyFactor;
 
@@ -18,6 +18,7 @@
 #include <utility>
 
 #include "AliAnalysisTaskRhoBaseDev.h"
+#include "AliRhoKernel.h"
 
 /** \class AliAnalysisTaskRhoDev
  * \brief Class for a task that calculates the UE
@@ -72,12 +73,13 @@ class AliAnalysisTaskRhoDev : public AliAnalysisTaskRhoBaseDev {
 
   Double_t         fOccupancyFactor;               //!<!occupancy correction factor for sparse events
   TH2F            *fHistOccCorrvsCent;             //!<!occupancy correction vs. centrality
+  AliRhoKernel     fRhoKernel;                     //!<!median, occupancy and signal overlap calculation
 
   AliAnalysisTaskRhoDev(const AliAnalysisTaskRhoDev&);             // not implemented
   AliAnalysisTaskRhoDev& operator=(const AliAnalysisTaskRhoDev&);  // not implemented
   
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskRhoDev, 2);
+  ClassDef(AliAnalysisTaskRhoDev, 3);
   /// \endcond
 };
 #endif
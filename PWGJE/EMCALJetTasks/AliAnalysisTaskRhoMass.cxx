@@ -24,7 +24,8 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -35,7 +36,8 @@ AliAnalysisTaskRhoMass::AliAnalysisTaskRhoMass(const char *name, Bool_t histo) :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -101,10 +103,9 @@ Bool_t AliAnalysisTaskRhoMass::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
-  Int_t NjetAcc = 0;
+  fRhoKernel.Reset();
+  Double_t sumE = 0.;
+  Double_t sumM = 0.;
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -127,22 +128,23 @@ Bool_t AliAnalysisTaskRhoMass::Run()
     if(jet->Area()>0.) {// && (jet->M()*jet->M() + jet->Pt()*jet->Pt())>0.) {
       //rhomvec[NjetAcc] = (TMath::Sqrt(sumM*sumM + sumPt*sumPt) - sumPt ) / jet->Area();
       // rhomvec[NjetAcc] = (TMath::Sqrt(jet->M()*jet->M() + jet->Pt()*jet->Pt()) - jet->Pt() ) / jet->Area();
-      rhomvec[NjetAcc] = GetMd(jet) / jet->Area();
-      fHistMdAreavsCent->Fill(fCent,rhomvec[NjetAcc]);
-      Evec[NjetAcc] = jet->E();
-      Mvec[NjetAcc] = jet->M();
-      ++NjetAcc;
+      Double_t rhom = GetMd(jet) / jet->Area();
+      fHistMdAreavsCent->Fill(fCent,rhom);
+      fRhoKernel.AddDensity(jet->Pt() / jet->Area(), rhom);
+      sumE += jet->E();
+      sumM += jet->M();
     }
   }
 
+  Int_t NjetAcc = fRhoKernel.GetNDensities();
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = fRhoKernel.GetRhoM();
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
-    Double_t meanM = TMath::Mean(NjetAcc, Mvec);
-    Double_t meanE = TMath::Mean(NjetAcc, Evec);
+    Double_t meanM = sumM / NjetAcc;
+    Double_t meanE = sumE / NjetAcc;
     Double_t gamma = 0.;
     if(meanM>0.) gamma = meanE/meanM;
     fHistGammaVsNtrack->Fill(Ntracks,gamma);
@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoMassBase.h"
+#include "AliRhoKernel.h"
 
 class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
 
@@ -36,10 +37,11 @@ class AliAnalysisTaskRhoMass : public AliAnalysisTaskRhoMassBase {
   Bool_t           fPionMassClusters;              // assume pion mass for clusters
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
+  AliRhoKernel     fRhoKernel;                     //!median calculation
 
   AliAnalysisTaskRhoMass(const AliAnalysisTaskRhoMass&);             // not implemented
   AliAnalysisTaskRhoMass& operator=(const AliAnalysisTaskRhoMass&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMass, 2); // Rho_m task
+  ClassDef(AliAnalysisTaskRhoMass, 3); // Rho_m task
 };
 #endif
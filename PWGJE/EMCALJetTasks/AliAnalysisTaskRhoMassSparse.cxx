@@ -25,7 +25,8 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse() :
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -36,7 +37,8 @@ AliAnalysisTaskRhoMassSparse::AliAnalysisTaskRhoMassSparse(const char *name, Boo
   fNExclLeadJets(0),
   fJetRhoMassType(kMd),
   fPionMassClusters(kFALSE),
-  fHistMdAreavsCent(0)
+  fHistMdAreavsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -137,12 +139,21 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     }
   }
 
-  static Double_t rhomvec[999];
-  static Double_t Evec[999];
-  static Double_t Mvec[999];
-  Int_t NjetAcc = 0;
-  Double_t TotaljetArea=0;
-  Double_t TotaljetAreaPhys=0;
+  fRhoKernel.Reset();
+  Double_t sumE = 0.;
+  Double_t sumM = 0.;
+
+  // signal jets, registered once per event for the overlap search
+  if (sigjets) {
+    for (Int_t j = 0; j < NjetsSig; j++) {
+      AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
+      if (!signalJet)
+        continue;
+      if (!IsJetSignal(signalJet))
+        continue;
+      fRhoKernel.AddSignalJet(signalJet);
+    }
+  }
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -157,35 +168,13 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
       continue;
     } 
 
-    TotaljetArea+=jet->Area();
-
-    if(jet->Pt()>0.1){
-      TotaljetAreaPhys+=jet->Area();
-    }
+    fRhoKernel.AddArea(jet->Area(), jet->Pt() > 0.1);
 
     if (!AcceptJet(jet))
       continue;
 
-      // Search for overlap with signal jets
-    Bool_t isOverlapping = kFALSE;
-    if (sigjets) {
-      for(Int_t j=0;j<NjetsSig;j++)
-	{
-	  AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
-	  if(!signalJet)
-	    continue;
-	  if(!IsJetSignal(signalJet))     
-	    continue;
-	  
-	  if(IsJetOverlapping(signalJet, jet))
-	    {
-	      isOverlapping = kTRUE;
-	      break;
-	    }
-	}
-    }
-
-    if(isOverlapping) 
+    // Search for overlap with signal jets
+    if (fRhoKernel.IsOverlappingSignal(jet))
       continue;
 
     // Double_t sumM = GetSumMConstituents(jet);
@@ -194,24 +183,24 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     if(jet->Area()>0.) {// && (jet->M()*jet->M() + jet->Pt()*jet->Pt())>0.) {
        //rhomvec[NjetAcc] = (TMath::Sqrt(sumM*sumM + sumPt*sumPt) - sumPt ) / jet->Area();
       // rhomvec[NjetAcc] = (TMath::Sqrt(jet->M()*jet->M() + jet->Pt()*jet->Pt()) - jet->Pt() ) / jet->Area();
-      rhomvec[NjetAcc] = GetMd(jet) / jet->Area();
-      fHistMdAreavsCent->Fill(fCent,rhomvec[NjetAcc]);
-      Evec[NjetAcc] = jet->E();
-      Mvec[NjetAcc] = jet->M();
-      ++NjetAcc;
+      Double_t rhom = GetMd(jet) / jet->Area();
+      fHistMdAreavsCent->Fill(fCent,rhom);
+      fRhoKernel.AddDensity(jet->Pt() / jet->Area(), rhom);
+      sumE += jet->E();
+      sumM += jet->M();
     }
   }
 
-  Double_t OccCorr=0.0;
-  if(TotaljetArea>0) OccCorr=TotaljetAreaPhys/TotaljetArea;
+  Double_t OccCorr = fRhoKernel.GetOccupancy();
  
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
 
+  Int_t NjetAcc = fRhoKernel.GetNDensities();
   if (NjetAcc > 0) {
     //find median value
-    Double_t rhom = TMath::Median(NjetAcc, rhomvec);
+    Double_t rhom = fRhoKernel.GetRhoM();
     if(fRhoCMS){
       rhom = rhom * OccCorr;
     }
@@ -219,8 +208,8 @@ Bool_t AliAnalysisTaskRhoMassSparse::Run()
     fOutRhoMass->SetVal(rhom);
 
     Int_t Ntracks = fTracks->GetEntries();
-    Double_t meanM = TMath::Mean(NjetAcc, Mvec);
-    Double_t meanE = TMath::Mean(NjetAcc, Evec);
+    Double_t meanM = sumM / NjetAcc;
+    Double_t meanE = sumE / NjetAcc;
     Double_t gamma = 0.;
     if(meanM>0.) gamma = meanE/meanM;
     fHistGammaVsNtrack->Fill(Ntracks,gamma);
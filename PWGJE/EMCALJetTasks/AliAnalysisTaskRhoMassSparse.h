@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoMassBase.h"
+#include "AliRhoKernel.h"
 
 class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
 
@@ -41,11 +42,12 @@ class AliAnalysisTaskRhoMassSparse : public AliAnalysisTaskRhoMassBase {
   Bool_t           fPionMassClusters;              // assume pion mass for clusters
 
   TH2F            *fHistMdAreavsCent;              //! Md/Area vs cent for all kt clusters
+  AliRhoKernel     fRhoKernel;                     //!median, occupancy and signal overlap calculation
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
 
   AliAnalysisTaskRhoMassSparse(const AliAnalysisTaskRhoMassSparse&);             // not implemented
   AliAnalysisTaskRhoMassSparse& operator=(const AliAnalysisTaskRhoMassSparse&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoMassSparse, 1); // Rho_m task
+  ClassDef(AliAnalysisTaskRhoMassSparse, 2); // Rho_m task
 };
 #endif
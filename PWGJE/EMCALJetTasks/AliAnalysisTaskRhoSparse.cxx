@@ -24,7 +24,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse() :
   AliAnalysisTaskRhoBase("AliAnalysisTaskRhoSparse"),
   fNExclLeadJets(0),
   fRhoCMS(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -34,7 +35,8 @@ AliAnalysisTaskRhoSparse::AliAnalysisTaskRhoSparse(const char *name, Bool_t hist
   AliAnalysisTaskRhoBase(name, histo),
   fNExclLeadJets(0),
   fRhoCMS(0),
-  fHistOccCorrvsCent(0)
+  fHistOccCorrvsCent(0),
+  fRhoKernel()
 {
   // Constructor.
 }
@@ -126,10 +128,19 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
     }
   }
 
-  static Double_t rhovec[999];
-  Int_t NjetAcc = 0;
-  Double_t TotaljetArea=0;
-  Double_t TotaljetAreaPhys=0;
+  fRhoKernel.Reset();
+
+  // signal jets, registered once per event for the overlap search
+  if (sigjets) {
+    for (Int_t j = 0; j < NjetsSig; j++) {
+      AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
+      if (!signalJet)
+        continue;
+      if (!IsJetSignal(signalJet))
+        continue;
+      fRhoKernel.AddSignalJet(signalJet);
+    }
+  }
 
   // push all jets within selected acceptance into stack
   for (Int_t iJets = 0; iJets < Njets; ++iJets) {
@@ -144,52 +155,28 @@ Bool_t AliAnalysisTaskRhoSparse::Run()
       continue;
     } 
 
-    TotaljetArea+=jet->Area();
-    
-    if(jet->Pt()>0.1){
-      TotaljetAreaPhys+=jet->Area();
-    }
+    fRhoKernel.AddArea(jet->Area(), jet->Pt() > 0.1);
 
     if (!AcceptJet(jet))
       continue;
 
-   // Search for overlap with signal jets
-    Bool_t isOverlapping = kFALSE;
-    if (sigjets) {
-      for(Int_t j=0;j<NjetsSig;j++)
-	{
-	  AliEmcalJet* signalJet = sigjets->GetAcceptJet(j);
-	  if(!signalJet)
-	    continue;
-	  if(!IsJetSignal(signalJet))     
-	    continue;
-	  
-	  if(IsJetOverlapping(signalJet, jet))
-	    {
-	      isOverlapping = kTRUE;
-	      break;
-	    }
-	}
-    }
-
-    if(isOverlapping) 
+    // Search for overlap with signal jets
+    if (fRhoKernel.IsOverlappingSignal(jet))
       continue;
 
     if(jet->Pt()>0.1){
-      rhovec[NjetAcc] = jet->Pt() / jet->Area();
-      ++NjetAcc;
+      fRhoKernel.AddDensity(jet->Pt() / jet->Area());
     }
   }
 
-  Double_t OccCorr=0.0;
-  if(TotaljetArea>0) OccCorr=TotaljetAreaPhys/TotaljetArea;
+  Double_t OccCorr = fRhoKernel.GetOccupancy();
  
   if (fCreateHisto)
     fHistOccCorrvsCent->Fill(fCent, OccCorr);
 
-  if (NjetAcc > 0) {
+  if (fRhoKernel.GetNDensities() > 0) {
     //find median value
-    Double_t rho = TMath::Median(NjetAcc, rhovec);
+    Double_t rho = fRhoKernel.GetRho();
 
     if(fRhoCMS){
       rho = rho * OccCorr;
@@ -4,6 +4,7 @@
 // $Id$
 
 #include "AliAnalysisTaskRhoBase.h"
+#include "AliRhoKernel.h"
 
 class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
 
@@ -25,10 +26,11 @@ class AliAnalysisTaskRhoSparse : public AliAnalysisTaskRhoBase {
   Bool_t           fRhoCMS;                        // flag to run CMS method
 
   TH2F            *fHistOccCorrvsCent;             //!occupancy correction vs. centrality
+  AliRhoKernel     fRhoKernel;                     //!median, occupancy and signal overlap calculation
 
   AliAnalysisTaskRhoSparse(const AliAnalysisTaskRhoSparse&);             // not implemented
   AliAnalysisTaskRhoSparse& operator=(const AliAnalysisTaskRhoSparse&);  // not implemented
   
-  ClassDef(AliAnalysisTaskRhoSparse, 2); // Rho task
+  ClassDef(AliAnalysisTaskRhoSparse, 3); // Rho task
 };
 #endif
@@ -0,0 +1,114 @@
+/**************************************************************************
+ * Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+#include <algorithm>
+
+#include "AliEmcalJet.h"
+#include "AliRhoKernel.h"
+
+/// \cond CLASSIMP
+ClassImp(AliRhoKernel);
+/// \endcond
+
+/**
+ * Default constructor.
+ */
+AliRhoKernel::AliRhoKernel() :
+  fRho(),
+  fRhoM(),
+  fSignalBits(),
+  fSignalIDs(),
+  fNegativeSignalIDs(),
+  fTotalArea(0),
+  fPhysicalArea(0)
+{
+}
+
+/**
+ * Prepare for a new event. The buffers keep their memory.
+ */
+void AliRhoKernel::Reset()
+{
+  fRho.clear();
+  fRhoM.clear();
+  for (std::vector<Int_t>::const_iterator it = fSignalIDs.begin(); it != fSignalIDs.end(); ++it) {
+    fSignalBits[*it >> 5] = 0;
+  }
+  fSignalIDs.clear();
+  fNegativeSignalIDs.clear();
+  fTotalArea = 0;
+  fPhysicalArea = 0;
+}
+
+/**
+ * Add the constituent tracks of a signal jet to the bitset.
+ * @param jet Signal jet
+ */
+void AliRhoKernel::AddSignalJet(const AliEmcalJet* jet)
+{
+  for (Int_t i = 0; i < jet->GetNumberOfTracks(); ++i) {
+    Int_t id = jet->TrackAt(i);
+    if (id < 0) {
+      fNegativeSignalIDs.push_back(id);
+      continue;
+    }
+    UInt_t word = id >> 5;
+    if (word >= fSignalBits.size()) fSignalBits.resize(word + 1, 0);
+    fSignalBits[word] |= 1u << (id & 31);
+    fSignalIDs.push_back(id);
+  }
+}
+
+/**
+ * Check whether a track belongs to one of the signal jets.
+ * @param id Track ID
+ * @return kTRUE if the track is a constituent of a signal jet
+ */
+Bool_t AliRhoKernel::IsSignalTrack(Int_t id) const
+{
+  if (id < 0) return std::find(fNegativeSignalIDs.begin(), fNegativeSignalIDs.end(), id) != fNegativeSignalIDs.end();
+  UInt_t word = id >> 5;
+  return word < fSignalBits.size() && (fSignalBits[word] >> (id & 31)) & 1u;
+}
+
+/**
+ * Verify whether a jet has any track in common with the signal jets.
+ * Same result as AliAnalysisTaskJetUE::AreJetsOverlapping() with each of the signal jets.
+ * @param jet Background jet
+ * @return kTRUE if the jet shares at least a track with a signal jet
+ */
+Bool_t AliRhoKernel::IsOverlappingSignal(const AliEmcalJet* jet) const
+{
+  if (fSignalIDs.empty() && fNegativeSignalIDs.empty()) return kFALSE;
+  for (Int_t i = 0; i < jet->GetNumberOfTracks(); ++i) {
+    if (IsSignalTrack(jet->TrackAt(i))) return kTRUE;
+  }
+  return kFALSE;
+}
+
+/**
+ * Median of the values, as TMath::Median (mean of the two central values for an even number).
+ * The order of the values is changed.
+ * @param v Values
+ * @return Median (0 if there are no values)
+ */
+Double_t AliRhoKernel::Median(std::vector<Double_t>& v)
+{
+  if (v.empty()) return 0;
+  std::vector<Double_t>::iterator mid = v.begin() + v.size() / 2;
+  std::nth_element(v.begin(), mid, v.end());
+  if (v.size() % 2 == 1) return *mid;
+  return 0.5 * (*std::max_element(v.begin(), mid) + *mid);
+}
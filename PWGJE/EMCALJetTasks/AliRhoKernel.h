@@ -0,0 +1,71 @@
+/**
+ * @file AliRhoKernel.h
+ * @brief Declaration of class AliRhoKernel
+ *
+ * In this header file the class AliRhoKernel is declared.
+ */
+
+/* Copyright(c) 1998-2017, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+#ifndef ALIRHOKERNEL_H
+#define ALIRHOKERNEL_H
+
+#include <vector>
+
+#include <Rtypes.h>
+
+class AliEmcalJet;
+
+/** \class AliRhoKernel
+ * \brief Event-by-event median background estimation shared by the rho tasks
+ *
+ * The background jets are passed once per event (single sweep):
+ * - AddArea() accumulates the total and the physical (non-ghost) area
+ *   used for the occupancy correction of sparse events (https://arxiv.org/abs/1207.2392),
+ * - AddDensity() stores the pt and mass densities of the jets used for the median.
+ *
+ * Jets overlapping with signal jets are identified with a bitset of the constituent
+ * track IDs of the signal jets (AddSignalJet()), so that IsOverlappingSignal()
+ * is a single pass over the constituents of the background jet.
+ *
+ * The medians are found by selection (std::nth_element) on buffers that are
+ * kept from one event to the next; they are identical to TMath::Median.
+ */
+class AliRhoKernel {
+ public:
+  AliRhoKernel();
+  virtual ~AliRhoKernel() {}
+
+  void                   Reset();
+
+  void                   AddSignalJet(const AliEmcalJet* jet);
+  Bool_t                 IsOverlappingSignal(const AliEmcalJet* jet) const;
+
+  void                   AddArea(Double_t area, Bool_t physical)               { fTotalArea += area; if (physical) fPhysicalArea += area; }
+  void                   AddDensity(Double_t rho, Double_t rhom = 0.)          { fRho.push_back(rho); fRhoM.push_back(rhom); }
+
+  Int_t                  GetNDensities() const                                 { return fRho.size(); }
+  Double_t               GetOccupancy() const                                  { return fTotalArea > 0 ? fPhysicalArea / fTotalArea : 0; }
+  Double_t               GetRho()                                              { return Median(fRho) ; }
+  Double_t               GetRhoM()                                             { return Median(fRhoM); }
+
+  static Double_t        Median(std::vector<Double_t>& v);
+
+ protected:
+  Bool_t                 IsSignalTrack(Int_t id) const;
+
+  std::vector<Double_t>  fRho;                ///< pt densities of the background jets
+  std::vector<Double_t>  fRhoM;               ///< mass densities of the background jets
+  std::vector<UInt_t>    fSignalBits;         ///< bitset of the constituent track IDs of the signal jets
+  std::vector<Int_t>     fSignalIDs;          ///< constituent track IDs set in fSignalBits (to reset them)
+  std::vector<Int_t>     fNegativeSignalIDs;  ///< negative constituent track IDs of the signal jets
+  Double_t               fTotalArea;          ///< total area of the background jets
+  Double_t               fPhysicalArea;       ///< area of the physical background jets (excluding ghost jets)
+
+ private:
+  /// \cond CLASSIMP
+  ClassDef(AliRhoKernel, 1);
+  /// \endcond
+};
+#endif
@@ -0,0 +1,237 @@
+//
+// closed form least squares fit of the azimuthal modulation of the background
+// see header for the model and the usage
+//
+
+#include <TF1.h>
+#include <TH1.h>
+#include <TH2.h>
+#include <TMath.h>
+#include <TString.h>
+
+#include "AliRhoModulationLinearFit.h"
+
+ClassImp(AliRhoModulationLinearFit)
+
+//_____________________________________________________________________________
+AliRhoModulationLinearFit::AliRhoModulationLinearFit() :
+  fNTerms(0), fChi2(0), fNDF(0)
+{
+  // default constructor
+  for(Int_t i(0); i < kMaxTerms; i++) {
+    fHarmonic[i] = 0;
+    fPrefactor[i] = 0;
+    fPsi[i] = 0;
+  }
+  for(Int_t i(0); i < kMaxTerms+1; i++) {
+    fPar[i] = 0;
+    for(Int_t j(0); j < kMaxTerms+1; j++) fCov[i][j] = 0;
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationLinearFit::AddTerm(Double_t n, Double_t c, Double_t psi)
+{
+  // add the term c * v * cos(n * (phi - psi)) to the model
+  if(fNTerms >= kMaxTerms) return kFALSE;
+  fHarmonic[fNTerms] = n;
+  fPrefactor[fNTerms] = c;
+  fPsi[fNTerms] = psi;
+  fNTerms++;
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationLinearFit::Fit(const TH1* histo, Double_t min, Double_t max, Bool_t integral, Bool_t unitWeights)
+{
+  // solve the normal equations sum_i w_i g_k(i) g_l(i) a_l = sum_i w_i g_k(i) y_i with
+  // g_0 = 1, g_k = c_k cos(n_k (phi_i - psi_k)) and w_i = 1 / sigma_i^2 (1 for unit weights)
+  // the chi2 follows from the same sums, chi2 = sum_i w_i y_i^2 - sum_k a_k b_k
+  // returns false if there are not enough bins or the system is singular
+  Int_t nPar(fNTerms + 1), nBins(0);
+  Double_t m[kMaxTerms+1][kMaxTerms+1], b[kMaxTerms+1], g[kMaxTerms+1], sumWY2(0.);
+  for(Int_t k(0); k < nPar; k++) {
+    b[k] = 0.;
+    for(Int_t l(0); l < nPar; l++) m[k][l] = 0.;
+  }
+  fChi2 = 0.;
+  fNDF = 0;
+  if(!histo) return kFALSE;
+
+  const TAxis* axis(histo->GetXaxis());
+  for(Int_t i(1); i <= axis->GetNbins(); i++) {
+    Double_t x(axis->GetBinCenter(i));
+    if(x < min || x > max) continue;
+    Double_t error(histo->GetBinError(i)), y(histo->GetBinContent(i));
+    if(error <= 0. && !(unitWeights && y != 0.)) continue;   // empty bin
+    Double_t w(unitWeights ? 1. : 1./(error*error));
+    Double_t lo(axis->GetBinLowEdge(i)), hi(axis->GetBinUpEdge(i));
+    g[0] = 1.;
+    for(Int_t k(0); k < fNTerms; k++) {
+      Double_t n(fHarmonic[k]);
+      if(integral && n != 0.) g[k+1] = fPrefactor[k]*(TMath::Sin(n*(hi-fPsi[k]))-TMath::Sin(n*(lo-fPsi[k])))/(n*(hi-lo));
+      else g[k+1] = fPrefactor[k]*TMath::Cos(n*(x-fPsi[k]));
+    }
+    for(Int_t k(0); k < nPar; k++) {
+      b[k] += w*g[k]*y;
+      for(Int_t l(0); l <= k; l++) m[k][l] += w*g[k]*g[l];
+    }
+    sumWY2 += w*y*y;
+    nBins++;
+  }
+  if(nBins <= nPar) return kFALSE;
+  for(Int_t k(0); k < nPar; k++) for(Int_t l(k+1); l < nPar; l++) m[k][l] = m[l][k];
+
+  // invert the (symmetric, positive definite) matrix with gauss jordan elimination
+  for(Int_t k(0); k < nPar; k++) {
+    for(Int_t l(0); l < nPar; l++) fCov[k][l] = (k == l) ? 1. : 0.;
+  }
+  for(Int_t k(0); k < nPar; k++) {
+    Int_t pivot(k);
+    for(Int_t l(k+1); l < nPar; l++) if(TMath::Abs(m[l][k]) > TMath::Abs(m[pivot][k])) pivot = l;
+    if(TMath::Abs(m[pivot][k]) <= 1e-12*TMath::Abs(m[0][0])) return kFALSE;
+    for(Int_t l(0); l < nPar; l++) {
+      Double_t t(m[k][l]); m[k][l] = m[pivot][l]; m[pivot][l] = t;
+      t = fCov[k][l]; fCov[k][l] = fCov[pivot][l]; fCov[pivot][l] = t;
+    }
+    Double_t d(1./m[k][k]);
+    for(Int_t l(0); l < nPar; l++) {
+      m[k][l] *= d;
+      fCov[k][l] *= d;
+    }
+    for(Int_t r(0); r < nPar; r++) {
+      if(r == k || m[r][k] == 0.) continue;
+      Double_t f(m[r][k]);
+      for(Int_t l(0); l < nPar; l++) {
+        m[r][l] -= f*m[k][l];
+        fCov[r][l] -= f*fCov[k][l];
+      }
+    }
+  }
+
+  Double_t bDotA(0.);
+  for(Int_t k(0); k < nPar; k++) {
+    fPar[k] = 0.;
+    for(Int_t l(0); l < nPar; l++) fPar[k] += fCov[k][l]*b[l];
+    bDotA += fPar[k]*b[k];
+  }
+  fChi2 = TMath::Max(0., sumWY2 - bDotA);
+  fNDF = nBins - nPar;
+  if(unitWeights) {
+    // without errors the scale of the covariance comes from the residuals, as for TH1::Fit option W
+    for(Int_t k(0); k < nPar; k++) for(Int_t l(0); l < nPar; l++) fCov[k][l] *= fChi2/fNDF;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Double_t AliRhoModulationLinearFit::GetVn(Int_t k) const
+{
+  // v of term k
+  return (fPar[0] != 0.) ? fPar[k+1]/fPar[0] : 0.;
+}
+
+//_____________________________________________________________________________
+Double_t AliRhoModulationLinearFit::GetVnError(Int_t k) const
+{
+  // error on v of term k, propagated from the covariance of p0 and p0*v
+  if(fPar[0] == 0.) return 0.;
+  Double_t v(GetVn(k));
+  Double_t var((fCov[k+1][k+1] - 2.*v*fCov[k+1][0] + v*v*fCov[0][0])/(fPar[0]*fPar[0]));
+  return (var > 0.) ? TMath::Sqrt(var) : 0.;
+}
+
+//_____________________________________________________________________________
+Double_t AliRhoModulationLinearFit::GetProb() const
+{
+  // p-value of the fit, i.e. 1 - the cdf of the chi2 distribution
+  return (fNDF > 0) ? TMath::Prob(fChi2, fNDF) : 0.;
+}
+
+//_____________________________________________________________________________
+Double_t AliRhoModulationLinearFit::Eval(Double_t phi) const
+{
+  // fitted modulation at phi
+  Double_t f(fPar[0]);
+  for(Int_t k(0); k < fNTerms; k++) f += fPar[k+1]*fPrefactor[k]*TMath::Cos(fHarmonic[k]*(phi-fPsi[k]));
+  return f;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationLinearFit::IsLinearFitOption(const char* options)
+{
+  // the closed form is the chi2 fit with the bin errors (default) or unit weights (W), the likelihood
+  // (L, LL, WL), pearson chi2 (P) and the unit weight fit including empty bins (WW) need the minimizer
+  TString o(options);
+  o.ToUpper();
+  return !(o.Contains("L") || o.Contains("P") || o.Contains("WW"));
+}
+
+//_____________________________________________________________________________
+TString AliRhoModulationLinearFit::GetLinearFitOptions(const char* options)
+{
+  // e.g. the default "QWLI" of the rho tasks becomes "QWI"
+  TString o(options);
+  o.ToUpper();
+  o.ReplaceAll("L", "");
+  return o;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationLinearFit::FitModulation(TF1* model, modulationType type, TH1* histo, Double_t min, Double_t max, const char* options, TH2* check)
+{
+  // closed form fit of the modulation model, the harmonics and symmetry planes are taken from model
+  if(!model || !IsLinearFitOption(options)) return kFALSE;
+  ClearTerms();
+  AddTerm(model->GetParameter(2), model->GetParameter(2), model->GetParameter(4));
+  if(type == kCombined) AddTerm(model->GetParameter(5), model->GetParameter(2), model->GetParameter(6));
+  TString o(options);
+  o.ToUpper();
+  if(!Fit(histo, min, max, o.Contains("I"), o.Contains("W"))) return kFALSE;
+  model->SetParameter(0, GetNormalisation());
+  model->SetParError(0, TMath::Sqrt(GetCovariance(0, 0)));
+  model->SetParameter(3, GetVn(0));
+  model->SetParError(3, GetVnError(0));
+  if(type == kCombined) {
+    model->SetParameter(7, GetVn(1));
+    model->SetParError(7, GetVnError(1));
+  }
+  model->SetChisquare(GetChisquare());
+  model->SetNDF(GetNDF());
+  if(check) {
+    Int_t par[] = {0, 3, 7};
+    Int_t slot[] = {kCheckRho0, kCheckV2, kCheckV3, kCheckChi2};
+    if(type == kV3) slot[1] = kCheckV3;
+    if(type != kCombined) slot[2] = kCheckChi2;
+    CompareWithFit(histo, model, par, slot, min, max, options, check);
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliRhoModulationLinearFit::CompareWithFit(TH1* histo, const TF1* model, const Int_t* par, const Int_t* slot, Double_t min, Double_t max, const char* options, TH2* check) const
+{
+  // fit a copy of model to histo with TH1::Fit and the given options and fill check with
+  // (closed form - TH1::Fit) / error of TH1::Fit for p0 and the v_k and with the
+  // relative difference of the chi2, at the x given by slot.
+  // returns true if the parameters agree within 1% of the error and the chi2 within 1e-3
+  if(!histo || !model || !par || !slot) return kFALSE;
+  TF1 fit(*model);
+  TString o(options);
+  o += "QN0";
+  histo->Fit(&fit, o.Data(), "", min, max);
+  Bool_t agree(kTRUE);
+  for(Int_t k(0); k < GetNParameters(); k++) {
+    Double_t value((k == 0) ? GetNormalisation() : GetVn(k-1));
+    Double_t error(fit.GetParError(par[k]));
+    if(error <= 0.) continue;
+    Double_t pull((value - fit.GetParameter(par[k]))/error);
+    if(check) check->Fill(slot[k], pull);
+    if(TMath::Abs(pull) > 1e-2) agree = kFALSE;
+  }
+  Double_t chi2(fit.GetChisquare());
+  Double_t diff((chi2 > 0.) ? (fChi2 - chi2)/chi2 : fChi2 - chi2);
+  if(check) check->Fill(slot[GetNParameters()], diff);
+  if(TMath::Abs(diff) > 1e-3) agree = kFALSE;
+  return agree;
+}
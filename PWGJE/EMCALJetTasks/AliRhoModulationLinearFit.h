@@ -0,0 +1,84 @@
+#ifndef ALIRHOMODULATIONLINEARFIT_H
+#define ALIRHOMODULATIONLINEARFIT_H
+
+// closed form least squares fit of the azimuthal modulation of the background
+//
+// for fixed symmetry planes the modulation
+//   f(phi) = p0 * ( 1 + sum_k c_k * v_k * cos(n_k * (phi - psi_k)) )
+// is linear in p0 and p0*v_k. the weighted least squares fit to a histogram
+// therefore reduces to the normal equations, which are built from sums of
+// trigonometric functions over the bins and solved directly (no minimizer).
+// parameters, covariance, chi2 and p-value are available after Fit()
+//
+// the result is the one of TH1::Fit with the default chi2 method (bin errors
+// as weights, empty bins skipped) or with the unit weight chi2 (option W),
+// with or without option I. likelihood (L) and pearson chi2 (P) fits are not
+// reproduced, see IsLinearFitOption()
+//
+// FitModulation() fits the modulation model shared by AliAnalysisTaskLocalRho
+// and AliAnalysisTaskJetV2,
+//   [0]*([1]+[2]*([3]*cos([2]*(x-[4]))+[7]*cos([5]*(x-[6]))))
+// where [7] is only present for the combined v2 + v3 fit
+
+#include <Rtypes.h>
+#include <TString.h>
+
+class TH1;
+class TH2;
+class TF1;
+
+class AliRhoModulationLinearFit {
+ public:
+  enum { kMaxTerms = 4 };       // maximum number of harmonic terms
+  enum modulationType { kV2, kV3, kCombined };  // models of FitModulation()
+  // bins (x) of the check histogram of FitModulation()
+  enum checkSlot { kCheckRho0, kCheckV2, kCheckV3, kCheckChi2, kCheckChi2Control };
+  // constructors, destructor
+  AliRhoModulationLinearFit();
+  virtual ~AliRhoModulationLinearFit() {}
+  // model
+  void                    ClearTerms()                            {fNTerms = 0; }
+  Bool_t                  AddTerm(Double_t n, Double_t c, Double_t psi);
+  Int_t                   GetNTerms() const                       {return fNTerms; }
+  // fit of the bins of histo in [min, max], empty bins are skipped.
+  // if integral is true the model is integrated over the bins (fit option I),
+  // if unitWeights is true all bins have weight 1 (fit option W)
+  Bool_t                  Fit(const TH1* histo, Double_t min, Double_t max, Bool_t integral = kFALSE, Bool_t unitWeights = kFALSE);
+  // fit of the modulation model (see above) with the TH1::Fit options, the result is stored in model.
+  // returns false, leaving model untouched, if the options need the minimizer or the fit fails.
+  // if check is given, the result is compared with TH1::Fit (see CompareWithFit and checkSlot)
+  Bool_t                  FitModulation(TF1* model, modulationType type, TH1* histo, Double_t min, Double_t max, const char* options, TH2* check = 0);
+  // results: parameter 0 is p0, parameter k+1 is p0*v_k
+  Int_t                   GetNParameters() const                  {return fNTerms + 1; }
+  Double_t                GetParameter(Int_t i) const             {return fPar[i]; }
+  Double_t                GetCovariance(Int_t i, Int_t j) const   {return fCov[i][j]; }
+  Double_t                GetNormalisation() const                {return fPar[0]; }
+  Double_t                GetVn(Int_t k) const;
+  Double_t                GetVnError(Int_t k) const;
+  Double_t                GetChisquare() const                    {return fChi2; }
+  Int_t                   GetNDF() const                          {return fNDF; }
+  Double_t                GetProb() const;
+  Double_t                Eval(Double_t phi) const;
+  // whether the TH1::Fit options ask for a fit done by Fit()
+  static Bool_t           IsLinearFitOption(const char* options);
+  // the options with the likelihood (L, LL) removed, i.e. the chi2 fit with the same weights
+  static TString          GetLinearFitOptions(const char* options);
+  // compare the last result with TH1::Fit of a copy of model, where par[0] is the index of p0
+  // and par[k+1] the index of v_k in model, all other parameters of model being fixed.
+  // the difference for parameter k is filled at x = slot[k] of check, the one of the chi2 at
+  // x = slot[GetNParameters()]
+  Bool_t                  CompareWithFit(TH1* histo, const TF1* model, const Int_t* par, const Int_t* slot, Double_t min, Double_t max, const char* options, TH2* check) const;
+
+ private:
+  Int_t                   fNTerms;                        // number of harmonic terms
+  Double_t                fHarmonic[kMaxTerms];           // harmonic n of the terms
+  Double_t                fPrefactor[kMaxTerms];          // prefactor c of the terms
+  Double_t                fPsi[kMaxTerms];                // symmetry plane of the terms
+  Double_t                fPar[kMaxTerms+1];              // fitted parameters
+  Double_t                fCov[kMaxTerms+1][kMaxTerms+1]; // covariance of the parameters
+  Double_t                fChi2;                          // chi2 of the fit
+  Int_t                   fNDF;                           // degrees of freedom
+
+  ClassDef(AliRhoModulationLinearFit, 1); // closed form fit of the background modulation
+};
+#endif
@@ -35,6 +35,7 @@
 #include "AliMCEvent.h"
 #include "AliAnalysisManager.h"
 #include "AliJetContainer.h"
+#include "AliEmcalJetDeclusteringCache.h"
 #include "AliParticleContainer.h"
 #include "AliEmcalPythiaInfo.h"
 #include "TRandom3.h"
@@ -1351,6 +1352,32 @@ void AliAnalysisTaskEmcalJetShapesMC::RecursiveParents(AliEmcalJet *fJet,AliJetC
   double zinject,angleinject,pptheta,sinpptheta,omega,omega2,angle2;
   AliParticleContainer *fTrackCont = fJetCont->GetParticleContainer();
   Float_t pTscale=0., phiscale=0., thetascale=0., pXscale=0., pYscale=0., pZscale=0., pscale=0.;
+
+  // C/A declustering of the unmodified constituents: read from the tree shared by the jet container
+  if (ReclusterAlgo==1 && !fScaleELoss && !fAddMedScat && fAdditionalTracks<=0 && fJetCont->GetDeclusteringRadius()==1.) {
+    Int_t node = fJetCont->GetDeclusteringRoot(fJet);
+    const AliEmcalJetDeclusteringCache *cache = fJetCont->GetDeclusteringCache();
+    if (!cache || node==AliEmcalJetDeclusteringCache::kNoNode) return;
+    xflagalgo=1.5;
+    double rootpt=cache->GetPt(node);
+    double ndepth=0;
+    double nsd=0;
+    double nall=0;
+    fShapesVar[10]=rootpt;
+    for (; node>=0; node=cache->GetSplitting(node).fHarder) {
+      const AliEmcalJetDeclusteringCache::Splitting &split = cache->GetSplitting(node);
+      nall=nall+1;
+      if(split.fZ>fHardCutoff){
+        ndepth=ndepth+1;
+        nsd=nsd+1;
+        if(nsd==1) fShapesVar[9]=split.fZ;
+        Double_t LundEntries[6] = {log(1.0/split.fTheta),log(split.fZ*split.fTheta),rootpt,xflagalgo,partonFlavor,ndepth};
+        fHLundIterative->Fill(LundEntries);}
+    }
+    fShapesVar[6]=nsd;
+    fShapesVar[7]=nall;
+    return;
+  }
   
   if (fTrackCont) for (Int_t i=0; i<fJet->GetNumberOfTracks(); i++) {
       AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
@@ -35,6 +35,7 @@
 #include "AliMCEvent.h"
 #include "AliAnalysisManager.h"
 #include "AliJetContainer.h"
+#include "AliEmcalJetDeclusteringCache.h"
 #include "AliParticleContainer.h"
 #include "AliEmcalPythiaInfo.h"
 #include "TRandom3.h"
@@ -1182,6 +1183,28 @@ void AliAnalysisTaskEmcalQGTagging::RecursiveParents(AliEmcalJet *fJet,AliJetCon
   fastjet::PseudoJet  PseudoTracks;
   double xflagalgo=0; 
   AliParticleContainer *fTrackCont = fJetCont->GetParticleContainer();
+
+  // C/A declustering of the unmodified constituents: read from the tree shared by the jet container
+  if (ReclusterAlgo==1 && !fDoTwoTrack && fJetCont->GetDeclusteringRadius()==1.) {
+    Int_t node = fJetCont->GetDeclusteringRoot(fJet);
+    const AliEmcalJetDeclusteringCache *cache = fJetCont->GetDeclusteringCache();
+    if (!cache || node==AliEmcalJetDeclusteringCache::kNoNode) return;
+    xflagalgo=1.5;
+    double rootpt=cache->GetPt(node);
+    double ndepth=0;
+    double nall=0;
+    for (; node>=0; node=cache->GetSplitting(node).fHarder) {
+      const AliEmcalJetDeclusteringCache::Splitting &split = cache->GetSplitting(node);
+      nall=nall+1;
+      if(split.fZ>fHardCutoff){
+        ndepth=ndepth+1;
+        Double_t LundEntries[5] = {log(1.0/split.fTheta),log(split.fZ*split.fTheta),rootpt,xflagalgo,ndepth};
+        fHLundIterative->Fill(LundEntries);}
+    }
+    fShapesVar[12]=nall;
+    fShapesVar[13]=ndepth;
+    return;
+  }
   
     if (fTrackCont) for (Int_t i=0; i<fJet->GetNumberOfTracks(); i++) {
       AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
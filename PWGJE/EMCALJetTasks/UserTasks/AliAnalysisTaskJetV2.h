@@ -23,6 +23,7 @@
 #include <TRandom3.h>
 #include <AliJetContainer.h>
 #include <AliParticleContainer.h>
+#include "AliRhoModulationLinearFit.h"
 
 class TFile;
 class TF1;
@@ -131,6 +132,8 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         void                    SetGoodnessTest(fitGoodnessTest test)           {fFitGoodnessTest = test; }
         void                    SetQCnRecoveryType(qcRecovery type)             {fQCRecovery = type; }
         void                    SetModulationFitOptions(TString opt)            {fFitModulationOptions = opt; }
+        void                    SetUseLinearFit(Bool_t l)                       {fUseLinearFit = l; }
+        void                    SetCheckLinearFit(Bool_t c)                     {fCheckLinearFit = c; }
         void                    SetReferenceDetector(detectorType type)         {fDetectorType = type; }
         void                    SetAnalysisType(analysisType type)              {fAnalysisType = type; }
         void                    SetCollisionType(collisionType type)            {fCollisionType = type; }
@@ -294,6 +297,10 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         Int_t                   fInCentralitySelection; //! centrality bin
         TF1*                    fFitModulation;         //-> modulation fit for rho
         TF1*                    fFitControl;            //-> control fit
+        Bool_t                  fUseLinearFit;          // fit kV2, kV3, kCombined and the control fit in closed form instead of with minuit
+        AliRhoModulationLinearFit fLinearFit;           //! closed form fit of the modulation
+        Bool_t                  fCheckLinearFit;        // compare the closed form fits with TH1::Fit
+        TH2F*                   fHistLinearFitCheck;    //! closed form fit - TH1::Fit
         Float_t                 fMinPvalue;             // minimum value of p
         Float_t                 fMaxPvalue;             // maximum value of p
         TString                 fNameSmallRho;          // name of small rho
@@ -451,7 +458,7 @@ class AliAnalysisTaskJetV2 : public AliAnalysisTaskEmcalJet {
         AliAnalysisTaskJetV2(const AliAnalysisTaskJetV2&);                  // not implemented
         AliAnalysisTaskJetV2& operator=(const AliAnalysisTaskJetV2&);       // not implemented
 
-        ClassDef(AliAnalysisTaskJetV2, 8);
+        ClassDef(AliAnalysisTaskJetV2, 10);
 };
 
 #endif
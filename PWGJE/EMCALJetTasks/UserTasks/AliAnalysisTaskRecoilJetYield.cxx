@@ -36,6 +36,7 @@
 #include "AliMCEvent.h"
 #include "AliAnalysisManager.h"
 #include "AliJetContainer.h"
+#include "AliEmcalJetDeclusteringCache.h"
 #include "AliParticleContainer.h"
 //#include "AliPythiaInfo.h"
 #include "TRandom3.h"
@@ -1151,6 +1152,34 @@ void AliAnalysisTaskRecoilJetYield::RecursiveParents(AliEmcalJet *fJet,AliJetCon
   fastjet::PseudoJet  PseudoTracks;
   double xflagalgo=0; 
   AliParticleContainer *fTrackCont = fJetCont->GetParticleContainer();
+
+  // C/A declustering: read from the tree shared by the jet container
+  if (ReclusterAlgo==1 && fJetCont->GetDeclusteringRadius()==1.) {
+    xflagalgo=1.5;
+    double ndepth=0;
+    double nhard=0;
+    double nall=0;
+    Int_t node = fJetCont->GetDeclusteringRoot(fJet);
+    const AliEmcalJetDeclusteringCache *cache = fJetCont->GetDeclusteringCache();
+    if (cache && node!=AliEmcalJetDeclusteringCache::kNoNode) {
+      double rootpt=cache->GetPt(node);
+      for (; node>=0; node=cache->GetSplitting(node).fHarder) {
+        const AliEmcalJetDeclusteringCache::Splitting &split = cache->GetSplitting(node);
+        ndepth=ndepth+1;
+        nall=nall+1;
+        if(split.fZ > 0.1) nhard=nhard+1;
+        Double_t LundEntries[5] = {log(1.0/split.fTheta),log(split.fZ*split.fTheta),rootpt,xflagalgo,ndepth};
+        if(!bTruth) fhLundIterative->Fill(LundEntries);
+        else if(bTruth) fhLundIterativeTrue->Fill(LundEntries);
+        if(bMinSubjetPt && cache->GetPt(split.fHarder) < fMinSubjetPt) break;
+      }
+    }
+    if(!bTruth) fJetInfoVar[14]=nhard;
+    else if(bTruth) fJetInfoVar[15]=nhard;
+    if(!bTruth) fJetInfoVar[20] = nall;
+    else if(bTruth) fJetInfoVar[21] = nall;
+    return;
+  }
   
   if (fTrackCont) for (Int_t i=0; i<fJet->GetNumberOfTracks(); i++) {
       AliVParticle *fTrk = fJet->TrackAt(i, fTrackCont->GetArray());
@@ -13,6 +13,7 @@
 #include "AliRhoParameter.h"
 #include "AliLog.h"
 #include "AliJetContainer.h"
+#include "AliEmcalJetDeclusteringCache.h"
 #include "AliParticleContainer.h"
 #include "AliClusterContainer.h"
 #include "AliPicoTrack.h"
@@ -41,7 +42,10 @@ AliAnalysisTaskSoftDrop::AliAnalysisTaskSoftDrop() :
   fhZg(0),
   fJetsCont(0),
   fTracksCont(0),
-  fCaloClustersCont(0)
+  fCaloClustersCont(0),
+  fUseDeclusteringCache(kFALSE),
+  fCheckDeclusteringCache(kFALSE),
+  fhDeclusteringCacheCheck(0)
 
 {
   // Default constructor.
@@ -88,7 +92,10 @@ AliAnalysisTaskSoftDrop::AliAnalysisTaskSoftDrop(const char *name) :
   fhZg(0),
   fJetsCont(0),
   fTracksCont(0),
-  fCaloClustersCont(0)
+  fCaloClustersCont(0),
+  fUseDeclusteringCache(kFALSE),
+  fCheckDeclusteringCache(kFALSE),
+  fhDeclusteringCacheCheck(0)
 {
   // Standard constructor.
 
@@ -240,6 +247,8 @@ void AliAnalysisTaskSoftDrop::UserCreateOutputObjects()
   }
   if(fTracksCont) fTracksCont->SetClassName("AliVTrack");
   if(fCaloClustersCont) fCaloClustersCont->SetClassName("AliVCluster");
+  // the declustering trees must correspond to the C/A R=0.4 reclustering done with fastjet
+  if(fJetsCont && (fUseDeclusteringCache || fCheckDeclusteringCache)) fJetsCont->SetDeclusteringRadius(0.4);
 
   TString histname;
 
@@ -358,6 +367,15 @@ void AliAnalysisTaskSoftDrop::UserCreateOutputObjects()
   fhCorrPtDropCount = new TH2F("fhCorrPtDropCount", "fhCorrPtDropCount; p_{T}^{corr} [GeV/c]; Counts", 16, 0, 160, 50, 0., 50);
   fOutput->Add(fhCorrPtDropCount);
 
+  if (fCheckDeclusteringCache) {
+    fhDeclusteringCacheCheck = new TH1F("fhDeclusteringCacheCheck", "declustering trees vs fastjet;;jets", 4, 0, 4);
+    fhDeclusteringCacheCheck->GetXaxis()->SetBinLabel(1, "compared");
+    fhDeclusteringCacheCheck->GetXaxis()->SetBinLabel(2, "p_{T} differs");
+    fhDeclusteringCacheCheck->GetXaxis()->SetBinLabel(3, "#it{Z}_{g} differs");
+    fhDeclusteringCacheCheck->GetXaxis()->SetBinLabel(4, "#it{Z}, R_{g} sequence differs");
+    fOutput->Add(fhDeclusteringCacheCheck);
+  }
+
   PostData(1, fOutput); // Post data for ALL output slots > 0 here.
 }
 
@@ -408,21 +426,37 @@ Bool_t AliAnalysisTaskSoftDrop::FillHistograms()
 
       Double_t jetpt_ungrmd = jet->Pt() / ( jet->GetShapeProperties()->GetSoftDropPtfrac() );
 
-      std::vector<fastjet::PseudoJet> particles;
-      UShort_t ntracks = jet->GetNumberOfTracks();
-      for (int j = 0; j < ntracks; j++) {
-        particles.push_back( fastjet::PseudoJet( jet->Track(j)->Px(), jet->Track(j)->Py(), jet->Track(j)->Pz(), jet->Track(j)->E() ) );
+      if (fUseDeclusteringCache && fJetsCont->GetParticleContainer()) {
+        // C/A R=0.4 reclustering: declustering tree of the jet container
+        Int_t root = fJetsCont->GetDeclusteringRoot(jet);
+        const AliEmcalJetDeclusteringCache *cache = fJetsCont->GetDeclusteringCache();
+        if (cache && root != AliEmcalJetDeclusteringCache::kNoNode) {
+          Float_t pt = cache->GetPt(root);
+          fSDM = 0;
+          SoftDropDeepDeclustering(cache, root, pt);
+          Int_t sd = cache->SoftDrop(root, 0.5, 1.5, 0.4);
+          fhCorrPtZg2->Fill( pt, sd >= 0 ? Float_t(cache->GetSplitting(sd).fZ) : 0.0 );
+        }
       }
-      fastjet::JetDefinition jet_def(fastjet::cambridge_algorithm, 0.4, fastjet::E_scheme);
-      fastjet::ClusterSequence cs(particles, jet_def);
-      std::vector<fastjet::PseudoJet> jets = sorted_by_pt(cs.inclusive_jets());
-
-      if (jets.size() > 0) {
-        fSDM = 0;
-        SoftDropDeepDeclustering( jets[0], jets[0].pt() );
-        fhCorrPtZg2->Fill( jets[0].pt(), SoftDropDeclustering(jets[0], 0.5, 1.5) );
+      else {
+        std::vector<fastjet::PseudoJet> particles;
+        UShort_t ntracks = jet->GetNumberOfTracks();
+        for (int j = 0; j < ntracks; j++) {
+          particles.push_back( fastjet::PseudoJet( jet->Track(j)->Px(), jet->Track(j)->Py(), jet->Track(j)->Pz(), jet->Track(j)->E() ) );
+        }
+        fastjet::JetDefinition jet_def(fastjet::cambridge_algorithm, 0.4, fastjet::E_scheme);
+        fastjet::ClusterSequence cs(particles, jet_def);
+        std::vector<fastjet::PseudoJet> jets = sorted_by_pt(cs.inclusive_jets());
+
+        if (jets.size() > 0) {
+          fSDM = 0;
+          SoftDropDeepDeclustering( jets[0], jets[0].pt() );
+          fhCorrPtZg2->Fill( jets[0].pt(), SoftDropDeclustering(jets[0], 0.5, 1.5) );
+        }
       }
 
+      if (fCheckDeclusteringCache) CheckDeclusteringCache(jet);
+
       fhZg->Fill(jet->GetShapeProperties()->GetSoftDropZg());
       fhCorrPtZg->Fill(jetpt_ungrmd - fJetsCont->GetRhoVal() * jet->Area(), jet->GetShapeProperties()->GetSoftDropZg() );
       fhCorrPtRg->Fill(jetpt_ungrmd - fJetsCont->GetRhoVal() * jet->Area(), jet->GetShapeProperties()->GetSoftDropdR() );
@@ -535,6 +569,96 @@ void AliAnalysisTaskSoftDrop::SoftDropDeepDeclustering(fastjet::PseudoJet jet, c
 
 }
 
+void AliAnalysisTaskSoftDrop::SoftDropDeepDeclustering(const AliEmcalJetDeclusteringCache *cache, Int_t node, const Float_t inpt) {
+
+  // same as above, following the harder branch in the declustering tree of the jet container
+  for (; node >= 0; node = cache->GetSplitting(node).fHarder) {
+    const AliEmcalJetDeclusteringCache::Splitting &split = cache->GetSplitting(node);
+    if (split.fZ > 0.1) {
+      fSDM++;
+      fhCorrPtZgD->Fill(inpt, split.fZ);
+      fhCorrPtRgD->Fill(inpt, split.fTheta);
+      fhCorrPtZgSDstep->Fill(inpt, split.fZ, fSDM);
+      fhCorrPtRgSDstep->Fill(inpt, split.fTheta, fSDM);
+    }
+  }
+
+}
+
+void AliAnalysisTaskSoftDrop::CheckDeclusteringCache(const AliEmcalJet *jet) {
+
+  // compare the C/A R=0.4 declustering tree of the jet container with the fastjet reclustering:
+  // pt of the hardest C/A jet, zg(zcut=0.5, beta=1.5) and the z, Rg sequence of the deep declustering
+  if (!fJetsCont->GetParticleContainer()) return;
+
+  std::vector<fastjet::PseudoJet> particles;
+  UShort_t ntracks = jet->GetNumberOfTracks();
+  for (int j = 0; j < ntracks; j++) {
+    particles.push_back( fastjet::PseudoJet( jet->Track(j)->Px(), jet->Track(j)->Py(), jet->Track(j)->Pz(), jet->Track(j)->E() ) );
+  }
+  fastjet::JetDefinition jet_def(fastjet::cambridge_algorithm, 0.4, fastjet::E_scheme);
+  fastjet::ClusterSequence cs(particles, jet_def);
+  std::vector<fastjet::PseudoJet> jets = sorted_by_pt(cs.inclusive_jets());
+
+  Int_t root = fJetsCont->GetDeclusteringRoot(jet);
+  const AliEmcalJetDeclusteringCache *cache = fJetsCont->GetDeclusteringCache();
+  Bool_t hasCacheJet = cache && root != AliEmcalJetDeclusteringCache::kNoNode;
+  if (jets.size() == 0 && !hasCacheJet) return;
+
+  fhDeclusteringCacheCheck->Fill(0.5);
+  if (jets.size() == 0 || !hasCacheJet) {
+    AliDebug(2, Form("jet %.2f GeV/c: C/A jet found only by %s", jet->Pt(), hasCacheJet ? "the declustering tree" : "fastjet"));
+    fhDeclusteringCacheCheck->Fill(1.5);
+    return;
+  }
+
+  const Double_t tolerance = 1e-5;
+  Double_t ptFastjet = jets[0].pt();
+  Double_t ptCache = cache->GetPt(root);
+  if (TMath::Abs(ptFastjet - ptCache) > tolerance * ptFastjet) {
+    AliDebug(2, Form("jet %.2f GeV/c: C/A jet pt %f (fastjet) %f (declustering tree)", jet->Pt(), ptFastjet, ptCache));
+    fhDeclusteringCacheCheck->Fill(1.5);
+  }
+
+  Int_t sd = cache->SoftDrop(root, 0.5, 1.5, 0.4);
+  Double_t zgFastjet = SoftDropDeclustering(jets[0], 0.5, 1.5);
+  Double_t zgCache = sd >= 0 ? cache->GetSplitting(sd).fZ : 0.;
+  if (TMath::Abs(zgFastjet - zgCache) > tolerance) {
+    AliDebug(2, Form("jet %.2f GeV/c: zg %f (fastjet) %f (declustering tree)", jet->Pt(), zgFastjet, zgCache));
+    fhDeclusteringCacheCheck->Fill(2.5);
+  }
+
+  // same splittings as in SoftDropDeepDeclustering
+  std::vector<Double_t> seqFastjet, seqCache;
+  fastjet::PseudoJet jj = jets[0];
+  fastjet::PseudoJet j1, j2;
+  while (jj.has_parents(j1, j2)) {
+    if (j1.pt() < j2.pt()) std::swap(j1, j2);
+    Double_t z = j2.pt() / (j1.pt() + j2.pt());
+    if (z > 0.1) {
+      seqFastjet.push_back(z);
+      seqFastjet.push_back(TMath::Sqrt(j1.plain_distance(j2)));
+    }
+    jj = j1;
+  }
+  for (Int_t node = root; node >= 0; node = cache->GetSplitting(node).fHarder) {
+    const AliEmcalJetDeclusteringCache::Splitting &split = cache->GetSplitting(node);
+    if (split.fZ > 0.1) {
+      seqCache.push_back(split.fZ);
+      seqCache.push_back(split.fTheta);
+    }
+  }
+  Bool_t sameSequence = seqFastjet.size() == seqCache.size();
+  for (UInt_t i = 0; sameSequence && i < seqFastjet.size(); i++) {
+    if (TMath::Abs(seqFastjet[i] - seqCache[i]) > tolerance) sameSequence = kFALSE;
+  }
+  if (!sameSequence) {
+    AliDebug(2, Form("jet %.2f GeV/c: %d splittings (fastjet) %d (declustering tree)", jet->Pt(), Int_t(seqFastjet.size() / 2), Int_t(seqCache.size() / 2)));
+    fhDeclusteringCacheCheck->Fill(3.5);
+  }
+
+}
+
 Float_t AliAnalysisTaskSoftDrop::SoftDropDeclustering(fastjet::PseudoJet jet, const Float_t zcut, const Float_t beta) {
 
   fastjet::PseudoJet jet1;
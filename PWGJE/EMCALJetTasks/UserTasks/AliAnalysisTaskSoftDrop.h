@@ -9,6 +9,7 @@ class TH3;
 class AliJetContainer;
 class AliParticleContainer;
 class AliClusterContainer;
+class AliEmcalJetDeclusteringCache;
 
 #include "AliAnalysisTaskEmcalJet.h"
 #include "FJ_includes.h"
@@ -25,6 +26,11 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
 
   static Float_t              SoftDropDeclustering(fastjet::PseudoJet jet, const Float_t zcut, const Float_t beta);
 
+  // C/A R=0.4 reclustering taken from the declustering trees of the jet container instead of fastjet
+  void                        SetUseDeclusteringCache(Bool_t b = kTRUE)   { fUseDeclusteringCache = b; }
+  // compare the declustering trees of the jet container with the fastjet reclustering, jet by jet
+  void                        SetCheckDeclusteringCache(Bool_t b = kTRUE) { fCheckDeclusteringCache = b; }
+
   static AliAnalysisTaskSoftDrop* AddTaskSoftDrop(
     const char *ntracks            = "usedefault",
     const char *nclusters          = "usedefault",
@@ -46,6 +52,8 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
   void                        CheckClusTrackMatching();
 
   void                        SoftDropDeepDeclustering(fastjet::PseudoJet jet, const Float_t inpt); 
+  void                        SoftDropDeepDeclustering(const AliEmcalJetDeclusteringCache *cache, Int_t node, const Float_t inpt);
+  void                        CheckDeclusteringCache(const AliEmcalJet *jet);
 
   // General histograms
   TH1                       **fHistTracksPt;            //!Track pt spectrum
@@ -81,12 +89,16 @@ class AliAnalysisTaskSoftDrop : public AliAnalysisTaskEmcalJet {
   AliParticleContainer       *fTracksCont;                 //!Tracks
   AliClusterContainer        *fCaloClustersCont;           //!Clusters  
 
+  Bool_t                      fUseDeclusteringCache;       ///< C/A reclustering from the declustering trees of the jet container
+  Bool_t                      fCheckDeclusteringCache;     ///< compare the declustering trees with the fastjet reclustering
+  TH1                        *fhDeclusteringCacheCheck;    //!<! jets compared and differences found
+
  private:
   AliAnalysisTaskSoftDrop(const AliAnalysisTaskSoftDrop&);            // not implemented
   AliAnalysisTaskSoftDrop &operator=(const AliAnalysisTaskSoftDrop&); // not implemented
 
   Int_t                       fSDM;                     ///< number of the SD iterations
 
-  ClassDef(AliAnalysisTaskSoftDrop, 1) // jet sample analysis task
+  ClassDef(AliAnalysisTaskSoftDrop, 2) // jet sample analysis task
 };
 #endif
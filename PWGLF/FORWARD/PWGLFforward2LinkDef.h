@@ -133,6 +133,7 @@
 #pragma link C++ class AliFMDSharingFilter::RingHistos+;
 #endif
 #pragma link C++ class AliFMDDensityCalculator+;
+#pragma link C++ class AliFMDELossWeightTable+;
 #if ROOT_VERSION_CODE < 0x56300/* ROOT_VERSION(5,99,0)*/ && __GNUC__ < 5
 // Used internally and never streamed
 #pragma link C++ class AliFMDDensityCalculator::RingHistos+;
@@ -9,6 +9,7 @@
 #include "AliForwardCorrectionManager.h"
 #include "AliFMDCorrDoubleHit.h"
 #include "AliFMDCorrELossFit.h"
+#include "AliFMDELossWeightTable.h"
 #include "AliLog.h"
 #include "AliForwardUtil.h"
 #include <TH2D.h>
@@ -60,7 +61,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fWeightTableTolerance(0),
+    fWeightTableMax(20),
+    fWeightTable(0)
 {
   // 
   // Constructor 
@@ -98,7 +102,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fWeightTableTolerance(0),
+    fWeightTableMax(20),
+    fWeightTable(0)
 {
   // 
   // Constructor 
@@ -167,7 +174,10 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fWeightTableTolerance(o.fWeightTableTolerance),
+  fWeightTableMax(o.fWeightTableMax),
+  fWeightTable(0)
 {
   // 
   // Copy constructor 
@@ -189,6 +199,7 @@ AliFMDDensityCalculator::~AliFMDDensityCalculator()
   //
   DGUARD(fDebug, 3, "DTOR of FMD density calculator");
   // fRingHistos.Delete();
+  if (fWeightTable) delete fWeightTable;
 }
 
 //____________________________________________________________________
@@ -232,6 +243,10 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fWeightTableTolerance = o.fWeightTableTolerance;
+  fWeightTableMax     = o.fWeightTableMax;
+  if (fWeightTable) delete fWeightTable;
+  fWeightTable        = 0; // Rebuilt in SetupForData
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -251,6 +266,7 @@ AliFMDDensityCalculator::SetupForData(const TAxis& axis)
   //   etaAxis   Eta axis
   DGUARD(fDebug, 1, "Initialize FMD density calculator");
   CacheMaxWeights(axis);
+  CacheWeightTable();
  
   fCache.Init(axis);
 
@@ -773,6 +789,49 @@ AliFMDDensityCalculator::CacheMaxWeights(const TAxis& axis)
   fCuts.FillHistogram(fLowCuts);
 }
 
+//_____________________________________________________________________
+void
+AliFMDDensityCalculator::CacheWeightTable()
+{
+  // 
+  // Tabulate the weighted energy loss fits of all rings and eta bins
+  // with the maximum number of particles used in NParticles
+  // 
+  if (fWeightTable) delete fWeightTable;
+  fWeightTable = 0;
+  if (fWeightTableTolerance <= 0) return;
+
+  DGUARD(fDebug, 2, "Cache weight tables in FMD density calculator");
+  AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  const AliFMDCorrELossFit*     cor = fcm.GetELossFit();
+  if (!cor) return;
+
+  Int_t nEta = cor->GetEtaAxis().GetNbins();
+  fWeightTable = new AliFMDELossWeightTable;
+  fWeightTable->SetTolerance(fWeightTableTolerance);
+  fWeightTable->SetRange(0, fWeightTableMax);
+  fWeightTable->Init(nEta);
+
+  Int_t nExact = 0;
+  for (UShort_t d=1; d<=3; d++) { 
+    UShort_t nr = (d == 1 ? 1 : 2);
+    for (UShort_t q=0; q<nr; q++) { 
+      Char_t r = (q == 0 ? 'I' : 'O');
+      for (Int_t iEta = 1; iEta <= nEta; iEta++) {
+	AliFMDCorrELossFit::ELossFit* fit = cor->FindFit(d,r,iEta,-1);
+	if (!fit) continue;
+	Int_t m = GetMaxWeight(d,r,iEta-1);
+	if (m < 1) continue;
+	UShort_t n = TMath::Min(fMaxParticles, UShort_t(m));
+	if (!fWeightTable->Fill(d,r,iEta,*fit,n)) nExact++;
+      }
+    }
+  }
+  if (nExact > 0) 
+    AliWarningF("%d eta bins use exact weights", nExact);
+  if (fDebug > 0) fWeightTable->Print();
+}
+
 //_____________________________________________________________________
 Int_t
 AliFMDDensityCalculator::GetMaxWeight(UShort_t d, Char_t r, Int_t iEta) const
@@ -864,6 +923,14 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   if (lowFlux) return 1;
   
   AliForwardCorrectionManager&  fcm = AliForwardCorrectionManager::Instance();
+  Double_t ret = 0;
+  if (fWeightTable && 
+      fWeightTable->Evaluate(d,r,fcm.GetELossFit()->FindEtaBin(eta),mult,ret)) {
+    fWeightedSum->Fill(ret);
+    fSumOfWeights->Fill(ret);
+    return ret;
+  }
+
   AliFMDCorrELossFit::ELossFit* fit = fcm.GetELossFit()->FindFit(d,r,eta, -1);
   if (!fit) { 
     AliWarning(Form("No energy loss fit for FMD%d%c at eta=%f qual=%d", 
@@ -878,7 +945,7 @@ AliFMDDensityCalculator::NParticles(Float_t  mult,
   }
   
   UShort_t n   = TMath::Min(fMaxParticles, UShort_t(m));
-  Double_t ret = fit->EvaluateWeighted(mult, n);
+  ret          = fit->EvaluateWeighted(mult, n);
   
   if (fDebug > 10) {
     AliInfo(Form("FMD%d%c, eta=%7.4f, %8.5f -> %8.5f", d, r, eta, mult, ret));
@@ -1120,6 +1187,7 @@ AliFMDDensityCalculator::CreateOutputObjects(TList* dir)
   d->Add(AliForwardUtil::MakeParameter("maxOutliers",  fMaxOutliers));
   d->Add(AliForwardUtil::MakeParameter("outlierCut",   fOutlierCut));
   d->Add(AliForwardUtil::MakeParameter("hitThreshold", fHitThreshold));
+  d->Add(AliForwardUtil::MakeParameter("weightTableTol", fWeightTableTolerance));
   d->Add(nFiles);
   // d->Add(nxi);
   fCuts.Output(d,"lCuts");
@@ -1201,6 +1269,7 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  PFV("Weight table tolerance", fWeightTableTolerance);
   PFV("Lower cut", "");
   fCuts.Print();
 
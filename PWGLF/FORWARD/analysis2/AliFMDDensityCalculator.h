@@ -25,6 +25,7 @@ class TH2D;
 class TH1D;
 class TProfile;
 class AliFMDCorrELossFit;
+class AliFMDELossWeightTable;
 
 /** 
  * This class calculates the inclusive charged particle density
@@ -211,6 +212,19 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Use interpolation tables of the energy loss fits
+   * (AliFMDELossWeightTable) instead of evaluating the weighted sum
+   * of Landau-Gauss functions for every strip.  The tables are built
+   * in SetupForData.
+   * 
+   * @param tol  Maximum relative deviation from the exact weights. If
+   *             0 or less, the weights are evaluated exactly.
+   * @param max  Largest tabulated energy loss.  Larger signals are
+   *             evaluated exactly.
+   */
+  void SetWeightTable(Double_t tol=1e-4, Double_t max=20) { 
+    fWeightTableTolerance = tol; fWeightTableMax = max; }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -297,6 +311,12 @@ protected:
    * @param axis Default @f$\eta@f$ axis from parent task 
    */  
   void CacheMaxWeights(const TAxis& axis);
+  /** 
+   * Build the interpolation tables of the energy loss fits, using
+   * the cached maximum weights.  Does nothing if the tables are
+   * disabled (see SetWeightTable).
+   */
+  void CacheWeightTable();
   /** 
    * Find the (cached) maximum weight for FMD<i>dr</i> in 
    * @f$\eta@f$ bin @a iEta
@@ -504,8 +524,11 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Double_t               fWeightTableTolerance; // Tolerance of weight tables
+  Double_t               fWeightTableMax;       // Upper limit of weight tables
+  AliFMDELossWeightTable* fWeightTable; //! Tabulated weights
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
@@ -0,0 +1,217 @@
+//
+// Interpolation tables of the weighted energy loss fits
+//
+#include "AliFMDELossWeightTable.h"
+#include <AliLog.h>
+#include <TROOT.h>
+#include <iostream>
+#include <vector>
+
+ClassImp(AliFMDELossWeightTable)
+#if 0
+; // For Emacs
+#endif
+
+//____________________________________________________________________
+AliFMDELossWeightTable::AliFMDELossWeightTable()
+  : TObject(),
+    fTolerance(1e-4),
+    fXMin(0),
+    fXMax(20),
+    fMaxPoints(8193),
+    fNEta(0),
+    fOffset(),
+    fNPoints(),
+    fInvStep(),
+    fError(),
+    fValues()
+{
+  //
+  // Constructor
+  //
+}
+
+//____________________________________________________________________
+AliFMDELossWeightTable::AliFMDELossWeightTable(const AliFMDELossWeightTable& o)
+  : TObject(o),
+    fTolerance(o.fTolerance),
+    fXMin(o.fXMin),
+    fXMax(o.fXMax),
+    fMaxPoints(o.fMaxPoints),
+    fNEta(o.fNEta),
+    fOffset(o.fOffset),
+    fNPoints(o.fNPoints),
+    fInvStep(o.fInvStep),
+    fError(o.fError),
+    fValues(o.fValues)
+{
+  //
+  // Copy constructor
+  //
+}
+
+//____________________________________________________________________
+AliFMDELossWeightTable&
+AliFMDELossWeightTable::operator=(const AliFMDELossWeightTable& o)
+{
+  //
+  // Assignment operator
+  //
+  if (&o == this) return *this;
+  TObject::operator=(o);
+  fTolerance = o.fTolerance;
+  fXMin      = o.fXMin;
+  fXMax      = o.fXMax;
+  fMaxPoints = o.fMaxPoints;
+  fNEta      = o.fNEta;
+  fOffset    = o.fOffset;
+  fNPoints   = o.fNPoints;
+  fInvStep   = o.fInvStep;
+  fError     = o.fError;
+  fValues    = o.fValues;
+  return *this;
+}
+
+//____________________________________________________________________
+void
+AliFMDELossWeightTable::Init(Int_t nEta)
+{
+  //
+  // Clear all tables
+  //
+  // Parameters:
+  //    nEta   Number of eta bins of the energy loss fits
+  //
+  fNEta = nEta;
+  fOffset.Set(5*nEta);
+  fOffset.Reset(-1);
+  fNPoints.Set(5*nEta);
+  fNPoints.Reset(0);
+  fInvStep.Set(5*nEta);
+  fInvStep.Reset(0);
+  fError.Set(5*nEta);
+  fError.Reset(-1);
+  fValues.Set(0);
+}
+
+//____________________________________________________________________
+Bool_t
+AliFMDELossWeightTable::Fill(UShort_t d, Char_t r, Int_t etaBin,
+			     const AliFMDCorrELossFit::ELossFit& fit,
+			     UShort_t maxN)
+{
+  //
+  // Tabulate the weights of a fit.  Starting from 65 points, the
+  // number of intervals is doubled until linear interpolation
+  // reproduces the exact weights at the middle of all intervals
+  // within the tolerance.  The middle points are the new points of
+  // the next refinement, so each exact value is computed once.
+  //
+  // Parameters:
+  //    d       Detector
+  //    r       Ring
+  //    etaBin  Eta bin (1 based)
+  //    fit     Energy loss fit
+  //    maxN    Maximum number of particles
+  //
+  // Return:
+  //    true if the tolerance was reached
+  //
+  Int_t slot = Slot(d, r, etaBin);
+  if (slot < 0 || fXMax <= fXMin) return false;
+
+  Int_t                 n = 65;
+  std::vector<Double_t> nodes(n);
+  Double_t              step = (fXMax - fXMin) / (n - 1);
+  for (Int_t i = 0; i < n; i++)
+    nodes[i] = fit.EvaluateWeighted(fXMin + i * step, maxN);
+
+  std::vector<Double_t> mids;
+  Double_t              maxErr = 0;
+  while (true) {
+    mids.resize(n-1);
+    maxErr = 0;
+    for (Int_t i = 0; i < n-1; i++) {
+      mids[i]        = fit.EvaluateWeighted(fXMin + (i + .5) * step, maxN);
+      Double_t inter = .5 * (nodes[i] + nodes[i+1]);
+      Double_t err   = TMath::Abs(inter - mids[i]) / TMath::Max(TMath::Abs(mids[i]), 1e-12);
+      maxErr         = TMath::Max(maxErr, err);
+    }
+    if (maxErr <= fTolerance) break;
+    if (2 * n - 1 > fMaxPoints) {
+      AliWarningF("FMD%d%c eta bin %d: relative deviation %g > %g with %d "
+		  "points, using exact weights", d, r, etaBin, maxErr,
+		  fTolerance, n);
+      return false;
+    }
+    // Refine: interleave nodes and middle points
+    std::vector<Double_t> fine(2 * n - 1);
+    for (Int_t i = 0; i < n-1; i++) {
+      fine[2*i]   = nodes[i];
+      fine[2*i+1] = mids[i];
+    }
+    fine[2*n-2] = nodes[n-1];
+    nodes.swap(fine);
+    n    = 2 * n - 1;
+    step = (fXMax - fXMin) / (n - 1);
+  }
+
+  Int_t off = fValues.GetSize();
+  fValues.Set(off + n);
+  for (Int_t i = 0; i < n; i++) fValues[off+i] = nodes[i];
+  fOffset[slot]  = off;
+  fNPoints[slot] = n;
+  fInvStep[slot] = 1 / step;
+  fError[slot]   = maxErr;
+  return true;
+}
+
+//____________________________________________________________________
+Double_t
+AliFMDELossWeightTable::GetError(UShort_t d, Char_t r, Int_t etaBin) const
+{
+  //
+  // Get the largest relative deviation found when checking a table
+  //
+  Int_t slot = Slot(d, r, etaBin);
+  if (slot < 0) return -1;
+  return fError[slot];
+}
+
+//____________________________________________________________________
+Int_t
+AliFMDELossWeightTable::GetNPoints(UShort_t d, Char_t r, Int_t etaBin) const
+{
+  //
+  // Get the number of points of a table
+  //
+  Int_t slot = Slot(d, r, etaBin);
+  if (slot < 0) return 0;
+  return fNPoints[slot];
+}
+
+//____________________________________________________________________
+void
+AliFMDELossWeightTable::Print(Option_t*) const
+{
+  //
+  // Print information
+  //
+  Int_t    nTables = 0;
+  Int_t    maxN    = 0;
+  Double_t maxErr  = 0;
+  for (Int_t i = 0; i < fOffset.GetSize(); i++) {
+    if (fOffset[i] < 0) continue;
+    nTables++;
+    maxN   = TMath::Max(maxN, fNPoints[i]);
+    maxErr = TMath::Max(maxErr, fError[i]);
+  }
+  gROOT->IndentLevel();
+  std::cout << ClassName() << ": " << nTables << " tables in ["
+	    << fXMin << "," << fXMax << "), tolerance " << fTolerance
+	    << ", max points " << maxN << ", max deviation " << maxErr
+	    << ", " << fValues.GetSize() << " values" << std::endl;
+}
+//
+// EOF
+//
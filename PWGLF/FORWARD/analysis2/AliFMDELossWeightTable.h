@@ -0,0 +1,184 @@
+#ifndef ALIFMDELOSSWEIGHTTABLE_H
+#define ALIFMDELOSSWEIGHTTABLE_H
+/**
+ * @file   AliFMDELossWeightTable.h
+ *
+ * @brief  Tabulated energy loss weights
+ *
+ * @ingroup pwglf_forward_algo
+ */
+#include <TObject.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
+#include <TMath.h>
+#include "AliFMDCorrELossFit.h"
+
+/**
+ * Interpolation tables of the weighted energy loss fits
+ * (AliFMDCorrELossFit::ELossFit::EvaluateWeighted) for each ring and
+ * @f$\eta@f$ bin of the energy loss fits.
+ *
+ * Each table samples
+ * @f[
+ *   f_W(x) = \frac{\sum_{i=1}^{n} i a_i f_i(x)}{\sum_{i=1}^{n} a_i f_i(x)}
+ * @f]
+ * on a uniform grid in @f$[x_{min},x_{max})@f$ and is evaluated by
+ * linear interpolation.  The grid is refined (number of intervals
+ * doubled) until the relative difference between the interpolated
+ * and exact value at the middle of every interval is below the
+ * tolerance.  Bins for which this is not reached with the maximum
+ * number of points, and values outside the range, are not tabulated
+ * and must be evaluated exactly.
+ *
+ * @ingroup pwglf_forward_algo
+ */
+class AliFMDELossWeightTable : public TObject
+{
+public:
+  /**
+   * Constructor
+   */
+  AliFMDELossWeightTable();
+  /**
+   * Copy constructor
+   *
+   * @param o Object to copy from
+   */
+  AliFMDELossWeightTable(const AliFMDELossWeightTable& o);
+  /**
+   * Destructor
+   */
+  virtual ~AliFMDELossWeightTable() {}
+  /**
+   * Assignment operator
+   *
+   * @param o Object to assign from
+   *
+   * @return Reference to this object
+   */
+  AliFMDELossWeightTable& operator=(const AliFMDELossWeightTable& o);
+  /**
+   * Set the maximum relative deviation from the exact weights
+   *
+   * @param tol Tolerance
+   */
+  void SetTolerance(Double_t tol) { fTolerance = tol; }
+  /**
+   * Set the range of energy loss values to tabulate
+   *
+   * @param min Least value
+   * @param max Largest value
+   */
+  void SetRange(Double_t min, Double_t max) { fXMin = min; fXMax = max; }
+  /**
+   * Set the maximum number of points of a table
+   *
+   * @param n Number of points
+   */
+  void SetMaxPoints(Int_t n) { fMaxPoints = n; }
+  /**
+   * Clear all tables and set the number of @f$\eta@f$ bins
+   *
+   * @param nEta Number of @f$\eta@f$ bins of the energy loss fits
+   */
+  void Init(Int_t nEta);
+  /**
+   * Tabulate the weights of a fit
+   *
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  @f$\eta@f$ bin (1 based)
+   * @param fit     Energy loss fit
+   * @param maxN    Maximum number of particles
+   *
+   * @return true if the tolerance was reached
+   */
+  Bool_t Fill(UShort_t d, Char_t r, Int_t etaBin,
+	      const AliFMDCorrELossFit::ELossFit& fit, UShort_t maxN);
+  /**
+   * Evaluate the weights
+   *
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  @f$\eta@f$ bin (1 based)
+   * @param x       Energy loss
+   * @param w       On return, the interpolated weight
+   *
+   * @return false if the value is not tabulated
+   */
+  Bool_t Evaluate(UShort_t d, Char_t r, Int_t etaBin, Double_t x,
+		  Double_t& w) const
+  {
+    if (x < fXMin || x >= fXMax) return false;
+    Int_t slot = Slot(d, r, etaBin);
+    if (slot < 0) return false;
+    Int_t off = fOffset.fArray[slot];
+    if (off < 0) return false;
+    Double_t u = (x - fXMin) * fInvStep.fArray[slot];
+    Int_t    i = TMath::Min(Int_t(u), fNPoints.fArray[slot] - 2);
+    Double_t f = u - i;
+    const Double_t* v = fValues.fArray + off + i;
+    w = (1 - f) * v[0] + f * v[1];
+    return true;
+  }
+  /**
+   * Get the relative deviation found when checking a table
+   *
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  @f$\eta@f$ bin (1 based)
+   *
+   * @return Largest relative deviation, or -1 if not tabulated
+   */
+  Double_t GetError(UShort_t d, Char_t r, Int_t etaBin) const;
+  /**
+   * Get the number of points of a table
+   *
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  @f$\eta@f$ bin (1 based)
+   *
+   * @return Number of points, or 0 if not tabulated
+   */
+  Int_t GetNPoints(UShort_t d, Char_t r, Int_t etaBin) const;
+  /**
+   * Print information
+   *
+   * @param option Not used
+   */
+  void Print(Option_t* option="") const;
+protected:
+  /**
+   * Get the index of a table
+   *
+   * @param d       Detector
+   * @param r       Ring
+   * @param etaBin  @f$\eta@f$ bin (1 based)
+   *
+   * @return Index, or -1 if out of range
+   */
+  Int_t Slot(UShort_t d, Char_t r, Int_t etaBin) const
+  {
+    if (etaBin < 1 || etaBin > fNEta) return -1;
+    Int_t ring = (d == 1 ? 0 : (d - 2) * 2 + 1 + (r == 'I' || r == 'i' ? 0 : 1));
+    if (ring < 0 || ring > 4) return -1;
+    return ring * fNEta + etaBin - 1;
+  }
+  Double_t fTolerance;   // Maximum relative deviation
+  Double_t fXMin;        // Least tabulated energy loss
+  Double_t fXMax;        // Largest tabulated energy loss
+  Int_t    fMaxPoints;   // Maximum number of points of a table
+  Int_t    fNEta;        // Number of eta bins
+  TArrayI  fOffset;      // Offset of each table in fValues (-1: none)
+  TArrayI  fNPoints;     // Number of points of each table
+  TArrayD  fInvStep;     // Inverse grid step of each table
+  TArrayD  fError;       // Largest relative deviation of each table
+  TArrayD  fValues;      // Tabulated weights
+
+  ClassDef(AliFMDELossWeightTable,1); // Tabulated energy loss weights
+};
+
+#endif
+// Local Variables:
+//   mode: C++
+// End:
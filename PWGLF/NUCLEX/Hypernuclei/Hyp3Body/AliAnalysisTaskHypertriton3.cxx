@@ -64,6 +64,7 @@
 #include "AliPhysicsSelection.h"
 #include "AliStack.h"
 #include "AliVertexerTracks.h"
+#include "AliHypertriton3TripletFinder.h"
 #include "AliVEvent.h"
 #include "AliVTrack.h"
 
@@ -88,6 +89,7 @@ AliAnalysisTaskHypertriton3::AliAnalysisTaskHypertriton3(TString taskname):
   fVtx1(0x0),
   fVtx2(0x0),
   fTrkArray(0x0),
+  fTripletFinder(0x0),
   fQAplots(kFALSE),
   fMC(kFALSE),
   fFillTree(kFALSE),
@@ -117,6 +119,8 @@ AliAnalysisTaskHypertriton3::AliAnalysisTaskHypertriton3(TString taskname):
   fMinvLikeSign(kFALSE),
   fSideBand(kFALSE),
   fTriangularDCAtracks(kFALSE),
+  fNThreadsVertexing(1),
+  fKinematicPrefilter(kFALSE),
   fMinPtDeuteron(0),
   fMaxPtDeuteron(10.),
   fMinPtProton(0),
@@ -381,6 +385,7 @@ AliAnalysisTaskHypertriton3::~AliAnalysisTaskHypertriton3(){
     if(fTrkArray) delete fTrkArray;
     if(fVtx1) delete fVtx1;
     if(fVtx2) delete fVtx2;
+    if(fTripletFinder) delete fTripletFinder;
 
 
 } // end of Destructor
@@ -633,8 +638,6 @@ AliESDtrack *trackD = 0x0;
 AliESDtrack *trackP = 0x0;
 AliESDtrack *trackNPi = 0x0;
 
-Double_t xthiss(0.0);
-Double_t xpp(0.0);
 Float_t piprim[2] = {0.,0.};
 Float_t piprimc[3] = {0.,0.,0.};
 Float_t nsd, nsp, nspi = 0.;
@@ -655,6 +658,20 @@ TParticle *tparticlePi = 0x0;
 // -------------------------------------------------------
 
 
+// Staged search:
+// 1) pair DCAs, computed once per pair by fTripletFinder
+// 2) triplets rejected by the pair DCA cuts (and optionally by the kinematic bounds)
+// 3) decay vertex fit of the surviving triplets, optionally on several threads
+// 4) topological and kinematical cuts of the survivors, in the order of the loops
+
+const Double_t kBoundTolerance = 1e-6;
+std::vector<Double_t> tripletDCA; // dca_dp, dca_dpi, dca_ppi of the surviving triplets
+
+fTripletFinder->Reset(bz,arrD.GetSize(),arrP.GetSize(),arrPi.GetSize());
+for(Int_t j=0; j<arrD.GetSize(); j++) fTripletFinder->SetDeuteron(j,dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrD[j])));
+for(Int_t m=0; m<arrP.GetSize(); m++) fTripletFinder->SetProton(m,dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrP[m])));
+for(Int_t s=0; s<arrPi.GetSize(); s++) fTripletFinder->SetPion(s,dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrPi[s])));
+
 for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size()
 
   trackD = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrD[j]));
@@ -666,7 +683,7 @@ for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size
 
     if(trackD->GetID() == trackP->GetID()) continue;
 
-    dca_dp = trackD->GetDCA(trackP,bz,xthiss,xpp);
+    dca_dp = fTripletFinder->GetDCAdp(j,m);
 
     fHistDCAdeupro->Fill(dca_dp);
 
@@ -675,26 +692,15 @@ for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size
 
     for(Int_t s=0; s<arrPi.GetSize(); s++ ){ // candidate pion loop cpion.size()
 
-      fTrkArray->Clear();
-      Hypertriton.Clear();
-      posD.Clear();
-      posP.Clear();
-      negPi.Clear();
-      h1.Clear();
-      d1.Clear();
-      p1.Clear();
-      pi1.Clear();
-
       trackNPi = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrPi[s]));
-      brotherHood = kFALSE;
 
 
       if(trackNPi->GetID() == trackP->GetID()) continue;
       if(trackNPi->GetID() == trackD->GetID()) continue;
 
 
-      dca_dpi = trackNPi->GetDCA(trackD,bz,xthiss,xpp);
-      dca_ppi = trackNPi->GetDCA(trackP,bz,xthiss,xpp);
+      dca_dpi = fTripletFinder->GetDCAdpi(j,s);
+      dca_ppi = fTripletFinder->GetDCAppi(m,s);
 
 
       fHistDCAdpdpi->Fill(dca_dp,dca_dpi);
@@ -712,12 +718,47 @@ for(Int_t j=0; j<arrD.GetSize(); j++){ // candidate deuteron loop cdeuteron.size
       fHistDCApiondeu->Fill(dca_dpi);
       fHistDCApionpro->Fill(dca_ppi);
 
-      fTrkArray->AddAt(trackD,0);
-      fTrkArray->AddAt(trackP,1);
-      fTrkArray->AddAt(trackNPi,2);
+      if(fKinematicPrefilter){
+        // bounds on the mass and pT at the decay vertex, see AliHypertriton3TripletFinder
+        Double_t minMass = fTripletFinder->GetMinMass(j,m,s,1.87561,0.93827,0.13957);
+        if(fRequireMassRange && minMass > fCutMassUp+kBoundTolerance) continue;
+        if(fSideBand && minMass > 3.18+kBoundTolerance) continue;
+        if(fTripletFinder->GetMaxPt(j,m,s) < fMinPtMother-kBoundTolerance) continue;
+      }
+
+      fTripletFinder->AddTriplet(j,m,s);
+      tripletDCA.push_back(dca_dp);
+      tripletDCA.push_back(dca_dpi);
+      tripletDCA.push_back(dca_ppi);
+    } // end of candidate pion loop
+  } // end of candidate proton loop
+}// end of candidate deuteron loop
+
+fTripletFinder->SetVtxStart(fPrimaryVertex);
+fTripletFinder->FitVertices(fVertexer);
+
+
+for(Int_t i=0; i<fTripletFinder->GetNTriplets(); i++){ // surviving triplets
+
+      Hypertriton.Clear();
+      posD.Clear();
+      posP.Clear();
+      negPi.Clear();
+      h1.Clear();
+      d1.Clear();
+      p1.Clear();
+      pi1.Clear();
+
+      trackD = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrD[fTripletFinder->GetDeuteron(i)]));
+      trackP = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrP[fTripletFinder->GetProton(i)]));
+      trackNPi = dynamic_cast<AliESDtrack*>(fESDevent->GetTrack(arrPi[fTripletFinder->GetPion(i)]));
+      brotherHood = kFALSE;
 
-      fVertexer->SetVtxStart(fPrimaryVertex);
-      decayVtx = (AliESDVertex*)fVertexer->VertexForSelectedESDTracks(fTrkArray);
+      dca_dp = tripletDCA[3*i];
+      dca_dpi = tripletDCA[3*i+1];
+      dca_ppi = tripletDCA[3*i+2];
+
+      decayVtx = fTripletFinder->TakeVertex(i);
 
       SetConvertedAODVertices(fPrimaryVertex,decayVtx);
 
@@ -1042,9 +1083,7 @@ if(fFillTree){
   fTTree->Fill();
   PostData(2,fTTree);
      } //end of Fill Tree
-    } // end of candidate pion loop
-  } // end of candidate proton loop
-}// end of candidate deuteron loop
+} // end of surviving triplets loop
 
 }
 
@@ -1058,6 +1097,8 @@ void AliAnalysisTaskHypertriton3::UserCreateOutputObjects(){
 
   fVertexer = new AliVertexerTracks();
   fTrkArray = new TObjArray(3);
+  fTripletFinder = new AliHypertriton3TripletFinder();
+  fTripletFinder->SetNThreads(fNThreadsVertexing);
   fVtx1 = new AliAODVertex();
   fVtx2 = new AliAODVertex();
 
@@ -48,6 +48,7 @@ class AliESDVertex;
 class AliPID;
 class AliPIDResponse;
 class AliVertexerTracks;
+class AliHypertriton3TripletFinder;
 
 class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
 
@@ -78,6 +79,8 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   void SetMotherType(bool matter = kTRUE, bool antimatter = kTRUE){fChooseMatter = matter; fChooseAntiMatter = antimatter;}
   void SetSideBand(Bool_t sband = kFALSE) {fSideBand = sband;}
   void SetDCAtracksTrianSel(Bool_t selDcaT = kFALSE) {fTriangularDCAtracks = selDcaT;}
+  void SetNThreadsVertexing(Int_t nthreads = 1) {fNThreadsVertexing = nthreads;}
+  void SetKinematicPrefilter(Bool_t prefilter = kTRUE) {fKinematicPrefilter = prefilter;}
 
   void SetDeuteronPtRange(double min=0, double max=10){fMinPtDeuteron = min; fMaxPtDeuteron = max;}
   void SetProtonPtRange(double min=0, double max=10){fMinPtProton = min; fMaxPtProton = max;}
@@ -138,6 +141,7 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   AliAODVertex       *fVtx2;                       //!<! Secondary vertex converted from ESD to AOD
 
   TObjArray          *fTrkArray;                   //!<! Array containing the three tracks candidated to the secondary vertex reconstruction
+  AliHypertriton3TripletFinder *fTripletFinder;  //!<! Staged triplet search: pair DCAs and decay vertex fits of the surviving triplets
 
   //Variables
   Bool_t             fQAplots;
@@ -169,6 +173,8 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   Bool_t             fMinvLikeSign;                ///< flag for like-sign charge triplet
   Bool_t             fSideBand;                    ///< select distributions in the side band region where only background
   Bool_t             fTriangularDCAtracks;             ///<
+  Int_t              fNThreadsVertexing;           ///< number of threads for the decay vertex fits (one deuteron candidate per thread at a time, needs ROOT::EnableThreadSafety() in the steering macro)
+  Bool_t             fKinematicPrefilter;          ///< reject the triplets by the bounds on mass and \f$p_{T}\f$ before the vertex fit (the QA histograms filled before these cuts then only see the survivors)
 
   //Cut variables
   Double_t           fMinPtDeuteron;               ///< Cut on minimum pT of deuteron candidate
@@ -426,7 +432,7 @@ class AliAnalysisTaskHypertriton3 : public AliAnalysisTaskSE {
   AliAnalysisTaskHypertriton3(const AliAnalysisTaskHypertriton3&); // not implemented
   AliAnalysisTaskHypertriton3& operator=(const AliAnalysisTaskHypertriton3&); // not implemented
 
-  ClassDef(AliAnalysisTaskHypertriton3, 3); // analysisclass
+  ClassDef(AliAnalysisTaskHypertriton3, 4); // analysisclass
 
 };
 
@@ -56,6 +56,7 @@
 #include "AliESDtrackCuts.h"
 #include "AliESDVertex.h"
 #include "AliExternalTrackParam.h"
+#include "AliHypertriton3TripletFinder.h"
 #include "AliInputEventHandler.h"
 #include "AliMCEventHandler.h"
 #include "AliMCEvent.h"
@@ -83,6 +84,7 @@ AliAnalysisTaskHypertriton3AOD::AliAnalysisTaskHypertriton3AOD(TString taskname)
   fVertexer(0x0),
   fVtx2(0x0),
   fTrkArray(0x0),
+  fTripletFinder(0x0),
   fMC(kFALSE),
   fFillTree(kFALSE),
   fCentrality(0x0),
@@ -122,6 +124,8 @@ AliAnalysisTaskHypertriton3AOD::AliAnalysisTaskHypertriton3AOD(TString taskname)
   fMaxPMotherCM(999.),
   fLowCentrality(0.),
   fHighCentrality(80.),
+  fNThreadsVertexing(1),
+  fKinematicPrefilter(kFALSE),
   fOutput(0x0),
   fHistCount(0x0),
   fHistCentralityClass(0x0),
@@ -283,6 +287,7 @@ AliAnalysisTaskHypertriton3AOD::~AliAnalysisTaskHypertriton3AOD(){
     if(fPrimaryVertex) delete fPrimaryVertex;
     if(fVertexer) delete fVertexer;
     if(fTrkArray) delete fTrkArray;
+    if(fTripletFinder) delete fTripletFinder;
     if(fVtx2) delete fVtx2;
 
 
@@ -330,6 +335,8 @@ void AliAnalysisTaskHypertriton3AOD::UserCreateOutputObjects(){
 
   fVertexer = new AliVertexerTracks();
   fTrkArray = new TObjArray(3);
+  fTripletFinder = new AliHypertriton3TripletFinder();
+  fTripletFinder->SetNThreads(fNThreadsVertexing);
   fVtx2 = new AliAODVertex();
     
   fOutput = new TList();
@@ -1029,8 +1036,6 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
   
   Double_t bz = fAODevent->GetMagneticField();
   fVertexer->SetFieldkG(bz);
-  Double_t xthiss(0.0);
-  Double_t xpp(0.0);
   
   AliESDVertex *decayVtx = 0x0;
 
@@ -1044,7 +1049,21 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
   TLorentzVector p_dp,p_dpi;
   Int_t deuIdx, proIdx, pioIdx = 0.;
   Double_t charge_d, charge_p, charge_pi = 0.;
-  AliExternalTrackParam etd, etp, etpi;
+
+  // Staged search:
+  // 1) pair DCAs, computed once per pair by fTripletFinder
+  // 2) triplets rejected by the pair DCA cuts (and optionally by the kinematic bounds)
+  // 3) decay vertex fit of the surviving triplets, optionally on several threads
+  // 4) topological and kinematical cuts of the survivors, in the order of the loops
+  // The track parameters at the primary vertex are kept for each candidate, each
+  // surviving triplet propagates its own copies of them to its decay vertex (the
+  // propagation is no longer carried over to the following triplets).
+  
+  const Double_t kBoundTolerance = 1e-6;
+  const Int_t kNTripletInfo = 12;
+  std::vector<AliExternalTrackParam> candD(nDeuTPC), candP(nProTPC), candPi(nPioTPC);
+  std::vector<Double_t> tripletInfo; // pair DCAs and DCAs to the primary vertex of the surviving triplets
+  fTripletFinder->Reset(bz,nDeuTPC,nProTPC,nPioTPC);
   
   for(UInt_t j=0; j<nDeuTPC; j++){ // candidate deuteron loop cdeuteron.size()
     
@@ -1058,7 +1077,8 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
     if(dcadprim < fDCADPVmin) continue;
     
     charge_d = trackD->Charge();
-    etd.CopyFromVTrack(trackD);
+    candD[j].CopyFromVTrack(trackD);
+    fTripletFinder->SetDeuteron(j,&candD[j]);
     
     for(UInt_t m=0; m<nProTPC; m++){ // candidate proton loop cproton.size()
           
@@ -1077,9 +1097,10 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
 
       if(dcapprim < fDCAPPVmin) continue;
 
-      etp.CopyFromVTrack(trackP);
+      candP[m].CopyFromVTrack(trackP);
+      fTripletFinder->SetProton(m,&candP[m]);
 
-      dca_dp = etd.GetDCA(&etp,bz,xthiss,xpp);
+      dca_dp = fTripletFinder->GetDCAdp(j,m);
 
       fHistDCAdeupro->Fill(dca_dp);
 
@@ -1088,21 +1109,7 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
             
       for(UInt_t s=0; s<nPioTPC; s++ ){ // candidate pion loop cpion.size()
 
-	fTrkArray->Clear();
-	Hypertriton.Clear();
-	HypertritonCM.Clear();
-	h1.Clear();
-	posD.Clear();
-	posP.Clear();
-	negPi.Clear();
-	d1.Clear();
-	p1.Clear();
-	pi1.Clear();
-	p_dp.Clear();
-	p_dpi.Clear();
-	
 	trackNPi = dynamic_cast<AliAODTrack*>(fAODevent->GetTrack(cpion[s]));
-	brotherHood = kFALSE;
 
 	charge_pi = trackNPi->Charge();
 
@@ -1128,12 +1135,13 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
 	
 	if(dcapiprim < fDCAPiPVmin) continue;
 
-	etpi.CopyFromVTrack(trackNPi);
+	candPi[s].CopyFromVTrack(trackNPi);
+	fTripletFinder->SetPion(s,&candPi[s]);
 
 	//====Triplets building====
 	
-	dca_dpi = etpi.GetDCA(&etd,bz,xthiss,xpp);
-	dca_ppi = etpi.GetDCA(&etp,bz,xthiss,xpp);
+	dca_dpi = fTripletFinder->GetDCAdpi(j,s);
+	dca_ppi = fTripletFinder->GetDCAppi(m,s);
 
 
 	fHistDCAdpdpi->Fill(dca_dp,dca_dpi);
@@ -1146,15 +1154,61 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
 
 	fHistDCApiondeu->Fill(dca_dpi);
 	fHistDCApionpro->Fill(dca_ppi);
-	
-	fTrkArray->AddAt(&etd,0);
-	fTrkArray->AddAt(&etp,1);
-	fTrkArray->AddAt(&etpi,2);
 
-	//====Decay vertex and topology====
+	if(fKinematicPrefilter){
+	  // bounds on the mass and pT at the decay vertex, see AliHypertriton3TripletFinder
+	  Double_t minMass = fTripletFinder->GetMinMass(j,m,s,deuteronMass,protonMass,pionMass);
+	  if(fSideBand && minMass > 3.18+kBoundTolerance) continue;
+	  if(fTripletFinder->GetMaxPt(j,m,s) < fMinPtMother-kBoundTolerance) continue;
+	}
+
+	fTripletFinder->AddTriplet(j,m,s);
+	Double_t info[kNTripletInfo] = {dca_dp, dca_dpi, dca_ppi, dprim[0], dprim[1], pprim[0], pprim[1],
+					piprim[0], piprim[1], dcadprim, dcapprim, dcapiprim};
+	tripletInfo.insert(tripletInfo.end(),info,info+kNTripletInfo);
+      } // end of candidate pion loop
+    } // end of candidate proton loop
+  }// end of candidate deuteron loop
+
+  //====Decay vertex and topology====
 
-	fVertexer->SetVtxStart(fPrimaryVertex->GetX(),fPrimaryVertex->GetY(),fPrimaryVertex->GetZ());
-	decayVtx = (AliESDVertex*)fVertexer->VertexForSelectedESDTracks(fTrkArray);
+  fTripletFinder->SetVtxStart(fPrimaryVertex->GetX(),fPrimaryVertex->GetY(),fPrimaryVertex->GetZ());
+  fTripletFinder->FitVertices(fVertexer);
+
+  for(Int_t i=0; i<fTripletFinder->GetNTriplets(); i++){ // surviving triplets
+
+	Hypertriton.Clear();
+	HypertritonCM.Clear();
+	h1.Clear();
+	posD.Clear();
+	posP.Clear();
+	negPi.Clear();
+	d1.Clear();
+	p1.Clear();
+	pi1.Clear();
+	p_dp.Clear();
+	p_dpi.Clear();
+
+	trackD = dynamic_cast<AliAODTrack*>(fAODevent->GetTrack(cdeuteron[fTripletFinder->GetDeuteron(i)]));
+	trackP = dynamic_cast<AliAODTrack*>(fAODevent->GetTrack(cproton[fTripletFinder->GetProton(i)]));
+	trackNPi = dynamic_cast<AliAODTrack*>(fAODevent->GetTrack(cpion[fTripletFinder->GetPion(i)]));
+	brotherHood = kFALSE;
+	charge_d = trackD->Charge();
+	charge_p = trackP->Charge();
+	charge_pi = trackNPi->Charge();
+
+	AliExternalTrackParam etd(candD[fTripletFinder->GetDeuteron(i)]);
+	AliExternalTrackParam etp(candP[fTripletFinder->GetProton(i)]);
+	AliExternalTrackParam etpi(candPi[fTripletFinder->GetPion(i)]);
+
+	const Double_t *info = &tripletInfo[kNTripletInfo*i];
+	dca_dp = info[0]; dca_dpi = info[1]; dca_ppi = info[2];
+	dprim[0] = info[3]; dprim[1] = info[4];
+	pprim[0] = info[5]; pprim[1] = info[6];
+	piprim[0] = info[7]; piprim[1] = info[8];
+	dcadprim = info[9]; dcapprim = info[10]; dcapiprim = info[11];
+
+	decayVtx = fTripletFinder->TakeVertex(i);
 
 	SetConvertedAODVertices(decayVtx);
 	
@@ -1382,9 +1436,7 @@ void AliAnalysisTaskHypertriton3AOD::UserExec(Option_t *){
 	    fHistMassHypertritonMCt->Fill(Hypertriton.M());
 	  }
 	} // end of Pure MC part
-      } // end of candidate pion loop
-    } // end of candidate proton loop
-  }// end of candidate deuteron loop
+  } // end of surviving triplets loop
 
 
 
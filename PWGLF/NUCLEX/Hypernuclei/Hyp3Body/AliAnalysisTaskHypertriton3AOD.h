@@ -43,6 +43,7 @@ class AliAODEvent;
 class AliAODTrack;
 class AliAODVertex;
 class AliESDtrackCuts;
+class AliHypertriton3TripletFinder;
 class AliPIDResponse;
 class AliVertexerTracks; 
 class AliVEvent;
@@ -91,6 +92,9 @@ class AliAnalysisTaskHypertriton3AOD : public AliAnalysisTaskSE {
   void SetAngleDeuteronProton(double ang_dp) {fAngledp = ang_dp;}
   
   void SetCentrPercentileLimits(double lowc, double highc) {fLowCentrality = lowc; fHighCentrality = highc;}
+
+  void SetNThreadsVertexing(Int_t nthreads = 1) {fNThreadsVertexing = nthreads;}
+  void SetKinematicPrefilter(Bool_t prefilter = kTRUE) {fKinematicPrefilter = prefilter;}
   
   Double_t GetDCAcut(Int_t part, Double_t dca) const;
 
@@ -108,6 +112,7 @@ class AliAnalysisTaskHypertriton3AOD : public AliAnalysisTaskSE {
   AliAODVertex       *fVtx2;                       //!<! Secondary vertex converted from ESD to AOD
   
   TObjArray          *fTrkArray;                   //!<! Array containing the three tracks candidated to the secondary vertex reconstruction
+  AliHypertriton3TripletFinder *fTripletFinder;    //!<! Staged triplet search: pair DCAs and decay vertex fits of the surviving triplets
   
   //Variables
   Bool_t             fMC;                          ///< variables for MC selection
@@ -153,6 +158,8 @@ class AliAnalysisTaskHypertriton3AOD : public AliAnalysisTaskSE {
   Double_t           fMaxPMotherCM;                ///< Cut on max mother momentum in the CM
   Double_t           fLowCentrality;               ///< Cut on lower value of centrality class
   Double_t           fHighCentrality;              ///< Cut on high value of centrality class
+  Int_t              fNThreadsVertexing;           ///< number of threads for the decay vertex fits (one deuteron candidate per thread at a time, needs ROOT::EnableThreadSafety() in the steering macro)
+  Bool_t             fKinematicPrefilter;          ///< reject the triplets by the bounds on mass and \f$p_{T}\f$ before the vertex fit (the QA histograms filled before these cuts then only see the survivors)
   
   //Output list
   TList              *fOutput;                     ///< Output list
@@ -314,7 +321,7 @@ class AliAnalysisTaskHypertriton3AOD : public AliAnalysisTaskSE {
   AliAnalysisTaskHypertriton3AOD(const AliAnalysisTaskHypertriton3AOD&); // not implemented
   AliAnalysisTaskHypertriton3AOD& operator=(const AliAnalysisTaskHypertriton3AOD&); // not implemented
   
-  ClassDef(AliAnalysisTaskHypertriton3AOD, 1); // analysisclass
+  ClassDef(AliAnalysisTaskHypertriton3AOD, 2); // analysisclass
   
 };
 
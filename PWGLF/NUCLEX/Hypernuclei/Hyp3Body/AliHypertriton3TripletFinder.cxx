@@ -0,0 +1,214 @@
+/**************************************************************************
+ * Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+///////////////////////////////////////////////////////////////////////////
+// AliHypertriton3TripletFinder class
+// Staged d+p+pi triplet search for the AliAnalysisTaskHypertriton3 tasks,
+// see the header for the description
+///////////////////////////////////////////////////////////////////////////
+
+#include <RVersion.h>
+#include <TMath.h>
+#include <TObjArray.h>
+#include <TVirtualMutex.h>
+
+#include "AliESDVertex.h"
+#include "AliExternalTrackParam.h"
+#include "AliHypertriton3TripletFinder.h"
+#include "AliLog.h"
+#include "AliVertexerTracks.h"
+
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIHYPERTRITON3TRIPLETFINDER_THREAD
+#include <atomic>
+#include <thread>
+#endif
+
+ClassImp(AliHypertriton3TripletFinder)
+
+//________________________________________________________________________
+AliHypertriton3TripletFinder::AliHypertriton3TripletFinder():
+  TObject(),
+  fNThreads(1),
+  fBz(0.),
+  fDeuterons(),
+  fProtons(),
+  fPions(),
+  fDCAdp(),
+  fDCAdpi(),
+  fDCAppi(),
+  fTriplets(),
+  fGroupFirst(),
+  fVertices(),
+  fVtxStart(0x0)
+{
+  //Constructor
+  fVtxStartXYZ[0] = 0.; fVtxStartXYZ[1] = 0.; fVtxStartXYZ[2] = 0.;
+}
+
+//________________________________________________________________________
+AliHypertriton3TripletFinder::~AliHypertriton3TripletFinder(){
+  //Destructor, the vertices not taken by the task are deleted
+  ClearVertices();
+}
+
+//________________________________________________________________________
+void AliHypertriton3TripletFinder::ClearVertices(){
+  for(UInt_t i=0; i<fVertices.size(); i++) delete fVertices[i];
+  fVertices.clear();
+}
+
+//________________________________________________________________________
+void AliHypertriton3TripletFinder::Reset(Double_t bz, Int_t nD, Int_t nP, Int_t nPi){
+  //Prepare for a new combination of nD deuteron, nP proton and nPi pion candidates
+  //The buffers keep their memory
+  ClearVertices();
+  fBz = bz;
+  fDeuterons.assign(nD,0x0);
+  fProtons.assign(nP,0x0);
+  fPions.assign(nPi,0x0);
+  fDCAdp.assign(nD*nP,-1.);
+  fDCAdpi.assign(nD*nPi,-1.);
+  fDCAppi.assign(nP*nPi,-1.);
+  fTriplets.clear();
+  fGroupFirst.clear();
+}
+
+//________________________________________________________________________
+Double_t AliHypertriton3TripletFinder::GetDCAdp(Int_t j, Int_t m){
+  Double_t &dca = fDCAdp[j*fProtons.size()+m];
+  if(dca < 0){
+    Double_t xthiss(0.0), xpp(0.0);
+    dca = fDeuterons[j]->GetDCA(fProtons[m],fBz,xthiss,xpp);
+  }
+  return dca;
+}
+
+//________________________________________________________________________
+Double_t AliHypertriton3TripletFinder::GetDCAdpi(Int_t j, Int_t s){
+  Double_t &dca = fDCAdpi[j*fPions.size()+s];
+  if(dca < 0){
+    Double_t xthiss(0.0), xpp(0.0);
+    dca = fPions[s]->GetDCA(fDeuterons[j],fBz,xthiss,xpp);
+  }
+  return dca;
+}
+
+//________________________________________________________________________
+Double_t AliHypertriton3TripletFinder::GetDCAppi(Int_t m, Int_t s){
+  Double_t &dca = fDCAppi[m*fPions.size()+s];
+  if(dca < 0){
+    Double_t xthiss(0.0), xpp(0.0);
+    dca = fPions[s]->GetDCA(fProtons[m],fBz,xthiss,xpp);
+  }
+  return dca;
+}
+
+//________________________________________________________________________
+Double_t AliHypertriton3TripletFinder::GetMinMass(Int_t j, Int_t m, Int_t s, Double_t massD, Double_t massP, Double_t massPi) const{
+  //Lower bound of the invariant mass of the triplet, whatever the directions at the decay vertex:
+  //M^2 = (sum E)^2 - |sum p|^2 >= (sum E)^2 - (sum |p|)^2
+  Double_t pD = fDeuterons[j]->P(), pP = fProtons[m]->P(), pPi = fPions[s]->P();
+  Double_t e = TMath::Sqrt(pD*pD+massD*massD) + TMath::Sqrt(pP*pP+massP*massP) + TMath::Sqrt(pPi*pPi+massPi*massPi);
+  Double_t p = pD + pP + pPi;
+  return TMath::Sqrt(TMath::Max(e*e-p*p,0.));
+}
+
+//________________________________________________________________________
+Double_t AliHypertriton3TripletFinder::GetMaxPt(Int_t j, Int_t m, Int_t s) const{
+  //Upper bound of the transverse momentum of the triplet
+  return fDeuterons[j]->Pt() + fProtons[m]->Pt() + fPions[s]->Pt();
+}
+
+//________________________________________________________________________
+Int_t AliHypertriton3TripletFinder::AddTriplet(Int_t j, Int_t m, Int_t s){
+  //Add a triplet for the vertex fit, returns its index
+  //The triplets of a deuteron candidate are expected to be added one after the other
+  Int_t i = GetNTriplets();
+  if(i == 0 || fTriplets[3*(i-1)] != j) fGroupFirst.push_back(i);
+  fTriplets.push_back(j);
+  fTriplets.push_back(m);
+  fTriplets.push_back(s);
+  return i;
+}
+
+//________________________________________________________________________
+void AliHypertriton3TripletFinder::FitGroup(AliVertexerTracks *vertexer, Int_t group){
+  //Decay vertices of the triplets of one deuteron candidate
+  Int_t first = fGroupFirst[group];
+  Int_t last = (group+1 < (Int_t)fGroupFirst.size()) ? fGroupFirst[group+1] : GetNTriplets();
+  TObjArray trkArray(3);
+  for(Int_t i=first; i<last; i++){
+    trkArray.Clear();
+    trkArray.AddAt(const_cast<AliExternalTrackParam*>(fDeuterons[GetDeuteron(i)]),0);
+    trkArray.AddAt(const_cast<AliExternalTrackParam*>(fProtons[GetProton(i)]),1);
+    trkArray.AddAt(const_cast<AliExternalTrackParam*>(fPions[GetPion(i)]),2);
+    if(fVtxStart) vertexer->SetVtxStart(fVtxStart);
+    else vertexer->SetVtxStart(fVtxStartXYZ[0],fVtxStartXYZ[1],fVtxStartXYZ[2]);
+    fVertices[i] = (AliESDVertex*)vertexer->VertexForSelectedESDTracks(&trkArray);
+  }
+}
+
+//________________________________________________________________________
+void AliHypertriton3TripletFinder::FitVertices(AliVertexerTracks *vertexer){
+  //Fit the decay vertex of all the triplets added since Reset()
+  //vertexer (configured by the task) is used by the first thread, the other
+  //threads use their own AliVertexerTracks with the same magnetic field
+  ClearVertices();
+  fVertices.assign(GetNTriplets(),0x0);
+
+  Int_t nGroups = fGroupFirst.size();
+  Int_t nThreads = TMath::Min(fNThreads,nGroups);
+#ifndef ALIHYPERTRITON3TRIPLETFINDER_THREAD
+  nThreads = 1;
+#endif
+  if(nThreads > 1 && !gGlobalMutex){
+    static Bool_t warned = kFALSE;
+    if(!warned) AliWarningGeneral("AliHypertriton3TripletFinder","ROOT thread safety not enabled in the steering macro, the vertex fits are done serially");
+    warned = kTRUE;
+    nThreads = 1;
+  }
+
+  if(nThreads <= 1){
+    for(Int_t g=0; g<nGroups; g++) FitGroup(vertexer,g);
+    return;
+  }
+
+#ifdef ALIHYPERTRITON3TRIPLETFINDER_THREAD
+  std::vector<AliVertexerTracks*> vertexers(nThreads,vertexer);
+  for(Int_t t=1; t<nThreads; t++){
+    vertexers[t] = new AliVertexerTracks();
+    vertexers[t]->SetFieldkG(fBz);
+  }
+  std::atomic<Int_t> next(0);
+  std::vector<std::thread> threads;
+  for(Int_t t=0; t<nThreads; t++){
+    AliVertexerTracks *vtxer = vertexers[t];
+    threads.push_back(std::thread([this,vtxer,nGroups,&next]() {
+      for(Int_t g=next++; g<nGroups; g=next++) FitGroup(vtxer,g);
+    }));
+  }
+  for(UInt_t t=0; t<threads.size(); t++) threads[t].join();
+  for(Int_t t=1; t<nThreads; t++) delete vertexers[t];
+#endif
+}
+
+//________________________________________________________________________
+AliESDVertex* AliHypertriton3TripletFinder::TakeVertex(Int_t i){
+  //Decay vertex of triplet i, the ownership goes to the caller
+  AliESDVertex *vtx = fVertices[i];
+  fVertices[i] = 0x0;
+  return vtx;
+}
@@ -0,0 +1,91 @@
+#ifndef ALIHYPERTRITON3TRIPLETFINDER_H
+#define ALIHYPERTRITON3TRIPLETFINDER_H
+
+/* Copyright(c) 1998-2018, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice */
+
+///////////////////////////////////////////////////////////////////////////
+// AliHypertriton3TripletFinder class
+// Staged d+p+pi triplet search shared by the AliAnalysisTaskHypertriton3
+// tasks (ESD, Dev and AOD):
+//  1) the pair DCAs (helix-helix closest approach, AliExternalTrackParam::GetDCA)
+//     are computed once per pair and kept for the event
+//  2) the triplets whose pair DCAs (or kinematic bounds) fail the cuts are
+//     rejected by the task before any vertexing
+//  3) the decay vertex is fitted only for the surviving triplets, optionally
+//     on several threads, one deuteron candidate at a time (only if the ROOT
+//     thread safety was enabled in the steering macro)
+// The tasks then apply the topological cuts to the survivors in the same
+// order as they were added, so the selected candidates and the output do not
+// depend on the number of threads.
+///////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include <TObject.h>
+
+class AliESDVertex;
+class AliExternalTrackParam;
+class AliVertexerTracks;
+
+class AliHypertriton3TripletFinder : public TObject {
+
+ public:
+  AliHypertriton3TripletFinder();
+  virtual ~AliHypertriton3TripletFinder();
+
+  void SetNThreads(Int_t n) {fNThreads = (n>0 ? n : 1);}
+  Int_t GetNThreads() const {return fNThreads;}
+
+  // candidates of the current combination, the tracks are not owned
+  void Reset(Double_t bz, Int_t nD, Int_t nP, Int_t nPi);
+  void SetDeuteron(Int_t j, const AliExternalTrackParam *trk) {fDeuterons[j] = trk;}
+  void SetProton(Int_t m, const AliExternalTrackParam *trk) {fProtons[m] = trk;}
+  void SetPion(Int_t s, const AliExternalTrackParam *trk) {fPions[s] = trk;}
+
+  // pair DCAs, same calls (and track order) as in the tasks
+  Double_t GetDCAdp(Int_t j, Int_t m);
+  Double_t GetDCAdpi(Int_t j, Int_t s);
+  Double_t GetDCAppi(Int_t m, Int_t s);
+
+  // bounds which do not change along the helices (no material correction)
+  Double_t GetMinMass(Int_t j, Int_t m, Int_t s, Double_t massD, Double_t massP, Double_t massPi) const;
+  Double_t GetMaxPt(Int_t j, Int_t m, Int_t s) const;
+
+  // survivors and their decay vertices
+  Int_t AddTriplet(Int_t j, Int_t m, Int_t s);
+  void SetVtxStart(AliESDVertex *vtx) {fVtxStart = vtx;}
+  void SetVtxStart(Double_t x, Double_t y, Double_t z) {fVtxStart = 0x0; fVtxStartXYZ[0] = x; fVtxStartXYZ[1] = y; fVtxStartXYZ[2] = z;}
+  void FitVertices(AliVertexerTracks *vertexer);
+
+  Int_t GetNTriplets() const {return fTriplets.size()/3;}
+  Int_t GetDeuteron(Int_t i) const {return fTriplets[3*i];}
+  Int_t GetProton(Int_t i) const {return fTriplets[3*i+1];}
+  Int_t GetPion(Int_t i) const {return fTriplets[3*i+2];}
+  AliESDVertex* TakeVertex(Int_t i); // the caller owns the vertex
+
+ private:
+  void FitGroup(AliVertexerTracks *vertexer, Int_t group);
+  void ClearVertices();
+
+  Int_t                                fNThreads;       ///< number of threads for the vertex fits
+  Double_t                             fBz;             //!<! magnetic field (kG)
+  std::vector<const AliExternalTrackParam*> fDeuterons; //!<! deuteron candidates
+  std::vector<const AliExternalTrackParam*> fProtons;   //!<! proton candidates
+  std::vector<const AliExternalTrackParam*> fPions;     //!<! pion candidates
+  std::vector<Double_t>                fDCAdp;          //!<! [j*nP+m], <0 not computed yet
+  std::vector<Double_t>                fDCAdpi;         //!<! [j*nPi+s], <0 not computed yet
+  std::vector<Double_t>                fDCAppi;         //!<! [m*nPi+s], <0 not computed yet
+  std::vector<Int_t>                   fTriplets;       //!<! (j,m,s) of the survivors
+  std::vector<Int_t>                   fGroupFirst;     //!<! first survivor of each deuteron candidate
+  std::vector<AliESDVertex*>           fVertices;       //!<! decay vertex of each survivor
+  AliESDVertex                        *fVtxStart;       //!<! start vertex of the fit, if given as vertex
+  Double_t                             fVtxStartXYZ[3]; //!<! start position of the fit otherwise
+
+  AliHypertriton3TripletFinder(const AliHypertriton3TripletFinder&);
+  AliHypertriton3TripletFinder& operator=(const AliHypertriton3TripletFinder&);
+
+  ClassDef(AliHypertriton3TripletFinder, 1);
+};
+
+#endif
@@ -77,6 +77,7 @@
 #pragma link C++ class AliAnalysisTaskHypertriton3+;
 #pragma link C++ class AliAnalysisTaskHypertriton3Dev+;
 #pragma link C++ class AliAnalysisTaskHypertriton3AOD+;
+#pragma link C++ class AliHypertriton3TripletFinder+;
 
 /// Utils
 /// * RecoDecay
@@ -105,7 +105,15 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask() :
    fRsnTreeInFile(kFALSE),
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fUseEventIndex(kTRUE),
+   fMixCacheSize(0),
+   fOnlineMix(kFALSE),
+   fEvIndex(),
+   fMixCache(),
+   fMixCacheIndex(),
+   fMixPools(),
+   fMixPoolKeys()
 {
 //
 // Dummy constructor ALWAYS needed for I/O.
@@ -166,7 +174,15 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const char *name, Bool_t useMC,Bo
    fRsnTreeInFile(saveRsnTreeInFile),
    fComputeSpherocity(kFALSE),
    fSpherocity(-10),
-   fResonanceFinders(0)
+   fResonanceFinders(0),
+   fUseEventIndex(kTRUE),
+   fMixCacheSize(0),
+   fOnlineMix(kFALSE),
+   fEvIndex(),
+   fMixCache(),
+   fMixCacheIndex(),
+   fMixPools(),
+   fMixPoolKeys()
 {
 //
 // Default constructor.
@@ -233,7 +249,15 @@ AliRsnMiniAnalysisTask::AliRsnMiniAnalysisTask(const AliRsnMiniAnalysisTask &cop
    fRsnTreeInFile(copy.fRsnTreeInFile),
    fComputeSpherocity(copy.fComputeSpherocity),
    fSpherocity(copy.fSpherocity),
-   fResonanceFinders(copy.fResonanceFinders)
+   fResonanceFinders(copy.fResonanceFinders),
+   fUseEventIndex(copy.fUseEventIndex),
+   fMixCacheSize(copy.fMixCacheSize),
+   fOnlineMix(copy.fOnlineMix),
+   fEvIndex(),
+   fMixCache(),
+   fMixCacheIndex(),
+   fMixPools(),
+   fMixPoolKeys()
 {
 //
 // Copy constructor.
@@ -302,6 +326,9 @@ AliRsnMiniAnalysisTask &AliRsnMiniAnalysisTask::operator=(const AliRsnMiniAnalys
    fComputeSpherocity = copy.fComputeSpherocity;
    fSpherocity = copy.fSpherocity;
    fResonanceFinders = copy.fResonanceFinders;
+   fUseEventIndex = copy.fUseEventIndex;
+   fMixCacheSize = copy.fMixCacheSize;
+   fOnlineMix = copy.fOnlineMix;
 
    return (*this);
 }
@@ -318,6 +345,8 @@ AliRsnMiniAnalysisTask::~AliRsnMiniAnalysisTask()
       delete fOutput;
       delete fEvBuffer;
    }
+   ClearMixCache();
+   ClearMixPools();
 }
 
 //__________________________________________________________________________________________________
@@ -436,6 +465,8 @@ void AliRsnMiniAnalysisTask::UserCreateOutputObjects()
    fEvBuffer = new TTree("EventBuffer", "Temporary buffer for mini events");
    fMiniEvent = new AliRsnMiniEvent();
    fEvBuffer->Branch("events", "AliRsnMiniEvent", &fMiniEvent);
+   fEvIndex.Reset();
+   fEvIndex.SetMatching(fContinuousMix, fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle);
    
    // create one histogram per each stored definition (event histograms)
    Int_t i, ndef = fHistograms.GetEntries();
@@ -500,7 +531,12 @@ void AliRsnMiniAnalysisTask::UserExec(Option_t *)
       Int_t id = fEvBuffer->GetEntries();
       AliDebugClass(2, Form("Adding event #%d with ID = %d", fEvNum, id));
       fMiniEvent->ID() = id;
+      if (fOnlineMix && fNMix > 0) MixOnline(fMiniEvent);
       fEvBuffer->Fill();
+      if (fUseEventIndex && fEvIndex.Add(fMiniEvent->Vz(), fMiniEvent->Mult(), fMiniEvent->Angle()) != id) {
+         AliWarning("Event index out of sync with the mini-event buffer, it will not be used");
+         fUseEventIndex = kFALSE;
+      }
    }
 
    // post data for computed stuff
@@ -585,7 +621,13 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       }
    }
 
-   // if no mixing is required, stop here and post the output
+   // if no mixing is required, or it was already done online, stop here and post the output
+   if (fOnlineMix && fNMix >= 1) {
+      AliDebugClass(2, "Stopping here, since mixing was done online");
+      ClearMixPools();
+      PostData(1, fOutput);
+      return;
+   }
    if (fNMix < 1) {
       AliDebugClass(2, "Stopping here, since no mixing is required");
       PostData(1, fOutput);
@@ -604,13 +646,33 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
-   // search for good matchings
+   // search for good matchings:
+   // with the event index, candidates come from a range lookup in the
+   // (vz, mult, angle) index and no buffer entry needs to be read;
+   // they are returned in the same order as the full scan below
+   Bool_t useIndex = fUseEventIndex && (fEvIndex.GetEntries() == nEvents);
+   if (fUseEventIndex && !useIndex) AliWarning("Event index not available, scanning the whole buffer for mixing partners");
+   std::vector<Int_t> candidates;
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       if (nmatched[ievt] >= fNMix) continue;
+      if (useIndex) {
+         fEvIndex.FindCandidates(ievt, candidates);
+         for (size_t icand = 0; icand < candidates.size(); icand++) {
+            imix = candidates[icand];
+            if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
+            if (nmatched[imix] >= fNMix) continue;
+            smatched[ievt].Append(Form("%d|", imix));
+            nmatched[ievt]++;
+            nmatched[imix]++;
+            if (nmatched[ievt] >= fNMix) break;
+         }
+         AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", ievt, nmatched[ievt], smatched[ievt].Data()));
+         continue;
+      }
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
       for (iloop = 1; iloop < nEvents; iloop++) {
@@ -646,28 +708,19 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
       ifill = 0;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
+      if (smatched[ievt].Length() < 2) continue;
+      AliRsnMiniEvent evMain(*GetMixEvent(ievt));
       list = smatched[ievt].Tokenize("|");
       TObjArrayIter next(list);
       while ( (os = (TObjString *)next()) ) {
          imix = os->GetString().Atoi();
-         fEvBuffer->GetEntry(imix);
-         for (idef = 0; idef < nDefs; idef++) {
-            def = (AliRsnMiniOutput *)fHistograms[idef];
-            if (!def) continue;
-            if (!def->IsTrackPairMix()) continue;
-            ifill += def->FillPair(&evMain, fMiniEvent, &fValues, kTRUE);
-            if (!def->IsSymmetric()) {
-               AliDebugClass(2, "Reflecting non symmetric pair");
-               ifill += def->FillPair(fMiniEvent, &evMain, &fValues, kFALSE);
-            }
-         }
+         ifill += FillMixedPairs(&evMain, GetMixEvent(imix));
       }
       delete list;
    }
 
    delete [] smatched;
+   ClearMixCache();
 
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
@@ -1586,6 +1639,139 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniAnalysisTask::FillMixedPairs(AliRsnMiniEvent *evMain, AliRsnMiniEvent *evMix)
+{
+//
+// Fill all mixing outputs with the pairs formed by two matched events.
+// Returns the number of fills.
+//
+
+   if (!evMain || !evMix) return 0;
+   Int_t idef, nDefs = fHistograms.GetEntries(), ifill = 0;
+   AliRsnMiniOutput *def = 0x0;
+   for (idef = 0; idef < nDefs; idef++) {
+      def = (AliRsnMiniOutput *)fHistograms[idef];
+      if (!def) continue;
+      if (!def->IsTrackPairMix()) continue;
+      ifill += def->FillPair(evMain, evMix, &fValues, kTRUE);
+      if (!def->IsSymmetric()) {
+         AliDebugClass(2, "Reflecting non symmetric pair");
+         ifill += def->FillPair(evMix, evMain, &fValues, kFALSE);
+      }
+   }
+   return ifill;
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEvent *AliRsnMiniAnalysisTask::GetMixEvent(Int_t ientry)
+{
+//
+// Return the mini-event stored at entry 'ientry' of the buffer.
+// If the mixing cache is enabled, the last fMixCacheSize events read
+// are kept deserialized (least recently used are dropped first), so that
+// partners shared by neighbouring events in the same mixing bin
+// are not read again from the buffer.
+// Without cache, the returned pointer is the buffer cursor and
+// is valid only until the next read.
+//
+
+   if (fMixCacheSize <= 0) {
+      fEvBuffer->GetEntry(ientry);
+      return fMiniEvent;
+   }
+
+   std::map<Int_t, std::list<std::pair<Int_t, AliRsnMiniEvent*> >::iterator>::iterator found = fMixCacheIndex.find(ientry);
+   if (found != fMixCacheIndex.end()) {
+      // splice keeps the iterators valid
+      if (found->second != fMixCache.begin()) fMixCache.splice(fMixCache.begin(), fMixCache, found->second);
+      return fMixCache.front().second;
+   }
+
+   fEvBuffer->GetEntry(ientry);
+   AliRsnMiniEvent *event = 0x0;
+   if ((Int_t)fMixCache.size() >= fMixCacheSize) {
+      // recycle the least recently used slot
+      event = fMixCache.back().second;
+      fMixCacheIndex.erase(fMixCache.back().first);
+      fMixCache.pop_back();
+      *event = *fMiniEvent;
+   } else {
+      event = new AliRsnMiniEvent(*fMiniEvent);
+   }
+   fMixCache.push_front(std::make_pair(ientry, event));
+   fMixCacheIndex[ientry] = fMixCache.begin();
+   return event;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::ClearMixCache()
+{
+//
+// Delete all the events of the mixing cache
+//
+
+   std::list<std::pair<Int_t, AliRsnMiniEvent*> >::iterator it;
+   for (it = fMixCache.begin(); it != fMixCache.end(); ++it) delete it->second;
+   fMixCache.clear();
+   fMixCacheIndex.clear();
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::MixOnline(AliRsnMiniEvent *event)
+{
+//
+// Online mixing: the event is mixed with at most fNMix stored events
+// accepted by EventsMatch, and is then added to the pool of its
+// (vz, mult, angle) bin. Each pool keeps at most fNMix events,
+// the oldest being dropped first.
+// In binned mode the partners are in the pool of the event bin;
+// in continuous mode the bins are as wide as the max differences,
+// so the partners are searched in the event bin and in the adjacent ones.
+//
+
+   Long64_t key = fEvIndex.BinKey(event->Vz(), event->Mult(), event->Angle());
+   if (fContinuousMix) fEvIndex.NeighbourKeys(event->Vz(), event->Mult(), event->Angle(), fMixPoolKeys);
+   else fMixPoolKeys.assign(1, key);
+
+   Int_t ifill = 0, nmix = 0;
+   for (size_t ikey = 0; ikey < fMixPoolKeys.size() && nmix < fNMix; ikey++) {
+      std::map<Long64_t, std::deque<AliRsnMiniEvent*> >::iterator found = fMixPools.find(fMixPoolKeys[ikey]);
+      if (found == fMixPools.end()) continue;
+      std::deque<AliRsnMiniEvent*> &candidates = found->second;
+      for (size_t i = 0; i < candidates.size() && nmix < fNMix; i++) {
+         if (!EventsMatch(event, candidates[i])) continue;
+         ifill += FillMixedPairs(event, candidates[i]);
+         nmix++;
+      }
+   }
+   AliDebugClass(1, Form("Event %6d: online mixing with %d pool events -- fills = %5d", event->ID(), nmix, ifill));
+
+   std::deque<AliRsnMiniEvent*> &pool = fMixPools[key];
+   if ((Int_t)pool.size() >= fNMix) {
+      AliRsnMiniEvent *oldest = pool.front();
+      pool.pop_front();
+      *oldest = *event;
+      pool.push_back(oldest);
+   } else {
+      pool.push_back(new AliRsnMiniEvent(*event));
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::ClearMixPools()
+{
+//
+// Delete all the events of the online mixing pools
+//
+
+   std::map<Long64_t, std::deque<AliRsnMiniEvent*> >::iterator it;
+   for (it = fMixPools.begin(); it != fMixPools.end(); ++it) {
+      for (size_t i = 0; i < it->second.size(); i++) delete it->second[i];
+   }
+   fMixPools.clear();
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -12,6 +12,11 @@
 // Developers: F. Bellini (fbellini@cern.ch)
 //
 
+#include <map>
+#include <list>
+#include <deque>
+#include <vector>
+
 #include <TString.h>
 #include <TClonesArray.h>
 
@@ -23,6 +28,7 @@
 #include "AliRsnCutEventUtils.h"
 #include "AliRsnCutPrimaryVertex.h"
 #include "AliRsnMiniResonanceFinder.h"
+#include "AliRsnMiniEventIndex.h"
 
 #include "AliESDtrackCuts.h"
 
@@ -62,6 +68,9 @@ public:
    void                SetMaxDiffAngle(Double_t val)      {fMaxDiffAngle = val;}
    void                SetEventCuts(AliRsnCutSet *cuts)   {fEventCuts    = cuts;}
    void                SetMixPrintRefresh(Int_t n)        {fMixPrintRefresh = n;}
+   void                SetUseEventIndex(Bool_t yn = kTRUE) {fUseEventIndex = yn;}
+   void                SetMixCacheSize(Int_t n)           {fMixCacheSize = n;}
+   void                SetOnlineMix(Bool_t yn = kTRUE)    {fOnlineMix = yn;}
    void                SetCheckDecay(Bool_t checkDecay = kTRUE) {fCheckDecay = checkDecay;}
    void                SetMaxNDaughters(Short_t n)        {fMaxNDaughters = n;}
    void                SetCheckMomentumConservation(Bool_t checkP) {fCheckP = checkP;}
@@ -110,6 +119,11 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Int_t    FillMixedPairs(AliRsnMiniEvent *evMain, AliRsnMiniEvent *evMix);
+   AliRsnMiniEvent *GetMixEvent(Int_t ientry);
+   void     ClearMixCache();
+   void     MixOnline(AliRsnMiniEvent *event);
+   void     ClearMixPools();
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -171,7 +185,16 @@ private:
    Double_t             fSpherocity; // stores value of spherocity
    TObjArray            fResonanceFinders; // list of AliRsnMiniResonanceFinder objects
 
-   ClassDef(AliRsnMiniAnalysisTask, 18);   // AliRsnMiniAnalysisTask
+   Bool_t               fUseEventIndex;   //  mixing --> find partners through the (vz, mult, angle) index instead of scanning the buffer
+   Int_t                fMixCacheSize;    //  mixing --> number of mini-events kept deserialized in the LRU window (0 = off)
+   Bool_t               fOnlineMix;       //  mixing --> mix in UserExec with bounded pools of fNMix events per bin, instead of in FinishTaskOutput
+   AliRsnMiniEventIndex fEvIndex;         //! index of the events stored in fEvBuffer
+   std::list<std::pair<Int_t, AliRsnMiniEvent*> > fMixCache;   //! LRU window of buffer entries, most recent first
+   std::map<Int_t, std::list<std::pair<Int_t, AliRsnMiniEvent*> >::iterator> fMixCacheIndex; //! buffer entry -> its place in fMixCache
+   std::map<Long64_t, std::deque<AliRsnMiniEvent*> > fMixPools; //! online mixing pools, per mixing bin
+   std::vector<Long64_t> fMixPoolKeys;    //! online mixing: keys of the pools searched for the current event
+
+   ClassDef(AliRsnMiniAnalysisTask, 19);   // AliRsnMiniAnalysisTask
 };
 
 
@@ -0,0 +1,253 @@
+//
+// Index of the mini-events stored in the buffer of AliRsnMiniAnalysisTask,
+// keyed by (vz, multiplicity, event-plane angle).
+//
+// The partner search reproduces exactly the result of scanning
+// the buffer with AliRsnMiniAnalysisTask::EventsMatch: candidates are
+// returned in the same order as such a scan, i.e. starting from the
+// event following the main one and wrapping around at the end of the buffer.
+//
+
+#include <algorithm>
+
+#include <TMath.h>
+
+#include "AliRsnMiniEventIndex.h"
+
+ClassImp(AliRsnMiniEventIndex)
+
+//__________________________________________________________________________________________________
+AliRsnMiniEventIndex::AliRsnMiniEventIndex() :
+   TObject(),
+   fContinuous(kFALSE),
+   fMaxDiffVz(1.0),
+   fMaxDiffMult(10.0),
+   fMaxDiffAngle(1E20),
+   fVz(),
+   fMult(),
+   fAngle(),
+   fBuilt(kFALSE),
+   fBins(),
+   fByMult()
+{
+//
+// Default constructor
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEventIndex::AliRsnMiniEventIndex(const AliRsnMiniEventIndex &copy) :
+   TObject(copy),
+   fContinuous(copy.fContinuous),
+   fMaxDiffVz(copy.fMaxDiffVz),
+   fMaxDiffMult(copy.fMaxDiffMult),
+   fMaxDiffAngle(copy.fMaxDiffAngle),
+   fVz(copy.fVz),
+   fMult(copy.fMult),
+   fAngle(copy.fAngle),
+   fBuilt(kFALSE),
+   fBins(),
+   fByMult()
+{
+//
+// Copy constructor
+//
+}
+
+//__________________________________________________________________________________________________
+AliRsnMiniEventIndex &AliRsnMiniEventIndex::operator=(const AliRsnMiniEventIndex &copy)
+{
+//
+// Assignment operator
+//
+   if (this == &copy)
+      return *this;
+   TObject::operator=(copy);
+   fContinuous = copy.fContinuous;
+   fMaxDiffVz = copy.fMaxDiffVz;
+   fMaxDiffMult = copy.fMaxDiffMult;
+   fMaxDiffAngle = copy.fMaxDiffAngle;
+   fVz = copy.fVz;
+   fMult = copy.fMult;
+   fAngle = copy.fAngle;
+   fBuilt = kFALSE;
+   fBins.clear();
+   fByMult.clear();
+
+   return (*this);
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniEventIndex::SetMatching(Bool_t continuous, Double_t maxDiffVz, Double_t maxDiffMult, Double_t maxDiffAngle)
+{
+//
+// Define the matching criterion, same meaning as in AliRsnMiniAnalysisTask
+//
+   fContinuous = continuous;
+   fMaxDiffVz = maxDiffVz;
+   fMaxDiffMult = maxDiffMult;
+   fMaxDiffAngle = maxDiffAngle;
+   fBuilt = kFALSE;
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniEventIndex::Reset()
+{
+//
+// Remove all the indexed events
+//
+   fVz.clear();
+   fMult.clear();
+   fAngle.clear();
+   fBins.clear();
+   fByMult.clear();
+   fBuilt = kFALSE;
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniEventIndex::Add(Float_t vz, Float_t mult, Float_t angle)
+{
+//
+// Index a new event, and return its ID,
+// which corresponds to its entry in the mini-event buffer
+//
+   Int_t id = (Int_t)fVz.size();
+   fVz.push_back(vz);
+   fMult.push_back(mult);
+   fAngle.push_back(angle);
+   if (fBuilt) {
+      // keep sorted structures up to date
+      if (fContinuous) {
+         std::pair<Float_t, Int_t> item(mult, id);
+         fByMult.insert(std::upper_bound(fByMult.begin(), fByMult.end(), item), item);
+      } else {
+         fBins[BinKey(vz, mult, angle)].push_back(id);
+      }
+   }
+   return id;
+}
+
+//__________________________________________________________________________________________________
+Long64_t AliRsnMiniEventIndex::BinKey(Float_t vz, Float_t mult, Float_t angle) const
+{
+//
+// Pack the mixing bin of an event into one key (binned mixing only).
+// Bin numbers are computed as in AliRsnMiniAnalysisTask::EventsMatch
+// and are folded into 21 bits each; events sharing a key are still
+// checked with Match().
+//
+   return BinKey((Int_t)(vz / fMaxDiffVz), (Int_t)(mult / fMaxDiffMult), (Int_t)(angle / fMaxDiffAngle));
+}
+
+//__________________________________________________________________________________________________
+Long64_t AliRsnMiniEventIndex::BinKey(Int_t ivz, Int_t imult, Int_t iangle) const
+{
+//
+// Pack the given bin numbers into one key
+//
+   const Long64_t mask = (1 << 21) - 1, offset = 1 << 20;
+   return ((((Long64_t)ivz + offset) & mask) << 42) | ((((Long64_t)imult + offset) & mask) << 21) | (((Long64_t)iangle + offset) & mask);
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniEventIndex::NeighbourKeys(Float_t vz, Float_t mult, Float_t angle, std::vector<Long64_t> &keys) const
+{
+//
+// Keys of the bin of the event and of all the adjacent bins (3x3x3),
+// the own bin coming first.
+// With bins as wide as the max differences, any event within the max
+// differences of the given one (continuous mixing) is in one of them.
+//
+   Int_t ivz = (Int_t)(vz / fMaxDiffVz);
+   Int_t imult = (Int_t)(mult / fMaxDiffMult);
+   Int_t iangle = (Int_t)(angle / fMaxDiffAngle);
+   keys.clear();
+   keys.push_back(BinKey(ivz, imult, iangle));
+   for (Int_t dvz = -1; dvz <= 1; dvz++)
+      for (Int_t dmult = -1; dmult <= 1; dmult++)
+         for (Int_t dangle = -1; dangle <= 1; dangle++)
+            if (dvz || dmult || dangle) keys.push_back(BinKey(ivz + dvz, imult + dmult, iangle + dangle));
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniEventIndex::Build()
+{
+//
+// Build the sorted lookup structures from the indexed events
+//
+   fBins.clear();
+   fByMult.clear();
+   Int_t n = GetEntries();
+   if (fContinuous) {
+      fByMult.reserve(n);
+      for (Int_t i = 0; i < n; i++) fByMult.push_back(std::make_pair(fMult[i], i));
+      std::sort(fByMult.begin(), fByMult.end());
+   } else {
+      for (Int_t i = 0; i < n; i++) fBins[BinKey(fVz[i], fMult[i], fAngle[i])].push_back(i);
+   }
+   fBuilt = kTRUE;
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniEventIndex::Match(Int_t ievt, Int_t jevt) const
+{
+//
+// Same criterion as AliRsnMiniAnalysisTask::EventsMatch
+//
+   if (fContinuous) {
+      if (TMath::Abs(fVz[ievt] - fVz[jevt]) > fMaxDiffVz) return kFALSE;
+      if (TMath::Abs(fMult[ievt] - fMult[jevt]) > fMaxDiffMult) return kFALSE;
+      if (TMath::Abs(fAngle[ievt] - fAngle[jevt]) > fMaxDiffAngle) return kFALSE;
+      return kTRUE;
+   }
+   if ((Int_t)(fVz[ievt] / fMaxDiffVz) != (Int_t)(fVz[jevt] / fMaxDiffVz)) return kFALSE;
+   if ((Int_t)(fMult[ievt] / fMaxDiffMult) != (Int_t)(fMult[jevt] / fMaxDiffMult)) return kFALSE;
+   if ((Int_t)(fAngle[ievt] / fMaxDiffAngle) != (Int_t)(fAngle[jevt] / fMaxDiffAngle)) return kFALSE;
+   return kTRUE;
+}
+
+//__________________________________________________________________________________________________
+Int_t AliRsnMiniEventIndex::FindCandidates(Int_t ievt, std::vector<Int_t> &out)
+{
+//
+// Fill 'out' with all events matching event 'ievt', ordered
+// as ievt+1, ievt+2, ..., N-1, 0, ..., ievt-1.
+// Returns the number of candidates.
+//
+   out.clear();
+   Int_t n = GetEntries();
+   if (ievt < 0 || ievt >= n) return 0;
+   if (!fBuilt) Build();
+
+   if (fContinuous) {
+      // the margin protects against rounding in the float/double comparison,
+      // the exact criterion is applied afterwards
+      Float_t lo = fMult[ievt] - fMaxDiffMult - 1E-3 * TMath::Max(1.0, fMaxDiffMult);
+      Float_t hi = fMult[ievt] + fMaxDiffMult + 1E-3 * TMath::Max(1.0, fMaxDiffMult);
+      std::vector<std::pair<Float_t, Int_t> >::const_iterator it, end;
+      it = std::lower_bound(fByMult.begin(), fByMult.end(), std::make_pair(lo, -1));
+      end = std::upper_bound(fByMult.begin(), fByMult.end(), std::make_pair(hi, n));
+      for (; it != end; ++it) {
+         Int_t j = it->second;
+         if (j != ievt && Match(ievt, j)) out.push_back(j);
+      }
+      // restore the scan order of the buffer, wrapping around at the end
+      std::vector<Int_t> after, before;
+      for (size_t k = 0; k < out.size(); k++) (out[k] > ievt ? after : before).push_back(out[k]);
+      std::sort(after.begin(), after.end());
+      std::sort(before.begin(), before.end());
+      out.swap(after);
+      out.insert(out.end(), before.begin(), before.end());
+   } else {
+      std::map<Long64_t, std::vector<Int_t> >::const_iterator bin = fBins.find(BinKey(fVz[ievt], fMult[ievt], fAngle[ievt]));
+      if (bin == fBins.end()) return 0;
+      const std::vector<Int_t> &ids = bin->second;
+      std::vector<Int_t>::const_iterator split = std::upper_bound(ids.begin(), ids.end(), ievt);
+      for (std::vector<Int_t>::const_iterator it = split; it != ids.end(); ++it)
+         if (Match(ievt, *it)) out.push_back(*it);
+      for (std::vector<Int_t>::const_iterator it = ids.begin(); it != split; ++it)
+         if (*it != ievt && Match(ievt, *it)) out.push_back(*it);
+   }
+
+   return (Int_t)out.size();
+}
@@ -0,0 +1,56 @@
+#ifndef ALIRSNMINIEVENTINDEX_H
+#define ALIRSNMINIEVENTINDEX_H
+
+//
+// Index of the mini-events stored in the buffer of AliRsnMiniAnalysisTask,
+// keyed by (vz, multiplicity, event-plane angle).
+// It is filled while the mini-events are produced, and is used to find
+// event-mixing partners with a range lookup instead of reading back
+// and comparing all the events stored in the buffer.
+//
+
+#include <map>
+#include <vector>
+
+#include <TObject.h>
+
+class AliRsnMiniEventIndex : public TObject {
+public:
+
+   AliRsnMiniEventIndex();
+   AliRsnMiniEventIndex(const AliRsnMiniEventIndex &copy);
+   AliRsnMiniEventIndex &operator=(const AliRsnMiniEventIndex &copy);
+   virtual ~AliRsnMiniEventIndex() {}
+
+   void     SetMatching(Bool_t continuous, Double_t maxDiffVz, Double_t maxDiffMult, Double_t maxDiffAngle);
+   void     Reset();
+   Int_t    Add(Float_t vz, Float_t mult, Float_t angle);
+   Int_t    GetEntries() const {return (Int_t)fVz.size();}
+
+   Bool_t   Match(Int_t ievt, Int_t jevt) const;
+   Int_t    FindCandidates(Int_t ievt, std::vector<Int_t> &out);
+   Long64_t BinKey(Float_t vz, Float_t mult, Float_t angle) const;
+   Long64_t BinKey(Int_t ivz, Int_t imult, Int_t iangle) const;
+   void     NeighbourKeys(Float_t vz, Float_t mult, Float_t angle, std::vector<Long64_t> &keys) const;
+
+private:
+
+   void     Build();
+
+   Bool_t                fContinuous;    //  mixing technique (continuous or binned)
+   Double_t              fMaxDiffVz;     //  max difference (or bin width) in Vz
+   Double_t              fMaxDiffMult;   //  max difference (or bin width) in multiplicity
+   Double_t              fMaxDiffAngle;  //  max difference (or bin width) in angle
+
+   std::vector<Float_t>  fVz;            //! vertex z of each stored event
+   std::vector<Float_t>  fMult;          //! multiplicity of each stored event
+   std::vector<Float_t>  fAngle;         //! event-plane angle of each stored event
+
+   Bool_t                                  fBuilt;   //! sorted structures are up to date
+   std::map<Long64_t, std::vector<Int_t> > fBins;    //! binned mode: event IDs per bin, ascending
+   std::vector<std::pair<Float_t, Int_t> > fByMult;  //! continuous mode: (mult, ID) sorted by mult
+
+   ClassDef(AliRsnMiniEventIndex, 1);   // AliRsnMiniEventIndex
+};
+
+#endif
@@ -65,6 +65,7 @@
 #pragma link C++ class AliRsnMiniPair+;
 #pragma link C++ class AliRsnCutMiniPair+;
 #pragma link C++ class AliRsnMiniEvent+;
+#pragma link C++ class AliRsnMiniEventIndex+;
 #pragma link C++ class AliRsnMiniAxis+;
 #pragma link C++ class AliRsnMiniOutput+;
 #pragma link C++ class AliRsnMiniValue+;
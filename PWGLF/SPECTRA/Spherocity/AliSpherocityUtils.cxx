@@ -41,6 +41,7 @@
 #include "AliVEvent.h"
 #include <TMatrixDSym.h>
 #include <TMath.h>
+#include "AliEventShapeCalculator.h"
 #include <TParticlePDG.h>
 #include <TParticle.h>
 #include "AliESDUtils.h"
@@ -366,40 +367,17 @@ Float_t AliSpherocityUtils::AnalyseGetSpherocity( const vector<Float_t> &pt, con
 
 
 	Float_t spherocity = -10.0;
-	Float_t pFull = 0;
-	Float_t Spherocity = 2;
 
-	//computing total pt
-	Float_t sumapt = 0;
+	AliEventShapeCalculator shape;
 	for(Int_t i1 = 0; i1 < fNrec; ++i1){
-		sumapt += pt[i1];
-
-	}
-
-	//Getting thrust
-	for(Int_t i = 0; i < 360/(fSizeStep); ++i){
-		Float_t numerador = 0;
-		Float_t phiparam  = 0;
-		Float_t nx = 0;
-		Float_t ny = 0;
-		phiparam=( (TMath::Pi()) * i * fSizeStep ) / 180; // parametrization of the angle
-		nx = TMath::Cos(phiparam);            // x component of an unitary vector n
-		ny = TMath::Sin(phiparam);            // y component of an unitary vector n
-		for(Int_t i1 = 0; i1 < fNrec; ++i1){
-
-			Float_t pxA = pt[i1] * TMath::Cos( phi[i1] );
-			Float_t pyA = pt[i1] * TMath::Sin( phi[i1] );
-
-			numerador += TMath::Abs( ny * pxA - nx * pyA );//product between p  proyection in XY plane and the unitary vector
-		}
-		pFull=TMath::Power( (numerador / sumapt),2 );
-		if(pFull < Spherocity)//maximization of pFull
-		{
-			Spherocity = pFull;
-		}
+		shape.AddParticlePtPhi( pt[i1], phi[i1] );
 	}
 
-	spherocity=((Spherocity)*TMath::Pi()*TMath::Pi())/4.0;
+	//step size > 0: scan of the axis in steps of fSizeStep degrees, otherwise exact minimisation
+	if(fSizeStep > 0)
+		spherocity = shape.GetSpherocityGrid( fSizeStep, AliEventShapeCalculator::kFloat );
+	else
+		spherocity = shape.GetSpherocity();
 
 
 	return spherocity;
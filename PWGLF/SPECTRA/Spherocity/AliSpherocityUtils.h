@@ -38,7 +38,7 @@ class AliSpherocityUtils : public TObject {
   void  SetAODTrackFilter(Int_t aodtrackF) {fAODFilterGlobal = aodtrackF;}
 
   void  SetMinMult(Int_t minnch)        {fMinMult    = minnch;}
-  void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;}
+  void  SetStepSize(Float_t sizestep)   {fSizeStep   = sizestep;} // degrees, <= 0: exact spherocity
   void  SetIsEtaAbs(Bool_t isabseta)    {fIsAbsEta   = isabseta;}
   void  SetTrackEtaMin(Float_t etaminF) {fEtaMinCut  = etaminF;}
   void  SetTrackEtaMax(Float_t etamaxF) {fEtaMaxCut  = etamaxF;}
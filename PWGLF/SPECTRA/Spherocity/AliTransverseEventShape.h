@@ -44,7 +44,7 @@ class AliTransverseEventShape : public TObject {
   void  SetAODTrackFilterESA(Int_t aodtrackF) {fAODFilterGlobal = aodtrackF;}
 
   void  SetMinMultForESA(Int_t minnch)     {fMinMultESA = minnch;}
-  void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;}
+  void  SetStepSizeESA(Float_t sizestep)   {fSizeStepESA = sizestep;} // degrees, <= 0: exact spherocity
   void  SetIsEtaAbsESA(Bool_t isabseta)    {fIsAbsEtaESA = isabseta;}
   void  SetTrackEtaMinESA(Float_t etaminF) {fEtaMinCutESA = etaminF;}
   void  SetTrackEtaMaxESA(Float_t etamaxF) {fEtaMaxCutESA = etamaxF;}
@@ -50,6 +50,7 @@
 #include "TFile.h"
 #include "TMatrixD.h"
 #include "TRandom3.h"
+#include "TMemFile.h"
 
 #include "AliHeader.h"  
 #include "AliGenEventHeader.h"  
@@ -81,6 +82,7 @@
 #include "AliFilteredTreeAcceptanceCuts.h"
 
 #include "AliAnalysisTaskFilteredTree.h"
+#include "AliFilteredTreeAsyncWriter.h"
 #include "AliKFParticle.h"
 #include "AliESDv0.h"
 #include "AliPID.h"
@@ -134,6 +136,11 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
   , fDummyTrack(0)
+  , fAsyncOutput(kFALSE)
+  , fAsyncQueueDepth(4)
+  , fAsyncChunkSize(0)
+  , fAsyncWriter(0)
+  , fAsyncChunk(0)
 {
   // Constructor
 
@@ -157,6 +164,7 @@ AliAnalysisTaskFilteredTree::~AliAnalysisTaskFilteredTree()
   delete fFilteredTreeAcceptanceCuts;
   delete fFilteredTreeRecAcceptanceCuts;
   delete fEsdTrackCuts;
+  delete fAsyncWriter;
 }
 
 //____________________________________________________________________________
@@ -196,16 +204,41 @@ void AliAnalysisTaskFilteredTree::UserCreateOutputObjects()
   //
   //get the output file to make sure the trees will be associated to it
   OpenFile(1);
-  fTreeSRedirector = new TTreeSRedirector();
-
   //
-  // Create trees
-  fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
-  fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
-  fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
-  fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
-  fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
-  fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  // the volume based friend downscaling (fFriendDownscaling<=0) compares the compressed sizes
+  // of the trees written so far, which are not known while the chunks wait for the writer thread
+  Double_t friendDownscaling=fFriendDownscaling;
+  TString env=gSystem->Getenv("AliAnalysisTaskFilteredTree_fFriendDownscaling");
+  if (!env.IsNull()) friendDownscaling=env.Atof();
+  if (IsAsyncOutput() && friendDownscaling<=0){
+    AliError(Form("Asynchronous output not possible with the volume based friend downscaling (fFriendDownscaling=%f), using the default output",friendDownscaling));
+    fAsyncOutput=kFALSE;
+  }
+  if (!IsAsyncOutput()) {
+    fTreeSRedirector = new TTreeSRedirector();
+
+    //
+    // Create trees
+    fV0Tree = ((*fTreeSRedirector)<<"V0s").GetTree();
+    fHighPtTree = ((*fTreeSRedirector)<<"highPt").GetTree();
+    fdEdxTree = ((*fTreeSRedirector)<<"dEdx").GetTree();
+    fLaserTree = ((*fTreeSRedirector)<<"Laser").GetTree();
+    fMCEffTree = ((*fTreeSRedirector)<<"MCEffTree").GetTree();
+    fCosmicPairsTree = ((*fTreeSRedirector)<<"CosmicPairs").GetTree();
+  }
+  else {
+    //
+    // Asynchronous output: fAsyncWriter fills trees of the same names in the
+    // output file, they replace these empty trees in the slots at the end (FinishTaskOutput)
+    fV0Tree = new TTree("V0s","V0s");
+    fHighPtTree = new TTree("highPt","highPt");
+    fdEdxTree = new TTree("dEdx","dEdx");
+    fLaserTree = new TTree("Laser","Laser");
+    fMCEffTree = new TTree("MCEffTree","MCEffTree");
+    fCosmicPairsTree = new TTree("CosmicPairs","CosmicPairs");
+    fAsyncWriter = new AliFilteredTreeAsyncWriter(gDirectory,fAsyncQueueDepth);
+    OpenAsyncChunk();
+  }
 
   if (!fDummyTrack)  {
     fDummyTrack=new AliESDtrack();
@@ -377,6 +410,7 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     //ProcessMC();  //TODO - enable MC detailed view switch after holidays
   }
   if (fProcessITSTPCmatchOut) ProcessITSTPCmatchOut(fESD, fESDfriend);
+  if (fAsyncWriter && AliFilteredTreeAsyncWriter::GetChunkSize(fAsyncChunk)>fAsyncChunkSize) FlushAsyncChunk(kFALSE);
   printf("processed event %d\n", Int_t(Entry()));
 }
 
@@ -2558,6 +2592,19 @@ void AliAnalysisTaskFilteredTree::FinishTaskOutput()
   // Called one at the end 
   // locally on working node
   //
+  if (fAsyncWriter) {
+    // hand over the last chunk, wait for the writer thread 
+    // and post the filled trees to the output slots
+    FlushAsyncChunk(kTRUE);
+    fAsyncWriter->Stop();
+    PostAsyncTree(1,fV0Tree);
+    PostAsyncTree(2,fHighPtTree);
+    PostAsyncTree(3,fdEdxTree);
+    PostAsyncTree(4,fLaserTree);
+    PostAsyncTree(5,fMCEffTree);
+    PostAsyncTree(6,fCosmicPairsTree);
+    return;
+  }
   Bool_t deleteTrees=kTRUE;
   if ((AliAnalysisManager::GetAnalysisManager()))
   {
@@ -2575,6 +2622,72 @@ void AliAnalysisTaskFilteredTree::Terminate(Option_t *)
   //
   // Called one at the end 
   //
+  if (fAsyncWriter) {
+    fAsyncWriter->Stop();
+    fAsyncWriter->Print();
+  }
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::SetAsyncOutput(Bool_t async, Int_t queueDepth, Double_t chunkSizeMB)
+{
+  //
+  // Enable the asynchronous output
+  // Entries are filled into uncompressed in-memory chunks of chunkSizeMB; 
+  // compression and writing of the chunks to the trees of the output file
+  // is done by a background thread (at most queueDepth chunks wait for it).
+  // The output file has the same trees, names and content as in the default output.
+  // The background thread is only used if the steering macro enabled the 
+  // thread safety of ROOT (ROOT::EnableThreadSafety()), otherwise the chunks
+  // are written synchronously.
+  // Requires the random friend downscaling (fFriendDownscaling>=1): with the 
+  // volume based one (fFriendDownscaling<=0) the default output is used.
+  // There is no rotation of the output file by size, the trees go to the 
+  // output file of the analysis manager as in the default output.
+  //
+  fAsyncOutput = async;
+  fAsyncQueueDepth = queueDepth;
+  fAsyncChunkSize = Long64_t(chunkSizeMB*1024*1024);
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::OpenAsyncChunk()
+{
+  //
+  // Start a new in-memory chunk: the redirector fills its trees there
+  //
+  fAsyncChunk = fAsyncWriter->NewChunk();
+  TDirectory::TContext context(gDirectory,fAsyncChunk);
+  fTreeSRedirector = new TTreeSRedirector();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::FlushAsyncChunk(Bool_t last)
+{
+  //
+  // Hand over the current chunk to the writer thread, 
+  // and start a new one unless this is the last chunk
+  //
+  if (!fAsyncChunk) return;
+  delete fTreeSRedirector;  // the trees stay in the chunk
+  fTreeSRedirector = NULL;
+  fAsyncWriter->Push(fAsyncChunk);
+  fAsyncChunk = NULL;
+  if (!last) OpenAsyncChunk();
+}
+
+//_____________________________________________________________________________
+void AliAnalysisTaskFilteredTree::PostAsyncTree(Int_t slot, TTree *&tree)
+{
+  //
+  // Replace the empty tree of an output slot by the tree 
+  // of the same name filled by the writer (if any) 
+  //
+  TTree *filled = fAsyncWriter->GetTree(tree->GetName());
+  if (!filled || filled==tree) return;
+  delete tree;
+  tree = filled;
+  PostData(slot,tree);
 }
 
 //_____________________________________________________________________________
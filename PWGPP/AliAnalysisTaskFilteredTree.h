@@ -28,6 +28,8 @@ class TList;
 class TObjArray;
 class TTree;
 class TTreeSRedirector;
+class TMemFile;
+class AliFilteredTreeAsyncWriter;
 class TParticle;
 class TH3D;
 #include <string>
@@ -115,6 +117,11 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   void SetFillTrees(Bool_t filltree) { fFillTree = filltree ;}
   Bool_t GetFillTrees() { return fFillTree ;}
 
+  // asynchronous output: trees of the output file are filled and compressed by a background thread
+  // (only with the random friend downscaling, fFriendDownscaling>=1)
+  void SetAsyncOutput(Bool_t async=kTRUE, Int_t queueDepth=4, Double_t chunkSizeMB=64.);
+  Bool_t IsAsyncOutput() const { return fAsyncOutput; }
+
   void FillHistograms(AliESDtrack* const ptrack, AliExternalTrackParam* const ptpcInnerC, Double_t centralityF, Double_t chi2TPCInnerC);
   Int_t   GetNearestTrack(const AliExternalTrackParam * trackMatch, Int_t indexSkip, AliESDEvent*event, Int_t trackType, Int_t paramType,  AliExternalTrackParam & paramNearest);
   static void SetDefaultAliasesV0(TTree *treeV0);
@@ -175,9 +182,19 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TObjString fCurrentFileName; // cached value of current file name
   AliESDtrack* fDummyTrack; //! dummy track for tree init
 
+  Bool_t   fAsyncOutput;        // trees are written by AliFilteredTreeAsyncWriter
+  Int_t    fAsyncQueueDepth;    // maximal number of chunks waiting for the writer thread
+  Long64_t fAsyncChunkSize;     // uncompressed size of the entries handed over to the writer thread at once (bytes)
+  AliFilteredTreeAsyncWriter *fAsyncWriter; //! writer of the asynchronous output
+  TMemFile *fAsyncChunk;        //! in-memory file the trees are currently filled into
+
+  void OpenAsyncChunk();
+  void FlushAsyncChunk(Bool_t last);
+  void PostAsyncTree(Int_t slot, TTree *&tree);
+
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
@@ -0,0 +1,319 @@
+/**************************************************************************
+ * Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+/*
+   Asynchronous writer for the trees of AliAnalysisTaskFilteredTree.
+
+   Each chunk is a TMemFile without compression: filling the trees of a chunk
+   only streams the entries into memory. The background thread reads the
+   trees of the chunk back and copies the entries (TTree::CopyEntries) to the
+   output trees, created in the output directory of the task at the first
+   chunk, which compresses the baskets and writes them to the file of the
+   output slots. The event thread does not touch the output directory until
+   Stop, which joins the background thread.
+
+   The background thread is only used with C++11 and ROOT 6, and only if the
+   thread safety of ROOT was enabled by the steering macro
+   (ROOT::EnableThreadSafety()); otherwise the chunks are written
+   synchronously in Push.
+*/
+
+#include <cstdio>
+#include <cstring>
+#include <deque>
+
+#include "RVersion.h"
+#include "TVirtualMutex.h"
+#include "TDirectory.h"
+#include "TMemFile.h"
+#include "TTree.h"
+#include "TKey.h"
+#include "TStopwatch.h"
+
+#include "AliLog.h"
+#include "AliFilteredTreeAsyncWriter.h"
+
+#if __cplusplus >= 201103L && ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+#define ALIFILTEREDTREEASYNCWRITER_THREAD
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#endif
+
+struct AliFilteredTreeAsyncWriter::Queue {
+  Queue() : fChunks(), fDone(kFALSE), fRunning(kFALSE) {}
+  std::deque<TMemFile*> fChunks;    // chunks waiting to be written
+  Bool_t fDone;                     // no more chunks will be pushed
+  Bool_t fRunning;                  // background thread started
+#ifdef ALIFILTEREDTREEASYNCWRITER_THREAD
+  std::mutex fMutex;
+  std::condition_variable fNotEmpty;
+  std::condition_variable fNotFull;
+  std::thread fThread;
+#endif
+};
+
+//_____________________________________________________________________________
+AliFilteredTreeAsyncWriter::AliFilteredTreeAsyncWriter(TDirectory *outputDir, Int_t queueDepth)
+  : fOutputDir(outputDir)
+  , fQueueDepth(queueDepth>0 ? queueDepth : 1)
+  , fNChunks(0)
+  , fStats()
+  , fNPushed(0)
+  , fMaxDepth(0)
+  , fSumDepth(0)
+  , fWaitTime(0)
+  , fQueue(new Queue)
+  , fStopped(kFALSE)
+{
+  //
+  // Constructor, starts the background thread if ROOT is thread safe
+  //
+#ifdef ALIFILTEREDTREEASYNCWRITER_THREAD
+  if (gGlobalMutex) {
+    fQueue->fRunning = kTRUE;
+    fQueue->fThread = std::thread(&AliFilteredTreeAsyncWriter::Run, this);
+  }
+  else {
+    AliWarningGeneral("AliFilteredTreeAsyncWriter","ROOT thread safety not enabled in the steering macro, chunks are written synchronously");
+  }
+#endif
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeAsyncWriter::~AliFilteredTreeAsyncWriter()
+{
+  //
+  // Destructor
+  //
+  Stop();
+  delete fQueue;
+}
+
+//_____________________________________________________________________________
+Long64_t AliFilteredTreeAsyncWriter::GetChunkSize(TMemFile *chunk)
+{
+  //
+  // Uncompressed size of the entries filled in the trees of the chunk
+  //
+  if (!chunk) return 0;
+  Long64_t size=0;
+  TIter next(chunk->GetList());
+  while (TObject *obj = next()) {
+    if (obj->InheritsFrom(TTree::Class())) size+=((TTree*)obj)->GetTotBytes();
+  }
+  return size;
+}
+
+//_____________________________________________________________________________
+TMemFile *AliFilteredTreeAsyncWriter::NewChunk()
+{
+  //
+  // Create the in-memory file for the next chunk (no compression)
+  //
+  return new TMemFile(Form("AliFilteredTreeAsyncWriter_chunk%d.root",fNChunks++),"RECREATE","",0);
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::Push(TMemFile *chunk)
+{
+  //
+  // Queue a filled chunk. Waits if the queue is full.
+  //
+  if (!chunk) return;
+  if (fStopped) {
+    AliErrorGeneral("AliFilteredTreeAsyncWriter::Push","output already closed, chunk dropped");
+    delete chunk;
+    return;
+  }
+  chunk->Write(0,TObject::kOverwrite);  // flush the last (uncompressed) baskets
+  fNPushed++;
+  if (!IsAsync()) {
+    fMaxDepth=1;
+    fSumDepth+=1;
+    WriteChunk(chunk);
+    return;
+  }
+#ifdef ALIFILTEREDTREEASYNCWRITER_THREAD
+  TStopwatch timer;
+  Int_t depth=0;
+  {
+    std::unique_lock<std::mutex> lock(fQueue->fMutex);
+    while ((Int_t)fQueue->fChunks.size()>=fQueueDepth) fQueue->fNotFull.wait(lock);
+    fQueue->fChunks.push_back(chunk);
+    depth=fQueue->fChunks.size();
+  }
+  fQueue->fNotEmpty.notify_one();
+  fWaitTime+=timer.RealTime();
+  if (depth>fMaxDepth) fMaxDepth=depth;
+  fSumDepth+=depth;
+#endif
+}
+
+//_____________________________________________________________________________
+Bool_t AliFilteredTreeAsyncWriter::IsAsync() const
+{
+  //
+  // Whether the chunks are written by the background thread
+  //
+  return fQueue->fRunning;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::Stop()
+{
+  //
+  // Write all queued chunks, wait for the background thread
+  // and write the output trees
+  //
+  if (fStopped) return;
+  fStopped=kTRUE;
+#ifdef ALIFILTEREDTREEASYNCWRITER_THREAD
+  if (IsAsync()) {
+    {
+      std::lock_guard<std::mutex> lock(fQueue->fMutex);
+      fQueue->fDone=kTRUE;
+    }
+    fQueue->fNotEmpty.notify_one();
+    if (fQueue->fThread.joinable()) fQueue->fThread.join();
+  }
+#endif
+  WriteTrees();
+}
+
+//_____________________________________________________________________________
+TTree *AliFilteredTreeAsyncWriter::GetTree(const char *name) const
+{
+  //
+  // Output tree with the given name, NULL if no chunk contained it.
+  // Only available after Stop (the trees are filled by the background thread).
+  //
+  if (!fStopped) return 0;
+  for (size_t i=0; i<fStats.size(); i++) {
+    if (fStats[i].fName==name) return fStats[i].fTree;
+  }
+  return 0;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::Run()
+{
+  //
+  // Background thread: write the chunks in the order they were pushed
+  //
+#ifdef ALIFILTEREDTREEASYNCWRITER_THREAD
+  for (;;) {
+    TMemFile *chunk=0;
+    {
+      std::unique_lock<std::mutex> lock(fQueue->fMutex);
+      while (fQueue->fChunks.empty() && !fQueue->fDone) fQueue->fNotEmpty.wait(lock);
+      if (fQueue->fChunks.empty()) break;
+      chunk=fQueue->fChunks.front();
+      fQueue->fChunks.pop_front();
+    }
+    fQueue->fNotFull.notify_one();
+    WriteChunk(chunk);
+  }
+#endif
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::WriteChunk(TMemFile *chunk)
+{
+  //
+  // Copy the entries of all trees of the chunk to the output file
+  //
+  TDirectory::TContext context(gDirectory);
+  TIter next(chunk->GetListOfKeys());
+  while (TKey *key = (TKey*)next()) {
+    if (strcmp(key->GetClassName(),"TTree")) continue;
+    if (chunk->GetKey(key->GetName())!=key) continue;  // older cycle
+    TTree *tree=(TTree*)chunk->Get(key->GetName());
+    if (!tree) continue;
+    TreeStat &stat=GetStat(tree->GetName());
+    TStopwatch timer;
+    if (!stat.fTree) {
+      if (fOutputDir) fOutputDir->cd();
+      stat.fTree=tree->CloneTree(0);
+      stat.fTree->SetDirectory(fOutputDir);
+    }
+    stat.fTree->CopyEntries(tree);
+    stat.fChunks++;
+    stat.fEntries+=tree->GetEntries();
+    stat.fBytesIn+=tree->GetTotBytes();
+    stat.fWriteTime+=timer.RealTime();
+  }
+  chunk->Close();
+  delete chunk;
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::WriteTrees()
+{
+  //
+  // Write the output trees to the output directory, 
+  // as the TTreeSRedirector does for the synchronous output
+  //
+  if (!fOutputDir) return;
+  TDirectory::TContext context(gDirectory,fOutputDir);
+  for (size_t i=0; i<fStats.size(); i++) {
+    TTree *tree=fStats[i].fTree;
+    if (!tree) continue;
+    tree->Write(0,TObject::kOverwrite);
+    fStats[i].fZipBytes=tree->GetZipBytes();
+  }
+}
+
+//_____________________________________________________________________________
+AliFilteredTreeAsyncWriter::TreeStat &AliFilteredTreeAsyncWriter::GetStat(const char *name)
+{
+  //
+  // Counters of the tree with the given name
+  //
+  for (size_t i=0; i<fStats.size(); i++) {
+    if (fStats[i].fName==name) return fStats[i];
+  }
+  TreeStat stat;
+  stat.fName=name;
+  stat.fTree=0;
+  stat.fChunks=0;
+  stat.fEntries=0;
+  stat.fBytesIn=0;
+  stat.fZipBytes=0;
+  stat.fWriteTime=0;
+  fStats.push_back(stat);
+  return fStats.back();
+}
+
+//_____________________________________________________________________________
+void AliFilteredTreeAsyncWriter::Print() const
+{
+  //
+  // Print the per-tree write throughput and the queue depth counters
+  // (complete after Stop)
+  //
+  const Double_t mb=1024.*1024.;
+  printf("AliFilteredTreeAsyncWriter: %d chunks written %s to %s\n",fNPushed,IsAsync() ? "by the background thread" : "synchronously",
+         fOutputDir ? fOutputDir->GetPath() : "(no output directory)");
+  printf("  queue: max depth %d/%d, mean depth %.2f, event thread waited %.2f s\n",
+         fMaxDepth,fQueueDepth,fNPushed>0 ? fSumDepth/fNPushed : 0.,fWaitTime);
+  for (size_t i=0; i<fStats.size(); i++) {
+    const TreeStat &stat=fStats[i];
+    Double_t time=stat.fWriteTime>0 ? stat.fWriteTime : 1e-9;
+    printf("  %-16s %10lld entries %4d chunks  in %9.2f MB  out %9.2f MB  %7.2f s  %8.2f MB/s in  %8.2f MB/s out\n",
+           stat.fName.Data(),stat.fEntries,stat.fChunks,stat.fBytesIn/mb,stat.fZipBytes/mb,stat.fWriteTime,
+           stat.fBytesIn/mb/time,stat.fZipBytes/mb/time);
+  }
+}
@@ -0,0 +1,70 @@
+#ifndef ALIFILTEREDTREEASYNCWRITER_H
+#define ALIFILTEREDTREEASYNCWRITER_H
+
+//------------------------------------------------------------------------------
+// Asynchronous output of the trees filled by AliAnalysisTaskFilteredTree.
+//
+// The event thread fills the trees into an uncompressed in-memory file
+// (a chunk, see NewChunk). Filled chunks are queued (Push) and a background
+// thread copies their entries to trees of the same name and branch structure
+// in the output directory of the task, so that the basket compression and the
+// file writes do not run in UserExec. The queue is bounded: Push waits when
+// it is full. After Stop the trees are complete and can be posted to the
+// output slots (GetTree).
+//------------------------------------------------------------------------------
+
+#include <vector>
+
+#include "TString.h"
+
+class TDirectory;
+class TMemFile;
+class TTree;
+
+class AliFilteredTreeAsyncWriter {
+ public:
+  AliFilteredTreeAsyncWriter(TDirectory *outputDir, Int_t queueDepth);
+  virtual ~AliFilteredTreeAsyncWriter();
+
+  TMemFile *NewChunk();              // in-memory file for the next chunk of entries
+  void      Push(TMemFile *chunk);   // queue a filled chunk, ownership is taken
+  void      Stop();                  // write the queued chunks and the trees
+  TTree    *GetTree(const char *name) const;  // output tree with the given name, only after Stop
+  Bool_t    IsAsync() const;         // chunks are written by the background thread
+  void      Print() const;           // write throughput and queue depth counters
+
+  static Long64_t GetChunkSize(TMemFile *chunk);  // uncompressed bytes filled in the chunk
+
+ private:
+  struct TreeStat {
+    TString  fName;       // tree name
+    TTree   *fTree;       // tree in the output directory
+    Int_t    fChunks;     // number of chunks written
+    Long64_t fEntries;    // number of entries written
+    Double_t fBytesIn;    // uncompressed bytes
+    Double_t fZipBytes;   // compressed bytes in the output file
+    Double_t fWriteTime;  // time spent copying the entries (s)
+  };
+  struct Queue;           // chunk queue and background thread
+
+  void      Run();
+  void      WriteChunk(TMemFile *chunk);
+  void      WriteTrees();
+  TreeStat &GetStat(const char *name);
+
+  TDirectory *fOutputDir;    // directory of the output trees (file of the task output slots)
+  Int_t     fQueueDepth;     // maximal number of chunks waiting in the queue
+  Int_t     fNChunks;        // number of chunks created
+  std::vector<TreeStat> fStats;  // per-tree counters and output trees
+  Int_t     fNPushed;        // number of chunks queued
+  Int_t     fMaxDepth;       // maximal queue depth seen
+  Double_t  fSumDepth;       // sum of the queue depth after each Push
+  Double_t  fWaitTime;       // time Push waited for a free slot (s)
+  Queue    *fQueue;          // synchronization, defined in the .cxx
+  Bool_t    fStopped;        // output closed
+
+  AliFilteredTreeAsyncWriter(const AliFilteredTreeAsyncWriter&); // not implemented
+  AliFilteredTreeAsyncWriter& operator=(const AliFilteredTreeAsyncWriter&); // not implemented
+};
+
+#endif
@@ -43,6 +43,7 @@
 #include <TF1.h>
 
 #include "AliPerformanceDCA.h" 
+#include "AliPerformanceFillBuffer.h"
 #include "AliVEvent.h"
 #include "AliESDVertex.h"
 #include "AliVVertex.h"
@@ -69,7 +70,8 @@ AliPerformanceDCA::AliPerformanceDCA(const Char_t* name, const Char_t* title,Int
   fDCAHisto(0),
 
   // histogram folder 
-  fAnalysisFolder(0)
+  fAnalysisFolder(0),
+  fDCABlock(-1)
 {
   // named constructor	 
 
@@ -167,7 +169,7 @@ void AliPerformanceDCA::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
   if (vTrack->GetTPCNcls()<fCutsRC.GetMinNClustersTPC()) return; // min. nb. TPC clusters  
  
 Double_t vDCAHisto[5]={dca[0],dca[1],etpTrack->Eta(),etpTrack->Pt(),etpTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  FillDCAHisto(vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -209,7 +211,7 @@ void AliPerformanceDCA::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
   if(vTrack->GetITSclusters(0)<fCutsRC.GetMinNClustersITS()) return;  // min. nb. ITS clusters
 
   Double_t vDCAHisto[5]={dca[0],dca[1],vTrack->Eta(),vTrack->Pt(),vTrack->Phi()};
-  fDCAHisto->Fill(vDCAHisto);
+  FillDCAHisto(vDCAHisto);
 
   //
   // Fill rec vs MC information
@@ -225,6 +227,24 @@ void AliPerformanceDCA::ProcessConstrained(AliMCEvent* const /*mcev*/, AliVTrack
   AliDebug(AliLog::kWarning, "Warning: Not implemented");
 }
 
+//_____________________________________________________________________________
+void AliPerformanceDCA::FillDCAHisto(const Double_t *vDCAHisto)
+{
+  // Fill the DCA histogram, directly or through the fill buffer
+
+  AliPerformanceFillBuffer *buffer = GetFillBuffer();
+  if(buffer) buffer->Fill(fDCABlock,vDCAHisto);
+  else fDCAHisto->Fill(vDCAHisto);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceDCA::RegisterFillBuffer(AliPerformanceFillBuffer *buffer)
+{
+  // Register the DCA histogram in the fill buffer
+
+  fDCABlock = buffer->AddBlock(5,fDCAHisto);
+}
+
 //_____________________________________________________________________________
 Long64_t AliPerformanceDCA::Merge(TCollection* const list) 
 {
@@ -235,6 +255,7 @@ Long64_t AliPerformanceDCA::Merge(TCollection* const list)
 
   if (list->IsEmpty())
   return 1;
+  FlushFillBuffer();
 
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
@@ -336,6 +357,7 @@ void AliPerformanceDCA::Analyse()
   // Analyse comparison information and store output histograms
   // in the analysis folder "folderDCA" 
   //
+  FlushFillBuffer();
   
   TH1::AddDirectory(kFALSE);
   TH1F *h1D=0;
@@ -63,6 +63,9 @@ public :
   TH1F* MakeStat1D(TH2 *hist, Int_t delta1, Int_t type);
   TH2F* MakeStat2D(TH3 *hist, Int_t delta0, Int_t delta1, Int_t type);
 
+protected:
+  virtual void RegisterFillBuffer(AliPerformanceFillBuffer *buffer);
+
 private:
 
   // DCA histograms
@@ -71,10 +74,14 @@ private:
   // analysis folder 
   TFolder *fAnalysisFolder; // folder for analysed histograms
 
+  Int_t fDCABlock; //! block of the fill buffer
+
+  void FillDCAHisto(const Double_t *vDCAHisto);
+
   AliPerformanceDCA(const AliPerformanceDCA&); // not implemented
   AliPerformanceDCA& operator=(const AliPerformanceDCA&); // not implemented
 
-  ClassDef(AliPerformanceDCA,2);
+  ClassDef(AliPerformanceDCA,3);
 };
 
 #endif
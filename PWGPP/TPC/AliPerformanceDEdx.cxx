@@ -47,6 +47,7 @@
 #include "TChain.h"
 
 #include "AliPerformanceDEdx.h"
+#include "AliPerformanceFillBuffer.h"
 #include "AliPerformanceTPC.h"
 #include "AliTPCPerformanceSummary.h"
 #include "AliVEvent.h"
@@ -84,7 +85,8 @@ AliPerformanceDEdx::AliPerformanceDEdx(TRootIOCtor* b):
   h_tpc_dedx_mips_c_0_5(0),
   h_tpc_dedx_mips_a_0_5(0),
   h_tpc_dedx_mips_c_0_1(0),
-  h_tpc_dedx_mips_a_0_1(0)
+  h_tpc_dedx_mips_a_0_1(0),
+  fDeDxBlock(-1)
 
 {
   // io constructor
@@ -103,7 +105,8 @@ AliPerformanceDEdx::AliPerformanceDEdx(const Char_t* name, const Char_t* title,
   h_tpc_dedx_mips_c_0_5(0),
   h_tpc_dedx_mips_a_0_5(0),
   h_tpc_dedx_mips_c_0_1(0),
-  h_tpc_dedx_mips_a_0_1(0)
+  h_tpc_dedx_mips_a_0_1(0),
+  fDeDxBlock(-1)
 {
   // named constructor
 
@@ -304,7 +307,9 @@ void AliPerformanceDEdx::ProcessInnerTPC(AliMCEvent* const mcev, AliVTrack *cons
     
     //Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,ncls,p,TPCSignalN,nCrossedRows};
     Double_t vDeDxHisto[10] = {dedx,phi,y,z,snp,tgl,Double_t(ncls),p,Double_t(TPCSignalN),nClsF};
-    if(fUseSparse) fDeDxHisto->Fill(vDeDxHisto);
+    AliPerformanceFillBuffer *buffer = GetFillBuffer();
+    if(buffer) buffer->Fill(fDeDxBlock,vDeDxHisto);
+    else if(fUseSparse) fDeDxHisto->Fill(vDeDxHisto);
     else  FilldEdxHisotgram(vDeDxHisto);
     
     if(!mcev) return;
@@ -338,6 +343,7 @@ Long64_t AliPerformanceDEdx::Merge(TCollection* const list)
   return 1;
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
+  FlushFillBuffer();
 
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
@@ -467,6 +473,7 @@ void AliPerformanceDEdx::Analyse()
   //fai fit con range p(.32,.38) and dEdx(65- 120 or 100) e ripeti cosa fatta per pion e fai trending della media e res, poio la loro differenza
   //fai dedx vs lamda ma for e e pion separati
   //
+  FlushFillBuffer();
   TH1::AddDirectory(kFALSE);
   TH1::SetDefaultSumw2(kFALSE);
     if(fUseSparse){
@@ -695,8 +702,75 @@ void AliPerformanceDEdx::FilldEdxHisotgram(double *vDeDxHisto){
 
 }
 
+//_____________________________________________________________________________
+void AliPerformanceDEdx::RegisterFillBuffer(AliPerformanceFillBuffer *buffer)
+{
+  // Register the dE/dx histograms in the fill buffer,
+  // with the same selections as FilldEdxHisotgram
+
+    if(fUseSparse) {
+      fDeDxBlock = buffer->AddBlock(10,fDeDxHisto);
+      return;
+    }
+
+    fDeDxBlock = buffer->AddBlock(10);
+    Int_t proj = -1;
+    if(h_tpc_dedx_mips_0) {
+      proj = RegisterMIPProjection(buffer,h_tpc_dedx_mips_0,0);
+      buffer->AddSelection(fDeDxBlock,proj,5,-1.,1.,kFALSE,kFALSE);
+    }
+    if(h_tpc_dedx_mips_c_0_5) {
+      proj = RegisterMIPProjection(buffer,h_tpc_dedx_mips_c_0_5,0,5);
+      buffer->AddSelection(fDeDxBlock,proj,5,-3.,0.,kFALSE,kFALSE);
+    }
+    if(h_tpc_dedx_mips_c_0_1) {
+      proj = RegisterMIPProjection(buffer,h_tpc_dedx_mips_c_0_1,0,1);
+      buffer->AddSelection(fDeDxBlock,proj,5,-3.,0.,kFALSE,kFALSE);
+    }
+    if(h_tpc_dedx_mips_a_0_5) {
+      proj = RegisterMIPProjection(buffer,h_tpc_dedx_mips_a_0_5,0,5);
+      buffer->AddSelection(fDeDxBlock,proj,5,0.,3.,kFALSE,kFALSE);
+    }
+    if(h_tpc_dedx_mips_a_0_1) {
+      proj = RegisterMIPProjection(buffer,h_tpc_dedx_mips_a_0_1,0,1);
+      buffer->AddSelection(fDeDxBlock,proj,5,0.,3.,kFALSE,kFALSE);
+    }
+    if(h_tpc_dedx_mipsele_0) {
+      // dedx and momenta for electrons
+      proj = buffer->AddProjection(fDeDxBlock,h_tpc_dedx_mipsele_0,0);
+      buffer->AddSelection(fDeDxBlock,proj,0,70.,100.);
+      buffer->AddSelection(fDeDxBlock,proj,2,-20.,19.999);
+      buffer->AddSelection(fDeDxBlock,proj,3,-250.,249.999);
+      buffer->AddSelection(fDeDxBlock,proj,4,-1.,0.99);
+      buffer->AddSelection(fDeDxBlock,proj,5,-1.,0.99);
+      buffer->AddSelection(fDeDxBlock,proj,6,80.,160.);
+      buffer->AddSelection(fDeDxBlock,proj,7,0.32,0.38);
+      buffer->AddSelection(fDeDxBlock,proj,8,80.,160.);
+      buffer->AddSelection(fDeDxBlock,proj,9,0.5,1.);
+    }
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceDEdx::RegisterMIPProjection(AliPerformanceFillBuffer *buffer, TH1 *hist, Int_t xDim, Int_t yDim)
+{
+  // Register a histogram with the MIP selection of FilldEdxHisotgram
+
+    Int_t proj = buffer->AddProjection(fDeDxBlock,hist,xDim,yDim);
+    buffer->AddSelection(fDeDxBlock,proj,0,35.,60.);
+    buffer->AddSelection(fDeDxBlock,proj,2,-20.,20.);
+    buffer->AddSelection(fDeDxBlock,proj,3,-250.,250.);
+    buffer->AddSelection(fDeDxBlock,proj,4,-1.,1.);
+    buffer->AddSelection(fDeDxBlock,proj,6,80.,160.);
+    buffer->AddSelection(fDeDxBlock,proj,7,0.4,0.55);
+    buffer->AddSelection(fDeDxBlock,proj,8,80.,160.);
+    buffer->AddSelection(fDeDxBlock,proj,9,0.5,1.);
+    return proj;
+}
+
 void AliPerformanceDEdx::ResetOutputData(){
 
+    FlushFillBuffer();
+
     if(fUseSparse){
         if(fDeDxHisto) fDeDxHisto->Reset("ICE");
     }
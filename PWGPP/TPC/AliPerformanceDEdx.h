@@ -76,6 +76,9 @@ public :
     
   virtual void ResetOutputData();
 
+protected:
+  virtual void RegisterFillBuffer(AliPerformanceFillBuffer *buffer);
+
 private:
 
   static Bool_t fgMergeTHnSparse;
@@ -95,10 +98,14 @@ private:
   TH2D *h_tpc_dedx_mips_a_0_1; //!
   
 
+  Int_t fDeDxBlock; //! block of the fill buffer
+
+  Int_t RegisterMIPProjection(AliPerformanceFillBuffer *buffer, TH1 *hist, Int_t xDim, Int_t yDim=-1);
+
   AliPerformanceDEdx(const AliPerformanceDEdx&); // not implemented
   AliPerformanceDEdx& operator=(const AliPerformanceDEdx&); // not implemented
 
-  ClassDef(AliPerformanceDEdx,8);
+  ClassDef(AliPerformanceDEdx,9);
 };
 
 #endif
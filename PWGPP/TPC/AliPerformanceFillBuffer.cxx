@@ -0,0 +1,543 @@
+/**************************************************************************
+* Copyright(c) 1998-1999, ALICE Experiment at CERN, All rights reserved. *
+*                                                                        *
+* Author: The ALICE Off-line Project.                                    *
+* Contributors are mentioned in the code where appropriate.              *
+*                                                                        *
+* Permission to use, copy, modify and distribute this software and its   *
+* documentation strictly for non-commercial purposes is hereby granted   *
+* without fee, provided that the above copyright notice appears in all   *
+* copies and that both the copyright notice and this permission notice   *
+* appear in the supporting documentation. The authors make no claims     *
+* about the suitability of this software for any purpose. It is          *
+* provided "as is" without express or implied warranty.                  *
+**************************************************************************/
+
+//------------------------------------------------------------------------------
+// Implementation of the AliPerformanceFillBuffer class.
+// Buffers the fills of the AliPerformanceObject histograms and applies
+// them in bulk (see header).
+//------------------------------------------------------------------------------
+
+#include <algorithm>
+#include <utility>
+
+#include "RVersion.h"
+#include "TAxis.h"
+#include "TArrayD.h"
+#include "TH1.h"
+#include "TH2.h"
+#include "TH3.h"
+#include "THnSparse.h"
+#include "TMath.h"
+#include "TString.h"
+
+#include "AliLog.h"
+#include "AliPerformanceFillBuffer.h"
+
+using namespace std;
+
+//_____________________________________________________________________________
+AliPerformanceFillBuffer::AliPerformanceFillBuffer(Int_t capacity):
+  fCapacity(capacity>0 ? capacity : 1),
+  fProjectAtTerminate(kFALSE),
+  fBlocks(),
+  fBins(),
+  fPass(),
+  fSelectionResult()
+{
+  // constructor
+}
+
+//_____________________________________________________________________________
+AliPerformanceFillBuffer::~AliPerformanceFillBuffer()
+{
+  // destructor, the projection sparses are owned
+  for (size_t i=0; i<fBlocks.size(); i++) delete fBlocks[i].fProjSparse;
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceFillBuffer::AddBlock(Int_t nDim, THnSparse *sparse)
+{
+  // register a block of tuples with nDim coordinates
+  // returns the block index used in Fill()
+
+  if (sparse && sparse->GetNdimensions()!=nDim) {
+    AliErrorGeneral("AliPerformanceFillBuffer::AddBlock", Form("sparse %s has %d dimensions, block has %d", sparse->GetName(), sparse->GetNdimensions(), nDim));
+    return -1;
+  }
+  Block block;
+  block.fNDim = nDim;
+  block.fSparse = sparse;
+  block.fN = 0;
+  block.fX.resize(nDim*fCapacity);
+  block.fW.resize(fCapacity);
+  block.fInitialised = kFALSE;
+  block.fProjSparse = 0;
+  fBlocks.push_back(block);
+  return fBlocks.size()-1;
+}
+
+//_____________________________________________________________________________
+Int_t AliPerformanceFillBuffer::AddProjection(Int_t block, TH1 *hist, Int_t xDim, Int_t yDim, Int_t zDim)
+{
+  // register a histogram filled with coordinates (xDim,yDim,zDim) of the block
+  // returns the projection index used in AddSelection()
+
+  if (block<0 || block>=GetNBlocks() || !hist) return -1;
+  Block &b = fBlocks[block];
+  Int_t dims[3] = {xDim, yDim, zDim};
+  for (Int_t i=0; i<hist->GetDimension(); i++) {
+    if (dims[i]<0 || dims[i]>=b.fNDim) {
+      AliErrorGeneral("AliPerformanceFillBuffer::AddProjection", Form("wrong coordinate for axis %d of %s", i, hist->GetName()));
+      return -1;
+    }
+  }
+  Projection proj;
+  proj.fHist = hist;
+  for (Int_t i=0; i<3; i++) proj.fDim[i] = dims[i];
+  proj.fAtTerminate = kFALSE;
+  proj.fSelectionBit = -1;
+  b.fProjections.push_back(proj);
+  return b.fProjections.size()-1;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::AddSelection(Int_t block, Int_t projection, Int_t dim, Double_t min, Double_t max, Bool_t minIncluded, Bool_t maxIncluded)
+{
+  // fill the projection only with the tuples passing the range selection on coordinate dim
+
+  if (block<0 || block>=GetNBlocks()) return;
+  Block &b = fBlocks[block];
+  if (projection<0 || projection>=Int_t(b.fProjections.size()) || dim<0 || dim>=b.fNDim) return;
+  Selection sel;
+  sel.fDim = dim;
+  sel.fMin = min;
+  sel.fMax = max;
+  sel.fMinIncluded = minIncluded;
+  sel.fMaxIncluded = maxIncluded;
+  b.fProjections[projection].fSelections.push_back(sel);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::Fill(Int_t block, const Double_t *x, Double_t w)
+{
+  // buffer one tuple
+
+  if (block<0 || block>=GetNBlocks()) return;
+  Block &b = fBlocks[block];
+  if (!b.fInitialised) InitBlock(block);
+  for (Int_t d=0; d<b.fNDim; d++) b.fX[d*fCapacity+b.fN] = x[d];
+  b.fW[b.fN] = w;
+  if (++b.fN == fCapacity) FlushBlock(b);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::Flush()
+{
+  // apply the buffered tuples of all blocks
+  // and generate the projections at terminate
+
+  for (size_t i=0; i<fBlocks.size(); i++) {
+    Block &b = fBlocks[i];
+    if (!b.fInitialised) InitBlock(i);
+    if (b.fN) FlushBlock(b);
+    if (b.fProjSparse) ProjectAtTerminate(b);
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::InitBlock(Int_t iBlock)
+{
+  // set up the projection sparse of a block, at the first fill
+  // its axes are the histogram axes of the projections generated at terminate,
+  // plus one axis with the result of their selections (one bit per selection)
+
+  const Int_t kMaxSelectionBits = 16;
+
+  Block &b = fBlocks[iBlock];
+  b.fInitialised = kTRUE;
+  b.fProjAxis.assign(b.fNDim, -1);
+  if (!fProjectAtTerminate) return;
+
+  vector<const TAxis*> axes(b.fNDim, (const TAxis*)0);
+  Bool_t atTerminate = kFALSE;
+  for (size_t ip=0; ip<b.fProjections.size(); ip++) {
+    Projection &p = b.fProjections[ip];
+    TH1 *h = p.fHist;
+    // buffered or extendable histograms are filled online
+    if (h->GetBuffer()) continue;
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+    if (h->CanExtendAllAxes()) continue;
+#else
+    if (h->TestBit(TH1::kCanRebin)) continue;
+#endif
+    const TAxis *hAxes[3] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+    Bool_t sameAxes = kTRUE;
+    for (Int_t a=0; a<h->GetDimension(); a++) {
+      const TAxis *axis = axes[p.fDim[a]];
+      if (axis && !IsSameBinning(axis, hAxes[a])) sameAxes = kFALSE;
+    }
+    if (!sameAxes) {
+      AliWarningGeneral("AliPerformanceFillBuffer::InitBlock", Form("%s: binning differs from the other projections, filled online", h->GetName()));
+      continue;
+    }
+    if (!p.fSelections.empty()) {
+      for (size_t s=0; s<b.fSelections.size(); s++) {
+        if (IsSameSelection(b.fProjections[b.fSelections[s]], p)) p.fSelectionBit = s;
+      }
+      if (p.fSelectionBit < 0) {
+        if (Int_t(b.fSelections.size()) >= kMaxSelectionBits) {
+          AliWarningGeneral("AliPerformanceFillBuffer::InitBlock", Form("%s: too many different selections, filled online", h->GetName()));
+          continue;
+        }
+        p.fSelectionBit = b.fSelections.size();
+        b.fSelections.push_back(ip);
+      }
+    }
+    for (Int_t a=0; a<h->GetDimension(); a++) axes[p.fDim[a]] = hAxes[a];
+    p.fAtTerminate = kTRUE;
+    atTerminate = kTRUE;
+  }
+  if (!atTerminate) return;
+
+  vector<Int_t> nbins;
+  vector<Double_t> xmin, xmax;
+  for (Int_t d=0; d<b.fNDim; d++) {
+    if (!axes[d]) continue;
+    b.fProjAxis[d] = b.fProjDims.size();
+    b.fProjDims.push_back(d);
+    nbins.push_back(axes[d]->GetNbins());
+    xmin.push_back(axes[d]->GetXmin());
+    xmax.push_back(axes[d]->GetXmax());
+  }
+  if (!b.fSelections.empty()) {
+    const Int_t nResults = 1 << b.fSelections.size();
+    b.fProjDims.push_back(-1);
+    nbins.push_back(nResults);
+    xmin.push_back(-0.5);
+    xmax.push_back(nResults-0.5);
+  }
+  b.fProjSparse = new THnSparseD(Form("fProjSparse%d", iBlock), "projections at terminate", nbins.size(), &nbins[0], &xmin[0], &xmax[0]);
+  for (size_t k=0; k<b.fProjDims.size(); k++) {
+    const Int_t d = b.fProjDims[k];
+    if (d>=0 && axes[d]->GetXbins()->GetSize()) b.fProjSparse->SetBinEdges(k, axes[d]->GetXbins()->GetArray());
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::FlushBlock(Block &block)
+{
+  // apply the buffered tuples of one block
+
+  const Int_t n = block.fN;
+  if (block.fSparse) {
+    vector<const Double_t*> x(block.fNDim);
+    for (Int_t d=0; d<block.fNDim; d++) x[d] = &block.fX[d*fCapacity];
+    FillSparse(block.fSparse, x, &block.fW[0], n);
+  }
+  if (block.fProjSparse) {
+    fSelectionResult.assign(n, 0.);
+    for (size_t s=0; s<block.fSelections.size(); s++) {
+      SelectTuples(block, block.fProjections[block.fSelections[s]]);
+      for (Int_t i=0; i<n; i++) if (fPass[i]) fSelectionResult[i] += 1 << s;
+    }
+    vector<const Double_t*> x(block.fProjDims.size());
+    for (size_t k=0; k<x.size(); k++) {
+      const Int_t d = block.fProjDims[k];
+      x[k] = d>=0 ? &block.fX[d*fCapacity] : &fSelectionResult[0];
+    }
+    FillSparse(block.fProjSparse, x, &block.fW[0], n);
+  }
+  for (size_t i=0; i<block.fProjections.size(); i++) {
+    if (!block.fProjections[i].fAtTerminate) FillProjection(block, block.fProjections[i]);
+  }
+  block.fN = 0;
+}
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::FindBins(const TAxis *axis, const Double_t *x, Int_t n, Int_t *bins)
+{
+  // bin numbers of n values, same as TAxis::FindFixBin
+
+  const Int_t nbins = axis->GetNbins();
+  const Double_t xmin = axis->GetXmin();
+  const Double_t xmax = axis->GetXmax();
+  const TArrayD *edges = axis->GetXbins();
+  if (!edges->GetSize()) {
+    for (Int_t i=0; i<n; i++) {
+      if (x[i] < xmin) bins[i] = 0;
+      else if (!(x[i] < xmax)) bins[i] = nbins+1;
+      else bins[i] = 1 + Int_t(nbins*(x[i]-xmin)/(xmax-xmin));
+    }
+  } else {
+    for (Int_t i=0; i<n; i++) {
+      if (x[i] < xmin) bins[i] = 0;
+      else if (!(x[i] < xmax)) bins[i] = nbins+1;
+      else bins[i] = 1 + TMath::BinarySearch(edges->GetSize(), edges->GetArray(), x[i]);
+    }
+  }
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceFillBuffer::IsSameBinning(const TAxis *a1, const TAxis *a2)
+{
+  // same bin edges
+
+  if (a1->GetNbins()!=a2->GetNbins() || a1->GetXmin()!=a2->GetXmin() || a1->GetXmax()!=a2->GetXmax()) return kFALSE;
+  const TArrayD *edges1 = a1->GetXbins();
+  const TArrayD *edges2 = a2->GetXbins();
+  if (edges1->GetSize()!=edges2->GetSize()) return kFALSE;
+  for (Int_t i=0; i<edges1->GetSize(); i++) {
+    if (edges1->At(i)!=edges2->At(i)) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+Bool_t AliPerformanceFillBuffer::IsSameSelection(const Projection &p1, const Projection &p2)
+{
+  // same list of range selections
+
+  if (p1.fSelections.size()!=p2.fSelections.size()) return kFALSE;
+  for (size_t s=0; s<p1.fSelections.size(); s++) {
+    const Selection &s1 = p1.fSelections[s];
+    const Selection &s2 = p2.fSelections[s];
+    if (s1.fDim!=s2.fDim || s1.fMin!=s2.fMin || s1.fMax!=s2.fMax ||
+        s1.fMinIncluded!=s2.fMinIncluded || s1.fMaxIncluded!=s2.fMaxIncluded) return kFALSE;
+  }
+  return kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::FillSparse(THnSparse *sparse, const vector<const Double_t*> &x, const Double_t *w, Int_t n)
+{
+  // add n tuples to the sparse, x[dim] being the coordinates along axis dim
+  // without errors the tuples falling into the same bin are combined,
+  // so that each bin is looked up only once
+
+  const Int_t nDim = sparse->GetNdimensions();
+
+  // weighted fills need the errors, as in TH1::Fill
+  if (!sparse->GetCalculateErrors()) {
+    for (Int_t i=0; i<n; i++) {
+      if (w[i]!=1.) { sparse->Sumw2(); break; }
+    }
+  }
+  if (sparse->GetCalculateErrors()) {
+    // the weighted sums of each axis need the coordinates: fill one by one
+    vector<Double_t> xi(nDim);
+    for (Int_t i=0; i<n; i++) {
+      for (Int_t d=0; d<nDim; d++) xi[d] = x[d][i];
+      sparse->Fill(&xi[0], w[i]);
+    }
+    return;
+  }
+
+  fBins.resize(nDim*n);
+  for (Int_t d=0; d<nDim; d++) FindBins(sparse->GetAxis(d), x[d], n, &fBins[d*n]);
+
+  // global bin number, if it fits into 62 bits
+  Double_t nCells = 1.;
+  for (Int_t d=0; d<nDim; d++) nCells *= sparse->GetAxis(d)->GetNbins()+2;
+  Bool_t combine = nCells < 4.e18;
+
+  vector<pair<Long64_t,Int_t> > keys(n);
+  for (Int_t i=0; i<n; i++) {
+    Long64_t key = 0;
+    if (combine) {
+      for (Int_t d=nDim-1; d>=0; d--) key = key*(sparse->GetAxis(d)->GetNbins()+2) + fBins[d*n+i];
+    }
+    keys[i] = make_pair(key, i);
+  }
+  if (combine) sort(keys.begin(), keys.end());
+
+  vector<Int_t> coord(nDim);
+  for (Int_t first=0; first<n; ) {
+    Int_t last = first+1;
+    if (combine) {
+      while (last<n && keys[last].first==keys[first].first) last++;
+    }
+    const Int_t i = keys[first].second;
+    for (Int_t d=0; d<nDim; d++) coord[d] = fBins[d*n+i];
+    Long64_t bin = sparse->GetBin(&coord[0], kTRUE);
+    // FillBin keeps the number of entries
+    for (Int_t j=first; j<last; j++) sparse->FillBin(bin, w[keys[j].second]);
+    first = last;
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::SelectTuples(const Block &block, const Projection &proj)
+{
+  // selection result of the buffered tuples for one projection, in fPass
+
+  const Int_t n = block.fN;
+  fPass.assign(n, kTRUE);
+  for (size_t s=0; s<proj.fSelections.size(); s++) {
+    const Selection &sel = proj.fSelections[s];
+    const Double_t *x = &block.fX[sel.fDim*fCapacity];
+    for (Int_t i=0; i<n; i++) {
+      if (!fPass[i]) continue;
+      Bool_t pass = sel.fMinIncluded ? x[i] >= sel.fMin : x[i] > sel.fMin;
+      if (pass) pass = sel.fMaxIncluded ? x[i] <= sel.fMax : x[i] < sel.fMax;
+      fPass[i] = pass;
+    }
+  }
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::FillProjection(Block &block, Projection &proj)
+{
+  // fill a derived histogram from the block, with the same contents
+  // and statistics as TH1::Fill (under/overflows are not counted in the statistics)
+
+  TH1 *h = proj.fHist;
+  const Int_t n = block.fN;
+  const Int_t nAxes = h->GetDimension();
+
+  SelectTuples(block, proj);
+
+  Bool_t bulk = (h->GetBuffer() == 0);
+#if ROOT_VERSION_CODE >= ROOT_VERSION(6,0,0)
+  if (h->CanExtendAllAxes()) bulk = kFALSE;
+#else
+  if (h->TestBit(TH1::kCanRebin)) bulk = kFALSE;
+#endif
+  if (!bulk) {
+    // buffered or extendable histograms: fill one by one
+    for (Int_t i=0; i<n; i++) {
+      if (!fPass[i]) continue;
+      const Double_t x = block.fX[proj.fDim[0]*fCapacity+i];
+      const Double_t w = block.fW[i];
+      if (nAxes==1) h->Fill(x, w);
+      else if (nAxes==2) ((TH2*)h)->Fill(x, block.fX[proj.fDim[1]*fCapacity+i], w);
+      else ((TH3*)h)->Fill(x, block.fX[proj.fDim[1]*fCapacity+i], block.fX[proj.fDim[2]*fCapacity+i], w);
+    }
+    return;
+  }
+
+  // weighted fills need the errors, as in TH1::Fill
+  if (!h->GetSumw2N() && !h->TestBit(TH1::kIsNotW)) {
+    for (Int_t i=0; i<n; i++) {
+      if (fPass[i] && block.fW[i]!=1.) { h->Sumw2(); break; }
+    }
+  }
+
+  TAxis *axes[3] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+  fBins.resize(nAxes*n);
+  for (Int_t a=0; a<nAxes; a++) FindBins(axes[a], &block.fX[proj.fDim[a]*fCapacity], n, &fBins[a*n]);
+
+  Double_t stats[TH1::kNstat];
+  for (Int_t s=0; s<TH1::kNstat; s++) stats[s] = 0.;
+  h->GetStats(stats);
+  const Double_t entries = h->GetEntries();
+  Double_t *sumw2 = h->GetSumw2N() ? h->GetSumw2()->GetArray() : 0;
+  Int_t nFilled = 0;
+  for (Int_t i=0; i<n; i++) {
+    if (!fPass[i]) continue;
+    nFilled++;
+    const Double_t w = block.fW[i];
+    const Int_t bx = fBins[i];
+    const Int_t by = nAxes>1 ? fBins[n+i] : 0;
+    const Int_t bz = nAxes>2 ? fBins[2*n+i] : 0;
+    const Int_t bin = h->GetBin(bx, by, bz);
+    h->AddBinContent(bin, w);
+    if (sumw2) sumw2[bin] += w*w;
+
+    // statistics, only for tuples inside the histogram range
+    if (bx==0 || bx>axes[0]->GetNbins()) continue;
+    if (nAxes>1 && (by==0 || by>axes[1]->GetNbins())) continue;
+    if (nAxes>2 && (bz==0 || bz>axes[2]->GetNbins())) continue;
+    const Double_t x = block.fX[proj.fDim[0]*fCapacity+i];
+    stats[0] += w;
+    stats[1] += w*w;
+    stats[2] += w*x;
+    stats[3] += w*x*x;
+    if (nAxes>1) {
+      const Double_t y = block.fX[proj.fDim[1]*fCapacity+i];
+      stats[4] += w*y;
+      stats[5] += w*y*y;
+      stats[6] += w*x*y;
+      if (nAxes>2) {
+        const Double_t z = block.fX[proj.fDim[2]*fCapacity+i];
+        stats[7] += w*z;
+        stats[8] += w*z*z;
+        stats[9] += w*x*z;
+        stats[10] += w*y*z;
+      }
+    }
+  }
+  h->PutStats(stats);
+  h->SetEntries(entries+nFilled);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceFillBuffer::ProjectAtTerminate(Block &block)
+{
+  // add the content of the projection sparse to the projections generated at terminate
+  // and reset it; the statistics are computed from the bin centres and the number
+  // of entries is the effective number of entries (the number of tuples for unit weights)
+
+  THnSparse *sparse = block.fProjSparse;
+  if (!sparse->GetNbins()) return;
+  const Int_t nSparseAxes = sparse->GetNdimensions();
+  const Int_t selAxis = block.fSelections.empty() ? -1 : nSparseAxes-1;
+  const Bool_t errors = sparse->GetCalculateErrors();
+  vector<Int_t> coord(nSparseAxes);
+
+  for (size_t ip=0; ip<block.fProjections.size(); ip++) {
+    Projection &proj = block.fProjections[ip];
+    if (!proj.fAtTerminate) continue;
+    TH1 *h = proj.fHist;
+    const Int_t nAxes = h->GetDimension();
+    Int_t sparseAxis[3] = {0, 0, 0};
+    for (Int_t a=0; a<nAxes; a++) sparseAxis[a] = block.fProjAxis[proj.fDim[a]];
+    if (errors && !h->GetSumw2N() && !h->TestBit(TH1::kIsNotW)) h->Sumw2();
+
+    TAxis *axes[3] = {h->GetXaxis(), h->GetYaxis(), h->GetZaxis()};
+    Double_t stats[TH1::kNstat];
+    for (Int_t s=0; s<TH1::kNstat; s++) stats[s] = 0.;
+    h->GetStats(stats);
+    const Double_t entries = h->GetEntries();
+    Double_t *sumw2 = h->GetSumw2N() ? h->GetSumw2()->GetArray() : 0;
+    Double_t sumw = 0., sumwSquared = 0.;
+    for (Long64_t i=0; i<sparse->GetNbins(); i++) {
+      const Double_t w = sparse->GetBinContent(i, &coord[0]);
+      if (proj.fSelectionBit>=0 && !((coord[selAxis]-1) & (1 << proj.fSelectionBit))) continue;
+      const Double_t w2 = sparse->GetBinError2(i);
+      sumw += w;
+      sumwSquared += w2;
+      const Int_t bx = coord[sparseAxis[0]];
+      const Int_t by = nAxes>1 ? coord[sparseAxis[1]] : 0;
+      const Int_t bz = nAxes>2 ? coord[sparseAxis[2]] : 0;
+      const Int_t bin = h->GetBin(bx, by, bz);
+      h->AddBinContent(bin, w);
+      if (sumw2) sumw2[bin] += w2;
+
+      if (bx==0 || bx>axes[0]->GetNbins()) continue;
+      if (nAxes>1 && (by==0 || by>axes[1]->GetNbins())) continue;
+      if (nAxes>2 && (bz==0 || bz>axes[2]->GetNbins())) continue;
+      const Double_t x = axes[0]->GetBinCenter(bx);
+      stats[0] += w;
+      stats[1] += w2;
+      stats[2] += w*x;
+      stats[3] += w*x*x;
+      if (nAxes>1) {
+        const Double_t y = axes[1]->GetBinCenter(by);
+        stats[4] += w*y;
+        stats[5] += w*y*y;
+        stats[6] += w*x*y;
+        if (nAxes>2) {
+          const Double_t z = axes[2]->GetBinCenter(bz);
+          stats[7] += w*z;
+          stats[8] += w*z*z;
+          stats[9] += w*x*z;
+          stats[10] += w*y*z;
+        }
+      }
+    }
+    h->PutStats(stats);
+    if (sumwSquared > 0.) h->SetEntries(entries + sumw*sumw/sumwSquared);
+  }
+  sparse->Reset();
+}
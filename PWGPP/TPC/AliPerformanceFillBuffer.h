@@ -0,0 +1,109 @@
+#ifndef ALIPERFORMANCEFILLBUFFER_H
+#define ALIPERFORMANCEFILLBUFFER_H
+
+//------------------------------------------------------------------------------
+// Fill buffer of the AliPerformanceObject histograms.
+//
+// The coordinate tuples of one fill site (block) are collected in columnar
+// arrays and applied in bulk at Flush(): the bin numbers of each axis are
+// computed in one pass per dimension, tuples falling into the same THnSparse
+// bin are combined, so that each bin is looked up only once, and the
+// registered derived histograms (projections with optional range selections)
+// are filled from the same arrays.
+//
+// Bin contents, errors, entries and statistics are the same as with per-tuple
+// Fill(). A weight different from 1 switches the errors on (Sumw2), as in
+// TH1::Fill. A THnSparse with errors also keeps the weighted sums of each
+// axis, which need the coordinates: it is filled tuple by tuple.
+//
+// With SetProjectAtTerminate() the derived histograms are not filled at each
+// flush: the tuples go to a sparse histogram made of the projection axes (and
+// of the selection result), and the projections are generated from it by
+// Flush(), which the owner calls before the histograms are read (Analyse,
+// Merge, end of the job). Contents and errors are the same as with the online
+// filling, the statistics are computed from the bin centres.
+//------------------------------------------------------------------------------
+
+#include <vector>
+
+#include "Rtypes.h"
+
+class TAxis;
+class TH1;
+class THnSparse;
+
+class AliPerformanceFillBuffer {
+public:
+  AliPerformanceFillBuffer(Int_t capacity=4096);
+  virtual ~AliPerformanceFillBuffer();
+
+  // register a block of nDim coordinates, optionally filling a THnSparse of nDim dimensions
+  Int_t AddBlock(Int_t nDim, THnSparse *sparse=0);
+  // register a histogram filled with dimensions (xDim,yDim,zDim) of the block tuples
+  Int_t AddProjection(Int_t block, TH1 *hist, Int_t xDim, Int_t yDim=-1, Int_t zDim=-1);
+  // fill the projection only for tuples with min <(=) x[dim] <(=) max
+  void  AddSelection(Int_t block, Int_t projection, Int_t dim, Double_t min, Double_t max, Bool_t minIncluded=kTRUE, Bool_t maxIncluded=kFALSE);
+
+  // generate the projections from a sparse histogram in Flush(), to be set before the registration
+  void  SetProjectAtTerminate(Bool_t project=kTRUE) { fProjectAtTerminate = project; }
+  Bool_t IsProjectAtTerminate() const { return fProjectAtTerminate; }
+
+  // buffer one tuple, the block is flushed when full
+  void  Fill(Int_t block, const Double_t *x, Double_t w=1.);
+  // apply all buffered tuples (and generate the projections at terminate)
+  void  Flush();
+
+  Int_t GetNBlocks() const { return fBlocks.size(); }
+  Int_t GetCapacity() const { return fCapacity; }
+
+private:
+  struct Selection {
+    Int_t    fDim;          // coordinate the selection is applied on
+    Double_t fMin;          // lower limit
+    Double_t fMax;          // upper limit
+    Bool_t   fMinIncluded;  // x >= fMin (otherwise x > fMin)
+    Bool_t   fMaxIncluded;  // x <= fMax (otherwise x < fMax)
+  };
+  struct Projection {
+    TH1  *fHist;                         // derived histogram
+    Int_t fDim[3];                       // block coordinates of the histogram axes (-1 if not used)
+    std::vector<Selection> fSelections;  // range selections
+    Bool_t fAtTerminate;                 // generated from the projection sparse
+    Int_t fSelectionBit;                 // bit of the selection in the projection sparse (-1: no selection)
+  };
+  struct Block {
+    Int_t      fNDim;                    // number of coordinates
+    THnSparse *fSparse;                  // sparse histogram (can be 0)
+    std::vector<Projection> fProjections;  // derived histograms
+    Int_t      fN;                       // number of buffered tuples
+    std::vector<Double_t> fX;            // coordinates, column by column: fX[dim*capacity+i]
+    std::vector<Double_t> fW;            // weights
+    Bool_t     fInitialised;             // projection sparse set up
+    THnSparse *fProjSparse;              // projection axes and selection result (owned, can be 0)
+    std::vector<Int_t> fProjDims;        // block coordinate of each axis of fProjSparse (-1: selection result)
+    std::vector<Int_t> fProjAxis;        // axis of fProjSparse of each block coordinate (-1 if not used)
+    std::vector<Int_t> fSelections;      // projection defining each selection bit
+  };
+
+  void InitBlock(Int_t iBlock);
+  void FlushBlock(Block &block);
+  void FillSparse(THnSparse *sparse, const std::vector<const Double_t*> &x, const Double_t *w, Int_t n);
+  void FillProjection(Block &block, Projection &proj);
+  void SelectTuples(const Block &block, const Projection &proj);
+  void ProjectAtTerminate(Block &block);
+  static void FindBins(const TAxis *axis, const Double_t *x, Int_t n, Int_t *bins);
+  static Bool_t IsSameBinning(const TAxis *a1, const TAxis *a2);
+  static Bool_t IsSameSelection(const Projection &p1, const Projection &p2);
+
+  Int_t fCapacity;             // tuples per block
+  Bool_t fProjectAtTerminate;  // generate the projections in Flush()
+  std::vector<Block> fBlocks;  // registered blocks
+  std::vector<Int_t> fBins;    // work array: bins of all coordinates of a block
+  std::vector<Bool_t> fPass;   // work array: selection result
+  std::vector<Double_t> fSelectionResult;  // work array: selection bits of each tuple
+
+  AliPerformanceFillBuffer(const AliPerformanceFillBuffer&); // not implemented
+  AliPerformanceFillBuffer& operator=(const AliPerformanceFillBuffer&); // not implemented
+};
+
+#endif
@@ -35,6 +35,7 @@
 
 #include "AliLog.h" 
 #include "AliPerformanceObject.h" 
+#include "AliPerformanceFillBuffer.h"
 
 using namespace std;
 
@@ -55,6 +56,9 @@ AliPerformanceObject::AliPerformanceObject(TRootIOCtor*):
   fUseCentralityBin(0),
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
+  fUseFillBuffer(kFALSE),
+  fProjectAtTerminate(kFALSE),
+  fFillBuffer(0),
   fCutsRC(),
   fCutsMC()
 {
@@ -76,6 +80,9 @@ AliPerformanceObject::AliPerformanceObject(const char* name, const char* title,
   fUseCentralityBin(0),
   fUseTOFBunchCrossing(kFALSE),
   fUseSparse(1),
+  fUseFillBuffer(kFALSE),
+  fProjectAtTerminate(kFALSE),
+  fFillBuffer(0),
   fCutsRC(),
   fCutsMC()
 {
@@ -86,6 +93,26 @@ AliPerformanceObject::AliPerformanceObject(const char* name, const char* title,
 //_____________________________________________________________________________
 AliPerformanceObject::~AliPerformanceObject(){
   // destructor 
+  delete fFillBuffer;
+}
+
+//_____________________________________________________________________________
+AliPerformanceFillBuffer* AliPerformanceObject::GetFillBuffer() {
+  // create the fill buffer at the first call
+  if(!fUseFillBuffer) return 0;
+  if(!fFillBuffer) {
+    fFillBuffer = new AliPerformanceFillBuffer();
+    fFillBuffer->SetProjectAtTerminate(fProjectAtTerminate);
+    RegisterFillBuffer(fFillBuffer);
+  }
+  return fFillBuffer;
+}
+
+//_____________________________________________________________________________
+void AliPerformanceObject::FlushFillBuffer() {
+  // apply the buffered histogram fills
+  // and generate the derived histograms at terminate
+  if(fFillBuffer) fFillBuffer->Flush();
 }
 
 //_____________________________________________________________________________
@@ -23,6 +23,7 @@ class AliMCInfoCuts;
 class AliVfriendEvent;
 class AliESDVertex;
 class TRootIOCtor;
+class AliPerformanceFillBuffer;
 #include "AliRecInfoCuts.h"
 #include "AliMCInfoCuts.h"
 
@@ -117,6 +118,15 @@ public :
   Bool_t IsUseTOFBunchCrossing() { return fUseTOFBunchCrossing; }
 
   virtual void ResetOutputData() { ; }
+
+  // buffered filling of the output histograms (see AliPerformanceFillBuffer)
+  void SetUseFillBuffer(Bool_t useBuffer = kTRUE) { fUseFillBuffer = useBuffer; }
+  Bool_t IsUseFillBuffer() const { return fUseFillBuffer; }
+  // with the fill buffer, generate the derived histograms from a sparse at terminate
+  void SetProjectAtTerminate(Bool_t project = kTRUE) { fProjectAtTerminate = project; }
+  Bool_t IsProjectAtTerminate() const { return fProjectAtTerminate; }
+  // apply the buffered fills, needed before the histograms are read
+  void FlushFillBuffer();
     
 protected: 
 
@@ -124,6 +134,11 @@ protected:
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, TString* selString = 0);
   void AddProjection(TObjArray* aFolderObj, TString nameSparse, THnSparse *hSparse, Int_t xDim, Int_t yDim, Int_t zDim, TString* selString = 0);
 
+  // fill buffer, created at the first call (0 if not used)
+  AliPerformanceFillBuffer* GetFillBuffer();
+  // register the blocks of the fill buffer, called once when the buffer is created
+  virtual void RegisterFillBuffer(AliPerformanceFillBuffer* /*buffer*/) { ; }
+
   // merge THnSparse
   Bool_t fMergeTHnSparseObj;
   
@@ -150,12 +165,15 @@ protected:
 
   Bool_t fUseTOFBunchCrossing; // use TOFBunchCrossing, default is yes
   Bool_t fUseSparse;
+  Bool_t fUseFillBuffer; // buffer the histogram fills, default is no
+  Bool_t fProjectAtTerminate; // derived histograms generated at terminate, default is no
+  AliPerformanceFillBuffer* fFillBuffer; //! fill buffer
 
   // Global cuts objects
   AliRecInfoCuts fCutsRC;  // selection cuts for reconstructed tracks
   AliMCInfoCuts  fCutsMC;  // selection cuts for MC tracks
 
-  ClassDef(AliPerformanceObject,11);
+  ClassDef(AliPerformanceObject,13);
 };
 
 #endif
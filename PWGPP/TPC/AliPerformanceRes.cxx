@@ -75,7 +75,9 @@ AliPerformanceRes::AliPerformanceRes(TRootIOCtor* b):
   // histogram folder 
   fAnalysisFolder(0),
   fValidLabels(NULL),
-  fComparisonContainer(NULL)
+  fComparisonContainer(NULL),
+  fResolBlock(-1),
+  fPullBlock(-1)
 {
   // io constructor	
 }
@@ -89,7 +91,9 @@ AliPerformanceRes::AliPerformanceRes(const Char_t* name, const Char_t* title, In
   // histogram folder 
   fAnalysisFolder(0),
   fValidLabels(NULL),
-  fComparisonContainer(NULL)
+  fComparisonContainer(NULL),
+  fResolBlock(-1),
+  fPullBlock(-1)
 {
   // named constructor	
   // 
@@ -314,10 +318,10 @@ void AliPerformanceRes::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     else pull1PtTPC = 0.; 
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
   }
 }
 
@@ -410,10 +414,10 @@ void AliPerformanceRes::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
 
    
     /*
@@ -437,10 +441,10 @@ void AliPerformanceRes::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,delta1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
     */
   }
 }
@@ -536,10 +540,10 @@ void AliPerformanceRes::ProcessConstrained(AliMCEvent* const mcev, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,particle->Vy(),particle->Vz(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
 
     /*
 
@@ -564,10 +568,10 @@ void AliPerformanceRes::ProcessConstrained(AliMCEvent* const mcev, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,delta1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,particle->Vy(),particle->Vz(),mceta,mcphi,mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
 
     */
   }
@@ -738,10 +742,10 @@ void AliPerformanceRes::ProcessInnerTPC(AliMCEvent *const mcEvent, AliVTrack *co
     }
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
   }
 
   if(track) delete track;
@@ -860,10 +864,10 @@ void AliPerformanceRes::ProcessOuterTPC(AliMCEvent *const mcEvent, AliVTrack *co
     else pull1PtTPC = 0.;
 
     Double_t vResolHisto[10] = {deltaYTPC,deltaZTPC,deltaPhiTPC,deltaLambdaTPC,deltaPtTPC,ref0->Y(),ref0->Z(),mcphi,mceta,mcpt};
-    fResolHisto->Fill(vResolHisto);
+    FillHisto(fResolHisto,fResolBlock,vResolHisto);
 
     Double_t vPullHisto[10] = {pullYTPC,pullZTPC,pullPhiTPC,pullLambdaTPC,pull1PtTPC,ref0->Y(),ref0->Z(),mcsnp,mctgl,1./mcpt};
-    fPullHisto->Fill(vPullHisto);
+    FillHisto(fPullHisto,fPullBlock,vPullHisto);
   }
 
   if(track) delete track;
@@ -1103,6 +1107,7 @@ void AliPerformanceRes::Analyse() {
   // Analyse comparison information and store output histograms
   // in the folder "folderRes"
   //
+  FlushFillBuffer();
   TH1::AddDirectory(kFALSE);
   TH1F *h=0;
   TH2F *h2D=0;
@@ -1249,6 +1254,25 @@ TFolder* AliPerformanceRes::ExportToFolder(TObjArray * array)
 return newFolder;
 }
 
+//_____________________________________________________________________________
+void AliPerformanceRes::FillHisto(THnSparse *hist, Int_t block, const Double_t *x)
+{
+  // Fill the resolution or pull histogram, directly or through the fill buffer
+
+  AliPerformanceFillBuffer *buffer = GetFillBuffer();
+  if(buffer) buffer->Fill(block,x);
+  else hist->Fill(x);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceRes::RegisterFillBuffer(AliPerformanceFillBuffer *buffer)
+{
+  // Register the resolution and pull histograms in the fill buffer
+
+  fResolBlock = buffer->AddBlock(10,fResolHisto);
+  fPullBlock = buffer->AddBlock(10,fPullHisto);
+}
+
 //_____________________________________________________________________________
 Long64_t AliPerformanceRes::Merge(TCollection* const list) 
 {
@@ -1259,6 +1283,7 @@ Long64_t AliPerformanceRes::Merge(TCollection* const list)
 
   if (list->IsEmpty())
   return 1;
+  FlushFillBuffer();
 
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
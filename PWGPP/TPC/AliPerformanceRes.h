@@ -78,6 +78,9 @@ public :
     float mcX, mcY, mcZ, mcPt, mcPhi, mcDzds, deltaY, deltaZ, deltaPhi, deltaDzds, deltaPt, oldX, oldY, oldZ, nCls;
   };
 
+protected:
+  virtual void RegisterFillBuffer(AliPerformanceFillBuffer *buffer);
+
 private:
   //
   // Control histograms
@@ -99,8 +102,12 @@ private:
   static Double_t            fgkMergeEntriesCut;  //maximal number of entries for merging  -can be modified via setter
   char* fValidLabels; //!
   comparisonContainer* fComparisonContainer; //!
+  Int_t fResolBlock; //! resolution block of the fill buffer
+  Int_t fPullBlock; //! pull block of the fill buffer
+
+  void FillHisto(THnSparse *hist, Int_t block, const Double_t *x);
   
-  ClassDef(AliPerformanceRes,4);
+  ClassDef(AliPerformanceRes,5);
 };
 
 #endif
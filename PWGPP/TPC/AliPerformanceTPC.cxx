@@ -51,6 +51,7 @@
 #include "AliTPCPerformanceSummary.h"
 #include "TSystem.h"
 #include "AliPerformanceTPC.h"
+#include "AliPerformanceFillBuffer.h"
 #include "AliVEvent.h" 
 #include "AliVTrack.h"
 #include "AliVVertex.h"
@@ -118,7 +119,9 @@ AliPerformanceTPC::AliPerformanceTPC(TRootIOCtor*):
   h_tpc_track_pos_recvertex_3_5_6(NULL),
   h_tpc_track_pos_recvertex_4_5_6(NULL),
   h_tpc_track_neg_recvertex_3_5_6(NULL),
-  h_tpc_track_neg_recvertex_4_5_6(NULL)
+  h_tpc_track_neg_recvertex_4_5_6(NULL),
+  fClustBlock(-1),
+  fTrackBlock(-1)
 {
   // io ctor
 }
@@ -162,7 +165,9 @@ AliPerformanceTPC::AliPerformanceTPC(const Char_t* name, const Char_t* title,Int
   h_tpc_track_pos_recvertex_3_5_6(NULL),
   h_tpc_track_pos_recvertex_4_5_6(NULL),
   h_tpc_track_neg_recvertex_3_5_6(NULL),
-  h_tpc_track_neg_recvertex_4_5_6(NULL)
+  h_tpc_track_neg_recvertex_4_5_6(NULL),
+  fClustBlock(-1),
+  fTrackBlock(-1)
 {
 
 // named constructor
@@ -628,37 +633,7 @@ void AliPerformanceTPC::ProcessTPC(AliMCEvent* const mcev, AliVTrack *const vTra
     if(q > 0.000001) fMultP++;
     else if(q < 0.000001) fMultN++;
     
-    if(fUseSparse) {
-      fTPCTrackHisto->Fill(vTPCTrackHisto);
-    } else {
-        if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
-        if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
-        double q = vTPCTrackHisto[8];
-            
-        if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-            
-        if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-            
-        if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        
-    }
+    FillTrackHisto(vTPCTrackHisto);
     //
   // Fill rec vs MC information
   //
@@ -728,41 +703,104 @@ void AliPerformanceTPC::ProcessTPCITS(AliMCEvent* const mcev, AliVTrack *const v
     if(q > 0.000001) fMultP++;
     else if(q < 0.000001) fMultN++;
     
+    FillTrackHisto(vTPCTrackHisto);
+  //
+  // Fill rec vs MC information
+  //
+  if(!mcev) return;
+}
+
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::FillTrackHisto(const Double_t *vTPCTrackHisto)
+{
+  // Fill the track histograms
+  // nClust:chi2PerClust:nClust/nFindableClust:DCAr:DCAz:eta:phi:pt:charge:vertStatus
+
+    AliPerformanceFillBuffer *buffer = GetFillBuffer();
+    if(buffer) {
+      buffer->Fill(fTrackBlock,vTPCTrackHisto);
+      return;
+    }
+
     if(fUseSparse) {
       fTPCTrackHisto->Fill(vTPCTrackHisto);
-    } else {
-        if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
-        if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        
-        double q = vTPCTrackHisto[8];
-        
-        if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+      return;
+    }
+
+    if(h_tpc_track_all_recvertex_5_8) h_tpc_track_all_recvertex_5_8->Fill(vTPCTrackHisto[5],vTPCTrackHisto[8]);
+    if(h_tpc_track_all_recvertex_1_5_7) h_tpc_track_all_recvertex_1_5_7->Fill(vTPCTrackHisto[1],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    if(h_tpc_track_all_recvertex_2_5_7) h_tpc_track_all_recvertex_2_5_7->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         
-        if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    double q = vTPCTrackHisto[8];
         
-        if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
-        else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    if (h_tpc_track_all_recvertex_0_5_7) h_tpc_track_all_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    if(q > 0 && h_tpc_track_pos_recvertex_0_5_7) h_tpc_track_pos_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    else if (h_tpc_track_neg_recvertex_0_5_7) h_tpc_track_neg_recvertex_0_5_7->Fill(vTPCTrackHisto[0],vTPCTrackHisto[5],vTPCTrackHisto[7]);
         
-        if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+    if(h_tpc_track_all_recvertex_3_5_7) h_tpc_track_all_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    if(q > 0 && h_tpc_track_pos_recvertex_3_5_7) h_tpc_track_pos_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    else if(h_tpc_track_neg_recvertex_3_5_7) h_tpc_track_neg_recvertex_3_5_7->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    
+    if(h_tpc_track_all_recvertex_4_5_7) h_tpc_track_all_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    if(q > 0 && h_tpc_track_pos_recvertex_4_5_7) h_tpc_track_pos_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    else if(h_tpc_track_neg_recvertex_4_5_7) h_tpc_track_neg_recvertex_4_5_7->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[7]);
+    
+    if(q > 0 && h_tpc_track_pos_recvertex_3_5_6) h_tpc_track_pos_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+    else if(h_tpc_track_neg_recvertex_3_5_6) h_tpc_track_neg_recvertex_3_5_6->Fill(vTPCTrackHisto[3],vTPCTrackHisto[5],vTPCTrackHisto[6]);
         
-        if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+    if(q > 0 && h_tpc_track_pos_recvertex_4_5_6) h_tpc_track_pos_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+    else if(h_tpc_track_neg_recvertex_4_5_6) h_tpc_track_neg_recvertex_4_5_6->Fill(vTPCTrackHisto[4],vTPCTrackHisto[5],vTPCTrackHisto[6]);
         
-        if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-        else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
-    
+    if(q > 0 && h_tpc_track_pos_recvertex_2_5_6) h_tpc_track_pos_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+    else if(h_tpc_track_neg_recvertex_2_5_6) h_tpc_track_neg_recvertex_2_5_6->Fill(vTPCTrackHisto[2],vTPCTrackHisto[5],vTPCTrackHisto[6]);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::RegisterFillBuffer(AliPerformanceFillBuffer *buffer)
+{
+  // Register the cluster and track histograms in the fill buffer,
+  // with the same selections as the direct filling
+
+    if(fUseSparse) {
+      fClustBlock = buffer->AddBlock(3,fTPCClustHisto);
+      fTrackBlock = buffer->AddBlock(10,fTPCTrackHisto);
+      return;
     }
-  //
-  // Fill rec vs MC information
-  //
-  if(!mcev) return;
+
+    fClustBlock = buffer->AddBlock(3);
+    if(h_tpc_clust_0_1_2) buffer->AddProjection(fClustBlock,h_tpc_clust_0_1_2,0,1,2);
+
+    fTrackBlock = buffer->AddBlock(10);
+    if(h_tpc_track_all_recvertex_5_8) buffer->AddProjection(fTrackBlock,h_tpc_track_all_recvertex_5_8,5,8);
+    RegisterTrackProjection(buffer,h_tpc_track_all_recvertex_0_5_7,0,5,7,0);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_0_5_7,0,5,7,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_0_5_7,0,5,7,-1);
+    RegisterTrackProjection(buffer,h_tpc_track_all_recvertex_1_5_7,1,5,7,0);
+    RegisterTrackProjection(buffer,h_tpc_track_all_recvertex_2_5_7,2,5,7,0);
+    RegisterTrackProjection(buffer,h_tpc_track_all_recvertex_3_5_7,3,5,7,0);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_3_5_7,3,5,7,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_3_5_7,3,5,7,-1);
+    RegisterTrackProjection(buffer,h_tpc_track_all_recvertex_4_5_7,4,5,7,0);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_4_5_7,4,5,7,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_4_5_7,4,5,7,-1);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_3_5_6,3,5,6,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_3_5_6,3,5,6,-1);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_4_5_6,4,5,6,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_4_5_6,4,5,6,-1);
+    RegisterTrackProjection(buffer,h_tpc_track_pos_recvertex_2_5_6,2,5,6,1);
+    RegisterTrackProjection(buffer,h_tpc_track_neg_recvertex_2_5_6,2,5,6,-1);
+}
+
+//_____________________________________________________________________________
+void AliPerformanceTPC::RegisterTrackProjection(AliPerformanceFillBuffer *buffer, TH3D *hist, Int_t xDim, Int_t yDim, Int_t zDim, Int_t charge)
+{
+  // Register a track histogram, charge: 0 all, 1 positive (q>0), -1 negative (q<=0)
+
+    if(!hist) return;
+    Int_t proj = buffer->AddProjection(fTrackBlock,hist,xDim,yDim,zDim);
+    if(charge > 0) buffer->AddSelection(fTrackBlock,proj,8,0.,TMath::Infinity(),kFALSE,kFALSE);
+    else if(charge < 0) buffer->AddSelection(fTrackBlock,proj,8,-TMath::Infinity(),0.,kFALSE,kTRUE);
 }
 
 
@@ -902,7 +940,9 @@ void AliPerformanceTPC::Exec(AliMCEvent* const mcEvent, AliVEvent *const vEvent,
 	    //Int_t detector = cluster->GetDetector();
 	    //Double_t vTPCClust[6] = { irow, phi, TPCside, pad, detector, gclf[2] };
 	    Double_t vTPCClust[3] = { static_cast<Double_t>(irow), phi, static_cast<Double_t>(TPCside) };
-	    if(fUseSparse) fTPCClustHisto->Fill(vTPCClust);
+	    AliPerformanceFillBuffer *buffer = GetFillBuffer();
+	    if(buffer) buffer->Fill(fClustBlock,vTPCClust);
+	    else if(fUseSparse) fTPCClustHisto->Fill(vTPCClust);
 	    else{
 	      h_tpc_clust_0_1_2->Fill(vTPCClust[0],vTPCClust[1],vTPCClust[2]);
 	    }
@@ -946,6 +986,7 @@ void AliPerformanceTPC::Analyse()
     // Analyse comparison information and store output histograms
     // in the folder "folderTPC"
     //
+    FlushFillBuffer();
 //    TH1::AddDirectory(kFALSE);
 //    TH1::SetDefaultSumw2(kFALSE);
 
@@ -1108,6 +1149,7 @@ Long64_t AliPerformanceTPC::Merge(TCollection* list)
   return 1;
   
   Bool_t merge = ((fgUseMergeTHnSparse && fgMergeTHnSparse) || (!fgUseMergeTHnSparse && fMergeTHnSparseObj));
+  FlushFillBuffer();
 
   TIterator* iter = list->MakeIterator();
   TObject* obj = 0;
@@ -1163,6 +1205,8 @@ TTree* AliPerformanceTPC::CreateSummary()
 
 void AliPerformanceTPC::ResetOutputData(){
 
+    FlushFillBuffer();
+
     if(fUseSparse){
         if(fTPCClustHisto) fTPCClustHisto->Reset("ICE");
         if(fTPCEventHisto) fTPCEventHisto->Reset("ICE");
@@ -82,6 +82,9 @@ public :
   TCollection* GetListOfDrawableObjects();
   virtual void ResetOutputData();
 
+protected:
+  virtual void RegisterFillBuffer(AliPerformanceFillBuffer *buffer);
+
     
 private:
 
@@ -132,10 +135,16 @@ private:
   TH3D *h_tpc_track_neg_recvertex_3_5_6;//!
   TH3D *h_tpc_track_neg_recvertex_4_5_6;//!
 
+  Int_t fClustBlock; //! cluster block of the fill buffer
+  Int_t fTrackBlock; //! track block of the fill buffer
+
+  void FillTrackHisto(const Double_t *vTPCTrackHisto);
+  void RegisterTrackProjection(AliPerformanceFillBuffer *buffer, TH3D *hist, Int_t xDim, Int_t yDim, Int_t zDim, Int_t charge);
+
   AliPerformanceTPC(const AliPerformanceTPC&); // not implemented
   AliPerformanceTPC& operator=(const AliPerformanceTPC&); // not implemented
 
-  ClassDef(AliPerformanceTPC,15);
+  ClassDef(AliPerformanceTPC,16);
 };
 
 #endif
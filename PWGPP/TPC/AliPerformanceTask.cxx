@@ -343,6 +343,7 @@ void AliPerformanceTask::FinishTaskOutput()
       itOut->Reset();
       while(( pObj = dynamic_cast<AliPerformanceObject*>(itOut->Next())) != NULL) {
           //pObj->SetRunNumber(fCurrentRunNumber);
+          pObj->FlushFillBuffer();
           pObj->Analyse();
       }
     
@@ -418,6 +419,7 @@ Bool_t AliPerformanceTask::ResetOutputData(){
     itOut->Reset();
 
     while(( pObj = dynamic_cast<AliPerformanceObject*>(itOut->Next())) != NULL) {
+      pObj->FlushFillBuffer();
       pObj->ResetOutputData();
     }
 